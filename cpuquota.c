@@ -0,0 +1,35 @@
+#include "types.h"
+#include "stat.h"
+#include "user.h"
+#include "param.h"
+
+int
+main(int argc, char *argv[])
+{
+  struct groupinfo gi;
+  int g;
+
+  if(argc == 3){
+    if(setgroup(atoi(argv[2]), atoi(argv[1])) < 0)
+      printf(2, "cpuquota: setgroup failed\n");
+    exit();
+  }
+  if(argc == 4){
+    if(setquota(atoi(argv[1]), atoi(argv[2]), atoi(argv[3])) < 0)
+      printf(2, "cpuquota: setquota failed\n");
+    exit();
+  }
+  if(argc != 1){
+    printf(2, "Usage: cpuquota [gid pid | gid quota_us period_us]\n");
+    exit();
+  }
+
+  printf(1, "gid nproc quota_us period_us used_us throttled "
+            "nthrottled throttled_ms\n");
+  for(g = 0; g < NGROUP; g++)
+    if(groupinfo(g, &gi) == 0)
+      printf(1, "%d %d %d %d %d %d %d %d\n", g, gi.nproc, gi.quota_us,
+             gi.period_us, gi.used_us, gi.throttled, gi.nthrottled,
+             gi.throttled_ms);
+  exit();
+}
@@ -0,0 +1,1450 @@
+
+_cpustat:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+  printf(1, " %d.%d%d", x >> 11, f / 10, f % 10);
+}
+
+int
+main(int argc, char *argv[])
+{
+   0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+   4:	83 e4 f0             	and    $0xfffffff0,%esp
+   7:	ff 71 fc             	push   -0x4(%ecx)
+   a:	55                   	push   %ebp
+   b:	89 e5                	mov    %esp,%ebp
+   d:	57                   	push   %edi
+   e:	56                   	push   %esi
+   f:	53                   	push   %ebx
+  10:	51                   	push   %ecx
+  11:	81 ec b8 00 00 00    	sub    $0xb8,%esp
+  struct telemetry st;
+  struct cpuinfo ci;
+  struct cpustat cs;
+  int count = 0;
+  int i;
+  uint seq = 0;
+  17:	c7 85 4c ff ff ff 00 	movl   $0x0,-0xb4(%ebp)
+  1e:	00 00 00 
+  21:	c7 85 44 ff ff ff 0a 	movl   $0xa,-0xbc(%ebp)
+  28:	00 00 00 
+  2b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  2f:	90                   	nop
+
+  // Print 10 reports, one per analytics period.  telemetry() blocks
+  // until the kernel has a new sample, so none are skipped.
+  while(count < 10) {
+    if(telemetry(&seq, &st, 1) != 1) {
+  30:	83 ec 04             	sub    $0x4,%esp
+  33:	8d 85 78 ff ff ff    	lea    -0x88(%ebp),%eax
+  39:	6a 01                	push   $0x1
+  3b:	50                   	push   %eax
+  3c:	8d 85 4c ff ff ff    	lea    -0xb4(%ebp),%eax
+  42:	50                   	push   %eax
+  43:	e8 7b 05 00 00       	call   5c3 <telemetry>
+  48:	83 c4 10             	add    $0x10,%esp
+  4b:	83 f8 01             	cmp    $0x1,%eax
+  4e:	0f 85 45 02 00 00    	jne    299 <main+0x299>
+      printf(2, "cpustat: telemetry failed\n");
+      exit();
+    }
+
+    // Print the report
+    printf(1, "--- SPAS-xv6 Scheduler Status (tick %d) ---\n", st.tick);
+  54:	83 ec 04             	sub    $0x4,%esp
+  57:	ff 75 80             	push   -0x80(%ebp)
+  5a:	68 9c 0a 00 00       	push   $0xa9c
+  5f:	6a 01                	push   $0x1
+  61:	e8 4a 06 00 00       	call   6b0 <printf>
+    if(st.dropped)
+  66:	8b 85 7c ff ff ff    	mov    -0x84(%ebp),%eax
+  6c:	83 c4 10             	add    $0x10,%esp
+  6f:	85 c0                	test   %eax,%eax
+  71:	0f 85 91 01 00 00    	jne    208 <main+0x208>
+      printf(1, "(%d samples dropped)\n", st.dropped);
+    printf(1, "CPU Load:     %d%%\n", st.load);
+  77:	83 ec 04             	sub    $0x4,%esp
+  7a:	ff 75 84             	push   -0x7c(%ebp)
+    printf(1, "Pred. Load:   %d%%\n", st.predicted_load);
+    printf(1, "Frequency:    %s\n", freq_str[st.frequency_level]);
+    // UPDATED LINE: Print temperature with one decimal place
+    printf(1, "Virtual Temp: %d.%d C\n", st.temp / 10, st.temp % 10);
+    printf(1, "Thresholds:   L->M %d%%, M->H %d%%\n", st.thresh_low_med, st.thresh_med_high);
+    if(cpustat(&cs) == 0)
+  7d:	8d 9d 50 ff ff ff    	lea    -0xb0(%ebp),%ebx
+    printf(1, "CPU Load:     %d%%\n", st.load);
+  83:	68 13 0a 00 00       	push   $0xa13
+  88:	6a 01                	push   $0x1
+  8a:	e8 21 06 00 00       	call   6b0 <printf>
+    printf(1, "Pred. Load:   %d%%\n", st.predicted_load);
+  8f:	83 c4 0c             	add    $0xc,%esp
+  92:	ff 75 88             	push   -0x78(%ebp)
+  95:	68 27 0a 00 00       	push   $0xa27
+  9a:	6a 01                	push   $0x1
+  9c:	e8 0f 06 00 00       	call   6b0 <printf>
+    printf(1, "Frequency:    %s\n", freq_str[st.frequency_level]);
+  a1:	8b 45 8c             	mov    -0x74(%ebp),%eax
+  a4:	83 c4 0c             	add    $0xc,%esp
+  a7:	ff 34 85 84 0e 00 00 	push   0xe84(,%eax,4)
+  ae:	68 3b 0a 00 00       	push   $0xa3b
+  b3:	6a 01                	push   $0x1
+  b5:	e8 f6 05 00 00       	call   6b0 <printf>
+    printf(1, "Virtual Temp: %d.%d C\n", st.temp / 10, st.temp % 10);
+  ba:	8b 4d 90             	mov    -0x70(%ebp),%ecx
+  bd:	b8 67 66 66 66       	mov    $0x66666667,%eax
+  c2:	f7 e9                	imul   %ecx
+  c4:	89 c8                	mov    %ecx,%eax
+  c6:	c1 f8 1f             	sar    $0x1f,%eax
+  c9:	c1 fa 02             	sar    $0x2,%edx
+  cc:	29 c2                	sub    %eax,%edx
+  ce:	8d 04 92             	lea    (%edx,%edx,4),%eax
+  d1:	01 c0                	add    %eax,%eax
+  d3:	29 c1                	sub    %eax,%ecx
+  d5:	51                   	push   %ecx
+  d6:	52                   	push   %edx
+  d7:	68 4d 0a 00 00       	push   $0xa4d
+  dc:	6a 01                	push   $0x1
+  de:	e8 cd 05 00 00       	call   6b0 <printf>
+    printf(1, "Thresholds:   L->M %d%%, M->H %d%%\n", st.thresh_low_med, st.thresh_med_high);
+  e3:	83 c4 20             	add    $0x20,%esp
+  e6:	ff 75 98             	push   -0x68(%ebp)
+  e9:	ff 75 94             	push   -0x6c(%ebp)
+  ec:	68 cc 0a 00 00       	push   $0xacc
+  f1:	6a 01                	push   $0x1
+  f3:	e8 b8 05 00 00       	call   6b0 <printf>
+    if(cpustat(&cs) == 0)
+  f8:	89 1c 24             	mov    %ebx,(%esp)
+  fb:	e8 93 04 00 00       	call   593 <cpustat>
+ 100:	83 c4 10             	add    $0x10,%esp
+ 103:	85 c0                	test   %eax,%eax
+ 105:	0f 84 15 01 00 00    	je     220 <main+0x220>
+    for(i = 0; cpuinfo(i, &ci) == 0; i++){
+      printf(1, "  cpu%d: load %d%% %s temp %d.%d C cap %d.%d, %d moved off hot\n",
+             i, ci.load, freq_str[ci.frequency_level], ci.temp / 10,
+             ci.temp % 10, ci.thermal_cap / 256,
+             (ci.thermal_cap % 256) * 10 / 256, ci.thermal_migrations);
+      printf(1, "        energy %d mJ, ticks L/M/H %d/%d/%d idle %d parked %d "
+ 10b:	31 db                	xor    %ebx,%ebx
+ 10d:	8d 75 a8             	lea    -0x58(%ebp),%esi
+ 110:	e9 b5 00 00 00       	jmp    1ca <main+0x1ca>
+ 115:	8d 76 00             	lea    0x0(%esi),%esi
+             (ci.thermal_cap % 256) * 10 / 256, ci.thermal_migrations);
+ 118:	8b 55 bc             	mov    -0x44(%ebp),%edx
+      printf(1, "  cpu%d: load %d%% %s temp %d.%d C cap %d.%d, %d moved off hot\n",
+ 11b:	83 ec 08             	sub    $0x8,%esp
+             ci.temp % 10, ci.thermal_cap / 256,
+ 11e:	8b 4d b8             	mov    -0x48(%ebp),%ecx
+      printf(1, "  cpu%d: load %d%% %s temp %d.%d C cap %d.%d, %d moved off hot\n",
+ 121:	ff 75 e4             	push   -0x1c(%ebp)
+             (ci.thermal_cap % 256) * 10 / 256, ci.thermal_migrations);
+ 124:	89 d7                	mov    %edx,%edi
+ 126:	c1 ff 1f             	sar    $0x1f,%edi
+ 129:	c1 ef 18             	shr    $0x18,%edi
+ 12c:	8d 04 3a             	lea    (%edx,%edi,1),%eax
+ 12f:	0f b6 c0             	movzbl %al,%eax
+ 132:	29 f8                	sub    %edi,%eax
+ 134:	8d 3c 80             	lea    (%eax,%eax,4),%edi
+ 137:	01 ff                	add    %edi,%edi
+      printf(1, "  cpu%d: load %d%% %s temp %d.%d C cap %d.%d, %d moved off hot\n",
+ 139:	8d 87 ff 00 00 00    	lea    0xff(%edi),%eax
+ 13f:	0f 49 c7             	cmovns %edi,%eax
+ 142:	c1 f8 08             	sar    $0x8,%eax
+ 145:	85 d2                	test   %edx,%edx
+ 147:	50                   	push   %eax
+ 148:	8d 82 ff 00 00 00    	lea    0xff(%edx),%eax
+ 14e:	0f 49 c2             	cmovns %edx,%eax
+ 151:	c1 f8 08             	sar    $0x8,%eax
+ 154:	50                   	push   %eax
+ 155:	b8 67 66 66 66       	mov    $0x66666667,%eax
+ 15a:	f7 e9                	imul   %ecx
+ 15c:	89 c8                	mov    %ecx,%eax
+ 15e:	c1 f8 1f             	sar    $0x1f,%eax
+ 161:	c1 fa 02             	sar    $0x2,%edx
+ 164:	29 c2                	sub    %eax,%edx
+ 166:	8d 04 92             	lea    (%edx,%edx,4),%eax
+ 169:	01 c0                	add    %eax,%eax
+ 16b:	29 c1                	sub    %eax,%ecx
+ 16d:	51                   	push   %ecx
+ 16e:	52                   	push   %edx
+ 16f:	8b 45 b4             	mov    -0x4c(%ebp),%eax
+ 172:	ff 34 85 84 0e 00 00 	push   0xe84(,%eax,4)
+ 179:	ff 75 a8             	push   -0x58(%ebp)
+ 17c:	53                   	push   %ebx
+ 17d:	68 f0 0a 00 00       	push   $0xaf0
+ 182:	6a 01                	push   $0x1
+ 184:	e8 27 05 00 00       	call   6b0 <printf>
+      printf(1, "        energy %d mJ, ticks L/M/H %d/%d/%d idle %d parked %d "
+ 189:	8b 45 e0             	mov    -0x20(%ebp),%eax
+ 18c:	83 c4 28             	add    $0x28,%esp
+ 18f:	b9 26 0a 00 00       	mov    $0xa26,%ecx
+ 194:	85 c0                	test   %eax,%eax
+ 196:	b8 d8 09 00 00       	mov    $0x9d8,%eax
+ 19b:	0f 44 c1             	cmove  %ecx,%eax
+    for(i = 0; cpuinfo(i, &ci) == 0; i++){
+ 19e:	83 c3 01             	add    $0x1,%ebx
+      printf(1, "        energy %d mJ, ticks L/M/H %d/%d/%d idle %d parked %d "
+ 1a1:	50                   	push   %eax
+ 1a2:	ff 75 dc             	push   -0x24(%ebp)
+ 1a5:	ff 75 d8             	push   -0x28(%ebp)
+ 1a8:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+ 1ab:	03 45 d0             	add    -0x30(%ebp),%eax
+ 1ae:	50                   	push   %eax
+ 1af:	ff 75 cc             	push   -0x34(%ebp)
+ 1b2:	ff 75 c8             	push   -0x38(%ebp)
+ 1b5:	ff 75 c4             	push   -0x3c(%ebp)
+ 1b8:	ff 75 c0             	push   -0x40(%ebp)
+ 1bb:	68 30 0b 00 00       	push   $0xb30
+ 1c0:	6a 01                	push   $0x1
+ 1c2:	e8 e9 04 00 00       	call   6b0 <printf>
+    for(i = 0; cpuinfo(i, &ci) == 0; i++){
+ 1c7:	83 c4 30             	add    $0x30,%esp
+ 1ca:	83 ec 08             	sub    $0x8,%esp
+ 1cd:	56                   	push   %esi
+ 1ce:	53                   	push   %ebx
+ 1cf:	e8 cf 03 00 00       	call   5a3 <cpuinfo>
+ 1d4:	83 c4 10             	add    $0x10,%esp
+ 1d7:	85 c0                	test   %eax,%eax
+ 1d9:	0f 84 39 ff ff ff    	je     118 <main+0x118>
+             "stalled %d%s\n", ci.energy_mj, ci.residency[0], ci.residency[1],
+             ci.residency[2], ci.idle_residency[0] + ci.idle_residency[1],
+             ci.idle_residency[2], ci.stalled, ci.parked ? " (parked)" : "");
+    }
+    printf(1, "\n");
+ 1df:	83 ec 08             	sub    $0x8,%esp
+ 1e2:	68 25 0a 00 00       	push   $0xa25
+ 1e7:	6a 01                	push   $0x1
+ 1e9:	e8 c2 04 00 00       	call   6b0 <printf>
+  while(count < 10) {
+ 1ee:	83 c4 10             	add    $0x10,%esp
+ 1f1:	83 ad 44 ff ff ff 01 	subl   $0x1,-0xbc(%ebp)
+ 1f8:	0f 85 32 fe ff ff    	jne    30 <main+0x30>
+    count++;
+  }
+
+  exit();
+ 1fe:	e8 f0 02 00 00       	call   4f3 <exit>
+ 203:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 207:	90                   	nop
+      printf(1, "(%d samples dropped)\n", st.dropped);
+ 208:	83 ec 04             	sub    $0x4,%esp
+ 20b:	50                   	push   %eax
+ 20c:	68 fd 09 00 00       	push   $0x9fd
+ 211:	6a 01                	push   $0x1
+ 213:	e8 98 04 00 00       	call   6b0 <printf>
+ 218:	83 c4 10             	add    $0x10,%esp
+ 21b:	e9 57 fe ff ff       	jmp    77 <main+0x77>
+      printf(1, "Load Avg:    ");
+ 220:	83 ec 08             	sub    $0x8,%esp
+ 223:	8d b5 5c ff ff ff    	lea    -0xa4(%ebp),%esi
+  printf(1, " %d.%d%d", x >> 11, f / 10, f % 10);
+ 229:	bf cd cc cc cc       	mov    $0xcccccccd,%edi
+      printf(1, "Load Avg:    ");
+ 22e:	68 64 0a 00 00       	push   $0xa64
+ 233:	6a 01                	push   $0x1
+ 235:	e8 76 04 00 00       	call   6b0 <printf>
+      for(i = 0; i < 3; i++)
+ 23a:	83 c4 10             	add    $0x10,%esp
+  f = ((x & 2047) * 100) >> 11;
+ 23d:	8b 4b 1c             	mov    0x1c(%ebx),%ecx
+  printf(1, " %d.%d%d", x >> 11, f / 10, f % 10);
+ 240:	83 ec 0c             	sub    $0xc,%esp
+      for(i = 0; i < 3; i++)
+ 243:	83 c3 04             	add    $0x4,%ebx
+  f = ((x & 2047) * 100) >> 11;
+ 246:	81 e1 ff 07 00 00    	and    $0x7ff,%ecx
+ 24c:	6b c9 64             	imul   $0x64,%ecx,%ecx
+ 24f:	c1 e9 0b             	shr    $0xb,%ecx
+  printf(1, " %d.%d%d", x >> 11, f / 10, f % 10);
+ 252:	89 c8                	mov    %ecx,%eax
+ 254:	f7 e7                	mul    %edi
+ 256:	c1 ea 03             	shr    $0x3,%edx
+ 259:	8d 04 92             	lea    (%edx,%edx,4),%eax
+ 25c:	01 c0                	add    %eax,%eax
+ 25e:	29 c1                	sub    %eax,%ecx
+ 260:	51                   	push   %ecx
+ 261:	52                   	push   %edx
+ 262:	8b 43 18             	mov    0x18(%ebx),%eax
+ 265:	c1 e8 0b             	shr    $0xb,%eax
+ 268:	50                   	push   %eax
+ 269:	68 72 0a 00 00       	push   $0xa72
+ 26e:	6a 01                	push   $0x1
+ 270:	e8 3b 04 00 00       	call   6b0 <printf>
+      for(i = 0; i < 3; i++)
+ 275:	83 c4 20             	add    $0x20,%esp
+ 278:	39 de                	cmp    %ebx,%esi
+ 27a:	75 c1                	jne    23d <main+0x23d>
+      printf(1, " (%d running)\n", cs.nrunning);
+ 27c:	83 ec 04             	sub    $0x4,%esp
+ 27f:	ff b5 68 ff ff ff    	push   -0x98(%ebp)
+ 285:	68 7b 0a 00 00       	push   $0xa7b
+ 28a:	6a 01                	push   $0x1
+ 28c:	e8 1f 04 00 00       	call   6b0 <printf>
+ 291:	83 c4 10             	add    $0x10,%esp
+ 294:	e9 72 fe ff ff       	jmp    10b <main+0x10b>
+      printf(2, "cpustat: telemetry failed\n");
+ 299:	52                   	push   %edx
+ 29a:	52                   	push   %edx
+ 29b:	68 e2 09 00 00       	push   $0x9e2
+ 2a0:	6a 02                	push   $0x2
+ 2a2:	e8 09 04 00 00       	call   6b0 <printf>
+      exit();
+ 2a7:	e8 47 02 00 00       	call   4f3 <exit>
+ 2ac:	66 90                	xchg   %ax,%ax
+ 2ae:	66 90                	xchg   %ax,%ax
+
+000002b0 <strcpy>:
+#include "user.h"
+#include "x86.h"
+
+char*
+strcpy(char *s, const char *t)
+{
+ 2b0:	55                   	push   %ebp
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+ 2b1:	31 c0                	xor    %eax,%eax
+{
+ 2b3:	89 e5                	mov    %esp,%ebp
+ 2b5:	53                   	push   %ebx
+ 2b6:	8b 4d 08             	mov    0x8(%ebp),%ecx
+ 2b9:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+ 2bc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  while((*s++ = *t++) != 0)
+ 2c0:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+ 2c4:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+ 2c7:	83 c0 01             	add    $0x1,%eax
+ 2ca:	84 d2                	test   %dl,%dl
+ 2cc:	75 f2                	jne    2c0 <strcpy+0x10>
+    ;
+  return os;
+}
+ 2ce:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 2d1:	89 c8                	mov    %ecx,%eax
+ 2d3:	c9                   	leave
+ 2d4:	c3                   	ret
+ 2d5:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 2dc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000002e0 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+ 2e0:	55                   	push   %ebp
+ 2e1:	89 e5                	mov    %esp,%ebp
+ 2e3:	53                   	push   %ebx
+ 2e4:	8b 55 08             	mov    0x8(%ebp),%edx
+ 2e7:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  while(*p && *p == *q)
+ 2ea:	0f b6 02             	movzbl (%edx),%eax
+ 2ed:	84 c0                	test   %al,%al
+ 2ef:	75 17                	jne    308 <strcmp+0x28>
+ 2f1:	eb 3a                	jmp    32d <strcmp+0x4d>
+ 2f3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 2f7:	90                   	nop
+ 2f8:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+    p++, q++;
+ 2fc:	83 c2 01             	add    $0x1,%edx
+ 2ff:	8d 59 01             	lea    0x1(%ecx),%ebx
+  while(*p && *p == *q)
+ 302:	84 c0                	test   %al,%al
+ 304:	74 1a                	je     320 <strcmp+0x40>
+    p++, q++;
+ 306:	89 d9                	mov    %ebx,%ecx
+  while(*p && *p == *q)
+ 308:	0f b6 19             	movzbl (%ecx),%ebx
+ 30b:	38 c3                	cmp    %al,%bl
+ 30d:	74 e9                	je     2f8 <strcmp+0x18>
+  return (uchar)*p - (uchar)*q;
+ 30f:	29 d8                	sub    %ebx,%eax
+}
+ 311:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 314:	c9                   	leave
+ 315:	c3                   	ret
+ 316:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 31d:	8d 76 00             	lea    0x0(%esi),%esi
+  return (uchar)*p - (uchar)*q;
+ 320:	0f b6 59 01          	movzbl 0x1(%ecx),%ebx
+ 324:	31 c0                	xor    %eax,%eax
+ 326:	29 d8                	sub    %ebx,%eax
+}
+ 328:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 32b:	c9                   	leave
+ 32c:	c3                   	ret
+  return (uchar)*p - (uchar)*q;
+ 32d:	0f b6 19             	movzbl (%ecx),%ebx
+ 330:	31 c0                	xor    %eax,%eax
+ 332:	eb db                	jmp    30f <strcmp+0x2f>
+ 334:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 33b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 33f:	90                   	nop
+
+00000340 <strlen>:
+
+uint
+strlen(const char *s)
+{
+ 340:	55                   	push   %ebp
+ 341:	89 e5                	mov    %esp,%ebp
+ 343:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for(n = 0; s[n]; n++)
+ 346:	80 3a 00             	cmpb   $0x0,(%edx)
+ 349:	74 15                	je     360 <strlen+0x20>
+ 34b:	31 c0                	xor    %eax,%eax
+ 34d:	8d 76 00             	lea    0x0(%esi),%esi
+ 350:	83 c0 01             	add    $0x1,%eax
+ 353:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+ 357:	89 c1                	mov    %eax,%ecx
+ 359:	75 f5                	jne    350 <strlen+0x10>
+    ;
+  return n;
+}
+ 35b:	89 c8                	mov    %ecx,%eax
+ 35d:	5d                   	pop    %ebp
+ 35e:	c3                   	ret
+ 35f:	90                   	nop
+  for(n = 0; s[n]; n++)
+ 360:	31 c9                	xor    %ecx,%ecx
+}
+ 362:	5d                   	pop    %ebp
+ 363:	89 c8                	mov    %ecx,%eax
+ 365:	c3                   	ret
+ 366:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 36d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000370 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+ 370:	55                   	push   %ebp
+ 371:	89 e5                	mov    %esp,%ebp
+ 373:	57                   	push   %edi
+ 374:	8b 55 08             	mov    0x8(%ebp),%edx
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosb" :
+ 377:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 37a:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 37d:	89 d7                	mov    %edx,%edi
+ 37f:	fc                   	cld
+ 380:	f3 aa                	rep stos %al,%es:(%edi)
+  stosb(dst, c, n);
+  return dst;
+}
+ 382:	8b 7d fc             	mov    -0x4(%ebp),%edi
+ 385:	89 d0                	mov    %edx,%eax
+ 387:	c9                   	leave
+ 388:	c3                   	ret
+ 389:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000390 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+ 390:	55                   	push   %ebp
+ 391:	89 e5                	mov    %esp,%ebp
+ 393:	8b 45 08             	mov    0x8(%ebp),%eax
+ 396:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+ 39a:	0f b6 10             	movzbl (%eax),%edx
+ 39d:	84 d2                	test   %dl,%dl
+ 39f:	75 12                	jne    3b3 <strchr+0x23>
+ 3a1:	eb 1d                	jmp    3c0 <strchr+0x30>
+ 3a3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 3a7:	90                   	nop
+ 3a8:	0f b6 50 01          	movzbl 0x1(%eax),%edx
+ 3ac:	83 c0 01             	add    $0x1,%eax
+ 3af:	84 d2                	test   %dl,%dl
+ 3b1:	74 0d                	je     3c0 <strchr+0x30>
+    if(*s == c)
+ 3b3:	38 d1                	cmp    %dl,%cl
+ 3b5:	75 f1                	jne    3a8 <strchr+0x18>
+      return (char*)s;
+  return 0;
+}
+ 3b7:	5d                   	pop    %ebp
+ 3b8:	c3                   	ret
+ 3b9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  return 0;
+ 3c0:	31 c0                	xor    %eax,%eax
+}
+ 3c2:	5d                   	pop    %ebp
+ 3c3:	c3                   	ret
+ 3c4:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 3cb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 3cf:	90                   	nop
+
+000003d0 <gets>:
+
+char*
+gets(char *buf, int max)
+{
+ 3d0:	55                   	push   %ebp
+ 3d1:	89 e5                	mov    %esp,%ebp
+ 3d3:	57                   	push   %edi
+ 3d4:	56                   	push   %esi
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+    cc = read(0, &c, 1);
+ 3d5:	8d 75 e7             	lea    -0x19(%ebp),%esi
+{
+ 3d8:	53                   	push   %ebx
+  for(i=0; i+1 < max; ){
+ 3d9:	31 db                	xor    %ebx,%ebx
+{
+ 3db:	83 ec 1c             	sub    $0x1c,%esp
+  for(i=0; i+1 < max; ){
+ 3de:	eb 27                	jmp    407 <gets+0x37>
+    cc = read(0, &c, 1);
+ 3e0:	83 ec 04             	sub    $0x4,%esp
+ 3e3:	6a 01                	push   $0x1
+ 3e5:	56                   	push   %esi
+ 3e6:	6a 00                	push   $0x0
+ 3e8:	e8 1e 01 00 00       	call   50b <read>
+    if(cc < 1)
+ 3ed:	83 c4 10             	add    $0x10,%esp
+ 3f0:	85 c0                	test   %eax,%eax
+ 3f2:	7e 1d                	jle    411 <gets+0x41>
+      break;
+    buf[i++] = c;
+ 3f4:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+ 3f8:	8b 55 08             	mov    0x8(%ebp),%edx
+ 3fb:	88 44 1a ff          	mov    %al,-0x1(%edx,%ebx,1)
+    if(c == '\n' || c == '\r')
+ 3ff:	3c 0a                	cmp    $0xa,%al
+ 401:	74 10                	je     413 <gets+0x43>
+ 403:	3c 0d                	cmp    $0xd,%al
+ 405:	74 0c                	je     413 <gets+0x43>
+  for(i=0; i+1 < max; ){
+ 407:	89 df                	mov    %ebx,%edi
+ 409:	83 c3 01             	add    $0x1,%ebx
+ 40c:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+ 40f:	7c cf                	jl     3e0 <gets+0x10>
+ 411:	89 fb                	mov    %edi,%ebx
+      break;
+  }
+  buf[i] = '\0';
+ 413:	8b 45 08             	mov    0x8(%ebp),%eax
+ 416:	c6 04 18 00          	movb   $0x0,(%eax,%ebx,1)
+  return buf;
+}
+ 41a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 41d:	5b                   	pop    %ebx
+ 41e:	5e                   	pop    %esi
+ 41f:	5f                   	pop    %edi
+ 420:	5d                   	pop    %ebp
+ 421:	c3                   	ret
+ 422:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 429:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000430 <stat>:
+
+int
+stat(const char *n, struct stat *st)
+{
+ 430:	55                   	push   %ebp
+ 431:	89 e5                	mov    %esp,%ebp
+ 433:	56                   	push   %esi
+ 434:	53                   	push   %ebx
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+ 435:	83 ec 08             	sub    $0x8,%esp
+ 438:	6a 00                	push   $0x0
+ 43a:	ff 75 08             	push   0x8(%ebp)
+ 43d:	e8 f1 00 00 00       	call   533 <open>
+  if(fd < 0)
+ 442:	83 c4 10             	add    $0x10,%esp
+ 445:	85 c0                	test   %eax,%eax
+ 447:	78 27                	js     470 <stat+0x40>
+    return -1;
+  r = fstat(fd, st);
+ 449:	83 ec 08             	sub    $0x8,%esp
+ 44c:	ff 75 0c             	push   0xc(%ebp)
+ 44f:	89 c3                	mov    %eax,%ebx
+ 451:	50                   	push   %eax
+ 452:	e8 f4 00 00 00       	call   54b <fstat>
+  close(fd);
+ 457:	89 1c 24             	mov    %ebx,(%esp)
+  r = fstat(fd, st);
+ 45a:	89 c6                	mov    %eax,%esi
+  close(fd);
+ 45c:	e8 ba 00 00 00       	call   51b <close>
+  return r;
+ 461:	83 c4 10             	add    $0x10,%esp
+}
+ 464:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 467:	89 f0                	mov    %esi,%eax
+ 469:	5b                   	pop    %ebx
+ 46a:	5e                   	pop    %esi
+ 46b:	5d                   	pop    %ebp
+ 46c:	c3                   	ret
+ 46d:	8d 76 00             	lea    0x0(%esi),%esi
+    return -1;
+ 470:	be ff ff ff ff       	mov    $0xffffffff,%esi
+ 475:	eb ed                	jmp    464 <stat+0x34>
+ 477:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 47e:	66 90                	xchg   %ax,%ax
+
+00000480 <atoi>:
+
+int
+atoi(const char *s)
+{
+ 480:	55                   	push   %ebp
+ 481:	89 e5                	mov    %esp,%ebp
+ 483:	53                   	push   %ebx
+ 484:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  n = 0;
+  while('0' <= *s && *s <= '9')
+ 487:	0f be 02             	movsbl (%edx),%eax
+ 48a:	8d 48 d0             	lea    -0x30(%eax),%ecx
+ 48d:	80 f9 09             	cmp    $0x9,%cl
+  n = 0;
+ 490:	b9 00 00 00 00       	mov    $0x0,%ecx
+  while('0' <= *s && *s <= '9')
+ 495:	77 1e                	ja     4b5 <atoi+0x35>
+ 497:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 49e:	66 90                	xchg   %ax,%ax
+    n = n*10 + *s++ - '0';
+ 4a0:	83 c2 01             	add    $0x1,%edx
+ 4a3:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+ 4a6:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+  while('0' <= *s && *s <= '9')
+ 4aa:	0f be 02             	movsbl (%edx),%eax
+ 4ad:	8d 58 d0             	lea    -0x30(%eax),%ebx
+ 4b0:	80 fb 09             	cmp    $0x9,%bl
+ 4b3:	76 eb                	jbe    4a0 <atoi+0x20>
+  return n;
+}
+ 4b5:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 4b8:	89 c8                	mov    %ecx,%eax
+ 4ba:	c9                   	leave
+ 4bb:	c3                   	ret
+ 4bc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000004c0 <memmove>:
+
+void*
+memmove(void *vdst, const void *vsrc, int n)
+{
+ 4c0:	55                   	push   %ebp
+ 4c1:	89 e5                	mov    %esp,%ebp
+ 4c3:	57                   	push   %edi
+ 4c4:	56                   	push   %esi
+ 4c5:	8b 45 10             	mov    0x10(%ebp),%eax
+ 4c8:	8b 55 08             	mov    0x8(%ebp),%edx
+ 4cb:	8b 75 0c             	mov    0xc(%ebp),%esi
+  char *dst;
+  const char *src;
+
+  dst = vdst;
+  src = vsrc;
+  while(n-- > 0)
+ 4ce:	85 c0                	test   %eax,%eax
+ 4d0:	7e 13                	jle    4e5 <memmove+0x25>
+ 4d2:	01 d0                	add    %edx,%eax
+  dst = vdst;
+ 4d4:	89 d7                	mov    %edx,%edi
+ 4d6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 4dd:	8d 76 00             	lea    0x0(%esi),%esi
+    *dst++ = *src++;
+ 4e0:	a4                   	movsb  %ds:(%esi),%es:(%edi)
+  while(n-- > 0)
+ 4e1:	39 f8                	cmp    %edi,%eax
+ 4e3:	75 fb                	jne    4e0 <memmove+0x20>
+  return vdst;
+}
+ 4e5:	5e                   	pop    %esi
+ 4e6:	89 d0                	mov    %edx,%eax
+ 4e8:	5f                   	pop    %edi
+ 4e9:	5d                   	pop    %ebp
+ 4ea:	c3                   	ret
+
+000004eb <fork>:
+  name: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+SYSCALL(fork)
+ 4eb:	b8 01 00 00 00       	mov    $0x1,%eax
+ 4f0:	cd 40                	int    $0x40
+ 4f2:	c3                   	ret
+
+000004f3 <exit>:
+SYSCALL(exit)
+ 4f3:	b8 02 00 00 00       	mov    $0x2,%eax
+ 4f8:	cd 40                	int    $0x40
+ 4fa:	c3                   	ret
+
+000004fb <wait>:
+SYSCALL(wait)
+ 4fb:	b8 03 00 00 00       	mov    $0x3,%eax
+ 500:	cd 40                	int    $0x40
+ 502:	c3                   	ret
+
+00000503 <pipe>:
+SYSCALL(pipe)
+ 503:	b8 04 00 00 00       	mov    $0x4,%eax
+ 508:	cd 40                	int    $0x40
+ 50a:	c3                   	ret
+
+0000050b <read>:
+SYSCALL(read)
+ 50b:	b8 05 00 00 00       	mov    $0x5,%eax
+ 510:	cd 40                	int    $0x40
+ 512:	c3                   	ret
+
+00000513 <write>:
+SYSCALL(write)
+ 513:	b8 10 00 00 00       	mov    $0x10,%eax
+ 518:	cd 40                	int    $0x40
+ 51a:	c3                   	ret
+
+0000051b <close>:
+SYSCALL(close)
+ 51b:	b8 15 00 00 00       	mov    $0x15,%eax
+ 520:	cd 40                	int    $0x40
+ 522:	c3                   	ret
+
+00000523 <kill>:
+SYSCALL(kill)
+ 523:	b8 06 00 00 00       	mov    $0x6,%eax
+ 528:	cd 40                	int    $0x40
+ 52a:	c3                   	ret
+
+0000052b <exec>:
+SYSCALL(exec)
+ 52b:	b8 07 00 00 00       	mov    $0x7,%eax
+ 530:	cd 40                	int    $0x40
+ 532:	c3                   	ret
+
+00000533 <open>:
+SYSCALL(open)
+ 533:	b8 0f 00 00 00       	mov    $0xf,%eax
+ 538:	cd 40                	int    $0x40
+ 53a:	c3                   	ret
+
+0000053b <mknod>:
+SYSCALL(mknod)
+ 53b:	b8 11 00 00 00       	mov    $0x11,%eax
+ 540:	cd 40                	int    $0x40
+ 542:	c3                   	ret
+
+00000543 <unlink>:
+SYSCALL(unlink)
+ 543:	b8 12 00 00 00       	mov    $0x12,%eax
+ 548:	cd 40                	int    $0x40
+ 54a:	c3                   	ret
+
+0000054b <fstat>:
+SYSCALL(fstat)
+ 54b:	b8 08 00 00 00       	mov    $0x8,%eax
+ 550:	cd 40                	int    $0x40
+ 552:	c3                   	ret
+
+00000553 <link>:
+SYSCALL(link)
+ 553:	b8 13 00 00 00       	mov    $0x13,%eax
+ 558:	cd 40                	int    $0x40
+ 55a:	c3                   	ret
+
+0000055b <mkdir>:
+SYSCALL(mkdir)
+ 55b:	b8 14 00 00 00       	mov    $0x14,%eax
+ 560:	cd 40                	int    $0x40
+ 562:	c3                   	ret
+
+00000563 <chdir>:
+SYSCALL(chdir)
+ 563:	b8 09 00 00 00       	mov    $0x9,%eax
+ 568:	cd 40                	int    $0x40
+ 56a:	c3                   	ret
+
+0000056b <dup>:
+SYSCALL(dup)
+ 56b:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 570:	cd 40                	int    $0x40
+ 572:	c3                   	ret
+
+00000573 <getpid>:
+SYSCALL(getpid)
+ 573:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 578:	cd 40                	int    $0x40
+ 57a:	c3                   	ret
+
+0000057b <sbrk>:
+SYSCALL(sbrk)
+ 57b:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 580:	cd 40                	int    $0x40
+ 582:	c3                   	ret
+
+00000583 <sleep>:
+SYSCALL(sleep)
+ 583:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 588:	cd 40                	int    $0x40
+ 58a:	c3                   	ret
+
+0000058b <uptime>:
+SYSCALL(uptime)
+ 58b:	b8 0e 00 00 00       	mov    $0xe,%eax
+ 590:	cd 40                	int    $0x40
+ 592:	c3                   	ret
+
+00000593 <cpustat>:
+SYSCALL(cpustat)
+ 593:	b8 16 00 00 00       	mov    $0x16,%eax
+ 598:	cd 40                	int    $0x40
+ 59a:	c3                   	ret
+
+0000059b <setpriority>:
+SYSCALL(setpriority)
+ 59b:	b8 17 00 00 00       	mov    $0x17,%eax
+ 5a0:	cd 40                	int    $0x40
+ 5a2:	c3                   	ret
+
+000005a3 <cpuinfo>:
+SYSCALL(cpuinfo)
+ 5a3:	b8 18 00 00 00       	mov    $0x18,%eax
+ 5a8:	cd 40                	int    $0x40
+ 5aa:	c3                   	ret
+
+000005ab <procinfo>:
+SYSCALL(procinfo)
+ 5ab:	b8 19 00 00 00       	mov    $0x19,%eax
+ 5b0:	cd 40                	int    $0x40
+ 5b2:	c3                   	ret
+
+000005b3 <setgovernor>:
+SYSCALL(setgovernor)
+ 5b3:	b8 1a 00 00 00       	mov    $0x1a,%eax
+ 5b8:	cd 40                	int    $0x40
+ 5ba:	c3                   	ret
+
+000005bb <sysctl>:
+SYSCALL(sysctl)
+ 5bb:	b8 1b 00 00 00       	mov    $0x1b,%eax
+ 5c0:	cd 40                	int    $0x40
+ 5c2:	c3                   	ret
+
+000005c3 <telemetry>:
+SYSCALL(telemetry)
+ 5c3:	b8 1c 00 00 00       	mov    $0x1c,%eax
+ 5c8:	cd 40                	int    $0x40
+ 5ca:	c3                   	ret
+
+000005cb <clock_gettime>:
+SYSCALL(clock_gettime)
+ 5cb:	b8 1d 00 00 00       	mov    $0x1d,%eax
+ 5d0:	cd 40                	int    $0x40
+ 5d2:	c3                   	ret
+
+000005d3 <sched_setaffinity>:
+SYSCALL(sched_setaffinity)
+ 5d3:	b8 1e 00 00 00       	mov    $0x1e,%eax
+ 5d8:	cd 40                	int    $0x40
+ 5da:	c3                   	ret
+
+000005db <sched_getaffinity>:
+SYSCALL(sched_getaffinity)
+ 5db:	b8 1f 00 00 00       	mov    $0x1f,%eax
+ 5e0:	cd 40                	int    $0x40
+ 5e2:	c3                   	ret
+
+000005e3 <setqos>:
+SYSCALL(setqos)
+ 5e3:	b8 20 00 00 00       	mov    $0x20,%eax
+ 5e8:	cd 40                	int    $0x40
+ 5ea:	c3                   	ret
+
+000005eb <setgroup>:
+SYSCALL(setgroup)
+ 5eb:	b8 21 00 00 00       	mov    $0x21,%eax
+ 5f0:	cd 40                	int    $0x40
+ 5f2:	c3                   	ret
+
+000005f3 <setquota>:
+SYSCALL(setquota)
+ 5f3:	b8 22 00 00 00       	mov    $0x22,%eax
+ 5f8:	cd 40                	int    $0x40
+ 5fa:	c3                   	ret
+
+000005fb <groupinfo>:
+SYSCALL(groupinfo)
+ 5fb:	b8 23 00 00 00       	mov    $0x23,%eax
+ 600:	cd 40                	int    $0x40
+ 602:	c3                   	ret
+ 603:	66 90                	xchg   %ax,%ax
+ 605:	66 90                	xchg   %ax,%ax
+ 607:	66 90                	xchg   %ax,%ax
+ 609:	66 90                	xchg   %ax,%ax
+ 60b:	66 90                	xchg   %ax,%ax
+ 60d:	66 90                	xchg   %ax,%ax
+ 60f:	90                   	nop
+
+00000610 <printint>:
+  write(fd, &c, 1);
+}
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+ 610:	55                   	push   %ebp
+ 611:	89 e5                	mov    %esp,%ebp
+ 613:	57                   	push   %edi
+ 614:	56                   	push   %esi
+ 615:	53                   	push   %ebx
+ 616:	89 cb                	mov    %ecx,%ebx
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+    neg = 1;
+    x = -xx;
+ 618:	89 d1                	mov    %edx,%ecx
+{
+ 61a:	83 ec 3c             	sub    $0x3c,%esp
+ 61d:	89 45 c0             	mov    %eax,-0x40(%ebp)
+  if(sgn && xx < 0){
+ 620:	85 d2                	test   %edx,%edx
+ 622:	0f 89 80 00 00 00    	jns    6a8 <printint+0x98>
+ 628:	f6 45 08 01          	testb  $0x1,0x8(%ebp)
+ 62c:	74 7a                	je     6a8 <printint+0x98>
+    x = -xx;
+ 62e:	f7 d9                	neg    %ecx
+    neg = 1;
+ 630:	b8 01 00 00 00       	mov    $0x1,%eax
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+ 635:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+ 638:	31 f6                	xor    %esi,%esi
+ 63a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  do{
+    buf[i++] = digits[x % base];
+ 640:	89 c8                	mov    %ecx,%eax
+ 642:	31 d2                	xor    %edx,%edx
+ 644:	89 f7                	mov    %esi,%edi
+ 646:	f7 f3                	div    %ebx
+ 648:	8d 76 01             	lea    0x1(%esi),%esi
+ 64b:	0f b6 92 dc 0b 00 00 	movzbl 0xbdc(%edx),%edx
+ 652:	88 54 35 d7          	mov    %dl,-0x29(%ebp,%esi,1)
+  }while((x /= base) != 0);
+ 656:	89 ca                	mov    %ecx,%edx
+ 658:	89 c1                	mov    %eax,%ecx
+ 65a:	39 da                	cmp    %ebx,%edx
+ 65c:	73 e2                	jae    640 <printint+0x30>
+  if(neg)
+ 65e:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+ 661:	85 c0                	test   %eax,%eax
+ 663:	74 07                	je     66c <printint+0x5c>
+    buf[i++] = '-';
+ 665:	c6 44 35 d8 2d       	movb   $0x2d,-0x28(%ebp,%esi,1)
+    buf[i++] = digits[x % base];
+ 66a:	89 f7                	mov    %esi,%edi
+ 66c:	8d 5d d8             	lea    -0x28(%ebp),%ebx
+ 66f:	8b 75 c0             	mov    -0x40(%ebp),%esi
+ 672:	01 df                	add    %ebx,%edi
+ 674:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+  while(--i >= 0)
+    putc(fd, buf[i]);
+ 678:	0f b6 07             	movzbl (%edi),%eax
+  write(fd, &c, 1);
+ 67b:	83 ec 04             	sub    $0x4,%esp
+ 67e:	88 45 d7             	mov    %al,-0x29(%ebp)
+ 681:	8d 45 d7             	lea    -0x29(%ebp),%eax
+ 684:	6a 01                	push   $0x1
+ 686:	50                   	push   %eax
+ 687:	56                   	push   %esi
+ 688:	e8 86 fe ff ff       	call   513 <write>
+  while(--i >= 0)
+ 68d:	89 f8                	mov    %edi,%eax
+ 68f:	83 c4 10             	add    $0x10,%esp
+ 692:	83 ef 01             	sub    $0x1,%edi
+ 695:	39 d8                	cmp    %ebx,%eax
+ 697:	75 df                	jne    678 <printint+0x68>
+}
+ 699:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 69c:	5b                   	pop    %ebx
+ 69d:	5e                   	pop    %esi
+ 69e:	5f                   	pop    %edi
+ 69f:	5d                   	pop    %ebp
+ 6a0:	c3                   	ret
+ 6a1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  neg = 0;
+ 6a8:	31 c0                	xor    %eax,%eax
+ 6aa:	eb 89                	jmp    635 <printint+0x25>
+ 6ac:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000006b0 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, const char *fmt, ...)
+{
+ 6b0:	55                   	push   %ebp
+ 6b1:	89 e5                	mov    %esp,%ebp
+ 6b3:	57                   	push   %edi
+ 6b4:	56                   	push   %esi
+ 6b5:	53                   	push   %ebx
+ 6b6:	83 ec 2c             	sub    $0x2c,%esp
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+  ap = (uint*)(void*)&fmt + 1;
+  for(i = 0; fmt[i]; i++){
+ 6b9:	8b 75 0c             	mov    0xc(%ebp),%esi
+{
+ 6bc:	8b 7d 08             	mov    0x8(%ebp),%edi
+  for(i = 0; fmt[i]; i++){
+ 6bf:	0f b6 1e             	movzbl (%esi),%ebx
+ 6c2:	83 c6 01             	add    $0x1,%esi
+ 6c5:	84 db                	test   %bl,%bl
+ 6c7:	74 67                	je     730 <printf+0x80>
+ 6c9:	8d 4d 10             	lea    0x10(%ebp),%ecx
+ 6cc:	31 d2                	xor    %edx,%edx
+ 6ce:	89 4d d0             	mov    %ecx,-0x30(%ebp)
+ 6d1:	eb 34                	jmp    707 <printf+0x57>
+ 6d3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 6d7:	90                   	nop
+ 6d8:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+        state = '%';
+ 6db:	ba 25 00 00 00       	mov    $0x25,%edx
+      if(c == '%'){
+ 6e0:	83 f8 25             	cmp    $0x25,%eax
+ 6e3:	74 18                	je     6fd <printf+0x4d>
+  write(fd, &c, 1);
+ 6e5:	83 ec 04             	sub    $0x4,%esp
+ 6e8:	8d 45 e7             	lea    -0x19(%ebp),%eax
+ 6eb:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 6ee:	6a 01                	push   $0x1
+ 6f0:	50                   	push   %eax
+ 6f1:	57                   	push   %edi
+ 6f2:	e8 1c fe ff ff       	call   513 <write>
+ 6f7:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+      } else {
+        putc(fd, c);
+ 6fa:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; fmt[i]; i++){
+ 6fd:	0f b6 1e             	movzbl (%esi),%ebx
+ 700:	83 c6 01             	add    $0x1,%esi
+ 703:	84 db                	test   %bl,%bl
+ 705:	74 29                	je     730 <printf+0x80>
+    c = fmt[i] & 0xff;
+ 707:	0f b6 c3             	movzbl %bl,%eax
+    if(state == 0){
+ 70a:	85 d2                	test   %edx,%edx
+ 70c:	74 ca                	je     6d8 <printf+0x28>
+      }
+    } else if(state == '%'){
+ 70e:	83 fa 25             	cmp    $0x25,%edx
+ 711:	75 ea                	jne    6fd <printf+0x4d>
+      if(c == 'd'){
+ 713:	83 f8 25             	cmp    $0x25,%eax
+ 716:	0f 84 24 01 00 00    	je     840 <printf+0x190>
+ 71c:	83 e8 63             	sub    $0x63,%eax
+ 71f:	83 f8 15             	cmp    $0x15,%eax
+ 722:	77 1c                	ja     740 <printf+0x90>
+ 724:	ff 24 85 84 0b 00 00 	jmp    *0xb84(,%eax,4)
+ 72b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 72f:	90                   	nop
+        putc(fd, c);
+      }
+      state = 0;
+    }
+  }
+}
+ 730:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 733:	5b                   	pop    %ebx
+ 734:	5e                   	pop    %esi
+ 735:	5f                   	pop    %edi
+ 736:	5d                   	pop    %ebp
+ 737:	c3                   	ret
+ 738:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 73f:	90                   	nop
+  write(fd, &c, 1);
+ 740:	83 ec 04             	sub    $0x4,%esp
+ 743:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 746:	c6 45 e7 25          	movb   $0x25,-0x19(%ebp)
+ 74a:	6a 01                	push   $0x1
+ 74c:	52                   	push   %edx
+ 74d:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+ 750:	57                   	push   %edi
+ 751:	e8 bd fd ff ff       	call   513 <write>
+ 756:	83 c4 0c             	add    $0xc,%esp
+ 759:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 75c:	6a 01                	push   $0x1
+ 75e:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+ 761:	52                   	push   %edx
+ 762:	57                   	push   %edi
+ 763:	e8 ab fd ff ff       	call   513 <write>
+        putc(fd, c);
+ 768:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 76b:	31 d2                	xor    %edx,%edx
+ 76d:	eb 8e                	jmp    6fd <printf+0x4d>
+ 76f:	90                   	nop
+        printint(fd, *ap, 16, 0);
+ 770:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+ 773:	83 ec 0c             	sub    $0xc,%esp
+ 776:	b9 10 00 00 00       	mov    $0x10,%ecx
+ 77b:	8b 13                	mov    (%ebx),%edx
+ 77d:	6a 00                	push   $0x0
+ 77f:	89 f8                	mov    %edi,%eax
+        ap++;
+ 781:	83 c3 04             	add    $0x4,%ebx
+        printint(fd, *ap, 16, 0);
+ 784:	e8 87 fe ff ff       	call   610 <printint>
+        ap++;
+ 789:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+ 78c:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 78f:	31 d2                	xor    %edx,%edx
+ 791:	e9 67 ff ff ff       	jmp    6fd <printf+0x4d>
+ 796:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 79d:	8d 76 00             	lea    0x0(%esi),%esi
+        s = (char*)*ap;
+ 7a0:	8b 45 d0             	mov    -0x30(%ebp),%eax
+ 7a3:	8b 18                	mov    (%eax),%ebx
+        ap++;
+ 7a5:	83 c0 04             	add    $0x4,%eax
+ 7a8:	89 45 d0             	mov    %eax,-0x30(%ebp)
+        if(s == 0)
+ 7ab:	85 db                	test   %ebx,%ebx
+ 7ad:	0f 84 9d 00 00 00    	je     850 <printf+0x1a0>
+        while(*s != 0){
+ 7b3:	0f b6 03             	movzbl (%ebx),%eax
+      state = 0;
+ 7b6:	31 d2                	xor    %edx,%edx
+        while(*s != 0){
+ 7b8:	84 c0                	test   %al,%al
+ 7ba:	0f 84 3d ff ff ff    	je     6fd <printf+0x4d>
+ 7c0:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 7c3:	89 75 d4             	mov    %esi,-0x2c(%ebp)
+ 7c6:	89 de                	mov    %ebx,%esi
+ 7c8:	89 d3                	mov    %edx,%ebx
+ 7ca:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  write(fd, &c, 1);
+ 7d0:	83 ec 04             	sub    $0x4,%esp
+ 7d3:	88 45 e7             	mov    %al,-0x19(%ebp)
+          s++;
+ 7d6:	83 c6 01             	add    $0x1,%esi
+  write(fd, &c, 1);
+ 7d9:	6a 01                	push   $0x1
+ 7db:	53                   	push   %ebx
+ 7dc:	57                   	push   %edi
+ 7dd:	e8 31 fd ff ff       	call   513 <write>
+        while(*s != 0){
+ 7e2:	0f b6 06             	movzbl (%esi),%eax
+ 7e5:	83 c4 10             	add    $0x10,%esp
+ 7e8:	84 c0                	test   %al,%al
+ 7ea:	75 e4                	jne    7d0 <printf+0x120>
+      state = 0;
+ 7ec:	8b 75 d4             	mov    -0x2c(%ebp),%esi
+ 7ef:	31 d2                	xor    %edx,%edx
+ 7f1:	e9 07 ff ff ff       	jmp    6fd <printf+0x4d>
+ 7f6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 7fd:	8d 76 00             	lea    0x0(%esi),%esi
+        printint(fd, *ap, 10, 1);
+ 800:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+ 803:	83 ec 0c             	sub    $0xc,%esp
+ 806:	b9 0a 00 00 00       	mov    $0xa,%ecx
+ 80b:	8b 13                	mov    (%ebx),%edx
+ 80d:	6a 01                	push   $0x1
+ 80f:	e9 6b ff ff ff       	jmp    77f <printf+0xcf>
+ 814:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+        putc(fd, *ap);
+ 818:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  write(fd, &c, 1);
+ 81b:	83 ec 04             	sub    $0x4,%esp
+ 81e:	8d 55 e7             	lea    -0x19(%ebp),%edx
+        putc(fd, *ap);
+ 821:	8b 03                	mov    (%ebx),%eax
+        ap++;
+ 823:	83 c3 04             	add    $0x4,%ebx
+        putc(fd, *ap);
+ 826:	88 45 e7             	mov    %al,-0x19(%ebp)
+  write(fd, &c, 1);
+ 829:	6a 01                	push   $0x1
+ 82b:	52                   	push   %edx
+ 82c:	57                   	push   %edi
+ 82d:	e8 e1 fc ff ff       	call   513 <write>
+        ap++;
+ 832:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+ 835:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 838:	31 d2                	xor    %edx,%edx
+ 83a:	e9 be fe ff ff       	jmp    6fd <printf+0x4d>
+ 83f:	90                   	nop
+  write(fd, &c, 1);
+ 840:	83 ec 04             	sub    $0x4,%esp
+ 843:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 846:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 849:	6a 01                	push   $0x1
+ 84b:	e9 11 ff ff ff       	jmp    761 <printf+0xb1>
+ 850:	b8 28 00 00 00       	mov    $0x28,%eax
+          s = "(null)";
+ 855:	bb 7b 0b 00 00       	mov    $0xb7b,%ebx
+ 85a:	e9 61 ff ff ff       	jmp    7c0 <printf+0x110>
+ 85f:	90                   	nop
+
+00000860 <free>:
+static Header base;
+static Header *freep;
+
+void
+free(void *ap)
+{
+ 860:	55                   	push   %ebp
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 861:	a1 90 0e 00 00       	mov    0xe90,%eax
+{
+ 866:	89 e5                	mov    %esp,%ebp
+ 868:	57                   	push   %edi
+ 869:	56                   	push   %esi
+ 86a:	53                   	push   %ebx
+ 86b:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  bp = (Header*)ap - 1;
+ 86e:	8d 4b f8             	lea    -0x8(%ebx),%ecx
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 871:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 878:	89 c2                	mov    %eax,%edx
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 87a:	8b 00                	mov    (%eax),%eax
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 87c:	39 ca                	cmp    %ecx,%edx
+ 87e:	73 30                	jae    8b0 <free+0x50>
+ 880:	39 c1                	cmp    %eax,%ecx
+ 882:	72 04                	jb     888 <free+0x28>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 884:	39 c2                	cmp    %eax,%edx
+ 886:	72 f0                	jb     878 <free+0x18>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+ 888:	8b 73 fc             	mov    -0x4(%ebx),%esi
+ 88b:	8d 3c f1             	lea    (%ecx,%esi,8),%edi
+ 88e:	39 f8                	cmp    %edi,%eax
+ 890:	74 2e                	je     8c0 <free+0x60>
+    bp->s.size += p->s.ptr->s.size;
+    bp->s.ptr = p->s.ptr->s.ptr;
+ 892:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  } else
+    bp->s.ptr = p->s.ptr;
+  if(p + p->s.size == bp){
+ 895:	8b 42 04             	mov    0x4(%edx),%eax
+ 898:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+ 89b:	39 f1                	cmp    %esi,%ecx
+ 89d:	74 38                	je     8d7 <free+0x77>
+    p->s.size += bp->s.size;
+    p->s.ptr = bp->s.ptr;
+ 89f:	89 0a                	mov    %ecx,(%edx)
+  } else
+    p->s.ptr = bp;
+  freep = p;
+}
+ 8a1:	5b                   	pop    %ebx
+  freep = p;
+ 8a2:	89 15 90 0e 00 00    	mov    %edx,0xe90
+}
+ 8a8:	5e                   	pop    %esi
+ 8a9:	5f                   	pop    %edi
+ 8aa:	5d                   	pop    %ebp
+ 8ab:	c3                   	ret
+ 8ac:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 8b0:	39 c1                	cmp    %eax,%ecx
+ 8b2:	72 d0                	jb     884 <free+0x24>
+ 8b4:	eb c2                	jmp    878 <free+0x18>
+ 8b6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 8bd:	8d 76 00             	lea    0x0(%esi),%esi
+    bp->s.size += p->s.ptr->s.size;
+ 8c0:	03 70 04             	add    0x4(%eax),%esi
+ 8c3:	89 73 fc             	mov    %esi,-0x4(%ebx)
+    bp->s.ptr = p->s.ptr->s.ptr;
+ 8c6:	8b 02                	mov    (%edx),%eax
+ 8c8:	8b 00                	mov    (%eax),%eax
+ 8ca:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  if(p + p->s.size == bp){
+ 8cd:	8b 42 04             	mov    0x4(%edx),%eax
+ 8d0:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+ 8d3:	39 f1                	cmp    %esi,%ecx
+ 8d5:	75 c8                	jne    89f <free+0x3f>
+    p->s.size += bp->s.size;
+ 8d7:	03 43 fc             	add    -0x4(%ebx),%eax
+  freep = p;
+ 8da:	89 15 90 0e 00 00    	mov    %edx,0xe90
+    p->s.size += bp->s.size;
+ 8e0:	89 42 04             	mov    %eax,0x4(%edx)
+    p->s.ptr = bp->s.ptr;
+ 8e3:	8b 4b f8             	mov    -0x8(%ebx),%ecx
+ 8e6:	89 0a                	mov    %ecx,(%edx)
+}
+ 8e8:	5b                   	pop    %ebx
+ 8e9:	5e                   	pop    %esi
+ 8ea:	5f                   	pop    %edi
+ 8eb:	5d                   	pop    %ebp
+ 8ec:	c3                   	ret
+ 8ed:	8d 76 00             	lea    0x0(%esi),%esi
+
+000008f0 <malloc>:
+  return freep;
+}
+
+void*
+malloc(uint nbytes)
+{
+ 8f0:	55                   	push   %ebp
+ 8f1:	89 e5                	mov    %esp,%ebp
+ 8f3:	57                   	push   %edi
+ 8f4:	56                   	push   %esi
+ 8f5:	53                   	push   %ebx
+ 8f6:	83 ec 0c             	sub    $0xc,%esp
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ 8f9:	8b 45 08             	mov    0x8(%ebp),%eax
+  if((prevp = freep) == 0){
+ 8fc:	8b 15 90 0e 00 00    	mov    0xe90,%edx
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ 902:	8d 78 07             	lea    0x7(%eax),%edi
+ 905:	c1 ef 03             	shr    $0x3,%edi
+ 908:	83 c7 01             	add    $0x1,%edi
+  if((prevp = freep) == 0){
+ 90b:	85 d2                	test   %edx,%edx
+ 90d:	0f 84 8d 00 00 00    	je     9a0 <malloc+0xb0>
+    base.s.ptr = freep = prevp = &base;
+    base.s.size = 0;
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ 913:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+ 915:	8b 48 04             	mov    0x4(%eax),%ecx
+ 918:	39 f9                	cmp    %edi,%ecx
+ 91a:	73 64                	jae    980 <malloc+0x90>
+  if(nu < 4096)
+ 91c:	bb 00 10 00 00       	mov    $0x1000,%ebx
+ 921:	39 df                	cmp    %ebx,%edi
+ 923:	0f 43 df             	cmovae %edi,%ebx
+  p = sbrk(nu * sizeof(Header));
+ 926:	8d 34 dd 00 00 00 00 	lea    0x0(,%ebx,8),%esi
+ 92d:	eb 0a                	jmp    939 <malloc+0x49>
+ 92f:	90                   	nop
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ 930:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+ 932:	8b 48 04             	mov    0x4(%eax),%ecx
+ 935:	39 f9                	cmp    %edi,%ecx
+ 937:	73 47                	jae    980 <malloc+0x90>
+        p->s.size = nunits;
+      }
+      freep = prevp;
+      return (void*)(p + 1);
+    }
+    if(p == freep)
+ 939:	89 c2                	mov    %eax,%edx
+ 93b:	39 05 90 0e 00 00    	cmp    %eax,0xe90
+ 941:	75 ed                	jne    930 <malloc+0x40>
+  p = sbrk(nu * sizeof(Header));
+ 943:	83 ec 0c             	sub    $0xc,%esp
+ 946:	56                   	push   %esi
+ 947:	e8 2f fc ff ff       	call   57b <sbrk>
+  if(p == (char*)-1)
+ 94c:	83 c4 10             	add    $0x10,%esp
+ 94f:	83 f8 ff             	cmp    $0xffffffff,%eax
+ 952:	74 1c                	je     970 <malloc+0x80>
+  hp->s.size = nu;
+ 954:	89 58 04             	mov    %ebx,0x4(%eax)
+  free((void*)(hp + 1));
+ 957:	83 ec 0c             	sub    $0xc,%esp
+ 95a:	83 c0 08             	add    $0x8,%eax
+ 95d:	50                   	push   %eax
+ 95e:	e8 fd fe ff ff       	call   860 <free>
+  return freep;
+ 963:	8b 15 90 0e 00 00    	mov    0xe90,%edx
+      if((p = morecore(nunits)) == 0)
+ 969:	83 c4 10             	add    $0x10,%esp
+ 96c:	85 d2                	test   %edx,%edx
+ 96e:	75 c0                	jne    930 <malloc+0x40>
+        return 0;
+  }
+}
+ 970:	8d 65 f4             	lea    -0xc(%ebp),%esp
+        return 0;
+ 973:	31 c0                	xor    %eax,%eax
+}
+ 975:	5b                   	pop    %ebx
+ 976:	5e                   	pop    %esi
+ 977:	5f                   	pop    %edi
+ 978:	5d                   	pop    %ebp
+ 979:	c3                   	ret
+ 97a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+      if(p->s.size == nunits)
+ 980:	39 cf                	cmp    %ecx,%edi
+ 982:	74 4c                	je     9d0 <malloc+0xe0>
+        p->s.size -= nunits;
+ 984:	29 f9                	sub    %edi,%ecx
+ 986:	89 48 04             	mov    %ecx,0x4(%eax)
+        p += p->s.size;
+ 989:	8d 04 c8             	lea    (%eax,%ecx,8),%eax
+        p->s.size = nunits;
+ 98c:	89 78 04             	mov    %edi,0x4(%eax)
+      freep = prevp;
+ 98f:	89 15 90 0e 00 00    	mov    %edx,0xe90
+}
+ 995:	8d 65 f4             	lea    -0xc(%ebp),%esp
+      return (void*)(p + 1);
+ 998:	83 c0 08             	add    $0x8,%eax
+}
+ 99b:	5b                   	pop    %ebx
+ 99c:	5e                   	pop    %esi
+ 99d:	5f                   	pop    %edi
+ 99e:	5d                   	pop    %ebp
+ 99f:	c3                   	ret
+    base.s.ptr = freep = prevp = &base;
+ 9a0:	c7 05 90 0e 00 00 94 	movl   $0xe94,0xe90
+ 9a7:	0e 00 00 
+    base.s.size = 0;
+ 9aa:	b8 94 0e 00 00       	mov    $0xe94,%eax
+    base.s.ptr = freep = prevp = &base;
+ 9af:	c7 05 94 0e 00 00 94 	movl   $0xe94,0xe94
+ 9b6:	0e 00 00 
+    base.s.size = 0;
+ 9b9:	c7 05 98 0e 00 00 00 	movl   $0x0,0xe98
+ 9c0:	00 00 00 
+    if(p->s.size >= nunits){
+ 9c3:	e9 54 ff ff ff       	jmp    91c <malloc+0x2c>
+ 9c8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 9cf:	90                   	nop
+        prevp->s.ptr = p->s.ptr;
+ 9d0:	8b 08                	mov    (%eax),%ecx
+ 9d2:	89 0a                	mov    %ecx,(%edx)
+ 9d4:	eb b9                	jmp    98f <malloc+0x9f>
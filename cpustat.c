@@ -4,30 +4,62 @@
 // This array must match the one in proc.c
 char *freq_str[] = { "LOW", "MEDIUM", "HIGH" };
 
+// Print a load average, which has 11 fraction bits, as " 1.25".
+static void
+printload(uint x)
+{
+  uint f;
+
+  f = ((x & 2047) * 100) >> 11;
+  printf(1, " %d.%d%d", x >> 11, f / 10, f % 10);
+}
+
 int
 main(int argc, char *argv[])
 {
-  struct cpustat st;
+  struct telemetry st;
+  struct cpuinfo ci;
+  struct cpustat cs;
   int count = 0;
+  int i;
+  uint seq = 0;
 
-  // Loop for 10 iterations, printing stats every second
+  // Print 10 reports, one per analytics period.  telemetry() blocks
+  // until the kernel has a new sample, so none are skipped.
   while(count < 10) {
-    if(cpustat(&st) < 0) {
-      printf(2, "cpustat failed\n");
+    if(telemetry(&seq, &st, 1) != 1) {
+      printf(2, "cpustat: telemetry failed\n");
       exit();
     }
 
     // Print the report
-    printf(1, "--- SPAS-xv6 Scheduler Status ---\n");
+    printf(1, "--- SPAS-xv6 Scheduler Status (tick %d) ---\n", st.tick);
+    if(st.dropped)
+      printf(1, "(%d samples dropped)\n", st.dropped);
     printf(1, "CPU Load:     %d%%\n", st.load);
     printf(1, "Pred. Load:   %d%%\n", st.predicted_load);
     printf(1, "Frequency:    %s\n", freq_str[st.frequency_level]);
     // UPDATED LINE: Print temperature with one decimal place
     printf(1, "Virtual Temp: %d.%d C\n", st.temp / 10, st.temp % 10);
     printf(1, "Thresholds:   L->M %d%%, M->H %d%%\n", st.thresh_low_med, st.thresh_med_high);
+    if(cpustat(&cs) == 0)
+    {
+      printf(1, "Load Avg:    ");
+      for(i = 0; i < 3; i++)
+        printload(cs.loadavg[i]);
+      printf(1, " (%d running)\n", cs.nrunning);
+    }
+    for(i = 0; cpuinfo(i, &ci) == 0; i++){
+      printf(1, "  cpu%d: load %d%% %s temp %d.%d C cap %d.%d, %d moved off hot\n",
+             i, ci.load, freq_str[ci.frequency_level], ci.temp / 10,
+             ci.temp % 10, ci.thermal_cap / 256,
+             (ci.thermal_cap % 256) * 10 / 256, ci.thermal_migrations);
+      printf(1, "        energy %d mJ, ticks L/M/H %d/%d/%d idle %d parked %d "
+             "stalled %d%s\n", ci.energy_mj, ci.residency[0], ci.residency[1],
+             ci.residency[2], ci.idle_residency[0] + ci.idle_residency[1],
+             ci.idle_residency[2], ci.stalled, ci.parked ? " (parked)" : "");
+    }
     printf(1, "\n");
-
-    sleep(100); // sleep for 100 ticks (1 second)
     count++;
   }
 
@@ -53,6 +53,17 @@ int             readi(struct inode*, char*, uint, uint);
 void            stati(struct inode*, struct stat*);
 int             writei(struct inode*, char*, uint, uint);
 
+// group.c
+struct groupinfo;
+void            groupinit(void);
+void            groupcharge(int, uint64);
+int             groupthrottled(int);
+uint            groupslice(int, uint);
+void            grouptick(void);
+uint            groupnohz(uint);
+int             setquota(int, uint, uint);
+int             getgroupinfo(int, struct groupinfo*);
+
 // ide.c
 void            ideinit(void);
 void            ideintr(void);
@@ -79,6 +90,11 @@ extern volatile uint*    lapic;
 void            lapiceoi(void);
 void            lapicinit(void);
 void            lapicstartap(uchar, uint);
+void            lapickick(int);
+void            lapicnohz(uint);
+void            lapicslice(uint);
+void            lapicstride(uint);
+int             lapictimer(int*);
 void            microdelay(int);
 
 // log.c
@@ -101,24 +117,44 @@ void            pipeclose(struct pipe*, int);
 int             piperead(struct pipe*, char*, int);
 int             pipewrite(struct pipe*, char*, int);
 
+// telemetry.c
+void            telemetryrecord(void);
+int             telemetryread(uint*, uint, int);
+
 //PAGEBREAK: 16
+// procfs.c
+void            procfsinit(void);
+
 // proc.c
+void            classcount(int*);
+void            groupkick(int);
+void            cpufold(void);
 int             cpuid(void);
 void            exit(void);
 int             fork(void);
+int             getaffinity(int, uint*);
 int             growproc(int);
 int             kill(int);
+void            loadbalance(void);
 struct cpu*     mycpu(void);
 struct proc*    myproc();
+int             nrunning(void);
 void            pinit(void);
 void            procdump(void);
 void            scheduler(void) __attribute__((noreturn));
 void            sched(void);
+int             setaffinity(int, uint);
+int             setgroup(int, int);
+int             setqos(int, int);
 void            setproc(struct proc*);
 void            sleep(void*, struct spinlock*);
+void            ttywakeup(void*);
+int             sleepuntil(uint);
 void            userinit(void);
 int             wait(void);
 void            wakeup(void*);
+void            wheeltick(void);
+uint            wheelnext(uint);
 void            yield(void);
 
 // swtch.S
@@ -159,6 +195,13 @@ void            syscall(void);
 // timer.c
 void            timerinit(void);
 
+// tsc.c
+uint64          div64(uint64, uint, uint*);
+void            tscinit(void);
+uint64          tscnow(void);
+uint64          tsc2ns(uint64);
+extern uint     tsc_khz;
+
 // trap.c
 void            idtinit(void);
 extern uint     ticks;
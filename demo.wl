@@ -0,0 +1,15 @@
+# SPAS workload description, one phase per line:
+#   name duty(%) nproc io(%) seconds
+# Run with: workload demo.wl
+idle     0   1  0  10
+light    20  1  0  15
+ramp     50  2  0  15
+full     100 4  0  30
+io       60  2 50  15
+flap1    100 4  0  5
+flap2    5   1  0  5
+flap3    100 4  0  5
+flap4    5   1  0  5
+flap5    100 4  0  5
+flap6    5   1  0  5
+cool     0   1  0  30
@@ -0,0 +1,1409 @@
+
+_energy:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+  return mj;
+}
+
+int
+main(int argc, char *argv[])
+{
+   0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+   4:	83 e4 f0             	and    $0xfffffff0,%esp
+   7:	ff 71 fc             	push   -0x4(%ecx)
+   a:	55                   	push   %ebp
+   b:	89 e5                	mov    %esp,%ebp
+   d:	57                   	push   %edi
+   e:	56                   	push   %esi
+   f:	53                   	push   %ebx
+  10:	51                   	push   %ecx
+  11:	81 ec b8 00 00 00    	sub    $0xb8,%esp
+  struct procinfo before, after;
+  uint sys0, sys1, t0, t1, job;
+  int pid;
+
+  if(argc < 2){
+  17:	83 39 01             	cmpl   $0x1,(%ecx)
+{
+  1a:	8b 59 04             	mov    0x4(%ecx),%ebx
+  if(argc < 2){
+  1d:	0f 8e 1e 01 00 00    	jle    141 <main+0x141>
+    printf(2, "usage: energy command [args...]\n");
+    exit();
+  }
+
+  if(procinfo(getpid(), &before) < 0){
+  23:	e8 6b 04 00 00       	call   493 <getpid>
+  28:	8d 95 48 ff ff ff    	lea    -0xb8(%ebp),%edx
+  2e:	57                   	push   %edi
+  2f:	57                   	push   %edi
+  30:	52                   	push   %edx
+  31:	50                   	push   %eax
+  32:	e8 94 04 00 00       	call   4cb <procinfo>
+  37:	83 c4 10             	add    $0x10,%esp
+  3a:	85 c0                	test   %eax,%eax
+  3c:	0f 88 ec 00 00 00    	js     12e <main+0x12e>
+    printf(2, "energy: procinfo failed\n");
+    exit();
+  }
+  sys0 = sysenergy();
+  42:	e8 49 01 00 00       	call   190 <sysenergy>
+  47:	89 c7                	mov    %eax,%edi
+  t0 = uptime();
+  49:	e8 5d 04 00 00       	call   4ab <uptime>
+  4e:	89 85 44 ff ff ff    	mov    %eax,-0xbc(%ebp)
+
+  pid = fork();
+  54:	e8 b2 03 00 00       	call   40b <fork>
+  59:	89 c6                	mov    %eax,%esi
+  if(pid < 0){
+  5b:	85 c0                	test   %eax,%eax
+  5d:	0f 88 16 01 00 00    	js     179 <main+0x179>
+    printf(2, "energy: fork failed\n");
+    exit();
+  }
+  if(pid == 0){
+  63:	0f 84 eb 00 00 00    	je     154 <main+0x154>
+  69:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    exec(argv[1], argv + 1);
+    printf(2, "energy: exec %s failed\n", argv[1]);
+    exit();
+  }
+  while(wait() != pid)
+  70:	e8 a6 03 00 00       	call   41b <wait>
+  75:	39 f0                	cmp    %esi,%eax
+  77:	75 f7                	jne    70 <main+0x70>
+    ;
+
+  t1 = uptime();
+  79:	e8 2d 04 00 00       	call   4ab <uptime>
+  7e:	89 85 40 ff ff ff    	mov    %eax,-0xc0(%ebp)
+  sys1 = sysenergy();
+  84:	e8 07 01 00 00       	call   190 <sysenergy>
+  89:	89 c6                	mov    %eax,%esi
+  procinfo(getpid(), &after);
+  8b:	e8 03 04 00 00       	call   493 <getpid>
+
+  job = after.child_energy_mj - before.child_energy_mj;
+  printf(2, "%s: job %d.%d%d%d J, system %d.%d%d%d J, %d ticks\n", argv[1],
+         job / 1000, job / 100 % 10, job / 10 % 10, job % 10,
+         (sys1 - sys0) / 1000, (sys1 - sys0) / 100 % 10,
+         (sys1 - sys0) / 10 % 10, (sys1 - sys0) % 10, t1 - t0);
+  90:	29 fe                	sub    %edi,%esi
+  procinfo(getpid(), &after);
+  92:	52                   	push   %edx
+         (sys1 - sys0) / 10 % 10, (sys1 - sys0) % 10, t1 - t0);
+  93:	89 f7                	mov    %esi,%edi
+  printf(2, "%s: job %d.%d%d%d J, system %d.%d%d%d J, %d ticks\n", argv[1],
+  95:	be 0a 00 00 00       	mov    $0xa,%esi
+  procinfo(getpid(), &after);
+  9a:	52                   	push   %edx
+  9b:	8d 55 98             	lea    -0x68(%ebp),%edx
+  9e:	52                   	push   %edx
+  9f:	50                   	push   %eax
+  a0:	e8 26 04 00 00       	call   4cb <procinfo>
+  printf(2, "%s: job %d.%d%d%d J, system %d.%d%d%d J, %d ticks\n", argv[1],
+  a5:	8b 95 44 ff ff ff    	mov    -0xbc(%ebp),%edx
+  ab:	8b 85 40 ff ff ff    	mov    -0xc0(%ebp),%eax
+  job = after.child_energy_mj - before.child_energy_mj;
+  b1:	8b 4d ac             	mov    -0x54(%ebp),%ecx
+  b4:	2b 8d 5c ff ff ff    	sub    -0xa4(%ebp),%ecx
+  printf(2, "%s: job %d.%d%d%d J, system %d.%d%d%d J, %d ticks\n", argv[1],
+  ba:	29 d0                	sub    %edx,%eax
+  bc:	31 d2                	xor    %edx,%edx
+  be:	50                   	push   %eax
+  bf:	89 f8                	mov    %edi,%eax
+  c1:	f7 f6                	div    %esi
+  c3:	52                   	push   %edx
+  c4:	31 d2                	xor    %edx,%edx
+  c6:	f7 f6                	div    %esi
+         (sys1 - sys0) / 1000, (sys1 - sys0) / 100 % 10,
+  c8:	89 f8                	mov    %edi,%eax
+  printf(2, "%s: job %d.%d%d%d J, system %d.%d%d%d J, %d ticks\n", argv[1],
+  ca:	52                   	push   %edx
+         (sys1 - sys0) / 1000, (sys1 - sys0) / 100 % 10,
+  cb:	31 d2                	xor    %edx,%edx
+  cd:	89 bd 44 ff ff ff    	mov    %edi,-0xbc(%ebp)
+  d3:	bf 64 00 00 00       	mov    $0x64,%edi
+  d8:	f7 f7                	div    %edi
+  printf(2, "%s: job %d.%d%d%d J, system %d.%d%d%d J, %d ticks\n", argv[1],
+  da:	31 d2                	xor    %edx,%edx
+  dc:	bf e8 03 00 00       	mov    $0x3e8,%edi
+  e1:	f7 f6                	div    %esi
+  e3:	52                   	push   %edx
+  e4:	8b 85 44 ff ff ff    	mov    -0xbc(%ebp),%eax
+  ea:	31 d2                	xor    %edx,%edx
+  ec:	f7 f7                	div    %edi
+  ee:	31 d2                	xor    %edx,%edx
+         job / 1000, job / 100 % 10, job / 10 % 10, job % 10,
+  f0:	bf 64 00 00 00       	mov    $0x64,%edi
+  printf(2, "%s: job %d.%d%d%d J, system %d.%d%d%d J, %d ticks\n", argv[1],
+  f5:	50                   	push   %eax
+  f6:	89 c8                	mov    %ecx,%eax
+  f8:	f7 f6                	div    %esi
+  fa:	52                   	push   %edx
+  fb:	31 d2                	xor    %edx,%edx
+  fd:	f7 f6                	div    %esi
+         job / 1000, job / 100 % 10, job / 10 % 10, job % 10,
+  ff:	89 c8                	mov    %ecx,%eax
+  printf(2, "%s: job %d.%d%d%d J, system %d.%d%d%d J, %d ticks\n", argv[1],
+ 101:	52                   	push   %edx
+         job / 1000, job / 100 % 10, job / 10 % 10, job % 10,
+ 102:	31 d2                	xor    %edx,%edx
+ 104:	f7 f7                	div    %edi
+  printf(2, "%s: job %d.%d%d%d J, system %d.%d%d%d J, %d ticks\n", argv[1],
+ 106:	31 d2                	xor    %edx,%edx
+ 108:	bf e8 03 00 00       	mov    $0x3e8,%edi
+ 10d:	f7 f6                	div    %esi
+ 10f:	89 c8                	mov    %ecx,%eax
+ 111:	52                   	push   %edx
+ 112:	31 d2                	xor    %edx,%edx
+ 114:	f7 f7                	div    %edi
+ 116:	50                   	push   %eax
+ 117:	ff 73 04             	push   0x4(%ebx)
+ 11a:	68 1c 09 00 00       	push   $0x91c
+ 11f:	6a 02                	push   $0x2
+ 121:	e8 aa 04 00 00       	call   5d0 <printf>
+  exit();
+ 126:	83 c4 40             	add    $0x40,%esp
+ 129:	e8 e5 02 00 00       	call   413 <exit>
+    printf(2, "energy: procinfo failed\n");
+ 12e:	56                   	push   %esi
+ 12f:	56                   	push   %esi
+ 130:	68 4f 09 00 00       	push   $0x94f
+ 135:	6a 02                	push   $0x2
+ 137:	e8 94 04 00 00       	call   5d0 <printf>
+    exit();
+ 13c:	e8 d2 02 00 00       	call   413 <exit>
+    printf(2, "usage: energy command [args...]\n");
+ 141:	50                   	push   %eax
+ 142:	50                   	push   %eax
+ 143:	68 f8 08 00 00       	push   $0x8f8
+ 148:	6a 02                	push   $0x2
+ 14a:	e8 81 04 00 00       	call   5d0 <printf>
+    exit();
+ 14f:	e8 bf 02 00 00       	call   413 <exit>
+    exec(argv[1], argv + 1);
+ 154:	8d 43 04             	lea    0x4(%ebx),%eax
+ 157:	51                   	push   %ecx
+ 158:	51                   	push   %ecx
+ 159:	50                   	push   %eax
+ 15a:	ff 73 04             	push   0x4(%ebx)
+ 15d:	e8 e9 02 00 00       	call   44b <exec>
+    printf(2, "energy: exec %s failed\n", argv[1]);
+ 162:	83 c4 0c             	add    $0xc,%esp
+ 165:	ff 73 04             	push   0x4(%ebx)
+ 168:	68 7d 09 00 00       	push   $0x97d
+ 16d:	6a 02                	push   $0x2
+ 16f:	e8 5c 04 00 00       	call   5d0 <printf>
+    exit();
+ 174:	e8 9a 02 00 00       	call   413 <exit>
+    printf(2, "energy: fork failed\n");
+ 179:	53                   	push   %ebx
+ 17a:	53                   	push   %ebx
+ 17b:	68 68 09 00 00       	push   $0x968
+ 180:	6a 02                	push   $0x2
+ 182:	e8 49 04 00 00       	call   5d0 <printf>
+    exit();
+ 187:	e8 87 02 00 00       	call   413 <exit>
+ 18c:	66 90                	xchg   %ax,%ax
+ 18e:	66 90                	xchg   %ax,%ax
+
+00000190 <sysenergy>:
+{
+ 190:	55                   	push   %ebp
+ 191:	89 e5                	mov    %esp,%ebp
+ 193:	57                   	push   %edi
+ 194:	56                   	push   %esi
+ 195:	8d 7d a8             	lea    -0x58(%ebp),%edi
+  mj = 0;
+ 198:	31 f6                	xor    %esi,%esi
+{
+ 19a:	53                   	push   %ebx
+  for(i = 0; cpuinfo(i, &ci) == 0; i++)
+ 19b:	31 db                	xor    %ebx,%ebx
+{
+ 19d:	83 ec 4c             	sub    $0x4c,%esp
+  for(i = 0; cpuinfo(i, &ci) == 0; i++)
+ 1a0:	eb 0c                	jmp    1ae <sysenergy+0x1e>
+ 1a2:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    mj += ci.energy_mj;
+ 1a8:	03 75 c0             	add    -0x40(%ebp),%esi
+  for(i = 0; cpuinfo(i, &ci) == 0; i++)
+ 1ab:	83 c3 01             	add    $0x1,%ebx
+ 1ae:	83 ec 08             	sub    $0x8,%esp
+ 1b1:	57                   	push   %edi
+ 1b2:	53                   	push   %ebx
+ 1b3:	e8 0b 03 00 00       	call   4c3 <cpuinfo>
+ 1b8:	83 c4 10             	add    $0x10,%esp
+ 1bb:	85 c0                	test   %eax,%eax
+ 1bd:	74 e9                	je     1a8 <sysenergy+0x18>
+}
+ 1bf:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 1c2:	89 f0                	mov    %esi,%eax
+ 1c4:	5b                   	pop    %ebx
+ 1c5:	5e                   	pop    %esi
+ 1c6:	5f                   	pop    %edi
+ 1c7:	5d                   	pop    %ebp
+ 1c8:	c3                   	ret
+ 1c9:	66 90                	xchg   %ax,%ax
+ 1cb:	66 90                	xchg   %ax,%ax
+ 1cd:	66 90                	xchg   %ax,%ax
+ 1cf:	90                   	nop
+
+000001d0 <strcpy>:
+#include "user.h"
+#include "x86.h"
+
+char*
+strcpy(char *s, const char *t)
+{
+ 1d0:	55                   	push   %ebp
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+ 1d1:	31 c0                	xor    %eax,%eax
+{
+ 1d3:	89 e5                	mov    %esp,%ebp
+ 1d5:	53                   	push   %ebx
+ 1d6:	8b 4d 08             	mov    0x8(%ebp),%ecx
+ 1d9:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+ 1dc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  while((*s++ = *t++) != 0)
+ 1e0:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+ 1e4:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+ 1e7:	83 c0 01             	add    $0x1,%eax
+ 1ea:	84 d2                	test   %dl,%dl
+ 1ec:	75 f2                	jne    1e0 <strcpy+0x10>
+    ;
+  return os;
+}
+ 1ee:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 1f1:	89 c8                	mov    %ecx,%eax
+ 1f3:	c9                   	leave
+ 1f4:	c3                   	ret
+ 1f5:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 1fc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000200 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+ 200:	55                   	push   %ebp
+ 201:	89 e5                	mov    %esp,%ebp
+ 203:	53                   	push   %ebx
+ 204:	8b 55 08             	mov    0x8(%ebp),%edx
+ 207:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  while(*p && *p == *q)
+ 20a:	0f b6 02             	movzbl (%edx),%eax
+ 20d:	84 c0                	test   %al,%al
+ 20f:	75 17                	jne    228 <strcmp+0x28>
+ 211:	eb 3a                	jmp    24d <strcmp+0x4d>
+ 213:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 217:	90                   	nop
+ 218:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+    p++, q++;
+ 21c:	83 c2 01             	add    $0x1,%edx
+ 21f:	8d 59 01             	lea    0x1(%ecx),%ebx
+  while(*p && *p == *q)
+ 222:	84 c0                	test   %al,%al
+ 224:	74 1a                	je     240 <strcmp+0x40>
+    p++, q++;
+ 226:	89 d9                	mov    %ebx,%ecx
+  while(*p && *p == *q)
+ 228:	0f b6 19             	movzbl (%ecx),%ebx
+ 22b:	38 c3                	cmp    %al,%bl
+ 22d:	74 e9                	je     218 <strcmp+0x18>
+  return (uchar)*p - (uchar)*q;
+ 22f:	29 d8                	sub    %ebx,%eax
+}
+ 231:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 234:	c9                   	leave
+ 235:	c3                   	ret
+ 236:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 23d:	8d 76 00             	lea    0x0(%esi),%esi
+  return (uchar)*p - (uchar)*q;
+ 240:	0f b6 59 01          	movzbl 0x1(%ecx),%ebx
+ 244:	31 c0                	xor    %eax,%eax
+ 246:	29 d8                	sub    %ebx,%eax
+}
+ 248:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 24b:	c9                   	leave
+ 24c:	c3                   	ret
+  return (uchar)*p - (uchar)*q;
+ 24d:	0f b6 19             	movzbl (%ecx),%ebx
+ 250:	31 c0                	xor    %eax,%eax
+ 252:	eb db                	jmp    22f <strcmp+0x2f>
+ 254:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 25b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 25f:	90                   	nop
+
+00000260 <strlen>:
+
+uint
+strlen(const char *s)
+{
+ 260:	55                   	push   %ebp
+ 261:	89 e5                	mov    %esp,%ebp
+ 263:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for(n = 0; s[n]; n++)
+ 266:	80 3a 00             	cmpb   $0x0,(%edx)
+ 269:	74 15                	je     280 <strlen+0x20>
+ 26b:	31 c0                	xor    %eax,%eax
+ 26d:	8d 76 00             	lea    0x0(%esi),%esi
+ 270:	83 c0 01             	add    $0x1,%eax
+ 273:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+ 277:	89 c1                	mov    %eax,%ecx
+ 279:	75 f5                	jne    270 <strlen+0x10>
+    ;
+  return n;
+}
+ 27b:	89 c8                	mov    %ecx,%eax
+ 27d:	5d                   	pop    %ebp
+ 27e:	c3                   	ret
+ 27f:	90                   	nop
+  for(n = 0; s[n]; n++)
+ 280:	31 c9                	xor    %ecx,%ecx
+}
+ 282:	5d                   	pop    %ebp
+ 283:	89 c8                	mov    %ecx,%eax
+ 285:	c3                   	ret
+ 286:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 28d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000290 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+ 290:	55                   	push   %ebp
+ 291:	89 e5                	mov    %esp,%ebp
+ 293:	57                   	push   %edi
+ 294:	8b 55 08             	mov    0x8(%ebp),%edx
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosb" :
+ 297:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 29a:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 29d:	89 d7                	mov    %edx,%edi
+ 29f:	fc                   	cld
+ 2a0:	f3 aa                	rep stos %al,%es:(%edi)
+  stosb(dst, c, n);
+  return dst;
+}
+ 2a2:	8b 7d fc             	mov    -0x4(%ebp),%edi
+ 2a5:	89 d0                	mov    %edx,%eax
+ 2a7:	c9                   	leave
+ 2a8:	c3                   	ret
+ 2a9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+000002b0 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+ 2b0:	55                   	push   %ebp
+ 2b1:	89 e5                	mov    %esp,%ebp
+ 2b3:	8b 45 08             	mov    0x8(%ebp),%eax
+ 2b6:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+ 2ba:	0f b6 10             	movzbl (%eax),%edx
+ 2bd:	84 d2                	test   %dl,%dl
+ 2bf:	75 12                	jne    2d3 <strchr+0x23>
+ 2c1:	eb 1d                	jmp    2e0 <strchr+0x30>
+ 2c3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 2c7:	90                   	nop
+ 2c8:	0f b6 50 01          	movzbl 0x1(%eax),%edx
+ 2cc:	83 c0 01             	add    $0x1,%eax
+ 2cf:	84 d2                	test   %dl,%dl
+ 2d1:	74 0d                	je     2e0 <strchr+0x30>
+    if(*s == c)
+ 2d3:	38 d1                	cmp    %dl,%cl
+ 2d5:	75 f1                	jne    2c8 <strchr+0x18>
+      return (char*)s;
+  return 0;
+}
+ 2d7:	5d                   	pop    %ebp
+ 2d8:	c3                   	ret
+ 2d9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  return 0;
+ 2e0:	31 c0                	xor    %eax,%eax
+}
+ 2e2:	5d                   	pop    %ebp
+ 2e3:	c3                   	ret
+ 2e4:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 2eb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 2ef:	90                   	nop
+
+000002f0 <gets>:
+
+char*
+gets(char *buf, int max)
+{
+ 2f0:	55                   	push   %ebp
+ 2f1:	89 e5                	mov    %esp,%ebp
+ 2f3:	57                   	push   %edi
+ 2f4:	56                   	push   %esi
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+    cc = read(0, &c, 1);
+ 2f5:	8d 75 e7             	lea    -0x19(%ebp),%esi
+{
+ 2f8:	53                   	push   %ebx
+  for(i=0; i+1 < max; ){
+ 2f9:	31 db                	xor    %ebx,%ebx
+{
+ 2fb:	83 ec 1c             	sub    $0x1c,%esp
+  for(i=0; i+1 < max; ){
+ 2fe:	eb 27                	jmp    327 <gets+0x37>
+    cc = read(0, &c, 1);
+ 300:	83 ec 04             	sub    $0x4,%esp
+ 303:	6a 01                	push   $0x1
+ 305:	56                   	push   %esi
+ 306:	6a 00                	push   $0x0
+ 308:	e8 1e 01 00 00       	call   42b <read>
+    if(cc < 1)
+ 30d:	83 c4 10             	add    $0x10,%esp
+ 310:	85 c0                	test   %eax,%eax
+ 312:	7e 1d                	jle    331 <gets+0x41>
+      break;
+    buf[i++] = c;
+ 314:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+ 318:	8b 55 08             	mov    0x8(%ebp),%edx
+ 31b:	88 44 1a ff          	mov    %al,-0x1(%edx,%ebx,1)
+    if(c == '\n' || c == '\r')
+ 31f:	3c 0a                	cmp    $0xa,%al
+ 321:	74 10                	je     333 <gets+0x43>
+ 323:	3c 0d                	cmp    $0xd,%al
+ 325:	74 0c                	je     333 <gets+0x43>
+  for(i=0; i+1 < max; ){
+ 327:	89 df                	mov    %ebx,%edi
+ 329:	83 c3 01             	add    $0x1,%ebx
+ 32c:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+ 32f:	7c cf                	jl     300 <gets+0x10>
+ 331:	89 fb                	mov    %edi,%ebx
+      break;
+  }
+  buf[i] = '\0';
+ 333:	8b 45 08             	mov    0x8(%ebp),%eax
+ 336:	c6 04 18 00          	movb   $0x0,(%eax,%ebx,1)
+  return buf;
+}
+ 33a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 33d:	5b                   	pop    %ebx
+ 33e:	5e                   	pop    %esi
+ 33f:	5f                   	pop    %edi
+ 340:	5d                   	pop    %ebp
+ 341:	c3                   	ret
+ 342:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 349:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000350 <stat>:
+
+int
+stat(const char *n, struct stat *st)
+{
+ 350:	55                   	push   %ebp
+ 351:	89 e5                	mov    %esp,%ebp
+ 353:	56                   	push   %esi
+ 354:	53                   	push   %ebx
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+ 355:	83 ec 08             	sub    $0x8,%esp
+ 358:	6a 00                	push   $0x0
+ 35a:	ff 75 08             	push   0x8(%ebp)
+ 35d:	e8 f1 00 00 00       	call   453 <open>
+  if(fd < 0)
+ 362:	83 c4 10             	add    $0x10,%esp
+ 365:	85 c0                	test   %eax,%eax
+ 367:	78 27                	js     390 <stat+0x40>
+    return -1;
+  r = fstat(fd, st);
+ 369:	83 ec 08             	sub    $0x8,%esp
+ 36c:	ff 75 0c             	push   0xc(%ebp)
+ 36f:	89 c3                	mov    %eax,%ebx
+ 371:	50                   	push   %eax
+ 372:	e8 f4 00 00 00       	call   46b <fstat>
+  close(fd);
+ 377:	89 1c 24             	mov    %ebx,(%esp)
+  r = fstat(fd, st);
+ 37a:	89 c6                	mov    %eax,%esi
+  close(fd);
+ 37c:	e8 ba 00 00 00       	call   43b <close>
+  return r;
+ 381:	83 c4 10             	add    $0x10,%esp
+}
+ 384:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 387:	89 f0                	mov    %esi,%eax
+ 389:	5b                   	pop    %ebx
+ 38a:	5e                   	pop    %esi
+ 38b:	5d                   	pop    %ebp
+ 38c:	c3                   	ret
+ 38d:	8d 76 00             	lea    0x0(%esi),%esi
+    return -1;
+ 390:	be ff ff ff ff       	mov    $0xffffffff,%esi
+ 395:	eb ed                	jmp    384 <stat+0x34>
+ 397:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 39e:	66 90                	xchg   %ax,%ax
+
+000003a0 <atoi>:
+
+int
+atoi(const char *s)
+{
+ 3a0:	55                   	push   %ebp
+ 3a1:	89 e5                	mov    %esp,%ebp
+ 3a3:	53                   	push   %ebx
+ 3a4:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  n = 0;
+  while('0' <= *s && *s <= '9')
+ 3a7:	0f be 02             	movsbl (%edx),%eax
+ 3aa:	8d 48 d0             	lea    -0x30(%eax),%ecx
+ 3ad:	80 f9 09             	cmp    $0x9,%cl
+  n = 0;
+ 3b0:	b9 00 00 00 00       	mov    $0x0,%ecx
+  while('0' <= *s && *s <= '9')
+ 3b5:	77 1e                	ja     3d5 <atoi+0x35>
+ 3b7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 3be:	66 90                	xchg   %ax,%ax
+    n = n*10 + *s++ - '0';
+ 3c0:	83 c2 01             	add    $0x1,%edx
+ 3c3:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+ 3c6:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+  while('0' <= *s && *s <= '9')
+ 3ca:	0f be 02             	movsbl (%edx),%eax
+ 3cd:	8d 58 d0             	lea    -0x30(%eax),%ebx
+ 3d0:	80 fb 09             	cmp    $0x9,%bl
+ 3d3:	76 eb                	jbe    3c0 <atoi+0x20>
+  return n;
+}
+ 3d5:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 3d8:	89 c8                	mov    %ecx,%eax
+ 3da:	c9                   	leave
+ 3db:	c3                   	ret
+ 3dc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000003e0 <memmove>:
+
+void*
+memmove(void *vdst, const void *vsrc, int n)
+{
+ 3e0:	55                   	push   %ebp
+ 3e1:	89 e5                	mov    %esp,%ebp
+ 3e3:	57                   	push   %edi
+ 3e4:	56                   	push   %esi
+ 3e5:	8b 45 10             	mov    0x10(%ebp),%eax
+ 3e8:	8b 55 08             	mov    0x8(%ebp),%edx
+ 3eb:	8b 75 0c             	mov    0xc(%ebp),%esi
+  char *dst;
+  const char *src;
+
+  dst = vdst;
+  src = vsrc;
+  while(n-- > 0)
+ 3ee:	85 c0                	test   %eax,%eax
+ 3f0:	7e 13                	jle    405 <memmove+0x25>
+ 3f2:	01 d0                	add    %edx,%eax
+  dst = vdst;
+ 3f4:	89 d7                	mov    %edx,%edi
+ 3f6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 3fd:	8d 76 00             	lea    0x0(%esi),%esi
+    *dst++ = *src++;
+ 400:	a4                   	movsb  %ds:(%esi),%es:(%edi)
+  while(n-- > 0)
+ 401:	39 f8                	cmp    %edi,%eax
+ 403:	75 fb                	jne    400 <memmove+0x20>
+  return vdst;
+}
+ 405:	5e                   	pop    %esi
+ 406:	89 d0                	mov    %edx,%eax
+ 408:	5f                   	pop    %edi
+ 409:	5d                   	pop    %ebp
+ 40a:	c3                   	ret
+
+0000040b <fork>:
+  name: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+SYSCALL(fork)
+ 40b:	b8 01 00 00 00       	mov    $0x1,%eax
+ 410:	cd 40                	int    $0x40
+ 412:	c3                   	ret
+
+00000413 <exit>:
+SYSCALL(exit)
+ 413:	b8 02 00 00 00       	mov    $0x2,%eax
+ 418:	cd 40                	int    $0x40
+ 41a:	c3                   	ret
+
+0000041b <wait>:
+SYSCALL(wait)
+ 41b:	b8 03 00 00 00       	mov    $0x3,%eax
+ 420:	cd 40                	int    $0x40
+ 422:	c3                   	ret
+
+00000423 <pipe>:
+SYSCALL(pipe)
+ 423:	b8 04 00 00 00       	mov    $0x4,%eax
+ 428:	cd 40                	int    $0x40
+ 42a:	c3                   	ret
+
+0000042b <read>:
+SYSCALL(read)
+ 42b:	b8 05 00 00 00       	mov    $0x5,%eax
+ 430:	cd 40                	int    $0x40
+ 432:	c3                   	ret
+
+00000433 <write>:
+SYSCALL(write)
+ 433:	b8 10 00 00 00       	mov    $0x10,%eax
+ 438:	cd 40                	int    $0x40
+ 43a:	c3                   	ret
+
+0000043b <close>:
+SYSCALL(close)
+ 43b:	b8 15 00 00 00       	mov    $0x15,%eax
+ 440:	cd 40                	int    $0x40
+ 442:	c3                   	ret
+
+00000443 <kill>:
+SYSCALL(kill)
+ 443:	b8 06 00 00 00       	mov    $0x6,%eax
+ 448:	cd 40                	int    $0x40
+ 44a:	c3                   	ret
+
+0000044b <exec>:
+SYSCALL(exec)
+ 44b:	b8 07 00 00 00       	mov    $0x7,%eax
+ 450:	cd 40                	int    $0x40
+ 452:	c3                   	ret
+
+00000453 <open>:
+SYSCALL(open)
+ 453:	b8 0f 00 00 00       	mov    $0xf,%eax
+ 458:	cd 40                	int    $0x40
+ 45a:	c3                   	ret
+
+0000045b <mknod>:
+SYSCALL(mknod)
+ 45b:	b8 11 00 00 00       	mov    $0x11,%eax
+ 460:	cd 40                	int    $0x40
+ 462:	c3                   	ret
+
+00000463 <unlink>:
+SYSCALL(unlink)
+ 463:	b8 12 00 00 00       	mov    $0x12,%eax
+ 468:	cd 40                	int    $0x40
+ 46a:	c3                   	ret
+
+0000046b <fstat>:
+SYSCALL(fstat)
+ 46b:	b8 08 00 00 00       	mov    $0x8,%eax
+ 470:	cd 40                	int    $0x40
+ 472:	c3                   	ret
+
+00000473 <link>:
+SYSCALL(link)
+ 473:	b8 13 00 00 00       	mov    $0x13,%eax
+ 478:	cd 40                	int    $0x40
+ 47a:	c3                   	ret
+
+0000047b <mkdir>:
+SYSCALL(mkdir)
+ 47b:	b8 14 00 00 00       	mov    $0x14,%eax
+ 480:	cd 40                	int    $0x40
+ 482:	c3                   	ret
+
+00000483 <chdir>:
+SYSCALL(chdir)
+ 483:	b8 09 00 00 00       	mov    $0x9,%eax
+ 488:	cd 40                	int    $0x40
+ 48a:	c3                   	ret
+
+0000048b <dup>:
+SYSCALL(dup)
+ 48b:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 490:	cd 40                	int    $0x40
+ 492:	c3                   	ret
+
+00000493 <getpid>:
+SYSCALL(getpid)
+ 493:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 498:	cd 40                	int    $0x40
+ 49a:	c3                   	ret
+
+0000049b <sbrk>:
+SYSCALL(sbrk)
+ 49b:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 4a0:	cd 40                	int    $0x40
+ 4a2:	c3                   	ret
+
+000004a3 <sleep>:
+SYSCALL(sleep)
+ 4a3:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 4a8:	cd 40                	int    $0x40
+ 4aa:	c3                   	ret
+
+000004ab <uptime>:
+SYSCALL(uptime)
+ 4ab:	b8 0e 00 00 00       	mov    $0xe,%eax
+ 4b0:	cd 40                	int    $0x40
+ 4b2:	c3                   	ret
+
+000004b3 <cpustat>:
+SYSCALL(cpustat)
+ 4b3:	b8 16 00 00 00       	mov    $0x16,%eax
+ 4b8:	cd 40                	int    $0x40
+ 4ba:	c3                   	ret
+
+000004bb <setpriority>:
+SYSCALL(setpriority)
+ 4bb:	b8 17 00 00 00       	mov    $0x17,%eax
+ 4c0:	cd 40                	int    $0x40
+ 4c2:	c3                   	ret
+
+000004c3 <cpuinfo>:
+SYSCALL(cpuinfo)
+ 4c3:	b8 18 00 00 00       	mov    $0x18,%eax
+ 4c8:	cd 40                	int    $0x40
+ 4ca:	c3                   	ret
+
+000004cb <procinfo>:
+SYSCALL(procinfo)
+ 4cb:	b8 19 00 00 00       	mov    $0x19,%eax
+ 4d0:	cd 40                	int    $0x40
+ 4d2:	c3                   	ret
+
+000004d3 <setgovernor>:
+SYSCALL(setgovernor)
+ 4d3:	b8 1a 00 00 00       	mov    $0x1a,%eax
+ 4d8:	cd 40                	int    $0x40
+ 4da:	c3                   	ret
+
+000004db <sysctl>:
+SYSCALL(sysctl)
+ 4db:	b8 1b 00 00 00       	mov    $0x1b,%eax
+ 4e0:	cd 40                	int    $0x40
+ 4e2:	c3                   	ret
+
+000004e3 <telemetry>:
+SYSCALL(telemetry)
+ 4e3:	b8 1c 00 00 00       	mov    $0x1c,%eax
+ 4e8:	cd 40                	int    $0x40
+ 4ea:	c3                   	ret
+
+000004eb <clock_gettime>:
+SYSCALL(clock_gettime)
+ 4eb:	b8 1d 00 00 00       	mov    $0x1d,%eax
+ 4f0:	cd 40                	int    $0x40
+ 4f2:	c3                   	ret
+
+000004f3 <sched_setaffinity>:
+SYSCALL(sched_setaffinity)
+ 4f3:	b8 1e 00 00 00       	mov    $0x1e,%eax
+ 4f8:	cd 40                	int    $0x40
+ 4fa:	c3                   	ret
+
+000004fb <sched_getaffinity>:
+SYSCALL(sched_getaffinity)
+ 4fb:	b8 1f 00 00 00       	mov    $0x1f,%eax
+ 500:	cd 40                	int    $0x40
+ 502:	c3                   	ret
+
+00000503 <setqos>:
+SYSCALL(setqos)
+ 503:	b8 20 00 00 00       	mov    $0x20,%eax
+ 508:	cd 40                	int    $0x40
+ 50a:	c3                   	ret
+
+0000050b <setgroup>:
+SYSCALL(setgroup)
+ 50b:	b8 21 00 00 00       	mov    $0x21,%eax
+ 510:	cd 40                	int    $0x40
+ 512:	c3                   	ret
+
+00000513 <setquota>:
+SYSCALL(setquota)
+ 513:	b8 22 00 00 00       	mov    $0x22,%eax
+ 518:	cd 40                	int    $0x40
+ 51a:	c3                   	ret
+
+0000051b <groupinfo>:
+SYSCALL(groupinfo)
+ 51b:	b8 23 00 00 00       	mov    $0x23,%eax
+ 520:	cd 40                	int    $0x40
+ 522:	c3                   	ret
+ 523:	66 90                	xchg   %ax,%ax
+ 525:	66 90                	xchg   %ax,%ax
+ 527:	66 90                	xchg   %ax,%ax
+ 529:	66 90                	xchg   %ax,%ax
+ 52b:	66 90                	xchg   %ax,%ax
+ 52d:	66 90                	xchg   %ax,%ax
+ 52f:	90                   	nop
+
+00000530 <printint>:
+  write(fd, &c, 1);
+}
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+ 530:	55                   	push   %ebp
+ 531:	89 e5                	mov    %esp,%ebp
+ 533:	57                   	push   %edi
+ 534:	56                   	push   %esi
+ 535:	53                   	push   %ebx
+ 536:	89 cb                	mov    %ecx,%ebx
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+    neg = 1;
+    x = -xx;
+ 538:	89 d1                	mov    %edx,%ecx
+{
+ 53a:	83 ec 3c             	sub    $0x3c,%esp
+ 53d:	89 45 c0             	mov    %eax,-0x40(%ebp)
+  if(sgn && xx < 0){
+ 540:	85 d2                	test   %edx,%edx
+ 542:	0f 89 80 00 00 00    	jns    5c8 <printint+0x98>
+ 548:	f6 45 08 01          	testb  $0x1,0x8(%ebp)
+ 54c:	74 7a                	je     5c8 <printint+0x98>
+    x = -xx;
+ 54e:	f7 d9                	neg    %ecx
+    neg = 1;
+ 550:	b8 01 00 00 00       	mov    $0x1,%eax
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+ 555:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+ 558:	31 f6                	xor    %esi,%esi
+ 55a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  do{
+    buf[i++] = digits[x % base];
+ 560:	89 c8                	mov    %ecx,%eax
+ 562:	31 d2                	xor    %edx,%edx
+ 564:	89 f7                	mov    %esi,%edi
+ 566:	f7 f3                	div    %ebx
+ 568:	8d 76 01             	lea    0x1(%esi),%esi
+ 56b:	0f b6 92 f4 09 00 00 	movzbl 0x9f4(%edx),%edx
+ 572:	88 54 35 d7          	mov    %dl,-0x29(%ebp,%esi,1)
+  }while((x /= base) != 0);
+ 576:	89 ca                	mov    %ecx,%edx
+ 578:	89 c1                	mov    %eax,%ecx
+ 57a:	39 da                	cmp    %ebx,%edx
+ 57c:	73 e2                	jae    560 <printint+0x30>
+  if(neg)
+ 57e:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+ 581:	85 c0                	test   %eax,%eax
+ 583:	74 07                	je     58c <printint+0x5c>
+    buf[i++] = '-';
+ 585:	c6 44 35 d8 2d       	movb   $0x2d,-0x28(%ebp,%esi,1)
+    buf[i++] = digits[x % base];
+ 58a:	89 f7                	mov    %esi,%edi
+ 58c:	8d 5d d8             	lea    -0x28(%ebp),%ebx
+ 58f:	8b 75 c0             	mov    -0x40(%ebp),%esi
+ 592:	01 df                	add    %ebx,%edi
+ 594:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+  while(--i >= 0)
+    putc(fd, buf[i]);
+ 598:	0f b6 07             	movzbl (%edi),%eax
+  write(fd, &c, 1);
+ 59b:	83 ec 04             	sub    $0x4,%esp
+ 59e:	88 45 d7             	mov    %al,-0x29(%ebp)
+ 5a1:	8d 45 d7             	lea    -0x29(%ebp),%eax
+ 5a4:	6a 01                	push   $0x1
+ 5a6:	50                   	push   %eax
+ 5a7:	56                   	push   %esi
+ 5a8:	e8 86 fe ff ff       	call   433 <write>
+  while(--i >= 0)
+ 5ad:	89 f8                	mov    %edi,%eax
+ 5af:	83 c4 10             	add    $0x10,%esp
+ 5b2:	83 ef 01             	sub    $0x1,%edi
+ 5b5:	39 d8                	cmp    %ebx,%eax
+ 5b7:	75 df                	jne    598 <printint+0x68>
+}
+ 5b9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 5bc:	5b                   	pop    %ebx
+ 5bd:	5e                   	pop    %esi
+ 5be:	5f                   	pop    %edi
+ 5bf:	5d                   	pop    %ebp
+ 5c0:	c3                   	ret
+ 5c1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  neg = 0;
+ 5c8:	31 c0                	xor    %eax,%eax
+ 5ca:	eb 89                	jmp    555 <printint+0x25>
+ 5cc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000005d0 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, const char *fmt, ...)
+{
+ 5d0:	55                   	push   %ebp
+ 5d1:	89 e5                	mov    %esp,%ebp
+ 5d3:	57                   	push   %edi
+ 5d4:	56                   	push   %esi
+ 5d5:	53                   	push   %ebx
+ 5d6:	83 ec 2c             	sub    $0x2c,%esp
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+  ap = (uint*)(void*)&fmt + 1;
+  for(i = 0; fmt[i]; i++){
+ 5d9:	8b 75 0c             	mov    0xc(%ebp),%esi
+{
+ 5dc:	8b 7d 08             	mov    0x8(%ebp),%edi
+  for(i = 0; fmt[i]; i++){
+ 5df:	0f b6 1e             	movzbl (%esi),%ebx
+ 5e2:	83 c6 01             	add    $0x1,%esi
+ 5e5:	84 db                	test   %bl,%bl
+ 5e7:	74 67                	je     650 <printf+0x80>
+ 5e9:	8d 4d 10             	lea    0x10(%ebp),%ecx
+ 5ec:	31 d2                	xor    %edx,%edx
+ 5ee:	89 4d d0             	mov    %ecx,-0x30(%ebp)
+ 5f1:	eb 34                	jmp    627 <printf+0x57>
+ 5f3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 5f7:	90                   	nop
+ 5f8:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+        state = '%';
+ 5fb:	ba 25 00 00 00       	mov    $0x25,%edx
+      if(c == '%'){
+ 600:	83 f8 25             	cmp    $0x25,%eax
+ 603:	74 18                	je     61d <printf+0x4d>
+  write(fd, &c, 1);
+ 605:	83 ec 04             	sub    $0x4,%esp
+ 608:	8d 45 e7             	lea    -0x19(%ebp),%eax
+ 60b:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 60e:	6a 01                	push   $0x1
+ 610:	50                   	push   %eax
+ 611:	57                   	push   %edi
+ 612:	e8 1c fe ff ff       	call   433 <write>
+ 617:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+      } else {
+        putc(fd, c);
+ 61a:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; fmt[i]; i++){
+ 61d:	0f b6 1e             	movzbl (%esi),%ebx
+ 620:	83 c6 01             	add    $0x1,%esi
+ 623:	84 db                	test   %bl,%bl
+ 625:	74 29                	je     650 <printf+0x80>
+    c = fmt[i] & 0xff;
+ 627:	0f b6 c3             	movzbl %bl,%eax
+    if(state == 0){
+ 62a:	85 d2                	test   %edx,%edx
+ 62c:	74 ca                	je     5f8 <printf+0x28>
+      }
+    } else if(state == '%'){
+ 62e:	83 fa 25             	cmp    $0x25,%edx
+ 631:	75 ea                	jne    61d <printf+0x4d>
+      if(c == 'd'){
+ 633:	83 f8 25             	cmp    $0x25,%eax
+ 636:	0f 84 24 01 00 00    	je     760 <printf+0x190>
+ 63c:	83 e8 63             	sub    $0x63,%eax
+ 63f:	83 f8 15             	cmp    $0x15,%eax
+ 642:	77 1c                	ja     660 <printf+0x90>
+ 644:	ff 24 85 9c 09 00 00 	jmp    *0x99c(,%eax,4)
+ 64b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 64f:	90                   	nop
+        putc(fd, c);
+      }
+      state = 0;
+    }
+  }
+}
+ 650:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 653:	5b                   	pop    %ebx
+ 654:	5e                   	pop    %esi
+ 655:	5f                   	pop    %edi
+ 656:	5d                   	pop    %ebp
+ 657:	c3                   	ret
+ 658:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 65f:	90                   	nop
+  write(fd, &c, 1);
+ 660:	83 ec 04             	sub    $0x4,%esp
+ 663:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 666:	c6 45 e7 25          	movb   $0x25,-0x19(%ebp)
+ 66a:	6a 01                	push   $0x1
+ 66c:	52                   	push   %edx
+ 66d:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+ 670:	57                   	push   %edi
+ 671:	e8 bd fd ff ff       	call   433 <write>
+ 676:	83 c4 0c             	add    $0xc,%esp
+ 679:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 67c:	6a 01                	push   $0x1
+ 67e:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+ 681:	52                   	push   %edx
+ 682:	57                   	push   %edi
+ 683:	e8 ab fd ff ff       	call   433 <write>
+        putc(fd, c);
+ 688:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 68b:	31 d2                	xor    %edx,%edx
+ 68d:	eb 8e                	jmp    61d <printf+0x4d>
+ 68f:	90                   	nop
+        printint(fd, *ap, 16, 0);
+ 690:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+ 693:	83 ec 0c             	sub    $0xc,%esp
+ 696:	b9 10 00 00 00       	mov    $0x10,%ecx
+ 69b:	8b 13                	mov    (%ebx),%edx
+ 69d:	6a 00                	push   $0x0
+ 69f:	89 f8                	mov    %edi,%eax
+        ap++;
+ 6a1:	83 c3 04             	add    $0x4,%ebx
+        printint(fd, *ap, 16, 0);
+ 6a4:	e8 87 fe ff ff       	call   530 <printint>
+        ap++;
+ 6a9:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+ 6ac:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 6af:	31 d2                	xor    %edx,%edx
+ 6b1:	e9 67 ff ff ff       	jmp    61d <printf+0x4d>
+ 6b6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 6bd:	8d 76 00             	lea    0x0(%esi),%esi
+        s = (char*)*ap;
+ 6c0:	8b 45 d0             	mov    -0x30(%ebp),%eax
+ 6c3:	8b 18                	mov    (%eax),%ebx
+        ap++;
+ 6c5:	83 c0 04             	add    $0x4,%eax
+ 6c8:	89 45 d0             	mov    %eax,-0x30(%ebp)
+        if(s == 0)
+ 6cb:	85 db                	test   %ebx,%ebx
+ 6cd:	0f 84 9d 00 00 00    	je     770 <printf+0x1a0>
+        while(*s != 0){
+ 6d3:	0f b6 03             	movzbl (%ebx),%eax
+      state = 0;
+ 6d6:	31 d2                	xor    %edx,%edx
+        while(*s != 0){
+ 6d8:	84 c0                	test   %al,%al
+ 6da:	0f 84 3d ff ff ff    	je     61d <printf+0x4d>
+ 6e0:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 6e3:	89 75 d4             	mov    %esi,-0x2c(%ebp)
+ 6e6:	89 de                	mov    %ebx,%esi
+ 6e8:	89 d3                	mov    %edx,%ebx
+ 6ea:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  write(fd, &c, 1);
+ 6f0:	83 ec 04             	sub    $0x4,%esp
+ 6f3:	88 45 e7             	mov    %al,-0x19(%ebp)
+          s++;
+ 6f6:	83 c6 01             	add    $0x1,%esi
+  write(fd, &c, 1);
+ 6f9:	6a 01                	push   $0x1
+ 6fb:	53                   	push   %ebx
+ 6fc:	57                   	push   %edi
+ 6fd:	e8 31 fd ff ff       	call   433 <write>
+        while(*s != 0){
+ 702:	0f b6 06             	movzbl (%esi),%eax
+ 705:	83 c4 10             	add    $0x10,%esp
+ 708:	84 c0                	test   %al,%al
+ 70a:	75 e4                	jne    6f0 <printf+0x120>
+      state = 0;
+ 70c:	8b 75 d4             	mov    -0x2c(%ebp),%esi
+ 70f:	31 d2                	xor    %edx,%edx
+ 711:	e9 07 ff ff ff       	jmp    61d <printf+0x4d>
+ 716:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 71d:	8d 76 00             	lea    0x0(%esi),%esi
+        printint(fd, *ap, 10, 1);
+ 720:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+ 723:	83 ec 0c             	sub    $0xc,%esp
+ 726:	b9 0a 00 00 00       	mov    $0xa,%ecx
+ 72b:	8b 13                	mov    (%ebx),%edx
+ 72d:	6a 01                	push   $0x1
+ 72f:	e9 6b ff ff ff       	jmp    69f <printf+0xcf>
+ 734:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+        putc(fd, *ap);
+ 738:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  write(fd, &c, 1);
+ 73b:	83 ec 04             	sub    $0x4,%esp
+ 73e:	8d 55 e7             	lea    -0x19(%ebp),%edx
+        putc(fd, *ap);
+ 741:	8b 03                	mov    (%ebx),%eax
+        ap++;
+ 743:	83 c3 04             	add    $0x4,%ebx
+        putc(fd, *ap);
+ 746:	88 45 e7             	mov    %al,-0x19(%ebp)
+  write(fd, &c, 1);
+ 749:	6a 01                	push   $0x1
+ 74b:	52                   	push   %edx
+ 74c:	57                   	push   %edi
+ 74d:	e8 e1 fc ff ff       	call   433 <write>
+        ap++;
+ 752:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+ 755:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 758:	31 d2                	xor    %edx,%edx
+ 75a:	e9 be fe ff ff       	jmp    61d <printf+0x4d>
+ 75f:	90                   	nop
+  write(fd, &c, 1);
+ 760:	83 ec 04             	sub    $0x4,%esp
+ 763:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 766:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 769:	6a 01                	push   $0x1
+ 76b:	e9 11 ff ff ff       	jmp    681 <printf+0xb1>
+ 770:	b8 28 00 00 00       	mov    $0x28,%eax
+          s = "(null)";
+ 775:	bb 95 09 00 00       	mov    $0x995,%ebx
+ 77a:	e9 61 ff ff ff       	jmp    6e0 <printf+0x110>
+ 77f:	90                   	nop
+
+00000780 <free>:
+static Header base;
+static Header *freep;
+
+void
+free(void *ap)
+{
+ 780:	55                   	push   %ebp
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 781:	a1 c8 0c 00 00       	mov    0xcc8,%eax
+{
+ 786:	89 e5                	mov    %esp,%ebp
+ 788:	57                   	push   %edi
+ 789:	56                   	push   %esi
+ 78a:	53                   	push   %ebx
+ 78b:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  bp = (Header*)ap - 1;
+ 78e:	8d 4b f8             	lea    -0x8(%ebx),%ecx
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 791:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 798:	89 c2                	mov    %eax,%edx
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 79a:	8b 00                	mov    (%eax),%eax
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 79c:	39 ca                	cmp    %ecx,%edx
+ 79e:	73 30                	jae    7d0 <free+0x50>
+ 7a0:	39 c1                	cmp    %eax,%ecx
+ 7a2:	72 04                	jb     7a8 <free+0x28>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 7a4:	39 c2                	cmp    %eax,%edx
+ 7a6:	72 f0                	jb     798 <free+0x18>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+ 7a8:	8b 73 fc             	mov    -0x4(%ebx),%esi
+ 7ab:	8d 3c f1             	lea    (%ecx,%esi,8),%edi
+ 7ae:	39 f8                	cmp    %edi,%eax
+ 7b0:	74 2e                	je     7e0 <free+0x60>
+    bp->s.size += p->s.ptr->s.size;
+    bp->s.ptr = p->s.ptr->s.ptr;
+ 7b2:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  } else
+    bp->s.ptr = p->s.ptr;
+  if(p + p->s.size == bp){
+ 7b5:	8b 42 04             	mov    0x4(%edx),%eax
+ 7b8:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+ 7bb:	39 f1                	cmp    %esi,%ecx
+ 7bd:	74 38                	je     7f7 <free+0x77>
+    p->s.size += bp->s.size;
+    p->s.ptr = bp->s.ptr;
+ 7bf:	89 0a                	mov    %ecx,(%edx)
+  } else
+    p->s.ptr = bp;
+  freep = p;
+}
+ 7c1:	5b                   	pop    %ebx
+  freep = p;
+ 7c2:	89 15 c8 0c 00 00    	mov    %edx,0xcc8
+}
+ 7c8:	5e                   	pop    %esi
+ 7c9:	5f                   	pop    %edi
+ 7ca:	5d                   	pop    %ebp
+ 7cb:	c3                   	ret
+ 7cc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 7d0:	39 c1                	cmp    %eax,%ecx
+ 7d2:	72 d0                	jb     7a4 <free+0x24>
+ 7d4:	eb c2                	jmp    798 <free+0x18>
+ 7d6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 7dd:	8d 76 00             	lea    0x0(%esi),%esi
+    bp->s.size += p->s.ptr->s.size;
+ 7e0:	03 70 04             	add    0x4(%eax),%esi
+ 7e3:	89 73 fc             	mov    %esi,-0x4(%ebx)
+    bp->s.ptr = p->s.ptr->s.ptr;
+ 7e6:	8b 02                	mov    (%edx),%eax
+ 7e8:	8b 00                	mov    (%eax),%eax
+ 7ea:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  if(p + p->s.size == bp){
+ 7ed:	8b 42 04             	mov    0x4(%edx),%eax
+ 7f0:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+ 7f3:	39 f1                	cmp    %esi,%ecx
+ 7f5:	75 c8                	jne    7bf <free+0x3f>
+    p->s.size += bp->s.size;
+ 7f7:	03 43 fc             	add    -0x4(%ebx),%eax
+  freep = p;
+ 7fa:	89 15 c8 0c 00 00    	mov    %edx,0xcc8
+    p->s.size += bp->s.size;
+ 800:	89 42 04             	mov    %eax,0x4(%edx)
+    p->s.ptr = bp->s.ptr;
+ 803:	8b 4b f8             	mov    -0x8(%ebx),%ecx
+ 806:	89 0a                	mov    %ecx,(%edx)
+}
+ 808:	5b                   	pop    %ebx
+ 809:	5e                   	pop    %esi
+ 80a:	5f                   	pop    %edi
+ 80b:	5d                   	pop    %ebp
+ 80c:	c3                   	ret
+ 80d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000810 <malloc>:
+  return freep;
+}
+
+void*
+malloc(uint nbytes)
+{
+ 810:	55                   	push   %ebp
+ 811:	89 e5                	mov    %esp,%ebp
+ 813:	57                   	push   %edi
+ 814:	56                   	push   %esi
+ 815:	53                   	push   %ebx
+ 816:	83 ec 0c             	sub    $0xc,%esp
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ 819:	8b 45 08             	mov    0x8(%ebp),%eax
+  if((prevp = freep) == 0){
+ 81c:	8b 15 c8 0c 00 00    	mov    0xcc8,%edx
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ 822:	8d 78 07             	lea    0x7(%eax),%edi
+ 825:	c1 ef 03             	shr    $0x3,%edi
+ 828:	83 c7 01             	add    $0x1,%edi
+  if((prevp = freep) == 0){
+ 82b:	85 d2                	test   %edx,%edx
+ 82d:	0f 84 8d 00 00 00    	je     8c0 <malloc+0xb0>
+    base.s.ptr = freep = prevp = &base;
+    base.s.size = 0;
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ 833:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+ 835:	8b 48 04             	mov    0x4(%eax),%ecx
+ 838:	39 f9                	cmp    %edi,%ecx
+ 83a:	73 64                	jae    8a0 <malloc+0x90>
+  if(nu < 4096)
+ 83c:	bb 00 10 00 00       	mov    $0x1000,%ebx
+ 841:	39 df                	cmp    %ebx,%edi
+ 843:	0f 43 df             	cmovae %edi,%ebx
+  p = sbrk(nu * sizeof(Header));
+ 846:	8d 34 dd 00 00 00 00 	lea    0x0(,%ebx,8),%esi
+ 84d:	eb 0a                	jmp    859 <malloc+0x49>
+ 84f:	90                   	nop
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ 850:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+ 852:	8b 48 04             	mov    0x4(%eax),%ecx
+ 855:	39 f9                	cmp    %edi,%ecx
+ 857:	73 47                	jae    8a0 <malloc+0x90>
+        p->s.size = nunits;
+      }
+      freep = prevp;
+      return (void*)(p + 1);
+    }
+    if(p == freep)
+ 859:	89 c2                	mov    %eax,%edx
+ 85b:	39 05 c8 0c 00 00    	cmp    %eax,0xcc8
+ 861:	75 ed                	jne    850 <malloc+0x40>
+  p = sbrk(nu * sizeof(Header));
+ 863:	83 ec 0c             	sub    $0xc,%esp
+ 866:	56                   	push   %esi
+ 867:	e8 2f fc ff ff       	call   49b <sbrk>
+  if(p == (char*)-1)
+ 86c:	83 c4 10             	add    $0x10,%esp
+ 86f:	83 f8 ff             	cmp    $0xffffffff,%eax
+ 872:	74 1c                	je     890 <malloc+0x80>
+  hp->s.size = nu;
+ 874:	89 58 04             	mov    %ebx,0x4(%eax)
+  free((void*)(hp + 1));
+ 877:	83 ec 0c             	sub    $0xc,%esp
+ 87a:	83 c0 08             	add    $0x8,%eax
+ 87d:	50                   	push   %eax
+ 87e:	e8 fd fe ff ff       	call   780 <free>
+  return freep;
+ 883:	8b 15 c8 0c 00 00    	mov    0xcc8,%edx
+      if((p = morecore(nunits)) == 0)
+ 889:	83 c4 10             	add    $0x10,%esp
+ 88c:	85 d2                	test   %edx,%edx
+ 88e:	75 c0                	jne    850 <malloc+0x40>
+        return 0;
+  }
+}
+ 890:	8d 65 f4             	lea    -0xc(%ebp),%esp
+        return 0;
+ 893:	31 c0                	xor    %eax,%eax
+}
+ 895:	5b                   	pop    %ebx
+ 896:	5e                   	pop    %esi
+ 897:	5f                   	pop    %edi
+ 898:	5d                   	pop    %ebp
+ 899:	c3                   	ret
+ 89a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+      if(p->s.size == nunits)
+ 8a0:	39 cf                	cmp    %ecx,%edi
+ 8a2:	74 4c                	je     8f0 <malloc+0xe0>
+        p->s.size -= nunits;
+ 8a4:	29 f9                	sub    %edi,%ecx
+ 8a6:	89 48 04             	mov    %ecx,0x4(%eax)
+        p += p->s.size;
+ 8a9:	8d 04 c8             	lea    (%eax,%ecx,8),%eax
+        p->s.size = nunits;
+ 8ac:	89 78 04             	mov    %edi,0x4(%eax)
+      freep = prevp;
+ 8af:	89 15 c8 0c 00 00    	mov    %edx,0xcc8
+}
+ 8b5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+      return (void*)(p + 1);
+ 8b8:	83 c0 08             	add    $0x8,%eax
+}
+ 8bb:	5b                   	pop    %ebx
+ 8bc:	5e                   	pop    %esi
+ 8bd:	5f                   	pop    %edi
+ 8be:	5d                   	pop    %ebp
+ 8bf:	c3                   	ret
+    base.s.ptr = freep = prevp = &base;
+ 8c0:	c7 05 c8 0c 00 00 cc 	movl   $0xccc,0xcc8
+ 8c7:	0c 00 00 
+    base.s.size = 0;
+ 8ca:	b8 cc 0c 00 00       	mov    $0xccc,%eax
+    base.s.ptr = freep = prevp = &base;
+ 8cf:	c7 05 cc 0c 00 00 cc 	movl   $0xccc,0xccc
+ 8d6:	0c 00 00 
+    base.s.size = 0;
+ 8d9:	c7 05 d0 0c 00 00 00 	movl   $0x0,0xcd0
+ 8e0:	00 00 00 
+    if(p->s.size >= nunits){
+ 8e3:	e9 54 ff ff ff       	jmp    83c <malloc+0x2c>
+ 8e8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 8ef:	90                   	nop
+        prevp->s.ptr = p->s.ptr;
+ 8f0:	8b 08                	mov    (%eax),%ecx
+ 8f2:	89 0a                	mov    %ecx,(%edx)
+ 8f4:	eb b9                	jmp    8af <malloc+0x9f>
@@ -0,0 +1,67 @@
+#include "types.h"
+#include "stat.h"
+#include "user.h"
+
+// Run a command and report the simulated energy it used.
+//
+// The job's figure is the energy charged to the command and every
+// process it forked (folded into ours when we reap it); the system
+// figure is what all CPUs drew over the same interval, idle included.
+// Usage: energy command [args...]
+
+static uint
+sysenergy(void)
+{
+  struct cpuinfo ci;
+  uint mj;
+  int i;
+
+  mj = 0;
+  for(i = 0; cpuinfo(i, &ci) == 0; i++)
+    mj += ci.energy_mj;
+  return mj;
+}
+
+int
+main(int argc, char *argv[])
+{
+  struct procinfo before, after;
+  uint sys0, sys1, t0, t1, job;
+  int pid;
+
+  if(argc < 2){
+    printf(2, "usage: energy command [args...]\n");
+    exit();
+  }
+
+  if(procinfo(getpid(), &before) < 0){
+    printf(2, "energy: procinfo failed\n");
+    exit();
+  }
+  sys0 = sysenergy();
+  t0 = uptime();
+
+  pid = fork();
+  if(pid < 0){
+    printf(2, "energy: fork failed\n");
+    exit();
+  }
+  if(pid == 0){
+    exec(argv[1], argv + 1);
+    printf(2, "energy: exec %s failed\n", argv[1]);
+    exit();
+  }
+  while(wait() != pid)
+    ;
+
+  t1 = uptime();
+  sys1 = sysenergy();
+  procinfo(getpid(), &after);
+
+  job = after.child_energy_mj - before.child_energy_mj;
+  printf(2, "%s: job %d.%d%d%d J, system %d.%d%d%d J, %d ticks\n", argv[1],
+         job / 1000, job / 100 % 10, job / 10 % 10, job % 10,
+         (sys1 - sys0) / 1000, (sys1 - sys0) / 100 % 10,
+         (sys1 - sys0) / 10 % 10, (sys1 - sys0) % 10, t1 - t0);
+  exit();
+}
@@ -28,10 +28,18 @@ struct inode {
 // table mapping major device number to
 // device functions
 struct devsw {
-  int (*read)(struct inode*, char*, int);
-  int (*write)(struct inode*, char*, int);
+  int (*read)(struct inode*, char*, uint off, int);
+  int (*write)(struct inode*, char*, uint off, int);
 };
 
 extern struct devsw devsw[];
 
 #define CONSOLE 1
+#define PROCFS  2
+
+// Minor numbers of the procfs files (see procfs.c)
+#define PROCFS_SCHEDSTAT 0
+#define PROCFS_LOADHIST  1
+#define PROCFS_PROCS     2
+#define PROCFS_THERMAL   3
+#define PROCFS_SYSCTL    4
@@ -0,0 +1,43 @@
+#include "types.h"
+#include "stat.h"
+#include "user.h"
+
+// Show or select the frequency governor.
+// Usage: governor                 list each CPU's governor and level
+//        governor name [cpu]      select name on cpu, or on every CPU
+
+char *gov_str[] = { "spas", "performance", "powersave", "ondemand",
+                    "conservative" };
+char *freq_str[] = { "LOW", "MEDIUM", "HIGH" };
+
+#define NGOV (sizeof(gov_str)/sizeof(gov_str[0]))
+
+int
+main(int argc, char *argv[])
+{
+  struct cpuinfo ci;
+  int i, gov, cpu;
+
+  if(argc < 2){
+    for(i = 0; cpuinfo(i, &ci) == 0; i++)
+      printf(1, "cpu%d: %s, wants %s, runs %s\n", i, gov_str[ci.governor],
+             freq_str[ci.requested_level], freq_str[ci.frequency_level]);
+    exit();
+  }
+
+  gov = -1;
+  for(i = 0; i < NGOV; i++)
+    if(strcmp(argv[1], gov_str[i]) == 0)
+      gov = i;
+  if(gov < 0){
+    printf(2, "governor: unknown governor %s; one of:", argv[1]);
+    for(i = 0; i < NGOV; i++)
+      printf(2, " %s", gov_str[i]);
+    printf(2, "\n");
+    exit();
+  }
+  cpu = argc > 2 ? atoi(argv[2]) : -1;
+  if(setgovernor(cpu, gov) < 0)
+    printf(2, "governor: setgovernor failed\n");
+  exit();
+}
@@ -0,0 +1,216 @@
+// CPU bandwidth control for process groups.
+//
+// Every process belongs to one of NGROUP groups, its parent's unless
+// moved with setgroup().  Group 0 is never limited.  Any other group
+// may be given a quota of CPU time per period, e.g. 20 ms per 100 ms.
+// The time its processes run is counted in TSC cycles by cpufold();
+// once the quota is spent the group is throttled, and the scheduler
+// runs none of its processes until the period ends and the quota is
+// refilled.  Each slice is cut to this CPU's share of the quota
+// left, split evenly among the CPUs running the group, and when the
+// quota runs out every CPU running the group is made to preempt at
+// once; so a group overruns by little more than the 100 us minimum
+// slice per CPU it runs on.
+//
+// Periods are whole ticks, kept by CPU 0's timer interrupt.
+// The group table is protected by glock.
+
+#include "types.h"
+#include "defs.h"
+#include "param.h"
+#include "mmu.h"
+#include "proc.h"
+#include "spinlock.h"
+#include "spas.h"
+
+struct group {
+  uint quota_us;        // CPU time allowed per period; 0 means no limit
+  uint period;          // Period length in ticks
+  uint64 quota;         // quota_us in TSC cycles
+  uint64 used;          // Cycles used this period
+  uint refill;          // Tick the current period ends
+  int throttled;        // Quota spent for this period?
+  uint throttled_at;    // Tick it was throttled
+  uint nthrottled;      // Periods in which the quota ran out
+  uint throttled_ticks; // Ticks spent throttled, not counting the current stretch
+};
+
+static struct spinlock glock;
+static struct group groups[NGROUP];
+
+void
+groupinit(void)
+{
+  initlock(&glock, "group");
+}
+
+// Charge cycles of CPU time to group g.  If that spends its quota,
+// make every CPU running one of its processes preempt it now.
+// Caller must have interrupts disabled.
+void
+groupcharge(int g, uint64 cycles)
+{
+  struct group *gp;
+  struct cpu *c;
+  struct proc *p;
+  int throttle;
+
+  gp = &groups[g];
+  if(gp->quota_us == 0)
+    return;
+  acquire(&glock);
+  gp->used += cycles;
+  throttle = gp->used >= gp->quota && !gp->throttled;
+  if(throttle){
+    gp->throttled = 1;
+    gp->throttled_at = ticks;
+    gp->nthrottled++;
+  }
+  release(&glock);
+  if(!throttle)
+    return;
+  for(c = cpus; c < &cpus[ncpu]; c++){
+    p = c->proc;
+    if(p == 0 || p->group != g)
+      continue;
+    c->preempt = 1;
+    if(c != mycpu())
+      lapickick(c->apicid);
+  }
+}
+
+int
+groupthrottled(int g)
+{
+  return groups[g].throttled;
+}
+
+// Shorten a time slice of us microseconds, about to start on this
+// CPU, to its share of what is left of g's quota: an even split
+// among this CPU and the others running g.  No less than 100 us.
+// Caller must have interrupts disabled.
+uint
+groupslice(int g, uint us)
+{
+  struct group *gp;
+  struct cpu *c;
+  struct proc *p;
+  uint64 left;
+  uint lus, share;
+
+  gp = &groups[g];
+  if(gp->quota_us == 0)
+    return us;
+  share = 1;
+  for(c = cpus; c < &cpus[ncpu]; c++){
+    p = c->proc;
+    if(c != mycpu() && p != 0 && p->group == g)
+      share++;
+  }
+  acquire(&glock);
+  left = gp->used < gp->quota ? gp->quota - gp->used : 0;
+  release(&glock);
+  lus = div64(left, share * (tsc_khz / 1000), 0);
+  if(lus < 100)
+    lus = 100;
+  return lus < us ? lus : us;
+}
+
+// Start a new period for every group whose period ends this tick,
+// and let the scheduler run any that were throttled.  Called by the
+// timer interrupt for every tick, with tickslock held.
+void
+grouptick(void)
+{
+  struct group *gp;
+  int g, unthrottled[NGROUP];
+
+  acquire(&glock);
+  for(g = 0; g < NGROUP; g++){
+    gp = &groups[g];
+    unthrottled[g] = 0;
+    if(gp->quota_us == 0 || (int)(ticks - gp->refill) < 0)
+      continue;
+    if(gp->throttled){
+      gp->throttled_ticks += ticks - gp->throttled_at;
+      gp->throttled = 0;
+      unthrottled[g] = 1;
+    }
+    gp->used = 0;
+    gp->refill = ticks + gp->period;
+  }
+  release(&glock);
+  for(g = 0; g < NGROUP; g++)
+    if(unthrottled[g])
+      groupkick(g);
+}
+
+// Ticks until the next throttled group is refilled, at most n, for
+// tickless idle: time must not stop while work waits on a refill.
+uint
+groupnohz(uint n)
+{
+  struct group *gp;
+  int g;
+
+  for(g = 0; g < NGROUP; g++){
+    gp = &groups[g];
+    if(!gp->throttled)
+      continue;
+    if((int)(gp->refill - ticks) <= 1)
+      return 1;
+    if(gp->refill - ticks < n)
+      n = gp->refill - ticks;
+  }
+  return n;
+}
+
+// Give group g quota_us of CPU time every period_us, rounded to
+// whole ticks; a quota of 0 lifts the limit.
+int
+setquota(int g, uint quota_us, uint period_us)
+{
+  struct group *gp;
+  uint period;
+
+  if(g <= 0 || g >= NGROUP)
+    return -1;
+  period = period_us / (TICK_MS * 1000);
+  if(quota_us != 0 && (period == 0 || quota_us > period_us * NCPU))
+    return -1;
+  gp = &groups[g];
+  acquire(&glock);
+  if(gp->throttled)
+    gp->throttled_ticks += ticks - gp->throttled_at;
+  gp->quota_us = quota_us;
+  gp->period = period;
+  gp->quota = (uint64)quota_us * (tsc_khz / 1000);
+  gp->used = 0;
+  gp->refill = ticks + period;
+  gp->throttled = 0;
+  release(&glock);
+  groupkick(g);
+  return 0;
+}
+
+// Fill in *gi for group g, except for nproc.
+int
+getgroupinfo(int g, struct groupinfo *gi)
+{
+  struct group *gp;
+
+  if(g < 0 || g >= NGROUP)
+    return -1;
+  gp = &groups[g];
+  acquire(&glock);
+  gi->quota_us = gp->quota_us;
+  gi->period_us = gp->period * TICK_MS * 1000;
+  gi->used_us = gp->quota_us ? div64(gp->used, tsc_khz / 1000, 0) : 0;
+  gi->throttled = gp->throttled;
+  gi->nthrottled = gp->nthrottled;
+  gi->throttled_ms = (gp->throttled_ticks +
+                      (gp->throttled ? ticks - gp->throttled_at : 0)) *
+                     TICK_MS;
+  release(&glock);
+  return 0;
+}
@@ -0,0 +1,1309 @@
+
+_init:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+  }
+}
+
+int
+main(void)
+{
+   0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+   4:	83 e4 f0             	and    $0xfffffff0,%esp
+   7:	ff 71 fc             	push   -0x4(%ecx)
+   a:	55                   	push   %ebp
+   b:	89 e5                	mov    %esp,%ebp
+   d:	57                   	push   %edi
+   e:	56                   	push   %esi
+   f:	53                   	push   %ebx
+  10:	51                   	push   %ecx
+  11:	83 ec 30             	sub    $0x30,%esp
+  int pid, wpid;
+
+  if(open("console", O_RDWR) < 0){
+  14:	6a 02                	push   $0x2
+  16:	68 68 08 00 00       	push   $0x868
+  1b:	e8 a3 03 00 00       	call   3c3 <open>
+  20:	83 c4 10             	add    $0x10,%esp
+  23:	85 c0                	test   %eax,%eax
+  25:	0f 88 ee 00 00 00    	js     119 <main+0x119>
+    mknod("console", 1, 1);
+    open("console", O_RDWR);
+  }
+  dup(0);  // stdout
+  2b:	83 ec 0c             	sub    $0xc,%esp
+  2e:	6a 00                	push   $0x0
+  30:	e8 c6 03 00 00       	call   3fb <dup>
+  dup(0);  // stderr
+  35:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+  3c:	e8 ba 03 00 00       	call   3fb <dup>
+  if(mkdir("dev") == 0)
+  41:	c7 04 24 70 08 00 00 	movl   $0x870,(%esp)
+  48:	e8 9e 03 00 00       	call   3eb <mkdir>
+  4d:	83 c4 10             	add    $0x10,%esp
+  50:	89 c3                	mov    %eax,%ebx
+  52:	85 c0                	test   %eax,%eax
+  54:	0f 84 7e 00 00 00    	je     d8 <main+0xd8>
+  5a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    mkprocfs();
+
+  for(;;){
+    printf(1, "init: starting sh\n");
+  60:	83 ec 08             	sub    $0x8,%esp
+  63:	68 79 08 00 00       	push   $0x879
+  68:	6a 01                	push   $0x1
+  6a:	e8 d1 04 00 00       	call   540 <printf>
+    pid = fork();
+  6f:	e8 07 03 00 00       	call   37b <fork>
+    if(pid < 0){
+  74:	83 c4 10             	add    $0x10,%esp
+    pid = fork();
+  77:	89 c3                	mov    %eax,%ebx
+    if(pid < 0){
+  79:	85 c0                	test   %eax,%eax
+  7b:	78 24                	js     a1 <main+0xa1>
+      printf(1, "init: fork failed\n");
+      exit();
+    }
+    if(pid == 0){
+  7d:	74 35                	je     b4 <main+0xb4>
+  7f:	90                   	nop
+      exec("sh", argv);
+      printf(1, "init: exec sh failed\n");
+      exit();
+    }
+    while((wpid=wait()) >= 0 && wpid != pid)
+  80:	e8 06 03 00 00       	call   38b <wait>
+  85:	39 c3                	cmp    %eax,%ebx
+  87:	74 d7                	je     60 <main+0x60>
+  89:	85 c0                	test   %eax,%eax
+  8b:	78 d3                	js     60 <main+0x60>
+      printf(1, "zombie!\n");
+  8d:	83 ec 08             	sub    $0x8,%esp
+  90:	68 b8 08 00 00       	push   $0x8b8
+  95:	6a 01                	push   $0x1
+  97:	e8 a4 04 00 00       	call   540 <printf>
+  9c:	83 c4 10             	add    $0x10,%esp
+  9f:	eb df                	jmp    80 <main+0x80>
+      printf(1, "init: fork failed\n");
+  a1:	53                   	push   %ebx
+  a2:	53                   	push   %ebx
+  a3:	68 8c 08 00 00       	push   $0x88c
+  a8:	6a 01                	push   $0x1
+  aa:	e8 91 04 00 00       	call   540 <printf>
+      exit();
+  af:	e8 cf 02 00 00       	call   383 <exit>
+      exec("sh", argv);
+  b4:	50                   	push   %eax
+  b5:	50                   	push   %eax
+  b6:	68 04 0c 00 00       	push   $0xc04
+  bb:	68 9f 08 00 00       	push   $0x89f
+  c0:	e8 f6 02 00 00       	call   3bb <exec>
+      printf(1, "init: exec sh failed\n");
+  c5:	5a                   	pop    %edx
+  c6:	59                   	pop    %ecx
+  c7:	68 a2 08 00 00       	push   $0x8a2
+  cc:	6a 01                	push   $0x1
+  ce:	e8 6d 04 00 00       	call   540 <printf>
+      exit();
+  d3:	e8 ab 02 00 00       	call   383 <exit>
+  d8:	8d 75 c8             	lea    -0x38(%ebp),%esi
+  db:	8d 7d cc             	lea    -0x34(%ebp),%edi
+  de:	66 90                	xchg   %ax,%ax
+    strcpy(path, "dev/");
+  e0:	83 ec 08             	sub    $0x8,%esp
+  e3:	68 74 08 00 00       	push   $0x874
+  e8:	56                   	push   %esi
+  e9:	e8 52 00 00 00       	call   140 <strcpy>
+    strcpy(path + 4, procfiles[i]);
+  ee:	58                   	pop    %eax
+  ef:	5a                   	pop    %edx
+  f0:	ff 34 9d f0 0b 00 00 	push   0xbf0(,%ebx,4)
+  f7:	57                   	push   %edi
+  f8:	e8 43 00 00 00       	call   140 <strcpy>
+    mknod(path, 2, i);
+  fd:	83 c4 0c             	add    $0xc,%esp
+ 100:	53                   	push   %ebx
+  for(i = 0; i < sizeof(procfiles)/sizeof(procfiles[0]); i++){
+ 101:	83 c3 01             	add    $0x1,%ebx
+    mknod(path, 2, i);
+ 104:	6a 02                	push   $0x2
+ 106:	56                   	push   %esi
+ 107:	e8 bf 02 00 00       	call   3cb <mknod>
+  for(i = 0; i < sizeof(procfiles)/sizeof(procfiles[0]); i++){
+ 10c:	83 c4 10             	add    $0x10,%esp
+ 10f:	83 fb 05             	cmp    $0x5,%ebx
+ 112:	75 cc                	jne    e0 <main+0xe0>
+ 114:	e9 47 ff ff ff       	jmp    60 <main+0x60>
+    mknod("console", 1, 1);
+ 119:	51                   	push   %ecx
+ 11a:	6a 01                	push   $0x1
+ 11c:	6a 01                	push   $0x1
+ 11e:	68 68 08 00 00       	push   $0x868
+ 123:	e8 a3 02 00 00       	call   3cb <mknod>
+    open("console", O_RDWR);
+ 128:	5b                   	pop    %ebx
+ 129:	5e                   	pop    %esi
+ 12a:	6a 02                	push   $0x2
+ 12c:	68 68 08 00 00       	push   $0x868
+ 131:	e8 8d 02 00 00       	call   3c3 <open>
+ 136:	83 c4 10             	add    $0x10,%esp
+ 139:	e9 ed fe ff ff       	jmp    2b <main+0x2b>
+ 13e:	66 90                	xchg   %ax,%ax
+
+00000140 <strcpy>:
+#include "user.h"
+#include "x86.h"
+
+char*
+strcpy(char *s, const char *t)
+{
+ 140:	55                   	push   %ebp
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+ 141:	31 c0                	xor    %eax,%eax
+{
+ 143:	89 e5                	mov    %esp,%ebp
+ 145:	53                   	push   %ebx
+ 146:	8b 4d 08             	mov    0x8(%ebp),%ecx
+ 149:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+ 14c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  while((*s++ = *t++) != 0)
+ 150:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+ 154:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+ 157:	83 c0 01             	add    $0x1,%eax
+ 15a:	84 d2                	test   %dl,%dl
+ 15c:	75 f2                	jne    150 <strcpy+0x10>
+    ;
+  return os;
+}
+ 15e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 161:	89 c8                	mov    %ecx,%eax
+ 163:	c9                   	leave
+ 164:	c3                   	ret
+ 165:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 16c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000170 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+ 170:	55                   	push   %ebp
+ 171:	89 e5                	mov    %esp,%ebp
+ 173:	53                   	push   %ebx
+ 174:	8b 55 08             	mov    0x8(%ebp),%edx
+ 177:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  while(*p && *p == *q)
+ 17a:	0f b6 02             	movzbl (%edx),%eax
+ 17d:	84 c0                	test   %al,%al
+ 17f:	75 17                	jne    198 <strcmp+0x28>
+ 181:	eb 3a                	jmp    1bd <strcmp+0x4d>
+ 183:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 187:	90                   	nop
+ 188:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+    p++, q++;
+ 18c:	83 c2 01             	add    $0x1,%edx
+ 18f:	8d 59 01             	lea    0x1(%ecx),%ebx
+  while(*p && *p == *q)
+ 192:	84 c0                	test   %al,%al
+ 194:	74 1a                	je     1b0 <strcmp+0x40>
+    p++, q++;
+ 196:	89 d9                	mov    %ebx,%ecx
+  while(*p && *p == *q)
+ 198:	0f b6 19             	movzbl (%ecx),%ebx
+ 19b:	38 c3                	cmp    %al,%bl
+ 19d:	74 e9                	je     188 <strcmp+0x18>
+  return (uchar)*p - (uchar)*q;
+ 19f:	29 d8                	sub    %ebx,%eax
+}
+ 1a1:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 1a4:	c9                   	leave
+ 1a5:	c3                   	ret
+ 1a6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 1ad:	8d 76 00             	lea    0x0(%esi),%esi
+  return (uchar)*p - (uchar)*q;
+ 1b0:	0f b6 59 01          	movzbl 0x1(%ecx),%ebx
+ 1b4:	31 c0                	xor    %eax,%eax
+ 1b6:	29 d8                	sub    %ebx,%eax
+}
+ 1b8:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 1bb:	c9                   	leave
+ 1bc:	c3                   	ret
+  return (uchar)*p - (uchar)*q;
+ 1bd:	0f b6 19             	movzbl (%ecx),%ebx
+ 1c0:	31 c0                	xor    %eax,%eax
+ 1c2:	eb db                	jmp    19f <strcmp+0x2f>
+ 1c4:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 1cb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 1cf:	90                   	nop
+
+000001d0 <strlen>:
+
+uint
+strlen(const char *s)
+{
+ 1d0:	55                   	push   %ebp
+ 1d1:	89 e5                	mov    %esp,%ebp
+ 1d3:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for(n = 0; s[n]; n++)
+ 1d6:	80 3a 00             	cmpb   $0x0,(%edx)
+ 1d9:	74 15                	je     1f0 <strlen+0x20>
+ 1db:	31 c0                	xor    %eax,%eax
+ 1dd:	8d 76 00             	lea    0x0(%esi),%esi
+ 1e0:	83 c0 01             	add    $0x1,%eax
+ 1e3:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+ 1e7:	89 c1                	mov    %eax,%ecx
+ 1e9:	75 f5                	jne    1e0 <strlen+0x10>
+    ;
+  return n;
+}
+ 1eb:	89 c8                	mov    %ecx,%eax
+ 1ed:	5d                   	pop    %ebp
+ 1ee:	c3                   	ret
+ 1ef:	90                   	nop
+  for(n = 0; s[n]; n++)
+ 1f0:	31 c9                	xor    %ecx,%ecx
+}
+ 1f2:	5d                   	pop    %ebp
+ 1f3:	89 c8                	mov    %ecx,%eax
+ 1f5:	c3                   	ret
+ 1f6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 1fd:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000200 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+ 200:	55                   	push   %ebp
+ 201:	89 e5                	mov    %esp,%ebp
+ 203:	57                   	push   %edi
+ 204:	8b 55 08             	mov    0x8(%ebp),%edx
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosb" :
+ 207:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 20a:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 20d:	89 d7                	mov    %edx,%edi
+ 20f:	fc                   	cld
+ 210:	f3 aa                	rep stos %al,%es:(%edi)
+  stosb(dst, c, n);
+  return dst;
+}
+ 212:	8b 7d fc             	mov    -0x4(%ebp),%edi
+ 215:	89 d0                	mov    %edx,%eax
+ 217:	c9                   	leave
+ 218:	c3                   	ret
+ 219:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000220 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+ 220:	55                   	push   %ebp
+ 221:	89 e5                	mov    %esp,%ebp
+ 223:	8b 45 08             	mov    0x8(%ebp),%eax
+ 226:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+ 22a:	0f b6 10             	movzbl (%eax),%edx
+ 22d:	84 d2                	test   %dl,%dl
+ 22f:	75 12                	jne    243 <strchr+0x23>
+ 231:	eb 1d                	jmp    250 <strchr+0x30>
+ 233:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 237:	90                   	nop
+ 238:	0f b6 50 01          	movzbl 0x1(%eax),%edx
+ 23c:	83 c0 01             	add    $0x1,%eax
+ 23f:	84 d2                	test   %dl,%dl
+ 241:	74 0d                	je     250 <strchr+0x30>
+    if(*s == c)
+ 243:	38 d1                	cmp    %dl,%cl
+ 245:	75 f1                	jne    238 <strchr+0x18>
+      return (char*)s;
+  return 0;
+}
+ 247:	5d                   	pop    %ebp
+ 248:	c3                   	ret
+ 249:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  return 0;
+ 250:	31 c0                	xor    %eax,%eax
+}
+ 252:	5d                   	pop    %ebp
+ 253:	c3                   	ret
+ 254:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 25b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 25f:	90                   	nop
+
+00000260 <gets>:
+
+char*
+gets(char *buf, int max)
+{
+ 260:	55                   	push   %ebp
+ 261:	89 e5                	mov    %esp,%ebp
+ 263:	57                   	push   %edi
+ 264:	56                   	push   %esi
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+    cc = read(0, &c, 1);
+ 265:	8d 75 e7             	lea    -0x19(%ebp),%esi
+{
+ 268:	53                   	push   %ebx
+  for(i=0; i+1 < max; ){
+ 269:	31 db                	xor    %ebx,%ebx
+{
+ 26b:	83 ec 1c             	sub    $0x1c,%esp
+  for(i=0; i+1 < max; ){
+ 26e:	eb 27                	jmp    297 <gets+0x37>
+    cc = read(0, &c, 1);
+ 270:	83 ec 04             	sub    $0x4,%esp
+ 273:	6a 01                	push   $0x1
+ 275:	56                   	push   %esi
+ 276:	6a 00                	push   $0x0
+ 278:	e8 1e 01 00 00       	call   39b <read>
+    if(cc < 1)
+ 27d:	83 c4 10             	add    $0x10,%esp
+ 280:	85 c0                	test   %eax,%eax
+ 282:	7e 1d                	jle    2a1 <gets+0x41>
+      break;
+    buf[i++] = c;
+ 284:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+ 288:	8b 55 08             	mov    0x8(%ebp),%edx
+ 28b:	88 44 1a ff          	mov    %al,-0x1(%edx,%ebx,1)
+    if(c == '\n' || c == '\r')
+ 28f:	3c 0a                	cmp    $0xa,%al
+ 291:	74 10                	je     2a3 <gets+0x43>
+ 293:	3c 0d                	cmp    $0xd,%al
+ 295:	74 0c                	je     2a3 <gets+0x43>
+  for(i=0; i+1 < max; ){
+ 297:	89 df                	mov    %ebx,%edi
+ 299:	83 c3 01             	add    $0x1,%ebx
+ 29c:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+ 29f:	7c cf                	jl     270 <gets+0x10>
+ 2a1:	89 fb                	mov    %edi,%ebx
+      break;
+  }
+  buf[i] = '\0';
+ 2a3:	8b 45 08             	mov    0x8(%ebp),%eax
+ 2a6:	c6 04 18 00          	movb   $0x0,(%eax,%ebx,1)
+  return buf;
+}
+ 2aa:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 2ad:	5b                   	pop    %ebx
+ 2ae:	5e                   	pop    %esi
+ 2af:	5f                   	pop    %edi
+ 2b0:	5d                   	pop    %ebp
+ 2b1:	c3                   	ret
+ 2b2:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 2b9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+000002c0 <stat>:
+
+int
+stat(const char *n, struct stat *st)
+{
+ 2c0:	55                   	push   %ebp
+ 2c1:	89 e5                	mov    %esp,%ebp
+ 2c3:	56                   	push   %esi
+ 2c4:	53                   	push   %ebx
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+ 2c5:	83 ec 08             	sub    $0x8,%esp
+ 2c8:	6a 00                	push   $0x0
+ 2ca:	ff 75 08             	push   0x8(%ebp)
+ 2cd:	e8 f1 00 00 00       	call   3c3 <open>
+  if(fd < 0)
+ 2d2:	83 c4 10             	add    $0x10,%esp
+ 2d5:	85 c0                	test   %eax,%eax
+ 2d7:	78 27                	js     300 <stat+0x40>
+    return -1;
+  r = fstat(fd, st);
+ 2d9:	83 ec 08             	sub    $0x8,%esp
+ 2dc:	ff 75 0c             	push   0xc(%ebp)
+ 2df:	89 c3                	mov    %eax,%ebx
+ 2e1:	50                   	push   %eax
+ 2e2:	e8 f4 00 00 00       	call   3db <fstat>
+  close(fd);
+ 2e7:	89 1c 24             	mov    %ebx,(%esp)
+  r = fstat(fd, st);
+ 2ea:	89 c6                	mov    %eax,%esi
+  close(fd);
+ 2ec:	e8 ba 00 00 00       	call   3ab <close>
+  return r;
+ 2f1:	83 c4 10             	add    $0x10,%esp
+}
+ 2f4:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 2f7:	89 f0                	mov    %esi,%eax
+ 2f9:	5b                   	pop    %ebx
+ 2fa:	5e                   	pop    %esi
+ 2fb:	5d                   	pop    %ebp
+ 2fc:	c3                   	ret
+ 2fd:	8d 76 00             	lea    0x0(%esi),%esi
+    return -1;
+ 300:	be ff ff ff ff       	mov    $0xffffffff,%esi
+ 305:	eb ed                	jmp    2f4 <stat+0x34>
+ 307:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 30e:	66 90                	xchg   %ax,%ax
+
+00000310 <atoi>:
+
+int
+atoi(const char *s)
+{
+ 310:	55                   	push   %ebp
+ 311:	89 e5                	mov    %esp,%ebp
+ 313:	53                   	push   %ebx
+ 314:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  n = 0;
+  while('0' <= *s && *s <= '9')
+ 317:	0f be 02             	movsbl (%edx),%eax
+ 31a:	8d 48 d0             	lea    -0x30(%eax),%ecx
+ 31d:	80 f9 09             	cmp    $0x9,%cl
+  n = 0;
+ 320:	b9 00 00 00 00       	mov    $0x0,%ecx
+  while('0' <= *s && *s <= '9')
+ 325:	77 1e                	ja     345 <atoi+0x35>
+ 327:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 32e:	66 90                	xchg   %ax,%ax
+    n = n*10 + *s++ - '0';
+ 330:	83 c2 01             	add    $0x1,%edx
+ 333:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+ 336:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+  while('0' <= *s && *s <= '9')
+ 33a:	0f be 02             	movsbl (%edx),%eax
+ 33d:	8d 58 d0             	lea    -0x30(%eax),%ebx
+ 340:	80 fb 09             	cmp    $0x9,%bl
+ 343:	76 eb                	jbe    330 <atoi+0x20>
+  return n;
+}
+ 345:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 348:	89 c8                	mov    %ecx,%eax
+ 34a:	c9                   	leave
+ 34b:	c3                   	ret
+ 34c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000350 <memmove>:
+
+void*
+memmove(void *vdst, const void *vsrc, int n)
+{
+ 350:	55                   	push   %ebp
+ 351:	89 e5                	mov    %esp,%ebp
+ 353:	57                   	push   %edi
+ 354:	56                   	push   %esi
+ 355:	8b 45 10             	mov    0x10(%ebp),%eax
+ 358:	8b 55 08             	mov    0x8(%ebp),%edx
+ 35b:	8b 75 0c             	mov    0xc(%ebp),%esi
+  char *dst;
+  const char *src;
+
+  dst = vdst;
+  src = vsrc;
+  while(n-- > 0)
+ 35e:	85 c0                	test   %eax,%eax
+ 360:	7e 13                	jle    375 <memmove+0x25>
+ 362:	01 d0                	add    %edx,%eax
+  dst = vdst;
+ 364:	89 d7                	mov    %edx,%edi
+ 366:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 36d:	8d 76 00             	lea    0x0(%esi),%esi
+    *dst++ = *src++;
+ 370:	a4                   	movsb  %ds:(%esi),%es:(%edi)
+  while(n-- > 0)
+ 371:	39 f8                	cmp    %edi,%eax
+ 373:	75 fb                	jne    370 <memmove+0x20>
+  return vdst;
+}
+ 375:	5e                   	pop    %esi
+ 376:	89 d0                	mov    %edx,%eax
+ 378:	5f                   	pop    %edi
+ 379:	5d                   	pop    %ebp
+ 37a:	c3                   	ret
+
+0000037b <fork>:
+  name: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+SYSCALL(fork)
+ 37b:	b8 01 00 00 00       	mov    $0x1,%eax
+ 380:	cd 40                	int    $0x40
+ 382:	c3                   	ret
+
+00000383 <exit>:
+SYSCALL(exit)
+ 383:	b8 02 00 00 00       	mov    $0x2,%eax
+ 388:	cd 40                	int    $0x40
+ 38a:	c3                   	ret
+
+0000038b <wait>:
+SYSCALL(wait)
+ 38b:	b8 03 00 00 00       	mov    $0x3,%eax
+ 390:	cd 40                	int    $0x40
+ 392:	c3                   	ret
+
+00000393 <pipe>:
+SYSCALL(pipe)
+ 393:	b8 04 00 00 00       	mov    $0x4,%eax
+ 398:	cd 40                	int    $0x40
+ 39a:	c3                   	ret
+
+0000039b <read>:
+SYSCALL(read)
+ 39b:	b8 05 00 00 00       	mov    $0x5,%eax
+ 3a0:	cd 40                	int    $0x40
+ 3a2:	c3                   	ret
+
+000003a3 <write>:
+SYSCALL(write)
+ 3a3:	b8 10 00 00 00       	mov    $0x10,%eax
+ 3a8:	cd 40                	int    $0x40
+ 3aa:	c3                   	ret
+
+000003ab <close>:
+SYSCALL(close)
+ 3ab:	b8 15 00 00 00       	mov    $0x15,%eax
+ 3b0:	cd 40                	int    $0x40
+ 3b2:	c3                   	ret
+
+000003b3 <kill>:
+SYSCALL(kill)
+ 3b3:	b8 06 00 00 00       	mov    $0x6,%eax
+ 3b8:	cd 40                	int    $0x40
+ 3ba:	c3                   	ret
+
+000003bb <exec>:
+SYSCALL(exec)
+ 3bb:	b8 07 00 00 00       	mov    $0x7,%eax
+ 3c0:	cd 40                	int    $0x40
+ 3c2:	c3                   	ret
+
+000003c3 <open>:
+SYSCALL(open)
+ 3c3:	b8 0f 00 00 00       	mov    $0xf,%eax
+ 3c8:	cd 40                	int    $0x40
+ 3ca:	c3                   	ret
+
+000003cb <mknod>:
+SYSCALL(mknod)
+ 3cb:	b8 11 00 00 00       	mov    $0x11,%eax
+ 3d0:	cd 40                	int    $0x40
+ 3d2:	c3                   	ret
+
+000003d3 <unlink>:
+SYSCALL(unlink)
+ 3d3:	b8 12 00 00 00       	mov    $0x12,%eax
+ 3d8:	cd 40                	int    $0x40
+ 3da:	c3                   	ret
+
+000003db <fstat>:
+SYSCALL(fstat)
+ 3db:	b8 08 00 00 00       	mov    $0x8,%eax
+ 3e0:	cd 40                	int    $0x40
+ 3e2:	c3                   	ret
+
+000003e3 <link>:
+SYSCALL(link)
+ 3e3:	b8 13 00 00 00       	mov    $0x13,%eax
+ 3e8:	cd 40                	int    $0x40
+ 3ea:	c3                   	ret
+
+000003eb <mkdir>:
+SYSCALL(mkdir)
+ 3eb:	b8 14 00 00 00       	mov    $0x14,%eax
+ 3f0:	cd 40                	int    $0x40
+ 3f2:	c3                   	ret
+
+000003f3 <chdir>:
+SYSCALL(chdir)
+ 3f3:	b8 09 00 00 00       	mov    $0x9,%eax
+ 3f8:	cd 40                	int    $0x40
+ 3fa:	c3                   	ret
+
+000003fb <dup>:
+SYSCALL(dup)
+ 3fb:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 400:	cd 40                	int    $0x40
+ 402:	c3                   	ret
+
+00000403 <getpid>:
+SYSCALL(getpid)
+ 403:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 408:	cd 40                	int    $0x40
+ 40a:	c3                   	ret
+
+0000040b <sbrk>:
+SYSCALL(sbrk)
+ 40b:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 410:	cd 40                	int    $0x40
+ 412:	c3                   	ret
+
+00000413 <sleep>:
+SYSCALL(sleep)
+ 413:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 418:	cd 40                	int    $0x40
+ 41a:	c3                   	ret
+
+0000041b <uptime>:
+SYSCALL(uptime)
+ 41b:	b8 0e 00 00 00       	mov    $0xe,%eax
+ 420:	cd 40                	int    $0x40
+ 422:	c3                   	ret
+
+00000423 <cpustat>:
+SYSCALL(cpustat)
+ 423:	b8 16 00 00 00       	mov    $0x16,%eax
+ 428:	cd 40                	int    $0x40
+ 42a:	c3                   	ret
+
+0000042b <setpriority>:
+SYSCALL(setpriority)
+ 42b:	b8 17 00 00 00       	mov    $0x17,%eax
+ 430:	cd 40                	int    $0x40
+ 432:	c3                   	ret
+
+00000433 <cpuinfo>:
+SYSCALL(cpuinfo)
+ 433:	b8 18 00 00 00       	mov    $0x18,%eax
+ 438:	cd 40                	int    $0x40
+ 43a:	c3                   	ret
+
+0000043b <procinfo>:
+SYSCALL(procinfo)
+ 43b:	b8 19 00 00 00       	mov    $0x19,%eax
+ 440:	cd 40                	int    $0x40
+ 442:	c3                   	ret
+
+00000443 <setgovernor>:
+SYSCALL(setgovernor)
+ 443:	b8 1a 00 00 00       	mov    $0x1a,%eax
+ 448:	cd 40                	int    $0x40
+ 44a:	c3                   	ret
+
+0000044b <sysctl>:
+SYSCALL(sysctl)
+ 44b:	b8 1b 00 00 00       	mov    $0x1b,%eax
+ 450:	cd 40                	int    $0x40
+ 452:	c3                   	ret
+
+00000453 <telemetry>:
+SYSCALL(telemetry)
+ 453:	b8 1c 00 00 00       	mov    $0x1c,%eax
+ 458:	cd 40                	int    $0x40
+ 45a:	c3                   	ret
+
+0000045b <clock_gettime>:
+SYSCALL(clock_gettime)
+ 45b:	b8 1d 00 00 00       	mov    $0x1d,%eax
+ 460:	cd 40                	int    $0x40
+ 462:	c3                   	ret
+
+00000463 <sched_setaffinity>:
+SYSCALL(sched_setaffinity)
+ 463:	b8 1e 00 00 00       	mov    $0x1e,%eax
+ 468:	cd 40                	int    $0x40
+ 46a:	c3                   	ret
+
+0000046b <sched_getaffinity>:
+SYSCALL(sched_getaffinity)
+ 46b:	b8 1f 00 00 00       	mov    $0x1f,%eax
+ 470:	cd 40                	int    $0x40
+ 472:	c3                   	ret
+
+00000473 <setqos>:
+SYSCALL(setqos)
+ 473:	b8 20 00 00 00       	mov    $0x20,%eax
+ 478:	cd 40                	int    $0x40
+ 47a:	c3                   	ret
+
+0000047b <setgroup>:
+SYSCALL(setgroup)
+ 47b:	b8 21 00 00 00       	mov    $0x21,%eax
+ 480:	cd 40                	int    $0x40
+ 482:	c3                   	ret
+
+00000483 <setquota>:
+SYSCALL(setquota)
+ 483:	b8 22 00 00 00       	mov    $0x22,%eax
+ 488:	cd 40                	int    $0x40
+ 48a:	c3                   	ret
+
+0000048b <groupinfo>:
+SYSCALL(groupinfo)
+ 48b:	b8 23 00 00 00       	mov    $0x23,%eax
+ 490:	cd 40                	int    $0x40
+ 492:	c3                   	ret
+ 493:	66 90                	xchg   %ax,%ax
+ 495:	66 90                	xchg   %ax,%ax
+ 497:	66 90                	xchg   %ax,%ax
+ 499:	66 90                	xchg   %ax,%ax
+ 49b:	66 90                	xchg   %ax,%ax
+ 49d:	66 90                	xchg   %ax,%ax
+ 49f:	90                   	nop
+
+000004a0 <printint>:
+  write(fd, &c, 1);
+}
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+ 4a0:	55                   	push   %ebp
+ 4a1:	89 e5                	mov    %esp,%ebp
+ 4a3:	57                   	push   %edi
+ 4a4:	56                   	push   %esi
+ 4a5:	53                   	push   %ebx
+ 4a6:	89 cb                	mov    %ecx,%ebx
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+    neg = 1;
+    x = -xx;
+ 4a8:	89 d1                	mov    %edx,%ecx
+{
+ 4aa:	83 ec 3c             	sub    $0x3c,%esp
+ 4ad:	89 45 c0             	mov    %eax,-0x40(%ebp)
+  if(sgn && xx < 0){
+ 4b0:	85 d2                	test   %edx,%edx
+ 4b2:	0f 89 80 00 00 00    	jns    538 <printint+0x98>
+ 4b8:	f6 45 08 01          	testb  $0x1,0x8(%ebp)
+ 4bc:	74 7a                	je     538 <printint+0x98>
+    x = -xx;
+ 4be:	f7 d9                	neg    %ecx
+    neg = 1;
+ 4c0:	b8 01 00 00 00       	mov    $0x1,%eax
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+ 4c5:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+ 4c8:	31 f6                	xor    %esi,%esi
+ 4ca:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  do{
+    buf[i++] = digits[x % base];
+ 4d0:	89 c8                	mov    %ecx,%eax
+ 4d2:	31 d2                	xor    %edx,%edx
+ 4d4:	89 f7                	mov    %esi,%edi
+ 4d6:	f7 f3                	div    %ebx
+ 4d8:	8d 76 01             	lea    0x1(%esi),%esi
+ 4db:	0f b6 92 48 09 00 00 	movzbl 0x948(%edx),%edx
+ 4e2:	88 54 35 d7          	mov    %dl,-0x29(%ebp,%esi,1)
+  }while((x /= base) != 0);
+ 4e6:	89 ca                	mov    %ecx,%edx
+ 4e8:	89 c1                	mov    %eax,%ecx
+ 4ea:	39 da                	cmp    %ebx,%edx
+ 4ec:	73 e2                	jae    4d0 <printint+0x30>
+  if(neg)
+ 4ee:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+ 4f1:	85 c0                	test   %eax,%eax
+ 4f3:	74 07                	je     4fc <printint+0x5c>
+    buf[i++] = '-';
+ 4f5:	c6 44 35 d8 2d       	movb   $0x2d,-0x28(%ebp,%esi,1)
+    buf[i++] = digits[x % base];
+ 4fa:	89 f7                	mov    %esi,%edi
+ 4fc:	8d 5d d8             	lea    -0x28(%ebp),%ebx
+ 4ff:	8b 75 c0             	mov    -0x40(%ebp),%esi
+ 502:	01 df                	add    %ebx,%edi
+ 504:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+  while(--i >= 0)
+    putc(fd, buf[i]);
+ 508:	0f b6 07             	movzbl (%edi),%eax
+  write(fd, &c, 1);
+ 50b:	83 ec 04             	sub    $0x4,%esp
+ 50e:	88 45 d7             	mov    %al,-0x29(%ebp)
+ 511:	8d 45 d7             	lea    -0x29(%ebp),%eax
+ 514:	6a 01                	push   $0x1
+ 516:	50                   	push   %eax
+ 517:	56                   	push   %esi
+ 518:	e8 86 fe ff ff       	call   3a3 <write>
+  while(--i >= 0)
+ 51d:	89 f8                	mov    %edi,%eax
+ 51f:	83 c4 10             	add    $0x10,%esp
+ 522:	83 ef 01             	sub    $0x1,%edi
+ 525:	39 d8                	cmp    %ebx,%eax
+ 527:	75 df                	jne    508 <printint+0x68>
+}
+ 529:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 52c:	5b                   	pop    %ebx
+ 52d:	5e                   	pop    %esi
+ 52e:	5f                   	pop    %edi
+ 52f:	5d                   	pop    %ebp
+ 530:	c3                   	ret
+ 531:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  neg = 0;
+ 538:	31 c0                	xor    %eax,%eax
+ 53a:	eb 89                	jmp    4c5 <printint+0x25>
+ 53c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000540 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, const char *fmt, ...)
+{
+ 540:	55                   	push   %ebp
+ 541:	89 e5                	mov    %esp,%ebp
+ 543:	57                   	push   %edi
+ 544:	56                   	push   %esi
+ 545:	53                   	push   %ebx
+ 546:	83 ec 2c             	sub    $0x2c,%esp
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+  ap = (uint*)(void*)&fmt + 1;
+  for(i = 0; fmt[i]; i++){
+ 549:	8b 75 0c             	mov    0xc(%ebp),%esi
+{
+ 54c:	8b 7d 08             	mov    0x8(%ebp),%edi
+  for(i = 0; fmt[i]; i++){
+ 54f:	0f b6 1e             	movzbl (%esi),%ebx
+ 552:	83 c6 01             	add    $0x1,%esi
+ 555:	84 db                	test   %bl,%bl
+ 557:	74 67                	je     5c0 <printf+0x80>
+ 559:	8d 4d 10             	lea    0x10(%ebp),%ecx
+ 55c:	31 d2                	xor    %edx,%edx
+ 55e:	89 4d d0             	mov    %ecx,-0x30(%ebp)
+ 561:	eb 34                	jmp    597 <printf+0x57>
+ 563:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 567:	90                   	nop
+ 568:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+        state = '%';
+ 56b:	ba 25 00 00 00       	mov    $0x25,%edx
+      if(c == '%'){
+ 570:	83 f8 25             	cmp    $0x25,%eax
+ 573:	74 18                	je     58d <printf+0x4d>
+  write(fd, &c, 1);
+ 575:	83 ec 04             	sub    $0x4,%esp
+ 578:	8d 45 e7             	lea    -0x19(%ebp),%eax
+ 57b:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 57e:	6a 01                	push   $0x1
+ 580:	50                   	push   %eax
+ 581:	57                   	push   %edi
+ 582:	e8 1c fe ff ff       	call   3a3 <write>
+ 587:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+      } else {
+        putc(fd, c);
+ 58a:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; fmt[i]; i++){
+ 58d:	0f b6 1e             	movzbl (%esi),%ebx
+ 590:	83 c6 01             	add    $0x1,%esi
+ 593:	84 db                	test   %bl,%bl
+ 595:	74 29                	je     5c0 <printf+0x80>
+    c = fmt[i] & 0xff;
+ 597:	0f b6 c3             	movzbl %bl,%eax
+    if(state == 0){
+ 59a:	85 d2                	test   %edx,%edx
+ 59c:	74 ca                	je     568 <printf+0x28>
+      }
+    } else if(state == '%'){
+ 59e:	83 fa 25             	cmp    $0x25,%edx
+ 5a1:	75 ea                	jne    58d <printf+0x4d>
+      if(c == 'd'){
+ 5a3:	83 f8 25             	cmp    $0x25,%eax
+ 5a6:	0f 84 24 01 00 00    	je     6d0 <printf+0x190>
+ 5ac:	83 e8 63             	sub    $0x63,%eax
+ 5af:	83 f8 15             	cmp    $0x15,%eax
+ 5b2:	77 1c                	ja     5d0 <printf+0x90>
+ 5b4:	ff 24 85 f0 08 00 00 	jmp    *0x8f0(,%eax,4)
+ 5bb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 5bf:	90                   	nop
+        putc(fd, c);
+      }
+      state = 0;
+    }
+  }
+}
+ 5c0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 5c3:	5b                   	pop    %ebx
+ 5c4:	5e                   	pop    %esi
+ 5c5:	5f                   	pop    %edi
+ 5c6:	5d                   	pop    %ebp
+ 5c7:	c3                   	ret
+ 5c8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 5cf:	90                   	nop
+  write(fd, &c, 1);
+ 5d0:	83 ec 04             	sub    $0x4,%esp
+ 5d3:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 5d6:	c6 45 e7 25          	movb   $0x25,-0x19(%ebp)
+ 5da:	6a 01                	push   $0x1
+ 5dc:	52                   	push   %edx
+ 5dd:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+ 5e0:	57                   	push   %edi
+ 5e1:	e8 bd fd ff ff       	call   3a3 <write>
+ 5e6:	83 c4 0c             	add    $0xc,%esp
+ 5e9:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 5ec:	6a 01                	push   $0x1
+ 5ee:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+ 5f1:	52                   	push   %edx
+ 5f2:	57                   	push   %edi
+ 5f3:	e8 ab fd ff ff       	call   3a3 <write>
+        putc(fd, c);
+ 5f8:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 5fb:	31 d2                	xor    %edx,%edx
+ 5fd:	eb 8e                	jmp    58d <printf+0x4d>
+ 5ff:	90                   	nop
+        printint(fd, *ap, 16, 0);
+ 600:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+ 603:	83 ec 0c             	sub    $0xc,%esp
+ 606:	b9 10 00 00 00       	mov    $0x10,%ecx
+ 60b:	8b 13                	mov    (%ebx),%edx
+ 60d:	6a 00                	push   $0x0
+ 60f:	89 f8                	mov    %edi,%eax
+        ap++;
+ 611:	83 c3 04             	add    $0x4,%ebx
+        printint(fd, *ap, 16, 0);
+ 614:	e8 87 fe ff ff       	call   4a0 <printint>
+        ap++;
+ 619:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+ 61c:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 61f:	31 d2                	xor    %edx,%edx
+ 621:	e9 67 ff ff ff       	jmp    58d <printf+0x4d>
+ 626:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 62d:	8d 76 00             	lea    0x0(%esi),%esi
+        s = (char*)*ap;
+ 630:	8b 45 d0             	mov    -0x30(%ebp),%eax
+ 633:	8b 18                	mov    (%eax),%ebx
+        ap++;
+ 635:	83 c0 04             	add    $0x4,%eax
+ 638:	89 45 d0             	mov    %eax,-0x30(%ebp)
+        if(s == 0)
+ 63b:	85 db                	test   %ebx,%ebx
+ 63d:	0f 84 9d 00 00 00    	je     6e0 <printf+0x1a0>
+        while(*s != 0){
+ 643:	0f b6 03             	movzbl (%ebx),%eax
+      state = 0;
+ 646:	31 d2                	xor    %edx,%edx
+        while(*s != 0){
+ 648:	84 c0                	test   %al,%al
+ 64a:	0f 84 3d ff ff ff    	je     58d <printf+0x4d>
+ 650:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 653:	89 75 d4             	mov    %esi,-0x2c(%ebp)
+ 656:	89 de                	mov    %ebx,%esi
+ 658:	89 d3                	mov    %edx,%ebx
+ 65a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  write(fd, &c, 1);
+ 660:	83 ec 04             	sub    $0x4,%esp
+ 663:	88 45 e7             	mov    %al,-0x19(%ebp)
+          s++;
+ 666:	83 c6 01             	add    $0x1,%esi
+  write(fd, &c, 1);
+ 669:	6a 01                	push   $0x1
+ 66b:	53                   	push   %ebx
+ 66c:	57                   	push   %edi
+ 66d:	e8 31 fd ff ff       	call   3a3 <write>
+        while(*s != 0){
+ 672:	0f b6 06             	movzbl (%esi),%eax
+ 675:	83 c4 10             	add    $0x10,%esp
+ 678:	84 c0                	test   %al,%al
+ 67a:	75 e4                	jne    660 <printf+0x120>
+      state = 0;
+ 67c:	8b 75 d4             	mov    -0x2c(%ebp),%esi
+ 67f:	31 d2                	xor    %edx,%edx
+ 681:	e9 07 ff ff ff       	jmp    58d <printf+0x4d>
+ 686:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 68d:	8d 76 00             	lea    0x0(%esi),%esi
+        printint(fd, *ap, 10, 1);
+ 690:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+ 693:	83 ec 0c             	sub    $0xc,%esp
+ 696:	b9 0a 00 00 00       	mov    $0xa,%ecx
+ 69b:	8b 13                	mov    (%ebx),%edx
+ 69d:	6a 01                	push   $0x1
+ 69f:	e9 6b ff ff ff       	jmp    60f <printf+0xcf>
+ 6a4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+        putc(fd, *ap);
+ 6a8:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  write(fd, &c, 1);
+ 6ab:	83 ec 04             	sub    $0x4,%esp
+ 6ae:	8d 55 e7             	lea    -0x19(%ebp),%edx
+        putc(fd, *ap);
+ 6b1:	8b 03                	mov    (%ebx),%eax
+        ap++;
+ 6b3:	83 c3 04             	add    $0x4,%ebx
+        putc(fd, *ap);
+ 6b6:	88 45 e7             	mov    %al,-0x19(%ebp)
+  write(fd, &c, 1);
+ 6b9:	6a 01                	push   $0x1
+ 6bb:	52                   	push   %edx
+ 6bc:	57                   	push   %edi
+ 6bd:	e8 e1 fc ff ff       	call   3a3 <write>
+        ap++;
+ 6c2:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+ 6c5:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 6c8:	31 d2                	xor    %edx,%edx
+ 6ca:	e9 be fe ff ff       	jmp    58d <printf+0x4d>
+ 6cf:	90                   	nop
+  write(fd, &c, 1);
+ 6d0:	83 ec 04             	sub    $0x4,%esp
+ 6d3:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 6d6:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 6d9:	6a 01                	push   $0x1
+ 6db:	e9 11 ff ff ff       	jmp    5f1 <printf+0xb1>
+ 6e0:	b8 28 00 00 00       	mov    $0x28,%eax
+          s = "(null)";
+ 6e5:	bb e9 08 00 00       	mov    $0x8e9,%ebx
+ 6ea:	e9 61 ff ff ff       	jmp    650 <printf+0x110>
+ 6ef:	90                   	nop
+
+000006f0 <free>:
+static Header base;
+static Header *freep;
+
+void
+free(void *ap)
+{
+ 6f0:	55                   	push   %ebp
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 6f1:	a1 0c 0c 00 00       	mov    0xc0c,%eax
+{
+ 6f6:	89 e5                	mov    %esp,%ebp
+ 6f8:	57                   	push   %edi
+ 6f9:	56                   	push   %esi
+ 6fa:	53                   	push   %ebx
+ 6fb:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  bp = (Header*)ap - 1;
+ 6fe:	8d 4b f8             	lea    -0x8(%ebx),%ecx
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 701:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 708:	89 c2                	mov    %eax,%edx
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 70a:	8b 00                	mov    (%eax),%eax
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 70c:	39 ca                	cmp    %ecx,%edx
+ 70e:	73 30                	jae    740 <free+0x50>
+ 710:	39 c1                	cmp    %eax,%ecx
+ 712:	72 04                	jb     718 <free+0x28>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 714:	39 c2                	cmp    %eax,%edx
+ 716:	72 f0                	jb     708 <free+0x18>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+ 718:	8b 73 fc             	mov    -0x4(%ebx),%esi
+ 71b:	8d 3c f1             	lea    (%ecx,%esi,8),%edi
+ 71e:	39 f8                	cmp    %edi,%eax
+ 720:	74 2e                	je     750 <free+0x60>
+    bp->s.size += p->s.ptr->s.size;
+    bp->s.ptr = p->s.ptr->s.ptr;
+ 722:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  } else
+    bp->s.ptr = p->s.ptr;
+  if(p + p->s.size == bp){
+ 725:	8b 42 04             	mov    0x4(%edx),%eax
+ 728:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+ 72b:	39 f1                	cmp    %esi,%ecx
+ 72d:	74 38                	je     767 <free+0x77>
+    p->s.size += bp->s.size;
+    p->s.ptr = bp->s.ptr;
+ 72f:	89 0a                	mov    %ecx,(%edx)
+  } else
+    p->s.ptr = bp;
+  freep = p;
+}
+ 731:	5b                   	pop    %ebx
+  freep = p;
+ 732:	89 15 0c 0c 00 00    	mov    %edx,0xc0c
+}
+ 738:	5e                   	pop    %esi
+ 739:	5f                   	pop    %edi
+ 73a:	5d                   	pop    %ebp
+ 73b:	c3                   	ret
+ 73c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 740:	39 c1                	cmp    %eax,%ecx
+ 742:	72 d0                	jb     714 <free+0x24>
+ 744:	eb c2                	jmp    708 <free+0x18>
+ 746:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 74d:	8d 76 00             	lea    0x0(%esi),%esi
+    bp->s.size += p->s.ptr->s.size;
+ 750:	03 70 04             	add    0x4(%eax),%esi
+ 753:	89 73 fc             	mov    %esi,-0x4(%ebx)
+    bp->s.ptr = p->s.ptr->s.ptr;
+ 756:	8b 02                	mov    (%edx),%eax
+ 758:	8b 00                	mov    (%eax),%eax
+ 75a:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  if(p + p->s.size == bp){
+ 75d:	8b 42 04             	mov    0x4(%edx),%eax
+ 760:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+ 763:	39 f1                	cmp    %esi,%ecx
+ 765:	75 c8                	jne    72f <free+0x3f>
+    p->s.size += bp->s.size;
+ 767:	03 43 fc             	add    -0x4(%ebx),%eax
+  freep = p;
+ 76a:	89 15 0c 0c 00 00    	mov    %edx,0xc0c
+    p->s.size += bp->s.size;
+ 770:	89 42 04             	mov    %eax,0x4(%edx)
+    p->s.ptr = bp->s.ptr;
+ 773:	8b 4b f8             	mov    -0x8(%ebx),%ecx
+ 776:	89 0a                	mov    %ecx,(%edx)
+}
+ 778:	5b                   	pop    %ebx
+ 779:	5e                   	pop    %esi
+ 77a:	5f                   	pop    %edi
+ 77b:	5d                   	pop    %ebp
+ 77c:	c3                   	ret
+ 77d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000780 <malloc>:
+  return freep;
+}
+
+void*
+malloc(uint nbytes)
+{
+ 780:	55                   	push   %ebp
+ 781:	89 e5                	mov    %esp,%ebp
+ 783:	57                   	push   %edi
+ 784:	56                   	push   %esi
+ 785:	53                   	push   %ebx
+ 786:	83 ec 0c             	sub    $0xc,%esp
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ 789:	8b 45 08             	mov    0x8(%ebp),%eax
+  if((prevp = freep) == 0){
+ 78c:	8b 15 0c 0c 00 00    	mov    0xc0c,%edx
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ 792:	8d 78 07             	lea    0x7(%eax),%edi
+ 795:	c1 ef 03             	shr    $0x3,%edi
+ 798:	83 c7 01             	add    $0x1,%edi
+  if((prevp = freep) == 0){
+ 79b:	85 d2                	test   %edx,%edx
+ 79d:	0f 84 8d 00 00 00    	je     830 <malloc+0xb0>
+    base.s.ptr = freep = prevp = &base;
+    base.s.size = 0;
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ 7a3:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+ 7a5:	8b 48 04             	mov    0x4(%eax),%ecx
+ 7a8:	39 f9                	cmp    %edi,%ecx
+ 7aa:	73 64                	jae    810 <malloc+0x90>
+  if(nu < 4096)
+ 7ac:	bb 00 10 00 00       	mov    $0x1000,%ebx
+ 7b1:	39 df                	cmp    %ebx,%edi
+ 7b3:	0f 43 df             	cmovae %edi,%ebx
+  p = sbrk(nu * sizeof(Header));
+ 7b6:	8d 34 dd 00 00 00 00 	lea    0x0(,%ebx,8),%esi
+ 7bd:	eb 0a                	jmp    7c9 <malloc+0x49>
+ 7bf:	90                   	nop
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ 7c0:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+ 7c2:	8b 48 04             	mov    0x4(%eax),%ecx
+ 7c5:	39 f9                	cmp    %edi,%ecx
+ 7c7:	73 47                	jae    810 <malloc+0x90>
+        p->s.size = nunits;
+      }
+      freep = prevp;
+      return (void*)(p + 1);
+    }
+    if(p == freep)
+ 7c9:	89 c2                	mov    %eax,%edx
+ 7cb:	39 05 0c 0c 00 00    	cmp    %eax,0xc0c
+ 7d1:	75 ed                	jne    7c0 <malloc+0x40>
+  p = sbrk(nu * sizeof(Header));
+ 7d3:	83 ec 0c             	sub    $0xc,%esp
+ 7d6:	56                   	push   %esi
+ 7d7:	e8 2f fc ff ff       	call   40b <sbrk>
+  if(p == (char*)-1)
+ 7dc:	83 c4 10             	add    $0x10,%esp
+ 7df:	83 f8 ff             	cmp    $0xffffffff,%eax
+ 7e2:	74 1c                	je     800 <malloc+0x80>
+  hp->s.size = nu;
+ 7e4:	89 58 04             	mov    %ebx,0x4(%eax)
+  free((void*)(hp + 1));
+ 7e7:	83 ec 0c             	sub    $0xc,%esp
+ 7ea:	83 c0 08             	add    $0x8,%eax
+ 7ed:	50                   	push   %eax
+ 7ee:	e8 fd fe ff ff       	call   6f0 <free>
+  return freep;
+ 7f3:	8b 15 0c 0c 00 00    	mov    0xc0c,%edx
+      if((p = morecore(nunits)) == 0)
+ 7f9:	83 c4 10             	add    $0x10,%esp
+ 7fc:	85 d2                	test   %edx,%edx
+ 7fe:	75 c0                	jne    7c0 <malloc+0x40>
+        return 0;
+  }
+}
+ 800:	8d 65 f4             	lea    -0xc(%ebp),%esp
+        return 0;
+ 803:	31 c0                	xor    %eax,%eax
+}
+ 805:	5b                   	pop    %ebx
+ 806:	5e                   	pop    %esi
+ 807:	5f                   	pop    %edi
+ 808:	5d                   	pop    %ebp
+ 809:	c3                   	ret
+ 80a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+      if(p->s.size == nunits)
+ 810:	39 cf                	cmp    %ecx,%edi
+ 812:	74 4c                	je     860 <malloc+0xe0>
+        p->s.size -= nunits;
+ 814:	29 f9                	sub    %edi,%ecx
+ 816:	89 48 04             	mov    %ecx,0x4(%eax)
+        p += p->s.size;
+ 819:	8d 04 c8             	lea    (%eax,%ecx,8),%eax
+        p->s.size = nunits;
+ 81c:	89 78 04             	mov    %edi,0x4(%eax)
+      freep = prevp;
+ 81f:	89 15 0c 0c 00 00    	mov    %edx,0xc0c
+}
+ 825:	8d 65 f4             	lea    -0xc(%ebp),%esp
+      return (void*)(p + 1);
+ 828:	83 c0 08             	add    $0x8,%eax
+}
+ 82b:	5b                   	pop    %ebx
+ 82c:	5e                   	pop    %esi
+ 82d:	5f                   	pop    %edi
+ 82e:	5d                   	pop    %ebp
+ 82f:	c3                   	ret
+    base.s.ptr = freep = prevp = &base;
+ 830:	c7 05 0c 0c 00 00 10 	movl   $0xc10,0xc0c
+ 837:	0c 00 00 
+    base.s.size = 0;
+ 83a:	b8 10 0c 00 00       	mov    $0xc10,%eax
+    base.s.ptr = freep = prevp = &base;
+ 83f:	c7 05 10 0c 00 00 10 	movl   $0xc10,0xc10
+ 846:	0c 00 00 
+    base.s.size = 0;
+ 849:	c7 05 14 0c 00 00 00 	movl   $0x0,0xc14
+ 850:	00 00 00 
+    if(p->s.size >= nunits){
+ 853:	e9 54 ff ff ff       	jmp    7ac <malloc+0x2c>
+ 858:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 85f:	90                   	nop
+        prevp->s.ptr = p->s.ptr;
+ 860:	8b 08                	mov    (%eax),%ecx
+ 862:	89 0a                	mov    %ecx,(%edx)
+ 864:	eb b9                	jmp    81f <malloc+0x9f>
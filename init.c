@@ -7,6 +7,22 @@
 
 char *argv[] = { "sh", 0 };
 
+// Scheduler and process state pseudo-files (see procfs.c).
+char *procfiles[] = { "schedstat", "loadhist", "procs", "thermal", "sysctl" };
+
+static void
+mkprocfs(void)
+{
+  char path[32];
+  int i;
+
+  for(i = 0; i < sizeof(procfiles)/sizeof(procfiles[0]); i++){
+    strcpy(path, "dev/");
+    strcpy(path + 4, procfiles[i]);
+    mknod(path, 2, i);
+  }
+}
+
 int
 main(void)
 {
@@ -18,6 +34,8 @@ main(void)
   }
   dup(0);  // stdout
   dup(0);  // stderr
+  if(mkdir("dev") == 0)
+    mkprocfs();
 
   for(;;){
     printf(1, "init: starting sh\n");
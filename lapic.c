@@ -31,6 +31,7 @@
 #define ICRHI   (0x0310/4)   // Interrupt Command [63:32]
 #define TIMER   (0x0320/4)   // Local Vector Table 0 (TIMER)
   #define X1         0x0000000B   // divide counts by 1
+  #define ONESHOT    0x00000000   // One-shot
   #define PERIODIC   0x00020000   // Periodic
 #define PCINT   (0x0340/4)   // Performance Counter LVT
 #define LINT0   (0x0350/4)   // Local Vector Table 1 (LINT0)
@@ -43,6 +44,42 @@
 
 volatile uint *lapic;  // Initialized in mp.c
 
+// Each CPU runs its timer in one-shot mode and multiplexes two
+// deadlines on it: the next periodic tick and the end of the running
+// process's time slice.  Deadlines are positions on a per-CPU
+// timeline measured in timer counts; comparisons are
+// wraparound-safe.
+//
+// The timeline is advanced from the TSC rather than read back from
+// the timer, so re-arming the timer, which happens at every context
+// switch, loses no time however late the interrupt is taken: the
+// timer only says when to look.  The timer's rate is calibrated
+// against the TSC at boot, making a tick TICKUS of TSC time.
+//
+// Ticks are counted lazily: any timer interrupt accounts for all the
+// tick boundaries passed since the last one.  So a busy CPU need only
+// take a timer tick every stride ticks, and an idle one can stop its
+// tick altogether for a while (lapicnohz) without time being lost.
+// The timeline wraps after 2^32 counts, about 400 ticks at a 1 GHz
+// timer, which bounds both.
+#define TICKUS    10000      // Length of a tick in microseconds
+#define USCOUNT   (tickcount / TICKUS)
+#define TSCSHIFT  24         // Fraction bits of tscmult
+
+static uint tickcount;       // Timer counts per tick
+static uint64 tscmult;       // Timer counts per TSC cycle << TSCSHIFT
+
+static struct timer {
+  uint now;       // Timeline position when last synced
+  uint64 tsc;     // TSC at that position
+  uint frac;      // ... plus this many counts >> TSCSHIFT
+  uint last;      // Last tick boundary accounted for
+  uint stride;    // Ticks between timer ticks while busy
+  uint nohz;      // If nonzero, ticks to the next timer tick while idle
+  uint slice;     // Deadline of the current time slice
+  int slicing;    // Is there a slice deadline?
+} timer[NCPU];
+
 //PAGEBREAK!
 static void
 lapicw(int index, int value)
@@ -51,6 +88,57 @@ lapicw(int index, int value)
   lapic[ID];  // wait for write to finish, by reading
 }
 
+static int
+before(uint a, uint b)
+{
+  return (int)(a - b) < 0;
+}
+
+// Advance t's timeline by the TSC cycles elapsed since the last
+// call, keeping the fraction of a count left over.
+static void
+timersync(struct timer *t)
+{
+  uint64 tsc, d;
+
+  tsc = rdtsc();
+  d = (tsc - t->tsc) * tscmult + t->frac;
+  t->tsc = tsc;
+  t->now += d >> TSCSHIFT;
+  t->frac = d & ((1 << TSCSHIFT) - 1);
+}
+
+// Arm the timer for t's earliest deadline.
+static void
+timerarm(struct timer *t)
+{
+  uint next;
+
+  next = t->last + (t->nohz ? t->nohz : t->stride) * tickcount;
+  if(t->slicing && before(t->slice, next))
+    next = t->slice;
+  lapicw(TICR, before(t->now, next) ? next - t->now : 1);
+}
+
+// Count the timer's ticks over one tick's worth of TSC cycles.
+// Needs tscinit() to have run.
+static void
+timercalibrate(void)
+{
+  uint64 t0, cycles;
+
+  cycles = tsc_khz * (TICKUS / 1000);
+  lapicw(TIMER, MASKED);
+  lapicw(TICR, 0xFFFFFFFF);
+  t0 = rdtsc();
+  while(rdtsc() - t0 < cycles)
+    ;
+  tickcount = 0xFFFFFFFF - lapic[TCCR];
+  if(tickcount < TICKUS)
+    tickcount = 10000000;      // timer not counting; assume 1 GHz
+  tscmult = div64((uint64)tickcount << TSCSHIFT, cycles, 0);
+}
+
 void
 lapicinit(void)
 {
@@ -60,13 +148,22 @@ lapicinit(void)
   // Enable local APIC; set spurious interrupt vector.
   lapicw(SVR, ENABLE | (T_IRQ0 + IRQ_SPURIOUS));
 
-  // The timer repeatedly counts down at bus frequency
-  // from lapic[TICR] and then issues an interrupt.
-  // If xv6 cared more about precise timekeeping,
-  // TICR would be calibrated using an external time source.
+  // The timer counts down at bus frequency from lapic[TICR]
+  // and then issues an interrupt; lapictimer() re-arms it.
+  // The boot CPU calibrates it against the TSC; the bus
+  // frequency is the same for all CPUs.
   lapicw(TDCR, X1);
-  lapicw(TIMER, PERIODIC | (T_IRQ0 + IRQ_TIMER));
-  lapicw(TICR, 10000000);
+  if(tickcount == 0)
+    timercalibrate();
+  lapicw(TIMER, ONESHOT | (T_IRQ0 + IRQ_TIMER));
+  timer[cpuid()].now = 0;
+  timer[cpuid()].tsc = rdtsc();
+  timer[cpuid()].frac = 0;
+  timer[cpuid()].last = 0;
+  timer[cpuid()].stride = 1;
+  timer[cpuid()].nohz = 0;
+  timer[cpuid()].slicing = 0;
+  timerarm(&timer[cpuid()]);
 
   // Disable logical interrupt lines.
   lapicw(LINT0, MASKED);
@@ -113,6 +210,94 @@ lapiceoi(void)
     lapicw(EOI, 0);
 }
 
+// Handle a timer interrupt on this CPU: work out which deadlines
+// have passed and re-arm for the next one.  Returns the number of
+// ticks elapsed since the last call, and sets *slice if the time
+// slice has ended.
+int
+lapictimer(int *slice)
+{
+  struct timer *t;
+  uint n;
+
+  t = &timer[cpuid()];
+  timersync(t);
+  n = (t->now - t->last) / tickcount;
+  t->last += n * tickcount;
+  *slice = 0;
+  if(t->slicing && !before(t->now, t->slice)){
+    *slice = 1;
+    t->slicing = 0;
+  }
+  timerarm(t);
+  return n;
+}
+
+// Take a timer tick only every n ticks while busy (n >= 1).
+// Caller must have interrupts disabled.
+void
+lapicstride(uint n)
+{
+  struct timer *t;
+
+  if(n < 1)
+    n = 1;
+  t = &timer[cpuid()];
+  if(!lapic || t->stride == n)
+    return;
+  timersync(t);
+  t->stride = n;
+  timerarm(t);
+}
+
+// Stop this CPU's tick for up to n ticks while it idles, or
+// restart it if n is 0.  Ticks that passed meanwhile are accounted
+// by the next lapictimer(), which a restart makes happen at once.
+// Caller must have interrupts disabled.
+void
+lapicnohz(uint n)
+{
+  struct timer *t;
+
+  if(!lapic)
+    return;
+  t = &timer[cpuid()];
+  timersync(t);
+  t->nohz = n;
+  timerarm(t);
+}
+
+// Interrupt the CPU with the given APIC ID, to get it out of hlt.
+void
+lapickick(int apicid)
+{
+  lapicw(ICRHI, apicid<<24);
+  lapicw(ICRLO, FIXED | ASSERT | (T_IRQ0 + IRQ_KICK));
+  while(lapic[ICRLO] & DELIVS)
+    ;
+}
+
+// Start a time slice of us microseconds on this CPU, or cancel
+// the current one if us is 0.  Ticks are unaffected.  Slices longer
+// than NOHZ_MAX ticks are cut to that, well inside the timeline's
+// wraparound-safe half.
+// Caller must have interrupts disabled.
+void
+lapicslice(uint us)
+{
+  struct timer *t;
+
+  if(!lapic)
+    return;
+  if(us > NOHZ_MAX * TICKUS)
+    us = NOHZ_MAX * TICKUS;
+  t = &timer[cpuid()];
+  timersync(t);
+  t->slicing = us > 0;
+  t->slice = t->now + us * USCOUNT;
+  timerarm(t);
+}
+
 // Spin for a given number of microseconds.
 // On real hardware would want to tune this dynamically.
 void
@@ -20,13 +20,16 @@ main(void)
   kinit1(end, P2V(4*1024*1024)); // phys page allocator
   kvmalloc();      // kernel page table
   mpinit();        // detect other processors
+  tscinit();       // calibrate the time stamp counter
   lapicinit();     // interrupt controller
   seginit();       // segment descriptors
   picinit();       // disable pic
   ioapicinit();    // another interrupt controller
   consoleinit();   // console hardware
+  procfsinit();    // /dev pseudo-files
   uartinit();      // serial port
   pinit();         // process table
+  groupinit();     // CPU bandwidth groups
   tvinit();        // trap vectors
   binit();         // buffer cache
   fileinit();      // file table
@@ -10,5 +10,8 @@
 #define MAXOPBLOCKS  10  // max # of blocks any FS op writes
 #define LOGSIZE      (MAXOPBLOCKS*3)  // max data blocks in on-disk log
 #define NBUF         (MAXOPBLOCKS*3)  // size of disk block cache
-#define FSSIZE       1000  // size of file system in blocks
+#define FSSIZE       4000  // size of file system in blocks
+#define NTELEMETRY   64  // SPAS samples kept for telemetry readers
+#define NOHZ_MAX    100  // longest an idle CPU goes without a tick
+#define NGROUP        8  // process groups for CPU bandwidth control
 
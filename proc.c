@@ -4,6 +4,7 @@
 #include "memlayout.h"
 #include "mmu.h"
 #include "x86.h"
+#include "spas.h"
 #include "proc.h"
 #include "spinlock.h"
 
@@ -19,56 +20,24 @@ extern void forkret(void);
 extern void trapret(void);
 
 static void wakeup1(void *chan);
+static void makerunnable(struct proc *p);
+static void wakepreempt(struct proc *p);
+static void kickidle(struct proc *p);
 
 struct spinlock tickslock;
 uint ticks;
 
-// --- Our new counters ---
-uint tot_ticks = 0;
-uint idle_ticks = 0;
-int is_idle = 0;
-// --- End of new counters ---
-
-// --- Phase 2: Predictive Scheduler Variables ---
-// HISTORY_SIZE and LOAD_PERIOD are now defined in proc.h
-
-int cpu_load = 0;         // Current CPU load (0-100)
-int predicted_load = 0;   // Predicted load (0-100)
-int load_history[HISTORY_SIZE]; // Array to store recent load values
-int history_index = 0;    // Current position in the history array
-
-// Simulated CPU frequency states
-char *freq_str[] = { "LOW", "MEDIUM", "HIGH" }; // String names for printing
-enum freq_level current_frequency = LOW;
-
-// Initial (non-adaptive) thresholds
-int THRESH_LOW_TO_MED = 30; // 30%
-int THRESH_MED_TO_HIGH = 70; // 70%
-// --- End of Phase 2 Variables ---
-
-// --- Phase 5: Adaptive Thresholds Variables ---
-int oscillation_count = 0;     // Count of recent frequency switches
-int last_switch_tick = 0;      // Tick when last switch occurred
-int OSCILLATION_WINDOW = 1000; // Ticks to consider for oscillation (10 seconds)
-int MAX_OSCILLATION = 5;       // Max switches in window before widening
-int ADAPTATION_PERIOD = 5000;  // Ticks between threshold adjustments
-int last_adaptation_tick = 0;  // Last time thresholds were adjusted
-enum freq_level prev_frequency = LOW; // Track previous frequency for oscillation detection
-int adaptation_counter = 0;    // Counter for adaptation periods
-// --- End of Phase 5 Variables ---
-
-// --- Phase 4: Virtual Thermal Variables ---
-int virtual_temp = 250;     // Temperature in tenths of degrees C (e.g., 250 = 25.0 C)
-int HEATING_FACTOR = 20;    // UPDATED: Increase per % load per period (e.g., 100% load adds 2.0 C)
-int COOLING_FACTOR = 5;     // UPDATED: Decrease per period (e.g., cools by 0.5 C)
-int TEMP_THROTTLE_LIMIT = 800; // Throttle if temp > 80.0 C
-int AMBIENT_TEMP = 250;     // Minimum temperature (25.0 C)
-// --- End of Phase 4 Variables ---
+// --- SPAS policy state (see spas.c) ---
+// Load prediction, frequency, thermal and threshold state,
+// updated every LOAD_PERIOD ticks by update_scheduler_analytics().
+struct spas spas;
+// --- End of SPAS state ---
 
 void
 pinit(void)
 {
   initlock(&ptable.lock, "ptable");
+  spas_init(&spas, ncpu);
 }
 
 // Must be called with interrupts disabled
@@ -135,7 +104,24 @@ found:
   p->pid = nextpid++;
   p->killed = 0; // *** ADDED: Explicitly clear killed status as a memory safety fix ***
   p->priority = DEFAULT_PRIORITY; // Initialize default priority
-  p->quantum_remaining = QUANTUM_MEDIUM; // Initialize quantum (will be updated when scheduled)
+  p->quantum_remaining = spas.quantum[MEDIUM]; // Initialize quantum (will be updated when scheduled)
+  p->energy_mj = p->energy_uj = 0;
+  p->cenergy_mj = p->cenergy_uj = 0;
+  p->runtime = 0;
+  p->cpu = 0;
+  p->load = SCHED_LOAD;          // assume busy until it shows otherwise
+  p->loadstamp = ticks;
+  p->lastrun = ticks;
+  p->lastcpu = -1;
+  p->migrations = 0;
+  p->affinity = ALLCPUS;
+  p->class = CLASS_CPU;
+  p->nvcsw = p->nivcsw = 0;
+  p->vratio = 0;
+  p->ttywake = ticks - spas.interactive_ticks;
+  p->boost = 0;
+  p->qos = QOS_DEFAULT;
+  p->group = 0;
 
   release(&ptable.lock);
 
@@ -256,12 +242,21 @@ fork(void)
 
   pid = np->pid;
 
-  // Inherit parent's priority by default
+  // Inherit the parent's scheduling attributes: priority, affinity
+  // mask, QoS class and bandwidth group.  exec() keeps them too, so
+  // a command can be started with them set by its parent.
   np->priority = curproc->priority;
+  np->affinity = curproc->affinity;
+  np->qos = curproc->qos;
+  np->group = curproc->group;
   // Give child a fresh quantum
-  np->quantum_remaining = QUANTUM_MEDIUM;
+  np->quantum_remaining = spas.quantum[MEDIUM];
+  // Start on the parent's queue, unless another is much lighter.
+  np->cpu = curproc->cpu;
 
-  np->state = RUNNABLE;
+  acquire(&ptable.lock);
+  makerunnable(np);
+  release(&ptable.lock);
 
   return pid;
 }
@@ -332,6 +327,10 @@ wait(void)
       if(p->state == ZOMBIE){
         // Found one.
         pid = p->pid;
+        // Fold its energy, and its children's, into ours.
+        spas_charge(&curproc->cenergy_mj, &curproc->cenergy_uj,
+                    p->energy_uj + p->cenergy_uj);
+        curproc->cenergy_mj += p->energy_mj + p->cenergy_mj;
         kfree(p->kstack);
         p->kstack = 0;
         freevm(p->pgdir);
@@ -356,6 +355,346 @@ wait(void)
   }
 }
 
+// Count the TSC cycles since this CPU's last call as busy, and
+// charge them, and their energy at this CPU's level, to the running
+// process and its group; or count them as idle if nothing runs.
+// Idle-class processes are charged but the time counts as idle, so
+// that they do not raise the load the governors see.
+// Called at every context switch and timer tick, so the counts are
+// exact rather than sampled.  Caller must have interrupts disabled.
+void
+cpufold(void)
+{
+  struct cpu *c;
+  uint64 now, d;
+
+  c = mycpu();
+  now = rdtsc();
+  d = now - c->stamp;
+  c->stamp = now;
+  if(c->proc){
+    c->proc->runtime += d;
+    groupcharge(c->proc->group, d);
+    // mW * ns / 10^6 = uJ
+    spas_charge(&c->proc->energy_mj, &c->proc->energy_uj,
+                div64(tsc2ns(d) * spas.busy_power[spas.cpu[c - cpus].freq],
+                      1000000, 0));
+  }
+  if(c->proc && c->proc->qos != QOS_IDLE){
+    c->busy_cycles += d;
+    c->busy_kc = c->busy_cycles >> 10;
+  } else {
+    c->idle_cycles += d;
+    c->idle_kc = c->idle_cycles >> 10;
+  }
+}
+
+// How many ticks this idle CPU can go without a timer tick: up to
+// the next analytics period at most.  CPU 0 keeps time, so it stops
+// its tick only while every CPU is idle, and not past the deadline of
+// any process in sleep(), nor past the refill of a throttled group.
+// The wheel is read without tickslock, which cannot be taken under
+// ptable.lock: that is safe because every other CPU is halted, so
+// none can be adding a sleeper, and CPU 0 itself is here.
+// Caller holds ptable.lock.
+static uint
+nohzticks(struct cpu *c)
+{
+  struct cpu *o;
+  uint now, n;
+
+  now = ticks;
+  n = spas.load_period - now % spas.load_period;
+  if(n > NOHZ_MAX)
+    n = NOHZ_MAX;
+  if(c != cpus)
+    return n;
+  for(o = cpus; o < &cpus[ncpu]; o++)
+    if(o != c && !o->halted)
+      return 1;
+  return groupnohz(wheelnext(n));
+}
+
+// --- Per-CPU queues and load balancing ---
+// Each process is queued on one CPU (p->cpu), and a CPU runs the
+// processes on its own queue.  A CPU with nothing of its own takes a
+// waiting process from another queue rather than go idle; and every
+// balance_interval ticks each busy CPU compares its load, the sum of
+// its processes' decayed loads, with the busiest CPU's, and pulls a
+// process over if that evens them out.  Processes that ran in the
+// last cache_hot ticks are left where their caches are warm, if
+// there is a choice, and processes that last ran on a CPU go back to
+// it on wakeup unless its queue is much busier than another.  No
+// process is queued on a CPU outside its affinity mask.
+//
+// When little load is forecast, SPAS parks all but the first
+// spas.nactive CPUs (see park() in spas.c).  Parked CPUs take no new
+// work, hand their queues to the active ones and halt in a deeper
+// idle state.  A process whose mask holds only parked CPUs still
+// runs on them.
+//
+// A CPU nearing throttle_limit pulls no work, and a cool CPU takes
+// the most CPU-bound process, running or not, off such a CPU, at most
+// one per hot CPU per analytics period (see spas_thermal_source).
+// The spas.cpu[].tmoved and tmigrations counts are protected by
+// ptable.lock.
+
+// Bring p->load up to the current tick.  runnable says whether p
+// has been running or waiting to run since it was last brought up
+// to date.  Caller holds ptable.lock.
+static void
+pelt(struct proc *p, int runnable)
+{
+  p->load = spas_pelt(p->load, ticks - p->loadstamp, runnable);
+  p->loadstamp = ticks;
+}
+
+static int
+allowed(struct proc *p, int cpu)
+{
+  return (p->affinity >> cpu) & 1;
+}
+
+static int
+parked(int cpu)
+{
+  return cpu >= spas.nactive;
+}
+
+// May p be queued on cpu?
+static int
+usable(struct proc *p, int cpu)
+{
+  if(!allowed(p, cpu))
+    return 0;
+  return !parked(cpu) || (p->affinity & ((1 << spas.nactive) - 1)) == 0;
+}
+
+// Priority to schedule p at, including any console wakeup boost.
+static int
+prio(struct proc *p)
+{
+  int pr;
+
+  pr = p->priority - p->boost;
+  return pr < 0 ? 0 : pr;
+}
+
+// Is p waiting to run, and allowed to by its group's quota?
+static int
+eligible(struct proc *p)
+{
+  return p->state == RUNNABLE && !groupthrottled(p->group);
+}
+
+static void
+classify(struct proc *p)
+{
+  p->class = spas_classify(&spas, p->load, p->vratio, ticks - p->ttywake);
+}
+
+static int
+cachehot(struct proc *p)
+{
+  return ticks - p->lastrun < spas.cache_hot;
+}
+
+// Is p a better process to move to cpu than best?  Anything before
+// idle-class processes, then higher priority, then one that last ran
+// on cpu, then cache cold before hot.
+static int
+bettermove(struct proc *p, struct proc *best, int cpu)
+{
+  if(best == 0)
+    return 1;
+  if((p->qos == QOS_IDLE) != (best->qos == QOS_IDLE))
+    return best->qos == QOS_IDLE;
+  if(prio(p) != prio(best))
+    return prio(p) < prio(best);
+  if((p->lastcpu == cpu) != (best->lastcpu == cpu))
+    return p->lastcpu == cpu;
+  return cachehot(best) && !cachehot(p);
+}
+
+// Should p run before best on the same CPU?  Idle-class processes
+// only when there is nothing else, then lower (boosted) priority
+// value first, then the more urgent QoS class, then interactive
+// processes.
+static int
+runsbefore(struct proc *p, struct proc *best)
+{
+  if(best == 0)
+    return 1;
+  if((p->qos == QOS_IDLE) != (best->qos == QOS_IDLE))
+    return best->qos == QOS_IDLE;
+  if(prio(p) != prio(best))
+    return prio(p) < prio(best);
+  if(p->qos != best->qos)
+    return p->qos < best->qos;
+  return p->class == CLASS_INTERACTIVE && best->class != CLASS_INTERACTIVE;
+}
+
+// Batch and idle processes, like I/O-bound ones, are not worth
+// waking or moving to another CPU for.
+static int
+batchy(struct proc *p)
+{
+  return p->qos >= QOS_BATCH || p->class == CLASS_IO;
+}
+
+// Sum the up to date loads of the processes on each CPU's queue.
+// Idle-class processes use only spare time, so they add nothing.
+// Caller holds ptable.lock.
+static void
+queueloads(uint *load)
+{
+  struct proc *p;
+  int i;
+
+  for(i = 0; i < ncpu; i++)
+    load[i] = 0;
+  for(p = ptable.proc; p < &ptable.proc[NPROC]; p++){
+    if(p->state != RUNNABLE && p->state != RUNNING)
+      continue;
+    pelt(p, 1);
+    if(p->qos != QOS_IDLE)
+      load[p->cpu] += p->load;
+  }
+}
+
+// Choose the queue for a process that is becoming runnable: the CPU
+// it last ran on (or its parent's, if it has not run yet), unless
+// that queue's load exceeds the lightest one's by affinity_pct, or
+// p may no longer run there, or it is parked.  Latency-critical
+// processes take the lightest queue outright; batch and idle ones
+// stay put whatever the imbalance.
+// Caller holds ptable.lock.
+static void
+placeproc(struct proc *p)
+{
+  uint load[NCPU];
+  int i, home, idlest, pct;
+
+  home = p->lastcpu >= 0 ? p->lastcpu : p->cpu;
+  pct = spas.affinity_pct;
+  if(p->qos == QOS_LATENCY)
+    pct = 0;
+  queueloads(load);
+  idlest = -1;
+  for(i = 0; i < ncpu; i++)
+    if(usable(p, i) && (idlest < 0 || load[i] < load[idlest]))
+      idlest = i;
+  if(!usable(p, home) || (p->qos < QOS_BATCH &&
+     (load[home] - load[idlest]) * 100 > pct * SCHED_LOAD))
+    home = idlest;
+  p->cpu = home;
+}
+
+// Take a waiting process from another CPU's queue for an idle CPU,
+// or for one with only idle-class work (idleonly), in which case
+// only a process of another class will do.  A hot CPU takes nothing,
+// or it would take back what thermalpull() just moved off it.
+// Caller holds ptable.lock.
+static struct proc*
+steal(int cpu, int idleonly)
+{
+  struct proc *p, *best;
+
+  if(spas_hot(&spas, cpu))
+    return 0;
+  best = 0;
+  for(p = ptable.proc; p < &ptable.proc[NPROC]; p++)
+    if(eligible(p) && p->cpu != cpu && usable(p, cpu) &&
+       !(idleonly && p->qos == QOS_IDLE) && bettermove(p, best, cpu))
+      best = p;
+  if(best)
+    best->cpu = cpu;
+  return best;
+}
+
+// Move the waiting processes off a parked CPU's queue.
+// Caller holds ptable.lock.
+static void
+unqueue(int cpu)
+{
+  struct proc *p;
+
+  for(p = ptable.proc; p < &ptable.proc[NPROC]; p++)
+    if(p->state == RUNNABLE && p->cpu == cpu && !usable(p, cpu)){
+      placeproc(p);
+      kickidle(p);
+    }
+}
+
+// Take the most CPU-bound process from a CPU nearing the throttle
+// limit, if there is one.  If it is running there, that CPU is made
+// to preempt it now.  Returns whether a process moved.
+// Caller holds ptable.lock.
+static int
+thermalpull(int me)
+{
+  struct proc *p, *best;
+  int src;
+
+  if((src = spas_thermal_source(&spas, me)) < 0)
+    return 0;
+  best = 0;
+  for(p = ptable.proc; p < &ptable.proc[NPROC]; p++)
+    if((p->state == RUNNABLE || p->state == RUNNING) && p->cpu == src &&
+       p->class == CLASS_CPU && usable(p, me) &&
+       (best == 0 || p->load > best->load))
+      best = p;
+  if(best == 0)
+    return 0;
+  best->cpu = me;
+  if(best->state == RUNNING){
+    cpus[src].preempt = 1;
+    lapickick(cpus[src].apicid);
+  } else
+    kickidle(best);
+  spas.cpu[src].tmoved = 1;
+  spas.cpu[src].tmigrations++;
+  return 1;
+}
+
+// Periodic load balancing, called from each CPU's timer tick.
+// The busiest CPU's running process cannot move, so only waiting
+// ones are considered, and only one whose load is less than the
+// difference: the two loads predicted after the move are then
+// closer than before.
+void
+loadbalance(void)
+{
+  struct proc *p, *best;
+  uint load[NCPU], diff;
+  int i, me, busiest;
+
+  acquire(&ptable.lock);
+  me = cpuid();
+  if(parked(me) || spas_hot(&spas, me) || thermalpull(me)){
+    release(&ptable.lock);
+    return;
+  }
+  queueloads(load);
+  busiest = me;
+  for(i = 0; i < ncpu; i++)
+    if(load[i] > load[busiest])
+      busiest = i;
+  diff = load[busiest] - load[me];
+  if(diff * 100 <= spas.balance_pct * SCHED_LOAD){
+    release(&ptable.lock);
+    return;
+  }
+  best = 0;
+  for(p = ptable.proc; p < &ptable.proc[NPROC]; p++)
+    if(eligible(p) && p->cpu == busiest && p->load < diff &&
+       p->qos != QOS_IDLE && usable(p, me) && bettermove(p, best, me))
+      best = p;
+  if(best)
+    best->cpu = me;
+  release(&ptable.lock);
+}
+
 //PAGEBREAK: 42
 // Per-CPU process scheduler.
 // Each CPU calls scheduler() after setting itself up.
@@ -369,37 +708,51 @@ scheduler(void)
 {
   struct proc *p;
   struct cpu *c = mycpu();
+  uint n;
   c->proc = 0;
+  c->stamp = rdtsc();
 
   for(;;){
     // Enable interrupts on this processor.
     sti();
 
     // --- Our new code: Assume we are idle until proven otherwise ---
-    is_idle = 1;
+    c->idle = 1;
     // --- End of new code ---
 
-    // Loop over process table looking for process to run.
+    // Run the RUNNABLE process on this CPU's queue that should go
+    // first (see runsbefore), or else take one from another queue.
     acquire(&ptable.lock);
-    // Select the RUNNABLE process with the lowest priority value
+    if(parked(c - cpus))
+      unqueue(c - cpus);
     struct proc *best = 0;
     for(p = ptable.proc; p < &ptable.proc[NPROC]; p++){
-      if(p->state != RUNNABLE)
+      if(!eligible(p) || p->cpu != c - cpus)
         continue;
-      if(best == 0 || p->priority < best->priority)
+      if(runsbefore(p, best))
         best = p;
     }
+    if((best == 0 || best->qos == QOS_IDLE) && !parked(c - cpus) &&
+       (p = steal(c - cpus, best != 0)) != 0)
+      best = p;
 
     if(best){
       // We found a process to run
-      is_idle = 0;
-      // Set quantum based on current frequency
-      if(current_frequency == LOW)
-        best->quantum_remaining = QUANTUM_LOW;
-      else if(current_frequency == MEDIUM)
-        best->quantum_remaining = QUANTUM_MEDIUM;
-      else // HIGH
-        best->quantum_remaining = QUANTUM_HIGH;
+      cpufold();
+      c->idle = 0;
+      // Set quantum based on this CPU's current frequency, scaled
+      // for the QoS class, or longer for CPU-bound processes of the
+      // default class, and have the timer end it (see lapicslice).
+      best->quantum_remaining = spas.quantum[spas.cpu[cpuid()].freq] / 100 *
+        (best->qos == QOS_DEFAULT && best->class == CLASS_CPU ?
+         spas.cpu_quantum_pct : spas.qos_quantum[best->qos]);
+      if(best->qos == QOS_LATENCY)
+        spas.cpu[c - cpus].floor = HIGH;
+      c->preempt = 0;
+      lapicslice(groupslice(best->group, best->quantum_remaining));
+      if(best->lastcpu >= 0 && best->lastcpu != c - cpus)
+        best->migrations++;
+      best->lastcpu = c - cpus;
       c->proc = best;
       switchuvm(best);
       best->state = RUNNING;
@@ -409,7 +762,29 @@ scheduler(void)
 
       // Process is done running for now.
       // It should have changed its state before coming back.
+      cpufold();
+      lapicslice(0);
+      best->lastrun = ticks;
       c->proc = 0;
+    } else {
+      // Nothing to run: halt until an interrupt, with the tick
+      // stopped for as long as nothing needs it (tickless idle).
+      // Interrupts stay off until the hlt, so a kickidle() after
+      // the lock is released still wakes us.
+      n = nohzticks(c);
+      c->halted = 1;
+      c->parked = parked(c - cpus);
+      c->nohz = n > 1;
+      lapicnohz(c->nohz ? n : 0);
+      pushcli();
+      release(&ptable.lock);
+      asm volatile("sti; hlt; cli");
+      c->halted = 0;
+      c->parked = 0;
+      c->nohz = 0;
+      lapicnohz(0);
+      popcli();
+      continue;
     }
     release(&ptable.lock);
 
@@ -437,17 +812,33 @@ sched(void)
     panic("sched running");
   if(readeflags()&FL_IF)
     panic("sched interruptible");
+  pelt(p, 1);
+  if(p->state == SLEEPING){
+    p->nvcsw++;
+    p->vratio += (SCHED_LOAD - p->vratio) / 8;
+  } else if(p->state == RUNNABLE){
+    p->nivcsw++;
+    p->vratio -= p->vratio / 8;
+  }
+  classify(p);
+  p->boost = 0;                  // one burst only
   intena = mycpu()->intena;
   swtch(&p->context, mycpu()->scheduler);
   mycpu()->intena = intena;
 }
 
-// Give up the CPU for one scheduling round.
+// Give up the CPU for one scheduling round.  If the process has
+// been moved to another CPU's queue meanwhile (see thermalpull and
+// setaffinity), wake that CPU should it have halted since.
 void
 yield(void)
 {
+  struct proc *p = myproc();
+
   acquire(&ptable.lock);  //DOC: yieldlock
-  myproc()->state = RUNNABLE;
+  p->state = RUNNABLE;
+  if(p->cpu != cpuid())
+    kickidle(p);
   sched();
   release(&ptable.lock);
 }
@@ -522,7 +913,90 @@ wakeup1(void *chan)
 
   for(p = ptable.proc; p < &ptable.proc[NPROC]; p++)
     if(p->state == SLEEPING && p->chan == chan)
-      p->state = RUNNABLE;
+      makerunnable(p);
+}
+
+// Make a sleeping or new process runnable and queue it.
+// The ptable lock must be held.
+static void
+makerunnable(struct proc *p)
+{
+  pelt(p, 0);
+  classify(p);
+  placeproc(p);
+  p->state = RUNNABLE;
+  kickidle(p);
+  wakepreempt(p);
+}
+
+// p has woken: if its CPU is running idle-class work, or p is
+// interactive, boosted or latency-critical and its CPU is running
+// something less urgent, preempt that rather than wait for the time
+// slice to end.
+// The ptable lock must be held.
+static void
+wakepreempt(struct proc *p)
+{
+  struct cpu *c;
+  struct proc *cur;
+
+  c = &cpus[p->cpu];
+  cur = c->proc;
+  if(cur == 0 || p->qos == QOS_IDLE)
+    return;
+  if(cur->qos != QOS_IDLE){
+    if(p->class != CLASS_INTERACTIVE && !p->boost && p->qos != QOS_LATENCY)
+      return;
+    if(cur->class == CLASS_INTERACTIVE || cur->qos == QOS_LATENCY ||
+       prio(cur) < prio(p))
+      return;
+  }
+  c->preempt = 1;
+  pushcli();
+  if(c != mycpu())
+    lapickick(c->apicid);
+  popcli();
+}
+
+// p has become runnable: wake its CPU if that is halted, or else
+// any halted CPU, which will take p from the busy one (see steal),
+// or else any CPU running idle-class work.
+// I/O-bound, batch and idle processes are not worth waking another
+// CPU for: they wait for their own CPU, batched with whatever else
+// runs there.
+// Also wake CPU 0 if its tick is stopped, since time must advance
+// while anything runs.
+static void
+kickidle(struct proc *p)
+{
+  struct cpu *c, *me, *home;
+  int kicked;
+
+  pushcli();
+  me = mycpu();
+  home = &cpus[p->cpu];
+  kicked = 0;
+  if(home != me && home->halted){
+    lapickick(home->apicid);
+    kicked = 1;
+  }
+  for(c = cpus; c < &cpus[ncpu]; c++){
+    if(c == me || c == home || !c->halted || c->parked)
+      continue;
+    if((!kicked && !batchy(p)) || (c == cpus && c->nohz)){
+      lapickick(c->apicid);
+      kicked = 1;
+    }
+  }
+  // Failing a halted CPU, one running only idle-class work will do.
+  for(c = cpus; c < &cpus[ncpu] && !kicked && !batchy(p); c++){
+    if(c == me || c == home || c->proc == 0 || c->proc->qos != QOS_IDLE)
+      continue;
+    c->preempt = 1;
+    lapickick(c->apicid);
+    kicked = 1;
+  }
+  popcli();
 }
 
 // Wake up all processes sleeping on chan.
@@ -534,6 +1008,58 @@ wakeup(void *chan)
   release(&ptable.lock);
 }
 
+// Wake up the processes reading the console, which sleep on chan,
+// noting that they are interactive.  Each is boosted by tty_boost
+// priority levels and preempts what its CPU is running, so that a
+// shell answers at once even behind CPU hogs of equal priority.
+// The boost lasts until it next leaves the CPU.
+void
+ttywakeup(void *chan)
+{
+  struct proc *p;
+
+  acquire(&ptable.lock);
+  for(p = ptable.proc; p < &ptable.proc[NPROC]; p++)
+    if(p->state == SLEEPING && p->chan == chan){
+      p->ttywake = ticks;
+      p->boost = spas.tty_boost;
+      makerunnable(p);
+    }
+  release(&ptable.lock);
+}
+
+// A throttled group's quota has been refilled: get CPUs to run its
+// waiting processes.
+void
+groupkick(int g)
+{
+  struct proc *p;
+
+  acquire(&ptable.lock);
+  for(p = ptable.proc; p < &ptable.proc[NPROC]; p++)
+    if(p->state == RUNNABLE && p->group == g)
+      kickidle(p);
+  release(&ptable.lock);
+}
+
+// Count the processes of each class that were running, waiting to
+// run or ran in the last analytics period, for the governor.
+void
+classcount(int *n)
+{
+  struct proc *p;
+  int i;
+
+  for(i = 0; i < NCLASS; i++)
+    n[i] = 0;
+  acquire(&ptable.lock);
+  for(p = ptable.proc; p < &ptable.proc[NPROC]; p++)
+    if(p->state == RUNNABLE || p->state == RUNNING ||
+       (p->state == SLEEPING && ticks - p->lastrun < spas.load_period))
+      n[p->class]++;
+  release(&ptable.lock);
+}
+
 // Kill the process with the given pid.
 // Process won't exit until it returns
 // to user space (see trap in trap.c).
@@ -548,7 +1074,111 @@ kill(int pid)
       p->killed = 1;
       // Wake process from sleep if necessary.
       if(p->state == SLEEPING)
-        p->state = RUNNABLE;
+        makerunnable(p);
+      release(&ptable.lock);
+      return 0;
+    }
+  }
+  release(&ptable.lock);
+  return -1;
+}
+
+// Restrict the process with the given pid, or the caller if pid is
+// 0, to the CPUs in mask.  If it is queued elsewhere it moves now;
+// if it is running on another CPU outside the mask, that CPU is made
+// to preempt it.
+int
+setaffinity(int pid, uint mask)
+{
+  struct proc *p, *me;
+  struct cpu *c;
+
+  mask &= ALLCPUS;
+  if(mask == 0)
+    return -1;
+  me = myproc();
+  acquire(&ptable.lock);
+  for(p = ptable.proc; p < &ptable.proc[NPROC]; p++){
+    if(p->state == UNUSED || p->pid != (pid ? pid : me->pid))
+      continue;
+    p->affinity = mask;
+    if(!allowed(p, p->cpu)){
+      placeproc(p);
+      if(p->state == RUNNABLE)
+        kickidle(p);
+    }
+    if(p->state == RUNNING && p != me && !allowed(p, p->lastcpu)){
+      c = &cpus[p->lastcpu];
+      c->preempt = 1;
+      lapickick(c->apicid);
+    }
+    release(&ptable.lock);
+    if(p == me && !allowed(p, p->lastcpu))
+      yield();
+    return 0;
+  }
+  release(&ptable.lock);
+  return -1;
+}
+
+// Move pid, or the caller if pid is 0, into CPU bandwidth group g.
+int
+setgroup(int pid, int g)
+{
+  struct proc *p, *me;
+
+  if(g < 0 || g >= NGROUP)
+    return -1;
+  me = myproc();
+  acquire(&ptable.lock);
+  for(p = ptable.proc; p < &ptable.proc[NPROC]; p++){
+    if(p->state != UNUSED && p->pid == (pid ? pid : me->pid)){
+      p->group = g;
+      if(p->state == RUNNABLE)
+        kickidle(p);
+      release(&ptable.lock);
+      return 0;
+    }
+  }
+  release(&ptable.lock);
+  return -1;
+}
+
+// Set the QoS class of pid, or of the caller if pid is 0, and return
+// the old one.
+int
+setqos(int pid, int qos)
+{
+  struct proc *p, *me;
+  int old;
+
+  if(qos < 0 || qos >= NQOS)
+    return -1;
+  me = myproc();
+  acquire(&ptable.lock);
+  for(p = ptable.proc; p < &ptable.proc[NPROC]; p++){
+    if(p->state != UNUSED && p->pid == (pid ? pid : me->pid)){
+      old = p->qos;
+      p->qos = qos;
+      release(&ptable.lock);
+      return old;
+    }
+  }
+  release(&ptable.lock);
+  return -1;
+}
+
+// Copy out the affinity mask of pid, or of the caller if pid is 0.
+int
+getaffinity(int pid, uint *mask)
+{
+  struct proc *p, *me;
+
+  me = myproc();
+  acquire(&ptable.lock);
+  for(p = ptable.proc; p < &ptable.proc[NPROC]; p++){
+    if(p->state != UNUSED && p->pid == (pid ? pid : me->pid)){
+      *mask = p->affinity;
       release(&ptable.lock);
       return 0;
     }
@@ -593,3 +1223,147 @@ procdump(void)
     cprintf("\n");
   }
 }
+
+//PAGEBREAK!
+// --- Timer wheel for sys_sleep() ---
+// Sleeping processes wait in a hashed timer wheel: slot
+// t % NWHEEL lists the processes due at ticks t, t+NWHEEL, ...
+// so each tick only one short list is looked at and only the
+// processes that are due are woken.  A deadline may be deferred by
+// up to timer_slack ticks so that nearby ones fall on the same tick.
+// The earliest deadline is cached for wheelnext(): sleepuntil()
+// lowers it, and wheeltick() looks for the next one only once it has
+// passed.  A process leaving the wheel early may leave it too low,
+// which costs no more than a tick taken for nothing.
+// The wheel is protected by tickslock.
+
+#define NWHEEL 64
+
+static struct proc *wheel[NWHEEL];
+static int nwheel;           // Processes in the wheel
+static uint wheelfirst;      // No deadline in the wheel is earlier
+
+static void
+wheelremove(struct proc *p)
+{
+  struct proc **pp;
+
+  for(pp = &wheel[p->wakeat % NWHEEL]; *pp; pp = &(*pp)->wnext)
+    if(*pp == p){
+      *pp = p->wnext;
+      nwheel--;
+      break;
+    }
+  p->wnext = 0;
+  p->onwheel = 0;
+}
+
+// Make p runnable if it is still asleep on chan.
+static void
+wakeproc(struct proc *p, void *chan)
+{
+  acquire(&ptable.lock);
+  if(p->state == SLEEPING && p->chan == chan)
+    makerunnable(p);
+  release(&ptable.lock);
+}
+
+// Sleep until ticks reaches t.  Returns -1 if killed first.
+// Caller holds tickslock.
+int
+sleepuntil(uint t)
+{
+  struct proc *p;
+  uint slack;
+
+  p = myproc();
+  slack = spas.timer_slack;
+  p->wakeat = t + slack - (t + slack) % (slack + 1);
+  if((int)(p->wakeat - ticks) <= 0)
+    return 0;
+  p->wnext = wheel[p->wakeat % NWHEEL];
+  wheel[p->wakeat % NWHEEL] = p;
+  p->onwheel = 1;
+  if(nwheel++ == 0 || (int)(p->wakeat - wheelfirst) < 0)
+    wheelfirst = p->wakeat;
+  while((int)(ticks - t) < 0){
+    if(p->killed){
+      wheelremove(p);
+      return -1;
+    }
+    sleep(&p->wakeat, &tickslock);
+  }
+  if(p->onwheel)
+    wheelremove(p);
+  return 0;
+}
+
+// The earliest deadline in the (non-empty) wheel, after this tick.
+static uint
+wheelscan(void)
+{
+  struct proc *p;
+  uint first;
+  int i;
+
+  first = ticks + 0x7FFFFFFF;
+  for(i = 0; i < NWHEEL; i++)
+    for(p = wheel[i]; p; p = p->wnext)
+      if((int)(p->wakeat - first) < 0)
+        first = p->wakeat;
+  return first;
+}
+
+// Wake the processes due at this tick.  Called by the timer
+// interrupt for every tick, with tickslock held.
+void
+wheeltick(void)
+{
+  struct proc **pp, *p;
+
+  pp = &wheel[ticks % NWHEEL];
+  while((p = *pp) != 0){
+    if(p->wakeat != ticks){
+      pp = &p->wnext;
+      continue;
+    }
+    *pp = p->wnext;
+    p->wnext = 0;
+    p->onwheel = 0;
+    nwheel--;
+    wakeproc(p, &p->wakeat);
+  }
+  if(nwheel > 0 && wheelfirst == ticks)
+    wheelfirst = wheelscan();
+}
+
+// Ticks until the earliest deadline in the wheel, at most n, so
+// that CPU 0 ticks in time for it however long its stride.
+// Caller holds tickslock (but see nohzticks).
+uint
+wheelnext(uint n)
+{
+  if(nwheel == 0)
+    return n;
+  if((int)(wheelfirst - ticks) <= 1)
+    return 1;
+  if(wheelfirst - ticks < n)
+    n = wheelfirst - ticks;
+  return n;
+}
+
+// Number of RUNNABLE and RUNNING processes, for the load averages.
+int
+nrunning(void)
+{
+  struct proc *p;
+  int n;
+
+  n = 0;
+  acquire(&ptable.lock);
+  for(p = ptable.proc; p < &ptable.proc[NPROC]; p++)
+    if(p->state == RUNNABLE || p->state == RUNNING)
+      n++;
+  release(&ptable.lock);
+  return n;
+}
@@ -1,11 +1,3 @@
-// --- Our new scheduler definitions ---
-#define HISTORY_SIZE 10   // Size of our moving average window
-#define LOAD_PERIOD 100   // Calculate load every 100 ticks
-#define QUANTUM_LOW 50    // Time slice for LOW frequency (ticks)
-#define QUANTUM_MEDIUM 100 // Time slice for MEDIUM frequency (ticks)
-#define QUANTUM_HIGH 150  // Time slice for HIGH frequency (ticks)
-// --- End of new definitions ---
-
 // Per-CPU state
 struct cpu {
   uchar apicid;                // Local APIC ID
@@ -16,6 +8,21 @@ struct cpu {
   int ncli;                    // Depth of pushcli nesting.
   int intena;                  // Were interrupts enabled before pushcli?
   struct proc *proc;           // The process running on this cpu or null
+  int idle;                    // Is the scheduler idle on this cpu?
+  uint64 stamp;                // TSC when busy/idle time was last counted
+  uint64 busy_cycles;          // TSC cycles spent running processes
+  uint64 idle_cycles;          // ... and in the scheduler
+  uint busy_kc;                // busy_cycles / 1024, readable by other CPUs
+  uint idle_kc;                // idle_cycles / 1024
+  uint last_busy_kc;           // busy_kc at the last analytics period
+  uint last_idle_kc;           // idle_kc at the last analytics period
+  int stall;                   // Ticks owed to duty-cycle emulation, < 0 if paid ahead
+  int stalling;                // Halted paying them off?
+  int preempt;                 // Has the running process's time slice ended?
+  int halted;                  // Is the scheduler halted for lack of work?
+  int nohz;                    // ... with its tick stopped?
+  int parked;                  // ... and parked by SPAS (see park())?
+  uint nextbalance;            // Tick of the next loadbalance() run
 };
 
 extern struct cpu cpus[NCPU];
@@ -42,10 +49,8 @@ struct context {
 
 enum procstate { UNUSED, EMBRYO, SLEEPING, RUNNABLE, RUNNING, ZOMBIE };
 
-// --- Our new enum definition ---
-// Simulated CPU frequency states
-enum freq_level { LOW, MEDIUM, HIGH };
-// --- End of new enum ---
+// Affinity mask of every CPU present
+#define ALLCPUS ((1 << ncpu) - 1)
 
 // Default priority for new processes (lower value = higher priority)
 #define DEFAULT_PRIORITY 10
@@ -58,11 +63,34 @@ struct proc {
   enum procstate state;        // Process state
   int pid;                     // Process ID
   int priority;                // Process scheduling priority (lower is higher priority)
-  int quantum_remaining;       // Remaining ticks in current time slice
+  int quantum_remaining;       // Length of the current time slice (us)
+  uint energy_mj;              // Simulated energy charged (millijoules)
+  uint energy_uj;              // ... plus this many microjoules
+  uint cenergy_mj;             // Energy of reaped children (millijoules)
+  uint cenergy_uj;             // ... plus this many microjoules
+  uint64 runtime;              // TSC cycles spent running
+  int cpu;                     // CPU whose run queue it is on
+  uint load;                   // Decayed runnable time, out of SCHED_LOAD
+  uint loadstamp;              // Tick load was last brought up to date
+  uint lastrun;                // Tick it last left a CPU
+  int lastcpu;                 // CPU it last ran on, or -1
+  uint migrations;             // Times it ran on a different CPU than before
+  uint affinity;               // Bit i set: may run on CPU i
+  int class;                   // enum proc_class (see spas_classify)
+  uint nvcsw;                  // Times it gave up the CPU to sleep
+  uint nivcsw;                 // Times it was preempted
+  uint vratio;                 // Recent share of switches voluntary, of SCHED_LOAD
+  uint ttywake;                // Tick it last woke from a console read
+  int boost;                   // Priority levels added until it next switches out
+  int qos;                     // QoS class hint (QOS_LATENCY, ...)
+  int group;                   // CPU bandwidth group (see group.c)
   struct proc *parent;         // Parent process
   struct trapframe *tf;        // Trap frame for current syscall
   struct context *context;     // swtch() here to run process
   void *chan;                  // If non-zero, sleeping on chan
+  uint wakeat;                 // Tick sys_sleep() is waiting for
+  int onwheel;                 // Is it in the timer wheel?
+  struct proc *wnext;          // Next in its timer wheel slot
   int killed;                  // If non-zero, have been killed
   struct file *ofile[NOFILE];  // Open files
   struct inode *cwd;           // Current directory
@@ -0,0 +1,323 @@
+// Text pseudo-files for scheduler and process state.
+//
+// All files share major device PROCFS; the minor number picks the
+// file.  init creates them under /dev.  Each read() renders a fresh
+// snapshot into a page and returns the part at the file offset, so
+// cat, grep and friends see ordinary text.  /dev/sysctl also accepts
+// writes of "name=value" (or "name value") lines.
+
+#include "types.h"
+#include "defs.h"
+#include "param.h"
+#include "spinlock.h"
+#include "sleeplock.h"
+#include "fs.h"
+#include "file.h"
+#include "mmu.h"
+#include "spas.h"
+#include "proc.h"
+
+extern struct {
+  struct spinlock lock;
+  struct proc proc[NPROC];
+} ptable;
+extern struct spas spas;
+
+// Output buffer for rendering a file.
+struct pbuf {
+  char *buf;
+  int n;
+};
+
+static void
+pputc(struct pbuf *b, int c)
+{
+  if(b->n < PGSIZE)
+    b->buf[b->n++] = c;
+}
+
+static void
+pputs(struct pbuf *b, char *s)
+{
+  while(*s)
+    pputc(b, *s++);
+}
+
+static void
+pputint(struct pbuf *b, int xx, int sign)
+{
+  char buf[16];
+  int i;
+  uint x;
+
+  if(sign && (sign = xx < 0))
+    x = -xx;
+  else
+    x = xx;
+  i = 0;
+  do{
+    buf[i++] = '0' + x % 10;
+  }while((x /= 10) != 0);
+  if(sign)
+    buf[i++] = '-';
+  while(--i >= 0)
+    pputc(b, buf[i]);
+}
+
+// Print to b. Understands %d, %u, %s, %t (tenths, as "25.3") and
+// %l (a load average in FSHIFT fixed point, as "1.25").
+static void
+pprintf(struct pbuf *b, char *fmt, ...)
+{
+  int i, c, t;
+  uint *argp;
+  char *s;
+
+  argp = (uint*)(void*)(&fmt + 1);
+  for(i = 0; (c = fmt[i] & 0xff) != 0; i++){
+    if(c != '%'){
+      pputc(b, c);
+      continue;
+    }
+    c = fmt[++i] & 0xff;
+    if(c == 0)
+      break;
+    switch(c){
+    case 'd':
+      pputint(b, *argp++, 1);
+      break;
+    case 'u':
+      pputint(b, *argp++, 0);
+      break;
+    case 't':
+      t = *argp++;
+      pputint(b, t / 10, 1);
+      pputc(b, '.');
+      pputint(b, t % 10, 0);
+      break;
+    case 'l':
+      t = *argp++;
+      pputint(b, LOADINT(t), 0);
+      pputc(b, '.');
+      t = LOADFRAC(t);
+      pputc(b, '0' + t / 10);
+      pputc(b, '0' + t % 10);
+      break;
+    case 's':
+      if((s = (char*)*argp++) == 0)
+        s = "(null)";
+      pputs(b, s);
+      break;
+    case '%':
+      pputc(b, '%');
+      break;
+    default:
+      pputc(b, '%');
+      pputc(b, c);
+      break;
+    }
+  }
+}
+
+static void
+schedstat(struct pbuf *b)
+{
+  struct spas_cpu *c;
+  int i;
+
+  acquire(&tickslock);
+  pprintf(b, "load %d\npredicted %d\nfrequency %s\ntemp %t\n",
+          spas.cpu_load, spas.predicted_load, freq_str[spas.frequency],
+          spas.virtual_temp);
+  pprintf(b, "thresh_low_med %d\nthresh_med_high %d\n",
+          spas.thresh_low_med, spas.thresh_med_high);
+  pprintf(b, "switches %u\nthrottled %u\noscillations %d\n",
+          spas.nswitch, spas.nthrottle, spas.oscillation_count);
+  pprintf(b, "loadavg %l %l %l\nnrunning %d\n", spas.loadavg[0],
+          spas.loadavg[1], spas.loadavg[2], spas.nrunning);
+  pprintf(b, "active_cpus %d\n", spas.nactive);
+  pprintf(b, "# cpu governor want freq load energy_mj "
+          "ticks_low ticks_medium ticks_high idle_poll idle_halt idle_park\n");
+  for(i = 0; i < spas.ncpu; i++){
+    c = &spas.cpu[i];
+    pprintf(b, "cpu%d %s %s %s %d %u %u %u %u %u %u %u\n", i,
+            gov_str[c->governor], freq_str[c->want], freq_str[c->freq],
+            c->load, c->energy_mj, c->residency[LOW], c->residency[MEDIUM],
+            c->residency[HIGH], c->idle_residency[IDLE_POLL],
+            c->idle_residency[IDLE_HALT], c->idle_residency[IDLE_PARK]);
+  }
+  release(&tickslock);
+}
+
+// The moving average window, oldest sample first.
+static void
+loadhist(struct pbuf *b)
+{
+  int i;
+
+  acquire(&tickslock);
+  for(i = 0; i < spas.history_size; i++)
+    pprintf(b, "%d\n",
+            spas.load_history[(spas.history_index + i) % spas.history_size]);
+  release(&tickslock);
+}
+
+static void
+procs(struct pbuf *b)
+{
+  static char *states[] = {
+  [UNUSED]    "unused",
+  [EMBRYO]    "embryo",
+  [SLEEPING]  "sleep",
+  [RUNNABLE]  "runble",
+  [RUNNING]   "run",
+  [ZOMBIE]    "zombie"
+  };
+  struct proc *p;
+
+  pprintf(b, "# pid ppid state prio class group cpu load migrations nvcsw "
+          "nivcsw energy_mj child_energy_mj name\n");
+  acquire(&ptable.lock);
+  for(p = ptable.proc; p < &ptable.proc[NPROC]; p++){
+    if(p->state == UNUSED)
+      continue;
+    pprintf(b, "%d %d %s %d %s %d %d %u %u %u %u %u %u %s\n", p->pid,
+            p->parent ? p->parent->pid : 0, states[p->state], p->priority,
+            class_str[p->class], p->group, p->cpu, p->load, p->migrations,
+            p->nvcsw, p->nivcsw, p->energy_mj, p->cenergy_mj, p->name);
+  }
+  release(&ptable.lock);
+}
+
+static void
+thermal(struct pbuf *b)
+{
+  struct spas_cpu *c;
+  int i;
+
+  acquire(&tickslock);
+  pprintf(b, "limit %t\ncritical %t\nambient %t\n", spas.throttle_limit,
+          spas.critical_temp, spas.ambient_temp);
+  pprintf(b, "# cpu temp cap pid_active pid_integral migrations\n");
+  for(i = 0; i < spas.ncpu; i++){
+    c = &spas.cpu[i];
+    pprintf(b, "cpu%d %t %d %d %d %u\n", i, c->temp, c->cap, c->pid_active,
+            c->pid_integral, c->tmigrations);
+  }
+  release(&tickslock);
+}
+
+static void
+sysctl(struct pbuf *b)
+{
+  char *name;
+  int i, val;
+
+  acquire(&tickslock);
+  for(i = 0; (name = spas_tunable(i)) != 0; i++)
+    if(spas_get(&spas, name, &val) == 0)
+      pprintf(b, "%s %d\n", name, val);
+  release(&tickslock);
+}
+
+// Apply one "name=value" or "name value" line.
+static int
+sysctlline(char *line)
+{
+  char *p;
+  int val, r;
+
+  for(p = line; *p && *p != '=' && *p != ' '; p++)
+    ;
+  if(*p == 0)
+    return -1;
+  *p++ = 0;
+  while(*p == ' ')
+    p++;
+  if(*p < '0' || *p > '9')
+    return -1;
+  for(val = 0; *p >= '0' && *p <= '9'; p++)
+    val = val*10 + *p - '0';
+  acquire(&tickslock);
+  r = spas_set(&spas, line, val);
+  release(&tickslock);
+  return r;
+}
+
+// Writers such as echo send a byte at a time, so collect a line
+// before applying it.  A write at offset 0 starts a new line.
+static struct {
+  struct spinlock lock;
+  char line[64];
+  int n;
+} ctl;
+
+static int
+sysctlwrite(char *src, uint off, int n)
+{
+  int i, c, r;
+
+  r = n;
+  acquire(&ctl.lock);
+  if(off == 0)
+    ctl.n = 0;
+  for(i = 0; i < n; i++){
+    c = src[i];
+    if(c == '\n' || c == ';'){
+      ctl.line[ctl.n] = 0;
+      if(ctl.n > 0 && sysctlline(ctl.line) < 0)
+        r = -1;
+      ctl.n = 0;
+    } else if(ctl.n < sizeof(ctl.line) - 1)
+      ctl.line[ctl.n++] = c;
+  }
+  release(&ctl.lock);
+  return r;
+}
+
+static struct {
+  void (*render)(struct pbuf*);
+  int (*write)(char*, uint, int);
+} files[] = {
+[PROCFS_SCHEDSTAT] { schedstat, 0 },
+[PROCFS_LOADHIST]  { loadhist, 0 },
+[PROCFS_PROCS]     { procs, 0 },
+[PROCFS_THERMAL]   { thermal, 0 },
+[PROCFS_SYSCTL]    { sysctl, sysctlwrite },
+};
+
+static int
+procfsread(struct inode *ip, char *dst, uint off, int n)
+{
+  struct pbuf b;
+
+  if(ip->minor < 0 || ip->minor >= NELEM(files))
+    return -1;
+  if((b.buf = kalloc()) == 0)
+    return -1;
+  b.n = 0;
+  files[ip->minor].render(&b);
+  if(off >= b.n)
+    n = 0;
+  else if(n > b.n - off)
+    n = b.n - off;
+  memmove(dst, b.buf + off, n);
+  kfree(b.buf);
+  return n;
+}
+
+static int
+procfswrite(struct inode *ip, char *src, uint off, int n)
+{
+  if(ip->minor < 0 || ip->minor >= NELEM(files) || !files[ip->minor].write)
+    return -1;
+  return files[ip->minor].write(src, off, n);
+}
+
+void
+procfsinit(void)
+{
+  initlock(&ctl.lock, "sysctl");
+  devsw[PROCFS].read = procfsread;
+  devsw[PROCFS].write = procfswrite;
+}
@@ -0,0 +1,34 @@
+#include "types.h"
+#include "stat.h"
+#include "user.h"
+
+char *qos_str[] = { "latency", "default", "batch", "idle" };
+
+int
+main(int argc, char *argv[])
+{
+  struct procinfo pi;
+  int pid, qos;
+
+  if(argc < 2){
+    printf(2, "Usage: qos pid [latency|default|batch|idle]\n");
+    exit();
+  }
+
+  pid = atoi(argv[1]);
+  if(argc == 2){
+    if(procinfo(pid, &pi) < 0){
+      printf(2, "qos: no process %d\n", pid);
+      exit();
+    }
+    printf(1, "%d: %s\n", pid, qos_str[pi.qos]);
+    exit();
+  }
+
+  for(qos = 0; qos < NQOS; qos++)
+    if(strcmp(argv[2], qos_str[qos]) == 0)
+      break;
+  if(qos == NQOS || setqos(pid, qos) < 0)
+    printf(2, "qos failed\n");
+  exit();
+}
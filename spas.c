@@ -0,0 +1,749 @@
+// SPAS policy core.
+//
+// Everything here is a pure function of a struct spas and its
+// inputs: no locks, no globals, no kernel calls.  The kernel runs
+// spas_update() from the timer interrupt (see trap.c) and the host
+// simulator (spassim.c) runs it over recorded or synthetic traces.
+
+#include "types.h"
+#include "param.h"
+#include "spas.h"
+
+// String names for printing
+char *freq_str[] = { "LOW", "MEDIUM", "HIGH" };
+char *idle_str[] = { "poll", "halt", "park" };
+char *class_str[] = { "cpu", "io", "interactive" };
+char *gov_str[] = { "spas", "performance", "powersave", "ondemand",
+                    "conservative" };
+
+// Reset s to the default tunables and an idle, ambient state
+// for ncpu CPUs.
+void
+spas_init(struct spas *s, int ncpu)
+{
+  static struct spas_cpu zero;
+  int i;
+
+  s->history_size = HISTORY_SIZE;
+  s->load_period = LOAD_PERIOD;
+  s->thresh_low_med = 30;       // 30%
+  s->thresh_med_high = 70;      // 70%
+  s->heating_factor = 20;       // 100% load at HIGH adds 2.0 C per period
+  s->heat_scale[LOW] = 40;
+  s->heat_scale[MEDIUM] = 70;
+  s->heat_scale[HIGH] = 100;
+  s->cooling_factor = 5;        // cools by 0.5 C per period
+  s->dissipation = 10;          // plus 1% of the rise above ambient
+  s->coupling = 10;
+  s->throttle_limit = 800;      // hold CPUs under 80.0 C
+  s->critical_temp = 850;       // force LOW above 85.0 C
+  s->ambient_temp = 250;        // 25.0 C
+  s->pid_switch_on = 100;       // engage 10.0 C below the limit
+  s->pid_kp = 64;
+  s->pid_ki = 8;
+  s->pid_kd = 32;
+  s->ondemand_up = 80;
+  s->conservative_up = 80;
+  s->conservative_down = 20;
+  s->busy_power[LOW] = 400;     // mW
+  s->busy_power[MEDIUM] = 900;
+  s->busy_power[HIGH] = 2000;
+  s->idle_power[IDLE_POLL] = 300;
+  s->idle_power[IDLE_HALT] = 80;
+  s->idle_power[IDLE_PARK] = 10;
+  s->quantum[LOW] = QUANTUM_LOW;
+  s->quantum[MEDIUM] = QUANTUM_MEDIUM;
+  s->quantum[HIGH] = QUANTUM_HIGH;
+  s->duty[LOW] = 40;            // LOW runs at 40% of HIGH's speed
+  s->duty[MEDIUM] = 70;
+  s->duty[HIGH] = 100;
+  s->tick_stride[LOW] = 4;      // 25 Hz
+  s->tick_stride[MEDIUM] = 2;
+  s->tick_stride[HIGH] = 1;     // 100 Hz
+  s->timer_slack = 0;
+  s->overload = 200;            // two runnable processes per CPU
+  s->balance_interval = 4;
+  s->balance_pct = 25;
+  s->cache_hot = 2;
+  s->affinity_pct = 100;        // one always-runnable process
+  s->park_util = 70;
+  s->thermal_margin = 150;      // act 15.0 C below the limit,
+  s->thermal_delta = 100;       // moving work 10.0 C cooler
+  s->cpu_quantum_pct = 200;
+  s->interactive_ticks = 300;   // 3 seconds
+  s->tty_boost = 5;
+  s->qos_quantum[QOS_LATENCY] = 50;
+  s->qos_quantum[QOS_DEFAULT] = 100;
+  s->qos_quantum[QOS_BATCH] = 300;
+  s->qos_quantum[QOS_IDLE] = 300;
+  s->oscillation_window = 1000; // 10 seconds
+  s->max_oscillation = 5;
+  s->adaptation_period = 5000;
+
+  if(ncpu < 1)
+    ncpu = 1;
+  if(ncpu > NCPU)
+    ncpu = NCPU;
+  s->ncpu = ncpu;
+  for(i = 0; i < NCPU; i++){
+    s->cpu[i] = zero;
+    s->cpu[i].temp = s->ambient_temp;
+    s->cpu[i].governor = GOV_SPAS;
+    s->cpu[i].want = LOW;
+    s->cpu[i].freq = LOW;
+    s->cpu[i].cap = CAP_MAX;
+  }
+  s->cpu_load = 0;
+  s->predicted_load = 0;
+  for(i = 0; i < MAXHISTORY; i++)
+    s->load_history[i] = 0;
+  s->history_index = 0;
+  s->frequency = LOW;
+  s->prev_frequency = LOW;
+  s->virtual_temp = s->ambient_temp;
+  s->oscillation_count = 0;
+  s->last_switch_tick = 0;
+  s->adaptation_counter = 0;
+  s->nswitch = 0;
+  s->nthrottle = 0;
+  s->nrunning = 0;
+  for(i = 0; i < 3; i++)
+    s->loadavg[i] = 0;
+  s->nactive = ncpu;
+  for(i = 0; i < NCLASS; i++)
+    s->nclass[i] = 0;
+}
+
+// Percentage of busy time out of total, in any unit.  Long periods
+// of kilocycles are scaled down first so that busy * 100 fits.
+int
+spas_load(uint busy, uint total)
+{
+  while(busy > 0xFFFFFFFF / 100){
+    busy >>= 1;
+    total >>= 1;
+  }
+  if(total == 0)
+    return 0;
+  return (busy * 100) / total;
+}
+
+// --- Phase 4: Virtual Thermal Model ---
+// Each CPU heats in proportion to its load and to the frequency it
+// ran at, loses a constant amount plus a fraction of its rise above
+// ambient, and exchanges heat with its neighbours i-1 and i+1.
+static void
+thermal(struct spas *s)
+{
+  int i, old[NCPU];
+  struct spas_cpu *c;
+
+  for(i = 0; i < s->ncpu; i++)
+    old[i] = s->cpu[i].temp;
+  s->virtual_temp = s->ambient_temp;
+  for(i = 0; i < s->ncpu; i++){
+    c = &s->cpu[i];
+    c->temp += c->load * s->heating_factor * s->heat_scale[c->freq] / 10000;
+    c->temp -= s->cooling_factor;
+    c->temp -= (old[i] - s->ambient_temp) * s->dissipation / 1000;
+    if(i > 0)
+      c->temp += (old[i-1] - old[i]) * s->coupling / 100;
+    if(i < s->ncpu - 1)
+      c->temp += (old[i+1] - old[i]) * s->coupling / 100;
+    if(c->temp < s->ambient_temp)
+      c->temp = s->ambient_temp;
+    if(c->temp > s->virtual_temp)
+      s->virtual_temp = c->temp;
+  }
+}
+
+// Recompute c's frequency cap from its distance to throttle_limit.
+// The controller idles at CAP_MAX until the CPU comes within
+// pid_switch_on of the limit, then starts with its integral preloaded
+// so that the cap falls smoothly from CAP_MAX instead of jumping.
+static void
+pid(struct spas *s, struct spas_cpu *c)
+{
+  int err, integral, out;
+
+  err = s->throttle_limit - c->temp;
+  if(!c->pid_active){
+    if(err > s->pid_switch_on){
+      c->cap = CAP_MAX;
+      return;
+    }
+    c->pid_active = 1;
+    c->pid_prev_err = err;
+    c->pid_integral = 0;
+    if(s->pid_ki)
+      c->pid_integral = ((CAP_MAX << PID_SHIFT) - s->pid_kp * err) / s->pid_ki;
+  } else if(err > s->pid_switch_on && c->cap >= CAP_MAX){
+    c->pid_active = 0;
+    c->cap = CAP_MAX;
+    return;
+  }
+
+  integral = c->pid_integral + err;
+  out = (s->pid_kp * err + s->pid_ki * integral +
+         s->pid_kd * (err - c->pid_prev_err)) / (1 << PID_SHIFT);
+  // Don't wind up the integral while the output is saturated.
+  if((out < CAP_MAX || err < 0) && (out > 0 || err > 0))
+    c->pid_integral = integral;
+  if(out > CAP_MAX)
+    out = CAP_MAX;
+  if(out < 0)
+    out = 0;
+  c->cap = out;
+  c->pid_prev_err = err;
+}
+
+// Highest level allowed by c's cap, at most want.  The fractional
+// part of the cap is dithered over successive periods, so a cap of
+// 1.5 levels alternates MEDIUM and HIGH rather than sitting at MEDIUM.
+static enum freq_level
+capped(struct spas *s, struct spas_cpu *c, enum freq_level want)
+{
+  int level;
+
+  if(c->temp > s->critical_temp)
+    return LOW;
+  level = c->cap >> CAP_SHIFT;
+  c->dither += c->cap & (CAP_ONE - 1);
+  if(c->dither >= CAP_ONE){
+    c->dither -= CAP_ONE;
+    level++;
+  }
+  if(level < want)
+    return level;
+  return want;
+}
+// --- Thermal migration ---
+// Rather than wait for a CPU to be throttled, the scheduler moves its
+// CPU-bound work to a cooler CPU, so that the heat source rotates
+// around the package and the aggregate frequency stays higher.
+
+// Is cpu within thermal_margin of throttle_limit?
+int
+spas_hot(struct spas *s, int cpu)
+{
+  return s->cpu[cpu].temp >= s->throttle_limit - s->thermal_margin;
+}
+
+// The CPU that cpu should take CPU-bound work from: the hottest hot
+// CPU that is at least thermal_delta hotter than cpu and has not yet
+// given up a process this period; or -1 if cpu is hot itself or
+// there is none.
+int
+spas_thermal_source(struct spas *s, int cpu)
+{
+  int i, src;
+
+  if(s->thermal_margin == 0 || spas_hot(s, cpu))
+    return -1;
+  src = -1;
+  for(i = 0; i < s->ncpu; i++){
+    if(!spas_hot(s, i) || s->cpu[i].tmoved ||
+       s->cpu[i].temp - s->cpu[cpu].temp < s->thermal_delta)
+      continue;
+    if(src < 0 || s->cpu[i].temp > s->cpu[src].temp)
+      src = i;
+  }
+  return src;
+}
+
+// --- End Phase 4 ---
+
+// --- Frequency governors ---
+// Each picks the level a CPU should run at for the next period,
+// before thermal capping.  They run after the SPAS prediction has
+// been updated, so s->frequency is this period's predictive choice.
+
+// The predictive policy: the system-wide moving average against
+// the adaptive thresholds.
+static enum freq_level
+gov_spas(struct spas *s, struct spas_cpu *c)
+{
+  return s->frequency;
+}
+
+static enum freq_level
+gov_performance(struct spas *s, struct spas_cpu *c)
+{
+  return HIGH;
+}
+
+static enum freq_level
+gov_powersave(struct spas *s, struct spas_cpu *c)
+{
+  return LOW;
+}
+
+// Jump to HIGH when this CPU's last load exceeds ondemand_up,
+// otherwise pick the level proportional to the load.
+static enum freq_level
+gov_ondemand(struct spas *s, struct spas_cpu *c)
+{
+  if(c->load > s->ondemand_up)
+    return HIGH;
+  return c->load * HIGH / s->ondemand_up;
+}
+
+// Move at most one level per period, up above conservative_up
+// and down below conservative_down.
+static enum freq_level
+gov_conservative(struct spas *s, struct spas_cpu *c)
+{
+  if(c->load > s->conservative_up && c->want < HIGH)
+    return c->want + 1;
+  if(c->load < s->conservative_down && c->want > LOW)
+    return c->want - 1;
+  return c->want;
+}
+
+static enum freq_level (*governors[])(struct spas*, struct spas_cpu*) = {
+[GOV_SPAS]         gov_spas,
+[GOV_PERFORMANCE]  gov_performance,
+[GOV_POWERSAVE]    gov_powersave,
+[GOV_ONDEMAND]     gov_ondemand,
+[GOV_CONSERVATIVE] gov_conservative,
+};
+
+// Select governor gov for cpu, or for every CPU if cpu is -1.
+// Returns -1 if either is out of range.
+int
+spas_setgov(struct spas *s, int cpu, int gov)
+{
+  int i;
+
+  if(gov < 0 || gov >= NGOV || cpu < -1 || cpu >= s->ncpu)
+    return -1;
+  for(i = 0; i < s->ncpu; i++)
+    if(cpu == -1 || cpu == i)
+      s->cpu[i].governor = gov;
+  return 0;
+}
+
+static int
+streq(char *a, char *b)
+{
+  while(*a && *a == *b)
+    a++, b++;
+  return *a == *b;
+}
+
+// Governor number for name, or -1.
+int
+spas_govbyname(char *name)
+{
+  int i;
+
+  for(i = 0; i < NGOV; i++)
+    if(streq(name, gov_str[i]))
+      return i;
+  return -1;
+}
+// --- End of governors ---
+
+// --- Core parking ---
+// Choose how many CPUs to keep taking work, so that the forecast
+// load packed onto them comes to about park_util percent each; the
+// scheduler leaves the others halted in IDLE_PARK.  The forecast is
+// the moving average, or if load is rising, the last period's load
+// plus the same rise again, so CPUs are unparked a period ahead.
+// CPUs are unparked all at once but parked one per period.
+static void
+park(struct spas *s)
+{
+  int demand, n;
+
+  if(s->park_util == 0){
+    s->nactive = s->ncpu;
+    return;
+  }
+  demand = s->predicted_load;
+  if(s->cpu_load > demand)
+    demand = 2 * s->cpu_load - demand;
+  demand *= s->ncpu;                   // percent of one CPU
+  n = (demand + s->park_util - 1) / s->park_util;
+  if(n < 1)
+    n = 1;
+  if(n > s->ncpu)
+    n = s->ncpu;
+  if(n < s->nactive - 1)
+    n = s->nactive - 1;
+  s->nactive = n;
+}
+
+// Feed one period's per-CPU loads (0-100, s->ncpu entries) observed
+// at tick now into the policy and recompute prediction, temperatures,
+// frequencies and thresholds.
+void
+spas_update(struct spas *s, int *load, uint now)
+{
+  int i, total_load;
+  enum freq_level next_frequency;
+  struct spas_cpu *c;
+
+  total_load = 0;
+  for(i = 0; i < s->ncpu; i++){
+    s->cpu[i].load = load[i];
+    total_load += load[i];
+  }
+  s->cpu_load = total_load / s->ncpu;
+
+  // --- Phase 4: Update Virtual Temperatures ---
+  thermal(s);
+
+  // Update Moving Average History
+  s->load_history[s->history_index] = s->cpu_load;
+  s->history_index = (s->history_index + 1) % s->history_size;
+
+  // Calculate Predicted Load (Moving Average)
+  total_load = 0;
+  for(i = 0; i < s->history_size; i++)
+    total_load += s->load_history[i];
+  s->predicted_load = total_load / s->history_size;
+
+  // Dynamic Frequency Simulation (based on predicted load)
+  if(s->predicted_load > s->thresh_med_high)
+    next_frequency = HIGH;
+  else if(s->predicted_load > s->thresh_low_med)
+    next_frequency = MEDIUM;
+  else
+    next_frequency = LOW;
+  // Busy percentages saturate at 100; a deep runqueue means the
+  // CPUs are more overloaded than they show, so step up a level.
+  if(s->overload > 0 && next_frequency < HIGH &&
+     s->loadavg[0] * 100 > s->overload * s->ncpu * FIXED_1)
+    next_frequency++;
+  // I/O-bound work gains little from a faster clock, so without
+  // CPU-bound work stop at MEDIUM; interactive work gets at least
+  // MEDIUM so that it responds quickly.
+  if(s->nclass[CLASS_CPU] == 0 && s->nclass[CLASS_IO] > 0 &&
+     next_frequency > MEDIUM)
+    next_frequency = MEDIUM;
+  if(s->nclass[CLASS_INTERACTIVE] > 0 && next_frequency < MEDIUM)
+    next_frequency = MEDIUM;
+  s->frequency = next_frequency;
+  park(s);
+
+  // Per-CPU governor choice, then Phase 4 thermal capping
+  for(i = 0; i < s->ncpu; i++){
+    c = &s->cpu[i];
+    c->tmoved = 0;
+    c->want = governors[c->governor](s, c);
+    // A latency-critical process ran here: honour its request for
+    // speed, whatever the load, unless the governor is powersave.
+    if(c->want < c->floor && c->governor != GOV_POWERSAVE)
+      c->want = c->floor;
+    c->floor = LOW;
+    pid(s, c);
+    c->freq = capped(s, c, c->want);
+    if(c->freq < c->want)
+      s->nthrottle++;
+  }
+
+  // --- Phase 5: Adaptive Thresholds ---
+  // Check for frequency change (oscillation detection)
+  if(s->frequency != s->prev_frequency){
+    s->oscillation_count++;
+    s->nswitch++;
+    s->last_switch_tick = now;
+    s->prev_frequency = s->frequency;
+  }
+
+  // Reset oscillation count if window expired
+  if(now - s->last_switch_tick > s->oscillation_window)
+    s->oscillation_count = 0;
+
+  // Adaptive logic: widen thresholds if oscillating
+  if(s->oscillation_count >= s->max_oscillation){
+    s->thresh_low_med += 5;
+    s->thresh_med_high += 5;
+    if(s->thresh_med_high > 90)
+      s->thresh_med_high = 90;
+    if(s->thresh_low_med > s->thresh_med_high - 10)
+      s->thresh_low_med = s->thresh_med_high - 10;
+    s->oscillation_count = 0;  // Reset after adaptation
+  }
+
+  // Periodic tuning: narrow thresholds if stable and low load
+  s->adaptation_counter++;
+  if(s->adaptation_counter >= s->adaptation_period / s->load_period){
+    s->adaptation_counter = 0;
+    if(s->oscillation_count == 0 && s->predicted_load < 20){
+      s->thresh_low_med = s->thresh_low_med > 20 ? s->thresh_low_med - 2 : 20;
+      s->thresh_med_high = s->thresh_med_high > 40 ? s->thresh_med_high - 2 : 40;
+    }
+  }
+}
+
+// --- Runqueue load averages ---
+// Exponentially decayed averages of the number of runnable
+// processes over 1, 5 and 15 minutes, updated every LOADAVG_PERIOD
+// ticks: avg = avg * e + n * (1 - e), with e = exp(-5s / 1, 5, 15 min).
+static uint loadexp[3] = { 1884, 2014, 2037 };
+
+void
+spas_loadavg(struct spas *s, int nrunning)
+{
+  int i;
+
+  s->nrunning = nrunning;
+  for(i = 0; i < 3; i++)
+    s->loadavg[i] = (s->loadavg[i] * loadexp[i] +
+                     nrunning * FIXED_1 * (FIXED_1 - loadexp[i])) >> FSHIFT;
+}
+
+// --- Per-task load tracking ---
+// A process's load is the fraction of recent ticks it spent runnable
+// (running or waiting to run), each tick weighted by y^age where
+// y^PELT_HALFLIFE = 1/2, scaled to SCHED_LOAD.  It is brought up to
+// date lazily: n ticks later, load = load * y^n, plus
+// SCHED_LOAD * (1 - y^n) if the process was runnable throughout.
+
+// y^k for k < PELT_HALFLIFE, in 1/65536ths.
+static uint pelt_y[PELT_HALFLIFE] = {
+  65536, 64132, 62757, 61413, 60097, 58809, 57549, 56316,
+  55109, 53928, 52773, 51642, 50535, 49452, 48393, 47356,
+  46341, 45348, 44376, 43425, 42495, 41584, 40693, 39821,
+  38968, 38133, 37316, 36516, 35734, 34968, 34219, 33486,
+};
+
+static uint
+pelt_decay(uint load, uint n)
+{
+  if(n >= 32 * PELT_HALFLIFE)
+    return 0;
+  load >>= n / PELT_HALFLIFE;
+  return (load * pelt_y[n % PELT_HALFLIFE]) >> 16;
+}
+
+uint
+spas_pelt(uint load, uint n, int runnable)
+{
+  if(n == 0)
+    return load;
+  load = pelt_decay(load, n);
+  if(runnable)
+    load += SCHED_LOAD - pelt_decay(SCHED_LOAD, n);
+  return load;
+}
+
+// --- Workload classification ---
+// A process that woke from a console read in the last
+// interactive_ticks, and is not using much CPU, is interactive.
+// Otherwise it is CPU-bound if it has been runnable most of the time
+// (load) and mostly gives up the CPU only when preempted (vratio, the
+// recent fraction of its switches that were voluntary, out of
+// SCHED_LOAD), and I/O-bound if not.
+enum proc_class
+spas_classify(struct spas *s, uint load, uint vratio, uint sincetty)
+{
+  if(sincetty < s->interactive_ticks && load < CPUBOUND_LOAD)
+    return CLASS_INTERACTIVE;
+  if(load >= CPUBOUND_LOAD && vratio < SCHED_LOAD / 2)
+    return CLASS_CPU;
+  return CLASS_IO;
+}
+
+// --- Energy accounting ---
+
+// Add add microjoules to the counter kept as *mj millijoules
+// plus *uj microjoules.
+void
+spas_charge(uint *mj, uint *uj, uint add)
+{
+  *uj += add;
+  *mj += *uj / 1000;
+  *uj %= 1000;
+}
+
+// Account busy ticks at cpu's current level and idle ticks in
+// idle state st to cpu's energy and residency counters.
+void
+spas_account(struct spas *s, int cpu, uint busy, uint idle, enum idle_state st)
+{
+  struct spas_cpu *c;
+
+  c = &s->cpu[cpu];
+  c->residency[c->freq] += busy;
+  c->idle_residency[st] += idle;
+  spas_charge(&c->energy_mj, &c->energy_uj,
+              (busy * s->busy_power[c->freq] + idle * s->idle_power[st]) *
+              TICK_MS);
+}
+
+// Duty-cycle frequency emulation.  Called for every tick cpu spent
+// running a process, not for ticks it spent halted paying off
+// earlier shortfall; returns the number of whole ticks the accrued
+// shortfall of the current level has reached, which the caller
+// should then spend halted.  Each tick run owes (100 - duty[f]) /
+// duty[f] ticks halted, so over time a busy CPU at level f runs for
+// duty[f] percent of the time.
+int
+spas_stall(struct spas *s, int cpu)
+{
+  struct spas_cpu *c;
+  int n;
+
+  c = &s->cpu[cpu];
+  c->stall_credit += 100 - s->duty[c->freq];
+  for(n = 0; c->stall_credit >= s->duty[c->freq]; n++)
+    c->stall_credit -= s->duty[c->freq];
+  c->stalled += n;
+  return n;
+}
+
+// --- Runtime tunables ---
+
+#define OFF(f) __builtin_offsetof(struct spas, f)
+
+static struct tunable {
+  char *name;
+  int off;       // Offset of the int in struct spas
+  int min, max;
+} tunables[] = {
+  { "history_size",      OFF(history_size),       1, MAXHISTORY },
+  { "load_period",       OFF(load_period),        1, 10000 },
+  { "thresh_low_med",    OFF(thresh_low_med),     0, 100 },
+  { "thresh_med_high",   OFF(thresh_med_high),    0, 100 },
+  { "heating_factor",    OFF(heating_factor),     0, 1000 },
+  { "heat_scale_low",    OFF(heat_scale[LOW]),    0, 1000 },
+  { "heat_scale_medium", OFF(heat_scale[MEDIUM]), 0, 1000 },
+  { "heat_scale_high",   OFF(heat_scale[HIGH]),   0, 1000 },
+  { "cooling_factor",    OFF(cooling_factor),     0, 1000 },
+  { "dissipation",       OFF(dissipation),        0, 1000 },
+  { "coupling",          OFF(coupling),           0, 50 },
+  { "throttle_limit",    OFF(throttle_limit),     0, 2000 },
+  { "critical_temp",     OFF(critical_temp),      0, 2000 },
+  { "ambient_temp",      OFF(ambient_temp),       0, 1000 },
+  { "pid_switch_on",     OFF(pid_switch_on),      0, 1000 },
+  { "pid_kp",            OFF(pid_kp),             0, 10000 },
+  { "pid_ki",            OFF(pid_ki),             0, 10000 },
+  { "pid_kd",            OFF(pid_kd),             0, 10000 },
+  { "oscillation_window", OFF(oscillation_window), 1, 1000000 },
+  { "max_oscillation",   OFF(max_oscillation),    1, 1000 },
+  { "adaptation_period", OFF(adaptation_period),  1, 1000000 },
+  { "ondemand_up",       OFF(ondemand_up),        1, 100 },
+  { "conservative_up",   OFF(conservative_up),    0, 100 },
+  { "conservative_down", OFF(conservative_down),  0, 100 },
+  { "busy_power_low",    OFF(busy_power[LOW]),    0, 100000 },
+  { "busy_power_medium", OFF(busy_power[MEDIUM]), 0, 100000 },
+  { "busy_power_high",   OFF(busy_power[HIGH]),   0, 100000 },
+  { "idle_power_poll",   OFF(idle_power[IDLE_POLL]), 0, 100000 },
+  { "idle_power_halt",   OFF(idle_power[IDLE_HALT]), 0, 100000 },
+  { "idle_power_park",   OFF(idle_power[IDLE_PARK]), 0, 100000 },
+  { "quantum_low",       OFF(quantum[LOW]),       100, 1000000 },
+  { "quantum_medium",    OFF(quantum[MEDIUM]),    100, 1000000 },
+  { "quantum_high",      OFF(quantum[HIGH]),      100, 1000000 },
+  { "duty_low",          OFF(duty[LOW]),          1, 100 },
+  { "duty_medium",       OFF(duty[MEDIUM]),       1, 100 },
+  { "duty_high",         OFF(duty[HIGH]),         1, 100 },
+  { "tick_stride_low",   OFF(tick_stride[LOW]),   1, 10 },
+  { "tick_stride_medium", OFF(tick_stride[MEDIUM]), 1, 10 },
+  { "tick_stride_high",  OFF(tick_stride[HIGH]),  1, 10 },
+  { "timer_slack",       OFF(timer_slack),        0, 100 },
+  { "overload",          OFF(overload),           0, 10000 },
+  { "balance_interval",  OFF(balance_interval),   0, 1000 },
+  { "balance_pct",       OFF(balance_pct),        1, 400 },
+  { "cache_hot",         OFF(cache_hot),          0, 100 },
+  { "affinity_pct",      OFF(affinity_pct),       0, 1000 },
+  { "park_util",         OFF(park_util),          0, 100 },
+  { "thermal_margin",    OFF(thermal_margin),     0, 1000 },
+  { "thermal_delta",     OFF(thermal_delta),      0, 1000 },
+  { "cpu_quantum_pct",   OFF(cpu_quantum_pct),    10, 1000 },
+  { "interactive_ticks", OFF(interactive_ticks),  0, 100000 },
+  { "tty_boost",         OFF(tty_boost),          0, 20 },
+  { "qos_quantum_latency", OFF(qos_quantum[QOS_LATENCY]), 10, 1000 },
+  { "qos_quantum_default", OFF(qos_quantum[QOS_DEFAULT]), 10, 1000 },
+  { "qos_quantum_batch", OFF(qos_quantum[QOS_BATCH]), 10, 1000 },
+  { "qos_quantum_idle",  OFF(qos_quantum[QOS_IDLE]),  10, 1000 },
+};
+
+#define NTUNABLE (sizeof(tunables)/sizeof(tunables[0]))
+
+static struct tunable*
+lookup(char *name)
+{
+  struct tunable *t;
+
+  for(t = tunables; t < &tunables[NTUNABLE]; t++)
+    if(streq(name, t->name))
+      return t;
+  return 0;
+}
+
+// Tunables that constrain each other.
+static int
+consistent(struct spas *s)
+{
+  return s->thresh_low_med < s->thresh_med_high &&
+         s->conservative_down < s->conservative_up &&
+         s->ambient_temp < s->throttle_limit &&
+         s->throttle_limit <= s->critical_temp;
+}
+
+// Change the moving average window to n entries, keeping the
+// most recent samples and padding a larger window with the current
+// prediction so the average doesn't jump.
+static void
+resize_history(struct spas *s, int n)
+{
+  int old[MAXHISTORY], i, keep;
+
+  for(i = 0; i < s->history_size; i++)
+    old[i] = s->load_history[(s->history_index + i) % s->history_size];
+  keep = n < s->history_size ? n : s->history_size;
+  for(i = 0; i < n - keep; i++)
+    s->load_history[i] = s->predicted_load;
+  for(; i < n; i++)
+    s->load_history[i] = old[s->history_size - n + i];
+  s->history_index = 0;
+  s->history_size = n;
+}
+
+// Name of the i'th tunable, or 0 past the end.
+char*
+spas_tunable(int i)
+{
+  if(i < 0 || i >= NTUNABLE)
+    return 0;
+  return tunables[i].name;
+}
+
+int
+spas_get(struct spas *s, char *name, int *val)
+{
+  struct tunable *t;
+
+  if((t = lookup(name)) == 0)
+    return -1;
+  *val = *(int*)((char*)s + t->off);
+  return 0;
+}
+
+// Set tunable name to val.  Returns -1, changing nothing, if the
+// name is unknown, val is out of range, or the result would leave
+// related tunables inconsistent.
+int
+spas_set(struct spas *s, char *name, int val)
+{
+  struct tunable *t;
+  int *p, old;
+
+  if((t = lookup(name)) == 0 || val < t->min || val > t->max)
+    return -1;
+  p = (int*)((char*)s + t->off);
+  if(p == &s->history_size){
+    resize_history(s, val);
+    return 0;
+  }
+  old = *p;
+  *p = val;
+  if(!consistent(s)){
+    *p = old;
+    return -1;
+  }
+  return 0;
+}
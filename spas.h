@@ -0,0 +1,161 @@
+// SPAS policy: load prediction, simulated frequency selection,
+// virtual thermal model and adaptive thresholds.
+//
+// This header and spas.c use nothing but plain C so that the same
+// policy code is linked into the kernel and into the host-side
+// simulator (spassim.c).  Include types.h and param.h first.
+
+#define HISTORY_SIZE 10   // Default size of the moving average window
+#define MAXHISTORY   64   // Largest moving average window supported
+#define LOAD_PERIOD 100   // Calculate load every 100 ticks
+#define QUANTUM_LOW 5000  // Default time slice at LOW frequency (us)
+#define QUANTUM_MEDIUM 10000 // Default time slice at MEDIUM frequency (us)
+#define QUANTUM_HIGH 15000 // Default time slice at HIGH frequency (us)
+
+// Simulated CPU frequency states
+enum freq_level { LOW, MEDIUM, HIGH };
+#define NFREQ 3
+
+// Idle states, shallowest first
+enum idle_state { IDLE_POLL, IDLE_HALT, IDLE_PARK };
+#define NIDLE 3
+
+#define TICK_MS 10        // Length of a timer tick in milliseconds
+
+// Runqueue load averages are fixed point with FSHIFT fraction bits,
+// sampled every LOADAVG_PERIOD ticks as in Unix.
+#define FSHIFT 11
+#define FIXED_1 (1 << FSHIFT)
+#define LOADINT(x) ((x) >> FSHIFT)
+#define LOADFRAC(x) ((((x) & (FIXED_1 - 1)) * 100) >> FSHIFT)
+#define LOADAVG_PERIOD 500
+
+// Per-task load (see spas_pelt) runs from 0 to SCHED_LOAD, and a
+// tick's contribution halves every PELT_HALFLIFE ticks.
+#define SCHED_LOAD 1024
+#define PELT_HALFLIFE 32
+
+// Workload classes (see spas_classify).  Processes with at least
+// CPUBOUND_LOAD count as CPU-bound.
+enum proc_class { CLASS_CPU, CLASS_IO, CLASS_INTERACTIVE };
+#define NCLASS 3
+#define CPUBOUND_LOAD (SCHED_LOAD * 3 / 4)
+
+// Frequency governors, selectable per CPU (see governors[] in spas.c)
+enum governor { GOV_SPAS, GOV_PERFORMANCE, GOV_POWERSAVE,
+                GOV_ONDEMAND, GOV_CONSERVATIVE };
+#define NGOV 5
+
+// Thermal frequency caps are fixed point: level << CAP_SHIFT.
+#define CAP_SHIFT 8
+#define CAP_ONE   (1 << CAP_SHIFT)
+#define CAP_MAX   (HIGH << CAP_SHIFT)
+#define PID_SHIFT 4       // PID gains are in 1/16ths
+
+// Per-CPU thermal state.
+struct spas_cpu {
+  enum governor governor;  // Policy choosing this CPU's level
+  enum freq_level want;    // Level the governor asked for
+  int load;                // Load of the last period (0-100)
+  int temp;                // Temperature in tenths of degrees C
+  enum freq_level freq;    // Effective frequency after thermal capping
+  int cap;                 // Thermal frequency cap (fixed point level)
+  int pid_active;          // Is the controller engaged?
+  int pid_integral;        // Accumulated error
+  int pid_prev_err;        // Error of the previous period
+  int dither;              // Fractional cap carried to the next period
+  uint energy_mj;          // Simulated energy used (millijoules)
+  uint energy_uj;          // ... plus this many microjoules
+  uint residency[NFREQ];   // Busy ticks at each level
+  uint idle_residency[NIDLE];  // Idle ticks in each idle state
+  enum freq_level floor;   // Level QoS hints asked for this period
+  int stall_credit;        // Shortfall accrued by duty-cycle emulation (see spas_stall)
+  uint stalled;            // Busy ticks spent halted to emulate the level
+  int tmoved;              // Gave a process to a cooler CPU this period?
+  uint tmigrations;        // Processes moved off it for heat
+};
+
+struct spas {
+  // --- Tunables ---
+  int history_size;        // Entries in the moving average window
+  int load_period;         // Ticks per analytics period
+  int thresh_low_med;      // Predicted load above which LOW -> MEDIUM
+  int thresh_med_high;     // Predicted load above which MEDIUM -> HIGH
+  int heating_factor;      // Increase per % load per period at HIGH (tenths of C)
+  int heat_scale[NFREQ];   // Percent of heating_factor at each level
+  int cooling_factor;      // Decrease per period (tenths of C)
+  int dissipation;         // Per-mille of the rise above ambient lost per period
+  int coupling;            // Percent of neighbour temp difference exchanged
+  int throttle_limit;      // Temperature the controller holds CPUs under
+  int critical_temp;       // Force LOW above this temperature
+  int ambient_temp;        // Minimum temperature
+  int pid_switch_on;       // Engage the controller this far below the limit
+  int pid_kp, pid_ki, pid_kd;  // Gains, in 1/16ths
+  int ondemand_up;         // ondemand: jump to HIGH above this load
+  int conservative_up;     // conservative: step up above this load
+  int conservative_down;   // conservative: step down below this load
+  int busy_power[NFREQ];   // Power drawn running at each level (mW)
+  int idle_power[NIDLE];   // Power drawn in each idle state (mW)
+  int quantum[NFREQ];      // Time slice at each level (microseconds)
+  int duty[NFREQ];         // Percent of each busy tick really run at each level
+  int tick_stride[NFREQ];  // A busy CPU takes a timer tick every this many ticks
+  int timer_slack;         // Ticks a sleep() may overrun to share a wakeup
+  int overload;            // Runnable per CPU (%) above which SPAS steps up a level
+  int balance_interval;    // Ticks between load balancing runs on a CPU
+  int balance_pct;         // Imbalance, % of SCHED_LOAD, worth a migration
+  int cache_hot;           // Ticks after running that a process is cache hot
+  int affinity_pct;        // Imbalance, % of SCHED_LOAD, that overrides the last CPU on wakeup
+  int park_util;           // Load (%) to pack active CPUs to; 0 never parks
+  int thermal_margin;      // Move work off CPUs this close to throttle_limit
+  int thermal_delta;       // ... to CPUs at least this much cooler
+  int cpu_quantum_pct;     // CPU-bound processes' slice, % of the level's quantum
+  int interactive_ticks;   // Interactive for this long after a console wakeup
+  int tty_boost;           // Priority levels a console wakeup gains for a burst
+  int qos_quantum[NQOS];   // Slice for each QoS class, % of the level's quantum
+  int oscillation_window;  // Ticks to consider for oscillation
+  int max_oscillation;     // Max switches in window before widening
+  int adaptation_period;   // Ticks between threshold adjustments
+
+  // --- State ---
+  int ncpu;                // CPUs being modelled
+  struct spas_cpu cpu[NCPU];
+  int cpu_load;            // Mean load of the last period (0-100)
+  int predicted_load;      // Moving average of load_history (0-100)
+  int load_history[MAXHISTORY];
+  int history_index;       // Next slot to fill in load_history
+  enum freq_level frequency;       // Level chosen by the SPAS predictor
+  enum freq_level prev_frequency;  // For oscillation detection
+  int virtual_temp;        // Hottest CPU, tenths of degrees C
+  int oscillation_count;   // Recent frequency switches
+  uint last_switch_tick;   // Tick when last switch occurred
+  int adaptation_counter;  // Periods since last adaptation
+  uint nswitch;            // Frequency switches since spas_init
+  uint nthrottle;          // CPU-periods run below the requested level
+  int nrunning;            // RUNNABLE+RUNNING processes at the last sample
+  uint loadavg[3];         // 1, 5 and 15 minute averages of nrunning (FSHIFT)
+  int nactive;             // CPUs 0..nactive-1 take work; the rest are parked
+  int nclass[NCLASS];      // Processes of each class active in the last period
+};
+
+extern char *freq_str[];
+extern char *idle_str[];
+extern char *gov_str[];
+extern char *class_str[];
+
+void spas_init(struct spas*, int ncpu);
+int  spas_load(uint busy, uint total);
+void spas_update(struct spas*, int *load, uint now);
+void spas_loadavg(struct spas*, int nrunning);
+uint spas_pelt(uint load, uint n, int runnable);
+enum proc_class spas_classify(struct spas*, uint load, uint vratio,
+                              uint sincetty);
+int  spas_hot(struct spas*, int cpu);
+int  spas_thermal_source(struct spas*, int cpu);
+void spas_account(struct spas*, int cpu, uint busy, uint idle, enum idle_state);
+void spas_charge(uint *mj, uint *uj, uint add);
+int  spas_stall(struct spas*, int cpu);
+int  spas_setgov(struct spas*, int cpu, int gov);
+int  spas_govbyname(char *name);
+char *spas_tunable(int i);
+int  spas_get(struct spas*, char *name, int *val);
+int  spas_set(struct spas*, char *name, int val);
@@ -0,0 +1,1485 @@
+
+_spas_test:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+#define DEFAULT_CHILDREN 4
+#define REPORTS 20
+
+int
+main(int argc, char *argv[])
+{
+   0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+   4:	83 e4 f0             	and    $0xfffffff0,%esp
+   7:	ff 71 fc             	push   -0x4(%ecx)
+   a:	55                   	push   %ebp
+   b:	89 e5                	mov    %esp,%ebp
+   d:	57                   	push   %edi
+   e:	56                   	push   %esi
+   f:	53                   	push   %ebx
+  10:	51                   	push   %ecx
+  11:	83 ec 78             	sub    $0x78,%esp
+  int n = DEFAULT_CHILDREN;
+  if(argc > 1) n = atoi(argv[1]);
+  14:	83 39 01             	cmpl   $0x1,(%ecx)
+{
+  17:	8b 41 04             	mov    0x4(%ecx),%eax
+  if(argc > 1) n = atoi(argv[1]);
+  1a:	7f 50                	jg     6c <main+0x6c>
+  if(n <= 0) n = DEFAULT_CHILDREN;
+
+  printf(1, "spas_test: starting %d busy children\n", n);
+  1c:	50                   	push   %eax
+
+  int pids[n];
+  1d:	8d 75 98             	lea    -0x68(%ebp),%esi
+  if(n <= 0) n = DEFAULT_CHILDREN;
+  20:	bb 04 00 00 00       	mov    $0x4,%ebx
+  printf(1, "spas_test: starting %d busy children\n", n);
+  25:	6a 04                	push   $0x4
+  27:	68 7c 0a 00 00       	push   $0xa7c
+  2c:	6a 01                	push   $0x1
+  2e:	e8 6d 06 00 00       	call   6a0 <printf>
+  33:	83 c4 10             	add    $0x10,%esp
+  int i;
+
+  for(i = 0; i < n; i++){
+  36:	31 ff                	xor    %edi,%edi
+  38:	eb 16                	jmp    50 <main+0x50>
+  3a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    int pid = fork();
+    if(pid < 0){
+      printf(2, "spas_test: fork failed\n");
+      exit();
+    }
+    if(pid == 0){
+  40:	0f 84 cc 01 00 00    	je     212 <main+0x212>
+        // Do not call I/O here to avoid serial contention.
+      }
+      // Child done
+      exit();
+    }
+    pids[i] = pid;
+  46:	89 04 be             	mov    %eax,(%esi,%edi,4)
+  for(i = 0; i < n; i++){
+  49:	83 c7 01             	add    $0x1,%edi
+  4c:	39 df                	cmp    %ebx,%edi
+  4e:	74 55                	je     a5 <main+0xa5>
+    int pid = fork();
+  50:	e8 86 04 00 00       	call   4db <fork>
+    if(pid < 0){
+  55:	85 c0                	test   %eax,%eax
+  57:	79 e7                	jns    40 <main+0x40>
+      printf(2, "spas_test: fork failed\n");
+  59:	50                   	push   %eax
+  5a:	50                   	push   %eax
+  5b:	68 cf 09 00 00       	push   $0x9cf
+  60:	6a 02                	push   $0x2
+  62:	e8 39 06 00 00       	call   6a0 <printf>
+      exit();
+  67:	e8 77 04 00 00       	call   4e3 <exit>
+  if(argc > 1) n = atoi(argv[1]);
+  6c:	83 ec 0c             	sub    $0xc,%esp
+  6f:	ff 70 04             	push   0x4(%eax)
+  72:	e8 f9 03 00 00       	call   470 <atoi>
+  if(n <= 0) n = DEFAULT_CHILDREN;
+  77:	83 c4 10             	add    $0x10,%esp
+  if(argc > 1) n = atoi(argv[1]);
+  7a:	89 c3                	mov    %eax,%ebx
+  if(n <= 0) n = DEFAULT_CHILDREN;
+  7c:	85 c0                	test   %eax,%eax
+  7e:	0f 8e f3 01 00 00    	jle    277 <main+0x277>
+  printf(1, "spas_test: starting %d busy children\n", n);
+  84:	50                   	push   %eax
+  85:	53                   	push   %ebx
+  86:	68 7c 0a 00 00       	push   $0xa7c
+  8b:	6a 01                	push   $0x1
+  8d:	e8 0e 06 00 00       	call   6a0 <printf>
+  int pids[n];
+  92:	8d 04 9d 0f 00 00 00 	lea    0xf(,%ebx,4),%eax
+  99:	83 c4 10             	add    $0x10,%esp
+  9c:	83 e0 f0             	and    $0xfffffff0,%eax
+  9f:	29 c4                	sub    %eax,%esp
+  a1:	89 e6                	mov    %esp,%esi
+  for(i = 0; i < n; i++){
+  a3:	eb 91                	jmp    36 <main+0x36>
+
+  // Parent: print cpustat reports
+  struct telemetry st;
+  uint seq = 0;
+  int rep;
+  for(rep = 0; rep < REPORTS; rep++){
+  a5:	31 ff                	xor    %edi,%edi
+  a7:	89 7d 88             	mov    %edi,-0x78(%ebp)
+  aa:	89 7d 84             	mov    %edi,-0x7c(%ebp)
+  ad:	8d 76 00             	lea    0x0(%esi),%esi
+    if(telemetry(&seq, &st, 1) != 1){
+  b0:	83 ec 04             	sub    $0x4,%esp
+  b3:	8d 45 b8             	lea    -0x48(%ebp),%eax
+  b6:	6a 01                	push   $0x1
+  b8:	50                   	push   %eax
+  b9:	8d 45 88             	lea    -0x78(%ebp),%eax
+  bc:	50                   	push   %eax
+  bd:	e8 f1 04 00 00       	call   5b3 <telemetry>
+  c2:	83 c4 10             	add    $0x10,%esp
+  c5:	83 f8 01             	cmp    $0x1,%eax
+  c8:	0f 85 72 01 00 00    	jne    240 <main+0x240>
+      printf(2, "spas_test: telemetry failed\n");
+      break;
+    }
+    printf(1, "--- SPAS Test Report %d/%d (tick %d) ---\n", rep+1, REPORTS, st.tick);
+  ce:	8b 45 84             	mov    -0x7c(%ebp),%eax
+  d1:	83 ec 0c             	sub    $0xc,%esp
+  d4:	83 c0 01             	add    $0x1,%eax
+  d7:	89 45 80             	mov    %eax,-0x80(%ebp)
+  da:	ff 75 c0             	push   -0x40(%ebp)
+  dd:	6a 14                	push   $0x14
+  df:	50                   	push   %eax
+  e0:	68 a4 0a 00 00       	push   $0xaa4
+  e5:	6a 01                	push   $0x1
+  e7:	e8 b4 05 00 00       	call   6a0 <printf>
+    printf(1, "CPU Load:       %d%%\n", st.load);
+  ec:	83 c4 1c             	add    $0x1c,%esp
+  ef:	ff 75 c4             	push   -0x3c(%ebp)
+  f2:	68 04 0a 00 00       	push   $0xa04
+  f7:	6a 01                	push   $0x1
+  f9:	e8 a2 05 00 00       	call   6a0 <printf>
+    printf(1, "Predicted Load: %d%%\n", st.predicted_load);
+  fe:	83 c4 0c             	add    $0xc,%esp
+ 101:	ff 75 c8             	push   -0x38(%ebp)
+ 104:	68 1a 0a 00 00       	push   $0xa1a
+ 109:	6a 01                	push   $0x1
+ 10b:	e8 90 05 00 00       	call   6a0 <printf>
+    char *freq[] = { "LOW", "MEDIUM", "HIGH" };
+    int fl = st.frequency_level;
+ 110:	8b 55 cc             	mov    -0x34(%ebp),%edx
+    if(fl < 0 || fl > 2) fl = 1;
+ 113:	83 c4 10             	add    $0x10,%esp
+ 116:	b8 c8 09 00 00       	mov    $0x9c8,%eax
+    char *freq[] = { "LOW", "MEDIUM", "HIGH" };
+ 11b:	c7 45 8c 30 0a 00 00 	movl   $0xa30,-0x74(%ebp)
+ 122:	c7 45 90 c8 09 00 00 	movl   $0x9c8,-0x70(%ebp)
+ 129:	c7 45 94 34 0a 00 00 	movl   $0xa34,-0x6c(%ebp)
+    if(fl < 0 || fl > 2) fl = 1;
+ 130:	83 fa 02             	cmp    $0x2,%edx
+ 133:	77 04                	ja     139 <main+0x139>
+    printf(1, "Frequency:      %s\n", freq[fl]);
+ 135:	8b 44 95 8c          	mov    -0x74(%ebp,%edx,4),%eax
+ 139:	83 ec 04             	sub    $0x4,%esp
+    printf(1, "Virtual Temp:   %d.%d C\n", st.temp/10, st.temp%10);
+    printf(1, "Thresholds:     L->M %d%%, M->H %d%%\n", st.thresh_low_med, st.thresh_med_high);
+
+    // Print remaining children (basic check)
+    printf(1, "Children PIDs: ");
+    for(i = 0; i < n; i++){
+ 13c:	31 ff                	xor    %edi,%edi
+    printf(1, "Frequency:      %s\n", freq[fl]);
+ 13e:	50                   	push   %eax
+ 13f:	68 39 0a 00 00       	push   $0xa39
+ 144:	6a 01                	push   $0x1
+ 146:	e8 55 05 00 00       	call   6a0 <printf>
+    printf(1, "Virtual Temp:   %d.%d C\n", st.temp/10, st.temp%10);
+ 14b:	8b 4d d0             	mov    -0x30(%ebp),%ecx
+ 14e:	b8 67 66 66 66       	mov    $0x66666667,%eax
+ 153:	f7 e9                	imul   %ecx
+ 155:	89 c8                	mov    %ecx,%eax
+ 157:	c1 f8 1f             	sar    $0x1f,%eax
+ 15a:	c1 fa 02             	sar    $0x2,%edx
+ 15d:	29 c2                	sub    %eax,%edx
+ 15f:	8d 04 92             	lea    (%edx,%edx,4),%eax
+ 162:	01 c0                	add    %eax,%eax
+ 164:	29 c1                	sub    %eax,%ecx
+ 166:	51                   	push   %ecx
+ 167:	52                   	push   %edx
+ 168:	68 4d 0a 00 00       	push   $0xa4d
+ 16d:	6a 01                	push   $0x1
+ 16f:	e8 2c 05 00 00       	call   6a0 <printf>
+    printf(1, "Thresholds:     L->M %d%%, M->H %d%%\n", st.thresh_low_med, st.thresh_med_high);
+ 174:	83 c4 20             	add    $0x20,%esp
+ 177:	ff 75 d8             	push   -0x28(%ebp)
+ 17a:	ff 75 d4             	push   -0x2c(%ebp)
+ 17d:	68 d0 0a 00 00       	push   $0xad0
+ 182:	6a 01                	push   $0x1
+ 184:	e8 17 05 00 00       	call   6a0 <printf>
+    printf(1, "Children PIDs: ");
+ 189:	58                   	pop    %eax
+ 18a:	5a                   	pop    %edx
+ 18b:	68 66 0a 00 00       	push   $0xa66
+ 190:	6a 01                	push   $0x1
+ 192:	e8 09 05 00 00       	call   6a0 <printf>
+ 197:	83 c4 10             	add    $0x10,%esp
+ 19a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+      printf(1, "%d ", pids[i]);
+ 1a0:	83 ec 04             	sub    $0x4,%esp
+ 1a3:	ff 34 be             	push   (%esi,%edi,4)
+    for(i = 0; i < n; i++){
+ 1a6:	83 c7 01             	add    $0x1,%edi
+      printf(1, "%d ", pids[i]);
+ 1a9:	68 76 0a 00 00       	push   $0xa76
+ 1ae:	6a 01                	push   $0x1
+ 1b0:	e8 eb 04 00 00       	call   6a0 <printf>
+    for(i = 0; i < n; i++){
+ 1b5:	83 c4 10             	add    $0x10,%esp
+ 1b8:	39 df                	cmp    %ebx,%edi
+ 1ba:	75 e4                	jne    1a0 <main+0x1a0>
+    }
+    printf(1, "\n");
+ 1bc:	83 ec 08             	sub    $0x8,%esp
+ 1bf:	68 18 0a 00 00       	push   $0xa18
+ 1c4:	6a 01                	push   $0x1
+ 1c6:	e8 d5 04 00 00       	call   6a0 <printf>
+
+    // Guidance: what to look for
+    if(rep == 0){
+ 1cb:	8b 7d 84             	mov    -0x7c(%ebp),%edi
+ 1ce:	83 c4 10             	add    $0x10,%esp
+ 1d1:	85 ff                	test   %edi,%edi
+ 1d3:	74 1b                	je     1f0 <main+0x1f0>
+  for(rep = 0; rep < REPORTS; rep++){
+ 1d5:	83 7d 80 14          	cmpl   $0x14,-0x80(%ebp)
+ 1d9:	74 76                	je     251 <main+0x251>
+    printf(1, "--- SPAS Test Report %d/%d (tick %d) ---\n", rep+1, REPORTS, st.tick);
+ 1db:	8b 45 80             	mov    -0x80(%ebp),%eax
+ 1de:	89 45 84             	mov    %eax,-0x7c(%ebp)
+ 1e1:	e9 ca fe ff ff       	jmp    b0 <main+0xb0>
+ 1e6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 1ed:	8d 76 00             	lea    0x0(%esi),%esi
+      printf(1, "Note: watch Frequency and Virtual Temp — with busy children Frequency should increase and temp should rise.\n");
+ 1f0:	83 ec 08             	sub    $0x8,%esp
+ 1f3:	68 f8 0a 00 00       	push   $0xaf8
+ 1f8:	6a 01                	push   $0x1
+ 1fa:	e8 a1 04 00 00       	call   6a0 <printf>
+      printf(1, "If Frequency moves LOW->MEDIUM->HIGH as load rises, dynamic time quanta assignment is active.\n");
+ 1ff:	5a                   	pop    %edx
+ 200:	59                   	pop    %ecx
+ 201:	68 68 0b 00 00       	push   $0xb68
+ 206:	6a 01                	push   $0x1
+ 208:	e8 93 04 00 00       	call   6a0 <printf>
+  for(rep = 0; rep < REPORTS; rep++){
+ 20d:	83 c4 10             	add    $0x10,%esp
+ 210:	eb c9                	jmp    1db <main+0x1db>
+      volatile unsigned long x = 0;
+ 212:	31 c0                	xor    %eax,%eax
+ 214:	89 45 b8             	mov    %eax,-0x48(%ebp)
+      while(x < work){
+ 217:	8b 45 b8             	mov    -0x48(%ebp),%eax
+ 21a:	3d ff 2c 31 01       	cmp    $0x1312cff,%eax
+ 21f:	77 1a                	ja     23b <main+0x23b>
+ 221:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+        x++;
+ 228:	8b 45 b8             	mov    -0x48(%ebp),%eax
+ 22b:	83 c0 01             	add    $0x1,%eax
+ 22e:	89 45 b8             	mov    %eax,-0x48(%ebp)
+      while(x < work){
+ 231:	8b 45 b8             	mov    -0x48(%ebp),%eax
+ 234:	3d ff 2c 31 01       	cmp    $0x1312cff,%eax
+ 239:	76 ed                	jbe    228 <main+0x228>
+      exit();
+ 23b:	e8 a3 02 00 00       	call   4e3 <exit>
+      printf(2, "spas_test: telemetry failed\n");
+ 240:	51                   	push   %ecx
+ 241:	51                   	push   %ecx
+ 242:	68 e7 09 00 00       	push   $0x9e7
+ 247:	6a 02                	push   $0x2
+ 249:	e8 52 04 00 00       	call   6a0 <printf>
+      break;
+ 24e:	83 c4 10             	add    $0x10,%esp
+    for(i = 0; i < n; i++){
+ 251:	31 f6                	xor    %esi,%esi
+ 253:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 257:	90                   	nop
+    }
+  }
+
+  // Wait for children to finish
+  for(i = 0; i < n; i++){
+    wait();
+ 258:	e8 8e 02 00 00       	call   4eb <wait>
+  for(i = 0; i < n; i++){
+ 25d:	83 c6 01             	add    $0x1,%esi
+ 260:	39 de                	cmp    %ebx,%esi
+ 262:	75 f4                	jne    258 <main+0x258>
+  }
+
+  printf(1, "spas_test: all children exited, done.\n");
+ 264:	50                   	push   %eax
+ 265:	50                   	push   %eax
+ 266:	68 c8 0b 00 00       	push   $0xbc8
+ 26b:	6a 01                	push   $0x1
+ 26d:	e8 2e 04 00 00       	call   6a0 <printf>
+  exit();
+ 272:	e8 6c 02 00 00       	call   4e3 <exit>
+  printf(1, "spas_test: starting %d busy children\n", n);
+ 277:	50                   	push   %eax
+  int pids[n];
+ 278:	8d 75 a8             	lea    -0x58(%ebp),%esi
+  if(n <= 0) n = DEFAULT_CHILDREN;
+ 27b:	bb 04 00 00 00       	mov    $0x4,%ebx
+  printf(1, "spas_test: starting %d busy children\n", n);
+ 280:	6a 04                	push   $0x4
+ 282:	68 7c 0a 00 00       	push   $0xa7c
+ 287:	6a 01                	push   $0x1
+ 289:	e8 12 04 00 00       	call   6a0 <printf>
+ 28e:	83 c4 10             	add    $0x10,%esp
+ 291:	e9 a0 fd ff ff       	jmp    36 <main+0x36>
+ 296:	66 90                	xchg   %ax,%ax
+ 298:	66 90                	xchg   %ax,%ax
+ 29a:	66 90                	xchg   %ax,%ax
+ 29c:	66 90                	xchg   %ax,%ax
+ 29e:	66 90                	xchg   %ax,%ax
+
+000002a0 <strcpy>:
+#include "user.h"
+#include "x86.h"
+
+char*
+strcpy(char *s, const char *t)
+{
+ 2a0:	55                   	push   %ebp
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+ 2a1:	31 c0                	xor    %eax,%eax
+{
+ 2a3:	89 e5                	mov    %esp,%ebp
+ 2a5:	53                   	push   %ebx
+ 2a6:	8b 4d 08             	mov    0x8(%ebp),%ecx
+ 2a9:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+ 2ac:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  while((*s++ = *t++) != 0)
+ 2b0:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+ 2b4:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+ 2b7:	83 c0 01             	add    $0x1,%eax
+ 2ba:	84 d2                	test   %dl,%dl
+ 2bc:	75 f2                	jne    2b0 <strcpy+0x10>
+    ;
+  return os;
+}
+ 2be:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 2c1:	89 c8                	mov    %ecx,%eax
+ 2c3:	c9                   	leave
+ 2c4:	c3                   	ret
+ 2c5:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 2cc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000002d0 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+ 2d0:	55                   	push   %ebp
+ 2d1:	89 e5                	mov    %esp,%ebp
+ 2d3:	53                   	push   %ebx
+ 2d4:	8b 55 08             	mov    0x8(%ebp),%edx
+ 2d7:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  while(*p && *p == *q)
+ 2da:	0f b6 02             	movzbl (%edx),%eax
+ 2dd:	84 c0                	test   %al,%al
+ 2df:	75 17                	jne    2f8 <strcmp+0x28>
+ 2e1:	eb 3a                	jmp    31d <strcmp+0x4d>
+ 2e3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 2e7:	90                   	nop
+ 2e8:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+    p++, q++;
+ 2ec:	83 c2 01             	add    $0x1,%edx
+ 2ef:	8d 59 01             	lea    0x1(%ecx),%ebx
+  while(*p && *p == *q)
+ 2f2:	84 c0                	test   %al,%al
+ 2f4:	74 1a                	je     310 <strcmp+0x40>
+    p++, q++;
+ 2f6:	89 d9                	mov    %ebx,%ecx
+  while(*p && *p == *q)
+ 2f8:	0f b6 19             	movzbl (%ecx),%ebx
+ 2fb:	38 c3                	cmp    %al,%bl
+ 2fd:	74 e9                	je     2e8 <strcmp+0x18>
+  return (uchar)*p - (uchar)*q;
+ 2ff:	29 d8                	sub    %ebx,%eax
+}
+ 301:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 304:	c9                   	leave
+ 305:	c3                   	ret
+ 306:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 30d:	8d 76 00             	lea    0x0(%esi),%esi
+  return (uchar)*p - (uchar)*q;
+ 310:	0f b6 59 01          	movzbl 0x1(%ecx),%ebx
+ 314:	31 c0                	xor    %eax,%eax
+ 316:	29 d8                	sub    %ebx,%eax
+}
+ 318:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 31b:	c9                   	leave
+ 31c:	c3                   	ret
+  return (uchar)*p - (uchar)*q;
+ 31d:	0f b6 19             	movzbl (%ecx),%ebx
+ 320:	31 c0                	xor    %eax,%eax
+ 322:	eb db                	jmp    2ff <strcmp+0x2f>
+ 324:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 32b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 32f:	90                   	nop
+
+00000330 <strlen>:
+
+uint
+strlen(const char *s)
+{
+ 330:	55                   	push   %ebp
+ 331:	89 e5                	mov    %esp,%ebp
+ 333:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for(n = 0; s[n]; n++)
+ 336:	80 3a 00             	cmpb   $0x0,(%edx)
+ 339:	74 15                	je     350 <strlen+0x20>
+ 33b:	31 c0                	xor    %eax,%eax
+ 33d:	8d 76 00             	lea    0x0(%esi),%esi
+ 340:	83 c0 01             	add    $0x1,%eax
+ 343:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+ 347:	89 c1                	mov    %eax,%ecx
+ 349:	75 f5                	jne    340 <strlen+0x10>
+    ;
+  return n;
+}
+ 34b:	89 c8                	mov    %ecx,%eax
+ 34d:	5d                   	pop    %ebp
+ 34e:	c3                   	ret
+ 34f:	90                   	nop
+  for(n = 0; s[n]; n++)
+ 350:	31 c9                	xor    %ecx,%ecx
+}
+ 352:	5d                   	pop    %ebp
+ 353:	89 c8                	mov    %ecx,%eax
+ 355:	c3                   	ret
+ 356:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 35d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000360 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+ 360:	55                   	push   %ebp
+ 361:	89 e5                	mov    %esp,%ebp
+ 363:	57                   	push   %edi
+ 364:	8b 55 08             	mov    0x8(%ebp),%edx
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosb" :
+ 367:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 36a:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 36d:	89 d7                	mov    %edx,%edi
+ 36f:	fc                   	cld
+ 370:	f3 aa                	rep stos %al,%es:(%edi)
+  stosb(dst, c, n);
+  return dst;
+}
+ 372:	8b 7d fc             	mov    -0x4(%ebp),%edi
+ 375:	89 d0                	mov    %edx,%eax
+ 377:	c9                   	leave
+ 378:	c3                   	ret
+ 379:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000380 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+ 380:	55                   	push   %ebp
+ 381:	89 e5                	mov    %esp,%ebp
+ 383:	8b 45 08             	mov    0x8(%ebp),%eax
+ 386:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+ 38a:	0f b6 10             	movzbl (%eax),%edx
+ 38d:	84 d2                	test   %dl,%dl
+ 38f:	75 12                	jne    3a3 <strchr+0x23>
+ 391:	eb 1d                	jmp    3b0 <strchr+0x30>
+ 393:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 397:	90                   	nop
+ 398:	0f b6 50 01          	movzbl 0x1(%eax),%edx
+ 39c:	83 c0 01             	add    $0x1,%eax
+ 39f:	84 d2                	test   %dl,%dl
+ 3a1:	74 0d                	je     3b0 <strchr+0x30>
+    if(*s == c)
+ 3a3:	38 d1                	cmp    %dl,%cl
+ 3a5:	75 f1                	jne    398 <strchr+0x18>
+      return (char*)s;
+  return 0;
+}
+ 3a7:	5d                   	pop    %ebp
+ 3a8:	c3                   	ret
+ 3a9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  return 0;
+ 3b0:	31 c0                	xor    %eax,%eax
+}
+ 3b2:	5d                   	pop    %ebp
+ 3b3:	c3                   	ret
+ 3b4:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 3bb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 3bf:	90                   	nop
+
+000003c0 <gets>:
+
+char*
+gets(char *buf, int max)
+{
+ 3c0:	55                   	push   %ebp
+ 3c1:	89 e5                	mov    %esp,%ebp
+ 3c3:	57                   	push   %edi
+ 3c4:	56                   	push   %esi
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+    cc = read(0, &c, 1);
+ 3c5:	8d 75 e7             	lea    -0x19(%ebp),%esi
+{
+ 3c8:	53                   	push   %ebx
+  for(i=0; i+1 < max; ){
+ 3c9:	31 db                	xor    %ebx,%ebx
+{
+ 3cb:	83 ec 1c             	sub    $0x1c,%esp
+  for(i=0; i+1 < max; ){
+ 3ce:	eb 27                	jmp    3f7 <gets+0x37>
+    cc = read(0, &c, 1);
+ 3d0:	83 ec 04             	sub    $0x4,%esp
+ 3d3:	6a 01                	push   $0x1
+ 3d5:	56                   	push   %esi
+ 3d6:	6a 00                	push   $0x0
+ 3d8:	e8 1e 01 00 00       	call   4fb <read>
+    if(cc < 1)
+ 3dd:	83 c4 10             	add    $0x10,%esp
+ 3e0:	85 c0                	test   %eax,%eax
+ 3e2:	7e 1d                	jle    401 <gets+0x41>
+      break;
+    buf[i++] = c;
+ 3e4:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+ 3e8:	8b 55 08             	mov    0x8(%ebp),%edx
+ 3eb:	88 44 1a ff          	mov    %al,-0x1(%edx,%ebx,1)
+    if(c == '\n' || c == '\r')
+ 3ef:	3c 0a                	cmp    $0xa,%al
+ 3f1:	74 10                	je     403 <gets+0x43>
+ 3f3:	3c 0d                	cmp    $0xd,%al
+ 3f5:	74 0c                	je     403 <gets+0x43>
+  for(i=0; i+1 < max; ){
+ 3f7:	89 df                	mov    %ebx,%edi
+ 3f9:	83 c3 01             	add    $0x1,%ebx
+ 3fc:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+ 3ff:	7c cf                	jl     3d0 <gets+0x10>
+ 401:	89 fb                	mov    %edi,%ebx
+      break;
+  }
+  buf[i] = '\0';
+ 403:	8b 45 08             	mov    0x8(%ebp),%eax
+ 406:	c6 04 18 00          	movb   $0x0,(%eax,%ebx,1)
+  return buf;
+}
+ 40a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 40d:	5b                   	pop    %ebx
+ 40e:	5e                   	pop    %esi
+ 40f:	5f                   	pop    %edi
+ 410:	5d                   	pop    %ebp
+ 411:	c3                   	ret
+ 412:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 419:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000420 <stat>:
+
+int
+stat(const char *n, struct stat *st)
+{
+ 420:	55                   	push   %ebp
+ 421:	89 e5                	mov    %esp,%ebp
+ 423:	56                   	push   %esi
+ 424:	53                   	push   %ebx
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+ 425:	83 ec 08             	sub    $0x8,%esp
+ 428:	6a 00                	push   $0x0
+ 42a:	ff 75 08             	push   0x8(%ebp)
+ 42d:	e8 f1 00 00 00       	call   523 <open>
+  if(fd < 0)
+ 432:	83 c4 10             	add    $0x10,%esp
+ 435:	85 c0                	test   %eax,%eax
+ 437:	78 27                	js     460 <stat+0x40>
+    return -1;
+  r = fstat(fd, st);
+ 439:	83 ec 08             	sub    $0x8,%esp
+ 43c:	ff 75 0c             	push   0xc(%ebp)
+ 43f:	89 c3                	mov    %eax,%ebx
+ 441:	50                   	push   %eax
+ 442:	e8 f4 00 00 00       	call   53b <fstat>
+  close(fd);
+ 447:	89 1c 24             	mov    %ebx,(%esp)
+  r = fstat(fd, st);
+ 44a:	89 c6                	mov    %eax,%esi
+  close(fd);
+ 44c:	e8 ba 00 00 00       	call   50b <close>
+  return r;
+ 451:	83 c4 10             	add    $0x10,%esp
+}
+ 454:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 457:	89 f0                	mov    %esi,%eax
+ 459:	5b                   	pop    %ebx
+ 45a:	5e                   	pop    %esi
+ 45b:	5d                   	pop    %ebp
+ 45c:	c3                   	ret
+ 45d:	8d 76 00             	lea    0x0(%esi),%esi
+    return -1;
+ 460:	be ff ff ff ff       	mov    $0xffffffff,%esi
+ 465:	eb ed                	jmp    454 <stat+0x34>
+ 467:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 46e:	66 90                	xchg   %ax,%ax
+
+00000470 <atoi>:
+
+int
+atoi(const char *s)
+{
+ 470:	55                   	push   %ebp
+ 471:	89 e5                	mov    %esp,%ebp
+ 473:	53                   	push   %ebx
+ 474:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  n = 0;
+  while('0' <= *s && *s <= '9')
+ 477:	0f be 02             	movsbl (%edx),%eax
+ 47a:	8d 48 d0             	lea    -0x30(%eax),%ecx
+ 47d:	80 f9 09             	cmp    $0x9,%cl
+  n = 0;
+ 480:	b9 00 00 00 00       	mov    $0x0,%ecx
+  while('0' <= *s && *s <= '9')
+ 485:	77 1e                	ja     4a5 <atoi+0x35>
+ 487:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 48e:	66 90                	xchg   %ax,%ax
+    n = n*10 + *s++ - '0';
+ 490:	83 c2 01             	add    $0x1,%edx
+ 493:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+ 496:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+  while('0' <= *s && *s <= '9')
+ 49a:	0f be 02             	movsbl (%edx),%eax
+ 49d:	8d 58 d0             	lea    -0x30(%eax),%ebx
+ 4a0:	80 fb 09             	cmp    $0x9,%bl
+ 4a3:	76 eb                	jbe    490 <atoi+0x20>
+  return n;
+}
+ 4a5:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 4a8:	89 c8                	mov    %ecx,%eax
+ 4aa:	c9                   	leave
+ 4ab:	c3                   	ret
+ 4ac:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000004b0 <memmove>:
+
+void*
+memmove(void *vdst, const void *vsrc, int n)
+{
+ 4b0:	55                   	push   %ebp
+ 4b1:	89 e5                	mov    %esp,%ebp
+ 4b3:	57                   	push   %edi
+ 4b4:	56                   	push   %esi
+ 4b5:	8b 45 10             	mov    0x10(%ebp),%eax
+ 4b8:	8b 55 08             	mov    0x8(%ebp),%edx
+ 4bb:	8b 75 0c             	mov    0xc(%ebp),%esi
+  char *dst;
+  const char *src;
+
+  dst = vdst;
+  src = vsrc;
+  while(n-- > 0)
+ 4be:	85 c0                	test   %eax,%eax
+ 4c0:	7e 13                	jle    4d5 <memmove+0x25>
+ 4c2:	01 d0                	add    %edx,%eax
+  dst = vdst;
+ 4c4:	89 d7                	mov    %edx,%edi
+ 4c6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 4cd:	8d 76 00             	lea    0x0(%esi),%esi
+    *dst++ = *src++;
+ 4d0:	a4                   	movsb  %ds:(%esi),%es:(%edi)
+  while(n-- > 0)
+ 4d1:	39 f8                	cmp    %edi,%eax
+ 4d3:	75 fb                	jne    4d0 <memmove+0x20>
+  return vdst;
+}
+ 4d5:	5e                   	pop    %esi
+ 4d6:	89 d0                	mov    %edx,%eax
+ 4d8:	5f                   	pop    %edi
+ 4d9:	5d                   	pop    %ebp
+ 4da:	c3                   	ret
+
+000004db <fork>:
+  name: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+SYSCALL(fork)
+ 4db:	b8 01 00 00 00       	mov    $0x1,%eax
+ 4e0:	cd 40                	int    $0x40
+ 4e2:	c3                   	ret
+
+000004e3 <exit>:
+SYSCALL(exit)
+ 4e3:	b8 02 00 00 00       	mov    $0x2,%eax
+ 4e8:	cd 40                	int    $0x40
+ 4ea:	c3                   	ret
+
+000004eb <wait>:
+SYSCALL(wait)
+ 4eb:	b8 03 00 00 00       	mov    $0x3,%eax
+ 4f0:	cd 40                	int    $0x40
+ 4f2:	c3                   	ret
+
+000004f3 <pipe>:
+SYSCALL(pipe)
+ 4f3:	b8 04 00 00 00       	mov    $0x4,%eax
+ 4f8:	cd 40                	int    $0x40
+ 4fa:	c3                   	ret
+
+000004fb <read>:
+SYSCALL(read)
+ 4fb:	b8 05 00 00 00       	mov    $0x5,%eax
+ 500:	cd 40                	int    $0x40
+ 502:	c3                   	ret
+
+00000503 <write>:
+SYSCALL(write)
+ 503:	b8 10 00 00 00       	mov    $0x10,%eax
+ 508:	cd 40                	int    $0x40
+ 50a:	c3                   	ret
+
+0000050b <close>:
+SYSCALL(close)
+ 50b:	b8 15 00 00 00       	mov    $0x15,%eax
+ 510:	cd 40                	int    $0x40
+ 512:	c3                   	ret
+
+00000513 <kill>:
+SYSCALL(kill)
+ 513:	b8 06 00 00 00       	mov    $0x6,%eax
+ 518:	cd 40                	int    $0x40
+ 51a:	c3                   	ret
+
+0000051b <exec>:
+SYSCALL(exec)
+ 51b:	b8 07 00 00 00       	mov    $0x7,%eax
+ 520:	cd 40                	int    $0x40
+ 522:	c3                   	ret
+
+00000523 <open>:
+SYSCALL(open)
+ 523:	b8 0f 00 00 00       	mov    $0xf,%eax
+ 528:	cd 40                	int    $0x40
+ 52a:	c3                   	ret
+
+0000052b <mknod>:
+SYSCALL(mknod)
+ 52b:	b8 11 00 00 00       	mov    $0x11,%eax
+ 530:	cd 40                	int    $0x40
+ 532:	c3                   	ret
+
+00000533 <unlink>:
+SYSCALL(unlink)
+ 533:	b8 12 00 00 00       	mov    $0x12,%eax
+ 538:	cd 40                	int    $0x40
+ 53a:	c3                   	ret
+
+0000053b <fstat>:
+SYSCALL(fstat)
+ 53b:	b8 08 00 00 00       	mov    $0x8,%eax
+ 540:	cd 40                	int    $0x40
+ 542:	c3                   	ret
+
+00000543 <link>:
+SYSCALL(link)
+ 543:	b8 13 00 00 00       	mov    $0x13,%eax
+ 548:	cd 40                	int    $0x40
+ 54a:	c3                   	ret
+
+0000054b <mkdir>:
+SYSCALL(mkdir)
+ 54b:	b8 14 00 00 00       	mov    $0x14,%eax
+ 550:	cd 40                	int    $0x40
+ 552:	c3                   	ret
+
+00000553 <chdir>:
+SYSCALL(chdir)
+ 553:	b8 09 00 00 00       	mov    $0x9,%eax
+ 558:	cd 40                	int    $0x40
+ 55a:	c3                   	ret
+
+0000055b <dup>:
+SYSCALL(dup)
+ 55b:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 560:	cd 40                	int    $0x40
+ 562:	c3                   	ret
+
+00000563 <getpid>:
+SYSCALL(getpid)
+ 563:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 568:	cd 40                	int    $0x40
+ 56a:	c3                   	ret
+
+0000056b <sbrk>:
+SYSCALL(sbrk)
+ 56b:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 570:	cd 40                	int    $0x40
+ 572:	c3                   	ret
+
+00000573 <sleep>:
+SYSCALL(sleep)
+ 573:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 578:	cd 40                	int    $0x40
+ 57a:	c3                   	ret
+
+0000057b <uptime>:
+SYSCALL(uptime)
+ 57b:	b8 0e 00 00 00       	mov    $0xe,%eax
+ 580:	cd 40                	int    $0x40
+ 582:	c3                   	ret
+
+00000583 <cpustat>:
+SYSCALL(cpustat)
+ 583:	b8 16 00 00 00       	mov    $0x16,%eax
+ 588:	cd 40                	int    $0x40
+ 58a:	c3                   	ret
+
+0000058b <setpriority>:
+SYSCALL(setpriority)
+ 58b:	b8 17 00 00 00       	mov    $0x17,%eax
+ 590:	cd 40                	int    $0x40
+ 592:	c3                   	ret
+
+00000593 <cpuinfo>:
+SYSCALL(cpuinfo)
+ 593:	b8 18 00 00 00       	mov    $0x18,%eax
+ 598:	cd 40                	int    $0x40
+ 59a:	c3                   	ret
+
+0000059b <procinfo>:
+SYSCALL(procinfo)
+ 59b:	b8 19 00 00 00       	mov    $0x19,%eax
+ 5a0:	cd 40                	int    $0x40
+ 5a2:	c3                   	ret
+
+000005a3 <setgovernor>:
+SYSCALL(setgovernor)
+ 5a3:	b8 1a 00 00 00       	mov    $0x1a,%eax
+ 5a8:	cd 40                	int    $0x40
+ 5aa:	c3                   	ret
+
+000005ab <sysctl>:
+SYSCALL(sysctl)
+ 5ab:	b8 1b 00 00 00       	mov    $0x1b,%eax
+ 5b0:	cd 40                	int    $0x40
+ 5b2:	c3                   	ret
+
+000005b3 <telemetry>:
+SYSCALL(telemetry)
+ 5b3:	b8 1c 00 00 00       	mov    $0x1c,%eax
+ 5b8:	cd 40                	int    $0x40
+ 5ba:	c3                   	ret
+
+000005bb <clock_gettime>:
+SYSCALL(clock_gettime)
+ 5bb:	b8 1d 00 00 00       	mov    $0x1d,%eax
+ 5c0:	cd 40                	int    $0x40
+ 5c2:	c3                   	ret
+
+000005c3 <sched_setaffinity>:
+SYSCALL(sched_setaffinity)
+ 5c3:	b8 1e 00 00 00       	mov    $0x1e,%eax
+ 5c8:	cd 40                	int    $0x40
+ 5ca:	c3                   	ret
+
+000005cb <sched_getaffinity>:
+SYSCALL(sched_getaffinity)
+ 5cb:	b8 1f 00 00 00       	mov    $0x1f,%eax
+ 5d0:	cd 40                	int    $0x40
+ 5d2:	c3                   	ret
+
+000005d3 <setqos>:
+SYSCALL(setqos)
+ 5d3:	b8 20 00 00 00       	mov    $0x20,%eax
+ 5d8:	cd 40                	int    $0x40
+ 5da:	c3                   	ret
+
+000005db <setgroup>:
+SYSCALL(setgroup)
+ 5db:	b8 21 00 00 00       	mov    $0x21,%eax
+ 5e0:	cd 40                	int    $0x40
+ 5e2:	c3                   	ret
+
+000005e3 <setquota>:
+SYSCALL(setquota)
+ 5e3:	b8 22 00 00 00       	mov    $0x22,%eax
+ 5e8:	cd 40                	int    $0x40
+ 5ea:	c3                   	ret
+
+000005eb <groupinfo>:
+SYSCALL(groupinfo)
+ 5eb:	b8 23 00 00 00       	mov    $0x23,%eax
+ 5f0:	cd 40                	int    $0x40
+ 5f2:	c3                   	ret
+ 5f3:	66 90                	xchg   %ax,%ax
+ 5f5:	66 90                	xchg   %ax,%ax
+ 5f7:	66 90                	xchg   %ax,%ax
+ 5f9:	66 90                	xchg   %ax,%ax
+ 5fb:	66 90                	xchg   %ax,%ax
+ 5fd:	66 90                	xchg   %ax,%ax
+ 5ff:	90                   	nop
+
+00000600 <printint>:
+  write(fd, &c, 1);
+}
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+ 600:	55                   	push   %ebp
+ 601:	89 e5                	mov    %esp,%ebp
+ 603:	57                   	push   %edi
+ 604:	56                   	push   %esi
+ 605:	53                   	push   %ebx
+ 606:	89 cb                	mov    %ecx,%ebx
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+    neg = 1;
+    x = -xx;
+ 608:	89 d1                	mov    %edx,%ecx
+{
+ 60a:	83 ec 3c             	sub    $0x3c,%esp
+ 60d:	89 45 c0             	mov    %eax,-0x40(%ebp)
+  if(sgn && xx < 0){
+ 610:	85 d2                	test   %edx,%edx
+ 612:	0f 89 80 00 00 00    	jns    698 <printint+0x98>
+ 618:	f6 45 08 01          	testb  $0x1,0x8(%ebp)
+ 61c:	74 7a                	je     698 <printint+0x98>
+    x = -xx;
+ 61e:	f7 d9                	neg    %ecx
+    neg = 1;
+ 620:	b8 01 00 00 00       	mov    $0x1,%eax
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+ 625:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+ 628:	31 f6                	xor    %esi,%esi
+ 62a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  do{
+    buf[i++] = digits[x % base];
+ 630:	89 c8                	mov    %ecx,%eax
+ 632:	31 d2                	xor    %edx,%edx
+ 634:	89 f7                	mov    %esi,%edi
+ 636:	f7 f3                	div    %ebx
+ 638:	8d 76 01             	lea    0x1(%esi),%esi
+ 63b:	0f b6 92 50 0c 00 00 	movzbl 0xc50(%edx),%edx
+ 642:	88 54 35 d7          	mov    %dl,-0x29(%ebp,%esi,1)
+  }while((x /= base) != 0);
+ 646:	89 ca                	mov    %ecx,%edx
+ 648:	89 c1                	mov    %eax,%ecx
+ 64a:	39 da                	cmp    %ebx,%edx
+ 64c:	73 e2                	jae    630 <printint+0x30>
+  if(neg)
+ 64e:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+ 651:	85 c0                	test   %eax,%eax
+ 653:	74 07                	je     65c <printint+0x5c>
+    buf[i++] = '-';
+ 655:	c6 44 35 d8 2d       	movb   $0x2d,-0x28(%ebp,%esi,1)
+    buf[i++] = digits[x % base];
+ 65a:	89 f7                	mov    %esi,%edi
+ 65c:	8d 5d d8             	lea    -0x28(%ebp),%ebx
+ 65f:	8b 75 c0             	mov    -0x40(%ebp),%esi
+ 662:	01 df                	add    %ebx,%edi
+ 664:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+  while(--i >= 0)
+    putc(fd, buf[i]);
+ 668:	0f b6 07             	movzbl (%edi),%eax
+  write(fd, &c, 1);
+ 66b:	83 ec 04             	sub    $0x4,%esp
+ 66e:	88 45 d7             	mov    %al,-0x29(%ebp)
+ 671:	8d 45 d7             	lea    -0x29(%ebp),%eax
+ 674:	6a 01                	push   $0x1
+ 676:	50                   	push   %eax
+ 677:	56                   	push   %esi
+ 678:	e8 86 fe ff ff       	call   503 <write>
+  while(--i >= 0)
+ 67d:	89 f8                	mov    %edi,%eax
+ 67f:	83 c4 10             	add    $0x10,%esp
+ 682:	83 ef 01             	sub    $0x1,%edi
+ 685:	39 d8                	cmp    %ebx,%eax
+ 687:	75 df                	jne    668 <printint+0x68>
+}
+ 689:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 68c:	5b                   	pop    %ebx
+ 68d:	5e                   	pop    %esi
+ 68e:	5f                   	pop    %edi
+ 68f:	5d                   	pop    %ebp
+ 690:	c3                   	ret
+ 691:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  neg = 0;
+ 698:	31 c0                	xor    %eax,%eax
+ 69a:	eb 89                	jmp    625 <printint+0x25>
+ 69c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000006a0 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, const char *fmt, ...)
+{
+ 6a0:	55                   	push   %ebp
+ 6a1:	89 e5                	mov    %esp,%ebp
+ 6a3:	57                   	push   %edi
+ 6a4:	56                   	push   %esi
+ 6a5:	53                   	push   %ebx
+ 6a6:	83 ec 2c             	sub    $0x2c,%esp
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+  ap = (uint*)(void*)&fmt + 1;
+  for(i = 0; fmt[i]; i++){
+ 6a9:	8b 75 0c             	mov    0xc(%ebp),%esi
+{
+ 6ac:	8b 7d 08             	mov    0x8(%ebp),%edi
+  for(i = 0; fmt[i]; i++){
+ 6af:	0f b6 1e             	movzbl (%esi),%ebx
+ 6b2:	83 c6 01             	add    $0x1,%esi
+ 6b5:	84 db                	test   %bl,%bl
+ 6b7:	74 67                	je     720 <printf+0x80>
+ 6b9:	8d 4d 10             	lea    0x10(%ebp),%ecx
+ 6bc:	31 d2                	xor    %edx,%edx
+ 6be:	89 4d d0             	mov    %ecx,-0x30(%ebp)
+ 6c1:	eb 34                	jmp    6f7 <printf+0x57>
+ 6c3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 6c7:	90                   	nop
+ 6c8:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+        state = '%';
+ 6cb:	ba 25 00 00 00       	mov    $0x25,%edx
+      if(c == '%'){
+ 6d0:	83 f8 25             	cmp    $0x25,%eax
+ 6d3:	74 18                	je     6ed <printf+0x4d>
+  write(fd, &c, 1);
+ 6d5:	83 ec 04             	sub    $0x4,%esp
+ 6d8:	8d 45 e7             	lea    -0x19(%ebp),%eax
+ 6db:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 6de:	6a 01                	push   $0x1
+ 6e0:	50                   	push   %eax
+ 6e1:	57                   	push   %edi
+ 6e2:	e8 1c fe ff ff       	call   503 <write>
+ 6e7:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+      } else {
+        putc(fd, c);
+ 6ea:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; fmt[i]; i++){
+ 6ed:	0f b6 1e             	movzbl (%esi),%ebx
+ 6f0:	83 c6 01             	add    $0x1,%esi
+ 6f3:	84 db                	test   %bl,%bl
+ 6f5:	74 29                	je     720 <printf+0x80>
+    c = fmt[i] & 0xff;
+ 6f7:	0f b6 c3             	movzbl %bl,%eax
+    if(state == 0){
+ 6fa:	85 d2                	test   %edx,%edx
+ 6fc:	74 ca                	je     6c8 <printf+0x28>
+      }
+    } else if(state == '%'){
+ 6fe:	83 fa 25             	cmp    $0x25,%edx
+ 701:	75 ea                	jne    6ed <printf+0x4d>
+      if(c == 'd'){
+ 703:	83 f8 25             	cmp    $0x25,%eax
+ 706:	0f 84 24 01 00 00    	je     830 <printf+0x190>
+ 70c:	83 e8 63             	sub    $0x63,%eax
+ 70f:	83 f8 15             	cmp    $0x15,%eax
+ 712:	77 1c                	ja     730 <printf+0x90>
+ 714:	ff 24 85 f8 0b 00 00 	jmp    *0xbf8(,%eax,4)
+ 71b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 71f:	90                   	nop
+        putc(fd, c);
+      }
+      state = 0;
+    }
+  }
+}
+ 720:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 723:	5b                   	pop    %ebx
+ 724:	5e                   	pop    %esi
+ 725:	5f                   	pop    %edi
+ 726:	5d                   	pop    %ebp
+ 727:	c3                   	ret
+ 728:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 72f:	90                   	nop
+  write(fd, &c, 1);
+ 730:	83 ec 04             	sub    $0x4,%esp
+ 733:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 736:	c6 45 e7 25          	movb   $0x25,-0x19(%ebp)
+ 73a:	6a 01                	push   $0x1
+ 73c:	52                   	push   %edx
+ 73d:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+ 740:	57                   	push   %edi
+ 741:	e8 bd fd ff ff       	call   503 <write>
+ 746:	83 c4 0c             	add    $0xc,%esp
+ 749:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 74c:	6a 01                	push   $0x1
+ 74e:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+ 751:	52                   	push   %edx
+ 752:	57                   	push   %edi
+ 753:	e8 ab fd ff ff       	call   503 <write>
+        putc(fd, c);
+ 758:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 75b:	31 d2                	xor    %edx,%edx
+ 75d:	eb 8e                	jmp    6ed <printf+0x4d>
+ 75f:	90                   	nop
+        printint(fd, *ap, 16, 0);
+ 760:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+ 763:	83 ec 0c             	sub    $0xc,%esp
+ 766:	b9 10 00 00 00       	mov    $0x10,%ecx
+ 76b:	8b 13                	mov    (%ebx),%edx
+ 76d:	6a 00                	push   $0x0
+ 76f:	89 f8                	mov    %edi,%eax
+        ap++;
+ 771:	83 c3 04             	add    $0x4,%ebx
+        printint(fd, *ap, 16, 0);
+ 774:	e8 87 fe ff ff       	call   600 <printint>
+        ap++;
+ 779:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+ 77c:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 77f:	31 d2                	xor    %edx,%edx
+ 781:	e9 67 ff ff ff       	jmp    6ed <printf+0x4d>
+ 786:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 78d:	8d 76 00             	lea    0x0(%esi),%esi
+        s = (char*)*ap;
+ 790:	8b 45 d0             	mov    -0x30(%ebp),%eax
+ 793:	8b 18                	mov    (%eax),%ebx
+        ap++;
+ 795:	83 c0 04             	add    $0x4,%eax
+ 798:	89 45 d0             	mov    %eax,-0x30(%ebp)
+        if(s == 0)
+ 79b:	85 db                	test   %ebx,%ebx
+ 79d:	0f 84 9d 00 00 00    	je     840 <printf+0x1a0>
+        while(*s != 0){
+ 7a3:	0f b6 03             	movzbl (%ebx),%eax
+      state = 0;
+ 7a6:	31 d2                	xor    %edx,%edx
+        while(*s != 0){
+ 7a8:	84 c0                	test   %al,%al
+ 7aa:	0f 84 3d ff ff ff    	je     6ed <printf+0x4d>
+ 7b0:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 7b3:	89 75 d4             	mov    %esi,-0x2c(%ebp)
+ 7b6:	89 de                	mov    %ebx,%esi
+ 7b8:	89 d3                	mov    %edx,%ebx
+ 7ba:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  write(fd, &c, 1);
+ 7c0:	83 ec 04             	sub    $0x4,%esp
+ 7c3:	88 45 e7             	mov    %al,-0x19(%ebp)
+          s++;
+ 7c6:	83 c6 01             	add    $0x1,%esi
+  write(fd, &c, 1);
+ 7c9:	6a 01                	push   $0x1
+ 7cb:	53                   	push   %ebx
+ 7cc:	57                   	push   %edi
+ 7cd:	e8 31 fd ff ff       	call   503 <write>
+        while(*s != 0){
+ 7d2:	0f b6 06             	movzbl (%esi),%eax
+ 7d5:	83 c4 10             	add    $0x10,%esp
+ 7d8:	84 c0                	test   %al,%al
+ 7da:	75 e4                	jne    7c0 <printf+0x120>
+      state = 0;
+ 7dc:	8b 75 d4             	mov    -0x2c(%ebp),%esi
+ 7df:	31 d2                	xor    %edx,%edx
+ 7e1:	e9 07 ff ff ff       	jmp    6ed <printf+0x4d>
+ 7e6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 7ed:	8d 76 00             	lea    0x0(%esi),%esi
+        printint(fd, *ap, 10, 1);
+ 7f0:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+ 7f3:	83 ec 0c             	sub    $0xc,%esp
+ 7f6:	b9 0a 00 00 00       	mov    $0xa,%ecx
+ 7fb:	8b 13                	mov    (%ebx),%edx
+ 7fd:	6a 01                	push   $0x1
+ 7ff:	e9 6b ff ff ff       	jmp    76f <printf+0xcf>
+ 804:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+        putc(fd, *ap);
+ 808:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  write(fd, &c, 1);
+ 80b:	83 ec 04             	sub    $0x4,%esp
+ 80e:	8d 55 e7             	lea    -0x19(%ebp),%edx
+        putc(fd, *ap);
+ 811:	8b 03                	mov    (%ebx),%eax
+        ap++;
+ 813:	83 c3 04             	add    $0x4,%ebx
+        putc(fd, *ap);
+ 816:	88 45 e7             	mov    %al,-0x19(%ebp)
+  write(fd, &c, 1);
+ 819:	6a 01                	push   $0x1
+ 81b:	52                   	push   %edx
+ 81c:	57                   	push   %edi
+ 81d:	e8 e1 fc ff ff       	call   503 <write>
+        ap++;
+ 822:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+ 825:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 828:	31 d2                	xor    %edx,%edx
+ 82a:	e9 be fe ff ff       	jmp    6ed <printf+0x4d>
+ 82f:	90                   	nop
+  write(fd, &c, 1);
+ 830:	83 ec 04             	sub    $0x4,%esp
+ 833:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 836:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 839:	6a 01                	push   $0x1
+ 83b:	e9 11 ff ff ff       	jmp    751 <printf+0xb1>
+ 840:	b8 28 00 00 00       	mov    $0x28,%eax
+          s = "(null)";
+ 845:	bb ef 0b 00 00       	mov    $0xbef,%ebx
+ 84a:	e9 61 ff ff ff       	jmp    7b0 <printf+0x110>
+ 84f:	90                   	nop
+
+00000850 <free>:
+static Header base;
+static Header *freep;
+
+void
+free(void *ap)
+{
+ 850:	55                   	push   %ebp
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 851:	a1 f8 0e 00 00       	mov    0xef8,%eax
+{
+ 856:	89 e5                	mov    %esp,%ebp
+ 858:	57                   	push   %edi
+ 859:	56                   	push   %esi
+ 85a:	53                   	push   %ebx
+ 85b:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  bp = (Header*)ap - 1;
+ 85e:	8d 4b f8             	lea    -0x8(%ebx),%ecx
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 861:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 868:	89 c2                	mov    %eax,%edx
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 86a:	8b 00                	mov    (%eax),%eax
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 86c:	39 ca                	cmp    %ecx,%edx
+ 86e:	73 30                	jae    8a0 <free+0x50>
+ 870:	39 c1                	cmp    %eax,%ecx
+ 872:	72 04                	jb     878 <free+0x28>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 874:	39 c2                	cmp    %eax,%edx
+ 876:	72 f0                	jb     868 <free+0x18>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+ 878:	8b 73 fc             	mov    -0x4(%ebx),%esi
+ 87b:	8d 3c f1             	lea    (%ecx,%esi,8),%edi
+ 87e:	39 f8                	cmp    %edi,%eax
+ 880:	74 2e                	je     8b0 <free+0x60>
+    bp->s.size += p->s.ptr->s.size;
+    bp->s.ptr = p->s.ptr->s.ptr;
+ 882:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  } else
+    bp->s.ptr = p->s.ptr;
+  if(p + p->s.size == bp){
+ 885:	8b 42 04             	mov    0x4(%edx),%eax
+ 888:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+ 88b:	39 f1                	cmp    %esi,%ecx
+ 88d:	74 38                	je     8c7 <free+0x77>
+    p->s.size += bp->s.size;
+    p->s.ptr = bp->s.ptr;
+ 88f:	89 0a                	mov    %ecx,(%edx)
+  } else
+    p->s.ptr = bp;
+  freep = p;
+}
+ 891:	5b                   	pop    %ebx
+  freep = p;
+ 892:	89 15 f8 0e 00 00    	mov    %edx,0xef8
+}
+ 898:	5e                   	pop    %esi
+ 899:	5f                   	pop    %edi
+ 89a:	5d                   	pop    %ebp
+ 89b:	c3                   	ret
+ 89c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 8a0:	39 c1                	cmp    %eax,%ecx
+ 8a2:	72 d0                	jb     874 <free+0x24>
+ 8a4:	eb c2                	jmp    868 <free+0x18>
+ 8a6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 8ad:	8d 76 00             	lea    0x0(%esi),%esi
+    bp->s.size += p->s.ptr->s.size;
+ 8b0:	03 70 04             	add    0x4(%eax),%esi
+ 8b3:	89 73 fc             	mov    %esi,-0x4(%ebx)
+    bp->s.ptr = p->s.ptr->s.ptr;
+ 8b6:	8b 02                	mov    (%edx),%eax
+ 8b8:	8b 00                	mov    (%eax),%eax
+ 8ba:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  if(p + p->s.size == bp){
+ 8bd:	8b 42 04             	mov    0x4(%edx),%eax
+ 8c0:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+ 8c3:	39 f1                	cmp    %esi,%ecx
+ 8c5:	75 c8                	jne    88f <free+0x3f>
+    p->s.size += bp->s.size;
+ 8c7:	03 43 fc             	add    -0x4(%ebx),%eax
+  freep = p;
+ 8ca:	89 15 f8 0e 00 00    	mov    %edx,0xef8
+    p->s.size += bp->s.size;
+ 8d0:	89 42 04             	mov    %eax,0x4(%edx)
+    p->s.ptr = bp->s.ptr;
+ 8d3:	8b 4b f8             	mov    -0x8(%ebx),%ecx
+ 8d6:	89 0a                	mov    %ecx,(%edx)
+}
+ 8d8:	5b                   	pop    %ebx
+ 8d9:	5e                   	pop    %esi
+ 8da:	5f                   	pop    %edi
+ 8db:	5d                   	pop    %ebp
+ 8dc:	c3                   	ret
+ 8dd:	8d 76 00             	lea    0x0(%esi),%esi
+
+000008e0 <malloc>:
+  return freep;
+}
+
+void*
+malloc(uint nbytes)
+{
+ 8e0:	55                   	push   %ebp
+ 8e1:	89 e5                	mov    %esp,%ebp
+ 8e3:	57                   	push   %edi
+ 8e4:	56                   	push   %esi
+ 8e5:	53                   	push   %ebx
+ 8e6:	83 ec 0c             	sub    $0xc,%esp
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ 8e9:	8b 45 08             	mov    0x8(%ebp),%eax
+  if((prevp = freep) == 0){
+ 8ec:	8b 15 f8 0e 00 00    	mov    0xef8,%edx
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ 8f2:	8d 78 07             	lea    0x7(%eax),%edi
+ 8f5:	c1 ef 03             	shr    $0x3,%edi
+ 8f8:	83 c7 01             	add    $0x1,%edi
+  if((prevp = freep) == 0){
+ 8fb:	85 d2                	test   %edx,%edx
+ 8fd:	0f 84 8d 00 00 00    	je     990 <malloc+0xb0>
+    base.s.ptr = freep = prevp = &base;
+    base.s.size = 0;
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ 903:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+ 905:	8b 48 04             	mov    0x4(%eax),%ecx
+ 908:	39 f9                	cmp    %edi,%ecx
+ 90a:	73 64                	jae    970 <malloc+0x90>
+  if(nu < 4096)
+ 90c:	bb 00 10 00 00       	mov    $0x1000,%ebx
+ 911:	39 df                	cmp    %ebx,%edi
+ 913:	0f 43 df             	cmovae %edi,%ebx
+  p = sbrk(nu * sizeof(Header));
+ 916:	8d 34 dd 00 00 00 00 	lea    0x0(,%ebx,8),%esi
+ 91d:	eb 0a                	jmp    929 <malloc+0x49>
+ 91f:	90                   	nop
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ 920:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+ 922:	8b 48 04             	mov    0x4(%eax),%ecx
+ 925:	39 f9                	cmp    %edi,%ecx
+ 927:	73 47                	jae    970 <malloc+0x90>
+        p->s.size = nunits;
+      }
+      freep = prevp;
+      return (void*)(p + 1);
+    }
+    if(p == freep)
+ 929:	89 c2                	mov    %eax,%edx
+ 92b:	39 05 f8 0e 00 00    	cmp    %eax,0xef8
+ 931:	75 ed                	jne    920 <malloc+0x40>
+  p = sbrk(nu * sizeof(Header));
+ 933:	83 ec 0c             	sub    $0xc,%esp
+ 936:	56                   	push   %esi
+ 937:	e8 2f fc ff ff       	call   56b <sbrk>
+  if(p == (char*)-1)
+ 93c:	83 c4 10             	add    $0x10,%esp
+ 93f:	83 f8 ff             	cmp    $0xffffffff,%eax
+ 942:	74 1c                	je     960 <malloc+0x80>
+  hp->s.size = nu;
+ 944:	89 58 04             	mov    %ebx,0x4(%eax)
+  free((void*)(hp + 1));
+ 947:	83 ec 0c             	sub    $0xc,%esp
+ 94a:	83 c0 08             	add    $0x8,%eax
+ 94d:	50                   	push   %eax
+ 94e:	e8 fd fe ff ff       	call   850 <free>
+  return freep;
+ 953:	8b 15 f8 0e 00 00    	mov    0xef8,%edx
+      if((p = morecore(nunits)) == 0)
+ 959:	83 c4 10             	add    $0x10,%esp
+ 95c:	85 d2                	test   %edx,%edx
+ 95e:	75 c0                	jne    920 <malloc+0x40>
+        return 0;
+  }
+}
+ 960:	8d 65 f4             	lea    -0xc(%ebp),%esp
+        return 0;
+ 963:	31 c0                	xor    %eax,%eax
+}
+ 965:	5b                   	pop    %ebx
+ 966:	5e                   	pop    %esi
+ 967:	5f                   	pop    %edi
+ 968:	5d                   	pop    %ebp
+ 969:	c3                   	ret
+ 96a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+      if(p->s.size == nunits)
+ 970:	39 cf                	cmp    %ecx,%edi
+ 972:	74 4c                	je     9c0 <malloc+0xe0>
+        p->s.size -= nunits;
+ 974:	29 f9                	sub    %edi,%ecx
+ 976:	89 48 04             	mov    %ecx,0x4(%eax)
+        p += p->s.size;
+ 979:	8d 04 c8             	lea    (%eax,%ecx,8),%eax
+        p->s.size = nunits;
+ 97c:	89 78 04             	mov    %edi,0x4(%eax)
+      freep = prevp;
+ 97f:	89 15 f8 0e 00 00    	mov    %edx,0xef8
+}
+ 985:	8d 65 f4             	lea    -0xc(%ebp),%esp
+      return (void*)(p + 1);
+ 988:	83 c0 08             	add    $0x8,%eax
+}
+ 98b:	5b                   	pop    %ebx
+ 98c:	5e                   	pop    %esi
+ 98d:	5f                   	pop    %edi
+ 98e:	5d                   	pop    %ebp
+ 98f:	c3                   	ret
+    base.s.ptr = freep = prevp = &base;
+ 990:	c7 05 f8 0e 00 00 fc 	movl   $0xefc,0xef8
+ 997:	0e 00 00 
+    base.s.size = 0;
+ 99a:	b8 fc 0e 00 00       	mov    $0xefc,%eax
+    base.s.ptr = freep = prevp = &base;
+ 99f:	c7 05 fc 0e 00 00 fc 	movl   $0xefc,0xefc
+ 9a6:	0e 00 00 
+    base.s.size = 0;
+ 9a9:	c7 05 00 0f 00 00 00 	movl   $0x0,0xf00
+ 9b0:	00 00 00 
+    if(p->s.size >= nunits){
+ 9b3:	e9 54 ff ff ff       	jmp    90c <malloc+0x2c>
+ 9b8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 9bf:	90                   	nop
+        prevp->s.ptr = p->s.ptr;
+ 9c0:	8b 08                	mov    (%eax),%ecx
+ 9c2:	89 0a                	mov    %ecx,(%edx)
+ 9c4:	eb b9                	jmp    97f <malloc+0x9f>
@@ -4,7 +4,7 @@
 
 // Small test program for SPAS scheduler
 // - forks `NCHILD` CPU-bound workers
-// - parent periodically calls cpustat() and prints scheduler state
+// - parent prints scheduler state after every analytics period
 // Usage: spas_test [nchildren]
 
 #define DEFAULT_CHILDREN 4
@@ -44,14 +44,15 @@ main(int argc, char *argv[])
   }
 
   // Parent: print cpustat reports
-  struct cpustat st;
+  struct telemetry st;
+  uint seq = 0;
   int rep;
   for(rep = 0; rep < REPORTS; rep++){
-    if(cpustat(&st) < 0){
-      printf(2, "spas_test: cpustat failed\n");
+    if(telemetry(&seq, &st, 1) != 1){
+      printf(2, "spas_test: telemetry failed\n");
       break;
     }
-    printf(1, "--- SPAS Test Report %d/%d ---\n", rep+1, REPORTS);
+    printf(1, "--- SPAS Test Report %d/%d (tick %d) ---\n", rep+1, REPORTS, st.tick);
     printf(1, "CPU Load:       %d%%\n", st.load);
     printf(1, "Predicted Load: %d%%\n", st.predicted_load);
     char *freq[] = { "LOW", "MEDIUM", "HIGH" };
@@ -73,8 +74,6 @@ main(int argc, char *argv[])
       printf(1, "Note: watch Frequency and Virtual Temp — with busy children Frequency should increase and temp should rise.\n");
       printf(1, "If Frequency moves LOW->MEDIUM->HIGH as load rises, dynamic time quanta assignment is active.\n");
     }
-
-    sleep(100); // sleep 1 second
   }
 
   // Wait for children to finish
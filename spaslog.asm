@@ -0,0 +1,1717 @@
+
+_spaslog:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+  return 0;
+}
+
+int
+main(int argc, char *argv[])
+{
+   0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+   4:	83 e4 f0             	and    $0xfffffff0,%esp
+   7:	ff 71 fc             	push   -0x4(%ecx)
+   a:	55                   	push   %ebp
+   b:	89 e5                	mov    %esp,%ebp
+   d:	57                   	push   %edi
+   e:	56                   	push   %esi
+   f:	53                   	push   %ebx
+  10:	51                   	push   %ecx
+  11:	83 ec 28             	sub    $0x28,%esp
+  14:	8b 01                	mov    (%ecx),%eax
+  16:	8b 49 04             	mov    0x4(%ecx),%ecx
+  char *name;
+  int i, n, limit, logged, period;
+  uint seq;
+
+  path = "spas.log";
+  limit = 0;
+  19:	c7 45 d4 00 00 00 00 	movl   $0x0,-0x2c(%ebp)
+  path = "spas.log";
+  20:	c7 05 e8 10 00 00 d8 	movl   $0xcd8,0x10e8
+  27:	0c 00 00 
+{
+  2a:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  for(i = 1; i < argc; i++){
+  2d:	83 f8 01             	cmp    $0x1,%eax
+  30:	7e 48                	jle    7a <main+0x7a>
+  32:	89 4d cc             	mov    %ecx,-0x34(%ebp)
+  35:	bb 01 00 00 00       	mov    $0x1,%ebx
+  3a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    if(strcmp(argv[i], "-n") == 0 && i + 1 < argc)
+  40:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  43:	8d 3c 9d 00 00 00 00 	lea    0x0(,%ebx,4),%edi
+  4a:	83 ec 08             	sub    $0x8,%esp
+  4d:	68 e1 0c 00 00       	push   $0xce1
+  52:	8d 34 38             	lea    (%eax,%edi,1),%esi
+  55:	ff 36                	push   (%esi)
+  57:	e8 34 05 00 00       	call   590 <strcmp>
+  5c:	8d 4b 01             	lea    0x1(%ebx),%ecx
+  5f:	83 c4 10             	add    $0x10,%esp
+  62:	85 c0                	test   %eax,%eax
+  64:	0f 85 fe 01 00 00    	jne    268 <main+0x268>
+  6a:	39 4d d0             	cmp    %ecx,-0x30(%ebp)
+  6d:	0f 8f 0d 02 00 00    	jg     280 <main+0x280>
+      limit = atoi(argv[++i]);
+    else
+      path = argv[i];
+  73:	8b 06                	mov    (%esi),%eax
+  75:	a3 e8 10 00 00       	mov    %eax,0x10e8
+  }
+
+  if(strlen(path) > DIRSIZ){
+  7a:	83 ec 0c             	sub    $0xc,%esp
+  7d:	ff 35 e8 10 00 00    	push   0x10e8
+  83:	e8 68 05 00 00       	call   5f0 <strlen>
+  88:	83 c4 10             	add    $0x10,%esp
+  8b:	89 c2                	mov    %eax,%edx
+  8d:	31 c0                	xor    %eax,%eax
+  8f:	83 fa 0e             	cmp    $0xe,%edx
+  92:	76 37                	jbe    cb <main+0xcb>
+  94:	e9 6d 02 00 00       	jmp    306 <main+0x306>
+  99:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    exit();
+  }
+
+  // Find the last existing segment and append to it.
+  for(seg = 0; (name = segname(seg + 1)) != 0; seg++){
+    if((fd = open(name, O_RDONLY)) < 0)
+  a0:	83 ec 08             	sub    $0x8,%esp
+  a3:	6a 00                	push   $0x0
+  a5:	50                   	push   %eax
+  a6:	e8 38 07 00 00       	call   7e3 <open>
+  ab:	83 c4 10             	add    $0x10,%esp
+  ae:	a3 d4 10 00 00       	mov    %eax,0x10d4
+  b3:	85 c0                	test   %eax,%eax
+  b5:	78 25                	js     dc <main+0xdc>
+      break;
+    close(fd);
+  b7:	83 ec 0c             	sub    $0xc,%esp
+  ba:	50                   	push   %eax
+  bb:	e8 0b 07 00 00       	call   7cb <close>
+  for(seg = 0; (name = segname(seg + 1)) != 0; seg++){
+  c0:	a1 e4 10 00 00       	mov    0x10e4,%eax
+  c5:	83 c4 10             	add    $0x10,%esp
+  c8:	83 c0 01             	add    $0x1,%eax
+  cb:	a3 e4 10 00 00       	mov    %eax,0x10e4
+  d0:	83 c0 01             	add    $0x1,%eax
+  d3:	e8 68 02 00 00       	call   340 <segname>
+  d8:	85 c0                	test   %eax,%eax
+  da:	75 c4                	jne    a0 <main+0xa0>
+  }
+  fd = -1;
+  dc:	c7 05 d4 10 00 00 ff 	movl   $0xffffffff,0x10d4
+  e3:	ff ff ff 
+  if(openseg() < 0)
+  e6:	e8 15 03 00 00       	call   400 <openseg>
+  eb:	85 c0                	test   %eax,%eax
+  ed:	0f 88 6c 01 00 00    	js     25f <main+0x25f>
+    exit();
+  if(sysctl(-1, "load_period", &period, 0) < 0)
+  f3:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  f6:	6a 00                	push   $0x0
+  f8:	50                   	push   %eax
+  f9:	68 00 0d 00 00       	push   $0xd00
+  fe:	6a ff                	push   $0xffffffff
+ 100:	e8 66 07 00 00       	call   86b <sysctl>
+ 105:	83 c4 10             	add    $0x10,%esp
+ 108:	85 c0                	test   %eax,%eax
+ 10a:	79 07                	jns    113 <main+0x113>
+    period = 100;
+ 10c:	c7 45 e0 64 00 00 00 	movl   $0x64,-0x20(%ebp)
+
+  seq = 0;
+  logged = 0;
+  while(limit == 0 || logged < limit){
+ 113:	8b 75 d4             	mov    -0x2c(%ebp),%esi
+  seq = 0;
+ 116:	31 db                	xor    %ebx,%ebx
+  logged = 0;
+ 118:	bf 00 00 00 00       	mov    $0x0,%edi
+  seq = 0;
+ 11d:	89 5d e4             	mov    %ebx,-0x1c(%ebp)
+  while(limit == 0 || logged < limit){
+ 120:	85 f6                	test   %esi,%esi
+ 122:	0f 94 45 cc          	sete   -0x34(%ebp)
+ 126:	0f 88 99 01 00 00    	js     2c5 <main+0x2c5>
+    if((n = telemetry(&seq, rec, NTELEMETRY)) < 0){
+ 12c:	83 ec 04             	sub    $0x4,%esp
+ 12f:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+ 132:	6a 40                	push   $0x40
+ 134:	68 00 11 00 00       	push   $0x1100
+ 139:	50                   	push   %eax
+ 13a:	e8 34 07 00 00       	call   873 <telemetry>
+ 13f:	83 c4 10             	add    $0x10,%esp
+ 142:	85 c0                	test   %eax,%eax
+ 144:	0f 88 d4 01 00 00    	js     31e <main+0x31e>
+      printf(2, "spaslog: telemetry failed\n");
+      break;
+    }
+    for(i = 0; i < n && (limit == 0 || logged < limit); i++, logged++){
+ 14a:	8b 75 d4             	mov    -0x2c(%ebp),%esi
+ 14d:	39 f7                	cmp    %esi,%edi
+ 14f:	0f 9c c2             	setl   %dl
+ 152:	0a 55 cc             	or     -0x34(%ebp),%dl
+ 155:	85 c0                	test   %eax,%eax
+ 157:	0f 84 5b 01 00 00    	je     2b8 <main+0x2b8>
+ 15d:	84 d2                	test   %dl,%dl
+ 15f:	0f 84 60 01 00 00    	je     2c5 <main+0x2c5>
+ 165:	01 f8                	add    %edi,%eax
+ 167:	bb 00 11 00 00       	mov    $0x1100,%ebx
+ 16c:	89 45 c8             	mov    %eax,-0x38(%ebp)
+ 16f:	eb 2b                	jmp    19c <main+0x19c>
+ 171:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 178:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+ 17b:	83 c7 01             	add    $0x1,%edi
+ 17e:	8b 75 c8             	mov    -0x38(%ebp),%esi
+ 181:	39 c7                	cmp    %eax,%edi
+ 183:	0f 9c c0             	setl   %al
+ 186:	0a 45 cc             	or     -0x34(%ebp),%al
+ 189:	39 f7                	cmp    %esi,%edi
+ 18b:	0f 84 27 01 00 00    	je     2b8 <main+0x2b8>
+ 191:	83 c3 30             	add    $0x30,%ebx
+ 194:	84 c0                	test   %al,%al
+ 196:	0f 84 29 01 00 00    	je     2c5 <main+0x2c5>
+      if(rec[i].dropped)
+ 19c:	8b 43 04             	mov    0x4(%ebx),%eax
+ 19f:	85 c0                	test   %eax,%eax
+ 1a1:	0f 85 f9 00 00 00    	jne    2a0 <main+0x2a0>
+  b = &batch[nblk];
+ 1a7:	a1 00 1d 00 00       	mov    0x1d00,%eax
+  b->rec[b->hdr.nrec++] = *t;
+ 1ac:	8b 0b                	mov    (%ebx),%ecx
+  b = &batch[nblk];
+ 1ae:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  b->hdr.magic = SPASLOG_MAGIC;
+ 1b1:	c1 e0 09             	shl    $0x9,%eax
+ 1b4:	c7 80 20 1d 00 00 53 	movl   $0x474c5053,0x1d20(%eax)
+ 1bb:	50 4c 47 
+  b->rec[b->hdr.nrec++] = *t;
+ 1be:	8b 90 24 1d 00 00    	mov    0x1d24(%eax),%edx
+  b->hdr.recsize = sizeof(struct telemetry);
+ 1c4:	c7 80 28 1d 00 00 30 	movl   $0x30,0x1d28(%eax)
+ 1cb:	00 00 00 
+  b->rec[b->hdr.nrec++] = *t;
+ 1ce:	8d 72 01             	lea    0x1(%edx),%esi
+ 1d1:	8d 14 52             	lea    (%edx,%edx,2),%edx
+ 1d4:	c1 e2 04             	shl    $0x4,%edx
+ 1d7:	89 b0 24 1d 00 00    	mov    %esi,0x1d24(%eax)
+ 1dd:	01 c2                	add    %eax,%edx
+ 1df:	89 8a 30 1d 00 00    	mov    %ecx,0x1d30(%edx)
+ 1e5:	8d 82 30 1d 00 00    	lea    0x1d30(%edx),%eax
+ 1eb:	8b 53 04             	mov    0x4(%ebx),%edx
+ 1ee:	89 50 04             	mov    %edx,0x4(%eax)
+ 1f1:	8b 53 08             	mov    0x8(%ebx),%edx
+ 1f4:	89 50 08             	mov    %edx,0x8(%eax)
+ 1f7:	8b 53 0c             	mov    0xc(%ebx),%edx
+ 1fa:	89 50 0c             	mov    %edx,0xc(%eax)
+ 1fd:	8b 53 10             	mov    0x10(%ebx),%edx
+ 200:	89 50 10             	mov    %edx,0x10(%eax)
+ 203:	8b 53 14             	mov    0x14(%ebx),%edx
+ 206:	89 50 14             	mov    %edx,0x14(%eax)
+ 209:	8b 53 18             	mov    0x18(%ebx),%edx
+ 20c:	89 50 18             	mov    %edx,0x18(%eax)
+ 20f:	8b 53 1c             	mov    0x1c(%ebx),%edx
+ 212:	89 50 1c             	mov    %edx,0x1c(%eax)
+ 215:	8b 53 20             	mov    0x20(%ebx),%edx
+ 218:	89 50 20             	mov    %edx,0x20(%eax)
+ 21b:	8b 53 24             	mov    0x24(%ebx),%edx
+ 21e:	89 50 24             	mov    %edx,0x24(%eax)
+ 221:	8b 53 28             	mov    0x28(%ebx),%edx
+ 224:	89 50 28             	mov    %edx,0x28(%eax)
+ 227:	8b 53 2c             	mov    0x2c(%ebx),%edx
+ 22a:	89 50 2c             	mov    %edx,0x2c(%eax)
+  if(b->hdr.nrec == SPASLOG_NREC && ++nblk == BATCH){
+ 22d:	83 fe 0a             	cmp    $0xa,%esi
+ 230:	0f 85 42 ff ff ff    	jne    178 <main+0x178>
+ 236:	8b 45 d0             	mov    -0x30(%ebp),%eax
+ 239:	83 c0 01             	add    $0x1,%eax
+ 23c:	a3 00 1d 00 00       	mov    %eax,0x1d00
+ 241:	83 f8 03             	cmp    $0x3,%eax
+ 244:	0f 85 2e ff ff ff    	jne    178 <main+0x178>
+    nblk = 0;
+ 24a:	31 d2                	xor    %edx,%edx
+ 24c:	89 15 00 1d 00 00    	mov    %edx,0x1d00
+    return flush(BATCH);
+ 252:	e8 69 02 00 00       	call   4c0 <flush>
+        printf(2, "spaslog: %d samples dropped\n", rec[i].dropped);
+      if(add(&rec[i]) < 0)
+ 257:	85 c0                	test   %eax,%eax
+ 259:	0f 89 19 ff ff ff    	jns    178 <main+0x178>
+    exit();
+ 25f:	e8 3f 05 00 00       	call   7a3 <exit>
+ 264:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+      path = argv[i];
+ 268:	8b 06                	mov    (%esi),%eax
+ 26a:	89 cb                	mov    %ecx,%ebx
+ 26c:	a3 e8 10 00 00       	mov    %eax,0x10e8
+  for(i = 1; i < argc; i++){
+ 271:	39 5d d0             	cmp    %ebx,-0x30(%ebp)
+ 274:	0f 8f c6 fd ff ff    	jg     40 <main+0x40>
+ 27a:	e9 fb fd ff ff       	jmp    7a <main+0x7a>
+ 27f:	90                   	nop
+      limit = atoi(argv[++i]);
+ 280:	8b 45 cc             	mov    -0x34(%ebp),%eax
+ 283:	83 ec 0c             	sub    $0xc,%esp
+  for(i = 1; i < argc; i++){
+ 286:	83 c3 02             	add    $0x2,%ebx
+      limit = atoi(argv[++i]);
+ 289:	ff 74 38 04          	push   0x4(%eax,%edi,1)
+ 28d:	e8 9e 04 00 00       	call   730 <atoi>
+ 292:	83 c4 10             	add    $0x10,%esp
+ 295:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+ 298:	eb d7                	jmp    271 <main+0x271>
+ 29a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+        printf(2, "spaslog: %d samples dropped\n", rec[i].dropped);
+ 2a0:	83 ec 04             	sub    $0x4,%esp
+ 2a3:	50                   	push   %eax
+ 2a4:	68 27 0d 00 00       	push   $0xd27
+ 2a9:	6a 02                	push   $0x2
+ 2ab:	e8 b0 06 00 00       	call   960 <printf>
+ 2b0:	83 c4 10             	add    $0x10,%esp
+ 2b3:	e9 ef fe ff ff       	jmp    1a7 <main+0x1a7>
+        exit();
+    }
+    if(limit == 0 || logged < limit)
+ 2b8:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+ 2bb:	39 c7                	cmp    %eax,%edi
+ 2bd:	7c 32                	jl     2f1 <main+0x2f1>
+ 2bf:	80 7d cc 00          	cmpb   $0x0,-0x34(%ebp)
+ 2c3:	75 2c                	jne    2f1 <main+0x2f1>
+      sleep(NAP * period);
+  }
+  flush(nblk + (batch[nblk].hdr.nrec > 0));
+ 2c5:	a1 00 1d 00 00       	mov    0x1d00,%eax
+ 2ca:	89 c2                	mov    %eax,%edx
+ 2cc:	c1 e2 09             	shl    $0x9,%edx
+ 2cf:	83 ba 24 1d 00 00 01 	cmpl   $0x1,0x1d24(%edx)
+ 2d6:	83 d8 ff             	sbb    $0xffffffff,%eax
+ 2d9:	e8 e2 01 00 00       	call   4c0 <flush>
+  close(fd);
+ 2de:	83 ec 0c             	sub    $0xc,%esp
+ 2e1:	ff 35 d4 10 00 00    	push   0x10d4
+ 2e7:	e8 df 04 00 00       	call   7cb <close>
+  exit();
+ 2ec:	e8 b2 04 00 00       	call   7a3 <exit>
+      sleep(NAP * period);
+ 2f1:	6b 45 e0 05          	imul   $0x5,-0x20(%ebp),%eax
+ 2f5:	83 ec 0c             	sub    $0xc,%esp
+ 2f8:	50                   	push   %eax
+ 2f9:	e8 35 05 00 00       	call   833 <sleep>
+ 2fe:	83 c4 10             	add    $0x10,%esp
+ 301:	e9 26 fe ff ff       	jmp    12c <main+0x12c>
+    printf(2, "spaslog: name too long: %s\n", path);
+ 306:	56                   	push   %esi
+ 307:	ff 35 e8 10 00 00    	push   0x10e8
+ 30d:	68 e4 0c 00 00       	push   $0xce4
+ 312:	6a 02                	push   $0x2
+ 314:	e8 47 06 00 00       	call   960 <printf>
+    exit();
+ 319:	e8 85 04 00 00       	call   7a3 <exit>
+      printf(2, "spaslog: telemetry failed\n");
+ 31e:	51                   	push   %ecx
+ 31f:	51                   	push   %ecx
+ 320:	68 0c 0d 00 00       	push   $0xd0c
+ 325:	6a 02                	push   $0x2
+ 327:	e8 34 06 00 00       	call   960 <printf>
+      break;
+ 32c:	83 c4 10             	add    $0x10,%esp
+ 32f:	eb 94                	jmp    2c5 <main+0x2c5>
+ 331:	66 90                	xchg   %ax,%ax
+ 333:	66 90                	xchg   %ax,%ax
+ 335:	66 90                	xchg   %ax,%ax
+ 337:	66 90                	xchg   %ax,%ax
+ 339:	66 90                	xchg   %ax,%ax
+ 33b:	66 90                	xchg   %ax,%ax
+ 33d:	66 90                	xchg   %ax,%ax
+ 33f:	90                   	nop
+
+00000340 <segname>:
+{
+ 340:	55                   	push   %ebp
+ 341:	89 e5                	mov    %esp,%ebp
+ 343:	57                   	push   %edi
+ 344:	56                   	push   %esi
+ 345:	53                   	push   %ebx
+ 346:	89 c3                	mov    %eax,%ebx
+ 348:	83 ec 24             	sub    $0x24,%esp
+  strcpy(name, path);
+ 34b:	ff 35 e8 10 00 00    	push   0x10e8
+ 351:	68 20 25 00 00       	push   $0x2520
+ 356:	e8 05 02 00 00       	call   560 <strcpy>
+  if(k == 0)
+ 35b:	83 c4 10             	add    $0x10,%esp
+ 35e:	85 db                	test   %ebx,%ebx
+ 360:	0f 84 87 00 00 00    	je     3ed <segname+0xad>
+  num[i] = 0;
+ 366:	c6 45 e7 00          	movb   $0x0,-0x19(%ebp)
+  i = sizeof(num) - 1;
+ 36a:	b9 0b 00 00 00       	mov    $0xb,%ecx
+    num[--i] = '0' + k % 10;
+ 36f:	bf 67 66 66 66       	mov    $0x66666667,%edi
+ 374:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 378:	89 d8                	mov    %ebx,%eax
+ 37a:	89 ce                	mov    %ecx,%esi
+ 37c:	83 e9 01             	sub    $0x1,%ecx
+ 37f:	f7 ef                	imul   %edi
+ 381:	89 d8                	mov    %ebx,%eax
+ 383:	c1 f8 1f             	sar    $0x1f,%eax
+ 386:	c1 fa 02             	sar    $0x2,%edx
+ 389:	29 c2                	sub    %eax,%edx
+ 38b:	8d 04 92             	lea    (%edx,%edx,4),%eax
+ 38e:	01 c0                	add    %eax,%eax
+ 390:	29 c3                	sub    %eax,%ebx
+ 392:	83 c3 30             	add    $0x30,%ebx
+ 395:	88 5c 0d dc          	mov    %bl,-0x24(%ebp,%ecx,1)
+  }while((k /= 10) != 0);
+ 399:	89 d3                	mov    %edx,%ebx
+ 39b:	85 d2                	test   %edx,%edx
+ 39d:	75 d9                	jne    378 <segname+0x38>
+  if(strlen(name) + strlen(num + i) > DIRSIZ)
+ 39f:	83 ec 0c             	sub    $0xc,%esp
+  num[--i] = '.';
+ 3a2:	c6 44 35 da 2e       	movb   $0x2e,-0x26(%ebp,%esi,1)
+ 3a7:	83 ee 02             	sub    $0x2,%esi
+  if(strlen(name) + strlen(num + i) > DIRSIZ)
+ 3aa:	68 20 25 00 00       	push   $0x2520
+ 3af:	e8 3c 02 00 00       	call   5f0 <strlen>
+ 3b4:	89 c7                	mov    %eax,%edi
+ 3b6:	8d 45 dc             	lea    -0x24(%ebp),%eax
+ 3b9:	01 c6                	add    %eax,%esi
+ 3bb:	89 34 24             	mov    %esi,(%esp)
+ 3be:	e8 2d 02 00 00       	call   5f0 <strlen>
+ 3c3:	83 c4 10             	add    $0x10,%esp
+ 3c6:	01 c7                	add    %eax,%edi
+    return 0;
+ 3c8:	31 c0                	xor    %eax,%eax
+  if(strlen(name) + strlen(num + i) > DIRSIZ)
+ 3ca:	83 ff 0e             	cmp    $0xe,%edi
+ 3cd:	77 23                	ja     3f2 <segname+0xb2>
+  strcpy(name + strlen(name), num + i);
+ 3cf:	83 ec 0c             	sub    $0xc,%esp
+ 3d2:	68 20 25 00 00       	push   $0x2520
+ 3d7:	e8 14 02 00 00       	call   5f0 <strlen>
+ 3dc:	5a                   	pop    %edx
+ 3dd:	59                   	pop    %ecx
+ 3de:	56                   	push   %esi
+ 3df:	05 20 25 00 00       	add    $0x2520,%eax
+ 3e4:	50                   	push   %eax
+ 3e5:	e8 76 01 00 00       	call   560 <strcpy>
+  return name;
+ 3ea:	83 c4 10             	add    $0x10,%esp
+    return name;
+ 3ed:	b8 20 25 00 00       	mov    $0x2520,%eax
+}
+ 3f2:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 3f5:	5b                   	pop    %ebx
+ 3f6:	5e                   	pop    %esi
+ 3f7:	5f                   	pop    %edi
+ 3f8:	5d                   	pop    %ebp
+ 3f9:	c3                   	ret
+ 3fa:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00000400 <openseg>:
+{
+ 400:	55                   	push   %ebp
+ 401:	89 e5                	mov    %esp,%ebp
+ 403:	53                   	push   %ebx
+ 404:	83 ec 04             	sub    $0x4,%esp
+  if(fd >= 0)
+ 407:	a1 d4 10 00 00       	mov    0x10d4,%eax
+ 40c:	85 c0                	test   %eax,%eax
+ 40e:	78 0c                	js     41c <openseg+0x1c>
+    close(fd);
+ 410:	83 ec 0c             	sub    $0xc,%esp
+ 413:	50                   	push   %eax
+ 414:	e8 b2 03 00 00       	call   7cb <close>
+ 419:	83 c4 10             	add    $0x10,%esp
+  if((name = segname(seg)) == 0){
+ 41c:	a1 e4 10 00 00       	mov    0x10e4,%eax
+ 421:	e8 1a ff ff ff       	call   340 <segname>
+ 426:	89 c3                	mov    %eax,%ebx
+ 428:	85 c0                	test   %eax,%eax
+ 42a:	74 58                	je     484 <openseg+0x84>
+  if((fd = open(name, O_CREATE | O_RDWR)) < 0){
+ 42c:	83 ec 08             	sub    $0x8,%esp
+ 42f:	68 02 02 00 00       	push   $0x202
+ 434:	50                   	push   %eax
+ 435:	e8 a9 03 00 00       	call   7e3 <open>
+ 43a:	83 c4 10             	add    $0x10,%esp
+ 43d:	a3 d4 10 00 00       	mov    %eax,0x10d4
+ 442:	85 c0                	test   %eax,%eax
+ 444:	78 5d                	js     4a3 <openseg+0xa3>
+  size = 0;
+ 446:	c7 05 e0 10 00 00 00 	movl   $0x0,0x10e0
+ 44d:	00 00 00 
+  while((n = read(fd, buf, sizeof(buf))) > 0)
+ 450:	eb 11                	jmp    463 <openseg+0x63>
+ 452:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    size += n;
+ 458:	01 05 e0 10 00 00    	add    %eax,0x10e0
+  while((n = read(fd, buf, sizeof(buf))) > 0)
+ 45e:	a1 d4 10 00 00       	mov    0x10d4,%eax
+ 463:	83 ec 04             	sub    $0x4,%esp
+ 466:	68 00 02 00 00       	push   $0x200
+ 46b:	68 20 23 00 00       	push   $0x2320
+ 470:	50                   	push   %eax
+ 471:	e8 45 03 00 00       	call   7bb <read>
+ 476:	83 c4 10             	add    $0x10,%esp
+ 479:	85 c0                	test   %eax,%eax
+ 47b:	7f db                	jg     458 <openseg+0x58>
+  return 0;
+ 47d:	31 c0                	xor    %eax,%eax
+}
+ 47f:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 482:	c9                   	leave
+ 483:	c3                   	ret
+    printf(2, "spaslog: %s: too many segments\n", path);
+ 484:	83 ec 04             	sub    $0x4,%esp
+ 487:	ff 35 e8 10 00 00    	push   0x10e8
+ 48d:	68 88 0c 00 00       	push   $0xc88
+ 492:	6a 02                	push   $0x2
+ 494:	e8 c7 04 00 00       	call   960 <printf>
+    return -1;
+ 499:	83 c4 10             	add    $0x10,%esp
+ 49c:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+ 4a1:	eb dc                	jmp    47f <openseg+0x7f>
+    printf(2, "spaslog: cannot open %s\n", name);
+ 4a3:	83 ec 04             	sub    $0x4,%esp
+ 4a6:	53                   	push   %ebx
+ 4a7:	68 a8 0c 00 00       	push   $0xca8
+ 4ac:	6a 02                	push   $0x2
+ 4ae:	e8 ad 04 00 00       	call   960 <printf>
+    return -1;
+ 4b3:	83 c4 10             	add    $0x10,%esp
+ 4b6:	eb e4                	jmp    49c <openseg+0x9c>
+ 4b8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 4bf:	90                   	nop
+
+000004c0 <flush>:
+  if(n == 0)
+ 4c0:	85 c0                	test   %eax,%eax
+ 4c2:	74 7c                	je     540 <flush+0x80>
+{
+ 4c4:	55                   	push   %ebp
+ 4c5:	89 e5                	mov    %esp,%ebp
+ 4c7:	53                   	push   %ebx
+ 4c8:	89 c3                	mov    %eax,%ebx
+  if(size + n * BSIZE > MAXFILE * BSIZE){
+ 4ca:	c1 e3 09             	shl    $0x9,%ebx
+{
+ 4cd:	83 ec 04             	sub    $0x4,%esp
+  if(size + n * BSIZE > MAXFILE * BSIZE){
+ 4d0:	a1 e0 10 00 00       	mov    0x10e0,%eax
+ 4d5:	01 d8                	add    %ebx,%eax
+ 4d7:	3d 00 18 01 00       	cmp    $0x11800,%eax
+ 4dc:	77 42                	ja     520 <flush+0x60>
+  if(write(fd, batch, n * BSIZE) != n * BSIZE){
+ 4de:	83 ec 04             	sub    $0x4,%esp
+ 4e1:	53                   	push   %ebx
+ 4e2:	68 20 1d 00 00       	push   $0x1d20
+ 4e7:	ff 35 d4 10 00 00    	push   0x10d4
+ 4ed:	e8 d1 02 00 00       	call   7c3 <write>
+ 4f2:	83 c4 10             	add    $0x10,%esp
+ 4f5:	39 c3                	cmp    %eax,%ebx
+ 4f7:	75 4f                	jne    548 <flush+0x88>
+  memset(batch, 0, sizeof(batch));
+ 4f9:	83 ec 04             	sub    $0x4,%esp
+  size += n * BSIZE;
+ 4fc:	01 1d e0 10 00 00    	add    %ebx,0x10e0
+  memset(batch, 0, sizeof(batch));
+ 502:	68 00 06 00 00       	push   $0x600
+ 507:	6a 00                	push   $0x0
+ 509:	68 20 1d 00 00       	push   $0x1d20
+ 50e:	e8 0d 01 00 00       	call   620 <memset>
+  return 0;
+ 513:	83 c4 10             	add    $0x10,%esp
+    return 0;
+ 516:	31 c0                	xor    %eax,%eax
+}
+ 518:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 51b:	c9                   	leave
+ 51c:	c3                   	ret
+ 51d:	8d 76 00             	lea    0x0(%esi),%esi
+    seg++;
+ 520:	83 05 e4 10 00 00 01 	addl   $0x1,0x10e4
+    if(openseg() < 0)
+ 527:	e8 d4 fe ff ff       	call   400 <openseg>
+ 52c:	85 c0                	test   %eax,%eax
+ 52e:	79 ae                	jns    4de <flush+0x1e>
+      return -1;
+ 530:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+ 535:	eb e1                	jmp    518 <flush+0x58>
+ 537:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 53e:	66 90                	xchg   %ax,%ax
+    return 0;
+ 540:	31 c0                	xor    %eax,%eax
+}
+ 542:	c3                   	ret
+ 543:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 547:	90                   	nop
+    printf(2, "spaslog: write failed\n");
+ 548:	83 ec 08             	sub    $0x8,%esp
+ 54b:	68 c1 0c 00 00       	push   $0xcc1
+ 550:	6a 02                	push   $0x2
+ 552:	e8 09 04 00 00       	call   960 <printf>
+    return -1;
+ 557:	83 c4 10             	add    $0x10,%esp
+ 55a:	eb d4                	jmp    530 <flush+0x70>
+ 55c:	66 90                	xchg   %ax,%ax
+ 55e:	66 90                	xchg   %ax,%ax
+
+00000560 <strcpy>:
+#include "user.h"
+#include "x86.h"
+
+char*
+strcpy(char *s, const char *t)
+{
+ 560:	55                   	push   %ebp
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+ 561:	31 c0                	xor    %eax,%eax
+{
+ 563:	89 e5                	mov    %esp,%ebp
+ 565:	53                   	push   %ebx
+ 566:	8b 4d 08             	mov    0x8(%ebp),%ecx
+ 569:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+ 56c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  while((*s++ = *t++) != 0)
+ 570:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+ 574:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+ 577:	83 c0 01             	add    $0x1,%eax
+ 57a:	84 d2                	test   %dl,%dl
+ 57c:	75 f2                	jne    570 <strcpy+0x10>
+    ;
+  return os;
+}
+ 57e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 581:	89 c8                	mov    %ecx,%eax
+ 583:	c9                   	leave
+ 584:	c3                   	ret
+ 585:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 58c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000590 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+ 590:	55                   	push   %ebp
+ 591:	89 e5                	mov    %esp,%ebp
+ 593:	53                   	push   %ebx
+ 594:	8b 55 08             	mov    0x8(%ebp),%edx
+ 597:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  while(*p && *p == *q)
+ 59a:	0f b6 02             	movzbl (%edx),%eax
+ 59d:	84 c0                	test   %al,%al
+ 59f:	75 17                	jne    5b8 <strcmp+0x28>
+ 5a1:	eb 3a                	jmp    5dd <strcmp+0x4d>
+ 5a3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 5a7:	90                   	nop
+ 5a8:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+    p++, q++;
+ 5ac:	83 c2 01             	add    $0x1,%edx
+ 5af:	8d 59 01             	lea    0x1(%ecx),%ebx
+  while(*p && *p == *q)
+ 5b2:	84 c0                	test   %al,%al
+ 5b4:	74 1a                	je     5d0 <strcmp+0x40>
+    p++, q++;
+ 5b6:	89 d9                	mov    %ebx,%ecx
+  while(*p && *p == *q)
+ 5b8:	0f b6 19             	movzbl (%ecx),%ebx
+ 5bb:	38 c3                	cmp    %al,%bl
+ 5bd:	74 e9                	je     5a8 <strcmp+0x18>
+  return (uchar)*p - (uchar)*q;
+ 5bf:	29 d8                	sub    %ebx,%eax
+}
+ 5c1:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 5c4:	c9                   	leave
+ 5c5:	c3                   	ret
+ 5c6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 5cd:	8d 76 00             	lea    0x0(%esi),%esi
+  return (uchar)*p - (uchar)*q;
+ 5d0:	0f b6 59 01          	movzbl 0x1(%ecx),%ebx
+ 5d4:	31 c0                	xor    %eax,%eax
+ 5d6:	29 d8                	sub    %ebx,%eax
+}
+ 5d8:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 5db:	c9                   	leave
+ 5dc:	c3                   	ret
+  return (uchar)*p - (uchar)*q;
+ 5dd:	0f b6 19             	movzbl (%ecx),%ebx
+ 5e0:	31 c0                	xor    %eax,%eax
+ 5e2:	eb db                	jmp    5bf <strcmp+0x2f>
+ 5e4:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 5eb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 5ef:	90                   	nop
+
+000005f0 <strlen>:
+
+uint
+strlen(const char *s)
+{
+ 5f0:	55                   	push   %ebp
+ 5f1:	89 e5                	mov    %esp,%ebp
+ 5f3:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for(n = 0; s[n]; n++)
+ 5f6:	80 3a 00             	cmpb   $0x0,(%edx)
+ 5f9:	74 15                	je     610 <strlen+0x20>
+ 5fb:	31 c0                	xor    %eax,%eax
+ 5fd:	8d 76 00             	lea    0x0(%esi),%esi
+ 600:	83 c0 01             	add    $0x1,%eax
+ 603:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+ 607:	89 c1                	mov    %eax,%ecx
+ 609:	75 f5                	jne    600 <strlen+0x10>
+    ;
+  return n;
+}
+ 60b:	89 c8                	mov    %ecx,%eax
+ 60d:	5d                   	pop    %ebp
+ 60e:	c3                   	ret
+ 60f:	90                   	nop
+  for(n = 0; s[n]; n++)
+ 610:	31 c9                	xor    %ecx,%ecx
+}
+ 612:	5d                   	pop    %ebp
+ 613:	89 c8                	mov    %ecx,%eax
+ 615:	c3                   	ret
+ 616:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 61d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000620 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+ 620:	55                   	push   %ebp
+ 621:	89 e5                	mov    %esp,%ebp
+ 623:	57                   	push   %edi
+ 624:	8b 55 08             	mov    0x8(%ebp),%edx
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosb" :
+ 627:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 62a:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 62d:	89 d7                	mov    %edx,%edi
+ 62f:	fc                   	cld
+ 630:	f3 aa                	rep stos %al,%es:(%edi)
+  stosb(dst, c, n);
+  return dst;
+}
+ 632:	8b 7d fc             	mov    -0x4(%ebp),%edi
+ 635:	89 d0                	mov    %edx,%eax
+ 637:	c9                   	leave
+ 638:	c3                   	ret
+ 639:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000640 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+ 640:	55                   	push   %ebp
+ 641:	89 e5                	mov    %esp,%ebp
+ 643:	8b 45 08             	mov    0x8(%ebp),%eax
+ 646:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+ 64a:	0f b6 10             	movzbl (%eax),%edx
+ 64d:	84 d2                	test   %dl,%dl
+ 64f:	75 12                	jne    663 <strchr+0x23>
+ 651:	eb 1d                	jmp    670 <strchr+0x30>
+ 653:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 657:	90                   	nop
+ 658:	0f b6 50 01          	movzbl 0x1(%eax),%edx
+ 65c:	83 c0 01             	add    $0x1,%eax
+ 65f:	84 d2                	test   %dl,%dl
+ 661:	74 0d                	je     670 <strchr+0x30>
+    if(*s == c)
+ 663:	38 d1                	cmp    %dl,%cl
+ 665:	75 f1                	jne    658 <strchr+0x18>
+      return (char*)s;
+  return 0;
+}
+ 667:	5d                   	pop    %ebp
+ 668:	c3                   	ret
+ 669:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  return 0;
+ 670:	31 c0                	xor    %eax,%eax
+}
+ 672:	5d                   	pop    %ebp
+ 673:	c3                   	ret
+ 674:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 67b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 67f:	90                   	nop
+
+00000680 <gets>:
+
+char*
+gets(char *buf, int max)
+{
+ 680:	55                   	push   %ebp
+ 681:	89 e5                	mov    %esp,%ebp
+ 683:	57                   	push   %edi
+ 684:	56                   	push   %esi
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+    cc = read(0, &c, 1);
+ 685:	8d 75 e7             	lea    -0x19(%ebp),%esi
+{
+ 688:	53                   	push   %ebx
+  for(i=0; i+1 < max; ){
+ 689:	31 db                	xor    %ebx,%ebx
+{
+ 68b:	83 ec 1c             	sub    $0x1c,%esp
+  for(i=0; i+1 < max; ){
+ 68e:	eb 27                	jmp    6b7 <gets+0x37>
+    cc = read(0, &c, 1);
+ 690:	83 ec 04             	sub    $0x4,%esp
+ 693:	6a 01                	push   $0x1
+ 695:	56                   	push   %esi
+ 696:	6a 00                	push   $0x0
+ 698:	e8 1e 01 00 00       	call   7bb <read>
+    if(cc < 1)
+ 69d:	83 c4 10             	add    $0x10,%esp
+ 6a0:	85 c0                	test   %eax,%eax
+ 6a2:	7e 1d                	jle    6c1 <gets+0x41>
+      break;
+    buf[i++] = c;
+ 6a4:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+ 6a8:	8b 55 08             	mov    0x8(%ebp),%edx
+ 6ab:	88 44 1a ff          	mov    %al,-0x1(%edx,%ebx,1)
+    if(c == '\n' || c == '\r')
+ 6af:	3c 0a                	cmp    $0xa,%al
+ 6b1:	74 10                	je     6c3 <gets+0x43>
+ 6b3:	3c 0d                	cmp    $0xd,%al
+ 6b5:	74 0c                	je     6c3 <gets+0x43>
+  for(i=0; i+1 < max; ){
+ 6b7:	89 df                	mov    %ebx,%edi
+ 6b9:	83 c3 01             	add    $0x1,%ebx
+ 6bc:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+ 6bf:	7c cf                	jl     690 <gets+0x10>
+ 6c1:	89 fb                	mov    %edi,%ebx
+      break;
+  }
+  buf[i] = '\0';
+ 6c3:	8b 45 08             	mov    0x8(%ebp),%eax
+ 6c6:	c6 04 18 00          	movb   $0x0,(%eax,%ebx,1)
+  return buf;
+}
+ 6ca:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 6cd:	5b                   	pop    %ebx
+ 6ce:	5e                   	pop    %esi
+ 6cf:	5f                   	pop    %edi
+ 6d0:	5d                   	pop    %ebp
+ 6d1:	c3                   	ret
+ 6d2:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 6d9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+000006e0 <stat>:
+
+int
+stat(const char *n, struct stat *st)
+{
+ 6e0:	55                   	push   %ebp
+ 6e1:	89 e5                	mov    %esp,%ebp
+ 6e3:	56                   	push   %esi
+ 6e4:	53                   	push   %ebx
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+ 6e5:	83 ec 08             	sub    $0x8,%esp
+ 6e8:	6a 00                	push   $0x0
+ 6ea:	ff 75 08             	push   0x8(%ebp)
+ 6ed:	e8 f1 00 00 00       	call   7e3 <open>
+  if(fd < 0)
+ 6f2:	83 c4 10             	add    $0x10,%esp
+ 6f5:	85 c0                	test   %eax,%eax
+ 6f7:	78 27                	js     720 <stat+0x40>
+    return -1;
+  r = fstat(fd, st);
+ 6f9:	83 ec 08             	sub    $0x8,%esp
+ 6fc:	ff 75 0c             	push   0xc(%ebp)
+ 6ff:	89 c3                	mov    %eax,%ebx
+ 701:	50                   	push   %eax
+ 702:	e8 f4 00 00 00       	call   7fb <fstat>
+  close(fd);
+ 707:	89 1c 24             	mov    %ebx,(%esp)
+  r = fstat(fd, st);
+ 70a:	89 c6                	mov    %eax,%esi
+  close(fd);
+ 70c:	e8 ba 00 00 00       	call   7cb <close>
+  return r;
+ 711:	83 c4 10             	add    $0x10,%esp
+}
+ 714:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 717:	89 f0                	mov    %esi,%eax
+ 719:	5b                   	pop    %ebx
+ 71a:	5e                   	pop    %esi
+ 71b:	5d                   	pop    %ebp
+ 71c:	c3                   	ret
+ 71d:	8d 76 00             	lea    0x0(%esi),%esi
+    return -1;
+ 720:	be ff ff ff ff       	mov    $0xffffffff,%esi
+ 725:	eb ed                	jmp    714 <stat+0x34>
+ 727:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 72e:	66 90                	xchg   %ax,%ax
+
+00000730 <atoi>:
+
+int
+atoi(const char *s)
+{
+ 730:	55                   	push   %ebp
+ 731:	89 e5                	mov    %esp,%ebp
+ 733:	53                   	push   %ebx
+ 734:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  n = 0;
+  while('0' <= *s && *s <= '9')
+ 737:	0f be 02             	movsbl (%edx),%eax
+ 73a:	8d 48 d0             	lea    -0x30(%eax),%ecx
+ 73d:	80 f9 09             	cmp    $0x9,%cl
+  n = 0;
+ 740:	b9 00 00 00 00       	mov    $0x0,%ecx
+  while('0' <= *s && *s <= '9')
+ 745:	77 1e                	ja     765 <atoi+0x35>
+ 747:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 74e:	66 90                	xchg   %ax,%ax
+    n = n*10 + *s++ - '0';
+ 750:	83 c2 01             	add    $0x1,%edx
+ 753:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+ 756:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+  while('0' <= *s && *s <= '9')
+ 75a:	0f be 02             	movsbl (%edx),%eax
+ 75d:	8d 58 d0             	lea    -0x30(%eax),%ebx
+ 760:	80 fb 09             	cmp    $0x9,%bl
+ 763:	76 eb                	jbe    750 <atoi+0x20>
+  return n;
+}
+ 765:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 768:	89 c8                	mov    %ecx,%eax
+ 76a:	c9                   	leave
+ 76b:	c3                   	ret
+ 76c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000770 <memmove>:
+
+void*
+memmove(void *vdst, const void *vsrc, int n)
+{
+ 770:	55                   	push   %ebp
+ 771:	89 e5                	mov    %esp,%ebp
+ 773:	57                   	push   %edi
+ 774:	56                   	push   %esi
+ 775:	8b 45 10             	mov    0x10(%ebp),%eax
+ 778:	8b 55 08             	mov    0x8(%ebp),%edx
+ 77b:	8b 75 0c             	mov    0xc(%ebp),%esi
+  char *dst;
+  const char *src;
+
+  dst = vdst;
+  src = vsrc;
+  while(n-- > 0)
+ 77e:	85 c0                	test   %eax,%eax
+ 780:	7e 13                	jle    795 <memmove+0x25>
+ 782:	01 d0                	add    %edx,%eax
+  dst = vdst;
+ 784:	89 d7                	mov    %edx,%edi
+ 786:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 78d:	8d 76 00             	lea    0x0(%esi),%esi
+    *dst++ = *src++;
+ 790:	a4                   	movsb  %ds:(%esi),%es:(%edi)
+  while(n-- > 0)
+ 791:	39 f8                	cmp    %edi,%eax
+ 793:	75 fb                	jne    790 <memmove+0x20>
+  return vdst;
+}
+ 795:	5e                   	pop    %esi
+ 796:	89 d0                	mov    %edx,%eax
+ 798:	5f                   	pop    %edi
+ 799:	5d                   	pop    %ebp
+ 79a:	c3                   	ret
+
+0000079b <fork>:
+  name: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+SYSCALL(fork)
+ 79b:	b8 01 00 00 00       	mov    $0x1,%eax
+ 7a0:	cd 40                	int    $0x40
+ 7a2:	c3                   	ret
+
+000007a3 <exit>:
+SYSCALL(exit)
+ 7a3:	b8 02 00 00 00       	mov    $0x2,%eax
+ 7a8:	cd 40                	int    $0x40
+ 7aa:	c3                   	ret
+
+000007ab <wait>:
+SYSCALL(wait)
+ 7ab:	b8 03 00 00 00       	mov    $0x3,%eax
+ 7b0:	cd 40                	int    $0x40
+ 7b2:	c3                   	ret
+
+000007b3 <pipe>:
+SYSCALL(pipe)
+ 7b3:	b8 04 00 00 00       	mov    $0x4,%eax
+ 7b8:	cd 40                	int    $0x40
+ 7ba:	c3                   	ret
+
+000007bb <read>:
+SYSCALL(read)
+ 7bb:	b8 05 00 00 00       	mov    $0x5,%eax
+ 7c0:	cd 40                	int    $0x40
+ 7c2:	c3                   	ret
+
+000007c3 <write>:
+SYSCALL(write)
+ 7c3:	b8 10 00 00 00       	mov    $0x10,%eax
+ 7c8:	cd 40                	int    $0x40
+ 7ca:	c3                   	ret
+
+000007cb <close>:
+SYSCALL(close)
+ 7cb:	b8 15 00 00 00       	mov    $0x15,%eax
+ 7d0:	cd 40                	int    $0x40
+ 7d2:	c3                   	ret
+
+000007d3 <kill>:
+SYSCALL(kill)
+ 7d3:	b8 06 00 00 00       	mov    $0x6,%eax
+ 7d8:	cd 40                	int    $0x40
+ 7da:	c3                   	ret
+
+000007db <exec>:
+SYSCALL(exec)
+ 7db:	b8 07 00 00 00       	mov    $0x7,%eax
+ 7e0:	cd 40                	int    $0x40
+ 7e2:	c3                   	ret
+
+000007e3 <open>:
+SYSCALL(open)
+ 7e3:	b8 0f 00 00 00       	mov    $0xf,%eax
+ 7e8:	cd 40                	int    $0x40
+ 7ea:	c3                   	ret
+
+000007eb <mknod>:
+SYSCALL(mknod)
+ 7eb:	b8 11 00 00 00       	mov    $0x11,%eax
+ 7f0:	cd 40                	int    $0x40
+ 7f2:	c3                   	ret
+
+000007f3 <unlink>:
+SYSCALL(unlink)
+ 7f3:	b8 12 00 00 00       	mov    $0x12,%eax
+ 7f8:	cd 40                	int    $0x40
+ 7fa:	c3                   	ret
+
+000007fb <fstat>:
+SYSCALL(fstat)
+ 7fb:	b8 08 00 00 00       	mov    $0x8,%eax
+ 800:	cd 40                	int    $0x40
+ 802:	c3                   	ret
+
+00000803 <link>:
+SYSCALL(link)
+ 803:	b8 13 00 00 00       	mov    $0x13,%eax
+ 808:	cd 40                	int    $0x40
+ 80a:	c3                   	ret
+
+0000080b <mkdir>:
+SYSCALL(mkdir)
+ 80b:	b8 14 00 00 00       	mov    $0x14,%eax
+ 810:	cd 40                	int    $0x40
+ 812:	c3                   	ret
+
+00000813 <chdir>:
+SYSCALL(chdir)
+ 813:	b8 09 00 00 00       	mov    $0x9,%eax
+ 818:	cd 40                	int    $0x40
+ 81a:	c3                   	ret
+
+0000081b <dup>:
+SYSCALL(dup)
+ 81b:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 820:	cd 40                	int    $0x40
+ 822:	c3                   	ret
+
+00000823 <getpid>:
+SYSCALL(getpid)
+ 823:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 828:	cd 40                	int    $0x40
+ 82a:	c3                   	ret
+
+0000082b <sbrk>:
+SYSCALL(sbrk)
+ 82b:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 830:	cd 40                	int    $0x40
+ 832:	c3                   	ret
+
+00000833 <sleep>:
+SYSCALL(sleep)
+ 833:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 838:	cd 40                	int    $0x40
+ 83a:	c3                   	ret
+
+0000083b <uptime>:
+SYSCALL(uptime)
+ 83b:	b8 0e 00 00 00       	mov    $0xe,%eax
+ 840:	cd 40                	int    $0x40
+ 842:	c3                   	ret
+
+00000843 <cpustat>:
+SYSCALL(cpustat)
+ 843:	b8 16 00 00 00       	mov    $0x16,%eax
+ 848:	cd 40                	int    $0x40
+ 84a:	c3                   	ret
+
+0000084b <setpriority>:
+SYSCALL(setpriority)
+ 84b:	b8 17 00 00 00       	mov    $0x17,%eax
+ 850:	cd 40                	int    $0x40
+ 852:	c3                   	ret
+
+00000853 <cpuinfo>:
+SYSCALL(cpuinfo)
+ 853:	b8 18 00 00 00       	mov    $0x18,%eax
+ 858:	cd 40                	int    $0x40
+ 85a:	c3                   	ret
+
+0000085b <procinfo>:
+SYSCALL(procinfo)
+ 85b:	b8 19 00 00 00       	mov    $0x19,%eax
+ 860:	cd 40                	int    $0x40
+ 862:	c3                   	ret
+
+00000863 <setgovernor>:
+SYSCALL(setgovernor)
+ 863:	b8 1a 00 00 00       	mov    $0x1a,%eax
+ 868:	cd 40                	int    $0x40
+ 86a:	c3                   	ret
+
+0000086b <sysctl>:
+SYSCALL(sysctl)
+ 86b:	b8 1b 00 00 00       	mov    $0x1b,%eax
+ 870:	cd 40                	int    $0x40
+ 872:	c3                   	ret
+
+00000873 <telemetry>:
+SYSCALL(telemetry)
+ 873:	b8 1c 00 00 00       	mov    $0x1c,%eax
+ 878:	cd 40                	int    $0x40
+ 87a:	c3                   	ret
+
+0000087b <clock_gettime>:
+SYSCALL(clock_gettime)
+ 87b:	b8 1d 00 00 00       	mov    $0x1d,%eax
+ 880:	cd 40                	int    $0x40
+ 882:	c3                   	ret
+
+00000883 <sched_setaffinity>:
+SYSCALL(sched_setaffinity)
+ 883:	b8 1e 00 00 00       	mov    $0x1e,%eax
+ 888:	cd 40                	int    $0x40
+ 88a:	c3                   	ret
+
+0000088b <sched_getaffinity>:
+SYSCALL(sched_getaffinity)
+ 88b:	b8 1f 00 00 00       	mov    $0x1f,%eax
+ 890:	cd 40                	int    $0x40
+ 892:	c3                   	ret
+
+00000893 <setqos>:
+SYSCALL(setqos)
+ 893:	b8 20 00 00 00       	mov    $0x20,%eax
+ 898:	cd 40                	int    $0x40
+ 89a:	c3                   	ret
+
+0000089b <setgroup>:
+SYSCALL(setgroup)
+ 89b:	b8 21 00 00 00       	mov    $0x21,%eax
+ 8a0:	cd 40                	int    $0x40
+ 8a2:	c3                   	ret
+
+000008a3 <setquota>:
+SYSCALL(setquota)
+ 8a3:	b8 22 00 00 00       	mov    $0x22,%eax
+ 8a8:	cd 40                	int    $0x40
+ 8aa:	c3                   	ret
+
+000008ab <groupinfo>:
+SYSCALL(groupinfo)
+ 8ab:	b8 23 00 00 00       	mov    $0x23,%eax
+ 8b0:	cd 40                	int    $0x40
+ 8b2:	c3                   	ret
+ 8b3:	66 90                	xchg   %ax,%ax
+ 8b5:	66 90                	xchg   %ax,%ax
+ 8b7:	66 90                	xchg   %ax,%ax
+ 8b9:	66 90                	xchg   %ax,%ax
+ 8bb:	66 90                	xchg   %ax,%ax
+ 8bd:	66 90                	xchg   %ax,%ax
+ 8bf:	90                   	nop
+
+000008c0 <printint>:
+  write(fd, &c, 1);
+}
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+ 8c0:	55                   	push   %ebp
+ 8c1:	89 e5                	mov    %esp,%ebp
+ 8c3:	57                   	push   %edi
+ 8c4:	56                   	push   %esi
+ 8c5:	53                   	push   %ebx
+ 8c6:	89 cb                	mov    %ecx,%ebx
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+    neg = 1;
+    x = -xx;
+ 8c8:	89 d1                	mov    %edx,%ecx
+{
+ 8ca:	83 ec 3c             	sub    $0x3c,%esp
+ 8cd:	89 45 c0             	mov    %eax,-0x40(%ebp)
+  if(sgn && xx < 0){
+ 8d0:	85 d2                	test   %edx,%edx
+ 8d2:	0f 89 80 00 00 00    	jns    958 <printint+0x98>
+ 8d8:	f6 45 08 01          	testb  $0x1,0x8(%ebp)
+ 8dc:	74 7a                	je     958 <printint+0x98>
+    x = -xx;
+ 8de:	f7 d9                	neg    %ecx
+    neg = 1;
+ 8e0:	b8 01 00 00 00       	mov    $0x1,%eax
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+ 8e5:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+ 8e8:	31 f6                	xor    %esi,%esi
+ 8ea:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  do{
+    buf[i++] = digits[x % base];
+ 8f0:	89 c8                	mov    %ecx,%eax
+ 8f2:	31 d2                	xor    %edx,%edx
+ 8f4:	89 f7                	mov    %esi,%edi
+ 8f6:	f7 f3                	div    %ebx
+ 8f8:	8d 76 01             	lea    0x1(%esi),%esi
+ 8fb:	0f b6 92 a4 0d 00 00 	movzbl 0xda4(%edx),%edx
+ 902:	88 54 35 d7          	mov    %dl,-0x29(%ebp,%esi,1)
+  }while((x /= base) != 0);
+ 906:	89 ca                	mov    %ecx,%edx
+ 908:	89 c1                	mov    %eax,%ecx
+ 90a:	39 da                	cmp    %ebx,%edx
+ 90c:	73 e2                	jae    8f0 <printint+0x30>
+  if(neg)
+ 90e:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+ 911:	85 c0                	test   %eax,%eax
+ 913:	74 07                	je     91c <printint+0x5c>
+    buf[i++] = '-';
+ 915:	c6 44 35 d8 2d       	movb   $0x2d,-0x28(%ebp,%esi,1)
+    buf[i++] = digits[x % base];
+ 91a:	89 f7                	mov    %esi,%edi
+ 91c:	8d 5d d8             	lea    -0x28(%ebp),%ebx
+ 91f:	8b 75 c0             	mov    -0x40(%ebp),%esi
+ 922:	01 df                	add    %ebx,%edi
+ 924:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+  while(--i >= 0)
+    putc(fd, buf[i]);
+ 928:	0f b6 07             	movzbl (%edi),%eax
+  write(fd, &c, 1);
+ 92b:	83 ec 04             	sub    $0x4,%esp
+ 92e:	88 45 d7             	mov    %al,-0x29(%ebp)
+ 931:	8d 45 d7             	lea    -0x29(%ebp),%eax
+ 934:	6a 01                	push   $0x1
+ 936:	50                   	push   %eax
+ 937:	56                   	push   %esi
+ 938:	e8 86 fe ff ff       	call   7c3 <write>
+  while(--i >= 0)
+ 93d:	89 f8                	mov    %edi,%eax
+ 93f:	83 c4 10             	add    $0x10,%esp
+ 942:	83 ef 01             	sub    $0x1,%edi
+ 945:	39 d8                	cmp    %ebx,%eax
+ 947:	75 df                	jne    928 <printint+0x68>
+}
+ 949:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 94c:	5b                   	pop    %ebx
+ 94d:	5e                   	pop    %esi
+ 94e:	5f                   	pop    %edi
+ 94f:	5d                   	pop    %ebp
+ 950:	c3                   	ret
+ 951:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  neg = 0;
+ 958:	31 c0                	xor    %eax,%eax
+ 95a:	eb 89                	jmp    8e5 <printint+0x25>
+ 95c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000960 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, const char *fmt, ...)
+{
+ 960:	55                   	push   %ebp
+ 961:	89 e5                	mov    %esp,%ebp
+ 963:	57                   	push   %edi
+ 964:	56                   	push   %esi
+ 965:	53                   	push   %ebx
+ 966:	83 ec 2c             	sub    $0x2c,%esp
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+  ap = (uint*)(void*)&fmt + 1;
+  for(i = 0; fmt[i]; i++){
+ 969:	8b 75 0c             	mov    0xc(%ebp),%esi
+{
+ 96c:	8b 7d 08             	mov    0x8(%ebp),%edi
+  for(i = 0; fmt[i]; i++){
+ 96f:	0f b6 1e             	movzbl (%esi),%ebx
+ 972:	83 c6 01             	add    $0x1,%esi
+ 975:	84 db                	test   %bl,%bl
+ 977:	74 67                	je     9e0 <printf+0x80>
+ 979:	8d 4d 10             	lea    0x10(%ebp),%ecx
+ 97c:	31 d2                	xor    %edx,%edx
+ 97e:	89 4d d0             	mov    %ecx,-0x30(%ebp)
+ 981:	eb 34                	jmp    9b7 <printf+0x57>
+ 983:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 987:	90                   	nop
+ 988:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+        state = '%';
+ 98b:	ba 25 00 00 00       	mov    $0x25,%edx
+      if(c == '%'){
+ 990:	83 f8 25             	cmp    $0x25,%eax
+ 993:	74 18                	je     9ad <printf+0x4d>
+  write(fd, &c, 1);
+ 995:	83 ec 04             	sub    $0x4,%esp
+ 998:	8d 45 e7             	lea    -0x19(%ebp),%eax
+ 99b:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 99e:	6a 01                	push   $0x1
+ 9a0:	50                   	push   %eax
+ 9a1:	57                   	push   %edi
+ 9a2:	e8 1c fe ff ff       	call   7c3 <write>
+ 9a7:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+      } else {
+        putc(fd, c);
+ 9aa:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; fmt[i]; i++){
+ 9ad:	0f b6 1e             	movzbl (%esi),%ebx
+ 9b0:	83 c6 01             	add    $0x1,%esi
+ 9b3:	84 db                	test   %bl,%bl
+ 9b5:	74 29                	je     9e0 <printf+0x80>
+    c = fmt[i] & 0xff;
+ 9b7:	0f b6 c3             	movzbl %bl,%eax
+    if(state == 0){
+ 9ba:	85 d2                	test   %edx,%edx
+ 9bc:	74 ca                	je     988 <printf+0x28>
+      }
+    } else if(state == '%'){
+ 9be:	83 fa 25             	cmp    $0x25,%edx
+ 9c1:	75 ea                	jne    9ad <printf+0x4d>
+      if(c == 'd'){
+ 9c3:	83 f8 25             	cmp    $0x25,%eax
+ 9c6:	0f 84 24 01 00 00    	je     af0 <printf+0x190>
+ 9cc:	83 e8 63             	sub    $0x63,%eax
+ 9cf:	83 f8 15             	cmp    $0x15,%eax
+ 9d2:	77 1c                	ja     9f0 <printf+0x90>
+ 9d4:	ff 24 85 4c 0d 00 00 	jmp    *0xd4c(,%eax,4)
+ 9db:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 9df:	90                   	nop
+        putc(fd, c);
+      }
+      state = 0;
+    }
+  }
+}
+ 9e0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 9e3:	5b                   	pop    %ebx
+ 9e4:	5e                   	pop    %esi
+ 9e5:	5f                   	pop    %edi
+ 9e6:	5d                   	pop    %ebp
+ 9e7:	c3                   	ret
+ 9e8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 9ef:	90                   	nop
+  write(fd, &c, 1);
+ 9f0:	83 ec 04             	sub    $0x4,%esp
+ 9f3:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 9f6:	c6 45 e7 25          	movb   $0x25,-0x19(%ebp)
+ 9fa:	6a 01                	push   $0x1
+ 9fc:	52                   	push   %edx
+ 9fd:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+ a00:	57                   	push   %edi
+ a01:	e8 bd fd ff ff       	call   7c3 <write>
+ a06:	83 c4 0c             	add    $0xc,%esp
+ a09:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ a0c:	6a 01                	push   $0x1
+ a0e:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+ a11:	52                   	push   %edx
+ a12:	57                   	push   %edi
+ a13:	e8 ab fd ff ff       	call   7c3 <write>
+        putc(fd, c);
+ a18:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ a1b:	31 d2                	xor    %edx,%edx
+ a1d:	eb 8e                	jmp    9ad <printf+0x4d>
+ a1f:	90                   	nop
+        printint(fd, *ap, 16, 0);
+ a20:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+ a23:	83 ec 0c             	sub    $0xc,%esp
+ a26:	b9 10 00 00 00       	mov    $0x10,%ecx
+ a2b:	8b 13                	mov    (%ebx),%edx
+ a2d:	6a 00                	push   $0x0
+ a2f:	89 f8                	mov    %edi,%eax
+        ap++;
+ a31:	83 c3 04             	add    $0x4,%ebx
+        printint(fd, *ap, 16, 0);
+ a34:	e8 87 fe ff ff       	call   8c0 <printint>
+        ap++;
+ a39:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+ a3c:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ a3f:	31 d2                	xor    %edx,%edx
+ a41:	e9 67 ff ff ff       	jmp    9ad <printf+0x4d>
+ a46:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ a4d:	8d 76 00             	lea    0x0(%esi),%esi
+        s = (char*)*ap;
+ a50:	8b 45 d0             	mov    -0x30(%ebp),%eax
+ a53:	8b 18                	mov    (%eax),%ebx
+        ap++;
+ a55:	83 c0 04             	add    $0x4,%eax
+ a58:	89 45 d0             	mov    %eax,-0x30(%ebp)
+        if(s == 0)
+ a5b:	85 db                	test   %ebx,%ebx
+ a5d:	0f 84 9d 00 00 00    	je     b00 <printf+0x1a0>
+        while(*s != 0){
+ a63:	0f b6 03             	movzbl (%ebx),%eax
+      state = 0;
+ a66:	31 d2                	xor    %edx,%edx
+        while(*s != 0){
+ a68:	84 c0                	test   %al,%al
+ a6a:	0f 84 3d ff ff ff    	je     9ad <printf+0x4d>
+ a70:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ a73:	89 75 d4             	mov    %esi,-0x2c(%ebp)
+ a76:	89 de                	mov    %ebx,%esi
+ a78:	89 d3                	mov    %edx,%ebx
+ a7a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  write(fd, &c, 1);
+ a80:	83 ec 04             	sub    $0x4,%esp
+ a83:	88 45 e7             	mov    %al,-0x19(%ebp)
+          s++;
+ a86:	83 c6 01             	add    $0x1,%esi
+  write(fd, &c, 1);
+ a89:	6a 01                	push   $0x1
+ a8b:	53                   	push   %ebx
+ a8c:	57                   	push   %edi
+ a8d:	e8 31 fd ff ff       	call   7c3 <write>
+        while(*s != 0){
+ a92:	0f b6 06             	movzbl (%esi),%eax
+ a95:	83 c4 10             	add    $0x10,%esp
+ a98:	84 c0                	test   %al,%al
+ a9a:	75 e4                	jne    a80 <printf+0x120>
+      state = 0;
+ a9c:	8b 75 d4             	mov    -0x2c(%ebp),%esi
+ a9f:	31 d2                	xor    %edx,%edx
+ aa1:	e9 07 ff ff ff       	jmp    9ad <printf+0x4d>
+ aa6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ aad:	8d 76 00             	lea    0x0(%esi),%esi
+        printint(fd, *ap, 10, 1);
+ ab0:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+ ab3:	83 ec 0c             	sub    $0xc,%esp
+ ab6:	b9 0a 00 00 00       	mov    $0xa,%ecx
+ abb:	8b 13                	mov    (%ebx),%edx
+ abd:	6a 01                	push   $0x1
+ abf:	e9 6b ff ff ff       	jmp    a2f <printf+0xcf>
+ ac4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+        putc(fd, *ap);
+ ac8:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  write(fd, &c, 1);
+ acb:	83 ec 04             	sub    $0x4,%esp
+ ace:	8d 55 e7             	lea    -0x19(%ebp),%edx
+        putc(fd, *ap);
+ ad1:	8b 03                	mov    (%ebx),%eax
+        ap++;
+ ad3:	83 c3 04             	add    $0x4,%ebx
+        putc(fd, *ap);
+ ad6:	88 45 e7             	mov    %al,-0x19(%ebp)
+  write(fd, &c, 1);
+ ad9:	6a 01                	push   $0x1
+ adb:	52                   	push   %edx
+ adc:	57                   	push   %edi
+ add:	e8 e1 fc ff ff       	call   7c3 <write>
+        ap++;
+ ae2:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+ ae5:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ ae8:	31 d2                	xor    %edx,%edx
+ aea:	e9 be fe ff ff       	jmp    9ad <printf+0x4d>
+ aef:	90                   	nop
+  write(fd, &c, 1);
+ af0:	83 ec 04             	sub    $0x4,%esp
+ af3:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ af6:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ af9:	6a 01                	push   $0x1
+ afb:	e9 11 ff ff ff       	jmp    a11 <printf+0xb1>
+ b00:	b8 28 00 00 00       	mov    $0x28,%eax
+          s = "(null)";
+ b05:	bb 44 0d 00 00       	mov    $0xd44,%ebx
+ b0a:	e9 61 ff ff ff       	jmp    a70 <printf+0x110>
+ b0f:	90                   	nop
+
+00000b10 <free>:
+static Header base;
+static Header *freep;
+
+void
+free(void *ap)
+{
+ b10:	55                   	push   %ebp
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ b11:	a1 30 25 00 00       	mov    0x2530,%eax
+{
+ b16:	89 e5                	mov    %esp,%ebp
+ b18:	57                   	push   %edi
+ b19:	56                   	push   %esi
+ b1a:	53                   	push   %ebx
+ b1b:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  bp = (Header*)ap - 1;
+ b1e:	8d 4b f8             	lea    -0x8(%ebx),%ecx
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ b21:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ b28:	89 c2                	mov    %eax,%edx
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ b2a:	8b 00                	mov    (%eax),%eax
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ b2c:	39 ca                	cmp    %ecx,%edx
+ b2e:	73 30                	jae    b60 <free+0x50>
+ b30:	39 c1                	cmp    %eax,%ecx
+ b32:	72 04                	jb     b38 <free+0x28>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ b34:	39 c2                	cmp    %eax,%edx
+ b36:	72 f0                	jb     b28 <free+0x18>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+ b38:	8b 73 fc             	mov    -0x4(%ebx),%esi
+ b3b:	8d 3c f1             	lea    (%ecx,%esi,8),%edi
+ b3e:	39 f8                	cmp    %edi,%eax
+ b40:	74 2e                	je     b70 <free+0x60>
+    bp->s.size += p->s.ptr->s.size;
+    bp->s.ptr = p->s.ptr->s.ptr;
+ b42:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  } else
+    bp->s.ptr = p->s.ptr;
+  if(p + p->s.size == bp){
+ b45:	8b 42 04             	mov    0x4(%edx),%eax
+ b48:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+ b4b:	39 f1                	cmp    %esi,%ecx
+ b4d:	74 38                	je     b87 <free+0x77>
+    p->s.size += bp->s.size;
+    p->s.ptr = bp->s.ptr;
+ b4f:	89 0a                	mov    %ecx,(%edx)
+  } else
+    p->s.ptr = bp;
+  freep = p;
+}
+ b51:	5b                   	pop    %ebx
+  freep = p;
+ b52:	89 15 30 25 00 00    	mov    %edx,0x2530
+}
+ b58:	5e                   	pop    %esi
+ b59:	5f                   	pop    %edi
+ b5a:	5d                   	pop    %ebp
+ b5b:	c3                   	ret
+ b5c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ b60:	39 c1                	cmp    %eax,%ecx
+ b62:	72 d0                	jb     b34 <free+0x24>
+ b64:	eb c2                	jmp    b28 <free+0x18>
+ b66:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ b6d:	8d 76 00             	lea    0x0(%esi),%esi
+    bp->s.size += p->s.ptr->s.size;
+ b70:	03 70 04             	add    0x4(%eax),%esi
+ b73:	89 73 fc             	mov    %esi,-0x4(%ebx)
+    bp->s.ptr = p->s.ptr->s.ptr;
+ b76:	8b 02                	mov    (%edx),%eax
+ b78:	8b 00                	mov    (%eax),%eax
+ b7a:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  if(p + p->s.size == bp){
+ b7d:	8b 42 04             	mov    0x4(%edx),%eax
+ b80:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+ b83:	39 f1                	cmp    %esi,%ecx
+ b85:	75 c8                	jne    b4f <free+0x3f>
+    p->s.size += bp->s.size;
+ b87:	03 43 fc             	add    -0x4(%ebx),%eax
+  freep = p;
+ b8a:	89 15 30 25 00 00    	mov    %edx,0x2530
+    p->s.size += bp->s.size;
+ b90:	89 42 04             	mov    %eax,0x4(%edx)
+    p->s.ptr = bp->s.ptr;
+ b93:	8b 4b f8             	mov    -0x8(%ebx),%ecx
+ b96:	89 0a                	mov    %ecx,(%edx)
+}
+ b98:	5b                   	pop    %ebx
+ b99:	5e                   	pop    %esi
+ b9a:	5f                   	pop    %edi
+ b9b:	5d                   	pop    %ebp
+ b9c:	c3                   	ret
+ b9d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000ba0 <malloc>:
+  return freep;
+}
+
+void*
+malloc(uint nbytes)
+{
+ ba0:	55                   	push   %ebp
+ ba1:	89 e5                	mov    %esp,%ebp
+ ba3:	57                   	push   %edi
+ ba4:	56                   	push   %esi
+ ba5:	53                   	push   %ebx
+ ba6:	83 ec 0c             	sub    $0xc,%esp
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ ba9:	8b 45 08             	mov    0x8(%ebp),%eax
+  if((prevp = freep) == 0){
+ bac:	8b 15 30 25 00 00    	mov    0x2530,%edx
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ bb2:	8d 78 07             	lea    0x7(%eax),%edi
+ bb5:	c1 ef 03             	shr    $0x3,%edi
+ bb8:	83 c7 01             	add    $0x1,%edi
+  if((prevp = freep) == 0){
+ bbb:	85 d2                	test   %edx,%edx
+ bbd:	0f 84 8d 00 00 00    	je     c50 <malloc+0xb0>
+    base.s.ptr = freep = prevp = &base;
+    base.s.size = 0;
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ bc3:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+ bc5:	8b 48 04             	mov    0x4(%eax),%ecx
+ bc8:	39 f9                	cmp    %edi,%ecx
+ bca:	73 64                	jae    c30 <malloc+0x90>
+  if(nu < 4096)
+ bcc:	bb 00 10 00 00       	mov    $0x1000,%ebx
+ bd1:	39 df                	cmp    %ebx,%edi
+ bd3:	0f 43 df             	cmovae %edi,%ebx
+  p = sbrk(nu * sizeof(Header));
+ bd6:	8d 34 dd 00 00 00 00 	lea    0x0(,%ebx,8),%esi
+ bdd:	eb 0a                	jmp    be9 <malloc+0x49>
+ bdf:	90                   	nop
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ be0:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+ be2:	8b 48 04             	mov    0x4(%eax),%ecx
+ be5:	39 f9                	cmp    %edi,%ecx
+ be7:	73 47                	jae    c30 <malloc+0x90>
+        p->s.size = nunits;
+      }
+      freep = prevp;
+      return (void*)(p + 1);
+    }
+    if(p == freep)
+ be9:	89 c2                	mov    %eax,%edx
+ beb:	39 05 30 25 00 00    	cmp    %eax,0x2530
+ bf1:	75 ed                	jne    be0 <malloc+0x40>
+  p = sbrk(nu * sizeof(Header));
+ bf3:	83 ec 0c             	sub    $0xc,%esp
+ bf6:	56                   	push   %esi
+ bf7:	e8 2f fc ff ff       	call   82b <sbrk>
+  if(p == (char*)-1)
+ bfc:	83 c4 10             	add    $0x10,%esp
+ bff:	83 f8 ff             	cmp    $0xffffffff,%eax
+ c02:	74 1c                	je     c20 <malloc+0x80>
+  hp->s.size = nu;
+ c04:	89 58 04             	mov    %ebx,0x4(%eax)
+  free((void*)(hp + 1));
+ c07:	83 ec 0c             	sub    $0xc,%esp
+ c0a:	83 c0 08             	add    $0x8,%eax
+ c0d:	50                   	push   %eax
+ c0e:	e8 fd fe ff ff       	call   b10 <free>
+  return freep;
+ c13:	8b 15 30 25 00 00    	mov    0x2530,%edx
+      if((p = morecore(nunits)) == 0)
+ c19:	83 c4 10             	add    $0x10,%esp
+ c1c:	85 d2                	test   %edx,%edx
+ c1e:	75 c0                	jne    be0 <malloc+0x40>
+        return 0;
+  }
+}
+ c20:	8d 65 f4             	lea    -0xc(%ebp),%esp
+        return 0;
+ c23:	31 c0                	xor    %eax,%eax
+}
+ c25:	5b                   	pop    %ebx
+ c26:	5e                   	pop    %esi
+ c27:	5f                   	pop    %edi
+ c28:	5d                   	pop    %ebp
+ c29:	c3                   	ret
+ c2a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+      if(p->s.size == nunits)
+ c30:	39 cf                	cmp    %ecx,%edi
+ c32:	74 4c                	je     c80 <malloc+0xe0>
+        p->s.size -= nunits;
+ c34:	29 f9                	sub    %edi,%ecx
+ c36:	89 48 04             	mov    %ecx,0x4(%eax)
+        p += p->s.size;
+ c39:	8d 04 c8             	lea    (%eax,%ecx,8),%eax
+        p->s.size = nunits;
+ c3c:	89 78 04             	mov    %edi,0x4(%eax)
+      freep = prevp;
+ c3f:	89 15 30 25 00 00    	mov    %edx,0x2530
+}
+ c45:	8d 65 f4             	lea    -0xc(%ebp),%esp
+      return (void*)(p + 1);
+ c48:	83 c0 08             	add    $0x8,%eax
+}
+ c4b:	5b                   	pop    %ebx
+ c4c:	5e                   	pop    %esi
+ c4d:	5f                   	pop    %edi
+ c4e:	5d                   	pop    %ebp
+ c4f:	c3                   	ret
+    base.s.ptr = freep = prevp = &base;
+ c50:	c7 05 30 25 00 00 34 	movl   $0x2534,0x2530
+ c57:	25 00 00 
+    base.s.size = 0;
+ c5a:	b8 34 25 00 00       	mov    $0x2534,%eax
+    base.s.ptr = freep = prevp = &base;
+ c5f:	c7 05 34 25 00 00 34 	movl   $0x2534,0x2534
+ c66:	25 00 00 
+    base.s.size = 0;
+ c69:	c7 05 38 25 00 00 00 	movl   $0x0,0x2538
+ c70:	00 00 00 
+    if(p->s.size >= nunits){
+ c73:	e9 54 ff ff ff       	jmp    bcc <malloc+0x2c>
+ c78:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ c7f:	90                   	nop
+        prevp->s.ptr = p->s.ptr;
+ c80:	8b 08                	mov    (%eax),%ecx
+ c82:	89 0a                	mov    %ecx,(%edx)
+ c84:	eb b9                	jmp    c3f <malloc+0x9f>
@@ -0,0 +1,175 @@
+#include "types.h"
+#include "stat.h"
+#include "user.h"
+#include "fcntl.h"
+#include "param.h"
+#include "fs.h"
+#include "spaslog.h"
+
+// Persistent SPAS telemetry logger.
+//
+// Drains the kernel telemetry stream and appends it to a binary log
+// (format in spaslog.h).  Samples are kept in memory and written
+// BATCH whole blocks at a time, so the file system sees one log
+// transaction per BATCH * SPASLOG_NREC analytics periods.  Between
+// reads the logger sleeps for several periods and picks up everything
+// the kernel buffered meanwhile, so it wakes rarely and never misses
+// samples as long as it keeps up with the ring.
+//
+// A file holds at most MAXFILE blocks (about 23 minutes of samples at
+// the default load_period), so the log continues in file.1, file.2
+// and so on.  A restarted logger appends to the last of these.
+//
+// Usage: spaslog [-n samples] [file]
+//
+// Runs until killed, or until -n samples have been logged; the
+// partly filled batch is written out only in the latter case.
+// Convert the log on the host with: spaslog2csv fs.img [file]
+
+#define BATCH 3        // Blocks per write; filewrite() logs 3 per transaction
+#define NAP   5        // Analytics periods to sleep between reads
+
+struct spaslog_block batch[BATCH];
+int nblk;              // Full blocks in batch
+struct telemetry rec[NTELEMETRY];
+char *path;
+int seg;               // Current file is path, or path.seg if seg > 0
+int fd = -1;
+int size;              // Bytes in the current file
+
+static char*
+segname(int k)
+{
+  static char name[DIRSIZ + 1];
+  char num[12];
+  int i;
+
+  strcpy(name, path);
+  if(k == 0)
+    return name;
+  i = sizeof(num) - 1;
+  num[i] = 0;
+  do{
+    num[--i] = '0' + k % 10;
+  }while((k /= 10) != 0);
+  num[--i] = '.';
+  if(strlen(name) + strlen(num + i) > DIRSIZ)
+    return 0;
+  strcpy(name + strlen(name), num + i);
+  return name;
+}
+
+// Open segment seg for appending.  There is no lseek, so read
+// through any existing contents to reach the end.
+static int
+openseg(void)
+{
+  static char buf[BSIZE];
+  char *name;
+  int n;
+
+  if(fd >= 0)
+    close(fd);
+  if((name = segname(seg)) == 0){
+    printf(2, "spaslog: %s: too many segments\n", path);
+    return -1;
+  }
+  if((fd = open(name, O_CREATE | O_RDWR)) < 0){
+    printf(2, "spaslog: cannot open %s\n", name);
+    return -1;
+  }
+  size = 0;
+  while((n = read(fd, buf, sizeof(buf))) > 0)
+    size += n;
+  return 0;
+}
+
+static int
+flush(int n)
+{
+  if(n == 0)
+    return 0;
+  if(size + n * BSIZE > MAXFILE * BSIZE){
+    seg++;
+    if(openseg() < 0)
+      return -1;
+  }
+  if(write(fd, batch, n * BSIZE) != n * BSIZE){
+    printf(2, "spaslog: write failed\n");
+    return -1;
+  }
+  size += n * BSIZE;
+  memset(batch, 0, sizeof(batch));
+  return 0;
+}
+
+// Add one sample; write out the batch when every block is full.
+static int
+add(struct telemetry *t)
+{
+  struct spaslog_block *b;
+
+  b = &batch[nblk];
+  b->hdr.magic = SPASLOG_MAGIC;
+  b->hdr.recsize = sizeof(struct telemetry);
+  b->rec[b->hdr.nrec++] = *t;
+  if(b->hdr.nrec == SPASLOG_NREC && ++nblk == BATCH){
+    nblk = 0;
+    return flush(BATCH);
+  }
+  return 0;
+}
+
+int
+main(int argc, char *argv[])
+{
+  char *name;
+  int i, n, limit, logged, period;
+  uint seq;
+
+  path = "spas.log";
+  limit = 0;
+  for(i = 1; i < argc; i++){
+    if(strcmp(argv[i], "-n") == 0 && i + 1 < argc)
+      limit = atoi(argv[++i]);
+    else
+      path = argv[i];
+  }
+
+  if(strlen(path) > DIRSIZ){
+    printf(2, "spaslog: name too long: %s\n", path);
+    exit();
+  }
+
+  // Find the last existing segment and append to it.
+  for(seg = 0; (name = segname(seg + 1)) != 0; seg++){
+    if((fd = open(name, O_RDONLY)) < 0)
+      break;
+    close(fd);
+  }
+  fd = -1;
+  if(openseg() < 0)
+    exit();
+  if(sysctl(-1, "load_period", &period, 0) < 0)
+    period = 100;
+
+  seq = 0;
+  logged = 0;
+  while(limit == 0 || logged < limit){
+    if((n = telemetry(&seq, rec, NTELEMETRY)) < 0){
+      printf(2, "spaslog: telemetry failed\n");
+      break;
+    }
+    for(i = 0; i < n && (limit == 0 || logged < limit); i++, logged++){
+      if(rec[i].dropped)
+        printf(2, "spaslog: %d samples dropped\n", rec[i].dropped);
+      if(add(&rec[i]) < 0)
+        exit();
+    }
+    if(limit == 0 || logged < limit)
+      sleep(NAP * period);
+  }
+  flush(nblk + (batch[nblk].hdr.nrec > 0));
+  close(fd);
+  exit();
+}
@@ -0,0 +1,27 @@
+// On-disk format of the SPAS telemetry log written by spaslog and
+// read back on the host by spaslog2csv.  Include types.h and fs.h
+// first.
+//
+// The log is a sequence of BSIZE blocks, each holding a header and
+// up to SPASLOG_NREC struct telemetry records.  Blocks are
+// self-contained, so a log may be appended to by several runs and a
+// torn tail costs at most the block being written.
+
+#define SPASLOG_MAGIC 0x474c5053  // "SPLG"
+
+struct spaslog_hdr {
+  uint magic;
+  uint nrec;      // Records used in this block
+  uint recsize;   // sizeof(struct telemetry) when written
+  uint pad;
+};
+
+#define SPASLOG_NREC \
+  ((BSIZE - sizeof(struct spaslog_hdr)) / sizeof(struct telemetry))
+
+struct spaslog_block {
+  struct spaslog_hdr hdr;
+  struct telemetry rec[SPASLOG_NREC];
+  char pad[BSIZE - sizeof(struct spaslog_hdr) -
+           SPASLOG_NREC * sizeof(struct telemetry)];
+};
@@ -0,0 +1,157 @@
+// Host-side decoder for the SPAS telemetry log.
+//
+// Finds a log in the root directory of an xv6 fs.img, reads it
+// through the inode's block map and prints its spaslog records
+// (see spaslog.h) as CSV.  The segments spaslog continues the log
+// in (file.1, file.2, ...) follow in order.
+//
+// Usage: spaslog2csv fs.img [file]
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define stat xv6_stat  // avoid clash with host struct stat
+#define timespec xv6_timespec  // ... and struct timespec
+#include "types.h"
+#include "fs.h"
+#include "stat.h"
+#include "spaslog.h"
+
+char *freq_str[] = { "LOW", "MEDIUM", "HIGH" };
+
+FILE *img;
+struct superblock sb;
+
+static void
+rsect(uint sec, void *buf)
+{
+  if(fseek(img, (long)sec * BSIZE, SEEK_SET) != 0 ||
+     fread(buf, BSIZE, 1, img) != 1){
+    fprintf(stderr, "spaslog2csv: cannot read block %u\n", sec);
+    exit(1);
+  }
+}
+
+static void
+rinode(uint inum, struct dinode *ip)
+{
+  char buf[BSIZE];
+
+  if(inum >= sb.ninodes){
+    fprintf(stderr, "spaslog2csv: bad inode %u\n", inum);
+    exit(1);
+  }
+  rsect(IBLOCK(inum, sb), buf);
+  *ip = ((struct dinode*)buf)[inum % IPB];
+}
+
+// Disk block holding block bn of the file, or 0 if there is none.
+static uint
+bmap(struct dinode *ip, uint bn)
+{
+  uint ind[NINDIRECT];
+
+  if(bn < NDIRECT)
+    return ip->addrs[bn];
+  bn -= NDIRECT;
+  if(bn >= NINDIRECT || ip->addrs[NDIRECT] == 0)
+    return 0;
+  rsect(ip->addrs[NDIRECT], ind);
+  return ind[bn];
+}
+
+static uint
+lookup(char *name)
+{
+  struct dinode root;
+  struct dirent de[BSIZE / sizeof(struct dirent)];
+  uint bn, i, n;
+
+  rinode(ROOTINO, &root);
+  n = 0;
+  for(bn = 0; bn * BSIZE < root.size; bn++){
+    rsect(bmap(&root, bn), de);
+    for(i = 0; i < BSIZE / sizeof(struct dirent); i++, n++){
+      if(n * sizeof(struct dirent) >= root.size)
+        return 0;
+      if(de[i].inum && strncmp(de[i].name, name, DIRSIZ) == 0)
+        return de[i].inum;
+    }
+  }
+  return 0;
+}
+
+// Print the records of the file at inode inum; return the number of
+// blocks that were not valid log blocks.
+static uint
+decode(uint inum)
+{
+  struct dinode ip;
+  struct spaslog_block b;
+  struct telemetry *t;
+  uint bn, addr, i, bad;
+
+  rinode(inum, &ip);
+  if(ip.type != T_FILE)
+    return 0;
+  bad = 0;
+  for(bn = 0; bn * BSIZE < ip.size; bn++){
+    if((addr = bmap(&ip, bn)) == 0)
+      break;
+    rsect(addr, &b);
+    if(b.hdr.magic != SPASLOG_MAGIC ||
+       b.hdr.recsize != sizeof(struct telemetry) ||
+       b.hdr.nrec > SPASLOG_NREC){
+      bad++;
+      continue;
+    }
+    for(i = 0; i < b.hdr.nrec; i++){
+      t = &b.rec[i];
+      printf("%u,%u,%u,%d,%d,%s,%d.%d,%d,%d,%u,%u,%u\n", t->seq, t->tick,
+             t->dropped, t->load, t->predicted_load,
+             t->frequency_level >= 0 && t->frequency_level <= 2 ?
+               freq_str[t->frequency_level] : "?",
+             t->temp / 10, t->temp % 10, t->thresh_low_med,
+             t->thresh_med_high, t->switches, t->throttled, t->energy_mj);
+    }
+  }
+  return bad;
+}
+
+int
+main(int argc, char *argv[])
+{
+  char buf[BSIZE], seg[DIRSIZ + 16];
+  uint inum, k, bad;
+  char *name;
+
+  if(argc < 2 || argc > 3){
+    fprintf(stderr, "usage: spaslog2csv fs.img [file]\n");
+    return 1;
+  }
+  name = argc > 2 ? argv[2] : "spas.log";
+  if((img = fopen(argv[1], "rb")) == 0){
+    perror(argv[1]);
+    return 1;
+  }
+  rsect(1, buf);
+  memmove(&sb, buf, sizeof(sb));
+
+  if((inum = lookup(name)) == 0){
+    fprintf(stderr, "spaslog2csv: no %s in %s\n", name, argv[1]);
+    return 1;
+  }
+  printf("seq,tick,dropped,load,predicted,freq,temp,thresh_low_med,"
+         "thresh_med_high,switches,throttled,energy_mj\n");
+  bad = decode(inum);
+  for(k = 1; ; k++){
+    snprintf(seg, sizeof(seg), "%s.%u", name, k);
+    if(strlen(seg) > DIRSIZ || (inum = lookup(seg)) == 0)
+      break;
+    bad += decode(inum);
+  }
+  if(bad)
+    fprintf(stderr, "spaslog2csv: skipped %u bad blocks\n", bad);
+  return 0;
+}
@@ -0,0 +1,408 @@
+// Host-side SPAS policy simulator.
+//
+// Replays a load trace through the same spas.c the kernel runs and
+// prints, per analytics period, the load, prediction, frequency,
+// temperature, thresholds and cumulative switch count as CSV,
+// followed by each simulated CPU's temperature and effective level.
+// While SPAS has CPUs parked, each period's load is packed onto the
+// active CPUs, as the kernel's scheduler would.
+// With -s it instead sweeps history size, heating factor and
+// threshold combinations and prints one summary line per run.
+//
+// Usage: spassim [options] [tracefile]
+//   tracefile      one sample per line, load 0-100 in column -c
+//                  and, for -N n, the other CPUs' loads in the
+//                  following columns (a short row repeats its last
+//                  load); comma or whitespace separated, '#' comments;
+//                  "-" reads standard input
+//   -g spec        synthetic trace instead of a file:
+//                    const:L  step:A:B:P  square:A:B:P
+//                    ramp:A:B:P  random:SEED
+//   -n periods     length of a synthetic trace (default 500)
+//   -N ncpu        CPUs to simulate (default 1)
+//   -1             synthetic load on CPU 0 only, others idle
+//   -c col         trace column holding the load (default 0)
+//   -S size        history size           -P ticks  load period
+//   -L pct         LOW->MEDIUM threshold  -M pct    MEDIUM->HIGH
+//   -H n           heating factor         -C n      cooling factor
+//   -T temp        throttle limit (tenths of degrees C)
+//   -X pct         neighbour heat coupling
+//   -K n -I n -D n thermal PID gains (1/16ths)
+//   -G name        governor for every CPU (spas, performance,
+//                  powersave, ondemand, conservative)
+//   -t name=value  set any tunable the kernel's sysctl() accepts
+//   -s             parameter sweep, summaries only
+//   -q             summary only
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <ctype.h>
+#include <unistd.h>
+
+#define timespec xv6_timespec  // avoid clash with host struct timespec
+#include "types.h"
+#include "param.h"
+#include "spas.h"
+
+struct result {
+  int periods;
+  uint nswitch;
+  uint nthrottle;
+  int maxtemp;
+  int avgtemp;
+  int mae;               // mean |predicted - next load|
+  int perf;              // mean speed of busy CPUs (duty percent)
+  uint energy_mj;        // simulated energy of all CPUs
+  int residency[NFREQ];  // CPU-periods spent at each level
+};
+
+int (*trace)[NCPU];
+int ntrace;
+int ncpu = 1;
+int cpu0only;
+
+static void
+usage(void)
+{
+  fprintf(stderr, "usage: spassim [-g spec] [-n periods] [-c col] [-S size] "
+          "[-N ncpu] [-1] [-P ticks] [-L pct] [-M pct] [-H n] [-C n] [-T temp] "
+          "[-X pct] [-K n] [-I n] [-D n] [-G governor] [-t name=value] [-s] [-q] "
+          "[tracefile]\n");
+  exit(1);
+}
+
+// Append one period; loads for CPUs past n repeat load[n-1].
+static void
+addrow(int *load, int n)
+{
+  static int cap;
+  int i, v;
+
+  if(ntrace == cap){
+    cap = cap ? cap * 2 : 1024;
+    if((trace = realloc(trace, cap * sizeof(trace[0]))) == 0){
+      perror("realloc");
+      exit(1);
+    }
+  }
+  for(i = 0; i < NCPU; i++){
+    v = load[i < n ? i : n - 1];
+    if(v < 0)
+      v = 0;
+    if(v > 100)
+      v = 100;
+    trace[ntrace][i] = v;
+  }
+  ntrace++;
+}
+
+static void
+addsample(int load)
+{
+  int row[NCPU];
+  int i;
+
+  row[0] = load;
+  for(i = 1; i < NCPU; i++)
+    row[i] = cpu0only ? 0 : load;
+  addrow(row, NCPU);
+}
+
+static char*
+skipfield(char *p)
+{
+  while(*p && *p != ',' && !isspace((uchar)*p))
+    p++;
+  while(*p == ',' || isspace((uchar)*p))
+    p++;
+  return p;
+}
+
+// Load columns col.. of every non-comment line of f.
+static void
+readtrace(FILE *f, int col)
+{
+  char line[512], *p;
+  int i, n, row[NCPU];
+
+  while(fgets(line, sizeof(line), f)){
+    p = line;
+    while(isspace((uchar)*p))
+      p++;
+    if(*p == '#' || *p == 0)
+      continue;
+    for(i = 0; i < col && *p; i++)
+      p = skipfield(p);
+    for(n = 0; n < ncpu && (isdigit((uchar)*p) || *p == '-'); n++){
+      row[n] = atoi(p);
+      p = skipfield(p);
+    }
+    if(n == 0)
+      continue;  // header line or short row
+    addrow(row, n);
+  }
+}
+
+// Build a synthetic trace of n periods from spec.
+static void
+gentrace(char *spec, int n)
+{
+  int a = 0, b = 100, period = 50, i;
+  uint seed;
+
+  if(sscanf(spec, "const:%d", &a) == 1){
+    for(i = 0; i < n; i++)
+      addsample(a);
+  } else if(sscanf(spec, "step:%d:%d:%d", &a, &b, &period) == 3){
+    for(i = 0; i < n; i++)
+      addsample(i < period ? a : b);
+  } else if(sscanf(spec, "square:%d:%d:%d", &a, &b, &period) == 3 && period > 0){
+    for(i = 0; i < n; i++)
+      addsample((i / period) % 2 ? b : a);
+  } else if(sscanf(spec, "ramp:%d:%d:%d", &a, &b, &period) == 3 && period > 0){
+    for(i = 0; i < n; i++)
+      addsample(a + (b - a) * (i % period) / period);
+  } else if(sscanf(spec, "random:%u", &seed) == 1){
+    srand(seed);
+    for(i = 0; i < n; i++)
+      addsample(rand() % 101);
+  } else {
+    fprintf(stderr, "spassim: bad trace spec %s\n", spec);
+    exit(1);
+  }
+}
+
+// Pack the total of one period's loads in onto the CPUs s leaves
+// active, filling each to 100% in turn; parked CPUs get none.
+static void
+pack(struct spas *s, int *in, int *out)
+{
+  int j, total;
+
+  if(s->nactive >= s->ncpu){
+    for(j = 0; j < s->ncpu; j++)
+      out[j] = in[j];
+    return;
+  }
+  total = 0;
+  for(j = 0; j < s->ncpu; j++)
+    total += in[j];
+  for(j = 0; j < s->ncpu; j++){
+    out[j] = j < s->nactive ? total / (s->nactive - j) : 0;
+    if(out[j] > 100)
+      out[j] = 100;
+    total -= out[j];
+  }
+}
+
+// Run the whole trace through a copy of the initial state *init.
+static void
+run(struct spas *init, struct result *r, int verbose)
+{
+  struct spas s;
+  int i, j, err, load, tempsum, errsum, perfsum, busy;
+  int packed[NCPU];
+  uint now, busyticks;
+
+  s = *init;
+  memset(r, 0, sizeof(*r));
+  tempsum = errsum = perfsum = busy = 0;
+  r->maxtemp = s.virtual_temp;
+
+  if(verbose){
+    printf("period,tick,load,predicted,freq,temp,thresh_low_med,"
+           "thresh_med_high,switches");
+    for(j = 0; j < s.ncpu; j++)
+      printf(",cpu%d_temp,cpu%d_freq", j, j);
+    printf("\n");
+  }
+  for(i = 0; i < ntrace; i++){
+    if(i > 0){
+      load = 0;
+      for(j = 0; j < s.ncpu; j++)
+        load += trace[i][j];
+      err = s.predicted_load - load / s.ncpu;
+      errsum += err < 0 ? -err : err;
+    }
+    now = (uint)(i + 1) * s.load_period;
+    pack(&s, trace[i], packed);
+    // The kernel's scheduler halts a CPU with nothing to run, in
+    // the deeper park state if SPAS has parked it.
+    for(j = 0; j < s.ncpu; j++){
+      busyticks = packed[j] * s.load_period / 100;
+      spas_account(&s, j, busyticks, s.load_period - busyticks,
+                   j < s.nactive ? IDLE_HALT : IDLE_PARK);
+    }
+    spas_update(&s, packed, now);
+    for(j = 0; j < s.ncpu; j++){
+      r->residency[s.cpu[j].freq]++;
+      if(s.cpu[j].load > 0){
+        perfsum += s.duty[s.cpu[j].freq];
+        busy++;
+      }
+    }
+    tempsum += s.virtual_temp;
+    if(s.virtual_temp > r->maxtemp)
+      r->maxtemp = s.virtual_temp;
+    if(verbose){
+      printf("%d,%u,%d,%d,%s,%d.%d,%d,%d,%u", i, now, s.cpu_load,
+             s.predicted_load, freq_str[s.frequency],
+             s.virtual_temp / 10, s.virtual_temp % 10,
+             s.thresh_low_med, s.thresh_med_high, s.nswitch);
+      for(j = 0; j < s.ncpu; j++)
+        printf(",%d.%d,%s", s.cpu[j].temp / 10, s.cpu[j].temp % 10,
+               freq_str[s.cpu[j].freq]);
+      printf("\n");
+    }
+  }
+  r->periods = ntrace;
+  r->nswitch = s.nswitch;
+  r->nthrottle = s.nthrottle;
+  if(ntrace > 0)
+    r->avgtemp = tempsum / ntrace;
+  if(ntrace > 1)
+    r->mae = errsum / (ntrace - 1);
+  if(busy > 0)
+    r->perf = perfsum / busy;
+  for(j = 0; j < s.ncpu; j++)
+    r->energy_mj += s.cpu[j].energy_mj;
+}
+
+static void
+summary(struct spas *s, struct result *r)
+{
+  printf("%d,%d,%d,%d,%d,%d,%u,%u,%d.%d,%d.%d,%d,%d,%u.%03u,%d,%d,%d\n",
+         s->history_size, s->thresh_low_med, s->thresh_med_high,
+         s->heating_factor, s->cooling_factor, r->periods,
+         r->nswitch, r->nthrottle,
+         r->maxtemp / 10, r->maxtemp % 10, r->avgtemp / 10, r->avgtemp % 10,
+         r->mae, r->perf, r->energy_mj / 1000, r->energy_mj % 1000,
+         r->residency[LOW], r->residency[MEDIUM], r->residency[HIGH]);
+}
+
+static void
+summaryhdr(void)
+{
+  printf("history,thresh_low_med,thresh_med_high,heating,cooling,periods,"
+         "switches,throttled,maxtemp,avgtemp,mae,perf,energy,low,medium,high\n");
+}
+
+// Try every combination of history size, heating factor and
+// threshold pair around the base configuration.
+static void
+sweep(struct spas *base)
+{
+  static int heat[] = { 5, 10, 15, 20, 25, 30, 40, 50 };
+  struct spas s;
+  struct result r;
+  int h, i, lo, hi;
+
+  summaryhdr();
+  for(h = 1; h <= MAXHISTORY; h++){
+    for(i = 0; i < sizeof(heat)/sizeof(heat[0]); i++){
+      for(lo = 10; lo <= 60; lo += 10){
+        for(hi = lo + 10; hi <= 90; hi += 10){
+          s = *base;
+          s.history_size = h;
+          s.heating_factor = heat[i];
+          s.thresh_low_med = lo;
+          s.thresh_med_high = hi;
+          run(&s, &r, 0);
+          summary(&s, &r);
+        }
+      }
+    }
+  }
+}
+
+int
+main(int argc, char *argv[])
+{
+  struct spas s;
+  struct result r;
+  char *spec = 0, *eq;
+  int c, col = 0, n = 500, dosweep = 0, quiet = 0;
+  FILE *f;
+
+  for(c = 1; c < argc - 1; c++)  // -N first: spas_init needs it
+    if(strcmp(argv[c], "-N") == 0)
+      ncpu = atoi(argv[c+1]);
+  if(ncpu < 1 || ncpu > NCPU){
+    fprintf(stderr, "spassim: ncpu must be 1..%d\n", NCPU);
+    exit(1);
+  }
+  spas_init(&s, ncpu);
+  while((c = getopt(argc, argv, "g:n:c:N:1S:P:L:M:H:C:T:X:K:I:D:G:t:sq")) != -1){
+    switch(c){
+    case 'g': spec = optarg; break;
+    case 'n': n = atoi(optarg); break;
+    case 'c': col = atoi(optarg); break;
+    case 'N': break;
+    case '1': cpu0only = 1; break;
+    case 'S': s.history_size = atoi(optarg); break;
+    case 'P': s.load_period = atoi(optarg); break;
+    case 'L': s.thresh_low_med = atoi(optarg); break;
+    case 'M': s.thresh_med_high = atoi(optarg); break;
+    case 'H': s.heating_factor = atoi(optarg); break;
+    case 'C': s.cooling_factor = atoi(optarg); break;
+    case 'T': s.throttle_limit = atoi(optarg); break;
+    case 'X': s.coupling = atoi(optarg); break;
+    case 'K': s.pid_kp = atoi(optarg); break;
+    case 'I': s.pid_ki = atoi(optarg); break;
+    case 'D': s.pid_kd = atoi(optarg); break;
+    case 'G':
+      if(spas_setgov(&s, -1, spas_govbyname(optarg)) < 0){
+        fprintf(stderr, "spassim: unknown governor %s\n", optarg);
+        exit(1);
+      }
+      break;
+    case 't':
+      if((eq = strchr(optarg, '=')) == 0)
+        usage();
+      *eq = 0;
+      if(spas_set(&s, optarg, atoi(eq + 1)) < 0){
+        fprintf(stderr, "spassim: cannot set %s to %s\n", optarg, eq + 1);
+        exit(1);
+      }
+      break;
+    case 's': dosweep = 1; break;
+    case 'q': quiet = 1; break;
+    default: usage();
+    }
+  }
+  if(s.history_size < 1 || s.history_size > MAXHISTORY){
+    fprintf(stderr, "spassim: history size must be 1..%d\n", MAXHISTORY);
+    exit(1);
+  }
+  if(s.load_period < 1){
+    fprintf(stderr, "spassim: load period must be positive\n");
+    exit(1);
+  }
+
+  if(spec)
+    gentrace(spec, n);
+  else if(optind < argc){
+    if(strcmp(argv[optind], "-") == 0)
+      f = stdin;
+    else if((f = fopen(argv[optind], "r")) == 0){
+      perror(argv[optind]);
+      exit(1);
+    }
+    readtrace(f, col);
+    if(f != stdin)
+      fclose(f);
+  } else
+    usage();
+
+  if(dosweep){
+    sweep(&s);
+    exit(0);
+  }
+  run(&s, &r, !quiet);
+  if(!quiet)
+    printf("\n");
+  summaryhdr();
+  summary(&s, &r);
+  exit(0);
+}
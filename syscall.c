@@ -105,6 +105,18 @@ extern int sys_write(void);
 extern int sys_uptime(void);
 extern int sys_cpustat(void); // <-- ADDED THIS LINE
 extern int sys_setpriority(void);
+extern int sys_cpuinfo(void);
+extern int sys_procinfo(void);
+extern int sys_setgovernor(void);
+extern int sys_sysctl(void);
+extern int sys_telemetry(void);
+extern int sys_clock_gettime(void);
+extern int sys_sched_setaffinity(void);
+extern int sys_sched_getaffinity(void);
+extern int sys_setqos(void);
+extern int sys_setgroup(void);
+extern int sys_setquota(void);
+extern int sys_groupinfo(void);
 
 static int (*syscalls[])(void) = {
 [SYS_fork]    sys_fork,
@@ -130,6 +142,18 @@ static int (*syscalls[])(void) = {
 [SYS_close]   sys_close,
 [SYS_cpustat] sys_cpustat, // <-- ADDED THIS LINE
 [SYS_setpriority] sys_setpriority,
+[SYS_cpuinfo] sys_cpuinfo,
+[SYS_procinfo] sys_procinfo,
+[SYS_setgovernor] sys_setgovernor,
+[SYS_sysctl] sys_sysctl,
+[SYS_telemetry] sys_telemetry,
+[SYS_clock_gettime] sys_clock_gettime,
+[SYS_sched_setaffinity] sys_sched_setaffinity,
+[SYS_sched_getaffinity] sys_sched_getaffinity,
+[SYS_setqos] sys_setqos,
+[SYS_setgroup] sys_setgroup,
+[SYS_setquota] sys_setquota,
+[SYS_groupinfo] sys_groupinfo,
 };
 
 void
@@ -22,3 +22,15 @@
 #define SYS_close  21
 #define SYS_cpustat 22
 #define SYS_setpriority 23
+#define SYS_cpuinfo 24
+#define SYS_procinfo 25
+#define SYS_setgovernor 26
+#define SYS_sysctl 27
+#define SYS_telemetry 28
+#define SYS_clock_gettime 29
+#define SYS_sched_setaffinity 30
+#define SYS_sched_getaffinity 31
+#define SYS_setqos 32
+#define SYS_setgroup 33
+#define SYS_setquota 34
+#define SYS_groupinfo 35
@@ -0,0 +1,39 @@
+#include "types.h"
+#include "stat.h"
+#include "user.h"
+
+// Read and set SPAS tunables at run time.
+// Usage: sysctl                  list every tunable and its value
+//        sysctl name             print one value
+//        sysctl name=value ...   set values
+
+int
+main(int argc, char *argv[])
+{
+  char name[SYSCTL_NAMELEN], *eq;
+  int i, val, old;
+
+  if(argc < 2){
+    for(i = 0; sysctl(i, name, &val, 0) == 0; i++)
+      printf(1, "%s = %d\n", name, val);
+    exit();
+  }
+
+  for(i = 1; i < argc; i++){
+    eq = strchr(argv[i], '=');
+    if(eq == 0){
+      if(sysctl(-1, argv[i], &val, 0) < 0)
+        printf(2, "sysctl: unknown tunable %s\n", argv[i]);
+      else
+        printf(1, "%s = %d\n", argv[i], val);
+      continue;
+    }
+    *eq = 0;
+    val = atoi(eq + 1);
+    if(sysctl(-1, argv[i], &old, &val) < 0)
+      printf(2, "sysctl: cannot set %s to %d\n", argv[i], val);
+    else
+      printf(1, "%s: %d -> %d\n", argv[i], old, val);
+  }
+  exit();
+}
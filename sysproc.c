@@ -5,6 +5,7 @@
 #include "param.h"
 #include "memlayout.h"
 #include "mmu.h"
+#include "spas.h"
 #include "proc.h"
 #include "spinlock.h"
 
@@ -13,12 +14,7 @@ extern struct {
   struct spinlock lock;
   struct proc proc[NPROC];
 } ptable;
-extern int cpu_load;
-extern int predicted_load;
-extern enum freq_level current_frequency;
-extern int THRESH_LOW_TO_MED;
-extern int THRESH_MED_TO_HIGH;
-extern int virtual_temp; // <-- ADDED for Phase 4
+extern struct spas spas;
 // --- End of externs ---
 
 int
@@ -80,12 +76,9 @@ sys_sleep(void)
     return -1;
   acquire(&tickslock);
   ticks0 = ticks;
-  while(ticks - ticks0 < n){
-    if(myproc()->killed){
-      release(&tickslock);
-      return -1;
-    }
-    sleep(&ticks, &tickslock);
+  if(sleepuntil(ticks0 + n) < 0){
+    release(&tickslock);
+    return -1;
   }
   release(&tickslock);
   return 0;
@@ -116,12 +109,16 @@ sys_cpustat(void)
     return -1;
 
   // 2. Populate our kernel-space struct
-  st_kernel.load = cpu_load;
-  st_kernel.predicted_load = predicted_load;
-  st_kernel.frequency_level = (int)current_frequency;
-  st_kernel.temp = virtual_temp; // <-- UPDATED for Phase 4
-  st_kernel.thresh_low_med = THRESH_LOW_TO_MED;
-  st_kernel.thresh_med_high = THRESH_MED_TO_HIGH;
+  st_kernel.load = spas.cpu_load;
+  st_kernel.predicted_load = spas.predicted_load;
+  st_kernel.frequency_level = (int)spas.frequency;
+  st_kernel.temp = spas.virtual_temp; // hottest CPU
+  st_kernel.thresh_low_med = spas.thresh_low_med;
+  st_kernel.thresh_med_high = spas.thresh_med_high;
+  st_kernel.nrunning = spas.nrunning;
+  st_kernel.loadavg[0] = spas.loadavg[0];
+  st_kernel.loadavg[1] = spas.loadavg[1];
+  st_kernel.loadavg[2] = spas.loadavg[2];
 
   // 3. Safely copy the kernel data to the user's pointer
   if(copyout(myproc()->pgdir, (uint)st_user, &st_kernel, sizeof(st_kernel)) < 0)
@@ -131,6 +128,41 @@ sys_cpustat(void)
 }
 // --- End of new system call ---
 
+// Per-CPU load, frequency and thermal state.
+int
+sys_cpuinfo(void)
+{
+  int cpu, i;
+  struct cpuinfo *ci_user;
+  struct cpuinfo ci;
+
+  if(argint(0, &cpu) < 0)
+    return -1;
+  if(argptr(1, (char**)&ci_user, sizeof(*ci_user)) < 0)
+    return -1;
+  if(cpu < 0 || cpu >= ncpu)
+    return -1;
+
+  ci.load = spas.cpu[cpu].load;
+  ci.governor = (int)spas.cpu[cpu].governor;
+  ci.requested_level = (int)spas.cpu[cpu].want;
+  ci.frequency_level = (int)spas.cpu[cpu].freq;
+  ci.temp = spas.cpu[cpu].temp;
+  ci.thermal_cap = spas.cpu[cpu].cap;
+  ci.energy_mj = spas.cpu[cpu].energy_mj;
+  for(i = 0; i < NFREQ; i++)
+    ci.residency[i] = spas.cpu[cpu].residency[i];
+  for(i = 0; i < NIDLE; i++)
+    ci.idle_residency[i] = spas.cpu[cpu].idle_residency[i];
+  ci.stalled = spas.cpu[cpu].stalled;
+  ci.parked = cpu >= spas.nactive;
+  ci.thermal_migrations = spas.cpu[cpu].tmigrations;
+
+  if(copyout(myproc()->pgdir, (uint)ci_user, &ci, sizeof(ci)) < 0)
+    return -1;
+  return 0;
+}
+
 // System call to set process priority
 int
 sys_setpriority(void)
@@ -158,3 +190,233 @@ sys_setpriority(void)
   release(&ptable.lock);
   return -1; // PID not found
 }
+
+// Select frequency governor gov for cpu, or for all CPUs if cpu is -1.
+int
+sys_setgovernor(void)
+{
+  int cpu, gov, r;
+
+  if(argint(0, &cpu) < 0 || argint(1, &gov) < 0)
+    return -1;
+  acquire(&tickslock);
+  r = spas_setgov(&spas, cpu, gov);
+  release(&tickslock);
+  return r;
+}
+
+// sysctl(index, name, oldp, newp): read and/or write a SPAS tunable.
+// With index >= 0 the index'th tunable is used and its name is copied
+// out to name (SYSCTL_NAMELEN bytes); with index < 0 name is looked up.
+// If oldp is non-zero the current value is stored there, then if newp
+// is non-zero the value it points to is validated and set.
+int
+sys_sysctl(void)
+{
+  int index, oldaddr, newaddr, val, r;
+  char *name, *tname, *oldp, *newp;
+
+  if(argint(0, &index) < 0 || argint(2, &oldaddr) < 0 || argint(3, &newaddr) < 0)
+    return -1;
+  if(oldaddr && argptr(2, &oldp, sizeof(int)) < 0)
+    return -1;
+  if(newaddr && argptr(3, &newp, sizeof(int)) < 0)
+    return -1;
+  if(index >= 0){
+    if((tname = spas_tunable(index)) == 0)
+      return -1;
+    if(argptr(1, &name, SYSCTL_NAMELEN) < 0)
+      return -1;
+    safestrcpy(name, tname, SYSCTL_NAMELEN);
+  } else {
+    if(argstr(1, &name) < 0)
+      return -1;
+    tname = name;
+  }
+
+  // Analytics run under tickslock; don't change policy mid-update.
+  acquire(&tickslock);
+  r = spas_get(&spas, tname, &val);
+  if(r == 0 && oldaddr)
+    *(int*)oldp = val;
+  if(r == 0 && newaddr)
+    r = spas_set(&spas, tname, *(int*)newp);
+  release(&tickslock);
+  return r;
+}
+
+// Scheduling and energy information about process pid.
+int
+sys_procinfo(void)
+{
+  int pid;
+  struct procinfo *pi_user;
+  struct procinfo pi;
+  struct proc *p;
+
+  if(argint(0, &pid) < 0)
+    return -1;
+  if(argptr(1, (char**)&pi_user, sizeof(*pi_user)) < 0)
+    return -1;
+
+  acquire(&ptable.lock);
+  for(p = ptable.proc; p < &ptable.proc[NPROC]; p++){
+    if(p->pid == pid && p->state != UNUSED){
+      pi.pid = p->pid;
+      pi.ppid = p->parent ? p->parent->pid : 0;
+      pi.state = p->state;
+      pi.priority = p->priority;
+      pi.energy_mj = p->energy_mj;
+      pi.child_energy_mj = p->cenergy_mj;
+      pi.runtime_ms = div64(tsc2ns(p->runtime), 1000000, 0);
+      pi.cpu = p->cpu;
+      pi.load = p->load;
+      pi.lastcpu = p->lastcpu;
+      pi.migrations = p->migrations;
+      pi.class = p->class;
+      pi.nvcsw = p->nvcsw;
+      pi.nivcsw = p->nivcsw;
+      pi.qos = p->qos;
+      pi.group = p->group;
+      safestrcpy(pi.name, p->name, sizeof(pi.name));
+      release(&ptable.lock);
+      return copyout(myproc()->pgdir, (uint)pi_user, &pi, sizeof(pi));
+    }
+  }
+  release(&ptable.lock);
+  return -1; // PID not found
+}
+
+// Block until the analytics produce a sample newer than *seq, then
+// return up to n samples and advance *seq (see telemetry.c).
+int
+sys_telemetry(void)
+{
+  uint *seq_user, seq;
+  struct telemetry *buf;
+  int n, r;
+
+  if(argptr(0, (char**)&seq_user, sizeof(*seq_user)) < 0)
+    return -1;
+  if(argint(2, &n) < 0 || n <= 0 || n > NTELEMETRY)
+    return -1;
+  if(argptr(1, (char**)&buf, n*sizeof(*buf)) < 0)
+    return -1;
+
+  seq = *seq_user;
+  if((r = telemetryread(&seq, (uint)buf, n)) < 0)
+    return -1;
+  *seq_user = seq;
+  return r;
+}
+
+// Nanosecond time from the TSC.
+int
+sys_clock_gettime(void)
+{
+  int clk;
+  struct timespec *ts;
+  uint64 ns;
+
+  if(argint(0, &clk) < 0)
+    return -1;
+  if(argptr(1, (char**)&ts, sizeof(*ts)) < 0)
+    return -1;
+
+  switch(clk){
+  case CLOCK_MONOTONIC:
+    ns = tsc2ns(tscnow());
+    break;
+  case CLOCK_PROCESS_CPUTIME_ID:
+    pushcli();
+    cpufold();
+    ns = tsc2ns(myproc()->runtime);
+    popcli();
+    break;
+  default:
+    return -1;
+  }
+  ts->tv_sec = div64(ns, 1000000000, &ts->tv_nsec);
+  return 0;
+}
+
+// Restrict process pid (0 for the caller) to the CPUs in mask.
+int
+sys_sched_setaffinity(void)
+{
+  int pid, mask;
+
+  if(argint(0, &pid) < 0 || argint(1, &mask) < 0)
+    return -1;
+  return setaffinity(pid, mask);
+}
+
+int
+sys_sched_getaffinity(void)
+{
+  int pid;
+  uint *mask;
+
+  if(argint(0, &pid) < 0)
+    return -1;
+  if(argptr(1, (char**)&mask, sizeof(*mask)) < 0)
+    return -1;
+  return getaffinity(pid, mask);
+}
+
+// Declare the QoS class of process pid (0 for the caller); returns
+// the previous class.
+int
+sys_setqos(void)
+{
+  int pid, qos;
+
+  if(argint(0, &pid) < 0 || argint(1, &qos) < 0)
+    return -1;
+  return setqos(pid, qos);
+}
+
+// Move process pid (0 for the caller) into CPU bandwidth group gid.
+int
+sys_setgroup(void)
+{
+  int pid, gid;
+
+  if(argint(0, &pid) < 0 || argint(1, &gid) < 0)
+    return -1;
+  return setgroup(pid, gid);
+}
+
+// Limit group gid to quota_us of CPU time every period_us.
+int
+sys_setquota(void)
+{
+  int gid, quota, period;
+
+  if(argint(0, &gid) < 0 || argint(1, &quota) < 0 || argint(2, &period) < 0)
+    return -1;
+  return setquota(gid, quota, period);
+}
+
+int
+sys_groupinfo(void)
+{
+  int gid;
+  struct groupinfo *gi_user;
+  struct groupinfo gi;
+  struct proc *p;
+
+  if(argint(0, &gid) < 0)
+    return -1;
+  if(argptr(1, (char**)&gi_user, sizeof(*gi_user)) < 0)
+    return -1;
+  if(getgroupinfo(gid, &gi) < 0)
+    return -1;
+  gi.nproc = 0;
+  acquire(&ptable.lock);
+  for(p = ptable.proc; p < &ptable.proc[NPROC]; p++)
+    if(p->state != UNUSED && p->group == gid)
+      gi.nproc++;
+  release(&ptable.lock);
+  return copyout(myproc()->pgdir, (uint)gi_user, &gi, sizeof(gi));
+}
@@ -0,0 +1,1425 @@
+
+_taskset:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+  exit();
+}
+
+int
+main(int argc, char *argv[])
+{
+   0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+   4:	83 e4 f0             	and    $0xfffffff0,%esp
+   7:	ff 71 fc             	push   -0x4(%ecx)
+   a:	55                   	push   %ebp
+   b:	89 e5                	mov    %esp,%ebp
+   d:	56                   	push   %esi
+   e:	53                   	push   %ebx
+   f:	51                   	push   %ecx
+  10:	83 ec 1c             	sub    $0x1c,%esp
+  13:	8b 19                	mov    (%ecx),%ebx
+  15:	8b 71 04             	mov    0x4(%ecx),%esi
+  uint mask;
+  int pid;
+
+  if(argc < 3)
+  18:	83 fb 02             	cmp    $0x2,%ebx
+  1b:	7e 24                	jle    41 <main+0x41>
+    usage();
+
+  if(strcmp(argv[1], "-p") == 0){
+  1d:	51                   	push   %ecx
+  1e:	51                   	push   %ecx
+  1f:	68 7e 09 00 00       	push   $0x97e
+  24:	ff 76 04             	push   0x4(%esi)
+  27:	e8 f4 01 00 00       	call   220 <strcmp>
+  2c:	83 c4 10             	add    $0x10,%esp
+  2f:	85 c0                	test   %eax,%eax
+  31:	75 13                	jne    46 <main+0x46>
+    if(argc == 3){
+  33:	83 fb 03             	cmp    $0x3,%ebx
+  36:	0f 84 88 00 00 00    	je     c4 <main+0xc4>
+        exit();
+      }
+      printf(1, "pid %d's affinity mask: %x\n", pid, mask);
+      exit();
+    }
+    if(argc != 4 || hexmask(argv[2], &mask) < 0)
+  3c:	83 fb 04             	cmp    $0x4,%ebx
+  3f:	74 50                	je     91 <main+0x91>
+    usage();
+  41:	e8 8a 01 00 00       	call   1d0 <usage>
+    if(sched_setaffinity(pid, mask) < 0)
+      printf(2, "taskset: cannot set pid %d to %x\n", pid, mask);
+    exit();
+  }
+
+  if(hexmask(argv[1], &mask) < 0)
+  46:	8b 46 04             	mov    0x4(%esi),%eax
+  49:	8d 55 e4             	lea    -0x1c(%ebp),%edx
+  4c:	e8 ef 00 00 00       	call   140 <hexmask>
+  51:	85 c0                	test   %eax,%eax
+  53:	78 ec                	js     41 <main+0x41>
+    usage();
+  if(sched_setaffinity(0, mask) < 0){
+  55:	51                   	push   %ecx
+  56:	51                   	push   %ecx
+  57:	ff 75 e4             	push   -0x1c(%ebp)
+  5a:	6a 00                	push   $0x0
+  5c:	e8 b2 04 00 00       	call   513 <sched_setaffinity>
+  61:	83 c4 10             	add    $0x10,%esp
+  64:	85 c0                	test   %eax,%eax
+  66:	0f 88 a0 00 00 00    	js     10c <main+0x10c>
+    printf(2, "taskset: cannot set mask %x\n", mask);
+    exit();
+  }
+  exec(argv[2], argv + 2);
+  6c:	50                   	push   %eax
+  6d:	50                   	push   %eax
+  6e:	8d 46 08             	lea    0x8(%esi),%eax
+  71:	50                   	push   %eax
+  72:	ff 76 08             	push   0x8(%esi)
+  75:	e8 f1 03 00 00       	call   46b <exec>
+  printf(2, "taskset: exec %s failed\n", argv[2]);
+  7a:	83 c4 0c             	add    $0xc,%esp
+  7d:	ff 76 08             	push   0x8(%esi)
+  80:	68 d2 09 00 00       	push   $0x9d2
+  85:	6a 02                	push   $0x2
+  87:	e8 64 05 00 00       	call   5f0 <printf>
+  exit();
+  8c:	e8 a2 03 00 00       	call   433 <exit>
+    if(argc != 4 || hexmask(argv[2], &mask) < 0)
+  91:	8b 46 08             	mov    0x8(%esi),%eax
+  94:	8d 55 e4             	lea    -0x1c(%ebp),%edx
+  97:	e8 a4 00 00 00       	call   140 <hexmask>
+  9c:	85 c0                	test   %eax,%eax
+  9e:	78 a1                	js     41 <main+0x41>
+    pid = atoi(argv[3]);
+  a0:	83 ec 0c             	sub    $0xc,%esp
+  a3:	ff 76 0c             	push   0xc(%esi)
+  a6:	e8 15 03 00 00       	call   3c0 <atoi>
+    if(sched_setaffinity(pid, mask) < 0)
+  ab:	5e                   	pop    %esi
+    pid = atoi(argv[3]);
+  ac:	89 c3                	mov    %eax,%ebx
+    if(sched_setaffinity(pid, mask) < 0)
+  ae:	58                   	pop    %eax
+  af:	ff 75 e4             	push   -0x1c(%ebp)
+  b2:	53                   	push   %ebx
+  b3:	e8 5b 04 00 00       	call   513 <sched_setaffinity>
+  b8:	83 c4 10             	add    $0x10,%esp
+  bb:	85 c0                	test   %eax,%eax
+  bd:	78 62                	js     121 <main+0x121>
+    exit();
+  bf:	e8 6f 03 00 00       	call   433 <exit>
+      pid = atoi(argv[2]);
+  c4:	83 ec 0c             	sub    $0xc,%esp
+  c7:	ff 76 08             	push   0x8(%esi)
+  ca:	e8 f1 02 00 00       	call   3c0 <atoi>
+  cf:	89 c3                	mov    %eax,%ebx
+      if(sched_getaffinity(pid, &mask) < 0){
+  d1:	58                   	pop    %eax
+  d2:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  d5:	5a                   	pop    %edx
+  d6:	50                   	push   %eax
+  d7:	53                   	push   %ebx
+  d8:	e8 3e 04 00 00       	call   51b <sched_getaffinity>
+  dd:	83 c4 10             	add    $0x10,%esp
+  e0:	85 c0                	test   %eax,%eax
+  e2:	78 15                	js     f9 <main+0xf9>
+      printf(1, "pid %d's affinity mask: %x\n", pid, mask);
+  e4:	ff 75 e4             	push   -0x1c(%ebp)
+  e7:	53                   	push   %ebx
+  e8:	68 99 09 00 00       	push   $0x999
+  ed:	6a 01                	push   $0x1
+  ef:	e8 fc 04 00 00       	call   5f0 <printf>
+      exit();
+  f4:	e8 3a 03 00 00       	call   433 <exit>
+        printf(2, "taskset: no process %d\n", pid);
+  f9:	50                   	push   %eax
+  fa:	53                   	push   %ebx
+  fb:	68 81 09 00 00       	push   $0x981
+ 100:	6a 02                	push   $0x2
+ 102:	e8 e9 04 00 00       	call   5f0 <printf>
+        exit();
+ 107:	e8 27 03 00 00       	call   433 <exit>
+    printf(2, "taskset: cannot set mask %x\n", mask);
+ 10c:	52                   	push   %edx
+ 10d:	ff 75 e4             	push   -0x1c(%ebp)
+ 110:	68 b5 09 00 00       	push   $0x9b5
+ 115:	6a 02                	push   $0x2
+ 117:	e8 d4 04 00 00       	call   5f0 <printf>
+    exit();
+ 11c:	e8 12 03 00 00       	call   433 <exit>
+      printf(2, "taskset: cannot set pid %d to %x\n", pid, mask);
+ 121:	ff 75 e4             	push   -0x1c(%ebp)
+ 124:	53                   	push   %ebx
+ 125:	68 5c 09 00 00       	push   $0x95c
+ 12a:	6a 02                	push   $0x2
+ 12c:	e8 bf 04 00 00       	call   5f0 <printf>
+ 131:	83 c4 10             	add    $0x10,%esp
+ 134:	eb 89                	jmp    bf <main+0xbf>
+ 136:	66 90                	xchg   %ax,%ax
+ 138:	66 90                	xchg   %ax,%ax
+ 13a:	66 90                	xchg   %ax,%ax
+ 13c:	66 90                	xchg   %ax,%ax
+ 13e:	66 90                	xchg   %ax,%ax
+
+00000140 <hexmask>:
+{
+ 140:	55                   	push   %ebp
+ 141:	89 c1                	mov    %eax,%ecx
+ 143:	89 e5                	mov    %esp,%ebp
+ 145:	57                   	push   %edi
+ 146:	56                   	push   %esi
+ 147:	53                   	push   %ebx
+  if(s[0] == '0' && (s[1] == 'x' || s[1] == 'X'))
+ 148:	80 38 30             	cmpb   $0x30,(%eax)
+{
+ 14b:	89 d3                	mov    %edx,%ebx
+  if(s[0] == '0' && (s[1] == 'x' || s[1] == 'X'))
+ 14d:	74 58                	je     1a7 <hexmask+0x67>
+  if(*s == 0)
+ 14f:	0f b6 01             	movzbl (%ecx),%eax
+ 152:	84 c0                	test   %al,%al
+ 154:	74 6d                	je     1c3 <hexmask+0x83>
+  for(m = 0; (c = *s) != 0; s++){
+ 156:	0f be f8             	movsbl %al,%edi
+ 159:	89 f8                	mov    %edi,%eax
+ 15b:	31 f6                	xor    %esi,%esi
+ 15d:	eb 17                	jmp    176 <hexmask+0x36>
+ 15f:	90                   	nop
+      c -= '0';
+ 160:	83 e8 30             	sub    $0x30,%eax
+    m = (m << 4) | c;
+ 163:	c1 e6 04             	shl    $0x4,%esi
+  for(m = 0; (c = *s) != 0; s++){
+ 166:	83 c1 01             	add    $0x1,%ecx
+    m = (m << 4) | c;
+ 169:	09 f0                	or     %esi,%eax
+ 16b:	89 c6                	mov    %eax,%esi
+  for(m = 0; (c = *s) != 0; s++){
+ 16d:	0f be 01             	movsbl (%ecx),%eax
+ 170:	89 c7                	mov    %eax,%edi
+ 172:	85 c0                	test   %eax,%eax
+ 174:	74 2a                	je     1a0 <hexmask+0x60>
+    if(c >= '0' && c <= '9')
+ 176:	8d 57 d0             	lea    -0x30(%edi),%edx
+ 179:	83 fa 09             	cmp    $0x9,%edx
+ 17c:	76 e2                	jbe    160 <hexmask+0x20>
+    else if(c >= 'a' && c <= 'f')
+ 17e:	8d 57 9f             	lea    -0x61(%edi),%edx
+ 181:	83 fa 05             	cmp    $0x5,%edx
+ 184:	77 0a                	ja     190 <hexmask+0x50>
+      c -= 'a' - 10;
+ 186:	83 e8 57             	sub    $0x57,%eax
+ 189:	eb d8                	jmp    163 <hexmask+0x23>
+ 18b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 18f:	90                   	nop
+    else if(c >= 'A' && c <= 'F')
+ 190:	83 ef 41             	sub    $0x41,%edi
+ 193:	83 ff 05             	cmp    $0x5,%edi
+ 196:	77 2b                	ja     1c3 <hexmask+0x83>
+      c -= 'A' - 10;
+ 198:	83 e8 37             	sub    $0x37,%eax
+ 19b:	eb c6                	jmp    163 <hexmask+0x23>
+ 19d:	8d 76 00             	lea    0x0(%esi),%esi
+  *mask = m;
+ 1a0:	89 33                	mov    %esi,(%ebx)
+}
+ 1a2:	5b                   	pop    %ebx
+ 1a3:	5e                   	pop    %esi
+ 1a4:	5f                   	pop    %edi
+ 1a5:	5d                   	pop    %ebp
+ 1a6:	c3                   	ret
+  if(s[0] == '0' && (s[1] == 'x' || s[1] == 'X'))
+ 1a7:	0f b6 40 01          	movzbl 0x1(%eax),%eax
+ 1ab:	83 e0 df             	and    $0xffffffdf,%eax
+ 1ae:	3c 58                	cmp    $0x58,%al
+ 1b0:	75 05                	jne    1b7 <hexmask+0x77>
+    s += 2;
+ 1b2:	83 c1 02             	add    $0x2,%ecx
+ 1b5:	eb 98                	jmp    14f <hexmask+0xf>
+  for(m = 0; (c = *s) != 0; s++){
+ 1b7:	b8 30 00 00 00       	mov    $0x30,%eax
+ 1bc:	bf 30 00 00 00       	mov    $0x30,%edi
+ 1c1:	eb 98                	jmp    15b <hexmask+0x1b>
+    return -1;
+ 1c3:	83 c8 ff             	or     $0xffffffff,%eax
+ 1c6:	eb da                	jmp    1a2 <hexmask+0x62>
+ 1c8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 1cf:	90                   	nop
+
+000001d0 <usage>:
+{
+ 1d0:	55                   	push   %ebp
+ 1d1:	89 e5                	mov    %esp,%ebp
+ 1d3:	83 ec 10             	sub    $0x10,%esp
+  printf(2, "usage: taskset mask command [args...]\n"
+ 1d6:	68 18 09 00 00       	push   $0x918
+ 1db:	6a 02                	push   $0x2
+ 1dd:	e8 0e 04 00 00       	call   5f0 <printf>
+  exit();
+ 1e2:	e8 4c 02 00 00       	call   433 <exit>
+ 1e7:	66 90                	xchg   %ax,%ax
+ 1e9:	66 90                	xchg   %ax,%ax
+ 1eb:	66 90                	xchg   %ax,%ax
+ 1ed:	66 90                	xchg   %ax,%ax
+ 1ef:	90                   	nop
+
+000001f0 <strcpy>:
+#include "user.h"
+#include "x86.h"
+
+char*
+strcpy(char *s, const char *t)
+{
+ 1f0:	55                   	push   %ebp
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+ 1f1:	31 c0                	xor    %eax,%eax
+{
+ 1f3:	89 e5                	mov    %esp,%ebp
+ 1f5:	53                   	push   %ebx
+ 1f6:	8b 4d 08             	mov    0x8(%ebp),%ecx
+ 1f9:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+ 1fc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  while((*s++ = *t++) != 0)
+ 200:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+ 204:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+ 207:	83 c0 01             	add    $0x1,%eax
+ 20a:	84 d2                	test   %dl,%dl
+ 20c:	75 f2                	jne    200 <strcpy+0x10>
+    ;
+  return os;
+}
+ 20e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 211:	89 c8                	mov    %ecx,%eax
+ 213:	c9                   	leave
+ 214:	c3                   	ret
+ 215:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 21c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000220 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+ 220:	55                   	push   %ebp
+ 221:	89 e5                	mov    %esp,%ebp
+ 223:	53                   	push   %ebx
+ 224:	8b 55 08             	mov    0x8(%ebp),%edx
+ 227:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  while(*p && *p == *q)
+ 22a:	0f b6 02             	movzbl (%edx),%eax
+ 22d:	84 c0                	test   %al,%al
+ 22f:	75 17                	jne    248 <strcmp+0x28>
+ 231:	eb 3a                	jmp    26d <strcmp+0x4d>
+ 233:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 237:	90                   	nop
+ 238:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+    p++, q++;
+ 23c:	83 c2 01             	add    $0x1,%edx
+ 23f:	8d 59 01             	lea    0x1(%ecx),%ebx
+  while(*p && *p == *q)
+ 242:	84 c0                	test   %al,%al
+ 244:	74 1a                	je     260 <strcmp+0x40>
+    p++, q++;
+ 246:	89 d9                	mov    %ebx,%ecx
+  while(*p && *p == *q)
+ 248:	0f b6 19             	movzbl (%ecx),%ebx
+ 24b:	38 c3                	cmp    %al,%bl
+ 24d:	74 e9                	je     238 <strcmp+0x18>
+  return (uchar)*p - (uchar)*q;
+ 24f:	29 d8                	sub    %ebx,%eax
+}
+ 251:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 254:	c9                   	leave
+ 255:	c3                   	ret
+ 256:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 25d:	8d 76 00             	lea    0x0(%esi),%esi
+  return (uchar)*p - (uchar)*q;
+ 260:	0f b6 59 01          	movzbl 0x1(%ecx),%ebx
+ 264:	31 c0                	xor    %eax,%eax
+ 266:	29 d8                	sub    %ebx,%eax
+}
+ 268:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 26b:	c9                   	leave
+ 26c:	c3                   	ret
+  return (uchar)*p - (uchar)*q;
+ 26d:	0f b6 19             	movzbl (%ecx),%ebx
+ 270:	31 c0                	xor    %eax,%eax
+ 272:	eb db                	jmp    24f <strcmp+0x2f>
+ 274:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 27b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 27f:	90                   	nop
+
+00000280 <strlen>:
+
+uint
+strlen(const char *s)
+{
+ 280:	55                   	push   %ebp
+ 281:	89 e5                	mov    %esp,%ebp
+ 283:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for(n = 0; s[n]; n++)
+ 286:	80 3a 00             	cmpb   $0x0,(%edx)
+ 289:	74 15                	je     2a0 <strlen+0x20>
+ 28b:	31 c0                	xor    %eax,%eax
+ 28d:	8d 76 00             	lea    0x0(%esi),%esi
+ 290:	83 c0 01             	add    $0x1,%eax
+ 293:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+ 297:	89 c1                	mov    %eax,%ecx
+ 299:	75 f5                	jne    290 <strlen+0x10>
+    ;
+  return n;
+}
+ 29b:	89 c8                	mov    %ecx,%eax
+ 29d:	5d                   	pop    %ebp
+ 29e:	c3                   	ret
+ 29f:	90                   	nop
+  for(n = 0; s[n]; n++)
+ 2a0:	31 c9                	xor    %ecx,%ecx
+}
+ 2a2:	5d                   	pop    %ebp
+ 2a3:	89 c8                	mov    %ecx,%eax
+ 2a5:	c3                   	ret
+ 2a6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 2ad:	8d 76 00             	lea    0x0(%esi),%esi
+
+000002b0 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+ 2b0:	55                   	push   %ebp
+ 2b1:	89 e5                	mov    %esp,%ebp
+ 2b3:	57                   	push   %edi
+ 2b4:	8b 55 08             	mov    0x8(%ebp),%edx
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosb" :
+ 2b7:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 2ba:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 2bd:	89 d7                	mov    %edx,%edi
+ 2bf:	fc                   	cld
+ 2c0:	f3 aa                	rep stos %al,%es:(%edi)
+  stosb(dst, c, n);
+  return dst;
+}
+ 2c2:	8b 7d fc             	mov    -0x4(%ebp),%edi
+ 2c5:	89 d0                	mov    %edx,%eax
+ 2c7:	c9                   	leave
+ 2c8:	c3                   	ret
+ 2c9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+000002d0 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+ 2d0:	55                   	push   %ebp
+ 2d1:	89 e5                	mov    %esp,%ebp
+ 2d3:	8b 45 08             	mov    0x8(%ebp),%eax
+ 2d6:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+ 2da:	0f b6 10             	movzbl (%eax),%edx
+ 2dd:	84 d2                	test   %dl,%dl
+ 2df:	75 12                	jne    2f3 <strchr+0x23>
+ 2e1:	eb 1d                	jmp    300 <strchr+0x30>
+ 2e3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 2e7:	90                   	nop
+ 2e8:	0f b6 50 01          	movzbl 0x1(%eax),%edx
+ 2ec:	83 c0 01             	add    $0x1,%eax
+ 2ef:	84 d2                	test   %dl,%dl
+ 2f1:	74 0d                	je     300 <strchr+0x30>
+    if(*s == c)
+ 2f3:	38 d1                	cmp    %dl,%cl
+ 2f5:	75 f1                	jne    2e8 <strchr+0x18>
+      return (char*)s;
+  return 0;
+}
+ 2f7:	5d                   	pop    %ebp
+ 2f8:	c3                   	ret
+ 2f9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  return 0;
+ 300:	31 c0                	xor    %eax,%eax
+}
+ 302:	5d                   	pop    %ebp
+ 303:	c3                   	ret
+ 304:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 30b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 30f:	90                   	nop
+
+00000310 <gets>:
+
+char*
+gets(char *buf, int max)
+{
+ 310:	55                   	push   %ebp
+ 311:	89 e5                	mov    %esp,%ebp
+ 313:	57                   	push   %edi
+ 314:	56                   	push   %esi
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+    cc = read(0, &c, 1);
+ 315:	8d 75 e7             	lea    -0x19(%ebp),%esi
+{
+ 318:	53                   	push   %ebx
+  for(i=0; i+1 < max; ){
+ 319:	31 db                	xor    %ebx,%ebx
+{
+ 31b:	83 ec 1c             	sub    $0x1c,%esp
+  for(i=0; i+1 < max; ){
+ 31e:	eb 27                	jmp    347 <gets+0x37>
+    cc = read(0, &c, 1);
+ 320:	83 ec 04             	sub    $0x4,%esp
+ 323:	6a 01                	push   $0x1
+ 325:	56                   	push   %esi
+ 326:	6a 00                	push   $0x0
+ 328:	e8 1e 01 00 00       	call   44b <read>
+    if(cc < 1)
+ 32d:	83 c4 10             	add    $0x10,%esp
+ 330:	85 c0                	test   %eax,%eax
+ 332:	7e 1d                	jle    351 <gets+0x41>
+      break;
+    buf[i++] = c;
+ 334:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+ 338:	8b 55 08             	mov    0x8(%ebp),%edx
+ 33b:	88 44 1a ff          	mov    %al,-0x1(%edx,%ebx,1)
+    if(c == '\n' || c == '\r')
+ 33f:	3c 0a                	cmp    $0xa,%al
+ 341:	74 10                	je     353 <gets+0x43>
+ 343:	3c 0d                	cmp    $0xd,%al
+ 345:	74 0c                	je     353 <gets+0x43>
+  for(i=0; i+1 < max; ){
+ 347:	89 df                	mov    %ebx,%edi
+ 349:	83 c3 01             	add    $0x1,%ebx
+ 34c:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+ 34f:	7c cf                	jl     320 <gets+0x10>
+ 351:	89 fb                	mov    %edi,%ebx
+      break;
+  }
+  buf[i] = '\0';
+ 353:	8b 45 08             	mov    0x8(%ebp),%eax
+ 356:	c6 04 18 00          	movb   $0x0,(%eax,%ebx,1)
+  return buf;
+}
+ 35a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 35d:	5b                   	pop    %ebx
+ 35e:	5e                   	pop    %esi
+ 35f:	5f                   	pop    %edi
+ 360:	5d                   	pop    %ebp
+ 361:	c3                   	ret
+ 362:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 369:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000370 <stat>:
+
+int
+stat(const char *n, struct stat *st)
+{
+ 370:	55                   	push   %ebp
+ 371:	89 e5                	mov    %esp,%ebp
+ 373:	56                   	push   %esi
+ 374:	53                   	push   %ebx
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+ 375:	83 ec 08             	sub    $0x8,%esp
+ 378:	6a 00                	push   $0x0
+ 37a:	ff 75 08             	push   0x8(%ebp)
+ 37d:	e8 f1 00 00 00       	call   473 <open>
+  if(fd < 0)
+ 382:	83 c4 10             	add    $0x10,%esp
+ 385:	85 c0                	test   %eax,%eax
+ 387:	78 27                	js     3b0 <stat+0x40>
+    return -1;
+  r = fstat(fd, st);
+ 389:	83 ec 08             	sub    $0x8,%esp
+ 38c:	ff 75 0c             	push   0xc(%ebp)
+ 38f:	89 c3                	mov    %eax,%ebx
+ 391:	50                   	push   %eax
+ 392:	e8 f4 00 00 00       	call   48b <fstat>
+  close(fd);
+ 397:	89 1c 24             	mov    %ebx,(%esp)
+  r = fstat(fd, st);
+ 39a:	89 c6                	mov    %eax,%esi
+  close(fd);
+ 39c:	e8 ba 00 00 00       	call   45b <close>
+  return r;
+ 3a1:	83 c4 10             	add    $0x10,%esp
+}
+ 3a4:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 3a7:	89 f0                	mov    %esi,%eax
+ 3a9:	5b                   	pop    %ebx
+ 3aa:	5e                   	pop    %esi
+ 3ab:	5d                   	pop    %ebp
+ 3ac:	c3                   	ret
+ 3ad:	8d 76 00             	lea    0x0(%esi),%esi
+    return -1;
+ 3b0:	be ff ff ff ff       	mov    $0xffffffff,%esi
+ 3b5:	eb ed                	jmp    3a4 <stat+0x34>
+ 3b7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 3be:	66 90                	xchg   %ax,%ax
+
+000003c0 <atoi>:
+
+int
+atoi(const char *s)
+{
+ 3c0:	55                   	push   %ebp
+ 3c1:	89 e5                	mov    %esp,%ebp
+ 3c3:	53                   	push   %ebx
+ 3c4:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  n = 0;
+  while('0' <= *s && *s <= '9')
+ 3c7:	0f be 02             	movsbl (%edx),%eax
+ 3ca:	8d 48 d0             	lea    -0x30(%eax),%ecx
+ 3cd:	80 f9 09             	cmp    $0x9,%cl
+  n = 0;
+ 3d0:	b9 00 00 00 00       	mov    $0x0,%ecx
+  while('0' <= *s && *s <= '9')
+ 3d5:	77 1e                	ja     3f5 <atoi+0x35>
+ 3d7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 3de:	66 90                	xchg   %ax,%ax
+    n = n*10 + *s++ - '0';
+ 3e0:	83 c2 01             	add    $0x1,%edx
+ 3e3:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+ 3e6:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+  while('0' <= *s && *s <= '9')
+ 3ea:	0f be 02             	movsbl (%edx),%eax
+ 3ed:	8d 58 d0             	lea    -0x30(%eax),%ebx
+ 3f0:	80 fb 09             	cmp    $0x9,%bl
+ 3f3:	76 eb                	jbe    3e0 <atoi+0x20>
+  return n;
+}
+ 3f5:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 3f8:	89 c8                	mov    %ecx,%eax
+ 3fa:	c9                   	leave
+ 3fb:	c3                   	ret
+ 3fc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000400 <memmove>:
+
+void*
+memmove(void *vdst, const void *vsrc, int n)
+{
+ 400:	55                   	push   %ebp
+ 401:	89 e5                	mov    %esp,%ebp
+ 403:	57                   	push   %edi
+ 404:	56                   	push   %esi
+ 405:	8b 45 10             	mov    0x10(%ebp),%eax
+ 408:	8b 55 08             	mov    0x8(%ebp),%edx
+ 40b:	8b 75 0c             	mov    0xc(%ebp),%esi
+  char *dst;
+  const char *src;
+
+  dst = vdst;
+  src = vsrc;
+  while(n-- > 0)
+ 40e:	85 c0                	test   %eax,%eax
+ 410:	7e 13                	jle    425 <memmove+0x25>
+ 412:	01 d0                	add    %edx,%eax
+  dst = vdst;
+ 414:	89 d7                	mov    %edx,%edi
+ 416:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 41d:	8d 76 00             	lea    0x0(%esi),%esi
+    *dst++ = *src++;
+ 420:	a4                   	movsb  %ds:(%esi),%es:(%edi)
+  while(n-- > 0)
+ 421:	39 f8                	cmp    %edi,%eax
+ 423:	75 fb                	jne    420 <memmove+0x20>
+  return vdst;
+}
+ 425:	5e                   	pop    %esi
+ 426:	89 d0                	mov    %edx,%eax
+ 428:	5f                   	pop    %edi
+ 429:	5d                   	pop    %ebp
+ 42a:	c3                   	ret
+
+0000042b <fork>:
+  name: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+SYSCALL(fork)
+ 42b:	b8 01 00 00 00       	mov    $0x1,%eax
+ 430:	cd 40                	int    $0x40
+ 432:	c3                   	ret
+
+00000433 <exit>:
+SYSCALL(exit)
+ 433:	b8 02 00 00 00       	mov    $0x2,%eax
+ 438:	cd 40                	int    $0x40
+ 43a:	c3                   	ret
+
+0000043b <wait>:
+SYSCALL(wait)
+ 43b:	b8 03 00 00 00       	mov    $0x3,%eax
+ 440:	cd 40                	int    $0x40
+ 442:	c3                   	ret
+
+00000443 <pipe>:
+SYSCALL(pipe)
+ 443:	b8 04 00 00 00       	mov    $0x4,%eax
+ 448:	cd 40                	int    $0x40
+ 44a:	c3                   	ret
+
+0000044b <read>:
+SYSCALL(read)
+ 44b:	b8 05 00 00 00       	mov    $0x5,%eax
+ 450:	cd 40                	int    $0x40
+ 452:	c3                   	ret
+
+00000453 <write>:
+SYSCALL(write)
+ 453:	b8 10 00 00 00       	mov    $0x10,%eax
+ 458:	cd 40                	int    $0x40
+ 45a:	c3                   	ret
+
+0000045b <close>:
+SYSCALL(close)
+ 45b:	b8 15 00 00 00       	mov    $0x15,%eax
+ 460:	cd 40                	int    $0x40
+ 462:	c3                   	ret
+
+00000463 <kill>:
+SYSCALL(kill)
+ 463:	b8 06 00 00 00       	mov    $0x6,%eax
+ 468:	cd 40                	int    $0x40
+ 46a:	c3                   	ret
+
+0000046b <exec>:
+SYSCALL(exec)
+ 46b:	b8 07 00 00 00       	mov    $0x7,%eax
+ 470:	cd 40                	int    $0x40
+ 472:	c3                   	ret
+
+00000473 <open>:
+SYSCALL(open)
+ 473:	b8 0f 00 00 00       	mov    $0xf,%eax
+ 478:	cd 40                	int    $0x40
+ 47a:	c3                   	ret
+
+0000047b <mknod>:
+SYSCALL(mknod)
+ 47b:	b8 11 00 00 00       	mov    $0x11,%eax
+ 480:	cd 40                	int    $0x40
+ 482:	c3                   	ret
+
+00000483 <unlink>:
+SYSCALL(unlink)
+ 483:	b8 12 00 00 00       	mov    $0x12,%eax
+ 488:	cd 40                	int    $0x40
+ 48a:	c3                   	ret
+
+0000048b <fstat>:
+SYSCALL(fstat)
+ 48b:	b8 08 00 00 00       	mov    $0x8,%eax
+ 490:	cd 40                	int    $0x40
+ 492:	c3                   	ret
+
+00000493 <link>:
+SYSCALL(link)
+ 493:	b8 13 00 00 00       	mov    $0x13,%eax
+ 498:	cd 40                	int    $0x40
+ 49a:	c3                   	ret
+
+0000049b <mkdir>:
+SYSCALL(mkdir)
+ 49b:	b8 14 00 00 00       	mov    $0x14,%eax
+ 4a0:	cd 40                	int    $0x40
+ 4a2:	c3                   	ret
+
+000004a3 <chdir>:
+SYSCALL(chdir)
+ 4a3:	b8 09 00 00 00       	mov    $0x9,%eax
+ 4a8:	cd 40                	int    $0x40
+ 4aa:	c3                   	ret
+
+000004ab <dup>:
+SYSCALL(dup)
+ 4ab:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 4b0:	cd 40                	int    $0x40
+ 4b2:	c3                   	ret
+
+000004b3 <getpid>:
+SYSCALL(getpid)
+ 4b3:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 4b8:	cd 40                	int    $0x40
+ 4ba:	c3                   	ret
+
+000004bb <sbrk>:
+SYSCALL(sbrk)
+ 4bb:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 4c0:	cd 40                	int    $0x40
+ 4c2:	c3                   	ret
+
+000004c3 <sleep>:
+SYSCALL(sleep)
+ 4c3:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 4c8:	cd 40                	int    $0x40
+ 4ca:	c3                   	ret
+
+000004cb <uptime>:
+SYSCALL(uptime)
+ 4cb:	b8 0e 00 00 00       	mov    $0xe,%eax
+ 4d0:	cd 40                	int    $0x40
+ 4d2:	c3                   	ret
+
+000004d3 <cpustat>:
+SYSCALL(cpustat)
+ 4d3:	b8 16 00 00 00       	mov    $0x16,%eax
+ 4d8:	cd 40                	int    $0x40
+ 4da:	c3                   	ret
+
+000004db <setpriority>:
+SYSCALL(setpriority)
+ 4db:	b8 17 00 00 00       	mov    $0x17,%eax
+ 4e0:	cd 40                	int    $0x40
+ 4e2:	c3                   	ret
+
+000004e3 <cpuinfo>:
+SYSCALL(cpuinfo)
+ 4e3:	b8 18 00 00 00       	mov    $0x18,%eax
+ 4e8:	cd 40                	int    $0x40
+ 4ea:	c3                   	ret
+
+000004eb <procinfo>:
+SYSCALL(procinfo)
+ 4eb:	b8 19 00 00 00       	mov    $0x19,%eax
+ 4f0:	cd 40                	int    $0x40
+ 4f2:	c3                   	ret
+
+000004f3 <setgovernor>:
+SYSCALL(setgovernor)
+ 4f3:	b8 1a 00 00 00       	mov    $0x1a,%eax
+ 4f8:	cd 40                	int    $0x40
+ 4fa:	c3                   	ret
+
+000004fb <sysctl>:
+SYSCALL(sysctl)
+ 4fb:	b8 1b 00 00 00       	mov    $0x1b,%eax
+ 500:	cd 40                	int    $0x40
+ 502:	c3                   	ret
+
+00000503 <telemetry>:
+SYSCALL(telemetry)
+ 503:	b8 1c 00 00 00       	mov    $0x1c,%eax
+ 508:	cd 40                	int    $0x40
+ 50a:	c3                   	ret
+
+0000050b <clock_gettime>:
+SYSCALL(clock_gettime)
+ 50b:	b8 1d 00 00 00       	mov    $0x1d,%eax
+ 510:	cd 40                	int    $0x40
+ 512:	c3                   	ret
+
+00000513 <sched_setaffinity>:
+SYSCALL(sched_setaffinity)
+ 513:	b8 1e 00 00 00       	mov    $0x1e,%eax
+ 518:	cd 40                	int    $0x40
+ 51a:	c3                   	ret
+
+0000051b <sched_getaffinity>:
+SYSCALL(sched_getaffinity)
+ 51b:	b8 1f 00 00 00       	mov    $0x1f,%eax
+ 520:	cd 40                	int    $0x40
+ 522:	c3                   	ret
+
+00000523 <setqos>:
+SYSCALL(setqos)
+ 523:	b8 20 00 00 00       	mov    $0x20,%eax
+ 528:	cd 40                	int    $0x40
+ 52a:	c3                   	ret
+
+0000052b <setgroup>:
+SYSCALL(setgroup)
+ 52b:	b8 21 00 00 00       	mov    $0x21,%eax
+ 530:	cd 40                	int    $0x40
+ 532:	c3                   	ret
+
+00000533 <setquota>:
+SYSCALL(setquota)
+ 533:	b8 22 00 00 00       	mov    $0x22,%eax
+ 538:	cd 40                	int    $0x40
+ 53a:	c3                   	ret
+
+0000053b <groupinfo>:
+SYSCALL(groupinfo)
+ 53b:	b8 23 00 00 00       	mov    $0x23,%eax
+ 540:	cd 40                	int    $0x40
+ 542:	c3                   	ret
+ 543:	66 90                	xchg   %ax,%ax
+ 545:	66 90                	xchg   %ax,%ax
+ 547:	66 90                	xchg   %ax,%ax
+ 549:	66 90                	xchg   %ax,%ax
+ 54b:	66 90                	xchg   %ax,%ax
+ 54d:	66 90                	xchg   %ax,%ax
+ 54f:	90                   	nop
+
+00000550 <printint>:
+  write(fd, &c, 1);
+}
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+ 550:	55                   	push   %ebp
+ 551:	89 e5                	mov    %esp,%ebp
+ 553:	57                   	push   %edi
+ 554:	56                   	push   %esi
+ 555:	53                   	push   %ebx
+ 556:	89 cb                	mov    %ecx,%ebx
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+    neg = 1;
+    x = -xx;
+ 558:	89 d1                	mov    %edx,%ecx
+{
+ 55a:	83 ec 3c             	sub    $0x3c,%esp
+ 55d:	89 45 c0             	mov    %eax,-0x40(%ebp)
+  if(sgn && xx < 0){
+ 560:	85 d2                	test   %edx,%edx
+ 562:	0f 89 80 00 00 00    	jns    5e8 <printint+0x98>
+ 568:	f6 45 08 01          	testb  $0x1,0x8(%ebp)
+ 56c:	74 7a                	je     5e8 <printint+0x98>
+    x = -xx;
+ 56e:	f7 d9                	neg    %ecx
+    neg = 1;
+ 570:	b8 01 00 00 00       	mov    $0x1,%eax
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+ 575:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+ 578:	31 f6                	xor    %esi,%esi
+ 57a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  do{
+    buf[i++] = digits[x % base];
+ 580:	89 c8                	mov    %ecx,%eax
+ 582:	31 d2                	xor    %edx,%edx
+ 584:	89 f7                	mov    %esi,%edi
+ 586:	f7 f3                	div    %ebx
+ 588:	8d 76 01             	lea    0x1(%esi),%esi
+ 58b:	0f b6 92 4c 0a 00 00 	movzbl 0xa4c(%edx),%edx
+ 592:	88 54 35 d7          	mov    %dl,-0x29(%ebp,%esi,1)
+  }while((x /= base) != 0);
+ 596:	89 ca                	mov    %ecx,%edx
+ 598:	89 c1                	mov    %eax,%ecx
+ 59a:	39 da                	cmp    %ebx,%edx
+ 59c:	73 e2                	jae    580 <printint+0x30>
+  if(neg)
+ 59e:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+ 5a1:	85 c0                	test   %eax,%eax
+ 5a3:	74 07                	je     5ac <printint+0x5c>
+    buf[i++] = '-';
+ 5a5:	c6 44 35 d8 2d       	movb   $0x2d,-0x28(%ebp,%esi,1)
+    buf[i++] = digits[x % base];
+ 5aa:	89 f7                	mov    %esi,%edi
+ 5ac:	8d 5d d8             	lea    -0x28(%ebp),%ebx
+ 5af:	8b 75 c0             	mov    -0x40(%ebp),%esi
+ 5b2:	01 df                	add    %ebx,%edi
+ 5b4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+  while(--i >= 0)
+    putc(fd, buf[i]);
+ 5b8:	0f b6 07             	movzbl (%edi),%eax
+  write(fd, &c, 1);
+ 5bb:	83 ec 04             	sub    $0x4,%esp
+ 5be:	88 45 d7             	mov    %al,-0x29(%ebp)
+ 5c1:	8d 45 d7             	lea    -0x29(%ebp),%eax
+ 5c4:	6a 01                	push   $0x1
+ 5c6:	50                   	push   %eax
+ 5c7:	56                   	push   %esi
+ 5c8:	e8 86 fe ff ff       	call   453 <write>
+  while(--i >= 0)
+ 5cd:	89 f8                	mov    %edi,%eax
+ 5cf:	83 c4 10             	add    $0x10,%esp
+ 5d2:	83 ef 01             	sub    $0x1,%edi
+ 5d5:	39 d8                	cmp    %ebx,%eax
+ 5d7:	75 df                	jne    5b8 <printint+0x68>
+}
+ 5d9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 5dc:	5b                   	pop    %ebx
+ 5dd:	5e                   	pop    %esi
+ 5de:	5f                   	pop    %edi
+ 5df:	5d                   	pop    %ebp
+ 5e0:	c3                   	ret
+ 5e1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  neg = 0;
+ 5e8:	31 c0                	xor    %eax,%eax
+ 5ea:	eb 89                	jmp    575 <printint+0x25>
+ 5ec:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000005f0 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, const char *fmt, ...)
+{
+ 5f0:	55                   	push   %ebp
+ 5f1:	89 e5                	mov    %esp,%ebp
+ 5f3:	57                   	push   %edi
+ 5f4:	56                   	push   %esi
+ 5f5:	53                   	push   %ebx
+ 5f6:	83 ec 2c             	sub    $0x2c,%esp
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+  ap = (uint*)(void*)&fmt + 1;
+  for(i = 0; fmt[i]; i++){
+ 5f9:	8b 75 0c             	mov    0xc(%ebp),%esi
+{
+ 5fc:	8b 7d 08             	mov    0x8(%ebp),%edi
+  for(i = 0; fmt[i]; i++){
+ 5ff:	0f b6 1e             	movzbl (%esi),%ebx
+ 602:	83 c6 01             	add    $0x1,%esi
+ 605:	84 db                	test   %bl,%bl
+ 607:	74 67                	je     670 <printf+0x80>
+ 609:	8d 4d 10             	lea    0x10(%ebp),%ecx
+ 60c:	31 d2                	xor    %edx,%edx
+ 60e:	89 4d d0             	mov    %ecx,-0x30(%ebp)
+ 611:	eb 34                	jmp    647 <printf+0x57>
+ 613:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 617:	90                   	nop
+ 618:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+        state = '%';
+ 61b:	ba 25 00 00 00       	mov    $0x25,%edx
+      if(c == '%'){
+ 620:	83 f8 25             	cmp    $0x25,%eax
+ 623:	74 18                	je     63d <printf+0x4d>
+  write(fd, &c, 1);
+ 625:	83 ec 04             	sub    $0x4,%esp
+ 628:	8d 45 e7             	lea    -0x19(%ebp),%eax
+ 62b:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 62e:	6a 01                	push   $0x1
+ 630:	50                   	push   %eax
+ 631:	57                   	push   %edi
+ 632:	e8 1c fe ff ff       	call   453 <write>
+ 637:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+      } else {
+        putc(fd, c);
+ 63a:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; fmt[i]; i++){
+ 63d:	0f b6 1e             	movzbl (%esi),%ebx
+ 640:	83 c6 01             	add    $0x1,%esi
+ 643:	84 db                	test   %bl,%bl
+ 645:	74 29                	je     670 <printf+0x80>
+    c = fmt[i] & 0xff;
+ 647:	0f b6 c3             	movzbl %bl,%eax
+    if(state == 0){
+ 64a:	85 d2                	test   %edx,%edx
+ 64c:	74 ca                	je     618 <printf+0x28>
+      }
+    } else if(state == '%'){
+ 64e:	83 fa 25             	cmp    $0x25,%edx
+ 651:	75 ea                	jne    63d <printf+0x4d>
+      if(c == 'd'){
+ 653:	83 f8 25             	cmp    $0x25,%eax
+ 656:	0f 84 24 01 00 00    	je     780 <printf+0x190>
+ 65c:	83 e8 63             	sub    $0x63,%eax
+ 65f:	83 f8 15             	cmp    $0x15,%eax
+ 662:	77 1c                	ja     680 <printf+0x90>
+ 664:	ff 24 85 f4 09 00 00 	jmp    *0x9f4(,%eax,4)
+ 66b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 66f:	90                   	nop
+        putc(fd, c);
+      }
+      state = 0;
+    }
+  }
+}
+ 670:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 673:	5b                   	pop    %ebx
+ 674:	5e                   	pop    %esi
+ 675:	5f                   	pop    %edi
+ 676:	5d                   	pop    %ebp
+ 677:	c3                   	ret
+ 678:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 67f:	90                   	nop
+  write(fd, &c, 1);
+ 680:	83 ec 04             	sub    $0x4,%esp
+ 683:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 686:	c6 45 e7 25          	movb   $0x25,-0x19(%ebp)
+ 68a:	6a 01                	push   $0x1
+ 68c:	52                   	push   %edx
+ 68d:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+ 690:	57                   	push   %edi
+ 691:	e8 bd fd ff ff       	call   453 <write>
+ 696:	83 c4 0c             	add    $0xc,%esp
+ 699:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 69c:	6a 01                	push   $0x1
+ 69e:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+ 6a1:	52                   	push   %edx
+ 6a2:	57                   	push   %edi
+ 6a3:	e8 ab fd ff ff       	call   453 <write>
+        putc(fd, c);
+ 6a8:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 6ab:	31 d2                	xor    %edx,%edx
+ 6ad:	eb 8e                	jmp    63d <printf+0x4d>
+ 6af:	90                   	nop
+        printint(fd, *ap, 16, 0);
+ 6b0:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+ 6b3:	83 ec 0c             	sub    $0xc,%esp
+ 6b6:	b9 10 00 00 00       	mov    $0x10,%ecx
+ 6bb:	8b 13                	mov    (%ebx),%edx
+ 6bd:	6a 00                	push   $0x0
+ 6bf:	89 f8                	mov    %edi,%eax
+        ap++;
+ 6c1:	83 c3 04             	add    $0x4,%ebx
+        printint(fd, *ap, 16, 0);
+ 6c4:	e8 87 fe ff ff       	call   550 <printint>
+        ap++;
+ 6c9:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+ 6cc:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 6cf:	31 d2                	xor    %edx,%edx
+ 6d1:	e9 67 ff ff ff       	jmp    63d <printf+0x4d>
+ 6d6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 6dd:	8d 76 00             	lea    0x0(%esi),%esi
+        s = (char*)*ap;
+ 6e0:	8b 45 d0             	mov    -0x30(%ebp),%eax
+ 6e3:	8b 18                	mov    (%eax),%ebx
+        ap++;
+ 6e5:	83 c0 04             	add    $0x4,%eax
+ 6e8:	89 45 d0             	mov    %eax,-0x30(%ebp)
+        if(s == 0)
+ 6eb:	85 db                	test   %ebx,%ebx
+ 6ed:	0f 84 9d 00 00 00    	je     790 <printf+0x1a0>
+        while(*s != 0){
+ 6f3:	0f b6 03             	movzbl (%ebx),%eax
+      state = 0;
+ 6f6:	31 d2                	xor    %edx,%edx
+        while(*s != 0){
+ 6f8:	84 c0                	test   %al,%al
+ 6fa:	0f 84 3d ff ff ff    	je     63d <printf+0x4d>
+ 700:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 703:	89 75 d4             	mov    %esi,-0x2c(%ebp)
+ 706:	89 de                	mov    %ebx,%esi
+ 708:	89 d3                	mov    %edx,%ebx
+ 70a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  write(fd, &c, 1);
+ 710:	83 ec 04             	sub    $0x4,%esp
+ 713:	88 45 e7             	mov    %al,-0x19(%ebp)
+          s++;
+ 716:	83 c6 01             	add    $0x1,%esi
+  write(fd, &c, 1);
+ 719:	6a 01                	push   $0x1
+ 71b:	53                   	push   %ebx
+ 71c:	57                   	push   %edi
+ 71d:	e8 31 fd ff ff       	call   453 <write>
+        while(*s != 0){
+ 722:	0f b6 06             	movzbl (%esi),%eax
+ 725:	83 c4 10             	add    $0x10,%esp
+ 728:	84 c0                	test   %al,%al
+ 72a:	75 e4                	jne    710 <printf+0x120>
+      state = 0;
+ 72c:	8b 75 d4             	mov    -0x2c(%ebp),%esi
+ 72f:	31 d2                	xor    %edx,%edx
+ 731:	e9 07 ff ff ff       	jmp    63d <printf+0x4d>
+ 736:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 73d:	8d 76 00             	lea    0x0(%esi),%esi
+        printint(fd, *ap, 10, 1);
+ 740:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+ 743:	83 ec 0c             	sub    $0xc,%esp
+ 746:	b9 0a 00 00 00       	mov    $0xa,%ecx
+ 74b:	8b 13                	mov    (%ebx),%edx
+ 74d:	6a 01                	push   $0x1
+ 74f:	e9 6b ff ff ff       	jmp    6bf <printf+0xcf>
+ 754:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+        putc(fd, *ap);
+ 758:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  write(fd, &c, 1);
+ 75b:	83 ec 04             	sub    $0x4,%esp
+ 75e:	8d 55 e7             	lea    -0x19(%ebp),%edx
+        putc(fd, *ap);
+ 761:	8b 03                	mov    (%ebx),%eax
+        ap++;
+ 763:	83 c3 04             	add    $0x4,%ebx
+        putc(fd, *ap);
+ 766:	88 45 e7             	mov    %al,-0x19(%ebp)
+  write(fd, &c, 1);
+ 769:	6a 01                	push   $0x1
+ 76b:	52                   	push   %edx
+ 76c:	57                   	push   %edi
+ 76d:	e8 e1 fc ff ff       	call   453 <write>
+        ap++;
+ 772:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+ 775:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 778:	31 d2                	xor    %edx,%edx
+ 77a:	e9 be fe ff ff       	jmp    63d <printf+0x4d>
+ 77f:	90                   	nop
+  write(fd, &c, 1);
+ 780:	83 ec 04             	sub    $0x4,%esp
+ 783:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 786:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 789:	6a 01                	push   $0x1
+ 78b:	e9 11 ff ff ff       	jmp    6a1 <printf+0xb1>
+ 790:	b8 28 00 00 00       	mov    $0x28,%eax
+          s = "(null)";
+ 795:	bb eb 09 00 00       	mov    $0x9eb,%ebx
+ 79a:	e9 61 ff ff ff       	jmp    700 <printf+0x110>
+ 79f:	90                   	nop
+
+000007a0 <free>:
+static Header base;
+static Header *freep;
+
+void
+free(void *ap)
+{
+ 7a0:	55                   	push   %ebp
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 7a1:	a1 3c 0d 00 00       	mov    0xd3c,%eax
+{
+ 7a6:	89 e5                	mov    %esp,%ebp
+ 7a8:	57                   	push   %edi
+ 7a9:	56                   	push   %esi
+ 7aa:	53                   	push   %ebx
+ 7ab:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  bp = (Header*)ap - 1;
+ 7ae:	8d 4b f8             	lea    -0x8(%ebx),%ecx
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 7b1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 7b8:	89 c2                	mov    %eax,%edx
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 7ba:	8b 00                	mov    (%eax),%eax
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 7bc:	39 ca                	cmp    %ecx,%edx
+ 7be:	73 30                	jae    7f0 <free+0x50>
+ 7c0:	39 c1                	cmp    %eax,%ecx
+ 7c2:	72 04                	jb     7c8 <free+0x28>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 7c4:	39 c2                	cmp    %eax,%edx
+ 7c6:	72 f0                	jb     7b8 <free+0x18>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+ 7c8:	8b 73 fc             	mov    -0x4(%ebx),%esi
+ 7cb:	8d 3c f1             	lea    (%ecx,%esi,8),%edi
+ 7ce:	39 f8                	cmp    %edi,%eax
+ 7d0:	74 2e                	je     800 <free+0x60>
+    bp->s.size += p->s.ptr->s.size;
+    bp->s.ptr = p->s.ptr->s.ptr;
+ 7d2:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  } else
+    bp->s.ptr = p->s.ptr;
+  if(p + p->s.size == bp){
+ 7d5:	8b 42 04             	mov    0x4(%edx),%eax
+ 7d8:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+ 7db:	39 f1                	cmp    %esi,%ecx
+ 7dd:	74 38                	je     817 <free+0x77>
+    p->s.size += bp->s.size;
+    p->s.ptr = bp->s.ptr;
+ 7df:	89 0a                	mov    %ecx,(%edx)
+  } else
+    p->s.ptr = bp;
+  freep = p;
+}
+ 7e1:	5b                   	pop    %ebx
+  freep = p;
+ 7e2:	89 15 3c 0d 00 00    	mov    %edx,0xd3c
+}
+ 7e8:	5e                   	pop    %esi
+ 7e9:	5f                   	pop    %edi
+ 7ea:	5d                   	pop    %ebp
+ 7eb:	c3                   	ret
+ 7ec:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 7f0:	39 c1                	cmp    %eax,%ecx
+ 7f2:	72 d0                	jb     7c4 <free+0x24>
+ 7f4:	eb c2                	jmp    7b8 <free+0x18>
+ 7f6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 7fd:	8d 76 00             	lea    0x0(%esi),%esi
+    bp->s.size += p->s.ptr->s.size;
+ 800:	03 70 04             	add    0x4(%eax),%esi
+ 803:	89 73 fc             	mov    %esi,-0x4(%ebx)
+    bp->s.ptr = p->s.ptr->s.ptr;
+ 806:	8b 02                	mov    (%edx),%eax
+ 808:	8b 00                	mov    (%eax),%eax
+ 80a:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  if(p + p->s.size == bp){
+ 80d:	8b 42 04             	mov    0x4(%edx),%eax
+ 810:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+ 813:	39 f1                	cmp    %esi,%ecx
+ 815:	75 c8                	jne    7df <free+0x3f>
+    p->s.size += bp->s.size;
+ 817:	03 43 fc             	add    -0x4(%ebx),%eax
+  freep = p;
+ 81a:	89 15 3c 0d 00 00    	mov    %edx,0xd3c
+    p->s.size += bp->s.size;
+ 820:	89 42 04             	mov    %eax,0x4(%edx)
+    p->s.ptr = bp->s.ptr;
+ 823:	8b 4b f8             	mov    -0x8(%ebx),%ecx
+ 826:	89 0a                	mov    %ecx,(%edx)
+}
+ 828:	5b                   	pop    %ebx
+ 829:	5e                   	pop    %esi
+ 82a:	5f                   	pop    %edi
+ 82b:	5d                   	pop    %ebp
+ 82c:	c3                   	ret
+ 82d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000830 <malloc>:
+  return freep;
+}
+
+void*
+malloc(uint nbytes)
+{
+ 830:	55                   	push   %ebp
+ 831:	89 e5                	mov    %esp,%ebp
+ 833:	57                   	push   %edi
+ 834:	56                   	push   %esi
+ 835:	53                   	push   %ebx
+ 836:	83 ec 0c             	sub    $0xc,%esp
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ 839:	8b 45 08             	mov    0x8(%ebp),%eax
+  if((prevp = freep) == 0){
+ 83c:	8b 15 3c 0d 00 00    	mov    0xd3c,%edx
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ 842:	8d 78 07             	lea    0x7(%eax),%edi
+ 845:	c1 ef 03             	shr    $0x3,%edi
+ 848:	83 c7 01             	add    $0x1,%edi
+  if((prevp = freep) == 0){
+ 84b:	85 d2                	test   %edx,%edx
+ 84d:	0f 84 8d 00 00 00    	je     8e0 <malloc+0xb0>
+    base.s.ptr = freep = prevp = &base;
+    base.s.size = 0;
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ 853:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+ 855:	8b 48 04             	mov    0x4(%eax),%ecx
+ 858:	39 f9                	cmp    %edi,%ecx
+ 85a:	73 64                	jae    8c0 <malloc+0x90>
+  if(nu < 4096)
+ 85c:	bb 00 10 00 00       	mov    $0x1000,%ebx
+ 861:	39 df                	cmp    %ebx,%edi
+ 863:	0f 43 df             	cmovae %edi,%ebx
+  p = sbrk(nu * sizeof(Header));
+ 866:	8d 34 dd 00 00 00 00 	lea    0x0(,%ebx,8),%esi
+ 86d:	eb 0a                	jmp    879 <malloc+0x49>
+ 86f:	90                   	nop
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ 870:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+ 872:	8b 48 04             	mov    0x4(%eax),%ecx
+ 875:	39 f9                	cmp    %edi,%ecx
+ 877:	73 47                	jae    8c0 <malloc+0x90>
+        p->s.size = nunits;
+      }
+      freep = prevp;
+      return (void*)(p + 1);
+    }
+    if(p == freep)
+ 879:	89 c2                	mov    %eax,%edx
+ 87b:	39 05 3c 0d 00 00    	cmp    %eax,0xd3c
+ 881:	75 ed                	jne    870 <malloc+0x40>
+  p = sbrk(nu * sizeof(Header));
+ 883:	83 ec 0c             	sub    $0xc,%esp
+ 886:	56                   	push   %esi
+ 887:	e8 2f fc ff ff       	call   4bb <sbrk>
+  if(p == (char*)-1)
+ 88c:	83 c4 10             	add    $0x10,%esp
+ 88f:	83 f8 ff             	cmp    $0xffffffff,%eax
+ 892:	74 1c                	je     8b0 <malloc+0x80>
+  hp->s.size = nu;
+ 894:	89 58 04             	mov    %ebx,0x4(%eax)
+  free((void*)(hp + 1));
+ 897:	83 ec 0c             	sub    $0xc,%esp
+ 89a:	83 c0 08             	add    $0x8,%eax
+ 89d:	50                   	push   %eax
+ 89e:	e8 fd fe ff ff       	call   7a0 <free>
+  return freep;
+ 8a3:	8b 15 3c 0d 00 00    	mov    0xd3c,%edx
+      if((p = morecore(nunits)) == 0)
+ 8a9:	83 c4 10             	add    $0x10,%esp
+ 8ac:	85 d2                	test   %edx,%edx
+ 8ae:	75 c0                	jne    870 <malloc+0x40>
+        return 0;
+  }
+}
+ 8b0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+        return 0;
+ 8b3:	31 c0                	xor    %eax,%eax
+}
+ 8b5:	5b                   	pop    %ebx
+ 8b6:	5e                   	pop    %esi
+ 8b7:	5f                   	pop    %edi
+ 8b8:	5d                   	pop    %ebp
+ 8b9:	c3                   	ret
+ 8ba:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+      if(p->s.size == nunits)
+ 8c0:	39 cf                	cmp    %ecx,%edi
+ 8c2:	74 4c                	je     910 <malloc+0xe0>
+        p->s.size -= nunits;
+ 8c4:	29 f9                	sub    %edi,%ecx
+ 8c6:	89 48 04             	mov    %ecx,0x4(%eax)
+        p += p->s.size;
+ 8c9:	8d 04 c8             	lea    (%eax,%ecx,8),%eax
+        p->s.size = nunits;
+ 8cc:	89 78 04             	mov    %edi,0x4(%eax)
+      freep = prevp;
+ 8cf:	89 15 3c 0d 00 00    	mov    %edx,0xd3c
+}
+ 8d5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+      return (void*)(p + 1);
+ 8d8:	83 c0 08             	add    $0x8,%eax
+}
+ 8db:	5b                   	pop    %ebx
+ 8dc:	5e                   	pop    %esi
+ 8dd:	5f                   	pop    %edi
+ 8de:	5d                   	pop    %ebp
+ 8df:	c3                   	ret
+    base.s.ptr = freep = prevp = &base;
+ 8e0:	c7 05 3c 0d 00 00 40 	movl   $0xd40,0xd3c
+ 8e7:	0d 00 00 
+    base.s.size = 0;
+ 8ea:	b8 40 0d 00 00       	mov    $0xd40,%eax
+    base.s.ptr = freep = prevp = &base;
+ 8ef:	c7 05 40 0d 00 00 40 	movl   $0xd40,0xd40
+ 8f6:	0d 00 00 
+    base.s.size = 0;
+ 8f9:	c7 05 44 0d 00 00 00 	movl   $0x0,0xd44
+ 900:	00 00 00 
+    if(p->s.size >= nunits){
+ 903:	e9 54 ff ff ff       	jmp    85c <malloc+0x2c>
+ 908:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 90f:	90                   	nop
+        prevp->s.ptr = p->s.ptr;
+ 910:	8b 08                	mov    (%eax),%ecx
+ 912:	89 0a                	mov    %ecx,(%edx)
+ 914:	eb b9                	jmp    8cf <malloc+0x9f>
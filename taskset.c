@@ -0,0 +1,80 @@
+#include "types.h"
+#include "stat.h"
+#include "user.h"
+
+// Show or set which CPUs processes may run on.  Masks are in hex,
+// bit i for CPU i.
+// Usage: taskset mask command [args...]   run command on mask's CPUs
+//        taskset -p pid                   show pid's mask
+//        taskset -p mask pid              set pid's mask
+
+static int
+hexmask(char *s, uint *mask)
+{
+  uint m;
+  int c;
+
+  if(s[0] == '0' && (s[1] == 'x' || s[1] == 'X'))
+    s += 2;
+  if(*s == 0)
+    return -1;
+  for(m = 0; (c = *s) != 0; s++){
+    if(c >= '0' && c <= '9')
+      c -= '0';
+    else if(c >= 'a' && c <= 'f')
+      c -= 'a' - 10;
+    else if(c >= 'A' && c <= 'F')
+      c -= 'A' - 10;
+    else
+      return -1;
+    m = (m << 4) | c;
+  }
+  *mask = m;
+  return 0;
+}
+
+static void
+usage(void)
+{
+  printf(2, "usage: taskset mask command [args...]\n"
+            "       taskset -p [mask] pid\n");
+  exit();
+}
+
+int
+main(int argc, char *argv[])
+{
+  uint mask;
+  int pid;
+
+  if(argc < 3)
+    usage();
+
+  if(strcmp(argv[1], "-p") == 0){
+    if(argc == 3){
+      pid = atoi(argv[2]);
+      if(sched_getaffinity(pid, &mask) < 0){
+        printf(2, "taskset: no process %d\n", pid);
+        exit();
+      }
+      printf(1, "pid %d's affinity mask: %x\n", pid, mask);
+      exit();
+    }
+    if(argc != 4 || hexmask(argv[2], &mask) < 0)
+      usage();
+    pid = atoi(argv[3]);
+    if(sched_setaffinity(pid, mask) < 0)
+      printf(2, "taskset: cannot set pid %d to %x\n", pid, mask);
+    exit();
+  }
+
+  if(hexmask(argv[1], &mask) < 0)
+    usage();
+  if(sched_setaffinity(0, mask) < 0){
+    printf(2, "taskset: cannot set mask %x\n", mask);
+    exit();
+  }
+  exec(argv[2], argv + 2);
+  printf(2, "taskset: exec %s failed\n", argv[2]);
+  exit();
+}
@@ -0,0 +1,100 @@
+// Telemetry stream: a ring of the most recent SPAS samples.
+//
+// update_scheduler_analytics() appends a sample at the end of every
+// analytics period.  Readers keep their own cursor, the sequence
+// number of the last sample they saw, and block in telemetryread()
+// until a newer one exists.  A reader that falls more than
+// NTELEMETRY samples behind is told how many it missed through the
+// dropped field of the next sample it gets.
+//
+// Everything here is protected by tickslock.
+
+#include "types.h"
+#include "defs.h"
+#include "param.h"
+#include "mmu.h"
+#include "spinlock.h"
+#include "spas.h"
+#include "proc.h"
+
+extern struct spas spas;
+
+static struct {
+  struct telemetry ring[NTELEMETRY];
+  uint head;    // Samples recorded so far; sample seq is index + 1
+} telem;
+
+// Append a sample of the current SPAS state.
+// Caller holds tickslock.
+void
+telemetryrecord(void)
+{
+  struct telemetry *t;
+  uint mj;
+  int i;
+
+  t = &telem.ring[telem.head % NTELEMETRY];
+  t->seq = ++telem.head;
+  t->dropped = 0;
+  t->tick = ticks;
+  t->load = spas.cpu_load;
+  t->predicted_load = spas.predicted_load;
+  t->frequency_level = spas.frequency;
+  t->temp = spas.virtual_temp;
+  t->thresh_low_med = spas.thresh_low_med;
+  t->thresh_med_high = spas.thresh_med_high;
+  t->switches = spas.nswitch;
+  t->throttled = spas.nthrottle;
+  mj = 0;
+  for(i = 0; i < spas.ncpu; i++)
+    mj += spas.cpu[i].energy_mj;
+  t->energy_mj = mj;
+  wakeup(&telem);
+}
+
+// Copy up to n samples newer than *seq to user address dst, sleeping
+// until at least one exists, and advance *seq past them.  A cursor
+// of 0 starts at the newest sample, so a new reader sees the current
+// state at once and then every sample after it.
+// Returns the number of samples copied, or -1.
+int
+telemetryread(uint *seq, uint dst, int n)
+{
+  struct telemetry t;
+  uint next, oldest, lost;
+  int i;
+
+  acquire(&tickslock);
+  if(*seq > telem.head){
+    release(&tickslock);
+    return -1;
+  }
+  while(telem.head == *seq){
+    if(myproc()->killed){
+      release(&tickslock);
+      return -1;
+    }
+    sleep(&telem, &tickslock);
+  }
+  oldest = telem.head > NTELEMETRY ? telem.head - NTELEMETRY : 0;
+  next = *seq;
+  lost = 0;
+  if(next == 0)
+    next = telem.head - 1;
+  else if(next < oldest){
+    lost = oldest - next;
+    next = oldest;
+  }
+  for(i = 0; i < n && next < telem.head; i++, next++){
+    t = telem.ring[next % NTELEMETRY];
+    t.dropped = lost;
+    lost = 0;
+    if(copyout(myproc()->pgdir, dst + i*sizeof(t), &t, sizeof(t)) < 0){
+      release(&tickslock);
+      return -1;
+    }
+  }
+  *seq = next;
+  release(&tickslock);
+  return i;
+}
@@ -3,6 +3,7 @@
 #include "param.h"
 #include "memlayout.h"
 #include "mmu.h"
+#include "spas.h"
 #include "proc.h"
 #include "x86.h"
 #include "traps.h"
@@ -17,40 +18,9 @@ extern struct spinlock tickslock;
 extern uint ticks;
 // --- END OF CORRECTION ---
 
-// --- Our new code ---
-extern int is_idle;
-extern uint tot_ticks;
-extern uint idle_ticks;
-// --- End of new code ---
-
-// --- Phase 2: Extern Variables ---
-extern int cpu_load;
-extern int predicted_load;
-extern int load_history[];
-extern int history_index;
-extern enum freq_level current_frequency;
-extern int THRESH_LOW_TO_MED;
-extern int THRESH_MED_TO_HIGH;
-// --- End of Phase 2 Externs ---
-
-// --- Phase 4: Extern Thermal Variables ---
-extern int virtual_temp;
-extern int HEATING_FACTOR;
-extern int COOLING_FACTOR;
-extern int TEMP_THROTTLE_LIMIT;
-extern int AMBIENT_TEMP;
-// --- End Phase 4 ---
-
-// --- Phase 5: Adaptive Thresholds Externs ---
-extern int oscillation_count;
-extern int last_switch_tick;
-extern int OSCILLATION_WINDOW;
-extern int MAX_OSCILLATION;
-extern int ADAPTATION_PERIOD;
-extern int last_adaptation_tick;
-extern enum freq_level prev_frequency;
-extern int adaptation_counter;
-// --- End Phase 5 ---
+// --- SPAS policy state (proc.c) ---
+extern struct spas spas;
+// --- End of SPAS externs ---
 
 
 void
@@ -74,108 +44,99 @@ idtinit(void)
 
 // --- Phase 2 & 4: Predictive Scheduler & Thermal Logic ---
 
-// This function is called every LOAD_PERIOD ticks from the timer interrupt
+// This function is called every LOAD_PERIOD ticks from the timer interrupt.
+// The policy itself (prediction, thermal model, frequency choice and
+// adaptive thresholds) lives in spas.c so it can also run on the host.
 void
 update_scheduler_analytics(void)
 {
-  int i; // Declare 'i' at the top of the function
-
-  // 1. Calculate Current CPU Load
-  if (tot_ticks > 0) {
-    // Load = (total ticks - idle ticks) * 100 / total ticks
-    cpu_load = ((tot_ticks - idle_ticks) * 100) / tot_ticks;
-  } else {
-    cpu_load = 0;
-  }
-
-  // --- Phase 4: Update Virtual Temperature ---
-  // Apply heating based on current load (scaled by factor)
-  virtual_temp += (cpu_load * HEATING_FACTOR) / 100; // Divide by 100 since load is %
-  // Apply cooling
-  virtual_temp -= COOLING_FACTOR;
-  // Clamp to ambient temperature
-  if (virtual_temp < AMBIENT_TEMP) {
-    virtual_temp = AMBIENT_TEMP;
-  }
-  // --- End Phase 4 Temperature Update ---
-
-
-  // 2. Update Moving Average History
-  load_history[history_index] = cpu_load;
-  history_index = (history_index + 1) % HISTORY_SIZE;
-
-  // 3. Calculate Predicted Load (Moving Average)
-  int total_load = 0;
-  for (i = 0; i < HISTORY_SIZE; i++) {
-    total_load += load_history[i];
-  }
-  predicted_load = total_load / HISTORY_SIZE;
-
-  // 4. Dynamic Frequency Simulation (based on predicted load)
-  enum freq_level next_frequency; // Temporary variable
-  if (predicted_load > THRESH_MED_TO_HIGH) {
-    next_frequency = HIGH;
-  } else if (predicted_load > THRESH_LOW_TO_MED) {
-    next_frequency = MEDIUM;
-  } else {
-    next_frequency = LOW;
-  }
-
-  // --- Phase 4: Apply Thermal Throttling ---
-  // Override frequency decision if temperature is too high
-  if (virtual_temp > TEMP_THROTTLE_LIMIT) {
-    next_frequency = LOW; // Force LOW frequency regardless of predicted load
-  }
-  // --- End Phase 4 Throttling ---
-
-  // Update the global frequency state
-  current_frequency = next_frequency;
-
-
-  // --- Phase 5: Adaptive Thresholds ---
-  // Check for frequency change (oscillation detection)
-  if (current_frequency != prev_frequency) {
-    oscillation_count++;
-    last_switch_tick = ticks;  // Use global ticks
-    prev_frequency = current_frequency;
-  }
-
-  // Reset oscillation count if window expired
-  if (ticks - last_switch_tick > OSCILLATION_WINDOW) {
-    oscillation_count = 0;
+  int i, load[NCPU];
+  uint busy, idle;
+  struct cpu *c;
+
+  // Busy and idle time are counted in TSC cycles by cpufold() on
+  // each CPU; take the part since the last period.
+  for(i = 0; i < ncpu; i++){
+    c = &cpus[i];
+    busy = c->busy_kc - c->last_busy_kc;
+    idle = c->idle_kc - c->last_idle_kc;
+    c->last_busy_kc += busy;
+    c->last_idle_kc += idle;
+    load[i] = spas_load(busy, busy + idle);
   }
+  classcount(spas.nclass);
+  spas_update(&spas, load, ticks);
+  telemetryrecord();
+}
+// --- End of Phase 2 & 4 Logic ---
 
-  // Adaptive logic: widen thresholds if oscillating
-  if (oscillation_count >= MAX_OSCILLATION) {
-    THRESH_LOW_TO_MED += 5;
-    THRESH_MED_TO_HIGH += 5;
-    if (THRESH_MED_TO_HIGH > 90) THRESH_MED_TO_HIGH = 90;
-    if (THRESH_LOW_TO_MED > THRESH_MED_TO_HIGH - 10) THRESH_LOW_TO_MED = THRESH_MED_TO_HIGH - 10;
-    oscillation_count = 0;  // Reset after adaptation
-  }
+// Per-CPU accounting for n timer ticks: brings the busy/idle cycle
+// counts and the running process's time and energy up to date (see
+// cpufold), and this CPU's simulated energy and time-in-level.  Ticks
+// spent in stall() count as busy: the process is running, slowly.
+// Idle ticks are charged to the halt state if the scheduler halted,
+// or the park state if it halted a parked CPU.
+static void
+cputick(int n)
+{
+  struct cpu *c;
+  int i;
 
-  // Periodic tuning: narrow thresholds if stable and low load
-  adaptation_counter++;
-  if (adaptation_counter >= (ADAPTATION_PERIOD / LOAD_PERIOD)) {
-    adaptation_counter = 0;
-    if (oscillation_count == 0 && predicted_load < 20) {
-      THRESH_LOW_TO_MED = THRESH_LOW_TO_MED > 20 ? THRESH_LOW_TO_MED - 2 : 20;
-      THRESH_MED_TO_HIGH = THRESH_MED_TO_HIGH > 40 ? THRESH_MED_TO_HIGH - 2 : 40;
-    }
+  c = mycpu();
+  cpufold();
+  if(c->proc && groupthrottled(c->proc->group))
+    c->preempt = 1;      // its group's quota ran out
+  spas_account(&spas, c - cpus, c->idle ? 0 : n, c->idle ? n : 0,
+               c->parked ? IDLE_PARK :
+               c->halted ? IDLE_HALT : IDLE_POLL);
+
+  // Ticks halted in stall() pay off debt, any excess from a long
+  // stride counting toward the next; only ticks the process
+  // actually ran add to it.
+  if(c->stalling)
+    c->stall -= n;
+  else if(c->idle)
+    c->stall = 0;        // idle time already covers the shortfall
+  else
+    for(i = 0; i < n; i++)
+      c->stall += spas_stall(&spas, c - cpus);
+
+  // Tick less often at lower frequency levels (CPU 0: see trap).
+  if(c != cpus)
+    lapicstride(spas.tick_stride[spas.cpu[c - cpus].freq]);
+
+  if(spas.balance_interval > 0 && (int)(ticks - c->nextbalance) >= 0){
+    c->nextbalance = ticks + spas.balance_interval;
+    loadbalance();
   }
-  // --- End Phase 5 ---
+}
 
-  // 5. Reset counters for the next period
-  tot_ticks = 0;
-  idle_ticks = 0;
+// Duty-cycle frequency emulation: before returning to user space,
+// spend any ticks this CPU owes in hlt, so that a CPU-bound process
+// gets through less work per second at lower frequency levels.
+// Interrupts are taken while halted, but the process is not
+// rescheduled until the debt is paid, unless it is killed.
+static void
+stall(void)
+{
+  struct cpu *c;
+
+  c = mycpu();
+  c->stalling = 1;
+  while(c->stall > 0 && !myproc()->killed)
+    asm volatile("sti; hlt; cli");
+  if(c->stall > 0)
+    c->stall = 0;        // killed: the next process owes nothing
+  c->stalling = 0;
 }
-// --- End of Phase 2 & 4 Logic ---
 
 
 //PAGEBREAK: 41
 void
 trap(struct trapframe *tf)
 {
+  int n, slice;
+
   if(tf->trapno == T_SYSCALL){
     if(myproc()->killed)
       exit();
@@ -188,34 +149,43 @@ trap(struct trapframe *tf)
 
   switch(tf->trapno){
   case T_IRQ0 + IRQ_TIMER:
+    // One timer serves both ticks and time slices, and may report
+    // several ticks at once (see lapic.c).
+    n = lapictimer(&slice);
+    if(slice)
+      mycpu()->preempt = 1;
+    if(n == 0){
+      lapiceoi();
+      break;
+    }
+    cputick(n);
     if(cpuid() == 0){
       acquire(&tickslock);
-      ticks++;
-
-      // --- Our new code ---
-      tot_ticks++;       // Increment total ticks
-      if(is_idle)
-        idle_ticks++;    // Increment idle ticks if scheduler is idle
-
-      // Quantum enforcement: decrement current process's quantum
-      struct proc *cur = myproc();
-      if(cur && cur->state == RUNNING && cur->quantum_remaining > 0){
-        cur->quantum_remaining--;
-        if(cur->quantum_remaining == 0){
-          yield();  // Time slice expired, yield CPU
-        }
+      while(n-- > 0){
+        ticks++;
+        wheeltick();
+        grouptick();
+
+        // --- Our new code ---
+        // Call our new scheduler logic periodically
+        if(ticks % spas.load_period == 0)
+          update_scheduler_analytics();
+        // --- End of new code ---
+        if(ticks % LOADAVG_PERIOD == 0)
+          spas_loadavg(&spas, nrunning());
       }
+      // CPU 0 keeps time, so it must not stride past a sleeper's
+      // deadline or a throttled group's refill.
+      lapicstride(groupnohz(wheelnext(spas.tick_stride[spas.cpu[0].freq])));
 
-      // Call our new scheduler logic periodically
-      if(ticks % LOAD_PERIOD == 0)
-        update_scheduler_analytics();
-      // --- End of new code ---
-
-      wakeup(&ticks);
       release(&tickslock);
     }
     lapiceoi();
     break;
+  case T_IRQ0 + IRQ_KICK:
+    // Only here to get a CPU out of hlt.
+    lapiceoi();
+    break;
   case T_IRQ0 + IRQ_IDE:
     ideintr();
     lapiceoi();
@@ -260,10 +230,14 @@ trap(struct trapframe *tf)
   if(myproc() && myproc()->killed && (tf->cs&3) == DPL_USER)
     exit();
 
-  // Force process to give up CPU on clock tick.
+  if(myproc() && mycpu()->stall > 0 && !mycpu()->stalling &&
+     (tf->cs&3) == DPL_USER)
+    stall();
+
+  // Force process to give up CPU when its time slice ends.
   // If interrupts were on while locks held, would need to check nlock.
   if(myproc() && myproc()->state == RUNNING &&
-     tf->trapno == T_IRQ0+IRQ_TIMER)
+     mycpu()->preempt && !mycpu()->stalling)
     yield();
 
   // Check if the process has been killed since we yielded
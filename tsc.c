@@ -0,0 +1,88 @@
+// Time stamp counter: boot-time calibration and conversion to
+// nanoseconds.
+//
+// The TSC is timed against channel 2 of the 8253/8254 PIT, whose
+// input clock is fixed, for CALMS milliseconds.  Conversion avoids
+// 64-bit division, which would need libgcc: cycles become
+// nanoseconds by a fixed-point multiply, and div64() does the rest.
+
+#include "types.h"
+#include "defs.h"
+#include "x86.h"
+
+#define PIT_HZ     1193182   // PIT input clock
+#define PIT_CH2    0x42      // Channel 2 data port
+#define PIT_MODE   0x43      // Mode/command register
+#define PIT_GATE   0x61      // Channel 2 gate and output
+#define CALMS      10        // Calibration window (milliseconds)
+#define NS_SHIFT   22        // Fraction bits of ns_mult
+
+uint tsc_khz;                // TSC cycles per millisecond
+static uint64 tsc_boot;      // TSC at tscinit()
+static uint ns_mult;         // Nanoseconds per cycle << NS_SHIFT
+
+// Divide n by d, setting *rem to the remainder if rem is not 0.
+uint64
+div64(uint64 n, uint d, uint *rem)
+{
+  uint64 q, r;
+  int i;
+
+  q = r = 0;
+  for(i = 63; i >= 0; i--){
+    r = (r << 1) | ((n >> i) & 1);
+    if(r >= d){
+      r -= d;
+      q |= (uint64)1 << i;
+    }
+  }
+  if(rem)
+    *rem = r;
+  return q;
+}
+
+void
+tscinit(void)
+{
+  uint64 t0, t1;
+  uint count;
+
+  // Gate channel 2 on with the speaker off, and count down once
+  // from CALMS worth of PIT clocks in mode 0; OUT2 goes high at 0.
+  count = PIT_HZ / (1000 / CALMS);
+  outb(PIT_GATE, (inb(PIT_GATE) & ~0x02) | 0x01);
+  outb(PIT_MODE, 0xB0);        // channel 2, lobyte/hibyte, mode 0
+  outb(PIT_CH2, count & 0xFF);
+  outb(PIT_CH2, count >> 8);
+  t0 = rdtsc();
+  while((inb(PIT_GATE) & 0x20) == 0)
+    ;
+  t1 = rdtsc();
+
+  // kHz rather than Hz, so that a TSC faster than 4.29 GHz fits.
+  t1 = div64(t1 - t0, CALMS, 0);
+  if(t1 < 1000 || t1 > 0xFFFFFFFF)
+    t1 = 1000000;              // no usable PIT; assume 1 GHz
+  tsc_khz = t1;
+  ns_mult = div64((uint64)1000000 << NS_SHIFT, tsc_khz, 0);
+  tsc_boot = rdtsc();
+  cprintf("tsc: %d MHz\n", tsc_khz / 1000);
+}
+
+// TSC cycles since tscinit().
+uint64
+tscnow(void)
+{
+  return rdtsc() - tsc_boot;
+}
+
+uint64
+tsc2ns(uint64 cycles)
+{
+  uint hi, lo;
+
+  hi = cycles >> 32;
+  lo = cycles;
+  return (((uint64)hi * ns_mult) << (32 - NS_SHIFT)) +
+         (((uint64)lo * ns_mult) >> NS_SHIFT);
+}
@@ -1,6 +1,7 @@
 typedef unsigned int   uint;
 typedef unsigned short ushort;
 typedef unsigned char  uchar;
+typedef unsigned long long uint64;
 typedef uint pde_t;
 
 // --- Our new struct for cpustat ---
@@ -11,4 +12,88 @@ struct cpustat {
   int temp;            // Will be 0 for now
   int thresh_low_med;
   int thresh_med_high;
+  int nrunning;        // RUNNABLE+RUNNING processes
+  uint loadavg[3];     // 1/5/15 minute averages of nrunning, x 2048
 };
+
+// One analytics period, as returned by telemetry()
+struct telemetry {
+  uint seq;            // Sample number, counting from 1
+  uint dropped;        // Samples this reader missed just before this one
+  uint tick;           // ticks at the end of the period
+  int load;
+  int predicted_load;
+  int frequency_level;
+  int temp;            // Hottest CPU, tenths of degrees C
+  int thresh_low_med;
+  int thresh_med_high;
+  uint switches;       // Frequency switches since boot
+  uint throttled;      // CPU-periods run below the requested level
+  uint energy_mj;      // Energy used by all CPUs since boot
+};
+
+// Per-CPU view returned by cpuinfo()
+struct cpuinfo {
+  int load;            // Load of the last period (0-100)
+  int governor;        // 0=spas 1=performance 2=powersave 3=ondemand 4=conservative
+  int requested_level; // Level the governor asked for
+  int frequency_level; // Effective level after thermal capping
+  int temp;            // Tenths of degrees C
+  int thermal_cap;     // Frequency cap, level * 256 (512 = uncapped)
+  uint energy_mj;      // Simulated energy used since boot (millijoules)
+  uint residency[3];   // Busy ticks at LOW, MEDIUM, HIGH
+  uint idle_residency[3]; // Idle ticks polling, halted, parked
+  uint stalled;        // Busy ticks halted to emulate the level's speed
+  int parked;          // Taking no work (see core parking in proc.c)?
+  uint thermal_migrations; // Processes moved off it for heat
+};
+
+// Per-process view returned by procinfo()
+struct procinfo {
+  int pid;
+  int ppid;
+  int state;           // enum procstate
+  int priority;
+  uint energy_mj;      // Simulated energy charged to this process
+  uint child_energy_mj; // ... and to its reaped descendants
+  uint runtime_ms;     // CPU time used, measured with the TSC
+  int cpu;             // CPU whose run queue it is on
+  uint load;           // Decayed runnable time, out of 1024
+  int lastcpu;         // CPU it last ran on, or -1
+  uint migrations;     // Times it ran on a different CPU than before
+  int class;           // 0=CPU-bound 1=I/O-bound 2=interactive
+  uint nvcsw;          // Times it gave up the CPU to sleep
+  uint nivcsw;         // Times it was preempted
+  int qos;             // QOS_LATENCY, ...
+  int group;           // CPU bandwidth group
+  char name[16];
+};
+
+// CPU bandwidth group state returned by groupinfo()
+struct groupinfo {
+  uint quota_us;       // CPU time allowed per period; 0 means no limit
+  uint period_us;
+  uint used_us;        // CPU time used so far this period
+  int throttled;       // Quota spent for this period?
+  uint nthrottled;     // Periods in which the quota ran out
+  uint throttled_ms;   // Time spent throttled
+  int nproc;           // Processes in the group
+};
+
+// Time returned by clock_gettime()
+struct timespec {
+  uint tv_sec;
+  uint tv_nsec;
+};
+#define CLOCK_MONOTONIC          1  // Time since boot
+#define CLOCK_PROCESS_CPUTIME_ID 2  // CPU time used by the caller
+
+// QoS classes for setqos(), most urgent first
+#define QOS_LATENCY  0       // Latency-critical: short slices, preempts, HIGH
+#define QOS_DEFAULT  1
+#define QOS_BATCH    2       // Throughput: long slices, never preempts
+#define QOS_IDLE     3       // Runs only when nothing else wants the CPU
+#define NQOS         4
+
+// Longest SPAS tunable name returned by sysctl(), including the NUL
+#define SYSCTL_NAMELEN 32
@@ -1,6 +1,11 @@
 struct stat;
 struct rtcdate;
 struct cpustat; // <-- ADDED THIS LINE
+struct cpuinfo;
+struct procinfo;
+struct telemetry;
+struct timespec;
+struct groupinfo;
 
 // system calls
 int fork(void);
@@ -26,6 +31,18 @@ int sleep(int);
 int uptime(void);
 int cpustat(struct cpustat*); // <-- ADDED THIS LINE
 int setpriority(int, int);
+int cpuinfo(int, struct cpuinfo*);
+int procinfo(int, struct procinfo*);
+int setgovernor(int, int);
+int sysctl(int, char*, int*, int*);
+int telemetry(uint*, struct telemetry*, int);
+int clock_gettime(int, struct timespec*);
+int sched_setaffinity(int, uint);
+int sched_getaffinity(int, uint*);
+int setqos(int, int);
+int setgroup(int, int);
+int setquota(int, uint, uint);
+int groupinfo(int, struct groupinfo*);
 
 // ulib.c
 int stat(const char*, struct stat*);
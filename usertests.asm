@@ -0,0 +1,8085 @@
+
+_usertests:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+  return randstate;
+}
+
+int
+main(int argc, char *argv[])
+{
+       0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+       4:	83 e4 f0             	and    $0xfffffff0,%esp
+       7:	ff 71 fc             	push   -0x4(%ecx)
+       a:	55                   	push   %ebp
+       b:	89 e5                	mov    %esp,%ebp
+       d:	51                   	push   %ecx
+       e:	83 ec 0c             	sub    $0xc,%esp
+  printf(1, "usertests starting\n");
+      11:	68 53 5e 00 00       	push   $0x5e53
+      16:	6a 01                	push   $0x1
+      18:	e8 83 48 00 00       	call   48a0 <printf>
+
+  if(open("usertests.ran", 0) >= 0){
+      1d:	59                   	pop    %ecx
+      1e:	58                   	pop    %eax
+      1f:	6a 00                	push   $0x0
+      21:	68 67 5e 00 00       	push   $0x5e67
+      26:	e8 f8 46 00 00       	call   4723 <open>
+      2b:	83 c4 10             	add    $0x10,%esp
+      2e:	85 c0                	test   %eax,%eax
+      30:	78 13                	js     45 <main+0x45>
+    printf(1, "already ran user tests -- rebuild fs.img\n");
+      32:	52                   	push   %edx
+      33:	52                   	push   %edx
+      34:	68 e4 67 00 00       	push   $0x67e4
+      39:	6a 01                	push   $0x1
+      3b:	e8 60 48 00 00       	call   48a0 <printf>
+    exit();
+      40:	e8 9e 46 00 00       	call   46e3 <exit>
+  }
+  close(open("usertests.ran", O_CREATE));
+      45:	50                   	push   %eax
+      46:	50                   	push   %eax
+      47:	68 00 02 00 00       	push   $0x200
+      4c:	68 67 5e 00 00       	push   $0x5e67
+      51:	e8 cd 46 00 00       	call   4723 <open>
+      56:	89 04 24             	mov    %eax,(%esp)
+      59:	e8 ad 46 00 00       	call   470b <close>
+
+  argptest();
+      5e:	e8 ad 43 00 00       	call   4410 <argptest>
+  createdelete();
+      63:	e8 f8 1f 00 00       	call   2060 <createdelete>
+  linkunlink();
+      68:	e8 93 28 00 00       	call   2900 <linkunlink>
+  concreate();
+      6d:	e8 8e 25 00 00       	call   2600 <concreate>
+  fourfiles();
+      72:	e8 e9 1d 00 00       	call   1e60 <fourfiles>
+  sharedfd();
+      77:	e8 24 1c 00 00       	call   1ca0 <sharedfd>
+
+  bigargtest();
+      7c:	e8 4f 40 00 00       	call   40d0 <bigargtest>
+  bigwrite();
+      81:	e8 9a 31 00 00       	call   3220 <bigwrite>
+  bigargtest();
+      86:	e8 45 40 00 00       	call   40d0 <bigargtest>
+  bsstest();
+      8b:	e8 d0 3f 00 00       	call   4060 <bsstest>
+  sbrktest();
+      90:	e8 cb 3a 00 00       	call   3b60 <sbrktest>
+  validatetest();
+      95:	e8 16 3f 00 00       	call   3fb0 <validatetest>
+
+  opentest();
+      9a:	e8 71 03 00 00       	call   410 <opentest>
+  writetest();
+      9f:	e8 fc 03 00 00       	call   4a0 <writetest>
+  writetest1();
+      a4:	e8 d7 05 00 00       	call   680 <writetest1>
+  createtest();
+      a9:	e8 a2 07 00 00       	call   850 <createtest>
+
+  openiputtest();
+      ae:	e8 5d 02 00 00       	call   310 <openiputtest>
+  exitiputtest();
+      b3:	e8 58 01 00 00       	call   210 <exitiputtest>
+  iputtest();
+      b8:	e8 73 00 00 00       	call   130 <iputtest>
+
+  mem();
+      bd:	e8 0e 1b 00 00       	call   1bd0 <mem>
+  pipe1();
+      c2:	e8 69 09 00 00       	call   a30 <pipe1>
+  preempt();
+      c7:	e8 04 0b 00 00       	call   bd0 <preempt>
+  exitwait();
+      cc:	e8 5f 0c 00 00       	call   d30 <exitwait>
+  sysctltest();
+      d1:	e8 3a 0f 00 00       	call   1010 <sysctltest>
+  telemetrytest();
+      d6:	e8 85 10 00 00       	call   1160 <telemetrytest>
+  sleeptest();
+      db:	e8 a0 11 00 00       	call   1280 <sleeptest>
+  affinitytest();
+      e0:	e8 3b 13 00 00       	call   1420 <affinitytest>
+  quotatest();
+      e5:	e8 f6 16 00 00       	call   17e0 <quotatest>
+  dutytest();
+      ea:	e8 91 0d 00 00       	call   e80 <dutytest>
+
+  rmdot();
+      ef:	e8 1c 35 00 00       	call   3610 <rmdot>
+  fourteen();
+      f4:	e8 d7 33 00 00       	call   34d0 <fourteen>
+  bigfile();
+      f9:	e8 02 32 00 00       	call   3300 <bigfile>
+  subdir();
+      fe:	e8 3d 2a 00 00       	call   2b40 <subdir>
+  linktest();
+     103:	e8 e8 22 00 00       	call   23f0 <linktest>
+  unlinkread();
+     108:	e8 53 21 00 00       	call   2260 <unlinkread>
+  dirfile();
+     10d:	e8 7e 36 00 00       	call   3790 <dirfile>
+  iref();
+     112:	e8 79 38 00 00       	call   3990 <iref>
+  forktest();
+     117:	e8 94 39 00 00       	call   3ab0 <forktest>
+  bigdir(); // slow
+     11c:	e8 ef 28 00 00       	call   2a10 <bigdir>
+
+  uio();
+     121:	e8 7a 42 00 00       	call   43a0 <uio>
+
+  exectest();
+     126:	e8 b5 08 00 00       	call   9e0 <exectest>
+
+  exit();
+     12b:	e8 b3 45 00 00       	call   46e3 <exit>
+
+00000130 <iputtest>:
+{
+     130:	55                   	push   %ebp
+     131:	89 e5                	mov    %esp,%ebp
+     133:	83 ec 10             	sub    $0x10,%esp
+  printf(stdout, "iput test\n");
+     136:	68 5c 4c 00 00       	push   $0x4c5c
+     13b:	ff 35 e8 72 00 00    	push   0x72e8
+     141:	e8 5a 47 00 00       	call   48a0 <printf>
+  if(mkdir("iputdir") < 0){
+     146:	c7 04 24 ef 4b 00 00 	movl   $0x4bef,(%esp)
+     14d:	e8 f9 45 00 00       	call   474b <mkdir>
+     152:	83 c4 10             	add    $0x10,%esp
+     155:	85 c0                	test   %eax,%eax
+     157:	78 58                	js     1b1 <iputtest+0x81>
+  if(chdir("iputdir") < 0){
+     159:	83 ec 0c             	sub    $0xc,%esp
+     15c:	68 ef 4b 00 00       	push   $0x4bef
+     161:	e8 ed 45 00 00       	call   4753 <chdir>
+     166:	83 c4 10             	add    $0x10,%esp
+     169:	85 c0                	test   %eax,%eax
+     16b:	0f 88 85 00 00 00    	js     1f6 <iputtest+0xc6>
+  if(unlink("../iputdir") < 0){
+     171:	83 ec 0c             	sub    $0xc,%esp
+     174:	68 ec 4b 00 00       	push   $0x4bec
+     179:	e8 b5 45 00 00       	call   4733 <unlink>
+     17e:	83 c4 10             	add    $0x10,%esp
+     181:	85 c0                	test   %eax,%eax
+     183:	78 5a                	js     1df <iputtest+0xaf>
+  if(chdir("/") < 0){
+     185:	83 ec 0c             	sub    $0xc,%esp
+     188:	68 11 4c 00 00       	push   $0x4c11
+     18d:	e8 c1 45 00 00       	call   4753 <chdir>
+     192:	83 c4 10             	add    $0x10,%esp
+     195:	85 c0                	test   %eax,%eax
+     197:	78 2f                	js     1c8 <iputtest+0x98>
+  printf(stdout, "iput test ok\n");
+     199:	83 ec 08             	sub    $0x8,%esp
+     19c:	68 94 4c 00 00       	push   $0x4c94
+     1a1:	ff 35 e8 72 00 00    	push   0x72e8
+     1a7:	e8 f4 46 00 00       	call   48a0 <printf>
+}
+     1ac:	83 c4 10             	add    $0x10,%esp
+     1af:	c9                   	leave
+     1b0:	c3                   	ret
+    printf(stdout, "mkdir failed\n");
+     1b1:	50                   	push   %eax
+     1b2:	50                   	push   %eax
+     1b3:	68 c8 4b 00 00       	push   $0x4bc8
+     1b8:	ff 35 e8 72 00 00    	push   0x72e8
+     1be:	e8 dd 46 00 00       	call   48a0 <printf>
+    exit();
+     1c3:	e8 1b 45 00 00       	call   46e3 <exit>
+    printf(stdout, "chdir / failed\n");
+     1c8:	50                   	push   %eax
+     1c9:	50                   	push   %eax
+     1ca:	68 13 4c 00 00       	push   $0x4c13
+     1cf:	ff 35 e8 72 00 00    	push   0x72e8
+     1d5:	e8 c6 46 00 00       	call   48a0 <printf>
+    exit();
+     1da:	e8 04 45 00 00       	call   46e3 <exit>
+    printf(stdout, "unlink ../iputdir failed\n");
+     1df:	52                   	push   %edx
+     1e0:	52                   	push   %edx
+     1e1:	68 f7 4b 00 00       	push   $0x4bf7
+     1e6:	ff 35 e8 72 00 00    	push   0x72e8
+     1ec:	e8 af 46 00 00       	call   48a0 <printf>
+    exit();
+     1f1:	e8 ed 44 00 00       	call   46e3 <exit>
+    printf(stdout, "chdir iputdir failed\n");
+     1f6:	51                   	push   %ecx
+     1f7:	51                   	push   %ecx
+     1f8:	68 d6 4b 00 00       	push   $0x4bd6
+     1fd:	ff 35 e8 72 00 00    	push   0x72e8
+     203:	e8 98 46 00 00       	call   48a0 <printf>
+    exit();
+     208:	e8 d6 44 00 00       	call   46e3 <exit>
+     20d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000210 <exitiputtest>:
+{
+     210:	55                   	push   %ebp
+     211:	89 e5                	mov    %esp,%ebp
+     213:	83 ec 10             	sub    $0x10,%esp
+  printf(stdout, "exitiput test\n");
+     216:	68 23 4c 00 00       	push   $0x4c23
+     21b:	ff 35 e8 72 00 00    	push   0x72e8
+     221:	e8 7a 46 00 00       	call   48a0 <printf>
+  pid = fork();
+     226:	e8 b0 44 00 00       	call   46db <fork>
+  if(pid < 0){
+     22b:	83 c4 10             	add    $0x10,%esp
+     22e:	85 c0                	test   %eax,%eax
+     230:	0f 88 8a 00 00 00    	js     2c0 <exitiputtest+0xb0>
+  if(pid == 0){
+     236:	75 50                	jne    288 <exitiputtest+0x78>
+    if(mkdir("iputdir") < 0){
+     238:	83 ec 0c             	sub    $0xc,%esp
+     23b:	68 ef 4b 00 00       	push   $0x4bef
+     240:	e8 06 45 00 00       	call   474b <mkdir>
+     245:	83 c4 10             	add    $0x10,%esp
+     248:	85 c0                	test   %eax,%eax
+     24a:	0f 88 87 00 00 00    	js     2d7 <exitiputtest+0xc7>
+    if(chdir("iputdir") < 0){
+     250:	83 ec 0c             	sub    $0xc,%esp
+     253:	68 ef 4b 00 00       	push   $0x4bef
+     258:	e8 f6 44 00 00       	call   4753 <chdir>
+     25d:	83 c4 10             	add    $0x10,%esp
+     260:	85 c0                	test   %eax,%eax
+     262:	0f 88 86 00 00 00    	js     2ee <exitiputtest+0xde>
+    if(unlink("../iputdir") < 0){
+     268:	83 ec 0c             	sub    $0xc,%esp
+     26b:	68 ec 4b 00 00       	push   $0x4bec
+     270:	e8 be 44 00 00       	call   4733 <unlink>
+     275:	83 c4 10             	add    $0x10,%esp
+     278:	85 c0                	test   %eax,%eax
+     27a:	78 2c                	js     2a8 <exitiputtest+0x98>
+    exit();
+     27c:	e8 62 44 00 00       	call   46e3 <exit>
+     281:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  wait();
+     288:	e8 5e 44 00 00       	call   46eb <wait>
+  printf(stdout, "exitiput test ok\n");
+     28d:	83 ec 08             	sub    $0x8,%esp
+     290:	68 46 4c 00 00       	push   $0x4c46
+     295:	ff 35 e8 72 00 00    	push   0x72e8
+     29b:	e8 00 46 00 00       	call   48a0 <printf>
+}
+     2a0:	83 c4 10             	add    $0x10,%esp
+     2a3:	c9                   	leave
+     2a4:	c3                   	ret
+     2a5:	8d 76 00             	lea    0x0(%esi),%esi
+      printf(stdout, "unlink ../iputdir failed\n");
+     2a8:	83 ec 08             	sub    $0x8,%esp
+     2ab:	68 f7 4b 00 00       	push   $0x4bf7
+     2b0:	ff 35 e8 72 00 00    	push   0x72e8
+     2b6:	e8 e5 45 00 00       	call   48a0 <printf>
+      exit();
+     2bb:	e8 23 44 00 00       	call   46e3 <exit>
+    printf(stdout, "fork failed\n");
+     2c0:	51                   	push   %ecx
+     2c1:	51                   	push   %ecx
+     2c2:	68 a6 5d 00 00       	push   $0x5da6
+     2c7:	ff 35 e8 72 00 00    	push   0x72e8
+     2cd:	e8 ce 45 00 00       	call   48a0 <printf>
+    exit();
+     2d2:	e8 0c 44 00 00       	call   46e3 <exit>
+      printf(stdout, "mkdir failed\n");
+     2d7:	52                   	push   %edx
+     2d8:	52                   	push   %edx
+     2d9:	68 c8 4b 00 00       	push   $0x4bc8
+     2de:	ff 35 e8 72 00 00    	push   0x72e8
+     2e4:	e8 b7 45 00 00       	call   48a0 <printf>
+      exit();
+     2e9:	e8 f5 43 00 00       	call   46e3 <exit>
+      printf(stdout, "child chdir failed\n");
+     2ee:	50                   	push   %eax
+     2ef:	50                   	push   %eax
+     2f0:	68 32 4c 00 00       	push   $0x4c32
+     2f5:	ff 35 e8 72 00 00    	push   0x72e8
+     2fb:	e8 a0 45 00 00       	call   48a0 <printf>
+      exit();
+     300:	e8 de 43 00 00       	call   46e3 <exit>
+     305:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     30c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000310 <openiputtest>:
+{
+     310:	55                   	push   %ebp
+     311:	89 e5                	mov    %esp,%ebp
+     313:	83 ec 10             	sub    $0x10,%esp
+  printf(stdout, "openiput test\n");
+     316:	68 58 4c 00 00       	push   $0x4c58
+     31b:	ff 35 e8 72 00 00    	push   0x72e8
+     321:	e8 7a 45 00 00       	call   48a0 <printf>
+  if(mkdir("oidir") < 0){
+     326:	c7 04 24 67 4c 00 00 	movl   $0x4c67,(%esp)
+     32d:	e8 19 44 00 00       	call   474b <mkdir>
+     332:	83 c4 10             	add    $0x10,%esp
+     335:	85 c0                	test   %eax,%eax
+     337:	0f 88 9f 00 00 00    	js     3dc <openiputtest+0xcc>
+  pid = fork();
+     33d:	e8 99 43 00 00       	call   46db <fork>
+  if(pid < 0){
+     342:	85 c0                	test   %eax,%eax
+     344:	78 7f                	js     3c5 <openiputtest+0xb5>
+  if(pid == 0){
+     346:	75 38                	jne    380 <openiputtest+0x70>
+    int fd = open("oidir", O_RDWR);
+     348:	83 ec 08             	sub    $0x8,%esp
+     34b:	6a 02                	push   $0x2
+     34d:	68 67 4c 00 00       	push   $0x4c67
+     352:	e8 cc 43 00 00       	call   4723 <open>
+    if(fd >= 0){
+     357:	83 c4 10             	add    $0x10,%esp
+     35a:	85 c0                	test   %eax,%eax
+     35c:	78 62                	js     3c0 <openiputtest+0xb0>
+      printf(stdout, "open directory for write succeeded\n");
+     35e:	83 ec 08             	sub    $0x8,%esp
+     361:	68 8c 5e 00 00       	push   $0x5e8c
+     366:	ff 35 e8 72 00 00    	push   0x72e8
+     36c:	e8 2f 45 00 00       	call   48a0 <printf>
+      exit();
+     371:	e8 6d 43 00 00       	call   46e3 <exit>
+     376:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     37d:	8d 76 00             	lea    0x0(%esi),%esi
+  sleep(1);
+     380:	83 ec 0c             	sub    $0xc,%esp
+     383:	6a 01                	push   $0x1
+     385:	e8 e9 43 00 00       	call   4773 <sleep>
+  if(unlink("oidir") != 0){
+     38a:	c7 04 24 67 4c 00 00 	movl   $0x4c67,(%esp)
+     391:	e8 9d 43 00 00       	call   4733 <unlink>
+     396:	83 c4 10             	add    $0x10,%esp
+     399:	85 c0                	test   %eax,%eax
+     39b:	75 56                	jne    3f3 <openiputtest+0xe3>
+  wait();
+     39d:	e8 49 43 00 00       	call   46eb <wait>
+  printf(stdout, "openiput test ok\n");
+     3a2:	83 ec 08             	sub    $0x8,%esp
+     3a5:	68 90 4c 00 00       	push   $0x4c90
+     3aa:	ff 35 e8 72 00 00    	push   0x72e8
+     3b0:	e8 eb 44 00 00       	call   48a0 <printf>
+}
+     3b5:	83 c4 10             	add    $0x10,%esp
+     3b8:	c9                   	leave
+     3b9:	c3                   	ret
+     3ba:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    exit();
+     3c0:	e8 1e 43 00 00       	call   46e3 <exit>
+    printf(stdout, "fork failed\n");
+     3c5:	52                   	push   %edx
+     3c6:	52                   	push   %edx
+     3c7:	68 a6 5d 00 00       	push   $0x5da6
+     3cc:	ff 35 e8 72 00 00    	push   0x72e8
+     3d2:	e8 c9 44 00 00       	call   48a0 <printf>
+    exit();
+     3d7:	e8 07 43 00 00       	call   46e3 <exit>
+    printf(stdout, "mkdir oidir failed\n");
+     3dc:	51                   	push   %ecx
+     3dd:	51                   	push   %ecx
+     3de:	68 6d 4c 00 00       	push   $0x4c6d
+     3e3:	ff 35 e8 72 00 00    	push   0x72e8
+     3e9:	e8 b2 44 00 00       	call   48a0 <printf>
+    exit();
+     3ee:	e8 f0 42 00 00       	call   46e3 <exit>
+    printf(stdout, "unlink failed\n");
+     3f3:	50                   	push   %eax
+     3f4:	50                   	push   %eax
+     3f5:	68 81 4c 00 00       	push   $0x4c81
+     3fa:	ff 35 e8 72 00 00    	push   0x72e8
+     400:	e8 9b 44 00 00       	call   48a0 <printf>
+    exit();
+     405:	e8 d9 42 00 00       	call   46e3 <exit>
+     40a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00000410 <opentest>:
+{
+     410:	55                   	push   %ebp
+     411:	89 e5                	mov    %esp,%ebp
+     413:	83 ec 10             	sub    $0x10,%esp
+  printf(stdout, "open test\n");
+     416:	68 a2 4c 00 00       	push   $0x4ca2
+     41b:	ff 35 e8 72 00 00    	push   0x72e8
+     421:	e8 7a 44 00 00       	call   48a0 <printf>
+  fd = open("echo", 0);
+     426:	58                   	pop    %eax
+     427:	5a                   	pop    %edx
+     428:	6a 00                	push   $0x0
+     42a:	68 ad 4c 00 00       	push   $0x4cad
+     42f:	e8 ef 42 00 00       	call   4723 <open>
+  if(fd < 0){
+     434:	83 c4 10             	add    $0x10,%esp
+     437:	85 c0                	test   %eax,%eax
+     439:	78 36                	js     471 <opentest+0x61>
+  close(fd);
+     43b:	83 ec 0c             	sub    $0xc,%esp
+     43e:	50                   	push   %eax
+     43f:	e8 c7 42 00 00       	call   470b <close>
+  fd = open("doesnotexist", 0);
+     444:	5a                   	pop    %edx
+     445:	59                   	pop    %ecx
+     446:	6a 00                	push   $0x0
+     448:	68 c5 4c 00 00       	push   $0x4cc5
+     44d:	e8 d1 42 00 00       	call   4723 <open>
+  if(fd >= 0){
+     452:	83 c4 10             	add    $0x10,%esp
+     455:	85 c0                	test   %eax,%eax
+     457:	79 2f                	jns    488 <opentest+0x78>
+  printf(stdout, "open test ok\n");
+     459:	83 ec 08             	sub    $0x8,%esp
+     45c:	68 f0 4c 00 00       	push   $0x4cf0
+     461:	ff 35 e8 72 00 00    	push   0x72e8
+     467:	e8 34 44 00 00       	call   48a0 <printf>
+}
+     46c:	83 c4 10             	add    $0x10,%esp
+     46f:	c9                   	leave
+     470:	c3                   	ret
+    printf(stdout, "open echo failed!\n");
+     471:	50                   	push   %eax
+     472:	50                   	push   %eax
+     473:	68 b2 4c 00 00       	push   $0x4cb2
+     478:	ff 35 e8 72 00 00    	push   0x72e8
+     47e:	e8 1d 44 00 00       	call   48a0 <printf>
+    exit();
+     483:	e8 5b 42 00 00       	call   46e3 <exit>
+    printf(stdout, "open doesnotexist succeeded!\n");
+     488:	50                   	push   %eax
+     489:	50                   	push   %eax
+     48a:	68 d2 4c 00 00       	push   $0x4cd2
+     48f:	ff 35 e8 72 00 00    	push   0x72e8
+     495:	e8 06 44 00 00       	call   48a0 <printf>
+    exit();
+     49a:	e8 44 42 00 00       	call   46e3 <exit>
+     49f:	90                   	nop
+
+000004a0 <writetest>:
+{
+     4a0:	55                   	push   %ebp
+     4a1:	89 e5                	mov    %esp,%ebp
+     4a3:	56                   	push   %esi
+     4a4:	53                   	push   %ebx
+  printf(stdout, "small file test\n");
+     4a5:	83 ec 08             	sub    $0x8,%esp
+     4a8:	68 fe 4c 00 00       	push   $0x4cfe
+     4ad:	ff 35 e8 72 00 00    	push   0x72e8
+     4b3:	e8 e8 43 00 00       	call   48a0 <printf>
+  fd = open("small", O_CREATE|O_RDWR);
+     4b8:	58                   	pop    %eax
+     4b9:	5a                   	pop    %edx
+     4ba:	68 02 02 00 00       	push   $0x202
+     4bf:	68 0f 4d 00 00       	push   $0x4d0f
+     4c4:	e8 5a 42 00 00       	call   4723 <open>
+  if(fd >= 0){
+     4c9:	83 c4 10             	add    $0x10,%esp
+     4cc:	85 c0                	test   %eax,%eax
+     4ce:	0f 88 88 01 00 00    	js     65c <writetest+0x1bc>
+    printf(stdout, "creat small succeeded; ok\n");
+     4d4:	83 ec 08             	sub    $0x8,%esp
+     4d7:	89 c6                	mov    %eax,%esi
+  for(i = 0; i < 100; i++){
+     4d9:	31 db                	xor    %ebx,%ebx
+    printf(stdout, "creat small succeeded; ok\n");
+     4db:	68 15 4d 00 00       	push   $0x4d15
+     4e0:	ff 35 e8 72 00 00    	push   0x72e8
+     4e6:	e8 b5 43 00 00       	call   48a0 <printf>
+     4eb:	83 c4 10             	add    $0x10,%esp
+     4ee:	66 90                	xchg   %ax,%ax
+    if(write(fd, "aaaaaaaaaa", 10) != 10){
+     4f0:	83 ec 04             	sub    $0x4,%esp
+     4f3:	6a 0a                	push   $0xa
+     4f5:	68 4c 4d 00 00       	push   $0x4d4c
+     4fa:	56                   	push   %esi
+     4fb:	e8 03 42 00 00       	call   4703 <write>
+     500:	83 c4 10             	add    $0x10,%esp
+     503:	83 f8 0a             	cmp    $0xa,%eax
+     506:	0f 85 d9 00 00 00    	jne    5e5 <writetest+0x145>
+    if(write(fd, "bbbbbbbbbb", 10) != 10){
+     50c:	83 ec 04             	sub    $0x4,%esp
+     50f:	6a 0a                	push   $0xa
+     511:	68 57 4d 00 00       	push   $0x4d57
+     516:	56                   	push   %esi
+     517:	e8 e7 41 00 00       	call   4703 <write>
+     51c:	83 c4 10             	add    $0x10,%esp
+     51f:	83 f8 0a             	cmp    $0xa,%eax
+     522:	0f 85 d6 00 00 00    	jne    5fe <writetest+0x15e>
+  for(i = 0; i < 100; i++){
+     528:	83 c3 01             	add    $0x1,%ebx
+     52b:	83 fb 64             	cmp    $0x64,%ebx
+     52e:	75 c0                	jne    4f0 <writetest+0x50>
+  printf(stdout, "writes ok\n");
+     530:	83 ec 08             	sub    $0x8,%esp
+     533:	68 62 4d 00 00       	push   $0x4d62
+     538:	ff 35 e8 72 00 00    	push   0x72e8
+     53e:	e8 5d 43 00 00       	call   48a0 <printf>
+  close(fd);
+     543:	89 34 24             	mov    %esi,(%esp)
+     546:	e8 c0 41 00 00       	call   470b <close>
+  fd = open("small", O_RDONLY);
+     54b:	5b                   	pop    %ebx
+     54c:	5e                   	pop    %esi
+     54d:	6a 00                	push   $0x0
+     54f:	68 0f 4d 00 00       	push   $0x4d0f
+     554:	e8 ca 41 00 00       	call   4723 <open>
+  if(fd >= 0){
+     559:	83 c4 10             	add    $0x10,%esp
+  fd = open("small", O_RDONLY);
+     55c:	89 c3                	mov    %eax,%ebx
+  if(fd >= 0){
+     55e:	85 c0                	test   %eax,%eax
+     560:	0f 88 b1 00 00 00    	js     617 <writetest+0x177>
+    printf(stdout, "open small succeeded ok\n");
+     566:	83 ec 08             	sub    $0x8,%esp
+     569:	68 6d 4d 00 00       	push   $0x4d6d
+     56e:	ff 35 e8 72 00 00    	push   0x72e8
+     574:	e8 27 43 00 00       	call   48a0 <printf>
+  i = read(fd, buf, 2000);
+     579:	83 c4 0c             	add    $0xc,%esp
+     57c:	68 d0 07 00 00       	push   $0x7d0
+     581:	68 20 9a 00 00       	push   $0x9a20
+     586:	53                   	push   %ebx
+     587:	e8 6f 41 00 00       	call   46fb <read>
+  if(i == 2000){
+     58c:	83 c4 10             	add    $0x10,%esp
+     58f:	3d d0 07 00 00       	cmp    $0x7d0,%eax
+     594:	0f 85 94 00 00 00    	jne    62e <writetest+0x18e>
+    printf(stdout, "read succeeded ok\n");
+     59a:	83 ec 08             	sub    $0x8,%esp
+     59d:	68 a1 4d 00 00       	push   $0x4da1
+     5a2:	ff 35 e8 72 00 00    	push   0x72e8
+     5a8:	e8 f3 42 00 00       	call   48a0 <printf>
+  close(fd);
+     5ad:	89 1c 24             	mov    %ebx,(%esp)
+     5b0:	e8 56 41 00 00       	call   470b <close>
+  if(unlink("small") < 0){
+     5b5:	c7 04 24 0f 4d 00 00 	movl   $0x4d0f,(%esp)
+     5bc:	e8 72 41 00 00       	call   4733 <unlink>
+     5c1:	83 c4 10             	add    $0x10,%esp
+     5c4:	85 c0                	test   %eax,%eax
+     5c6:	78 7d                	js     645 <writetest+0x1a5>
+  printf(stdout, "small file test ok\n");
+     5c8:	83 ec 08             	sub    $0x8,%esp
+     5cb:	68 c9 4d 00 00       	push   $0x4dc9
+     5d0:	ff 35 e8 72 00 00    	push   0x72e8
+     5d6:	e8 c5 42 00 00       	call   48a0 <printf>
+}
+     5db:	83 c4 10             	add    $0x10,%esp
+     5de:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     5e1:	5b                   	pop    %ebx
+     5e2:	5e                   	pop    %esi
+     5e3:	5d                   	pop    %ebp
+     5e4:	c3                   	ret
+      printf(stdout, "error: write aa %d new file failed\n", i);
+     5e5:	83 ec 04             	sub    $0x4,%esp
+     5e8:	53                   	push   %ebx
+     5e9:	68 b0 5e 00 00       	push   $0x5eb0
+     5ee:	ff 35 e8 72 00 00    	push   0x72e8
+     5f4:	e8 a7 42 00 00       	call   48a0 <printf>
+      exit();
+     5f9:	e8 e5 40 00 00       	call   46e3 <exit>
+      printf(stdout, "error: write bb %d new file failed\n", i);
+     5fe:	83 ec 04             	sub    $0x4,%esp
+     601:	53                   	push   %ebx
+     602:	68 d4 5e 00 00       	push   $0x5ed4
+     607:	ff 35 e8 72 00 00    	push   0x72e8
+     60d:	e8 8e 42 00 00       	call   48a0 <printf>
+      exit();
+     612:	e8 cc 40 00 00       	call   46e3 <exit>
+    printf(stdout, "error: open small failed!\n");
+     617:	51                   	push   %ecx
+     618:	51                   	push   %ecx
+     619:	68 86 4d 00 00       	push   $0x4d86
+     61e:	ff 35 e8 72 00 00    	push   0x72e8
+     624:	e8 77 42 00 00       	call   48a0 <printf>
+    exit();
+     629:	e8 b5 40 00 00       	call   46e3 <exit>
+    printf(stdout, "read failed\n");
+     62e:	52                   	push   %edx
+     62f:	52                   	push   %edx
+     630:	68 d1 4f 00 00       	push   $0x4fd1
+     635:	ff 35 e8 72 00 00    	push   0x72e8
+     63b:	e8 60 42 00 00       	call   48a0 <printf>
+    exit();
+     640:	e8 9e 40 00 00       	call   46e3 <exit>
+    printf(stdout, "unlink small failed\n");
+     645:	50                   	push   %eax
+     646:	50                   	push   %eax
+     647:	68 b4 4d 00 00       	push   $0x4db4
+     64c:	ff 35 e8 72 00 00    	push   0x72e8
+     652:	e8 49 42 00 00       	call   48a0 <printf>
+    exit();
+     657:	e8 87 40 00 00       	call   46e3 <exit>
+    printf(stdout, "error: creat small failed!\n");
+     65c:	50                   	push   %eax
+     65d:	50                   	push   %eax
+     65e:	68 30 4d 00 00       	push   $0x4d30
+     663:	ff 35 e8 72 00 00    	push   0x72e8
+     669:	e8 32 42 00 00       	call   48a0 <printf>
+    exit();
+     66e:	e8 70 40 00 00       	call   46e3 <exit>
+     673:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     67a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00000680 <writetest1>:
+{
+     680:	55                   	push   %ebp
+     681:	89 e5                	mov    %esp,%ebp
+     683:	56                   	push   %esi
+     684:	53                   	push   %ebx
+  printf(stdout, "big files test\n");
+     685:	83 ec 08             	sub    $0x8,%esp
+     688:	68 dd 4d 00 00       	push   $0x4ddd
+     68d:	ff 35 e8 72 00 00    	push   0x72e8
+     693:	e8 08 42 00 00       	call   48a0 <printf>
+  fd = open("big", O_CREATE|O_RDWR);
+     698:	58                   	pop    %eax
+     699:	5a                   	pop    %edx
+     69a:	68 02 02 00 00       	push   $0x202
+     69f:	68 57 4e 00 00       	push   $0x4e57
+     6a4:	e8 7a 40 00 00       	call   4723 <open>
+  if(fd < 0){
+     6a9:	83 c4 10             	add    $0x10,%esp
+     6ac:	85 c0                	test   %eax,%eax
+     6ae:	0f 88 61 01 00 00    	js     815 <writetest1+0x195>
+     6b4:	89 c6                	mov    %eax,%esi
+  for(i = 0; i < MAXFILE; i++){
+     6b6:	31 db                	xor    %ebx,%ebx
+     6b8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     6bf:	90                   	nop
+    if(write(fd, buf, 512) != 512){
+     6c0:	83 ec 04             	sub    $0x4,%esp
+    ((int*)buf)[0] = i;
+     6c3:	89 1d 20 9a 00 00    	mov    %ebx,0x9a20
+    if(write(fd, buf, 512) != 512){
+     6c9:	68 00 02 00 00       	push   $0x200
+     6ce:	68 20 9a 00 00       	push   $0x9a20
+     6d3:	56                   	push   %esi
+     6d4:	e8 2a 40 00 00       	call   4703 <write>
+     6d9:	83 c4 10             	add    $0x10,%esp
+     6dc:	3d 00 02 00 00       	cmp    $0x200,%eax
+     6e1:	0f 85 b3 00 00 00    	jne    79a <writetest1+0x11a>
+  for(i = 0; i < MAXFILE; i++){
+     6e7:	83 c3 01             	add    $0x1,%ebx
+     6ea:	81 fb 8c 00 00 00    	cmp    $0x8c,%ebx
+     6f0:	75 ce                	jne    6c0 <writetest1+0x40>
+  close(fd);
+     6f2:	83 ec 0c             	sub    $0xc,%esp
+     6f5:	56                   	push   %esi
+     6f6:	e8 10 40 00 00       	call   470b <close>
+  fd = open("big", O_RDONLY);
+     6fb:	5b                   	pop    %ebx
+     6fc:	5e                   	pop    %esi
+     6fd:	6a 00                	push   $0x0
+     6ff:	68 57 4e 00 00       	push   $0x4e57
+     704:	e8 1a 40 00 00       	call   4723 <open>
+  if(fd < 0){
+     709:	83 c4 10             	add    $0x10,%esp
+  fd = open("big", O_RDONLY);
+     70c:	89 c3                	mov    %eax,%ebx
+  if(fd < 0){
+     70e:	85 c0                	test   %eax,%eax
+     710:	0f 88 e8 00 00 00    	js     7fe <writetest1+0x17e>
+  n = 0;
+     716:	31 f6                	xor    %esi,%esi
+     718:	eb 1d                	jmp    737 <writetest1+0xb7>
+     71a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    } else if(i != 512){
+     720:	3d 00 02 00 00       	cmp    $0x200,%eax
+     725:	0f 85 9f 00 00 00    	jne    7ca <writetest1+0x14a>
+    if(((int*)buf)[0] != n){
+     72b:	a1 20 9a 00 00       	mov    0x9a20,%eax
+     730:	39 f0                	cmp    %esi,%eax
+     732:	75 7f                	jne    7b3 <writetest1+0x133>
+    n++;
+     734:	83 c6 01             	add    $0x1,%esi
+    i = read(fd, buf, 512);
+     737:	83 ec 04             	sub    $0x4,%esp
+     73a:	68 00 02 00 00       	push   $0x200
+     73f:	68 20 9a 00 00       	push   $0x9a20
+     744:	53                   	push   %ebx
+     745:	e8 b1 3f 00 00       	call   46fb <read>
+    if(i == 0){
+     74a:	83 c4 10             	add    $0x10,%esp
+     74d:	85 c0                	test   %eax,%eax
+     74f:	75 cf                	jne    720 <writetest1+0xa0>
+      if(n == MAXFILE - 1){
+     751:	81 fe 8b 00 00 00    	cmp    $0x8b,%esi
+     757:	0f 84 86 00 00 00    	je     7e3 <writetest1+0x163>
+  close(fd);
+     75d:	83 ec 0c             	sub    $0xc,%esp
+     760:	53                   	push   %ebx
+     761:	e8 a5 3f 00 00       	call   470b <close>
+  if(unlink("big") < 0){
+     766:	c7 04 24 57 4e 00 00 	movl   $0x4e57,(%esp)
+     76d:	e8 c1 3f 00 00       	call   4733 <unlink>
+     772:	83 c4 10             	add    $0x10,%esp
+     775:	85 c0                	test   %eax,%eax
+     777:	0f 88 af 00 00 00    	js     82c <writetest1+0x1ac>
+  printf(stdout, "big files ok\n");
+     77d:	83 ec 08             	sub    $0x8,%esp
+     780:	68 7e 4e 00 00       	push   $0x4e7e
+     785:	ff 35 e8 72 00 00    	push   0x72e8
+     78b:	e8 10 41 00 00       	call   48a0 <printf>
+}
+     790:	83 c4 10             	add    $0x10,%esp
+     793:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     796:	5b                   	pop    %ebx
+     797:	5e                   	pop    %esi
+     798:	5d                   	pop    %ebp
+     799:	c3                   	ret
+      printf(stdout, "error: write big file failed\n", i);
+     79a:	83 ec 04             	sub    $0x4,%esp
+     79d:	53                   	push   %ebx
+     79e:	68 07 4e 00 00       	push   $0x4e07
+     7a3:	ff 35 e8 72 00 00    	push   0x72e8
+     7a9:	e8 f2 40 00 00       	call   48a0 <printf>
+      exit();
+     7ae:	e8 30 3f 00 00       	call   46e3 <exit>
+      printf(stdout, "read content of block %d is %d\n",
+     7b3:	50                   	push   %eax
+     7b4:	56                   	push   %esi
+     7b5:	68 f8 5e 00 00       	push   $0x5ef8
+     7ba:	ff 35 e8 72 00 00    	push   0x72e8
+     7c0:	e8 db 40 00 00       	call   48a0 <printf>
+      exit();
+     7c5:	e8 19 3f 00 00       	call   46e3 <exit>
+      printf(stdout, "read failed %d\n", i);
+     7ca:	83 ec 04             	sub    $0x4,%esp
+     7cd:	50                   	push   %eax
+     7ce:	68 5b 4e 00 00       	push   $0x4e5b
+     7d3:	ff 35 e8 72 00 00    	push   0x72e8
+     7d9:	e8 c2 40 00 00       	call   48a0 <printf>
+      exit();
+     7de:	e8 00 3f 00 00       	call   46e3 <exit>
+        printf(stdout, "read only %d blocks from big", n);
+     7e3:	52                   	push   %edx
+     7e4:	68 8b 00 00 00       	push   $0x8b
+     7e9:	68 3e 4e 00 00       	push   $0x4e3e
+     7ee:	ff 35 e8 72 00 00    	push   0x72e8
+     7f4:	e8 a7 40 00 00       	call   48a0 <printf>
+        exit();
+     7f9:	e8 e5 3e 00 00       	call   46e3 <exit>
+    printf(stdout, "error: open big failed!\n");
+     7fe:	51                   	push   %ecx
+     7ff:	51                   	push   %ecx
+     800:	68 25 4e 00 00       	push   $0x4e25
+     805:	ff 35 e8 72 00 00    	push   0x72e8
+     80b:	e8 90 40 00 00       	call   48a0 <printf>
+    exit();
+     810:	e8 ce 3e 00 00       	call   46e3 <exit>
+    printf(stdout, "error: creat big failed!\n");
+     815:	50                   	push   %eax
+     816:	50                   	push   %eax
+     817:	68 ed 4d 00 00       	push   $0x4ded
+     81c:	ff 35 e8 72 00 00    	push   0x72e8
+     822:	e8 79 40 00 00       	call   48a0 <printf>
+    exit();
+     827:	e8 b7 3e 00 00       	call   46e3 <exit>
+    printf(stdout, "unlink big failed\n");
+     82c:	50                   	push   %eax
+     82d:	50                   	push   %eax
+     82e:	68 6b 4e 00 00       	push   $0x4e6b
+     833:	ff 35 e8 72 00 00    	push   0x72e8
+     839:	e8 62 40 00 00       	call   48a0 <printf>
+    exit();
+     83e:	e8 a0 3e 00 00       	call   46e3 <exit>
+     843:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     84a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00000850 <createtest>:
+{
+     850:	55                   	push   %ebp
+     851:	89 e5                	mov    %esp,%ebp
+     853:	53                   	push   %ebx
+  name[2] = '\0';
+     854:	bb 30 00 00 00       	mov    $0x30,%ebx
+{
+     859:	83 ec 0c             	sub    $0xc,%esp
+  printf(stdout, "many creates, followed by unlink test\n");
+     85c:	68 18 5f 00 00       	push   $0x5f18
+     861:	ff 35 e8 72 00 00    	push   0x72e8
+     867:	e8 34 40 00 00       	call   48a0 <printf>
+  name[0] = 'a';
+     86c:	c6 05 10 9a 00 00 61 	movb   $0x61,0x9a10
+  name[2] = '\0';
+     873:	83 c4 10             	add    $0x10,%esp
+     876:	c6 05 12 9a 00 00 00 	movb   $0x0,0x9a12
+  for(i = 0; i < 52; i++){
+     87d:	8d 76 00             	lea    0x0(%esi),%esi
+    fd = open(name, O_CREATE|O_RDWR);
+     880:	83 ec 08             	sub    $0x8,%esp
+    name[1] = '0' + i;
+     883:	88 1d 11 9a 00 00    	mov    %bl,0x9a11
+  for(i = 0; i < 52; i++){
+     889:	83 c3 01             	add    $0x1,%ebx
+    fd = open(name, O_CREATE|O_RDWR);
+     88c:	68 02 02 00 00       	push   $0x202
+     891:	68 10 9a 00 00       	push   $0x9a10
+     896:	e8 88 3e 00 00       	call   4723 <open>
+    close(fd);
+     89b:	89 04 24             	mov    %eax,(%esp)
+     89e:	e8 68 3e 00 00       	call   470b <close>
+  for(i = 0; i < 52; i++){
+     8a3:	83 c4 10             	add    $0x10,%esp
+     8a6:	80 fb 64             	cmp    $0x64,%bl
+     8a9:	75 d5                	jne    880 <createtest+0x30>
+  name[0] = 'a';
+     8ab:	c6 05 10 9a 00 00 61 	movb   $0x61,0x9a10
+  name[2] = '\0';
+     8b2:	bb 30 00 00 00       	mov    $0x30,%ebx
+     8b7:	c6 05 12 9a 00 00 00 	movb   $0x0,0x9a12
+  for(i = 0; i < 52; i++){
+     8be:	66 90                	xchg   %ax,%ax
+    unlink(name);
+     8c0:	83 ec 0c             	sub    $0xc,%esp
+    name[1] = '0' + i;
+     8c3:	88 1d 11 9a 00 00    	mov    %bl,0x9a11
+  for(i = 0; i < 52; i++){
+     8c9:	83 c3 01             	add    $0x1,%ebx
+    unlink(name);
+     8cc:	68 10 9a 00 00       	push   $0x9a10
+     8d1:	e8 5d 3e 00 00       	call   4733 <unlink>
+  for(i = 0; i < 52; i++){
+     8d6:	83 c4 10             	add    $0x10,%esp
+     8d9:	80 fb 64             	cmp    $0x64,%bl
+     8dc:	75 e2                	jne    8c0 <createtest+0x70>
+  printf(stdout, "many creates, followed by unlink; ok\n");
+     8de:	83 ec 08             	sub    $0x8,%esp
+     8e1:	68 40 5f 00 00       	push   $0x5f40
+     8e6:	ff 35 e8 72 00 00    	push   0x72e8
+     8ec:	e8 af 3f 00 00       	call   48a0 <printf>
+}
+     8f1:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     8f4:	83 c4 10             	add    $0x10,%esp
+     8f7:	c9                   	leave
+     8f8:	c3                   	ret
+     8f9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000900 <dirtest>:
+{
+     900:	55                   	push   %ebp
+     901:	89 e5                	mov    %esp,%ebp
+     903:	83 ec 10             	sub    $0x10,%esp
+  printf(stdout, "mkdir test\n");
+     906:	68 8c 4e 00 00       	push   $0x4e8c
+     90b:	ff 35 e8 72 00 00    	push   0x72e8
+     911:	e8 8a 3f 00 00       	call   48a0 <printf>
+  if(mkdir("dir0") < 0){
+     916:	c7 04 24 98 4e 00 00 	movl   $0x4e98,(%esp)
+     91d:	e8 29 3e 00 00       	call   474b <mkdir>
+     922:	83 c4 10             	add    $0x10,%esp
+     925:	85 c0                	test   %eax,%eax
+     927:	78 58                	js     981 <dirtest+0x81>
+  if(chdir("dir0") < 0){
+     929:	83 ec 0c             	sub    $0xc,%esp
+     92c:	68 98 4e 00 00       	push   $0x4e98
+     931:	e8 1d 3e 00 00       	call   4753 <chdir>
+     936:	83 c4 10             	add    $0x10,%esp
+     939:	85 c0                	test   %eax,%eax
+     93b:	0f 88 85 00 00 00    	js     9c6 <dirtest+0xc6>
+  if(chdir("..") < 0){
+     941:	83 ec 0c             	sub    $0xc,%esp
+     944:	68 da 56 00 00       	push   $0x56da
+     949:	e8 05 3e 00 00       	call   4753 <chdir>
+     94e:	83 c4 10             	add    $0x10,%esp
+     951:	85 c0                	test   %eax,%eax
+     953:	78 5a                	js     9af <dirtest+0xaf>
+  if(unlink("dir0") < 0){
+     955:	83 ec 0c             	sub    $0xc,%esp
+     958:	68 98 4e 00 00       	push   $0x4e98
+     95d:	e8 d1 3d 00 00       	call   4733 <unlink>
+     962:	83 c4 10             	add    $0x10,%esp
+     965:	85 c0                	test   %eax,%eax
+     967:	78 2f                	js     998 <dirtest+0x98>
+  printf(stdout, "mkdir test ok\n");
+     969:	83 ec 08             	sub    $0x8,%esp
+     96c:	68 d5 4e 00 00       	push   $0x4ed5
+     971:	ff 35 e8 72 00 00    	push   0x72e8
+     977:	e8 24 3f 00 00       	call   48a0 <printf>
+}
+     97c:	83 c4 10             	add    $0x10,%esp
+     97f:	c9                   	leave
+     980:	c3                   	ret
+    printf(stdout, "mkdir failed\n");
+     981:	50                   	push   %eax
+     982:	50                   	push   %eax
+     983:	68 c8 4b 00 00       	push   $0x4bc8
+     988:	ff 35 e8 72 00 00    	push   0x72e8
+     98e:	e8 0d 3f 00 00       	call   48a0 <printf>
+    exit();
+     993:	e8 4b 3d 00 00       	call   46e3 <exit>
+    printf(stdout, "unlink dir0 failed\n");
+     998:	50                   	push   %eax
+     999:	50                   	push   %eax
+     99a:	68 c1 4e 00 00       	push   $0x4ec1
+     99f:	ff 35 e8 72 00 00    	push   0x72e8
+     9a5:	e8 f6 3e 00 00       	call   48a0 <printf>
+    exit();
+     9aa:	e8 34 3d 00 00       	call   46e3 <exit>
+    printf(stdout, "chdir .. failed\n");
+     9af:	52                   	push   %edx
+     9b0:	52                   	push   %edx
+     9b1:	68 b0 4e 00 00       	push   $0x4eb0
+     9b6:	ff 35 e8 72 00 00    	push   0x72e8
+     9bc:	e8 df 3e 00 00       	call   48a0 <printf>
+    exit();
+     9c1:	e8 1d 3d 00 00       	call   46e3 <exit>
+    printf(stdout, "chdir dir0 failed\n");
+     9c6:	51                   	push   %ecx
+     9c7:	51                   	push   %ecx
+     9c8:	68 9d 4e 00 00       	push   $0x4e9d
+     9cd:	ff 35 e8 72 00 00    	push   0x72e8
+     9d3:	e8 c8 3e 00 00       	call   48a0 <printf>
+    exit();
+     9d8:	e8 06 3d 00 00       	call   46e3 <exit>
+     9dd:	8d 76 00             	lea    0x0(%esi),%esi
+
+000009e0 <exectest>:
+{
+     9e0:	55                   	push   %ebp
+     9e1:	89 e5                	mov    %esp,%ebp
+     9e3:	83 ec 10             	sub    $0x10,%esp
+  printf(stdout, "exec test\n");
+     9e6:	68 e4 4e 00 00       	push   $0x4ee4
+     9eb:	ff 35 e8 72 00 00    	push   0x72e8
+     9f1:	e8 aa 3e 00 00       	call   48a0 <printf>
+  if(exec("echo", echoargv) < 0){
+     9f6:	5a                   	pop    %edx
+     9f7:	59                   	pop    %ecx
+     9f8:	68 ec 72 00 00       	push   $0x72ec
+     9fd:	68 ad 4c 00 00       	push   $0x4cad
+     a02:	e8 14 3d 00 00       	call   471b <exec>
+     a07:	83 c4 10             	add    $0x10,%esp
+     a0a:	85 c0                	test   %eax,%eax
+     a0c:	78 02                	js     a10 <exectest+0x30>
+}
+     a0e:	c9                   	leave
+     a0f:	c3                   	ret
+    printf(stdout, "exec echo failed\n");
+     a10:	50                   	push   %eax
+     a11:	50                   	push   %eax
+     a12:	68 ef 4e 00 00       	push   $0x4eef
+     a17:	ff 35 e8 72 00 00    	push   0x72e8
+     a1d:	e8 7e 3e 00 00       	call   48a0 <printf>
+    exit();
+     a22:	e8 bc 3c 00 00       	call   46e3 <exit>
+     a27:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     a2e:	66 90                	xchg   %ax,%ax
+
+00000a30 <pipe1>:
+{
+     a30:	55                   	push   %ebp
+     a31:	89 e5                	mov    %esp,%ebp
+     a33:	57                   	push   %edi
+     a34:	56                   	push   %esi
+  if(pipe(fds) != 0){
+     a35:	8d 45 e0             	lea    -0x20(%ebp),%eax
+{
+     a38:	53                   	push   %ebx
+     a39:	83 ec 28             	sub    $0x28,%esp
+  if(pipe(fds) != 0){
+     a3c:	50                   	push   %eax
+     a3d:	e8 b1 3c 00 00       	call   46f3 <pipe>
+     a42:	83 c4 10             	add    $0x10,%esp
+     a45:	85 c0                	test   %eax,%eax
+     a47:	0f 85 41 01 00 00    	jne    b8e <pipe1+0x15e>
+     a4d:	89 c6                	mov    %eax,%esi
+  pid = fork();
+     a4f:	e8 87 3c 00 00       	call   46db <fork>
+  if(pid == 0){
+     a54:	85 c0                	test   %eax,%eax
+     a56:	0f 84 92 00 00 00    	je     aee <pipe1+0xbe>
+  } else if(pid > 0){
+     a5c:	0f 8e 3f 01 00 00    	jle    ba1 <pipe1+0x171>
+    close(fds[1]);
+     a62:	83 ec 0c             	sub    $0xc,%esp
+     a65:	ff 75 e4             	push   -0x1c(%ebp)
+    total = 0;
+     a68:	31 db                	xor    %ebx,%ebx
+    cc = 1;
+     a6a:	bf 01 00 00 00       	mov    $0x1,%edi
+    close(fds[1]);
+     a6f:	e8 97 3c 00 00       	call   470b <close>
+    while((n = read(fds[0], buf, cc)) > 0){
+     a74:	83 c4 10             	add    $0x10,%esp
+     a77:	83 ec 04             	sub    $0x4,%esp
+     a7a:	57                   	push   %edi
+     a7b:	68 20 9a 00 00       	push   $0x9a20
+     a80:	ff 75 e0             	push   -0x20(%ebp)
+     a83:	e8 73 3c 00 00       	call   46fb <read>
+     a88:	83 c4 10             	add    $0x10,%esp
+     a8b:	89 c1                	mov    %eax,%ecx
+     a8d:	85 c0                	test   %eax,%eax
+     a8f:	0f 8e b8 00 00 00    	jle    b4d <pipe1+0x11d>
+        if((buf[i] & 0xff) != (seq++ & 0xff)){
+     a95:	89 f0                	mov    %esi,%eax
+     a97:	32 05 20 9a 00 00    	xor    0x9a20,%al
+     a9d:	0f b6 c0             	movzbl %al,%eax
+     aa0:	85 c0                	test   %eax,%eax
+     aa2:	75 30                	jne    ad4 <pipe1+0xa4>
+     aa4:	83 c6 01             	add    $0x1,%esi
+     aa7:	eb 0f                	jmp    ab8 <pipe1+0x88>
+     aa9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     ab0:	38 90 20 9a 00 00    	cmp    %dl,0x9a20(%eax)
+     ab6:	75 1c                	jne    ad4 <pipe1+0xa4>
+     ab8:	8d 14 06             	lea    (%esi,%eax,1),%edx
+      for(i = 0; i < n; i++){
+     abb:	83 c0 01             	add    $0x1,%eax
+     abe:	39 c1                	cmp    %eax,%ecx
+     ac0:	75 ee                	jne    ab0 <pipe1+0x80>
+      cc = cc * 2;
+     ac2:	01 ff                	add    %edi,%edi
+      if(cc > sizeof(buf))
+     ac4:	b8 00 20 00 00       	mov    $0x2000,%eax
+      total += n;
+     ac9:	01 cb                	add    %ecx,%ebx
+      if(cc > sizeof(buf))
+     acb:	89 d6                	mov    %edx,%esi
+     acd:	39 c7                	cmp    %eax,%edi
+     acf:	0f 4f f8             	cmovg  %eax,%edi
+     ad2:	eb a3                	jmp    a77 <pipe1+0x47>
+          printf(1, "pipe1 oops 2\n");
+     ad4:	83 ec 08             	sub    $0x8,%esp
+     ad7:	68 1e 4f 00 00       	push   $0x4f1e
+     adc:	6a 01                	push   $0x1
+     ade:	e8 bd 3d 00 00       	call   48a0 <printf>
+     ae3:	83 c4 10             	add    $0x10,%esp
+}
+     ae6:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     ae9:	5b                   	pop    %ebx
+     aea:	5e                   	pop    %esi
+     aeb:	5f                   	pop    %edi
+     aec:	5d                   	pop    %ebp
+     aed:	c3                   	ret
+    close(fds[0]);
+     aee:	83 ec 0c             	sub    $0xc,%esp
+     af1:	ff 75 e0             	push   -0x20(%ebp)
+  seq = 0;
+     af4:	31 db                	xor    %ebx,%ebx
+    close(fds[0]);
+     af6:	e8 10 3c 00 00       	call   470b <close>
+     afb:	83 c4 10             	add    $0x10,%esp
+     afe:	66 90                	xchg   %ax,%ax
+      for(i = 0; i < 1033; i++)
+     b00:	31 c0                	xor    %eax,%eax
+     b02:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+        buf[i] = seq++;
+     b08:	8d 14 03             	lea    (%ebx,%eax,1),%edx
+      for(i = 0; i < 1033; i++)
+     b0b:	83 c0 01             	add    $0x1,%eax
+        buf[i] = seq++;
+     b0e:	88 90 1f 9a 00 00    	mov    %dl,0x9a1f(%eax)
+      for(i = 0; i < 1033; i++)
+     b14:	3d 09 04 00 00       	cmp    $0x409,%eax
+     b19:	75 ed                	jne    b08 <pipe1+0xd8>
+      if(write(fds[1], buf, 1033) != 1033){
+     b1b:	83 ec 04             	sub    $0x4,%esp
+        buf[i] = seq++;
+     b1e:	81 c3 09 04 00 00    	add    $0x409,%ebx
+      if(write(fds[1], buf, 1033) != 1033){
+     b24:	68 09 04 00 00       	push   $0x409
+     b29:	68 20 9a 00 00       	push   $0x9a20
+     b2e:	ff 75 e4             	push   -0x1c(%ebp)
+     b31:	e8 cd 3b 00 00       	call   4703 <write>
+     b36:	83 c4 10             	add    $0x10,%esp
+     b39:	3d 09 04 00 00       	cmp    $0x409,%eax
+     b3e:	75 74                	jne    bb4 <pipe1+0x184>
+    for(n = 0; n < 5; n++){
+     b40:	81 fb 2d 14 00 00    	cmp    $0x142d,%ebx
+     b46:	75 b8                	jne    b00 <pipe1+0xd0>
+    exit();
+     b48:	e8 96 3b 00 00       	call   46e3 <exit>
+    if(total != 5 * 1033){
+     b4d:	81 fb 2d 14 00 00    	cmp    $0x142d,%ebx
+     b53:	75 26                	jne    b7b <pipe1+0x14b>
+    close(fds[0]);
+     b55:	83 ec 0c             	sub    $0xc,%esp
+     b58:	ff 75 e0             	push   -0x20(%ebp)
+     b5b:	e8 ab 3b 00 00       	call   470b <close>
+    wait();
+     b60:	e8 86 3b 00 00       	call   46eb <wait>
+  printf(1, "pipe1 ok\n");
+     b65:	5a                   	pop    %edx
+     b66:	59                   	pop    %ecx
+     b67:	68 43 4f 00 00       	push   $0x4f43
+     b6c:	6a 01                	push   $0x1
+     b6e:	e8 2d 3d 00 00       	call   48a0 <printf>
+     b73:	83 c4 10             	add    $0x10,%esp
+     b76:	e9 6b ff ff ff       	jmp    ae6 <pipe1+0xb6>
+      printf(1, "pipe1 oops 3 total %d\n", total);
+     b7b:	56                   	push   %esi
+     b7c:	53                   	push   %ebx
+     b7d:	68 2c 4f 00 00       	push   $0x4f2c
+     b82:	6a 01                	push   $0x1
+     b84:	e8 17 3d 00 00       	call   48a0 <printf>
+      exit();
+     b89:	e8 55 3b 00 00       	call   46e3 <exit>
+    printf(1, "pipe() failed\n");
+     b8e:	50                   	push   %eax
+     b8f:	50                   	push   %eax
+     b90:	68 01 4f 00 00       	push   $0x4f01
+     b95:	6a 01                	push   $0x1
+     b97:	e8 04 3d 00 00       	call   48a0 <printf>
+    exit();
+     b9c:	e8 42 3b 00 00       	call   46e3 <exit>
+    printf(1, "fork() failed\n");
+     ba1:	50                   	push   %eax
+     ba2:	50                   	push   %eax
+     ba3:	68 4d 4f 00 00       	push   $0x4f4d
+     ba8:	6a 01                	push   $0x1
+     baa:	e8 f1 3c 00 00       	call   48a0 <printf>
+    exit();
+     baf:	e8 2f 3b 00 00       	call   46e3 <exit>
+        printf(1, "pipe1 oops 1\n");
+     bb4:	57                   	push   %edi
+     bb5:	57                   	push   %edi
+     bb6:	68 10 4f 00 00       	push   $0x4f10
+     bbb:	6a 01                	push   $0x1
+     bbd:	e8 de 3c 00 00       	call   48a0 <printf>
+        exit();
+     bc2:	e8 1c 3b 00 00       	call   46e3 <exit>
+     bc7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     bce:	66 90                	xchg   %ax,%ax
+
+00000bd0 <preempt>:
+{
+     bd0:	55                   	push   %ebp
+     bd1:	89 e5                	mov    %esp,%ebp
+     bd3:	57                   	push   %edi
+     bd4:	56                   	push   %esi
+     bd5:	53                   	push   %ebx
+     bd6:	83 ec 24             	sub    $0x24,%esp
+  printf(1, "preempt: ");
+     bd9:	68 5c 4f 00 00       	push   $0x4f5c
+     bde:	6a 01                	push   $0x1
+     be0:	e8 bb 3c 00 00       	call   48a0 <printf>
+  pid1 = fork();
+     be5:	e8 f1 3a 00 00       	call   46db <fork>
+  if(pid1 == 0)
+     bea:	83 c4 10             	add    $0x10,%esp
+     bed:	85 c0                	test   %eax,%eax
+     bef:	75 07                	jne    bf8 <preempt+0x28>
+    for(;;)
+     bf1:	eb fe                	jmp    bf1 <preempt+0x21>
+     bf3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     bf7:	90                   	nop
+     bf8:	89 c3                	mov    %eax,%ebx
+  pid2 = fork();
+     bfa:	e8 dc 3a 00 00       	call   46db <fork>
+     bff:	89 c6                	mov    %eax,%esi
+  if(pid2 == 0)
+     c01:	85 c0                	test   %eax,%eax
+     c03:	75 0b                	jne    c10 <preempt+0x40>
+    for(;;)
+     c05:	eb fe                	jmp    c05 <preempt+0x35>
+     c07:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     c0e:	66 90                	xchg   %ax,%ax
+  pipe(pfds);
+     c10:	83 ec 0c             	sub    $0xc,%esp
+     c13:	8d 45 e0             	lea    -0x20(%ebp),%eax
+     c16:	50                   	push   %eax
+     c17:	e8 d7 3a 00 00       	call   46f3 <pipe>
+  pid3 = fork();
+     c1c:	e8 ba 3a 00 00       	call   46db <fork>
+  if(pid3 == 0){
+     c21:	83 c4 10             	add    $0x10,%esp
+  pid3 = fork();
+     c24:	89 c7                	mov    %eax,%edi
+  if(pid3 == 0){
+     c26:	85 c0                	test   %eax,%eax
+     c28:	75 3e                	jne    c68 <preempt+0x98>
+    close(pfds[0]);
+     c2a:	83 ec 0c             	sub    $0xc,%esp
+     c2d:	ff 75 e0             	push   -0x20(%ebp)
+     c30:	e8 d6 3a 00 00       	call   470b <close>
+    if(write(pfds[1], "x", 1) != 1)
+     c35:	83 c4 0c             	add    $0xc,%esp
+     c38:	6a 01                	push   $0x1
+     c3a:	68 be 57 00 00       	push   $0x57be
+     c3f:	ff 75 e4             	push   -0x1c(%ebp)
+     c42:	e8 bc 3a 00 00       	call   4703 <write>
+     c47:	83 c4 10             	add    $0x10,%esp
+     c4a:	83 f8 01             	cmp    $0x1,%eax
+     c4d:	0f 85 b8 00 00 00    	jne    d0b <preempt+0x13b>
+    close(pfds[1]);
+     c53:	83 ec 0c             	sub    $0xc,%esp
+     c56:	ff 75 e4             	push   -0x1c(%ebp)
+     c59:	e8 ad 3a 00 00       	call   470b <close>
+     c5e:	83 c4 10             	add    $0x10,%esp
+    for(;;)
+     c61:	eb fe                	jmp    c61 <preempt+0x91>
+     c63:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     c67:	90                   	nop
+  close(pfds[1]);
+     c68:	83 ec 0c             	sub    $0xc,%esp
+     c6b:	ff 75 e4             	push   -0x1c(%ebp)
+     c6e:	e8 98 3a 00 00       	call   470b <close>
+  if(read(pfds[0], buf, sizeof(buf)) != 1){
+     c73:	83 c4 0c             	add    $0xc,%esp
+     c76:	68 00 20 00 00       	push   $0x2000
+     c7b:	68 20 9a 00 00       	push   $0x9a20
+     c80:	ff 75 e0             	push   -0x20(%ebp)
+     c83:	e8 73 3a 00 00       	call   46fb <read>
+     c88:	83 c4 10             	add    $0x10,%esp
+     c8b:	83 f8 01             	cmp    $0x1,%eax
+     c8e:	75 67                	jne    cf7 <preempt+0x127>
+  close(pfds[0]);
+     c90:	83 ec 0c             	sub    $0xc,%esp
+     c93:	ff 75 e0             	push   -0x20(%ebp)
+     c96:	e8 70 3a 00 00       	call   470b <close>
+  printf(1, "kill... ");
+     c9b:	58                   	pop    %eax
+     c9c:	5a                   	pop    %edx
+     c9d:	68 8d 4f 00 00       	push   $0x4f8d
+     ca2:	6a 01                	push   $0x1
+     ca4:	e8 f7 3b 00 00       	call   48a0 <printf>
+  kill(pid1);
+     ca9:	89 1c 24             	mov    %ebx,(%esp)
+     cac:	e8 62 3a 00 00       	call   4713 <kill>
+  kill(pid2);
+     cb1:	89 34 24             	mov    %esi,(%esp)
+     cb4:	e8 5a 3a 00 00       	call   4713 <kill>
+  kill(pid3);
+     cb9:	89 3c 24             	mov    %edi,(%esp)
+     cbc:	e8 52 3a 00 00       	call   4713 <kill>
+  printf(1, "wait... ");
+     cc1:	59                   	pop    %ecx
+     cc2:	5b                   	pop    %ebx
+     cc3:	68 96 4f 00 00       	push   $0x4f96
+     cc8:	6a 01                	push   $0x1
+     cca:	e8 d1 3b 00 00       	call   48a0 <printf>
+  wait();
+     ccf:	e8 17 3a 00 00       	call   46eb <wait>
+  wait();
+     cd4:	e8 12 3a 00 00       	call   46eb <wait>
+  wait();
+     cd9:	e8 0d 3a 00 00       	call   46eb <wait>
+  printf(1, "preempt ok\n");
+     cde:	5e                   	pop    %esi
+     cdf:	5f                   	pop    %edi
+     ce0:	68 9f 4f 00 00       	push   $0x4f9f
+     ce5:	6a 01                	push   $0x1
+     ce7:	e8 b4 3b 00 00       	call   48a0 <printf>
+     cec:	83 c4 10             	add    $0x10,%esp
+}
+     cef:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     cf2:	5b                   	pop    %ebx
+     cf3:	5e                   	pop    %esi
+     cf4:	5f                   	pop    %edi
+     cf5:	5d                   	pop    %ebp
+     cf6:	c3                   	ret
+    printf(1, "preempt read error");
+     cf7:	83 ec 08             	sub    $0x8,%esp
+     cfa:	68 7a 4f 00 00       	push   $0x4f7a
+     cff:	6a 01                	push   $0x1
+     d01:	e8 9a 3b 00 00       	call   48a0 <printf>
+     d06:	83 c4 10             	add    $0x10,%esp
+     d09:	eb e4                	jmp    cef <preempt+0x11f>
+      printf(1, "preempt write error");
+     d0b:	83 ec 08             	sub    $0x8,%esp
+     d0e:	68 66 4f 00 00       	push   $0x4f66
+     d13:	6a 01                	push   $0x1
+     d15:	e8 86 3b 00 00       	call   48a0 <printf>
+     d1a:	83 c4 10             	add    $0x10,%esp
+     d1d:	e9 31 ff ff ff       	jmp    c53 <preempt+0x83>
+     d22:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     d29:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000d30 <exitwait>:
+{
+     d30:	55                   	push   %ebp
+     d31:	89 e5                	mov    %esp,%ebp
+     d33:	56                   	push   %esi
+     d34:	be 64 00 00 00       	mov    $0x64,%esi
+     d39:	53                   	push   %ebx
+     d3a:	eb 14                	jmp    d50 <exitwait+0x20>
+     d3c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    if(pid){
+     d40:	74 68                	je     daa <exitwait+0x7a>
+      if(wait() != pid){
+     d42:	e8 a4 39 00 00       	call   46eb <wait>
+     d47:	39 d8                	cmp    %ebx,%eax
+     d49:	75 2d                	jne    d78 <exitwait+0x48>
+  for(i = 0; i < 100; i++){
+     d4b:	83 ee 01             	sub    $0x1,%esi
+     d4e:	74 41                	je     d91 <exitwait+0x61>
+    pid = fork();
+     d50:	e8 86 39 00 00       	call   46db <fork>
+     d55:	89 c3                	mov    %eax,%ebx
+    if(pid < 0){
+     d57:	85 c0                	test   %eax,%eax
+     d59:	79 e5                	jns    d40 <exitwait+0x10>
+      printf(1, "fork failed\n");
+     d5b:	83 ec 08             	sub    $0x8,%esp
+     d5e:	68 a6 5d 00 00       	push   $0x5da6
+     d63:	6a 01                	push   $0x1
+     d65:	e8 36 3b 00 00       	call   48a0 <printf>
+      return;
+     d6a:	83 c4 10             	add    $0x10,%esp
+}
+     d6d:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     d70:	5b                   	pop    %ebx
+     d71:	5e                   	pop    %esi
+     d72:	5d                   	pop    %ebp
+     d73:	c3                   	ret
+     d74:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+        printf(1, "wait wrong pid\n");
+     d78:	83 ec 08             	sub    $0x8,%esp
+     d7b:	68 ab 4f 00 00       	push   $0x4fab
+     d80:	6a 01                	push   $0x1
+     d82:	e8 19 3b 00 00       	call   48a0 <printf>
+        return;
+     d87:	83 c4 10             	add    $0x10,%esp
+}
+     d8a:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     d8d:	5b                   	pop    %ebx
+     d8e:	5e                   	pop    %esi
+     d8f:	5d                   	pop    %ebp
+     d90:	c3                   	ret
+  printf(1, "exitwait ok\n");
+     d91:	83 ec 08             	sub    $0x8,%esp
+     d94:	68 bb 4f 00 00       	push   $0x4fbb
+     d99:	6a 01                	push   $0x1
+     d9b:	e8 00 3b 00 00       	call   48a0 <printf>
+     da0:	83 c4 10             	add    $0x10,%esp
+}
+     da3:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     da6:	5b                   	pop    %ebx
+     da7:	5e                   	pop    %esi
+     da8:	5d                   	pop    %ebp
+     da9:	c3                   	ret
+      exit();
+     daa:	e8 34 39 00 00       	call   46e3 <exit>
+     daf:	90                   	nop
+
+00000db0 <spinwork>:
+{
+     db0:	55                   	push   %ebp
+     db1:	89 e5                	mov    %esp,%ebp
+     db3:	56                   	push   %esi
+     db4:	53                   	push   %ebx
+  pipe(fds);
+     db5:	8d 45 f0             	lea    -0x10(%ebp),%eax
+{
+     db8:	83 ec 1c             	sub    $0x1c,%esp
+  pipe(fds);
+     dbb:	50                   	push   %eax
+     dbc:	e8 32 39 00 00       	call   46f3 <pipe>
+  pid = fork();
+     dc1:	e8 15 39 00 00       	call   46db <fork>
+  if(pid < 0){
+     dc6:	83 c4 10             	add    $0x10,%esp
+     dc9:	85 c0                	test   %eax,%eax
+     dcb:	78 47                	js     e14 <spinwork+0x64>
+  if(pid == 0){
+     dcd:	74 6b                	je     e3a <spinwork+0x8a>
+  close(fds[1]);
+     dcf:	83 ec 0c             	sub    $0xc,%esp
+     dd2:	ff 75 f4             	push   -0xc(%ebp)
+     dd5:	e8 31 39 00 00       	call   470b <close>
+  if(read(fds[0], &count, sizeof(count)) != sizeof(count)){
+     dda:	83 c4 0c             	add    $0xc,%esp
+     ddd:	8d 45 ec             	lea    -0x14(%ebp),%eax
+  count = 0;
+     de0:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%ebp)
+  if(read(fds[0], &count, sizeof(count)) != sizeof(count)){
+     de7:	6a 04                	push   $0x4
+     de9:	50                   	push   %eax
+     dea:	ff 75 f0             	push   -0x10(%ebp)
+     ded:	e8 09 39 00 00       	call   46fb <read>
+     df2:	83 c4 10             	add    $0x10,%esp
+     df5:	83 f8 04             	cmp    $0x4,%eax
+     df8:	75 2d                	jne    e27 <spinwork+0x77>
+  close(fds[0]);
+     dfa:	83 ec 0c             	sub    $0xc,%esp
+     dfd:	ff 75 f0             	push   -0x10(%ebp)
+     e00:	e8 06 39 00 00       	call   470b <close>
+  wait();
+     e05:	e8 e1 38 00 00       	call   46eb <wait>
+}
+     e0a:	8b 45 ec             	mov    -0x14(%ebp),%eax
+     e0d:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     e10:	5b                   	pop    %ebx
+     e11:	5e                   	pop    %esi
+     e12:	5d                   	pop    %ebp
+     e13:	c3                   	ret
+    printf(1, "fork failed\n");
+     e14:	51                   	push   %ecx
+     e15:	51                   	push   %ecx
+     e16:	68 a6 5d 00 00       	push   $0x5da6
+     e1b:	6a 01                	push   $0x1
+     e1d:	e8 7e 3a 00 00       	call   48a0 <printf>
+    exit();
+     e22:	e8 bc 38 00 00       	call   46e3 <exit>
+    printf(1, "spinwork read failed\n");
+     e27:	50                   	push   %eax
+     e28:	50                   	push   %eax
+     e29:	68 c8 4f 00 00       	push   $0x4fc8
+     e2e:	6a 01                	push   $0x1
+     e30:	e8 6b 3a 00 00       	call   48a0 <printf>
+    exit();
+     e35:	e8 a9 38 00 00       	call   46e3 <exit>
+    close(fds[0]);
+     e3a:	83 ec 0c             	sub    $0xc,%esp
+     e3d:	ff 75 f0             	push   -0x10(%ebp)
+     e40:	89 c3                	mov    %eax,%ebx
+     e42:	e8 c4 38 00 00       	call   470b <close>
+    end = uptime() + n;
+     e47:	e8 2f 39 00 00       	call   477b <uptime>
+     e4c:	03 45 08             	add    0x8(%ebp),%eax
+    for(count = 0; uptime() < end; count++)
+     e4f:	83 c4 10             	add    $0x10,%esp
+    end = uptime() + n;
+     e52:	89 c6                	mov    %eax,%esi
+    for(count = 0; uptime() < end; count++)
+     e54:	eb 06                	jmp    e5c <spinwork+0xac>
+     e56:	8b 45 ec             	mov    -0x14(%ebp),%eax
+     e59:	8d 58 01             	lea    0x1(%eax),%ebx
+     e5c:	89 5d ec             	mov    %ebx,-0x14(%ebp)
+     e5f:	e8 17 39 00 00       	call   477b <uptime>
+     e64:	39 f0                	cmp    %esi,%eax
+     e66:	72 ee                	jb     e56 <spinwork+0xa6>
+    write(fds[1], &count, sizeof(count));
+     e68:	8d 45 ec             	lea    -0x14(%ebp),%eax
+     e6b:	52                   	push   %edx
+     e6c:	6a 04                	push   $0x4
+     e6e:	50                   	push   %eax
+     e6f:	ff 75 f4             	push   -0xc(%ebp)
+     e72:	e8 8c 38 00 00       	call   4703 <write>
+    exit();
+     e77:	e8 67 38 00 00       	call   46e3 <exit>
+     e7c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000e80 <dutytest>:
+{
+     e80:	55                   	push   %ebp
+     e81:	89 e5                	mov    %esp,%ebp
+     e83:	56                   	push   %esi
+     e84:	53                   	push   %ebx
+     e85:	83 ec 18             	sub    $0x18,%esp
+  printf(1, "duty test\n");
+     e88:	68 de 4f 00 00       	push   $0x4fde
+     e8d:	6a 01                	push   $0x1
+     e8f:	e8 0c 3a 00 00       	call   48a0 <printf>
+  if(sysctl(-1, "load_period", &period, 0) < 0 ||
+     e94:	8d 45 f0             	lea    -0x10(%ebp),%eax
+     e97:	6a 00                	push   $0x0
+     e99:	50                   	push   %eax
+     e9a:	68 e9 4f 00 00       	push   $0x4fe9
+     e9f:	6a ff                	push   $0xffffffff
+     ea1:	e8 05 39 00 00       	call   47ab <sysctl>
+     ea6:	83 c4 20             	add    $0x20,%esp
+     ea9:	85 c0                	test   %eax,%eax
+     eab:	0f 88 22 01 00 00    	js     fd3 <dutytest+0x153>
+     sysctl(-1, "duty_low", &duty, 0) < 0){
+     eb1:	8d 45 f4             	lea    -0xc(%ebp),%eax
+     eb4:	6a 00                	push   $0x0
+     eb6:	50                   	push   %eax
+     eb7:	68 04 50 00 00       	push   $0x5004
+     ebc:	6a ff                	push   $0xffffffff
+     ebe:	e8 e8 38 00 00       	call   47ab <sysctl>
+  if(sysctl(-1, "load_period", &period, 0) < 0 ||
+     ec3:	83 c4 10             	add    $0x10,%esp
+     ec6:	85 c0                	test   %eax,%eax
+     ec8:	0f 88 05 01 00 00    	js     fd3 <dutytest+0x153>
+  setgovernor(-1, 1);
+     ece:	83 ec 08             	sub    $0x8,%esp
+     ed1:	6a 01                	push   $0x1
+     ed3:	6a ff                	push   $0xffffffff
+     ed5:	e8 c9 38 00 00       	call   47a3 <setgovernor>
+  sleep(2 * period);              // levels change once per period
+     eda:	8b 45 f0             	mov    -0x10(%ebp),%eax
+     edd:	01 c0                	add    %eax,%eax
+     edf:	89 04 24             	mov    %eax,(%esp)
+     ee2:	e8 8c 38 00 00       	call   4773 <sleep>
+  high = spinwork(200);
+     ee7:	c7 04 24 c8 00 00 00 	movl   $0xc8,(%esp)
+     eee:	e8 bd fe ff ff       	call   db0 <spinwork>
+     ef3:	89 c3                	mov    %eax,%ebx
+  setgovernor(-1, 2);
+     ef5:	58                   	pop    %eax
+     ef6:	5a                   	pop    %edx
+     ef7:	6a 02                	push   $0x2
+     ef9:	6a ff                	push   $0xffffffff
+     efb:	e8 a3 38 00 00       	call   47a3 <setgovernor>
+  sleep(2 * period);
+     f00:	8b 45 f0             	mov    -0x10(%ebp),%eax
+     f03:	01 c0                	add    %eax,%eax
+     f05:	89 04 24             	mov    %eax,(%esp)
+     f08:	e8 66 38 00 00       	call   4773 <sleep>
+  low = spinwork(200);
+     f0d:	c7 04 24 c8 00 00 00 	movl   $0xc8,(%esp)
+     f14:	e8 97 fe ff ff       	call   db0 <spinwork>
+  pct = high >= 100 ? low / (high / 100) : 0;
+     f19:	83 c4 10             	add    $0x10,%esp
+  low = spinwork(200);
+     f1c:	89 c6                	mov    %eax,%esi
+  pct = high >= 100 ? low / (high / 100) : 0;
+     f1e:	31 c0                	xor    %eax,%eax
+     f20:	83 fb 63             	cmp    $0x63,%ebx
+     f23:	7f 2b                	jg     f50 <dutytest+0xd0>
+  if(pct < duty - 15 || pct > duty + 15){
+     f25:	8b 55 f4             	mov    -0xc(%ebp),%edx
+     f28:	8d 4a f1             	lea    -0xf(%edx),%ecx
+     f2b:	39 c1                	cmp    %eax,%ecx
+     f2d:	0f 8f b3 00 00 00    	jg     fe6 <dutytest+0x166>
+     f33:	8d 4a 0f             	lea    0xf(%edx),%ecx
+     f36:	39 c1                	cmp    %eax,%ecx
+     f38:	0f 8c a8 00 00 00    	jl     fe6 <dutytest+0x166>
+  pid = fork();
+     f3e:	e8 98 37 00 00       	call   46db <fork>
+     f43:	89 c3                	mov    %eax,%ebx
+  if(pid == 0)
+     f45:	85 c0                	test   %eax,%eax
+     f47:	75 1f                	jne    f68 <dutytest+0xe8>
+    for(;;)
+     f49:	eb fe                	jmp    f49 <dutytest+0xc9>
+     f4b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     f4f:	90                   	nop
+  pct = high >= 100 ? low / (high / 100) : 0;
+     f50:	b8 1f 85 eb 51       	mov    $0x51eb851f,%eax
+     f55:	f7 eb                	imul   %ebx
+     f57:	89 f0                	mov    %esi,%eax
+     f59:	c1 fb 1f             	sar    $0x1f,%ebx
+     f5c:	c1 fa 05             	sar    $0x5,%edx
+     f5f:	89 d1                	mov    %edx,%ecx
+     f61:	99                   	cltd
+     f62:	29 d9                	sub    %ebx,%ecx
+     f64:	f7 f9                	idiv   %ecx
+     f66:	eb bd                	jmp    f25 <dutytest+0xa5>
+  sleep(20);
+     f68:	83 ec 0c             	sub    $0xc,%esp
+     f6b:	6a 14                	push   $0x14
+     f6d:	e8 01 38 00 00       	call   4773 <sleep>
+  t0 = uptime();
+     f72:	e8 04 38 00 00       	call   477b <uptime>
+  kill(pid);
+     f77:	89 1c 24             	mov    %ebx,(%esp)
+  t0 = uptime();
+     f7a:	89 c6                	mov    %eax,%esi
+  kill(pid);
+     f7c:	e8 92 37 00 00       	call   4713 <kill>
+  wait();
+     f81:	e8 65 37 00 00       	call   46eb <wait>
+  setgovernor(-1, 0);
+     f86:	59                   	pop    %ecx
+     f87:	5b                   	pop    %ebx
+     f88:	6a 00                	push   $0x0
+     f8a:	6a ff                	push   $0xffffffff
+     f8c:	e8 12 38 00 00       	call   47a3 <setgovernor>
+  if(uptime() - t0 > 50){
+     f91:	e8 e5 37 00 00       	call   477b <uptime>
+     f96:	83 c4 10             	add    $0x10,%esp
+     f99:	29 f0                	sub    %esi,%eax
+     f9b:	83 f8 32             	cmp    $0x32,%eax
+     f9e:	7f 19                	jg     fb9 <dutytest+0x139>
+  printf(1, "duty test ok\n");
+     fa0:	83 ec 08             	sub    $0x8,%esp
+     fa3:	68 0d 50 00 00       	push   $0x500d
+     fa8:	6a 01                	push   $0x1
+     faa:	e8 f1 38 00 00       	call   48a0 <printf>
+}
+     faf:	83 c4 10             	add    $0x10,%esp
+     fb2:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     fb5:	5b                   	pop    %ebx
+     fb6:	5e                   	pop    %esi
+     fb7:	5d                   	pop    %ebp
+     fb8:	c3                   	ret
+    printf(1, "stalled spinner took %d ticks to die\n", uptime() - t0);
+     fb9:	e8 bd 37 00 00       	call   477b <uptime>
+     fbe:	29 f0                	sub    %esi,%eax
+     fc0:	52                   	push   %edx
+     fc1:	50                   	push   %eax
+     fc2:	68 9c 5f 00 00       	push   $0x5f9c
+     fc7:	6a 01                	push   $0x1
+     fc9:	e8 d2 38 00 00       	call   48a0 <printf>
+    exit();
+     fce:	e8 10 37 00 00       	call   46e3 <exit>
+    printf(1, "sysctl failed\n");
+     fd3:	51                   	push   %ecx
+     fd4:	51                   	push   %ecx
+     fd5:	68 f5 4f 00 00       	push   $0x4ff5
+     fda:	6a 01                	push   $0x1
+     fdc:	e8 bf 38 00 00       	call   48a0 <printf>
+    exit();
+     fe1:	e8 fd 36 00 00       	call   46e3 <exit>
+    printf(1, "spinner at LOW did %d%% of HIGH's work, want %d%%\n",
+     fe6:	52                   	push   %edx
+     fe7:	50                   	push   %eax
+     fe8:	68 68 5f 00 00       	push   $0x5f68
+     fed:	6a 01                	push   $0x1
+     fef:	e8 ac 38 00 00       	call   48a0 <printf>
+    setgovernor(-1, 0);
+     ff4:	5e                   	pop    %esi
+     ff5:	58                   	pop    %eax
+     ff6:	6a 00                	push   $0x0
+     ff8:	6a ff                	push   $0xffffffff
+     ffa:	e8 a4 37 00 00       	call   47a3 <setgovernor>
+    exit();
+     fff:	e8 df 36 00 00       	call   46e3 <exit>
+    1004:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    100b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    100f:	90                   	nop
+
+00001010 <sysctltest>:
+{
+    1010:	55                   	push   %ebp
+    1011:	89 e5                	mov    %esp,%ebp
+    1013:	53                   	push   %ebx
+    1014:	83 ec 1c             	sub    $0x1c,%esp
+  printf(1, "sysctl test\n");
+    1017:	68 1b 50 00 00       	push   $0x501b
+    101c:	6a 01                	push   $0x1
+    101e:	e8 7d 38 00 00       	call   48a0 <printf>
+  if(sysctl(-1, "thresh_low_med", &low, 0) < 0 ||
+    1023:	8d 45 e8             	lea    -0x18(%ebp),%eax
+    1026:	6a 00                	push   $0x0
+    1028:	50                   	push   %eax
+    1029:	68 28 50 00 00       	push   $0x5028
+    102e:	6a ff                	push   $0xffffffff
+    1030:	e8 76 37 00 00       	call   47ab <sysctl>
+    1035:	83 c4 20             	add    $0x20,%esp
+    1038:	85 c0                	test   %eax,%eax
+    103a:	0f 88 b2 00 00 00    	js     10f2 <sysctltest+0xe2>
+     sysctl(-1, "thresh_med_high", &high, 0) < 0){
+    1040:	8d 45 ec             	lea    -0x14(%ebp),%eax
+    1043:	6a 00                	push   $0x0
+    1045:	50                   	push   %eax
+    1046:	68 4b 50 00 00       	push   $0x504b
+    104b:	6a ff                	push   $0xffffffff
+    104d:	e8 59 37 00 00       	call   47ab <sysctl>
+  if(sysctl(-1, "thresh_low_med", &low, 0) < 0 ||
+    1052:	83 c4 10             	add    $0x10,%esp
+    1055:	85 c0                	test   %eax,%eax
+    1057:	0f 88 95 00 00 00    	js     10f2 <sysctltest+0xe2>
+  if(sysctl(-1, "thresh_low_med", 0, &bad) >= 0){
+    105d:	8d 5d f4             	lea    -0xc(%ebp),%ebx
+  bad = 101;
+    1060:	c7 45 f4 65 00 00 00 	movl   $0x65,-0xc(%ebp)
+  if(sysctl(-1, "thresh_low_med", 0, &bad) >= 0){
+    1067:	53                   	push   %ebx
+    1068:	6a 00                	push   $0x0
+    106a:	68 28 50 00 00       	push   $0x5028
+    106f:	6a ff                	push   $0xffffffff
+    1071:	e8 35 37 00 00       	call   47ab <sysctl>
+    1076:	83 c4 10             	add    $0x10,%esp
+    1079:	85 c0                	test   %eax,%eax
+    107b:	0f 89 c3 00 00 00    	jns    1144 <sysctltest+0x134>
+  bad = high + 1;
+    1081:	8b 45 ec             	mov    -0x14(%ebp),%eax
+    1084:	83 c0 01             	add    $0x1,%eax
+    1087:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  if(sysctl(-1, "thresh_low_med", 0, &bad) >= 0){
+    108a:	53                   	push   %ebx
+    108b:	6a 00                	push   $0x0
+    108d:	68 28 50 00 00       	push   $0x5028
+    1092:	6a ff                	push   $0xffffffff
+    1094:	e8 12 37 00 00       	call   47ab <sysctl>
+    1099:	83 c4 10             	add    $0x10,%esp
+    109c:	85 c0                	test   %eax,%eax
+    109e:	0f 89 89 00 00 00    	jns    112d <sysctltest+0x11d>
+  if(sysctl(-1, "thresh_low_med", &v, 0) < 0 || v != low){
+    10a4:	8d 5d f0             	lea    -0x10(%ebp),%ebx
+    10a7:	6a 00                	push   $0x0
+    10a9:	53                   	push   %ebx
+    10aa:	68 28 50 00 00       	push   $0x5028
+    10af:	6a ff                	push   $0xffffffff
+    10b1:	e8 f5 36 00 00       	call   47ab <sysctl>
+    10b6:	83 c4 10             	add    $0x10,%esp
+    10b9:	85 c0                	test   %eax,%eax
+    10bb:	78 48                	js     1105 <sysctltest+0xf5>
+    10bd:	8b 45 e8             	mov    -0x18(%ebp),%eax
+    10c0:	39 45 f0             	cmp    %eax,-0x10(%ebp)
+    10c3:	75 40                	jne    1105 <sysctltest+0xf5>
+  if(sysctl(-1, "no_such_tunable", &v, 0) >= 0){
+    10c5:	6a 00                	push   $0x0
+    10c7:	53                   	push   %ebx
+    10c8:	68 5b 50 00 00       	push   $0x505b
+    10cd:	6a ff                	push   $0xffffffff
+    10cf:	e8 d7 36 00 00       	call   47ab <sysctl>
+    10d4:	83 c4 10             	add    $0x10,%esp
+    10d7:	85 c0                	test   %eax,%eax
+    10d9:	79 3f                	jns    111a <sysctltest+0x10a>
+  printf(1, "sysctl test ok\n");
+    10db:	83 ec 08             	sub    $0x8,%esp
+    10de:	68 89 50 00 00       	push   $0x5089
+    10e3:	6a 01                	push   $0x1
+    10e5:	e8 b6 37 00 00       	call   48a0 <printf>
+}
+    10ea:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    10ed:	83 c4 10             	add    $0x10,%esp
+    10f0:	c9                   	leave
+    10f1:	c3                   	ret
+    printf(1, "sysctl read failed\n");
+    10f2:	53                   	push   %ebx
+    10f3:	53                   	push   %ebx
+    10f4:	68 37 50 00 00       	push   $0x5037
+    10f9:	6a 01                	push   $0x1
+    10fb:	e8 a0 37 00 00       	call   48a0 <printf>
+    exit();
+    1100:	e8 de 35 00 00       	call   46e3 <exit>
+    printf(1, "rejected sysctl changed thresh_low_med to %d\n", v);
+    1105:	52                   	push   %edx
+    1106:	ff 75 f0             	push   -0x10(%ebp)
+    1109:	68 20 60 00 00       	push   $0x6020
+    110e:	6a 01                	push   $0x1
+    1110:	e8 8b 37 00 00       	call   48a0 <printf>
+    exit();
+    1115:	e8 c9 35 00 00       	call   46e3 <exit>
+    printf(1, "sysctl accepted unknown name\n");
+    111a:	50                   	push   %eax
+    111b:	50                   	push   %eax
+    111c:	68 6b 50 00 00       	push   $0x506b
+    1121:	6a 01                	push   $0x1
+    1123:	e8 78 37 00 00       	call   48a0 <printf>
+    exit();
+    1128:	e8 b6 35 00 00       	call   46e3 <exit>
+    printf(1, "sysctl accepted thresh_low_med %d > thresh_med_high %d\n",
+    112d:	ff 75 ec             	push   -0x14(%ebp)
+    1130:	ff 75 f4             	push   -0xc(%ebp)
+    1133:	68 e8 5f 00 00       	push   $0x5fe8
+    1138:	6a 01                	push   $0x1
+    113a:	e8 61 37 00 00       	call   48a0 <printf>
+    exit();
+    113f:	e8 9f 35 00 00       	call   46e3 <exit>
+    printf(1, "sysctl accepted out-of-range %d\n", bad);
+    1144:	51                   	push   %ecx
+    1145:	ff 75 f4             	push   -0xc(%ebp)
+    1148:	68 c4 5f 00 00       	push   $0x5fc4
+    114d:	6a 01                	push   $0x1
+    114f:	e8 4c 37 00 00       	call   48a0 <printf>
+    exit();
+    1154:	e8 8a 35 00 00       	call   46e3 <exit>
+    1159:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00001160 <telemetrytest>:
+{
+    1160:	55                   	push   %ebp
+    1161:	89 e5                	mov    %esp,%ebp
+    1163:	57                   	push   %edi
+    1164:	56                   	push   %esi
+    1165:	53                   	push   %ebx
+  if(sysctl(-1, "load_period", &old, 0) < 0){
+    1166:	8d 5d b0             	lea    -0x50(%ebp),%ebx
+{
+    1169:	83 ec 54             	sub    $0x54,%esp
+  printf(1, "telemetry test\n");
+    116c:	68 99 50 00 00       	push   $0x5099
+    1171:	6a 01                	push   $0x1
+    1173:	e8 28 37 00 00       	call   48a0 <printf>
+  if(sysctl(-1, "load_period", &old, 0) < 0){
+    1178:	6a 00                	push   $0x0
+    117a:	53                   	push   %ebx
+    117b:	68 e9 4f 00 00       	push   $0x4fe9
+    1180:	6a ff                	push   $0xffffffff
+    1182:	e8 24 36 00 00       	call   47ab <sysctl>
+    1187:	83 c4 20             	add    $0x20,%esp
+    118a:	85 c0                	test   %eax,%eax
+    118c:	0f 88 d4 00 00 00    	js     1266 <telemetrytest+0x106>
+  if(telemetry(&seq, &t, 1) != 1 || t.dropped != 0){
+    1192:	83 ec 04             	sub    $0x4,%esp
+    1195:	8d 7d b8             	lea    -0x48(%ebp),%edi
+    1198:	8d 75 ac             	lea    -0x54(%ebp),%esi
+  seq = 0;
+    119b:	c7 45 ac 00 00 00 00 	movl   $0x0,-0x54(%ebp)
+  if(telemetry(&seq, &t, 1) != 1 || t.dropped != 0){
+    11a2:	6a 01                	push   $0x1
+    11a4:	57                   	push   %edi
+    11a5:	56                   	push   %esi
+    11a6:	e8 08 36 00 00       	call   47b3 <telemetry>
+    11ab:	83 c4 10             	add    $0x10,%esp
+    11ae:	83 f8 01             	cmp    $0x1,%eax
+    11b1:	0f 85 81 00 00 00    	jne    1238 <telemetrytest+0xd8>
+    11b7:	8b 45 bc             	mov    -0x44(%ebp),%eax
+    11ba:	85 c0                	test   %eax,%eax
+    11bc:	75 7a                	jne    1238 <telemetrytest+0xd8>
+  sysctl(-1, "load_period", 0, &period);
+    11be:	8d 45 b4             	lea    -0x4c(%ebp),%eax
+  period = 1;                     // a sample every tick
+    11c1:	c7 45 b4 01 00 00 00 	movl   $0x1,-0x4c(%ebp)
+  sysctl(-1, "load_period", 0, &period);
+    11c8:	50                   	push   %eax
+    11c9:	6a 00                	push   $0x0
+    11cb:	68 e9 4f 00 00       	push   $0x4fe9
+    11d0:	6a ff                	push   $0xffffffff
+    11d2:	e8 d4 35 00 00       	call   47ab <sysctl>
+  sleep(NTELEMETRY + 20);
+    11d7:	c7 04 24 54 00 00 00 	movl   $0x54,(%esp)
+    11de:	e8 90 35 00 00       	call   4773 <sleep>
+  sysctl(-1, "load_period", 0, &old);
+    11e3:	53                   	push   %ebx
+    11e4:	6a 00                	push   $0x0
+    11e6:	68 e9 4f 00 00       	push   $0x4fe9
+    11eb:	6a ff                	push   $0xffffffff
+    11ed:	e8 b9 35 00 00       	call   47ab <sysctl>
+  if(telemetry(&seq, &t, 1) != 1){
+    11f2:	83 c4 1c             	add    $0x1c,%esp
+  last = seq;
+    11f5:	8b 5d ac             	mov    -0x54(%ebp),%ebx
+  if(telemetry(&seq, &t, 1) != 1){
+    11f8:	6a 01                	push   $0x1
+    11fa:	57                   	push   %edi
+    11fb:	56                   	push   %esi
+    11fc:	e8 b2 35 00 00       	call   47b3 <telemetry>
+    1201:	83 c4 10             	add    $0x10,%esp
+    1204:	83 f8 01             	cmp    $0x1,%eax
+    1207:	75 2f                	jne    1238 <telemetrytest+0xd8>
+  if(t.dropped == 0 || t.seq - last != t.dropped + 1){
+    1209:	8b 45 bc             	mov    -0x44(%ebp),%eax
+    120c:	8b 55 b8             	mov    -0x48(%ebp),%edx
+    120f:	85 c0                	test   %eax,%eax
+    1211:	74 39                	je     124c <telemetrytest+0xec>
+    1213:	89 d6                	mov    %edx,%esi
+    1215:	8d 48 01             	lea    0x1(%eax),%ecx
+    1218:	29 de                	sub    %ebx,%esi
+    121a:	39 ce                	cmp    %ecx,%esi
+    121c:	75 2e                	jne    124c <telemetrytest+0xec>
+  printf(1, "telemetry test ok\n");
+    121e:	83 ec 08             	sub    $0x8,%esp
+    1221:	68 db 50 00 00       	push   $0x50db
+    1226:	6a 01                	push   $0x1
+    1228:	e8 73 36 00 00       	call   48a0 <printf>
+}
+    122d:	83 c4 10             	add    $0x10,%esp
+    1230:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    1233:	5b                   	pop    %ebx
+    1234:	5e                   	pop    %esi
+    1235:	5f                   	pop    %edi
+    1236:	5d                   	pop    %ebp
+    1237:	c3                   	ret
+    printf(1, "telemetry read failed\n");
+    1238:	83 ec 08             	sub    $0x8,%esp
+    123b:	68 c4 50 00 00       	push   $0x50c4
+    1240:	6a 01                	push   $0x1
+    1242:	e8 59 36 00 00       	call   48a0 <printf>
+    exit();
+    1247:	e8 97 34 00 00       	call   46e3 <exit>
+    printf(1, "telemetry sample %d after %d reports %d dropped\n",
+    124c:	83 ec 0c             	sub    $0xc,%esp
+    124f:	50                   	push   %eax
+    1250:	53                   	push   %ebx
+    1251:	52                   	push   %edx
+    1252:	68 50 60 00 00       	push   $0x6050
+    1257:	6a 01                	push   $0x1
+    1259:	e8 42 36 00 00       	call   48a0 <printf>
+    exit();
+    125e:	83 c4 20             	add    $0x20,%esp
+    1261:	e8 7d 34 00 00       	call   46e3 <exit>
+    printf(1, "sysctl load_period failed\n");
+    1266:	52                   	push   %edx
+    1267:	52                   	push   %edx
+    1268:	68 a9 50 00 00       	push   $0x50a9
+    126d:	6a 01                	push   $0x1
+    126f:	e8 2c 36 00 00       	call   48a0 <printf>
+    exit();
+    1274:	e8 6a 34 00 00       	call   46e3 <exit>
+    1279:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00001280 <sleeptest>:
+{
+    1280:	55                   	push   %ebp
+    1281:	89 e5                	mov    %esp,%ebp
+    1283:	57                   	push   %edi
+    1284:	56                   	push   %esi
+    1285:	53                   	push   %ebx
+    1286:	83 ec 24             	sub    $0x24,%esp
+  printf(1, "sleep test\n");
+    1289:	68 ee 50 00 00       	push   $0x50ee
+    128e:	6a 01                	push   $0x1
+    1290:	e8 0b 36 00 00       	call   48a0 <printf>
+  if(sysctl(-1, "timer_slack", &old, 0) < 0){
+    1295:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+    1298:	6a 00                	push   $0x0
+    129a:	50                   	push   %eax
+    129b:	68 fa 50 00 00       	push   $0x50fa
+    12a0:	6a ff                	push   $0xffffffff
+    12a2:	e8 04 35 00 00       	call   47ab <sysctl>
+    12a7:	83 c4 20             	add    $0x20,%esp
+    12aa:	85 c0                	test   %eax,%eax
+    12ac:	0f 88 3d 01 00 00    	js     13ef <sleeptest+0x16f>
+  for(slack = 0; slack <= 3; slack += 3){
+    12b2:	c7 45 e0 00 00 00 00 	movl   $0x0,-0x20(%ebp)
+    12b9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    sysctl(-1, "timer_slack", 0, &slack);
+    12c0:	8d 45 e0             	lea    -0x20(%ebp),%eax
+    for(i = 0; i < sizeof(waits)/sizeof(waits[0]); i++){
+    12c3:	31 db                	xor    %ebx,%ebx
+    sysctl(-1, "timer_slack", 0, &slack);
+    12c5:	50                   	push   %eax
+    12c6:	6a 00                	push   $0x0
+    12c8:	68 fa 50 00 00       	push   $0x50fa
+    12cd:	6a ff                	push   $0xffffffff
+    12cf:	e8 d7 34 00 00       	call   47ab <sysctl>
+    12d4:	83 c4 10             	add    $0x10,%esp
+      n = waits[i];
+    12d7:	8b 3c 9d 10 68 00 00 	mov    0x6810(,%ebx,4),%edi
+      t0 = uptime();
+    12de:	e8 98 34 00 00       	call   477b <uptime>
+      if(sleep(n) < 0){
+    12e3:	83 ec 0c             	sub    $0xc,%esp
+    12e6:	57                   	push   %edi
+      t0 = uptime();
+    12e7:	89 c6                	mov    %eax,%esi
+      if(sleep(n) < 0){
+    12e9:	e8 85 34 00 00       	call   4773 <sleep>
+    12ee:	83 c4 10             	add    $0x10,%esp
+    12f1:	85 c0                	test   %eax,%eax
+    12f3:	0f 88 bc 00 00 00    	js     13b5 <sleeptest+0x135>
+      t = uptime() - t0;
+    12f9:	e8 7d 34 00 00       	call   477b <uptime>
+      if(t < n || t > n + slack + 5){
+    12fe:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+      t = uptime() - t0;
+    1301:	29 f0                	sub    %esi,%eax
+      if(t < n || t > n + slack + 5){
+    1303:	39 c7                	cmp    %eax,%edi
+    1305:	0f 8f 90 00 00 00    	jg     139b <sleeptest+0x11b>
+    130b:	8d 54 39 05          	lea    0x5(%ecx,%edi,1),%edx
+    130f:	39 c2                	cmp    %eax,%edx
+    1311:	0f 8c 84 00 00 00    	jl     139b <sleeptest+0x11b>
+    for(i = 0; i < sizeof(waits)/sizeof(waits[0]); i++){
+    1317:	83 c3 01             	add    $0x1,%ebx
+    131a:	83 fb 04             	cmp    $0x4,%ebx
+    131d:	75 b8                	jne    12d7 <sleeptest+0x57>
+  for(slack = 0; slack <= 3; slack += 3){
+    131f:	83 c1 03             	add    $0x3,%ecx
+    1322:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+    1325:	83 f9 03             	cmp    $0x3,%ecx
+    1328:	7e 96                	jle    12c0 <sleeptest+0x40>
+  sysctl(-1, "timer_slack", 0, &old);
+    132a:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+    132d:	50                   	push   %eax
+    132e:	6a 00                	push   $0x0
+    1330:	68 fa 50 00 00       	push   $0x50fa
+    1335:	6a ff                	push   $0xffffffff
+    1337:	e8 6f 34 00 00       	call   47ab <sysctl>
+  pid = fork();
+    133c:	e8 9a 33 00 00       	call   46db <fork>
+  if(pid < 0){
+    1341:	83 c4 10             	add    $0x10,%esp
+  pid = fork();
+    1344:	89 c3                	mov    %eax,%ebx
+  if(pid < 0){
+    1346:	85 c0                	test   %eax,%eax
+    1348:	0f 88 b4 00 00 00    	js     1402 <sleeptest+0x182>
+  if(pid == 0){
+    134e:	0f 84 89 00 00 00    	je     13dd <sleeptest+0x15d>
+  t0 = uptime();
+    1354:	e8 22 34 00 00       	call   477b <uptime>
+  sleep(2);
+    1359:	83 ec 0c             	sub    $0xc,%esp
+    135c:	6a 02                	push   $0x2
+  t0 = uptime();
+    135e:	89 c6                	mov    %eax,%esi
+  sleep(2);
+    1360:	e8 0e 34 00 00       	call   4773 <sleep>
+  kill(pid);
+    1365:	89 1c 24             	mov    %ebx,(%esp)
+    1368:	e8 a6 33 00 00       	call   4713 <kill>
+  wait();
+    136d:	e8 79 33 00 00       	call   46eb <wait>
+  if(uptime() - t0 > 100){
+    1372:	e8 04 34 00 00       	call   477b <uptime>
+    1377:	83 c4 10             	add    $0x10,%esp
+    137a:	29 f0                	sub    %esi,%eax
+    137c:	83 f8 64             	cmp    $0x64,%eax
+    137f:	7f 49                	jg     13ca <sleeptest+0x14a>
+  printf(1, "sleep test ok\n");
+    1381:	83 ec 08             	sub    $0x8,%esp
+    1384:	68 50 51 00 00       	push   $0x5150
+    1389:	6a 01                	push   $0x1
+    138b:	e8 10 35 00 00       	call   48a0 <printf>
+}
+    1390:	83 c4 10             	add    $0x10,%esp
+    1393:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    1396:	5b                   	pop    %ebx
+    1397:	5e                   	pop    %esi
+    1398:	5f                   	pop    %edi
+    1399:	5d                   	pop    %ebp
+    139a:	c3                   	ret
+        printf(1, "sleep(%d) with slack %d took %d ticks\n", n, slack, t);
+    139b:	83 ec 0c             	sub    $0xc,%esp
+    139e:	50                   	push   %eax
+    139f:	51                   	push   %ecx
+    13a0:	57                   	push   %edi
+    13a1:	68 84 60 00 00       	push   $0x6084
+    13a6:	6a 01                	push   $0x1
+    13a8:	e8 f3 34 00 00       	call   48a0 <printf>
+        exit();
+    13ad:	83 c4 20             	add    $0x20,%esp
+    13b0:	e8 2e 33 00 00       	call   46e3 <exit>
+        printf(1, "sleep(%d) failed\n", n);
+    13b5:	83 ec 04             	sub    $0x4,%esp
+    13b8:	57                   	push   %edi
+    13b9:	68 21 51 00 00       	push   $0x5121
+    13be:	6a 01                	push   $0x1
+    13c0:	e8 db 34 00 00       	call   48a0 <printf>
+        exit();
+    13c5:	e8 19 33 00 00       	call   46e3 <exit>
+    printf(1, "killed sleeper did not wake\n");
+    13ca:	50                   	push   %eax
+    13cb:	50                   	push   %eax
+    13cc:	68 33 51 00 00       	push   $0x5133
+    13d1:	6a 01                	push   $0x1
+    13d3:	e8 c8 34 00 00       	call   48a0 <printf>
+    exit();
+    13d8:	e8 06 33 00 00       	call   46e3 <exit>
+    sleep(1000);
+    13dd:	83 ec 0c             	sub    $0xc,%esp
+    13e0:	68 e8 03 00 00       	push   $0x3e8
+    13e5:	e8 89 33 00 00       	call   4773 <sleep>
+    exit();
+    13ea:	e8 f4 32 00 00       	call   46e3 <exit>
+    printf(1, "sysctl timer_slack failed\n");
+    13ef:	51                   	push   %ecx
+    13f0:	51                   	push   %ecx
+    13f1:	68 06 51 00 00       	push   $0x5106
+    13f6:	6a 01                	push   $0x1
+    13f8:	e8 a3 34 00 00       	call   48a0 <printf>
+    exit();
+    13fd:	e8 e1 32 00 00       	call   46e3 <exit>
+    printf(1, "fork failed\n");
+    1402:	52                   	push   %edx
+    1403:	52                   	push   %edx
+    1404:	68 a6 5d 00 00       	push   $0x5da6
+    1409:	6a 01                	push   $0x1
+    140b:	e8 90 34 00 00       	call   48a0 <printf>
+    exit();
+    1410:	e8 ce 32 00 00       	call   46e3 <exit>
+    1415:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    141c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00001420 <affinitytest>:
+{
+    1420:	55                   	push   %ebp
+    1421:	89 e5                	mov    %esp,%ebp
+    1423:	57                   	push   %edi
+    1424:	56                   	push   %esi
+    1425:	53                   	push   %ebx
+    1426:	81 ec 84 00 00 00    	sub    $0x84,%esp
+  printf(1, "affinity test\n");
+    142c:	68 5f 51 00 00       	push   $0x515f
+    1431:	6a 01                	push   $0x1
+    1433:	e8 68 34 00 00       	call   48a0 <printf>
+  if(sched_getaffinity(0, &all) < 0 || (all & 1) == 0){
+    1438:	58                   	pop    %eax
+    1439:	8d 45 8c             	lea    -0x74(%ebp),%eax
+    143c:	5a                   	pop    %edx
+    143d:	50                   	push   %eax
+    143e:	6a 00                	push   $0x0
+    1440:	e8 86 33 00 00       	call   47cb <sched_getaffinity>
+    1445:	83 c4 10             	add    $0x10,%esp
+    1448:	85 c0                	test   %eax,%eax
+    144a:	0f 88 b7 02 00 00    	js     1707 <affinitytest+0x2e7>
+    1450:	f6 45 8c 01          	testb  $0x1,-0x74(%ebp)
+    1454:	0f 84 ad 02 00 00    	je     1707 <affinitytest+0x2e7>
+  if(sched_setaffinity(0, 0) >= 0 || sched_setaffinity(0, ~all) >= 0){
+    145a:	83 ec 08             	sub    $0x8,%esp
+    145d:	6a 00                	push   $0x0
+    145f:	6a 00                	push   $0x0
+    1461:	e8 5d 33 00 00       	call   47c3 <sched_setaffinity>
+    1466:	83 c4 10             	add    $0x10,%esp
+    1469:	85 c0                	test   %eax,%eax
+    146b:	0f 89 cf 02 00 00    	jns    1740 <affinitytest+0x320>
+    1471:	8b 45 8c             	mov    -0x74(%ebp),%eax
+    1474:	83 ec 08             	sub    $0x8,%esp
+    1477:	f7 d0                	not    %eax
+    1479:	50                   	push   %eax
+    147a:	6a 00                	push   $0x0
+    147c:	e8 42 33 00 00       	call   47c3 <sched_setaffinity>
+    1481:	83 c4 10             	add    $0x10,%esp
+    1484:	85 c0                	test   %eax,%eax
+    1486:	0f 89 b4 02 00 00    	jns    1740 <affinitytest+0x320>
+  pid = fork();
+    148c:	e8 4a 32 00 00       	call   46db <fork>
+    1491:	89 c6                	mov    %eax,%esi
+  if(pid < 0){
+    1493:	85 c0                	test   %eax,%eax
+    1495:	0f 88 92 02 00 00    	js     172d <affinitytest+0x30d>
+  if(pid == 0)
+    149b:	0f 84 3e 01 00 00    	je     15df <affinitytest+0x1bf>
+  for(cpu = 0; cpu < 2 && (all >> cpu) & 1; cpu++){
+    14a1:	31 ff                	xor    %edi,%edi
+    14a3:	f6 45 8c 01          	testb  $0x1,-0x74(%ebp)
+    14a7:	74 7b                	je     1524 <affinitytest+0x104>
+    if(sched_setaffinity(pid, 1 << cpu) < 0){
+    14a9:	89 f9                	mov    %edi,%ecx
+    14ab:	b8 01 00 00 00       	mov    $0x1,%eax
+    14b0:	83 ec 08             	sub    $0x8,%esp
+    14b3:	d3 e0                	shl    %cl,%eax
+    14b5:	89 45 84             	mov    %eax,-0x7c(%ebp)
+    14b8:	50                   	push   %eax
+    14b9:	56                   	push   %esi
+    14ba:	e8 04 33 00 00       	call   47c3 <sched_setaffinity>
+    14bf:	83 c4 10             	add    $0x10,%esp
+    14c2:	85 c0                	test   %eax,%eax
+    14c4:	0f 88 50 02 00 00    	js     171a <affinitytest+0x2fa>
+    sleep(2);
+    14ca:	83 ec 0c             	sub    $0xc,%esp
+    14cd:	bb 14 00 00 00       	mov    $0x14,%ebx
+    14d2:	6a 02                	push   $0x2
+    14d4:	e8 9a 32 00 00       	call   4773 <sleep>
+    14d9:	83 c4 10             	add    $0x10,%esp
+    14dc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+      if(procinfo(pid, &pi) < 0 || pi.lastcpu != cpu){
+    14e0:	83 ec 08             	sub    $0x8,%esp
+    14e3:	8d 45 98             	lea    -0x68(%ebp),%eax
+    14e6:	50                   	push   %eax
+    14e7:	56                   	push   %esi
+    14e8:	e8 ae 32 00 00       	call   479b <procinfo>
+    14ed:	83 c4 10             	add    $0x10,%esp
+    14f0:	85 c0                	test   %eax,%eax
+    14f2:	8b 45 bc             	mov    -0x44(%ebp),%eax
+    14f5:	0f 88 f7 01 00 00    	js     16f2 <affinitytest+0x2d2>
+    14fb:	39 f8                	cmp    %edi,%eax
+    14fd:	0f 85 ef 01 00 00    	jne    16f2 <affinitytest+0x2d2>
+      sleep(1);
+    1503:	83 ec 0c             	sub    $0xc,%esp
+    1506:	6a 01                	push   $0x1
+    1508:	e8 66 32 00 00       	call   4773 <sleep>
+    for(i = 0; i < 20; i++){
+    150d:	83 c4 10             	add    $0x10,%esp
+    1510:	83 eb 01             	sub    $0x1,%ebx
+    1513:	75 cb                	jne    14e0 <affinitytest+0xc0>
+  for(cpu = 0; cpu < 2 && (all >> cpu) & 1; cpu++){
+    1515:	85 ff                	test   %edi,%edi
+    1517:	75 0b                	jne    1524 <affinitytest+0x104>
+    1519:	bf 01 00 00 00       	mov    $0x1,%edi
+    151e:	f6 45 8c 02          	testb  $0x2,-0x74(%ebp)
+    1522:	75 85                	jne    14a9 <affinitytest+0x89>
+  kill(pid);
+    1524:	83 ec 0c             	sub    $0xc,%esp
+    1527:	56                   	push   %esi
+    1528:	e8 e6 31 00 00       	call   4713 <kill>
+  wait();
+    152d:	e8 b9 31 00 00       	call   46eb <wait>
+  if(sched_setaffinity(0, 1) < 0){
+    1532:	5b                   	pop    %ebx
+    1533:	5e                   	pop    %esi
+    1534:	6a 01                	push   $0x1
+    1536:	6a 00                	push   $0x0
+    1538:	e8 86 32 00 00       	call   47c3 <sched_setaffinity>
+    153d:	83 c4 10             	add    $0x10,%esp
+    1540:	85 c0                	test   %eax,%eax
+    1542:	0f 88 d2 01 00 00    	js     171a <affinitytest+0x2fa>
+  for(i = 0; i < 100; i++){
+    1548:	31 db                	xor    %ebx,%ebx
+    154a:	8d 7d 98             	lea    -0x68(%ebp),%edi
+    154d:	8d 76 00             	lea    0x0(%esi),%esi
+    if(procinfo(getpid(), &pi) < 0 || pi.lastcpu != 0){
+    1550:	e8 0e 32 00 00       	call   4763 <getpid>
+    1555:	83 ec 08             	sub    $0x8,%esp
+    1558:	57                   	push   %edi
+    1559:	50                   	push   %eax
+    155a:	e8 3c 32 00 00       	call   479b <procinfo>
+    155f:	8b 75 bc             	mov    -0x44(%ebp),%esi
+    1562:	83 c4 10             	add    $0x10,%esp
+    1565:	85 c0                	test   %eax,%eax
+    1567:	0f 88 70 01 00 00    	js     16dd <affinitytest+0x2bd>
+    156d:	85 f6                	test   %esi,%esi
+    156f:	0f 85 68 01 00 00    	jne    16dd <affinitytest+0x2bd>
+    sleep(i % 2);
+    1575:	89 d8                	mov    %ebx,%eax
+    1577:	83 ec 0c             	sub    $0xc,%esp
+  for(i = 0; i < 100; i++){
+    157a:	83 c3 01             	add    $0x1,%ebx
+    sleep(i % 2);
+    157d:	83 e0 01             	and    $0x1,%eax
+    1580:	50                   	push   %eax
+    1581:	e8 ed 31 00 00       	call   4773 <sleep>
+  for(i = 0; i < 100; i++){
+    1586:	83 c4 10             	add    $0x10,%esp
+    1589:	83 fb 64             	cmp    $0x64,%ebx
+    158c:	75 c2                	jne    1550 <affinitytest+0x130>
+  pipe(fds);
+    158e:	83 ec 0c             	sub    $0xc,%esp
+    1591:	8d 45 90             	lea    -0x70(%ebp),%eax
+    1594:	50                   	push   %eax
+    1595:	e8 59 31 00 00       	call   46f3 <pipe>
+  pid = fork();
+    159a:	e8 3c 31 00 00       	call   46db <fork>
+  if(pid < 0){
+    159f:	83 c4 10             	add    $0x10,%esp
+    15a2:	85 c0                	test   %eax,%eax
+    15a4:	0f 88 83 01 00 00    	js     172d <affinitytest+0x30d>
+  if(pid == 0){
+    15aa:	75 3c                	jne    15e8 <affinitytest+0x1c8>
+    if(sched_getaffinity(0, &mask) < 0 || mask != 1){
+    15ac:	83 ec 08             	sub    $0x8,%esp
+    15af:	8d 45 88             	lea    -0x78(%ebp),%eax
+    15b2:	50                   	push   %eax
+    15b3:	6a 00                	push   $0x0
+    15b5:	e8 11 32 00 00       	call   47cb <sched_getaffinity>
+    15ba:	83 c4 10             	add    $0x10,%esp
+    15bd:	85 c0                	test   %eax,%eax
+    15bf:	78 0a                	js     15cb <affinitytest+0x1ab>
+    15c1:	83 7d 88 01          	cmpl   $0x1,-0x78(%ebp)
+    15c5:	0f 84 c9 00 00 00    	je     1694 <affinitytest+0x274>
+      printf(1, "mask not inherited across fork\n");
+    15cb:	83 ec 08             	sub    $0x8,%esp
+    15ce:	68 f4 60 00 00       	push   $0x60f4
+    15d3:	6a 01                	push   $0x1
+    15d5:	e8 c6 32 00 00       	call   48a0 <printf>
+      exit();
+    15da:	e8 04 31 00 00       	call   46e3 <exit>
+    for(;;)
+    15df:	eb fe                	jmp    15df <affinitytest+0x1bf>
+    15e1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  close(fds[1]);
+    15e8:	83 ec 0c             	sub    $0xc,%esp
+    15eb:	ff 75 94             	push   -0x6c(%ebp)
+  while((i = read(fds[0], buf + n, sizeof(buf) - 1 - n)) > 0)
+    15ee:	bb ff 1f 00 00       	mov    $0x1fff,%ebx
+  close(fds[1]);
+    15f3:	e8 13 31 00 00       	call   470b <close>
+  while((i = read(fds[0], buf + n, sizeof(buf) - 1 - n)) > 0)
+    15f8:	83 c4 10             	add    $0x10,%esp
+    15fb:	eb 05                	jmp    1602 <affinitytest+0x1e2>
+    15fd:	8d 76 00             	lea    0x0(%esi),%esi
+    n += i;
+    1600:	01 c6                	add    %eax,%esi
+  while((i = read(fds[0], buf + n, sizeof(buf) - 1 - n)) > 0)
+    1602:	89 d8                	mov    %ebx,%eax
+    1604:	83 ec 04             	sub    $0x4,%esp
+    1607:	29 f0                	sub    %esi,%eax
+    1609:	50                   	push   %eax
+    160a:	8d 86 20 9a 00 00    	lea    0x9a20(%esi),%eax
+    1610:	50                   	push   %eax
+    1611:	ff 75 90             	push   -0x70(%ebp)
+    1614:	e8 e2 30 00 00       	call   46fb <read>
+    1619:	83 c4 10             	add    $0x10,%esp
+    161c:	85 c0                	test   %eax,%eax
+    161e:	7f e0                	jg     1600 <affinitytest+0x1e0>
+  close(fds[0]);
+    1620:	83 ec 0c             	sub    $0xc,%esp
+    1623:	ff 75 90             	push   -0x70(%ebp)
+    1626:	e8 e0 30 00 00       	call   470b <close>
+  wait();
+    162b:	e8 bb 30 00 00       	call   46eb <wait>
+  buf[n] = 0;
+    1630:	c6 86 20 9a 00 00 00 	movb   $0x0,0x9a20(%esi)
+  if(n < 3 || strcmp(buf + n - 3, " 1\n") != 0){
+    1637:	83 c4 10             	add    $0x10,%esp
+    163a:	83 fe 02             	cmp    $0x2,%esi
+    163d:	0f 8e 10 01 00 00    	jle    1753 <affinitytest+0x333>
+    1643:	83 ec 08             	sub    $0x8,%esp
+    1646:	81 c6 1d 9a 00 00    	add    $0x9a1d,%esi
+    164c:	68 1a 4f 00 00       	push   $0x4f1a
+    1651:	56                   	push   %esi
+    1652:	e8 79 2e 00 00       	call   44d0 <strcmp>
+    1657:	83 c4 10             	add    $0x10,%esp
+    165a:	85 c0                	test   %eax,%eax
+    165c:	0f 85 f1 00 00 00    	jne    1753 <affinitytest+0x333>
+  if(sched_setaffinity(0, all) < 0){
+    1662:	83 ec 08             	sub    $0x8,%esp
+    1665:	ff 75 8c             	push   -0x74(%ebp)
+    1668:	6a 00                	push   $0x0
+    166a:	e8 54 31 00 00       	call   47c3 <sched_setaffinity>
+    166f:	83 c4 10             	add    $0x10,%esp
+    1672:	85 c0                	test   %eax,%eax
+    1674:	0f 88 a0 00 00 00    	js     171a <affinitytest+0x2fa>
+  printf(1, "affinity test ok\n");
+    167a:	83 ec 08             	sub    $0x8,%esp
+    167d:	68 d4 51 00 00       	push   $0x51d4
+    1682:	6a 01                	push   $0x1
+    1684:	e8 17 32 00 00       	call   48a0 <printf>
+}
+    1689:	83 c4 10             	add    $0x10,%esp
+    168c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    168f:	5b                   	pop    %ebx
+    1690:	5e                   	pop    %esi
+    1691:	5f                   	pop    %edi
+    1692:	5d                   	pop    %ebp
+    1693:	c3                   	ret
+    close(1);
+    1694:	83 ec 0c             	sub    $0xc,%esp
+    1697:	6a 01                	push   $0x1
+    1699:	e8 6d 30 00 00       	call   470b <close>
+    dup(fds[1]);
+    169e:	5a                   	pop    %edx
+    169f:	ff 75 94             	push   -0x6c(%ebp)
+    16a2:	e8 b4 30 00 00       	call   475b <dup>
+    close(fds[0]);
+    16a7:	59                   	pop    %ecx
+    16a8:	ff 75 90             	push   -0x70(%ebp)
+    16ab:	e8 5b 30 00 00       	call   470b <close>
+    close(fds[1]);
+    16b0:	5b                   	pop    %ebx
+    16b1:	ff 75 94             	push   -0x6c(%ebp)
+    16b4:	e8 52 30 00 00       	call   470b <close>
+    exec("taskset", args);
+    16b9:	5e                   	pop    %esi
+    16ba:	5f                   	pop    %edi
+    16bb:	68 d4 72 00 00       	push   $0x72d4
+    16c0:	68 b7 51 00 00       	push   $0x51b7
+    16c5:	e8 51 30 00 00       	call   471b <exec>
+    printf(2, "exec taskset failed\n");
+    16ca:	58                   	pop    %eax
+    16cb:	5a                   	pop    %edx
+    16cc:	68 bf 51 00 00       	push   $0x51bf
+    16d1:	6a 02                	push   $0x2
+    16d3:	e8 c8 31 00 00       	call   48a0 <printf>
+    exit();
+    16d8:	e8 06 30 00 00       	call   46e3 <exit>
+      printf(1, "running on cpu %d outside mask\n", pi.lastcpu);
+    16dd:	83 ec 04             	sub    $0x4,%esp
+    16e0:	56                   	push   %esi
+    16e1:	68 d4 60 00 00       	push   $0x60d4
+    16e6:	6a 01                	push   $0x1
+    16e8:	e8 b3 31 00 00       	call   48a0 <printf>
+      exit();
+    16ed:	e8 f1 2f 00 00       	call   46e3 <exit>
+        printf(1, "spinner ran on cpu %d outside mask %x\n",
+    16f2:	ff 75 84             	push   -0x7c(%ebp)
+    16f5:	50                   	push   %eax
+    16f6:	68 ac 60 00 00       	push   $0x60ac
+    16fb:	6a 01                	push   $0x1
+    16fd:	e8 9e 31 00 00       	call   48a0 <printf>
+        exit();
+    1702:	e8 dc 2f 00 00       	call   46e3 <exit>
+    printf(1, "sched_getaffinity failed\n");
+    1707:	50                   	push   %eax
+    1708:	50                   	push   %eax
+    1709:	68 6e 51 00 00       	push   $0x516e
+    170e:	6a 01                	push   $0x1
+    1710:	e8 8b 31 00 00       	call   48a0 <printf>
+    exit();
+    1715:	e8 c9 2f 00 00       	call   46e3 <exit>
+      printf(1, "sched_setaffinity failed\n");
+    171a:	51                   	push   %ecx
+    171b:	51                   	push   %ecx
+    171c:	68 9d 51 00 00       	push   $0x519d
+    1721:	6a 01                	push   $0x1
+    1723:	e8 78 31 00 00       	call   48a0 <printf>
+      exit();
+    1728:	e8 b6 2f 00 00       	call   46e3 <exit>
+    printf(1, "fork failed\n");
+    172d:	57                   	push   %edi
+    172e:	57                   	push   %edi
+    172f:	68 a6 5d 00 00       	push   $0x5da6
+    1734:	6a 01                	push   $0x1
+    1736:	e8 65 31 00 00       	call   48a0 <printf>
+    exit();
+    173b:	e8 a3 2f 00 00       	call   46e3 <exit>
+    printf(1, "empty mask accepted\n");
+    1740:	50                   	push   %eax
+    1741:	50                   	push   %eax
+    1742:	68 88 51 00 00       	push   $0x5188
+    1747:	6a 01                	push   $0x1
+    1749:	e8 52 31 00 00       	call   48a0 <printf>
+    exit();
+    174e:	e8 90 2f 00 00       	call   46e3 <exit>
+    printf(1, "mask not kept across exec: %s\n", buf);
+    1753:	50                   	push   %eax
+    1754:	68 20 9a 00 00       	push   $0x9a20
+    1759:	68 14 61 00 00       	push   $0x6114
+    175e:	6a 01                	push   $0x1
+    1760:	e8 3b 31 00 00       	call   48a0 <printf>
+    exit();
+    1765:	e8 79 2f 00 00       	call   46e3 <exit>
+    176a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00001770 <runtimeof>:
+{
+    1770:	55                   	push   %ebp
+    1771:	89 e5                	mov    %esp,%ebp
+    1773:	57                   	push   %edi
+    1774:	56                   	push   %esi
+    1775:	53                   	push   %ebx
+    1776:	83 ec 5c             	sub    $0x5c,%esp
+  for(i = 0; i < n; i++){
+    1779:	8b 45 0c             	mov    0xc(%ebp),%eax
+    177c:	85 c0                	test   %eax,%eax
+    177e:	7e 41                	jle    17c1 <runtimeof+0x51>
+    1780:	31 f6                	xor    %esi,%esi
+  ms = 0;
+    1782:	31 db                	xor    %ebx,%ebx
+    1784:	8d 7d 98             	lea    -0x68(%ebp),%edi
+    1787:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    178e:	66 90                	xchg   %ax,%ax
+    if(procinfo(pids[i], &pi) < 0 || pi.group != 1){
+    1790:	83 ec 08             	sub    $0x8,%esp
+    1793:	57                   	push   %edi
+    1794:	8b 45 08             	mov    0x8(%ebp),%eax
+    1797:	ff 34 b0             	push   (%eax,%esi,4)
+    179a:	e8 fc 2f 00 00       	call   479b <procinfo>
+    179f:	83 c4 10             	add    $0x10,%esp
+    17a2:	85 c0                	test   %eax,%eax
+    17a4:	78 1f                	js     17c5 <runtimeof+0x55>
+    17a6:	83 7d d4 01          	cmpl   $0x1,-0x2c(%ebp)
+    17aa:	75 19                	jne    17c5 <runtimeof+0x55>
+    ms += pi.runtime_ms;
+    17ac:	03 5d b0             	add    -0x50(%ebp),%ebx
+  for(i = 0; i < n; i++){
+    17af:	83 c6 01             	add    $0x1,%esi
+    17b2:	39 75 0c             	cmp    %esi,0xc(%ebp)
+    17b5:	75 d9                	jne    1790 <runtimeof+0x20>
+}
+    17b7:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    17ba:	89 d8                	mov    %ebx,%eax
+    17bc:	5b                   	pop    %ebx
+    17bd:	5e                   	pop    %esi
+    17be:	5f                   	pop    %edi
+    17bf:	5d                   	pop    %ebp
+    17c0:	c3                   	ret
+  ms = 0;
+    17c1:	31 db                	xor    %ebx,%ebx
+  return ms;
+    17c3:	eb f2                	jmp    17b7 <runtimeof+0x47>
+      printf(1, "procinfo failed\n");
+    17c5:	83 ec 08             	sub    $0x8,%esp
+    17c8:	68 e6 51 00 00       	push   $0x51e6
+    17cd:	6a 01                	push   $0x1
+    17cf:	e8 cc 30 00 00       	call   48a0 <printf>
+      exit();
+    17d4:	e8 0a 2f 00 00       	call   46e3 <exit>
+    17d9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+000017e0 <quotatest>:
+{
+    17e0:	55                   	push   %ebp
+    17e1:	89 e5                	mov    %esp,%ebp
+    17e3:	57                   	push   %edi
+    17e4:	56                   	push   %esi
+    17e5:	53                   	push   %ebx
+    17e6:	81 ec 84 01 00 00    	sub    $0x184,%esp
+  printf(1, "quota test\n");
+    17ec:	68 f7 51 00 00       	push   $0x51f7
+    17f1:	6a 01                	push   $0x1
+    17f3:	e8 a8 30 00 00       	call   48a0 <printf>
+  if(setquota(0, 20000, 100000) >= 0 || setquota(1, 1000, 0) >= 0 ||
+    17f8:	83 c4 0c             	add    $0xc,%esp
+    17fb:	68 a0 86 01 00       	push   $0x186a0
+    1800:	68 20 4e 00 00       	push   $0x4e20
+    1805:	6a 00                	push   $0x0
+    1807:	e8 d7 2f 00 00       	call   47e3 <setquota>
+    180c:	83 c4 10             	add    $0x10,%esp
+    180f:	85 c0                	test   %eax,%eax
+    1811:	0f 89 82 03 00 00    	jns    1b99 <quotatest+0x3b9>
+    1817:	83 ec 04             	sub    $0x4,%esp
+    181a:	6a 00                	push   $0x0
+    181c:	68 e8 03 00 00       	push   $0x3e8
+    1821:	6a 01                	push   $0x1
+    1823:	e8 bb 2f 00 00       	call   47e3 <setquota>
+    1828:	83 c4 10             	add    $0x10,%esp
+    182b:	85 c0                	test   %eax,%eax
+    182d:	0f 89 66 03 00 00    	jns    1b99 <quotatest+0x3b9>
+     setgroup(0, NGROUP) >= 0){
+    1833:	83 ec 08             	sub    $0x8,%esp
+    1836:	6a 08                	push   $0x8
+    1838:	6a 00                	push   $0x0
+    183a:	e8 9c 2f 00 00       	call   47db <setgroup>
+  if(setquota(0, 20000, 100000) >= 0 || setquota(1, 1000, 0) >= 0 ||
+    183f:	83 c4 10             	add    $0x10,%esp
+    1842:	85 c0                	test   %eax,%eax
+    1844:	0f 89 4f 03 00 00    	jns    1b99 <quotatest+0x3b9>
+  if(setquota(1, 20000, 100000) < 0){
+    184a:	83 ec 04             	sub    $0x4,%esp
+    184d:	68 a0 86 01 00       	push   $0x186a0
+    1852:	68 20 4e 00 00       	push   $0x4e20
+    1857:	6a 01                	push   $0x1
+    1859:	e8 85 2f 00 00       	call   47e3 <setquota>
+    185e:	83 c4 10             	add    $0x10,%esp
+    1861:	85 c0                	test   %eax,%eax
+    1863:	0f 88 1d 03 00 00    	js     1b86 <quotatest+0x3a6>
+    pids[i] = fork();
+    1869:	e8 6d 2e 00 00       	call   46db <fork>
+    186e:	89 c3                	mov    %eax,%ebx
+    if(pids[i] < 0){
+    1870:	85 c0                	test   %eax,%eax
+    1872:	0f 88 fb 02 00 00    	js     1b73 <quotatest+0x393>
+    if(pids[i] == 0){
+    1878:	0f 84 a8 02 00 00    	je     1b26 <quotatest+0x346>
+    pids[i] = fork();
+    187e:	e8 58 2e 00 00       	call   46db <fork>
+    1883:	89 c7                	mov    %eax,%edi
+    if(pids[i] < 0){
+    1885:	85 c0                	test   %eax,%eax
+    1887:	0f 88 e6 02 00 00    	js     1b73 <quotatest+0x393>
+    if(pids[i] == 0){
+    188d:	0f 84 93 02 00 00    	je     1b26 <quotatest+0x346>
+  sleep(20);
+    1893:	83 ec 0c             	sub    $0xc,%esp
+    if(procinfo(pids[i], &pi) < 0 || pi.group != 1){
+    1896:	8d b5 f8 fe ff ff    	lea    -0x108(%ebp),%esi
+  sleep(20);
+    189c:	6a 14                	push   $0x14
+    189e:	e8 d0 2e 00 00       	call   4773 <sleep>
+    if(procinfo(pids[i], &pi) < 0 || pi.group != 1){
+    18a3:	58                   	pop    %eax
+    18a4:	5a                   	pop    %edx
+    18a5:	56                   	push   %esi
+    18a6:	53                   	push   %ebx
+    18a7:	e8 ef 2e 00 00       	call   479b <procinfo>
+    18ac:	83 c4 10             	add    $0x10,%esp
+    18af:	85 c0                	test   %eax,%eax
+    18b1:	0f 88 5b 02 00 00    	js     1b12 <quotatest+0x332>
+    18b7:	83 bd 34 ff ff ff 01 	cmpl   $0x1,-0xcc(%ebp)
+    18be:	0f 85 4e 02 00 00    	jne    1b12 <quotatest+0x332>
+    ms += pi.runtime_ms;
+    18c4:	8b 85 10 ff ff ff    	mov    -0xf0(%ebp),%eax
+    if(procinfo(pids[i], &pi) < 0 || pi.group != 1){
+    18ca:	83 ec 08             	sub    $0x8,%esp
+    ms += pi.runtime_ms;
+    18cd:	89 85 84 fe ff ff    	mov    %eax,-0x17c(%ebp)
+    if(procinfo(pids[i], &pi) < 0 || pi.group != 1){
+    18d3:	56                   	push   %esi
+    18d4:	57                   	push   %edi
+    18d5:	e8 c1 2e 00 00       	call   479b <procinfo>
+    18da:	83 c4 10             	add    $0x10,%esp
+    18dd:	85 c0                	test   %eax,%eax
+    18df:	0f 88 2d 02 00 00    	js     1b12 <quotatest+0x332>
+    18e5:	83 bd 34 ff ff ff 01 	cmpl   $0x1,-0xcc(%ebp)
+    18ec:	0f 85 20 02 00 00    	jne    1b12 <quotatest+0x332>
+    ms += pi.runtime_ms;
+    18f2:	8b 85 10 ff ff ff    	mov    -0xf0(%ebp),%eax
+  sleep(100);
+    18f8:	83 ec 0c             	sub    $0xc,%esp
+    ms += pi.runtime_ms;
+    18fb:	89 85 80 fe ff ff    	mov    %eax,-0x180(%ebp)
+  sleep(100);
+    1901:	6a 64                	push   $0x64
+    1903:	e8 6b 2e 00 00       	call   4773 <sleep>
+    if(procinfo(pids[i], &pi) < 0 || pi.group != 1){
+    1908:	5e                   	pop    %esi
+    1909:	8d b5 a8 fe ff ff    	lea    -0x158(%ebp),%esi
+    190f:	58                   	pop    %eax
+    1910:	56                   	push   %esi
+    1911:	53                   	push   %ebx
+    1912:	e8 84 2e 00 00       	call   479b <procinfo>
+    1917:	83 c4 10             	add    $0x10,%esp
+    191a:	85 c0                	test   %eax,%eax
+    191c:	0f 88 f0 01 00 00    	js     1b12 <quotatest+0x332>
+    1922:	83 bd e4 fe ff ff 01 	cmpl   $0x1,-0x11c(%ebp)
+    1929:	0f 85 e3 01 00 00    	jne    1b12 <quotatest+0x332>
+    ms += pi.runtime_ms;
+    192f:	8b 95 c0 fe ff ff    	mov    -0x140(%ebp),%edx
+    if(procinfo(pids[i], &pi) < 0 || pi.group != 1){
+    1935:	83 ec 08             	sub    $0x8,%esp
+    ms += pi.runtime_ms;
+    1938:	89 95 7c fe ff ff    	mov    %edx,-0x184(%ebp)
+    if(procinfo(pids[i], &pi) < 0 || pi.group != 1){
+    193e:	56                   	push   %esi
+    193f:	57                   	push   %edi
+    1940:	e8 56 2e 00 00       	call   479b <procinfo>
+    1945:	83 c4 10             	add    $0x10,%esp
+    1948:	85 c0                	test   %eax,%eax
+    194a:	0f 88 c2 01 00 00    	js     1b12 <quotatest+0x332>
+    1950:	83 bd e4 fe ff ff 01 	cmpl   $0x1,-0x11c(%ebp)
+    1957:	0f 85 b5 01 00 00    	jne    1b12 <quotatest+0x332>
+  ran = runtimeof(pids, 2) - before;
+    195d:	8b 85 84 fe ff ff    	mov    -0x17c(%ebp),%eax
+    1963:	8b 95 7c fe ff ff    	mov    -0x184(%ebp),%edx
+  if(groupinfo(1, &gi) < 0){
+    1969:	83 ec 08             	sub    $0x8,%esp
+    196c:	03 95 c0 fe ff ff    	add    -0x140(%ebp),%edx
+  ran = runtimeof(pids, 2) - before;
+    1972:	29 c2                	sub    %eax,%edx
+    1974:	8b 85 80 fe ff ff    	mov    -0x180(%ebp),%eax
+    197a:	29 c2                	sub    %eax,%edx
+  if(groupinfo(1, &gi) < 0){
+    197c:	8d 85 8c fe ff ff    	lea    -0x174(%ebp),%eax
+  ran = runtimeof(pids, 2) - before;
+    1982:	89 95 84 fe ff ff    	mov    %edx,-0x17c(%ebp)
+  if(groupinfo(1, &gi) < 0){
+    1988:	50                   	push   %eax
+    1989:	6a 01                	push   $0x1
+    198b:	e8 5b 2e 00 00       	call   47eb <groupinfo>
+    1990:	83 c4 10             	add    $0x10,%esp
+    1993:	85 c0                	test   %eax,%eax
+    1995:	0f 88 c5 01 00 00    	js     1b60 <quotatest+0x380>
+  if(gi.nproc != 2 || gi.nthrottled < 5 || gi.throttled_ms < 300 ||
+    199b:	8b 85 a4 fe ff ff    	mov    -0x15c(%ebp),%eax
+    19a1:	8b 95 9c fe ff ff    	mov    -0x164(%ebp),%edx
+    19a7:	8b 8d a0 fe ff ff    	mov    -0x160(%ebp),%ecx
+    19ad:	83 f8 02             	cmp    $0x2,%eax
+    19b0:	0f 85 8a 01 00 00    	jne    1b40 <quotatest+0x360>
+    19b6:	83 fa 04             	cmp    $0x4,%edx
+    19b9:	0f 86 81 01 00 00    	jbe    1b40 <quotatest+0x360>
+    19bf:	81 f9 2b 01 00 00    	cmp    $0x12b,%ecx
+    19c5:	0f 86 75 01 00 00    	jbe    1b40 <quotatest+0x360>
+     ran < 100 || ran > 250){
+    19cb:	8b b5 84 fe ff ff    	mov    -0x17c(%ebp),%esi
+    19d1:	83 ee 64             	sub    $0x64,%esi
+    19d4:	81 fe 96 00 00 00    	cmp    $0x96,%esi
+    19da:	0f 87 60 01 00 00    	ja     1b40 <quotatest+0x360>
+  setquota(1, 0, 0);
+    19e0:	83 ec 04             	sub    $0x4,%esp
+    if(procinfo(pids[i], &pi) < 0 || pi.group != 1){
+    19e3:	8d 75 98             	lea    -0x68(%ebp),%esi
+  setquota(1, 0, 0);
+    19e6:	6a 00                	push   $0x0
+    19e8:	6a 00                	push   $0x0
+    19ea:	6a 01                	push   $0x1
+    19ec:	e8 f2 2d 00 00       	call   47e3 <setquota>
+    if(procinfo(pids[i], &pi) < 0 || pi.group != 1){
+    19f1:	58                   	pop    %eax
+    19f2:	5a                   	pop    %edx
+    19f3:	56                   	push   %esi
+    19f4:	53                   	push   %ebx
+    19f5:	e8 a1 2d 00 00       	call   479b <procinfo>
+    19fa:	83 c4 10             	add    $0x10,%esp
+    19fd:	85 c0                	test   %eax,%eax
+    19ff:	0f 88 0d 01 00 00    	js     1b12 <quotatest+0x332>
+    1a05:	83 7d d4 01          	cmpl   $0x1,-0x2c(%ebp)
+    1a09:	0f 85 03 01 00 00    	jne    1b12 <quotatest+0x332>
+    ms += pi.runtime_ms;
+    1a0f:	8b 45 b0             	mov    -0x50(%ebp),%eax
+    if(procinfo(pids[i], &pi) < 0 || pi.group != 1){
+    1a12:	83 ec 08             	sub    $0x8,%esp
+    ms += pi.runtime_ms;
+    1a15:	89 85 84 fe ff ff    	mov    %eax,-0x17c(%ebp)
+    if(procinfo(pids[i], &pi) < 0 || pi.group != 1){
+    1a1b:	56                   	push   %esi
+    1a1c:	57                   	push   %edi
+    1a1d:	e8 79 2d 00 00       	call   479b <procinfo>
+    1a22:	83 c4 10             	add    $0x10,%esp
+    1a25:	85 c0                	test   %eax,%eax
+    1a27:	0f 88 e5 00 00 00    	js     1b12 <quotatest+0x332>
+    1a2d:	83 7d d4 01          	cmpl   $0x1,-0x2c(%ebp)
+    1a31:	0f 85 db 00 00 00    	jne    1b12 <quotatest+0x332>
+    ms += pi.runtime_ms;
+    1a37:	8b 4d b0             	mov    -0x50(%ebp),%ecx
+  sleep(50);
+    1a3a:	83 ec 0c             	sub    $0xc,%esp
+    ms += pi.runtime_ms;
+    1a3d:	89 8d 80 fe ff ff    	mov    %ecx,-0x180(%ebp)
+  sleep(50);
+    1a43:	6a 32                	push   $0x32
+    1a45:	e8 29 2d 00 00       	call   4773 <sleep>
+    if(procinfo(pids[i], &pi) < 0 || pi.group != 1){
+    1a4a:	8d 95 48 ff ff ff    	lea    -0xb8(%ebp),%edx
+    1a50:	5e                   	pop    %esi
+    1a51:	58                   	pop    %eax
+    1a52:	52                   	push   %edx
+    1a53:	53                   	push   %ebx
+    1a54:	e8 42 2d 00 00       	call   479b <procinfo>
+    1a59:	83 c4 10             	add    $0x10,%esp
+    1a5c:	85 c0                	test   %eax,%eax
+    1a5e:	0f 88 ae 00 00 00    	js     1b12 <quotatest+0x332>
+    1a64:	83 7d 84 01          	cmpl   $0x1,-0x7c(%ebp)
+    1a68:	0f 85 a4 00 00 00    	jne    1b12 <quotatest+0x332>
+    1a6e:	83 ec 08             	sub    $0x8,%esp
+    1a71:	8d 95 48 ff ff ff    	lea    -0xb8(%ebp),%edx
+    ms += pi.runtime_ms;
+    1a77:	8b b5 60 ff ff ff    	mov    -0xa0(%ebp),%esi
+    if(procinfo(pids[i], &pi) < 0 || pi.group != 1){
+    1a7d:	52                   	push   %edx
+    1a7e:	57                   	push   %edi
+    1a7f:	e8 17 2d 00 00       	call   479b <procinfo>
+    1a84:	83 c4 10             	add    $0x10,%esp
+    1a87:	85 c0                	test   %eax,%eax
+    1a89:	0f 88 83 00 00 00    	js     1b12 <quotatest+0x332>
+    1a8f:	83 7d 84 01          	cmpl   $0x1,-0x7c(%ebp)
+    1a93:	75 7d                	jne    1b12 <quotatest+0x332>
+  ran = runtimeof(pids, 2) - before;
+    1a95:	8b 85 84 fe ff ff    	mov    -0x17c(%ebp),%eax
+    1a9b:	03 b5 60 ff ff ff    	add    -0xa0(%ebp),%esi
+  if(groupinfo(1, &gi) < 0 || gi.throttled || ran < 200){
+    1aa1:	83 ec 08             	sub    $0x8,%esp
+  ran = runtimeof(pids, 2) - before;
+    1aa4:	8b 8d 80 fe ff ff    	mov    -0x180(%ebp),%ecx
+    1aaa:	29 c6                	sub    %eax,%esi
+  if(groupinfo(1, &gi) < 0 || gi.throttled || ran < 200){
+    1aac:	8d 85 8c fe ff ff    	lea    -0x174(%ebp),%eax
+    1ab2:	50                   	push   %eax
+  ran = runtimeof(pids, 2) - before;
+    1ab3:	29 ce                	sub    %ecx,%esi
+  if(groupinfo(1, &gi) < 0 || gi.throttled || ran < 200){
+    1ab5:	6a 01                	push   $0x1
+    1ab7:	e8 2f 2d 00 00       	call   47eb <groupinfo>
+    1abc:	83 c4 10             	add    $0x10,%esp
+    1abf:	85 c0                	test   %eax,%eax
+    1ac1:	0f 88 e6 00 00 00    	js     1bad <quotatest+0x3cd>
+    1ac7:	8b 8d 98 fe ff ff    	mov    -0x168(%ebp),%ecx
+    1acd:	85 c9                	test   %ecx,%ecx
+    1acf:	0f 85 d8 00 00 00    	jne    1bad <quotatest+0x3cd>
+    1ad5:	81 fe c7 00 00 00    	cmp    $0xc7,%esi
+    1adb:	0f 86 cc 00 00 00    	jbe    1bad <quotatest+0x3cd>
+    kill(pids[i]);
+    1ae1:	83 ec 0c             	sub    $0xc,%esp
+    1ae4:	53                   	push   %ebx
+    1ae5:	e8 29 2c 00 00       	call   4713 <kill>
+    wait();
+    1aea:	e8 fc 2b 00 00       	call   46eb <wait>
+    kill(pids[i]);
+    1aef:	89 3c 24             	mov    %edi,(%esp)
+    1af2:	e8 1c 2c 00 00       	call   4713 <kill>
+    wait();
+    1af7:	e8 ef 2b 00 00       	call   46eb <wait>
+  printf(1, "quota test ok\n");
+    1afc:	58                   	pop    %eax
+    1afd:	5a                   	pop    %edx
+    1afe:	68 3a 52 00 00       	push   $0x523a
+    1b03:	6a 01                	push   $0x1
+    1b05:	e8 96 2d 00 00       	call   48a0 <printf>
+}
+    1b0a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    1b0d:	5b                   	pop    %ebx
+    1b0e:	5e                   	pop    %esi
+    1b0f:	5f                   	pop    %edi
+    1b10:	5d                   	pop    %ebp
+    1b11:	c3                   	ret
+      printf(1, "procinfo failed\n");
+    1b12:	83 ec 08             	sub    $0x8,%esp
+    1b15:	68 e6 51 00 00       	push   $0x51e6
+    1b1a:	6a 01                	push   $0x1
+    1b1c:	e8 7f 2d 00 00       	call   48a0 <printf>
+      exit();
+    1b21:	e8 bd 2b 00 00       	call   46e3 <exit>
+      setgroup(0, 1);
+    1b26:	83 ec 08             	sub    $0x8,%esp
+    1b29:	6a 01                	push   $0x1
+    1b2b:	6a 00                	push   $0x0
+    1b2d:	e8 a9 2c 00 00       	call   47db <setgroup>
+    1b32:	83 c4 10             	add    $0x10,%esp
+      for(;;)
+    1b35:	eb fe                	jmp    1b35 <quotatest+0x355>
+    1b37:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    1b3e:	66 90                	xchg   %ax,%ax
+    printf(1, "not throttled: nproc %d throttled %d times for %d ms, "
+    1b40:	83 ec 08             	sub    $0x8,%esp
+    1b43:	ff b5 84 fe ff ff    	push   -0x17c(%ebp)
+    1b49:	51                   	push   %ecx
+    1b4a:	52                   	push   %edx
+    1b4b:	50                   	push   %eax
+    1b4c:	68 34 61 00 00       	push   $0x6134
+    1b51:	6a 01                	push   $0x1
+    1b53:	e8 48 2d 00 00       	call   48a0 <printf>
+    exit();
+    1b58:	83 c4 20             	add    $0x20,%esp
+    1b5b:	e8 83 2b 00 00       	call   46e3 <exit>
+    printf(1, "groupinfo failed\n");
+    1b60:	51                   	push   %ecx
+    1b61:	51                   	push   %ecx
+    1b62:	68 28 52 00 00       	push   $0x5228
+    1b67:	6a 01                	push   $0x1
+    1b69:	e8 32 2d 00 00       	call   48a0 <printf>
+    exit();
+    1b6e:	e8 70 2b 00 00       	call   46e3 <exit>
+      printf(1, "fork failed\n");
+    1b73:	50                   	push   %eax
+    1b74:	50                   	push   %eax
+    1b75:	68 a6 5d 00 00       	push   $0x5da6
+    1b7a:	6a 01                	push   $0x1
+    1b7c:	e8 1f 2d 00 00       	call   48a0 <printf>
+      exit();
+    1b81:	e8 5d 2b 00 00       	call   46e3 <exit>
+    printf(1, "setquota failed\n");
+    1b86:	50                   	push   %eax
+    1b87:	50                   	push   %eax
+    1b88:	68 17 52 00 00       	push   $0x5217
+    1b8d:	6a 01                	push   $0x1
+    1b8f:	e8 0c 2d 00 00       	call   48a0 <printf>
+    exit();
+    1b94:	e8 4a 2b 00 00       	call   46e3 <exit>
+    printf(1, "bad quota accepted\n");
+    1b99:	83 ec 08             	sub    $0x8,%esp
+    1b9c:	68 03 52 00 00       	push   $0x5203
+    1ba1:	6a 01                	push   $0x1
+    1ba3:	e8 f8 2c 00 00       	call   48a0 <printf>
+    exit();
+    1ba8:	e8 36 2b 00 00       	call   46e3 <exit>
+    printf(1, "not unthrottled: ran %d ms\n", ran);
+    1bad:	83 ec 04             	sub    $0x4,%esp
+    1bb0:	56                   	push   %esi
+    1bb1:	68 49 52 00 00       	push   $0x5249
+    1bb6:	6a 01                	push   $0x1
+    1bb8:	e8 e3 2c 00 00       	call   48a0 <printf>
+    exit();
+    1bbd:	e8 21 2b 00 00       	call   46e3 <exit>
+    1bc2:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    1bc9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00001bd0 <mem>:
+{
+    1bd0:	55                   	push   %ebp
+    1bd1:	89 e5                	mov    %esp,%ebp
+    1bd3:	56                   	push   %esi
+    1bd4:	31 f6                	xor    %esi,%esi
+    1bd6:	53                   	push   %ebx
+  printf(1, "mem test\n");
+    1bd7:	83 ec 08             	sub    $0x8,%esp
+    1bda:	68 65 52 00 00       	push   $0x5265
+    1bdf:	6a 01                	push   $0x1
+    1be1:	e8 ba 2c 00 00       	call   48a0 <printf>
+  ppid = getpid();
+    1be6:	e8 78 2b 00 00       	call   4763 <getpid>
+    1beb:	89 c3                	mov    %eax,%ebx
+  if((pid = fork()) == 0){
+    1bed:	e8 e9 2a 00 00       	call   46db <fork>
+    1bf2:	83 c4 10             	add    $0x10,%esp
+    1bf5:	85 c0                	test   %eax,%eax
+    1bf7:	74 0b                	je     1c04 <mem+0x34>
+    1bf9:	e9 8a 00 00 00       	jmp    1c88 <mem+0xb8>
+    1bfe:	66 90                	xchg   %ax,%ax
+      *(char**)m2 = m1;
+    1c00:	89 30                	mov    %esi,(%eax)
+    1c02:	89 c6                	mov    %eax,%esi
+    while((m2 = malloc(10001)) != 0){
+    1c04:	83 ec 0c             	sub    $0xc,%esp
+    1c07:	68 11 27 00 00       	push   $0x2711
+    1c0c:	e8 cf 2e 00 00       	call   4ae0 <malloc>
+    1c11:	83 c4 10             	add    $0x10,%esp
+    1c14:	85 c0                	test   %eax,%eax
+    1c16:	75 e8                	jne    1c00 <mem+0x30>
+    while(m1){
+    1c18:	85 f6                	test   %esi,%esi
+    1c1a:	74 18                	je     1c34 <mem+0x64>
+    1c1c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+      m2 = *(char**)m1;
+    1c20:	89 f0                	mov    %esi,%eax
+      free(m1);
+    1c22:	83 ec 0c             	sub    $0xc,%esp
+      m2 = *(char**)m1;
+    1c25:	8b 36                	mov    (%esi),%esi
+      free(m1);
+    1c27:	50                   	push   %eax
+    1c28:	e8 23 2e 00 00       	call   4a50 <free>
+    while(m1){
+    1c2d:	83 c4 10             	add    $0x10,%esp
+    1c30:	85 f6                	test   %esi,%esi
+    1c32:	75 ec                	jne    1c20 <mem+0x50>
+    m1 = malloc(1024*20);
+    1c34:	83 ec 0c             	sub    $0xc,%esp
+    1c37:	68 00 50 00 00       	push   $0x5000
+    1c3c:	e8 9f 2e 00 00       	call   4ae0 <malloc>
+    if(m1 == 0){
+    1c41:	83 c4 10             	add    $0x10,%esp
+    1c44:	85 c0                	test   %eax,%eax
+    1c46:	74 20                	je     1c68 <mem+0x98>
+    free(m1);
+    1c48:	83 ec 0c             	sub    $0xc,%esp
+    1c4b:	50                   	push   %eax
+    1c4c:	e8 ff 2d 00 00       	call   4a50 <free>
+    printf(1, "mem ok\n");
+    1c51:	58                   	pop    %eax
+    1c52:	5a                   	pop    %edx
+    1c53:	68 89 52 00 00       	push   $0x5289
+    1c58:	6a 01                	push   $0x1
+    1c5a:	e8 41 2c 00 00       	call   48a0 <printf>
+    exit();
+    1c5f:	e8 7f 2a 00 00       	call   46e3 <exit>
+    1c64:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+      printf(1, "couldn't allocate mem?!!\n");
+    1c68:	83 ec 08             	sub    $0x8,%esp
+    1c6b:	68 6f 52 00 00       	push   $0x526f
+    1c70:	6a 01                	push   $0x1
+    1c72:	e8 29 2c 00 00       	call   48a0 <printf>
+      kill(ppid);
+    1c77:	89 1c 24             	mov    %ebx,(%esp)
+    1c7a:	e8 94 2a 00 00       	call   4713 <kill>
+      exit();
+    1c7f:	e8 5f 2a 00 00       	call   46e3 <exit>
+    1c84:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+}
+    1c88:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    1c8b:	5b                   	pop    %ebx
+    1c8c:	5e                   	pop    %esi
+    1c8d:	5d                   	pop    %ebp
+    wait();
+    1c8e:	e9 58 2a 00 00       	jmp    46eb <wait>
+    1c93:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    1c9a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00001ca0 <sharedfd>:
+{
+    1ca0:	55                   	push   %ebp
+    1ca1:	89 e5                	mov    %esp,%ebp
+    1ca3:	57                   	push   %edi
+    1ca4:	56                   	push   %esi
+    1ca5:	53                   	push   %ebx
+    1ca6:	83 ec 34             	sub    $0x34,%esp
+  printf(1, "sharedfd test\n");
+    1ca9:	68 91 52 00 00       	push   $0x5291
+    1cae:	6a 01                	push   $0x1
+    1cb0:	e8 eb 2b 00 00       	call   48a0 <printf>
+  unlink("sharedfd");
+    1cb5:	c7 04 24 a0 52 00 00 	movl   $0x52a0,(%esp)
+    1cbc:	e8 72 2a 00 00       	call   4733 <unlink>
+  fd = open("sharedfd", O_CREATE|O_RDWR);
+    1cc1:	5b                   	pop    %ebx
+    1cc2:	5e                   	pop    %esi
+    1cc3:	68 02 02 00 00       	push   $0x202
+    1cc8:	68 a0 52 00 00       	push   $0x52a0
+    1ccd:	e8 51 2a 00 00       	call   4723 <open>
+  if(fd < 0){
+    1cd2:	83 c4 10             	add    $0x10,%esp
+    1cd5:	85 c0                	test   %eax,%eax
+    1cd7:	0f 88 2a 01 00 00    	js     1e07 <sharedfd+0x167>
+    1cdd:	89 c7                	mov    %eax,%edi
+  memset(buf, pid==0?'c':'p', sizeof(buf));
+    1cdf:	8d 75 de             	lea    -0x22(%ebp),%esi
+    1ce2:	bb e8 03 00 00       	mov    $0x3e8,%ebx
+  pid = fork();
+    1ce7:	e8 ef 29 00 00       	call   46db <fork>
+  memset(buf, pid==0?'c':'p', sizeof(buf));
+    1cec:	83 f8 01             	cmp    $0x1,%eax
+  pid = fork();
+    1cef:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  memset(buf, pid==0?'c':'p', sizeof(buf));
+    1cf2:	19 c0                	sbb    %eax,%eax
+    1cf4:	83 ec 04             	sub    $0x4,%esp
+    1cf7:	83 e0 f3             	and    $0xfffffff3,%eax
+    1cfa:	6a 0a                	push   $0xa
+    1cfc:	83 c0 70             	add    $0x70,%eax
+    1cff:	50                   	push   %eax
+    1d00:	56                   	push   %esi
+    1d01:	e8 5a 28 00 00       	call   4560 <memset>
+    1d06:	83 c4 10             	add    $0x10,%esp
+    1d09:	eb 0a                	jmp    1d15 <sharedfd+0x75>
+    1d0b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    1d0f:	90                   	nop
+  for(i = 0; i < 1000; i++){
+    1d10:	83 eb 01             	sub    $0x1,%ebx
+    1d13:	74 26                	je     1d3b <sharedfd+0x9b>
+    if(write(fd, buf, sizeof(buf)) != sizeof(buf)){
+    1d15:	83 ec 04             	sub    $0x4,%esp
+    1d18:	6a 0a                	push   $0xa
+    1d1a:	56                   	push   %esi
+    1d1b:	57                   	push   %edi
+    1d1c:	e8 e2 29 00 00       	call   4703 <write>
+    1d21:	83 c4 10             	add    $0x10,%esp
+    1d24:	83 f8 0a             	cmp    $0xa,%eax
+    1d27:	74 e7                	je     1d10 <sharedfd+0x70>
+      printf(1, "fstests: write sharedfd failed\n");
+    1d29:	83 ec 08             	sub    $0x8,%esp
+    1d2c:	68 a4 61 00 00       	push   $0x61a4
+    1d31:	6a 01                	push   $0x1
+    1d33:	e8 68 2b 00 00       	call   48a0 <printf>
+      break;
+    1d38:	83 c4 10             	add    $0x10,%esp
+  if(pid == 0)
+    1d3b:	8b 4d d4             	mov    -0x2c(%ebp),%ecx
+    1d3e:	85 c9                	test   %ecx,%ecx
+    1d40:	0f 84 f5 00 00 00    	je     1e3b <sharedfd+0x19b>
+    wait();
+    1d46:	e8 a0 29 00 00       	call   46eb <wait>
+  close(fd);
+    1d4b:	83 ec 0c             	sub    $0xc,%esp
+  nc = np = 0;
+    1d4e:	31 db                	xor    %ebx,%ebx
+  close(fd);
+    1d50:	57                   	push   %edi
+    1d51:	8d 7d e8             	lea    -0x18(%ebp),%edi
+    1d54:	e8 b2 29 00 00       	call   470b <close>
+  fd = open("sharedfd", 0);
+    1d59:	58                   	pop    %eax
+    1d5a:	5a                   	pop    %edx
+    1d5b:	6a 00                	push   $0x0
+    1d5d:	68 a0 52 00 00       	push   $0x52a0
+    1d62:	e8 bc 29 00 00       	call   4723 <open>
+  if(fd < 0){
+    1d67:	83 c4 10             	add    $0x10,%esp
+  nc = np = 0;
+    1d6a:	31 d2                	xor    %edx,%edx
+  fd = open("sharedfd", 0);
+    1d6c:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  if(fd < 0){
+    1d6f:	85 c0                	test   %eax,%eax
+    1d71:	0f 88 aa 00 00 00    	js     1e21 <sharedfd+0x181>
+    1d77:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    1d7e:	66 90                	xchg   %ax,%ax
+  while((n = read(fd, buf, sizeof(buf))) > 0){
+    1d80:	83 ec 04             	sub    $0x4,%esp
+    1d83:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+    1d86:	6a 0a                	push   $0xa
+    1d88:	56                   	push   %esi
+    1d89:	ff 75 d0             	push   -0x30(%ebp)
+    1d8c:	e8 6a 29 00 00       	call   46fb <read>
+    1d91:	83 c4 10             	add    $0x10,%esp
+    1d94:	85 c0                	test   %eax,%eax
+    1d96:	7e 28                	jle    1dc0 <sharedfd+0x120>
+    1d98:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+    1d9b:	89 f0                	mov    %esi,%eax
+    1d9d:	eb 13                	jmp    1db2 <sharedfd+0x112>
+    1d9f:	90                   	nop
+        np++;
+    1da0:	80 f9 70             	cmp    $0x70,%cl
+    1da3:	0f 94 c1             	sete   %cl
+    1da6:	0f b6 c9             	movzbl %cl,%ecx
+    1da9:	01 cb                	add    %ecx,%ebx
+    for(i = 0; i < sizeof(buf); i++){
+    1dab:	83 c0 01             	add    $0x1,%eax
+    1dae:	39 f8                	cmp    %edi,%eax
+    1db0:	74 ce                	je     1d80 <sharedfd+0xe0>
+      if(buf[i] == 'c')
+    1db2:	0f b6 08             	movzbl (%eax),%ecx
+    1db5:	80 f9 63             	cmp    $0x63,%cl
+    1db8:	75 e6                	jne    1da0 <sharedfd+0x100>
+        nc++;
+    1dba:	83 c2 01             	add    $0x1,%edx
+      if(buf[i] == 'p')
+    1dbd:	eb ec                	jmp    1dab <sharedfd+0x10b>
+    1dbf:	90                   	nop
+  close(fd);
+    1dc0:	83 ec 0c             	sub    $0xc,%esp
+    1dc3:	ff 75 d0             	push   -0x30(%ebp)
+    1dc6:	e8 40 29 00 00       	call   470b <close>
+  unlink("sharedfd");
+    1dcb:	c7 04 24 a0 52 00 00 	movl   $0x52a0,(%esp)
+    1dd2:	e8 5c 29 00 00       	call   4733 <unlink>
+  if(nc == 10000 && np == 10000){
+    1dd7:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+    1dda:	83 c4 10             	add    $0x10,%esp
+    1ddd:	81 fa 10 27 00 00    	cmp    $0x2710,%edx
+    1de3:	75 5b                	jne    1e40 <sharedfd+0x1a0>
+    1de5:	81 fb 10 27 00 00    	cmp    $0x2710,%ebx
+    1deb:	75 53                	jne    1e40 <sharedfd+0x1a0>
+    printf(1, "sharedfd ok\n");
+    1ded:	83 ec 08             	sub    $0x8,%esp
+    1df0:	68 a9 52 00 00       	push   $0x52a9
+    1df5:	6a 01                	push   $0x1
+    1df7:	e8 a4 2a 00 00       	call   48a0 <printf>
+    1dfc:	83 c4 10             	add    $0x10,%esp
+}
+    1dff:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    1e02:	5b                   	pop    %ebx
+    1e03:	5e                   	pop    %esi
+    1e04:	5f                   	pop    %edi
+    1e05:	5d                   	pop    %ebp
+    1e06:	c3                   	ret
+    printf(1, "fstests: cannot open sharedfd for writing");
+    1e07:	83 ec 08             	sub    $0x8,%esp
+    1e0a:	68 78 61 00 00       	push   $0x6178
+    1e0f:	6a 01                	push   $0x1
+    1e11:	e8 8a 2a 00 00       	call   48a0 <printf>
+    return;
+    1e16:	83 c4 10             	add    $0x10,%esp
+}
+    1e19:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    1e1c:	5b                   	pop    %ebx
+    1e1d:	5e                   	pop    %esi
+    1e1e:	5f                   	pop    %edi
+    1e1f:	5d                   	pop    %ebp
+    1e20:	c3                   	ret
+    printf(1, "fstests: cannot open sharedfd for reading\n");
+    1e21:	83 ec 08             	sub    $0x8,%esp
+    1e24:	68 c4 61 00 00       	push   $0x61c4
+    1e29:	6a 01                	push   $0x1
+    1e2b:	e8 70 2a 00 00       	call   48a0 <printf>
+    return;
+    1e30:	83 c4 10             	add    $0x10,%esp
+}
+    1e33:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    1e36:	5b                   	pop    %ebx
+    1e37:	5e                   	pop    %esi
+    1e38:	5f                   	pop    %edi
+    1e39:	5d                   	pop    %ebp
+    1e3a:	c3                   	ret
+    exit();
+    1e3b:	e8 a3 28 00 00       	call   46e3 <exit>
+    printf(1, "sharedfd oops %d %d\n", nc, np);
+    1e40:	53                   	push   %ebx
+    1e41:	52                   	push   %edx
+    1e42:	68 b6 52 00 00       	push   $0x52b6
+    1e47:	6a 01                	push   $0x1
+    1e49:	e8 52 2a 00 00       	call   48a0 <printf>
+    exit();
+    1e4e:	e8 90 28 00 00       	call   46e3 <exit>
+    1e53:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    1e5a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00001e60 <fourfiles>:
+{
+    1e60:	55                   	push   %ebp
+    1e61:	89 e5                	mov    %esp,%ebp
+    1e63:	57                   	push   %edi
+    1e64:	56                   	push   %esi
+    1e65:	53                   	push   %ebx
+  for(pi = 0; pi < 4; pi++){
+    1e66:	31 db                	xor    %ebx,%ebx
+{
+    1e68:	83 ec 34             	sub    $0x34,%esp
+  char *names[] = { "f0", "f1", "f2", "f3" };
+    1e6b:	c7 45 d8 cb 52 00 00 	movl   $0x52cb,-0x28(%ebp)
+    1e72:	c7 45 dc 14 54 00 00 	movl   $0x5414,-0x24(%ebp)
+    1e79:	c7 45 e0 18 54 00 00 	movl   $0x5418,-0x20(%ebp)
+    1e80:	c7 45 e4 ce 52 00 00 	movl   $0x52ce,-0x1c(%ebp)
+  printf(1, "fourfiles test\n");
+    1e87:	68 d1 52 00 00       	push   $0x52d1
+    1e8c:	6a 01                	push   $0x1
+    1e8e:	e8 0d 2a 00 00       	call   48a0 <printf>
+    1e93:	83 c4 10             	add    $0x10,%esp
+    fname = names[pi];
+    1e96:	8b 74 9d d8          	mov    -0x28(%ebp,%ebx,4),%esi
+    unlink(fname);
+    1e9a:	83 ec 0c             	sub    $0xc,%esp
+    1e9d:	56                   	push   %esi
+    1e9e:	e8 90 28 00 00       	call   4733 <unlink>
+    pid = fork();
+    1ea3:	e8 33 28 00 00       	call   46db <fork>
+    if(pid < 0){
+    1ea8:	83 c4 10             	add    $0x10,%esp
+    1eab:	85 c0                	test   %eax,%eax
+    1ead:	0f 88 65 01 00 00    	js     2018 <fourfiles+0x1b8>
+    if(pid == 0){
+    1eb3:	0f 84 eb 00 00 00    	je     1fa4 <fourfiles+0x144>
+  for(pi = 0; pi < 4; pi++){
+    1eb9:	83 c3 01             	add    $0x1,%ebx
+    1ebc:	83 fb 04             	cmp    $0x4,%ebx
+    1ebf:	75 d5                	jne    1e96 <fourfiles+0x36>
+    wait();
+    1ec1:	e8 25 28 00 00       	call   46eb <wait>
+  for(i = 0; i < 2; i++){
+    1ec6:	31 f6                	xor    %esi,%esi
+    wait();
+    1ec8:	e8 1e 28 00 00       	call   46eb <wait>
+    1ecd:	e8 19 28 00 00       	call   46eb <wait>
+    1ed2:	e8 14 28 00 00       	call   46eb <wait>
+    fname = names[i];
+    1ed7:	8b 5c b5 d8          	mov    -0x28(%ebp,%esi,4),%ebx
+    fd = open(fname, 0);
+    1edb:	83 ec 08             	sub    $0x8,%esp
+    total = 0;
+    1ede:	31 ff                	xor    %edi,%edi
+    fd = open(fname, 0);
+    1ee0:	6a 00                	push   $0x0
+    1ee2:	53                   	push   %ebx
+    1ee3:	e8 3b 28 00 00       	call   4723 <open>
+    while((n = read(fd, buf, sizeof(buf))) > 0){
+    1ee8:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+    1eeb:	83 c4 10             	add    $0x10,%esp
+    1eee:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+    1ef1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    1ef8:	83 ec 04             	sub    $0x4,%esp
+    1efb:	68 00 20 00 00       	push   $0x2000
+    1f00:	68 20 9a 00 00       	push   $0x9a20
+    1f05:	ff 75 d4             	push   -0x2c(%ebp)
+    1f08:	e8 ee 27 00 00       	call   46fb <read>
+    1f0d:	83 c4 10             	add    $0x10,%esp
+    1f10:	89 c3                	mov    %eax,%ebx
+    1f12:	85 c0                	test   %eax,%eax
+    1f14:	7e 28                	jle    1f3e <fourfiles+0xde>
+      for(j = 0; j < n; j++){
+    1f16:	31 c0                	xor    %eax,%eax
+    1f18:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    1f1f:	90                   	nop
+        if(buf[j] != '0'+i){
+    1f20:	83 fe 01             	cmp    $0x1,%esi
+    1f23:	0f be 88 20 9a 00 00 	movsbl 0x9a20(%eax),%ecx
+    1f2a:	19 d2                	sbb    %edx,%edx
+    1f2c:	83 c2 31             	add    $0x31,%edx
+    1f2f:	39 d1                	cmp    %edx,%ecx
+    1f31:	75 5d                	jne    1f90 <fourfiles+0x130>
+      for(j = 0; j < n; j++){
+    1f33:	83 c0 01             	add    $0x1,%eax
+    1f36:	39 c3                	cmp    %eax,%ebx
+    1f38:	75 e6                	jne    1f20 <fourfiles+0xc0>
+      total += n;
+    1f3a:	01 df                	add    %ebx,%edi
+    1f3c:	eb ba                	jmp    1ef8 <fourfiles+0x98>
+    close(fd);
+    1f3e:	8b 4d d4             	mov    -0x2c(%ebp),%ecx
+    1f41:	83 ec 0c             	sub    $0xc,%esp
+    1f44:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+    1f47:	51                   	push   %ecx
+    1f48:	e8 be 27 00 00       	call   470b <close>
+    if(total != 12*500){
+    1f4d:	83 c4 10             	add    $0x10,%esp
+    1f50:	81 ff 70 17 00 00    	cmp    $0x1770,%edi
+    1f56:	0f 85 d0 00 00 00    	jne    202c <fourfiles+0x1cc>
+    unlink(fname);
+    1f5c:	83 ec 0c             	sub    $0xc,%esp
+    1f5f:	53                   	push   %ebx
+    1f60:	e8 ce 27 00 00       	call   4733 <unlink>
+  for(i = 0; i < 2; i++){
+    1f65:	83 c4 10             	add    $0x10,%esp
+    1f68:	85 f6                	test   %esi,%esi
+    1f6a:	75 0a                	jne    1f76 <fourfiles+0x116>
+    1f6c:	be 01 00 00 00       	mov    $0x1,%esi
+    1f71:	e9 61 ff ff ff       	jmp    1ed7 <fourfiles+0x77>
+  printf(1, "fourfiles ok\n");
+    1f76:	83 ec 08             	sub    $0x8,%esp
+    1f79:	68 0f 53 00 00       	push   $0x530f
+    1f7e:	6a 01                	push   $0x1
+    1f80:	e8 1b 29 00 00       	call   48a0 <printf>
+}
+    1f85:	83 c4 10             	add    $0x10,%esp
+    1f88:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    1f8b:	5b                   	pop    %ebx
+    1f8c:	5e                   	pop    %esi
+    1f8d:	5f                   	pop    %edi
+    1f8e:	5d                   	pop    %ebp
+    1f8f:	c3                   	ret
+          printf(1, "wrong char\n");
+    1f90:	83 ec 08             	sub    $0x8,%esp
+    1f93:	68 f2 52 00 00       	push   $0x52f2
+    1f98:	6a 01                	push   $0x1
+    1f9a:	e8 01 29 00 00       	call   48a0 <printf>
+          exit();
+    1f9f:	e8 3f 27 00 00       	call   46e3 <exit>
+      fd = open(fname, O_CREATE | O_RDWR);
+    1fa4:	83 ec 08             	sub    $0x8,%esp
+    1fa7:	68 02 02 00 00       	push   $0x202
+    1fac:	56                   	push   %esi
+    1fad:	e8 71 27 00 00       	call   4723 <open>
+      if(fd < 0){
+    1fb2:	83 c4 10             	add    $0x10,%esp
+      fd = open(fname, O_CREATE | O_RDWR);
+    1fb5:	89 c6                	mov    %eax,%esi
+      if(fd < 0){
+    1fb7:	85 c0                	test   %eax,%eax
+    1fb9:	78 45                	js     2000 <fourfiles+0x1a0>
+      memset(buf, '0'+pi, 512);
+    1fbb:	83 ec 04             	sub    $0x4,%esp
+    1fbe:	83 c3 30             	add    $0x30,%ebx
+    1fc1:	68 00 02 00 00       	push   $0x200
+    1fc6:	53                   	push   %ebx
+    1fc7:	bb 0c 00 00 00       	mov    $0xc,%ebx
+    1fcc:	68 20 9a 00 00       	push   $0x9a20
+    1fd1:	e8 8a 25 00 00       	call   4560 <memset>
+    1fd6:	83 c4 10             	add    $0x10,%esp
+        if((n = write(fd, buf, 500)) != 500){
+    1fd9:	83 ec 04             	sub    $0x4,%esp
+    1fdc:	68 f4 01 00 00       	push   $0x1f4
+    1fe1:	68 20 9a 00 00       	push   $0x9a20
+    1fe6:	56                   	push   %esi
+    1fe7:	e8 17 27 00 00       	call   4703 <write>
+    1fec:	83 c4 10             	add    $0x10,%esp
+    1fef:	3d f4 01 00 00       	cmp    $0x1f4,%eax
+    1ff4:	75 49                	jne    203f <fourfiles+0x1df>
+      for(i = 0; i < 12; i++){
+    1ff6:	83 eb 01             	sub    $0x1,%ebx
+    1ff9:	75 de                	jne    1fd9 <fourfiles+0x179>
+      exit();
+    1ffb:	e8 e3 26 00 00       	call   46e3 <exit>
+        printf(1, "create failed\n");
+    2000:	51                   	push   %ecx
+    2001:	51                   	push   %ecx
+    2002:	68 6c 55 00 00       	push   $0x556c
+    2007:	6a 01                	push   $0x1
+    2009:	e8 92 28 00 00       	call   48a0 <printf>
+        exit();
+    200e:	e8 d0 26 00 00       	call   46e3 <exit>
+    2013:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    2017:	90                   	nop
+      printf(1, "fork failed\n");
+    2018:	83 ec 08             	sub    $0x8,%esp
+    201b:	68 a6 5d 00 00       	push   $0x5da6
+    2020:	6a 01                	push   $0x1
+    2022:	e8 79 28 00 00       	call   48a0 <printf>
+      exit();
+    2027:	e8 b7 26 00 00       	call   46e3 <exit>
+      printf(1, "wrong length %d\n", total);
+    202c:	50                   	push   %eax
+    202d:	57                   	push   %edi
+    202e:	68 fe 52 00 00       	push   $0x52fe
+    2033:	6a 01                	push   $0x1
+    2035:	e8 66 28 00 00       	call   48a0 <printf>
+      exit();
+    203a:	e8 a4 26 00 00       	call   46e3 <exit>
+          printf(1, "write failed %d\n", n);
+    203f:	52                   	push   %edx
+    2040:	50                   	push   %eax
+    2041:	68 e1 52 00 00       	push   $0x52e1
+    2046:	6a 01                	push   $0x1
+    2048:	e8 53 28 00 00       	call   48a0 <printf>
+          exit();
+    204d:	e8 91 26 00 00       	call   46e3 <exit>
+    2052:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    2059:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00002060 <createdelete>:
+{
+    2060:	55                   	push   %ebp
+    2061:	89 e5                	mov    %esp,%ebp
+    2063:	57                   	push   %edi
+    2064:	56                   	push   %esi
+  for(pi = 0; pi < 4; pi++){
+    2065:	31 f6                	xor    %esi,%esi
+{
+    2067:	53                   	push   %ebx
+    2068:	83 ec 44             	sub    $0x44,%esp
+  printf(1, "createdelete test\n");
+    206b:	68 1d 53 00 00       	push   $0x531d
+    2070:	6a 01                	push   $0x1
+    2072:	e8 29 28 00 00       	call   48a0 <printf>
+    2077:	83 c4 10             	add    $0x10,%esp
+    pid = fork();
+    207a:	e8 5c 26 00 00       	call   46db <fork>
+    207f:	89 c3                	mov    %eax,%ebx
+    if(pid < 0){
+    2081:	85 c0                	test   %eax,%eax
+    2083:	0f 88 ac 01 00 00    	js     2235 <createdelete+0x1d5>
+    if(pid == 0){
+    2089:	0f 84 01 01 00 00    	je     2190 <createdelete+0x130>
+  for(pi = 0; pi < 4; pi++){
+    208f:	83 c6 01             	add    $0x1,%esi
+    2092:	83 fe 04             	cmp    $0x4,%esi
+    2095:	75 e3                	jne    207a <createdelete+0x1a>
+    wait();
+    2097:	e8 4f 26 00 00       	call   46eb <wait>
+  for(i = 0; i < N; i++){
+    209c:	31 ff                	xor    %edi,%edi
+    209e:	8d 75 c8             	lea    -0x38(%ebp),%esi
+    wait();
+    20a1:	e8 45 26 00 00       	call   46eb <wait>
+    20a6:	e8 40 26 00 00       	call   46eb <wait>
+    20ab:	e8 3b 26 00 00       	call   46eb <wait>
+  name[0] = name[1] = name[2] = 0;
+    20b0:	c6 45 ca 00          	movb   $0x0,-0x36(%ebp)
+  for(i = 0; i < N; i++){
+    20b4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+      if((i == 0 || i >= N/2) && fd < 0){
+    20b8:	85 ff                	test   %edi,%edi
+      name[1] = '0' + i;
+    20ba:	8d 47 30             	lea    0x30(%edi),%eax
+      if((i == 0 || i >= N/2) && fd < 0){
+    20bd:	bb 70 00 00 00       	mov    $0x70,%ebx
+    20c2:	0f 94 c2             	sete   %dl
+    20c5:	83 ff 09             	cmp    $0x9,%edi
+      name[1] = '0' + i;
+    20c8:	88 45 c6             	mov    %al,-0x3a(%ebp)
+      if((i == 0 || i >= N/2) && fd < 0){
+    20cb:	0f 9f c0             	setg   %al
+    20ce:	09 c2                	or     %eax,%edx
+    20d0:	88 55 c7             	mov    %dl,-0x39(%ebp)
+      name[1] = '0' + i;
+    20d3:	0f b6 45 c6          	movzbl -0x3a(%ebp),%eax
+      fd = open(name, 0);
+    20d7:	83 ec 08             	sub    $0x8,%esp
+      name[0] = 'p' + pi;
+    20da:	88 5d c8             	mov    %bl,-0x38(%ebp)
+      name[1] = '0' + i;
+    20dd:	88 45 c9             	mov    %al,-0x37(%ebp)
+      fd = open(name, 0);
+    20e0:	6a 00                	push   $0x0
+    20e2:	56                   	push   %esi
+    20e3:	e8 3b 26 00 00       	call   4723 <open>
+      if((i == 0 || i >= N/2) && fd < 0){
+    20e8:	83 c4 10             	add    $0x10,%esp
+    20eb:	80 7d c7 00          	cmpb   $0x0,-0x39(%ebp)
+    20ef:	74 7f                	je     2170 <createdelete+0x110>
+    20f1:	85 c0                	test   %eax,%eax
+    20f3:	0f 88 27 01 00 00    	js     2220 <createdelete+0x1c0>
+        close(fd);
+    20f9:	83 ec 0c             	sub    $0xc,%esp
+    20fc:	50                   	push   %eax
+    20fd:	e8 09 26 00 00       	call   470b <close>
+    2102:	83 c4 10             	add    $0x10,%esp
+    for(pi = 0; pi < 4; pi++){
+    2105:	83 c3 01             	add    $0x1,%ebx
+    2108:	80 fb 74             	cmp    $0x74,%bl
+    210b:	75 c6                	jne    20d3 <createdelete+0x73>
+  for(i = 0; i < N; i++){
+    210d:	83 c7 01             	add    $0x1,%edi
+    2110:	83 ff 14             	cmp    $0x14,%edi
+    2113:	75 a3                	jne    20b8 <createdelete+0x58>
+    2115:	bf 70 00 00 00       	mov    $0x70,%edi
+    211a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+      name[1] = '0' + i;
+    2120:	8d 47 c0             	lea    -0x40(%edi),%eax
+    2123:	bb 04 00 00 00       	mov    $0x4,%ebx
+    2128:	88 45 c7             	mov    %al,-0x39(%ebp)
+      name[0] = 'p' + i;
+    212b:	89 f8                	mov    %edi,%eax
+      unlink(name);
+    212d:	83 ec 0c             	sub    $0xc,%esp
+      name[0] = 'p' + i;
+    2130:	88 45 c8             	mov    %al,-0x38(%ebp)
+      name[1] = '0' + i;
+    2133:	0f b6 45 c7          	movzbl -0x39(%ebp),%eax
+    2137:	88 45 c9             	mov    %al,-0x37(%ebp)
+      unlink(name);
+    213a:	56                   	push   %esi
+    213b:	e8 f3 25 00 00       	call   4733 <unlink>
+    for(pi = 0; pi < 4; pi++){
+    2140:	83 c4 10             	add    $0x10,%esp
+    2143:	83 eb 01             	sub    $0x1,%ebx
+    2146:	75 e3                	jne    212b <createdelete+0xcb>
+  for(i = 0; i < N; i++){
+    2148:	83 c7 01             	add    $0x1,%edi
+    214b:	89 f8                	mov    %edi,%eax
+    214d:	3c 84                	cmp    $0x84,%al
+    214f:	75 cf                	jne    2120 <createdelete+0xc0>
+  printf(1, "createdelete ok\n");
+    2151:	83 ec 08             	sub    $0x8,%esp
+    2154:	68 30 53 00 00       	push   $0x5330
+    2159:	6a 01                	push   $0x1
+    215b:	e8 40 27 00 00       	call   48a0 <printf>
+}
+    2160:	83 c4 10             	add    $0x10,%esp
+    2163:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    2166:	5b                   	pop    %ebx
+    2167:	5e                   	pop    %esi
+    2168:	5f                   	pop    %edi
+    2169:	5d                   	pop    %ebp
+    216a:	c3                   	ret
+    216b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    216f:	90                   	nop
+      } else if((i >= 1 && i < N/2) && fd >= 0){
+    2170:	85 c0                	test   %eax,%eax
+    2172:	78 91                	js     2105 <createdelete+0xa5>
+        printf(1, "oops createdelete %s did exist\n", name);
+    2174:	50                   	push   %eax
+    2175:	56                   	push   %esi
+    2176:	68 14 62 00 00       	push   $0x6214
+    217b:	6a 01                	push   $0x1
+    217d:	e8 1e 27 00 00       	call   48a0 <printf>
+        exit();
+    2182:	e8 5c 25 00 00       	call   46e3 <exit>
+    2187:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    218e:	66 90                	xchg   %ax,%ax
+      name[0] = 'p' + pi;
+    2190:	8d 46 70             	lea    0x70(%esi),%eax
+      name[2] = '\0';
+    2193:	c6 45 ca 00          	movb   $0x0,-0x36(%ebp)
+    2197:	8d 75 c8             	lea    -0x38(%ebp),%esi
+      name[0] = 'p' + pi;
+    219a:	88 45 c8             	mov    %al,-0x38(%ebp)
+      for(i = 0; i < N; i++){
+    219d:	8d 76 00             	lea    0x0(%esi),%esi
+        fd = open(name, O_CREATE | O_RDWR);
+    21a0:	83 ec 08             	sub    $0x8,%esp
+        name[1] = '0' + i;
+    21a3:	8d 43 30             	lea    0x30(%ebx),%eax
+    21a6:	88 45 c9             	mov    %al,-0x37(%ebp)
+        fd = open(name, O_CREATE | O_RDWR);
+    21a9:	68 02 02 00 00       	push   $0x202
+    21ae:	56                   	push   %esi
+    21af:	e8 6f 25 00 00       	call   4723 <open>
+        if(fd < 0){
+    21b4:	83 c4 10             	add    $0x10,%esp
+    21b7:	85 c0                	test   %eax,%eax
+    21b9:	0f 88 8a 00 00 00    	js     2249 <createdelete+0x1e9>
+        close(fd);
+    21bf:	83 ec 0c             	sub    $0xc,%esp
+    21c2:	50                   	push   %eax
+    21c3:	e8 43 25 00 00       	call   470b <close>
+        if(i > 0 && (i % 2 ) == 0){
+    21c8:	83 c4 10             	add    $0x10,%esp
+    21cb:	85 db                	test   %ebx,%ebx
+    21cd:	74 19                	je     21e8 <createdelete+0x188>
+    21cf:	f6 c3 01             	test   $0x1,%bl
+    21d2:	74 1b                	je     21ef <createdelete+0x18f>
+      for(i = 0; i < N; i++){
+    21d4:	83 c3 01             	add    $0x1,%ebx
+    21d7:	83 fb 14             	cmp    $0x14,%ebx
+    21da:	75 c4                	jne    21a0 <createdelete+0x140>
+      exit();
+    21dc:	e8 02 25 00 00       	call   46e3 <exit>
+    21e1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+      for(i = 0; i < N; i++){
+    21e8:	bb 01 00 00 00       	mov    $0x1,%ebx
+    21ed:	eb b1                	jmp    21a0 <createdelete+0x140>
+          name[1] = '0' + (i / 2);
+    21ef:	89 d8                	mov    %ebx,%eax
+          if(unlink(name) < 0){
+    21f1:	83 ec 0c             	sub    $0xc,%esp
+          name[1] = '0' + (i / 2);
+    21f4:	d1 f8                	sar    %eax
+    21f6:	83 c0 30             	add    $0x30,%eax
+    21f9:	88 45 c9             	mov    %al,-0x37(%ebp)
+          if(unlink(name) < 0){
+    21fc:	56                   	push   %esi
+    21fd:	e8 31 25 00 00       	call   4733 <unlink>
+    2202:	83 c4 10             	add    $0x10,%esp
+    2205:	85 c0                	test   %eax,%eax
+    2207:	79 cb                	jns    21d4 <createdelete+0x174>
+            printf(1, "unlink failed\n");
+    2209:	52                   	push   %edx
+    220a:	52                   	push   %edx
+    220b:	68 81 4c 00 00       	push   $0x4c81
+    2210:	6a 01                	push   $0x1
+    2212:	e8 89 26 00 00       	call   48a0 <printf>
+            exit();
+    2217:	e8 c7 24 00 00       	call   46e3 <exit>
+    221c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+        printf(1, "oops createdelete %s didn't exist\n", name);
+    2220:	83 ec 04             	sub    $0x4,%esp
+    2223:	56                   	push   %esi
+    2224:	68 f0 61 00 00       	push   $0x61f0
+    2229:	6a 01                	push   $0x1
+    222b:	e8 70 26 00 00       	call   48a0 <printf>
+        exit();
+    2230:	e8 ae 24 00 00       	call   46e3 <exit>
+      printf(1, "fork failed\n");
+    2235:	83 ec 08             	sub    $0x8,%esp
+    2238:	68 a6 5d 00 00       	push   $0x5da6
+    223d:	6a 01                	push   $0x1
+    223f:	e8 5c 26 00 00       	call   48a0 <printf>
+      exit();
+    2244:	e8 9a 24 00 00       	call   46e3 <exit>
+          printf(1, "create failed\n");
+    2249:	83 ec 08             	sub    $0x8,%esp
+    224c:	68 6c 55 00 00       	push   $0x556c
+    2251:	6a 01                	push   $0x1
+    2253:	e8 48 26 00 00       	call   48a0 <printf>
+          exit();
+    2258:	e8 86 24 00 00       	call   46e3 <exit>
+    225d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00002260 <unlinkread>:
+{
+    2260:	55                   	push   %ebp
+    2261:	89 e5                	mov    %esp,%ebp
+    2263:	56                   	push   %esi
+    2264:	53                   	push   %ebx
+  printf(1, "unlinkread test\n");
+    2265:	83 ec 08             	sub    $0x8,%esp
+    2268:	68 41 53 00 00       	push   $0x5341
+    226d:	6a 01                	push   $0x1
+    226f:	e8 2c 26 00 00       	call   48a0 <printf>
+  fd = open("unlinkread", O_CREATE | O_RDWR);
+    2274:	5b                   	pop    %ebx
+    2275:	5e                   	pop    %esi
+    2276:	68 02 02 00 00       	push   $0x202
+    227b:	68 52 53 00 00       	push   $0x5352
+    2280:	e8 9e 24 00 00       	call   4723 <open>
+  if(fd < 0){
+    2285:	83 c4 10             	add    $0x10,%esp
+    2288:	85 c0                	test   %eax,%eax
+    228a:	0f 88 e6 00 00 00    	js     2376 <unlinkread+0x116>
+  write(fd, "hello", 5);
+    2290:	83 ec 04             	sub    $0x4,%esp
+    2293:	89 c3                	mov    %eax,%ebx
+    2295:	6a 05                	push   $0x5
+    2297:	68 77 53 00 00       	push   $0x5377
+    229c:	50                   	push   %eax
+    229d:	e8 61 24 00 00       	call   4703 <write>
+  close(fd);
+    22a2:	89 1c 24             	mov    %ebx,(%esp)
+    22a5:	e8 61 24 00 00       	call   470b <close>
+  fd = open("unlinkread", O_RDWR);
+    22aa:	58                   	pop    %eax
+    22ab:	5a                   	pop    %edx
+    22ac:	6a 02                	push   $0x2
+    22ae:	68 52 53 00 00       	push   $0x5352
+    22b3:	e8 6b 24 00 00       	call   4723 <open>
+  if(fd < 0){
+    22b8:	83 c4 10             	add    $0x10,%esp
+  fd = open("unlinkread", O_RDWR);
+    22bb:	89 c3                	mov    %eax,%ebx
+  if(fd < 0){
+    22bd:	85 c0                	test   %eax,%eax
+    22bf:	0f 88 10 01 00 00    	js     23d5 <unlinkread+0x175>
+  if(unlink("unlinkread") != 0){
+    22c5:	83 ec 0c             	sub    $0xc,%esp
+    22c8:	68 52 53 00 00       	push   $0x5352
+    22cd:	e8 61 24 00 00       	call   4733 <unlink>
+    22d2:	83 c4 10             	add    $0x10,%esp
+    22d5:	85 c0                	test   %eax,%eax
+    22d7:	0f 85 e5 00 00 00    	jne    23c2 <unlinkread+0x162>
+  fd1 = open("unlinkread", O_CREATE | O_RDWR);
+    22dd:	83 ec 08             	sub    $0x8,%esp
+    22e0:	68 02 02 00 00       	push   $0x202
+    22e5:	68 52 53 00 00       	push   $0x5352
+    22ea:	e8 34 24 00 00       	call   4723 <open>
+  write(fd1, "yyy", 3);
+    22ef:	83 c4 0c             	add    $0xc,%esp
+    22f2:	6a 03                	push   $0x3
+  fd1 = open("unlinkread", O_CREATE | O_RDWR);
+    22f4:	89 c6                	mov    %eax,%esi
+  write(fd1, "yyy", 3);
+    22f6:	68 af 53 00 00       	push   $0x53af
+    22fb:	50                   	push   %eax
+    22fc:	e8 02 24 00 00       	call   4703 <write>
+  close(fd1);
+    2301:	89 34 24             	mov    %esi,(%esp)
+    2304:	e8 02 24 00 00       	call   470b <close>
+  if(read(fd, buf, sizeof(buf)) != 5){
+    2309:	83 c4 0c             	add    $0xc,%esp
+    230c:	68 00 20 00 00       	push   $0x2000
+    2311:	68 20 9a 00 00       	push   $0x9a20
+    2316:	53                   	push   %ebx
+    2317:	e8 df 23 00 00       	call   46fb <read>
+    231c:	83 c4 10             	add    $0x10,%esp
+    231f:	83 f8 05             	cmp    $0x5,%eax
+    2322:	0f 85 87 00 00 00    	jne    23af <unlinkread+0x14f>
+  if(buf[0] != 'h'){
+    2328:	80 3d 20 9a 00 00 68 	cmpb   $0x68,0x9a20
+    232f:	75 6b                	jne    239c <unlinkread+0x13c>
+  if(write(fd, buf, 10) != 10){
+    2331:	83 ec 04             	sub    $0x4,%esp
+    2334:	6a 0a                	push   $0xa
+    2336:	68 20 9a 00 00       	push   $0x9a20
+    233b:	53                   	push   %ebx
+    233c:	e8 c2 23 00 00       	call   4703 <write>
+    2341:	83 c4 10             	add    $0x10,%esp
+    2344:	83 f8 0a             	cmp    $0xa,%eax
+    2347:	75 40                	jne    2389 <unlinkread+0x129>
+  close(fd);
+    2349:	83 ec 0c             	sub    $0xc,%esp
+    234c:	53                   	push   %ebx
+    234d:	e8 b9 23 00 00       	call   470b <close>
+  unlink("unlinkread");
+    2352:	c7 04 24 52 53 00 00 	movl   $0x5352,(%esp)
+    2359:	e8 d5 23 00 00       	call   4733 <unlink>
+  printf(1, "unlinkread ok\n");
+    235e:	58                   	pop    %eax
+    235f:	5a                   	pop    %edx
+    2360:	68 fa 53 00 00       	push   $0x53fa
+    2365:	6a 01                	push   $0x1
+    2367:	e8 34 25 00 00       	call   48a0 <printf>
+}
+    236c:	83 c4 10             	add    $0x10,%esp
+    236f:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    2372:	5b                   	pop    %ebx
+    2373:	5e                   	pop    %esi
+    2374:	5d                   	pop    %ebp
+    2375:	c3                   	ret
+    printf(1, "create unlinkread failed\n");
+    2376:	51                   	push   %ecx
+    2377:	51                   	push   %ecx
+    2378:	68 5d 53 00 00       	push   $0x535d
+    237d:	6a 01                	push   $0x1
+    237f:	e8 1c 25 00 00       	call   48a0 <printf>
+    exit();
+    2384:	e8 5a 23 00 00       	call   46e3 <exit>
+    printf(1, "unlinkread write failed\n");
+    2389:	51                   	push   %ecx
+    238a:	51                   	push   %ecx
+    238b:	68 e1 53 00 00       	push   $0x53e1
+    2390:	6a 01                	push   $0x1
+    2392:	e8 09 25 00 00       	call   48a0 <printf>
+    exit();
+    2397:	e8 47 23 00 00       	call   46e3 <exit>
+    printf(1, "unlinkread wrong data\n");
+    239c:	53                   	push   %ebx
+    239d:	53                   	push   %ebx
+    239e:	68 ca 53 00 00       	push   $0x53ca
+    23a3:	6a 01                	push   $0x1
+    23a5:	e8 f6 24 00 00       	call   48a0 <printf>
+    exit();
+    23aa:	e8 34 23 00 00       	call   46e3 <exit>
+    printf(1, "unlinkread read failed");
+    23af:	56                   	push   %esi
+    23b0:	56                   	push   %esi
+    23b1:	68 b3 53 00 00       	push   $0x53b3
+    23b6:	6a 01                	push   $0x1
+    23b8:	e8 e3 24 00 00       	call   48a0 <printf>
+    exit();
+    23bd:	e8 21 23 00 00       	call   46e3 <exit>
+    printf(1, "unlink unlinkread failed\n");
+    23c2:	50                   	push   %eax
+    23c3:	50                   	push   %eax
+    23c4:	68 95 53 00 00       	push   $0x5395
+    23c9:	6a 01                	push   $0x1
+    23cb:	e8 d0 24 00 00       	call   48a0 <printf>
+    exit();
+    23d0:	e8 0e 23 00 00       	call   46e3 <exit>
+    printf(1, "open unlinkread failed\n");
+    23d5:	50                   	push   %eax
+    23d6:	50                   	push   %eax
+    23d7:	68 7d 53 00 00       	push   $0x537d
+    23dc:	6a 01                	push   $0x1
+    23de:	e8 bd 24 00 00       	call   48a0 <printf>
+    exit();
+    23e3:	e8 fb 22 00 00       	call   46e3 <exit>
+    23e8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    23ef:	90                   	nop
+
+000023f0 <linktest>:
+{
+    23f0:	55                   	push   %ebp
+    23f1:	89 e5                	mov    %esp,%ebp
+    23f3:	53                   	push   %ebx
+    23f4:	83 ec 0c             	sub    $0xc,%esp
+  printf(1, "linktest\n");
+    23f7:	68 09 54 00 00       	push   $0x5409
+    23fc:	6a 01                	push   $0x1
+    23fe:	e8 9d 24 00 00       	call   48a0 <printf>
+  unlink("lf1");
+    2403:	c7 04 24 13 54 00 00 	movl   $0x5413,(%esp)
+    240a:	e8 24 23 00 00       	call   4733 <unlink>
+  unlink("lf2");
+    240f:	c7 04 24 17 54 00 00 	movl   $0x5417,(%esp)
+    2416:	e8 18 23 00 00       	call   4733 <unlink>
+  fd = open("lf1", O_CREATE|O_RDWR);
+    241b:	58                   	pop    %eax
+    241c:	5a                   	pop    %edx
+    241d:	68 02 02 00 00       	push   $0x202
+    2422:	68 13 54 00 00       	push   $0x5413
+    2427:	e8 f7 22 00 00       	call   4723 <open>
+  if(fd < 0){
+    242c:	83 c4 10             	add    $0x10,%esp
+    242f:	85 c0                	test   %eax,%eax
+    2431:	0f 88 1e 01 00 00    	js     2555 <linktest+0x165>
+  if(write(fd, "hello", 5) != 5){
+    2437:	83 ec 04             	sub    $0x4,%esp
+    243a:	89 c3                	mov    %eax,%ebx
+    243c:	6a 05                	push   $0x5
+    243e:	68 77 53 00 00       	push   $0x5377
+    2443:	50                   	push   %eax
+    2444:	e8 ba 22 00 00       	call   4703 <write>
+    2449:	83 c4 10             	add    $0x10,%esp
+    244c:	83 f8 05             	cmp    $0x5,%eax
+    244f:	0f 85 98 01 00 00    	jne    25ed <linktest+0x1fd>
+  close(fd);
+    2455:	83 ec 0c             	sub    $0xc,%esp
+    2458:	53                   	push   %ebx
+    2459:	e8 ad 22 00 00       	call   470b <close>
+  if(link("lf1", "lf2") < 0){
+    245e:	5b                   	pop    %ebx
+    245f:	58                   	pop    %eax
+    2460:	68 17 54 00 00       	push   $0x5417
+    2465:	68 13 54 00 00       	push   $0x5413
+    246a:	e8 d4 22 00 00       	call   4743 <link>
+    246f:	83 c4 10             	add    $0x10,%esp
+    2472:	85 c0                	test   %eax,%eax
+    2474:	0f 88 60 01 00 00    	js     25da <linktest+0x1ea>
+  unlink("lf1");
+    247a:	83 ec 0c             	sub    $0xc,%esp
+    247d:	68 13 54 00 00       	push   $0x5413
+    2482:	e8 ac 22 00 00       	call   4733 <unlink>
+  if(open("lf1", 0) >= 0){
+    2487:	58                   	pop    %eax
+    2488:	5a                   	pop    %edx
+    2489:	6a 00                	push   $0x0
+    248b:	68 13 54 00 00       	push   $0x5413
+    2490:	e8 8e 22 00 00       	call   4723 <open>
+    2495:	83 c4 10             	add    $0x10,%esp
+    2498:	85 c0                	test   %eax,%eax
+    249a:	0f 89 27 01 00 00    	jns    25c7 <linktest+0x1d7>
+  fd = open("lf2", 0);
+    24a0:	83 ec 08             	sub    $0x8,%esp
+    24a3:	6a 00                	push   $0x0
+    24a5:	68 17 54 00 00       	push   $0x5417
+    24aa:	e8 74 22 00 00       	call   4723 <open>
+  if(fd < 0){
+    24af:	83 c4 10             	add    $0x10,%esp
+  fd = open("lf2", 0);
+    24b2:	89 c3                	mov    %eax,%ebx
+  if(fd < 0){
+    24b4:	85 c0                	test   %eax,%eax
+    24b6:	0f 88 f8 00 00 00    	js     25b4 <linktest+0x1c4>
+  if(read(fd, buf, sizeof(buf)) != 5){
+    24bc:	83 ec 04             	sub    $0x4,%esp
+    24bf:	68 00 20 00 00       	push   $0x2000
+    24c4:	68 20 9a 00 00       	push   $0x9a20
+    24c9:	50                   	push   %eax
+    24ca:	e8 2c 22 00 00       	call   46fb <read>
+    24cf:	83 c4 10             	add    $0x10,%esp
+    24d2:	83 f8 05             	cmp    $0x5,%eax
+    24d5:	0f 85 c6 00 00 00    	jne    25a1 <linktest+0x1b1>
+  close(fd);
+    24db:	83 ec 0c             	sub    $0xc,%esp
+    24de:	53                   	push   %ebx
+    24df:	e8 27 22 00 00       	call   470b <close>
+  if(link("lf2", "lf2") >= 0){
+    24e4:	58                   	pop    %eax
+    24e5:	5a                   	pop    %edx
+    24e6:	68 17 54 00 00       	push   $0x5417
+    24eb:	68 17 54 00 00       	push   $0x5417
+    24f0:	e8 4e 22 00 00       	call   4743 <link>
+    24f5:	83 c4 10             	add    $0x10,%esp
+    24f8:	85 c0                	test   %eax,%eax
+    24fa:	0f 89 8e 00 00 00    	jns    258e <linktest+0x19e>
+  unlink("lf2");
+    2500:	83 ec 0c             	sub    $0xc,%esp
+    2503:	68 17 54 00 00       	push   $0x5417
+    2508:	e8 26 22 00 00       	call   4733 <unlink>
+  if(link("lf2", "lf1") >= 0){
+    250d:	59                   	pop    %ecx
+    250e:	5b                   	pop    %ebx
+    250f:	68 13 54 00 00       	push   $0x5413
+    2514:	68 17 54 00 00       	push   $0x5417
+    2519:	e8 25 22 00 00       	call   4743 <link>
+    251e:	83 c4 10             	add    $0x10,%esp
+    2521:	85 c0                	test   %eax,%eax
+    2523:	79 56                	jns    257b <linktest+0x18b>
+  if(link(".", "lf1") >= 0){
+    2525:	83 ec 08             	sub    $0x8,%esp
+    2528:	68 13 54 00 00       	push   $0x5413
+    252d:	68 db 56 00 00       	push   $0x56db
+    2532:	e8 0c 22 00 00       	call   4743 <link>
+    2537:	83 c4 10             	add    $0x10,%esp
+    253a:	85 c0                	test   %eax,%eax
+    253c:	79 2a                	jns    2568 <linktest+0x178>
+  printf(1, "linktest ok\n");
+    253e:	83 ec 08             	sub    $0x8,%esp
+    2541:	68 b1 54 00 00       	push   $0x54b1
+    2546:	6a 01                	push   $0x1
+    2548:	e8 53 23 00 00       	call   48a0 <printf>
+}
+    254d:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    2550:	83 c4 10             	add    $0x10,%esp
+    2553:	c9                   	leave
+    2554:	c3                   	ret
+    printf(1, "create lf1 failed\n");
+    2555:	50                   	push   %eax
+    2556:	50                   	push   %eax
+    2557:	68 1b 54 00 00       	push   $0x541b
+    255c:	6a 01                	push   $0x1
+    255e:	e8 3d 23 00 00       	call   48a0 <printf>
+    exit();
+    2563:	e8 7b 21 00 00       	call   46e3 <exit>
+    printf(1, "link . lf1 succeeded! oops\n");
+    2568:	50                   	push   %eax
+    2569:	50                   	push   %eax
+    256a:	68 95 54 00 00       	push   $0x5495
+    256f:	6a 01                	push   $0x1
+    2571:	e8 2a 23 00 00       	call   48a0 <printf>
+    exit();
+    2576:	e8 68 21 00 00       	call   46e3 <exit>
+    printf(1, "link non-existant succeeded! oops\n");
+    257b:	52                   	push   %edx
+    257c:	52                   	push   %edx
+    257d:	68 5c 62 00 00       	push   $0x625c
+    2582:	6a 01                	push   $0x1
+    2584:	e8 17 23 00 00       	call   48a0 <printf>
+    exit();
+    2589:	e8 55 21 00 00       	call   46e3 <exit>
+    printf(1, "link lf2 lf2 succeeded! oops\n");
+    258e:	50                   	push   %eax
+    258f:	50                   	push   %eax
+    2590:	68 77 54 00 00       	push   $0x5477
+    2595:	6a 01                	push   $0x1
+    2597:	e8 04 23 00 00       	call   48a0 <printf>
+    exit();
+    259c:	e8 42 21 00 00       	call   46e3 <exit>
+    printf(1, "read lf2 failed\n");
+    25a1:	51                   	push   %ecx
+    25a2:	51                   	push   %ecx
+    25a3:	68 66 54 00 00       	push   $0x5466
+    25a8:	6a 01                	push   $0x1
+    25aa:	e8 f1 22 00 00       	call   48a0 <printf>
+    exit();
+    25af:	e8 2f 21 00 00       	call   46e3 <exit>
+    printf(1, "open lf2 failed\n");
+    25b4:	53                   	push   %ebx
+    25b5:	53                   	push   %ebx
+    25b6:	68 55 54 00 00       	push   $0x5455
+    25bb:	6a 01                	push   $0x1
+    25bd:	e8 de 22 00 00       	call   48a0 <printf>
+    exit();
+    25c2:	e8 1c 21 00 00       	call   46e3 <exit>
+    printf(1, "unlinked lf1 but it is still there!\n");
+    25c7:	50                   	push   %eax
+    25c8:	50                   	push   %eax
+    25c9:	68 34 62 00 00       	push   $0x6234
+    25ce:	6a 01                	push   $0x1
+    25d0:	e8 cb 22 00 00       	call   48a0 <printf>
+    exit();
+    25d5:	e8 09 21 00 00       	call   46e3 <exit>
+    printf(1, "link lf1 lf2 failed\n");
+    25da:	51                   	push   %ecx
+    25db:	51                   	push   %ecx
+    25dc:	68 40 54 00 00       	push   $0x5440
+    25e1:	6a 01                	push   $0x1
+    25e3:	e8 b8 22 00 00       	call   48a0 <printf>
+    exit();
+    25e8:	e8 f6 20 00 00       	call   46e3 <exit>
+    printf(1, "write lf1 failed\n");
+    25ed:	50                   	push   %eax
+    25ee:	50                   	push   %eax
+    25ef:	68 2e 54 00 00       	push   $0x542e
+    25f4:	6a 01                	push   $0x1
+    25f6:	e8 a5 22 00 00       	call   48a0 <printf>
+    exit();
+    25fb:	e8 e3 20 00 00       	call   46e3 <exit>
+
+00002600 <concreate>:
+{
+    2600:	55                   	push   %ebp
+    2601:	89 e5                	mov    %esp,%ebp
+    2603:	57                   	push   %edi
+    2604:	56                   	push   %esi
+  for(i = 0; i < 40; i++){
+    2605:	31 f6                	xor    %esi,%esi
+{
+    2607:	53                   	push   %ebx
+    2608:	8d 5d ad             	lea    -0x53(%ebp),%ebx
+    260b:	83 ec 64             	sub    $0x64,%esp
+  printf(1, "concreate test\n");
+    260e:	68 be 54 00 00       	push   $0x54be
+    2613:	6a 01                	push   $0x1
+    2615:	e8 86 22 00 00       	call   48a0 <printf>
+  file[0] = 'C';
+    261a:	c6 45 ad 43          	movb   $0x43,-0x53(%ebp)
+  file[2] = '\0';
+    261e:	83 c4 10             	add    $0x10,%esp
+    2621:	c6 45 af 00          	movb   $0x0,-0x51(%ebp)
+  for(i = 0; i < 40; i++){
+    2625:	eb 4c                	jmp    2673 <concreate+0x73>
+    2627:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    262e:	66 90                	xchg   %ax,%ax
+    2630:	69 c6 ab aa aa aa    	imul   $0xaaaaaaab,%esi,%eax
+    if(pid && (i % 3) == 1){
+    2636:	3d ab aa aa aa       	cmp    $0xaaaaaaab,%eax
+    263b:	0f 83 8f 00 00 00    	jae    26d0 <concreate+0xd0>
+      fd = open(file, O_CREATE | O_RDWR);
+    2641:	83 ec 08             	sub    $0x8,%esp
+    2644:	68 02 02 00 00       	push   $0x202
+    2649:	53                   	push   %ebx
+    264a:	e8 d4 20 00 00       	call   4723 <open>
+      if(fd < 0){
+    264f:	83 c4 10             	add    $0x10,%esp
+    2652:	85 c0                	test   %eax,%eax
+    2654:	78 63                	js     26b9 <concreate+0xb9>
+      close(fd);
+    2656:	83 ec 0c             	sub    $0xc,%esp
+  for(i = 0; i < 40; i++){
+    2659:	83 c6 01             	add    $0x1,%esi
+      close(fd);
+    265c:	50                   	push   %eax
+    265d:	e8 a9 20 00 00       	call   470b <close>
+    2662:	83 c4 10             	add    $0x10,%esp
+      wait();
+    2665:	e8 81 20 00 00       	call   46eb <wait>
+  for(i = 0; i < 40; i++){
+    266a:	83 fe 28             	cmp    $0x28,%esi
+    266d:	0f 84 7f 00 00 00    	je     26f2 <concreate+0xf2>
+    unlink(file);
+    2673:	83 ec 0c             	sub    $0xc,%esp
+    file[1] = '0' + i;
+    2676:	8d 46 30             	lea    0x30(%esi),%eax
+    2679:	88 45 ae             	mov    %al,-0x52(%ebp)
+    unlink(file);
+    267c:	53                   	push   %ebx
+    267d:	e8 b1 20 00 00       	call   4733 <unlink>
+    pid = fork();
+    2682:	e8 54 20 00 00       	call   46db <fork>
+    if(pid && (i % 3) == 1){
+    2687:	83 c4 10             	add    $0x10,%esp
+    268a:	85 c0                	test   %eax,%eax
+    268c:	75 a2                	jne    2630 <concreate+0x30>
+      link("C0", file);
+    268e:	69 f6 cd cc cc cc    	imul   $0xcccccccd,%esi,%esi
+    } else if(pid == 0 && (i % 5) == 1){
+    2694:	81 fe cd cc cc cc    	cmp    $0xcccccccd,%esi
+    269a:	0f 83 d0 00 00 00    	jae    2770 <concreate+0x170>
+      fd = open(file, O_CREATE | O_RDWR);
+    26a0:	83 ec 08             	sub    $0x8,%esp
+    26a3:	68 02 02 00 00       	push   $0x202
+    26a8:	53                   	push   %ebx
+    26a9:	e8 75 20 00 00       	call   4723 <open>
+      if(fd < 0){
+    26ae:	83 c4 10             	add    $0x10,%esp
+    26b1:	85 c0                	test   %eax,%eax
+    26b3:	0f 89 ea 01 00 00    	jns    28a3 <concreate+0x2a3>
+        printf(1, "concreate create %s failed\n", file);
+    26b9:	83 ec 04             	sub    $0x4,%esp
+    26bc:	53                   	push   %ebx
+    26bd:	68 d1 54 00 00       	push   $0x54d1
+    26c2:	6a 01                	push   $0x1
+    26c4:	e8 d7 21 00 00       	call   48a0 <printf>
+        exit();
+    26c9:	e8 15 20 00 00       	call   46e3 <exit>
+    26ce:	66 90                	xchg   %ax,%ax
+      link("C0", file);
+    26d0:	83 ec 08             	sub    $0x8,%esp
+  for(i = 0; i < 40; i++){
+    26d3:	83 c6 01             	add    $0x1,%esi
+      link("C0", file);
+    26d6:	53                   	push   %ebx
+    26d7:	68 ce 54 00 00       	push   $0x54ce
+    26dc:	e8 62 20 00 00       	call   4743 <link>
+    26e1:	83 c4 10             	add    $0x10,%esp
+      wait();
+    26e4:	e8 02 20 00 00       	call   46eb <wait>
+  for(i = 0; i < 40; i++){
+    26e9:	83 fe 28             	cmp    $0x28,%esi
+    26ec:	0f 85 81 ff ff ff    	jne    2673 <concreate+0x73>
+  memset(fa, 0, sizeof(fa));
+    26f2:	83 ec 04             	sub    $0x4,%esp
+    26f5:	8d 45 c0             	lea    -0x40(%ebp),%eax
+    26f8:	6a 28                	push   $0x28
+    26fa:	6a 00                	push   $0x0
+    26fc:	50                   	push   %eax
+    26fd:	e8 5e 1e 00 00       	call   4560 <memset>
+  fd = open(".", 0);
+    2702:	5e                   	pop    %esi
+    2703:	5f                   	pop    %edi
+    2704:	6a 00                	push   $0x0
+    2706:	68 db 56 00 00       	push   $0x56db
+    270b:	8d 7d b0             	lea    -0x50(%ebp),%edi
+    270e:	e8 10 20 00 00       	call   4723 <open>
+  n = 0;
+    2713:	c7 45 a4 00 00 00 00 	movl   $0x0,-0x5c(%ebp)
+  while(read(fd, &de, sizeof(de)) > 0){
+    271a:	83 c4 10             	add    $0x10,%esp
+  fd = open(".", 0);
+    271d:	89 c6                	mov    %eax,%esi
+  while(read(fd, &de, sizeof(de)) > 0){
+    271f:	90                   	nop
+    2720:	83 ec 04             	sub    $0x4,%esp
+    2723:	6a 10                	push   $0x10
+    2725:	57                   	push   %edi
+    2726:	56                   	push   %esi
+    2727:	e8 cf 1f 00 00       	call   46fb <read>
+    272c:	83 c4 10             	add    $0x10,%esp
+    272f:	85 c0                	test   %eax,%eax
+    2731:	7e 5d                	jle    2790 <concreate+0x190>
+    if(de.inum == 0)
+    2733:	66 83 7d b0 00       	cmpw   $0x0,-0x50(%ebp)
+    2738:	74 e6                	je     2720 <concreate+0x120>
+    if(de.name[0] == 'C' && de.name[2] == '\0'){
+    273a:	80 7d b2 43          	cmpb   $0x43,-0x4e(%ebp)
+    273e:	75 e0                	jne    2720 <concreate+0x120>
+    2740:	80 7d b4 00          	cmpb   $0x0,-0x4c(%ebp)
+    2744:	75 da                	jne    2720 <concreate+0x120>
+      i = de.name[1] - '0';
+    2746:	0f be 45 b3          	movsbl -0x4d(%ebp),%eax
+    274a:	83 e8 30             	sub    $0x30,%eax
+      if(i < 0 || i >= sizeof(fa)){
+    274d:	83 f8 27             	cmp    $0x27,%eax
+    2750:	0f 87 5e 01 00 00    	ja     28b4 <concreate+0x2b4>
+      if(fa[i]){
+    2756:	80 7c 05 c0 00       	cmpb   $0x0,-0x40(%ebp,%eax,1)
+    275b:	0f 85 7e 01 00 00    	jne    28df <concreate+0x2df>
+      n++;
+    2761:	83 45 a4 01          	addl   $0x1,-0x5c(%ebp)
+      fa[i] = 1;
+    2765:	c6 44 05 c0 01       	movb   $0x1,-0x40(%ebp,%eax,1)
+      n++;
+    276a:	eb b4                	jmp    2720 <concreate+0x120>
+    276c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+      link("C0", file);
+    2770:	83 ec 08             	sub    $0x8,%esp
+    2773:	53                   	push   %ebx
+    2774:	68 ce 54 00 00       	push   $0x54ce
+    2779:	e8 c5 1f 00 00       	call   4743 <link>
+    277e:	83 c4 10             	add    $0x10,%esp
+      exit();
+    2781:	e8 5d 1f 00 00       	call   46e3 <exit>
+    2786:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    278d:	8d 76 00             	lea    0x0(%esi),%esi
+  close(fd);
+    2790:	83 ec 0c             	sub    $0xc,%esp
+    2793:	56                   	push   %esi
+    2794:	e8 72 1f 00 00       	call   470b <close>
+  if(n != 40){
+    2799:	83 c4 10             	add    $0x10,%esp
+    279c:	83 7d a4 28          	cmpl   $0x28,-0x5c(%ebp)
+    27a0:	0f 85 26 01 00 00    	jne    28cc <concreate+0x2cc>
+  for(i = 0; i < 40; i++){
+    27a6:	31 f6                	xor    %esi,%esi
+    27a8:	eb 48                	jmp    27f2 <concreate+0x1f2>
+    27aa:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+       ((i % 3) == 1 && pid != 0)){
+    27b0:	85 ff                	test   %edi,%edi
+    27b2:	74 05                	je     27b9 <concreate+0x1b9>
+    27b4:	83 f8 01             	cmp    $0x1,%eax
+    27b7:	74 68                	je     2821 <concreate+0x221>
+      unlink(file);
+    27b9:	83 ec 0c             	sub    $0xc,%esp
+    27bc:	53                   	push   %ebx
+    27bd:	e8 71 1f 00 00       	call   4733 <unlink>
+      unlink(file);
+    27c2:	89 1c 24             	mov    %ebx,(%esp)
+    27c5:	e8 69 1f 00 00       	call   4733 <unlink>
+      unlink(file);
+    27ca:	89 1c 24             	mov    %ebx,(%esp)
+    27cd:	e8 61 1f 00 00       	call   4733 <unlink>
+      unlink(file);
+    27d2:	89 1c 24             	mov    %ebx,(%esp)
+    27d5:	e8 59 1f 00 00       	call   4733 <unlink>
+    27da:	83 c4 10             	add    $0x10,%esp
+    if(pid == 0)
+    27dd:	85 ff                	test   %edi,%edi
+    27df:	74 a0                	je     2781 <concreate+0x181>
+      wait();
+    27e1:	e8 05 1f 00 00       	call   46eb <wait>
+  for(i = 0; i < 40; i++){
+    27e6:	83 c6 01             	add    $0x1,%esi
+    27e9:	83 fe 28             	cmp    $0x28,%esi
+    27ec:	0f 84 86 00 00 00    	je     2878 <concreate+0x278>
+    file[1] = '0' + i;
+    27f2:	8d 46 30             	lea    0x30(%esi),%eax
+    27f5:	88 45 ae             	mov    %al,-0x52(%ebp)
+    pid = fork();
+    27f8:	e8 de 1e 00 00       	call   46db <fork>
+    27fd:	89 c7                	mov    %eax,%edi
+    if(pid < 0){
+    27ff:	85 c0                	test   %eax,%eax
+    2801:	0f 88 88 00 00 00    	js     288f <concreate+0x28f>
+    if(((i % 3) == 0 && pid == 0) ||
+    2807:	b8 ab aa aa aa       	mov    $0xaaaaaaab,%eax
+    280c:	f7 e6                	mul    %esi
+    280e:	89 d0                	mov    %edx,%eax
+    2810:	83 e2 fe             	and    $0xfffffffe,%edx
+    2813:	d1 e8                	shr    %eax
+    2815:	01 c2                	add    %eax,%edx
+    2817:	89 f0                	mov    %esi,%eax
+    2819:	29 d0                	sub    %edx,%eax
+    281b:	89 c1                	mov    %eax,%ecx
+    281d:	09 f9                	or     %edi,%ecx
+    281f:	75 8f                	jne    27b0 <concreate+0x1b0>
+      close(open(file, 0));
+    2821:	83 ec 08             	sub    $0x8,%esp
+    2824:	6a 00                	push   $0x0
+    2826:	53                   	push   %ebx
+    2827:	e8 f7 1e 00 00       	call   4723 <open>
+    282c:	89 04 24             	mov    %eax,(%esp)
+    282f:	e8 d7 1e 00 00       	call   470b <close>
+      close(open(file, 0));
+    2834:	58                   	pop    %eax
+    2835:	5a                   	pop    %edx
+    2836:	6a 00                	push   $0x0
+    2838:	53                   	push   %ebx
+    2839:	e8 e5 1e 00 00       	call   4723 <open>
+    283e:	89 04 24             	mov    %eax,(%esp)
+    2841:	e8 c5 1e 00 00       	call   470b <close>
+      close(open(file, 0));
+    2846:	59                   	pop    %ecx
+    2847:	58                   	pop    %eax
+    2848:	6a 00                	push   $0x0
+    284a:	53                   	push   %ebx
+    284b:	e8 d3 1e 00 00       	call   4723 <open>
+    2850:	89 04 24             	mov    %eax,(%esp)
+    2853:	e8 b3 1e 00 00       	call   470b <close>
+      close(open(file, 0));
+    2858:	58                   	pop    %eax
+    2859:	5a                   	pop    %edx
+    285a:	6a 00                	push   $0x0
+    285c:	53                   	push   %ebx
+    285d:	e8 c1 1e 00 00       	call   4723 <open>
+    2862:	89 04 24             	mov    %eax,(%esp)
+    2865:	e8 a1 1e 00 00       	call   470b <close>
+    286a:	83 c4 10             	add    $0x10,%esp
+    286d:	e9 6b ff ff ff       	jmp    27dd <concreate+0x1dd>
+    2872:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  printf(1, "concreate ok\n");
+    2878:	83 ec 08             	sub    $0x8,%esp
+    287b:	68 23 55 00 00       	push   $0x5523
+    2880:	6a 01                	push   $0x1
+    2882:	e8 19 20 00 00       	call   48a0 <printf>
+}
+    2887:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    288a:	5b                   	pop    %ebx
+    288b:	5e                   	pop    %esi
+    288c:	5f                   	pop    %edi
+    288d:	5d                   	pop    %ebp
+    288e:	c3                   	ret
+      printf(1, "fork failed\n");
+    288f:	83 ec 08             	sub    $0x8,%esp
+    2892:	68 a6 5d 00 00       	push   $0x5da6
+    2897:	6a 01                	push   $0x1
+    2899:	e8 02 20 00 00       	call   48a0 <printf>
+      exit();
+    289e:	e8 40 1e 00 00       	call   46e3 <exit>
+      close(fd);
+    28a3:	83 ec 0c             	sub    $0xc,%esp
+    28a6:	50                   	push   %eax
+    28a7:	e8 5f 1e 00 00       	call   470b <close>
+    28ac:	83 c4 10             	add    $0x10,%esp
+    28af:	e9 cd fe ff ff       	jmp    2781 <concreate+0x181>
+        printf(1, "concreate weird file %s\n", de.name);
+    28b4:	83 ec 04             	sub    $0x4,%esp
+    28b7:	8d 45 b2             	lea    -0x4e(%ebp),%eax
+    28ba:	50                   	push   %eax
+    28bb:	68 ed 54 00 00       	push   $0x54ed
+    28c0:	6a 01                	push   $0x1
+    28c2:	e8 d9 1f 00 00       	call   48a0 <printf>
+        exit();
+    28c7:	e8 17 1e 00 00       	call   46e3 <exit>
+    printf(1, "concreate not enough files in directory listing\n");
+    28cc:	51                   	push   %ecx
+    28cd:	51                   	push   %ecx
+    28ce:	68 80 62 00 00       	push   $0x6280
+    28d3:	6a 01                	push   $0x1
+    28d5:	e8 c6 1f 00 00       	call   48a0 <printf>
+    exit();
+    28da:	e8 04 1e 00 00       	call   46e3 <exit>
+        printf(1, "concreate duplicate file %s\n", de.name);
+    28df:	83 ec 04             	sub    $0x4,%esp
+    28e2:	8d 45 b2             	lea    -0x4e(%ebp),%eax
+    28e5:	50                   	push   %eax
+    28e6:	68 06 55 00 00       	push   $0x5506
+    28eb:	6a 01                	push   $0x1
+    28ed:	e8 ae 1f 00 00       	call   48a0 <printf>
+        exit();
+    28f2:	e8 ec 1d 00 00       	call   46e3 <exit>
+    28f7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    28fe:	66 90                	xchg   %ax,%ax
+
+00002900 <linkunlink>:
+{
+    2900:	55                   	push   %ebp
+    2901:	89 e5                	mov    %esp,%ebp
+    2903:	57                   	push   %edi
+    2904:	56                   	push   %esi
+    2905:	53                   	push   %ebx
+    2906:	83 ec 24             	sub    $0x24,%esp
+  printf(1, "linkunlink test\n");
+    2909:	68 31 55 00 00       	push   $0x5531
+    290e:	6a 01                	push   $0x1
+    2910:	e8 8b 1f 00 00       	call   48a0 <printf>
+  unlink("x");
+    2915:	c7 04 24 be 57 00 00 	movl   $0x57be,(%esp)
+    291c:	e8 12 1e 00 00       	call   4733 <unlink>
+  pid = fork();
+    2921:	e8 b5 1d 00 00       	call   46db <fork>
+  if(pid < 0){
+    2926:	83 c4 10             	add    $0x10,%esp
+  pid = fork();
+    2929:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  if(pid < 0){
+    292c:	85 c0                	test   %eax,%eax
+    292e:	0f 88 b6 00 00 00    	js     29ea <linkunlink+0xea>
+  unsigned int x = (pid ? 1 : 97);
+    2934:	83 7d e4 01          	cmpl   $0x1,-0x1c(%ebp)
+    2938:	bb 64 00 00 00       	mov    $0x64,%ebx
+    if((x % 3) == 0){
+    293d:	be ab aa aa aa       	mov    $0xaaaaaaab,%esi
+  unsigned int x = (pid ? 1 : 97);
+    2942:	19 ff                	sbb    %edi,%edi
+    2944:	83 e7 60             	and    $0x60,%edi
+    2947:	83 c7 01             	add    $0x1,%edi
+    294a:	eb 1e                	jmp    296a <linkunlink+0x6a>
+    294c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    } else if((x % 3) == 1){
+    2950:	83 f8 01             	cmp    $0x1,%eax
+    2953:	74 7b                	je     29d0 <linkunlink+0xd0>
+      unlink("x");
+    2955:	83 ec 0c             	sub    $0xc,%esp
+    2958:	68 be 57 00 00       	push   $0x57be
+    295d:	e8 d1 1d 00 00       	call   4733 <unlink>
+    2962:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; i < 100; i++){
+    2965:	83 eb 01             	sub    $0x1,%ebx
+    2968:	74 41                	je     29ab <linkunlink+0xab>
+    x = x * 1103515245 + 12345;
+    296a:	69 cf 6d 4e c6 41    	imul   $0x41c64e6d,%edi,%ecx
+    2970:	8d b9 39 30 00 00    	lea    0x3039(%ecx),%edi
+    if((x % 3) == 0){
+    2976:	89 f8                	mov    %edi,%eax
+    2978:	f7 e6                	mul    %esi
+    297a:	89 d0                	mov    %edx,%eax
+    297c:	83 e2 fe             	and    $0xfffffffe,%edx
+    297f:	d1 e8                	shr    %eax
+    2981:	01 c2                	add    %eax,%edx
+    2983:	89 f8                	mov    %edi,%eax
+    2985:	29 d0                	sub    %edx,%eax
+    2987:	75 c7                	jne    2950 <linkunlink+0x50>
+      close(open("x", O_RDWR | O_CREATE));
+    2989:	83 ec 08             	sub    $0x8,%esp
+    298c:	68 02 02 00 00       	push   $0x202
+    2991:	68 be 57 00 00       	push   $0x57be
+    2996:	e8 88 1d 00 00       	call   4723 <open>
+    299b:	89 04 24             	mov    %eax,(%esp)
+    299e:	e8 68 1d 00 00       	call   470b <close>
+    29a3:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; i < 100; i++){
+    29a6:	83 eb 01             	sub    $0x1,%ebx
+    29a9:	75 bf                	jne    296a <linkunlink+0x6a>
+  if(pid)
+    29ab:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+    29ae:	85 c0                	test   %eax,%eax
+    29b0:	74 4b                	je     29fd <linkunlink+0xfd>
+    wait();
+    29b2:	e8 34 1d 00 00       	call   46eb <wait>
+  printf(1, "linkunlink ok\n");
+    29b7:	83 ec 08             	sub    $0x8,%esp
+    29ba:	68 46 55 00 00       	push   $0x5546
+    29bf:	6a 01                	push   $0x1
+    29c1:	e8 da 1e 00 00       	call   48a0 <printf>
+}
+    29c6:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    29c9:	5b                   	pop    %ebx
+    29ca:	5e                   	pop    %esi
+    29cb:	5f                   	pop    %edi
+    29cc:	5d                   	pop    %ebp
+    29cd:	c3                   	ret
+    29ce:	66 90                	xchg   %ax,%ax
+      link("cat", "x");
+    29d0:	83 ec 08             	sub    $0x8,%esp
+    29d3:	68 be 57 00 00       	push   $0x57be
+    29d8:	68 42 55 00 00       	push   $0x5542
+    29dd:	e8 61 1d 00 00       	call   4743 <link>
+    29e2:	83 c4 10             	add    $0x10,%esp
+    29e5:	e9 7b ff ff ff       	jmp    2965 <linkunlink+0x65>
+    printf(1, "fork failed\n");
+    29ea:	52                   	push   %edx
+    29eb:	52                   	push   %edx
+    29ec:	68 a6 5d 00 00       	push   $0x5da6
+    29f1:	6a 01                	push   $0x1
+    29f3:	e8 a8 1e 00 00       	call   48a0 <printf>
+    exit();
+    29f8:	e8 e6 1c 00 00       	call   46e3 <exit>
+    exit();
+    29fd:	e8 e1 1c 00 00       	call   46e3 <exit>
+    2a02:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    2a09:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00002a10 <bigdir>:
+{
+    2a10:	55                   	push   %ebp
+    2a11:	89 e5                	mov    %esp,%ebp
+    2a13:	57                   	push   %edi
+    2a14:	56                   	push   %esi
+    2a15:	53                   	push   %ebx
+    2a16:	83 ec 24             	sub    $0x24,%esp
+  printf(1, "bigdir test\n");
+    2a19:	68 55 55 00 00       	push   $0x5555
+    2a1e:	6a 01                	push   $0x1
+    2a20:	e8 7b 1e 00 00       	call   48a0 <printf>
+  unlink("bd");
+    2a25:	c7 04 24 62 55 00 00 	movl   $0x5562,(%esp)
+    2a2c:	e8 02 1d 00 00       	call   4733 <unlink>
+  fd = open("bd", O_CREATE);
+    2a31:	5a                   	pop    %edx
+    2a32:	59                   	pop    %ecx
+    2a33:	68 00 02 00 00       	push   $0x200
+    2a38:	68 62 55 00 00       	push   $0x5562
+    2a3d:	e8 e1 1c 00 00       	call   4723 <open>
+  if(fd < 0){
+    2a42:	83 c4 10             	add    $0x10,%esp
+    2a45:	85 c0                	test   %eax,%eax
+    2a47:	0f 88 de 00 00 00    	js     2b2b <bigdir+0x11b>
+  close(fd);
+    2a4d:	83 ec 0c             	sub    $0xc,%esp
+  for(i = 0; i < 500; i++){
+    2a50:	31 f6                	xor    %esi,%esi
+    2a52:	8d 7d de             	lea    -0x22(%ebp),%edi
+  close(fd);
+    2a55:	50                   	push   %eax
+    2a56:	e8 b0 1c 00 00       	call   470b <close>
+    2a5b:	83 c4 10             	add    $0x10,%esp
+    2a5e:	66 90                	xchg   %ax,%ax
+    name[1] = '0' + (i / 64);
+    2a60:	89 f0                	mov    %esi,%eax
+    if(link("bd", name) != 0){
+    2a62:	83 ec 08             	sub    $0x8,%esp
+    name[0] = 'x';
+    2a65:	c6 45 de 78          	movb   $0x78,-0x22(%ebp)
+    name[1] = '0' + (i / 64);
+    2a69:	c1 f8 06             	sar    $0x6,%eax
+    name[3] = '\0';
+    2a6c:	c6 45 e1 00          	movb   $0x0,-0x1f(%ebp)
+    name[1] = '0' + (i / 64);
+    2a70:	83 c0 30             	add    $0x30,%eax
+    2a73:	88 45 df             	mov    %al,-0x21(%ebp)
+    name[2] = '0' + (i % 64);
+    2a76:	89 f0                	mov    %esi,%eax
+    2a78:	83 e0 3f             	and    $0x3f,%eax
+    2a7b:	83 c0 30             	add    $0x30,%eax
+    2a7e:	88 45 e0             	mov    %al,-0x20(%ebp)
+    if(link("bd", name) != 0){
+    2a81:	57                   	push   %edi
+    2a82:	68 62 55 00 00       	push   $0x5562
+    2a87:	e8 b7 1c 00 00       	call   4743 <link>
+    2a8c:	83 c4 10             	add    $0x10,%esp
+    2a8f:	89 c3                	mov    %eax,%ebx
+    2a91:	85 c0                	test   %eax,%eax
+    2a93:	75 6e                	jne    2b03 <bigdir+0xf3>
+  for(i = 0; i < 500; i++){
+    2a95:	83 c6 01             	add    $0x1,%esi
+    2a98:	81 fe f4 01 00 00    	cmp    $0x1f4,%esi
+    2a9e:	75 c0                	jne    2a60 <bigdir+0x50>
+  unlink("bd");
+    2aa0:	83 ec 0c             	sub    $0xc,%esp
+    2aa3:	68 62 55 00 00       	push   $0x5562
+    2aa8:	e8 86 1c 00 00       	call   4733 <unlink>
+    2aad:	83 c4 10             	add    $0x10,%esp
+    name[1] = '0' + (i / 64);
+    2ab0:	89 d8                	mov    %ebx,%eax
+    if(unlink(name) != 0){
+    2ab2:	83 ec 0c             	sub    $0xc,%esp
+    name[0] = 'x';
+    2ab5:	c6 45 de 78          	movb   $0x78,-0x22(%ebp)
+    name[1] = '0' + (i / 64);
+    2ab9:	c1 f8 06             	sar    $0x6,%eax
+    name[3] = '\0';
+    2abc:	c6 45 e1 00          	movb   $0x0,-0x1f(%ebp)
+    name[1] = '0' + (i / 64);
+    2ac0:	83 c0 30             	add    $0x30,%eax
+    2ac3:	88 45 df             	mov    %al,-0x21(%ebp)
+    name[2] = '0' + (i % 64);
+    2ac6:	89 d8                	mov    %ebx,%eax
+    2ac8:	83 e0 3f             	and    $0x3f,%eax
+    2acb:	83 c0 30             	add    $0x30,%eax
+    2ace:	88 45 e0             	mov    %al,-0x20(%ebp)
+    if(unlink(name) != 0){
+    2ad1:	57                   	push   %edi
+    2ad2:	e8 5c 1c 00 00       	call   4733 <unlink>
+    2ad7:	83 c4 10             	add    $0x10,%esp
+    2ada:	85 c0                	test   %eax,%eax
+    2adc:	75 39                	jne    2b17 <bigdir+0x107>
+  for(i = 0; i < 500; i++){
+    2ade:	83 c3 01             	add    $0x1,%ebx
+    2ae1:	81 fb f4 01 00 00    	cmp    $0x1f4,%ebx
+    2ae7:	75 c7                	jne    2ab0 <bigdir+0xa0>
+  printf(1, "bigdir ok\n");
+    2ae9:	83 ec 08             	sub    $0x8,%esp
+    2aec:	68 a4 55 00 00       	push   $0x55a4
+    2af1:	6a 01                	push   $0x1
+    2af3:	e8 a8 1d 00 00       	call   48a0 <printf>
+    2af8:	83 c4 10             	add    $0x10,%esp
+}
+    2afb:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    2afe:	5b                   	pop    %ebx
+    2aff:	5e                   	pop    %esi
+    2b00:	5f                   	pop    %edi
+    2b01:	5d                   	pop    %ebp
+    2b02:	c3                   	ret
+      printf(1, "bigdir link failed\n");
+    2b03:	83 ec 08             	sub    $0x8,%esp
+    2b06:	68 7b 55 00 00       	push   $0x557b
+    2b0b:	6a 01                	push   $0x1
+    2b0d:	e8 8e 1d 00 00       	call   48a0 <printf>
+      exit();
+    2b12:	e8 cc 1b 00 00       	call   46e3 <exit>
+      printf(1, "bigdir unlink failed");
+    2b17:	83 ec 08             	sub    $0x8,%esp
+    2b1a:	68 8f 55 00 00       	push   $0x558f
+    2b1f:	6a 01                	push   $0x1
+    2b21:	e8 7a 1d 00 00       	call   48a0 <printf>
+      exit();
+    2b26:	e8 b8 1b 00 00       	call   46e3 <exit>
+    printf(1, "bigdir create failed\n");
+    2b2b:	50                   	push   %eax
+    2b2c:	50                   	push   %eax
+    2b2d:	68 65 55 00 00       	push   $0x5565
+    2b32:	6a 01                	push   $0x1
+    2b34:	e8 67 1d 00 00       	call   48a0 <printf>
+    exit();
+    2b39:	e8 a5 1b 00 00       	call   46e3 <exit>
+    2b3e:	66 90                	xchg   %ax,%ax
+
+00002b40 <subdir>:
+{
+    2b40:	55                   	push   %ebp
+    2b41:	89 e5                	mov    %esp,%ebp
+    2b43:	53                   	push   %ebx
+    2b44:	83 ec 0c             	sub    $0xc,%esp
+  printf(1, "subdir test\n");
+    2b47:	68 af 55 00 00       	push   $0x55af
+    2b4c:	6a 01                	push   $0x1
+    2b4e:	e8 4d 1d 00 00       	call   48a0 <printf>
+  unlink("ff");
+    2b53:	c7 04 24 38 56 00 00 	movl   $0x5638,(%esp)
+    2b5a:	e8 d4 1b 00 00       	call   4733 <unlink>
+  if(mkdir("dd") != 0){
+    2b5f:	c7 04 24 d5 56 00 00 	movl   $0x56d5,(%esp)
+    2b66:	e8 e0 1b 00 00       	call   474b <mkdir>
+    2b6b:	83 c4 10             	add    $0x10,%esp
+    2b6e:	85 c0                	test   %eax,%eax
+    2b70:	0f 85 b3 05 00 00    	jne    3129 <subdir+0x5e9>
+  fd = open("dd/ff", O_CREATE | O_RDWR);
+    2b76:	83 ec 08             	sub    $0x8,%esp
+    2b79:	68 02 02 00 00       	push   $0x202
+    2b7e:	68 0e 56 00 00       	push   $0x560e
+    2b83:	e8 9b 1b 00 00       	call   4723 <open>
+  if(fd < 0){
+    2b88:	83 c4 10             	add    $0x10,%esp
+  fd = open("dd/ff", O_CREATE | O_RDWR);
+    2b8b:	89 c3                	mov    %eax,%ebx
+  if(fd < 0){
+    2b8d:	85 c0                	test   %eax,%eax
+    2b8f:	0f 88 81 05 00 00    	js     3116 <subdir+0x5d6>
+  write(fd, "ff", 2);
+    2b95:	83 ec 04             	sub    $0x4,%esp
+    2b98:	6a 02                	push   $0x2
+    2b9a:	68 38 56 00 00       	push   $0x5638
+    2b9f:	50                   	push   %eax
+    2ba0:	e8 5e 1b 00 00       	call   4703 <write>
+  close(fd);
+    2ba5:	89 1c 24             	mov    %ebx,(%esp)
+    2ba8:	e8 5e 1b 00 00       	call   470b <close>
+  if(unlink("dd") >= 0){
+    2bad:	c7 04 24 d5 56 00 00 	movl   $0x56d5,(%esp)
+    2bb4:	e8 7a 1b 00 00       	call   4733 <unlink>
+    2bb9:	83 c4 10             	add    $0x10,%esp
+    2bbc:	85 c0                	test   %eax,%eax
+    2bbe:	0f 89 3f 05 00 00    	jns    3103 <subdir+0x5c3>
+  if(mkdir("/dd/dd") != 0){
+    2bc4:	83 ec 0c             	sub    $0xc,%esp
+    2bc7:	68 e9 55 00 00       	push   $0x55e9
+    2bcc:	e8 7a 1b 00 00       	call   474b <mkdir>
+    2bd1:	83 c4 10             	add    $0x10,%esp
+    2bd4:	85 c0                	test   %eax,%eax
+    2bd6:	0f 85 14 05 00 00    	jne    30f0 <subdir+0x5b0>
+  fd = open("dd/dd/ff", O_CREATE | O_RDWR);
+    2bdc:	83 ec 08             	sub    $0x8,%esp
+    2bdf:	68 02 02 00 00       	push   $0x202
+    2be4:	68 0b 56 00 00       	push   $0x560b
+    2be9:	e8 35 1b 00 00       	call   4723 <open>
+  if(fd < 0){
+    2bee:	83 c4 10             	add    $0x10,%esp
+  fd = open("dd/dd/ff", O_CREATE | O_RDWR);
+    2bf1:	89 c3                	mov    %eax,%ebx
+  if(fd < 0){
+    2bf3:	85 c0                	test   %eax,%eax
+    2bf5:	0f 88 24 04 00 00    	js     301f <subdir+0x4df>
+  write(fd, "FF", 2);
+    2bfb:	83 ec 04             	sub    $0x4,%esp
+    2bfe:	6a 02                	push   $0x2
+    2c00:	68 2c 56 00 00       	push   $0x562c
+    2c05:	50                   	push   %eax
+    2c06:	e8 f8 1a 00 00       	call   4703 <write>
+  close(fd);
+    2c0b:	89 1c 24             	mov    %ebx,(%esp)
+    2c0e:	e8 f8 1a 00 00       	call   470b <close>
+  fd = open("dd/dd/../ff", 0);
+    2c13:	58                   	pop    %eax
+    2c14:	5a                   	pop    %edx
+    2c15:	6a 00                	push   $0x0
+    2c17:	68 2f 56 00 00       	push   $0x562f
+    2c1c:	e8 02 1b 00 00       	call   4723 <open>
+  if(fd < 0){
+    2c21:	83 c4 10             	add    $0x10,%esp
+  fd = open("dd/dd/../ff", 0);
+    2c24:	89 c3                	mov    %eax,%ebx
+  if(fd < 0){
+    2c26:	85 c0                	test   %eax,%eax
+    2c28:	0f 88 de 03 00 00    	js     300c <subdir+0x4cc>
+  cc = read(fd, buf, sizeof(buf));
+    2c2e:	83 ec 04             	sub    $0x4,%esp
+    2c31:	68 00 20 00 00       	push   $0x2000
+    2c36:	68 20 9a 00 00       	push   $0x9a20
+    2c3b:	50                   	push   %eax
+    2c3c:	e8 ba 1a 00 00       	call   46fb <read>
+  if(cc != 2 || buf[0] != 'f'){
+    2c41:	83 c4 10             	add    $0x10,%esp
+    2c44:	83 f8 02             	cmp    $0x2,%eax
+    2c47:	0f 85 3a 03 00 00    	jne    2f87 <subdir+0x447>
+    2c4d:	80 3d 20 9a 00 00 66 	cmpb   $0x66,0x9a20
+    2c54:	0f 85 2d 03 00 00    	jne    2f87 <subdir+0x447>
+  close(fd);
+    2c5a:	83 ec 0c             	sub    $0xc,%esp
+    2c5d:	53                   	push   %ebx
+    2c5e:	e8 a8 1a 00 00       	call   470b <close>
+  if(link("dd/dd/ff", "dd/dd/ffff") != 0){
+    2c63:	59                   	pop    %ecx
+    2c64:	5b                   	pop    %ebx
+    2c65:	68 6f 56 00 00       	push   $0x566f
+    2c6a:	68 0b 56 00 00       	push   $0x560b
+    2c6f:	e8 cf 1a 00 00       	call   4743 <link>
+    2c74:	83 c4 10             	add    $0x10,%esp
+    2c77:	85 c0                	test   %eax,%eax
+    2c79:	0f 85 c6 03 00 00    	jne    3045 <subdir+0x505>
+  if(unlink("dd/dd/ff") != 0){
+    2c7f:	83 ec 0c             	sub    $0xc,%esp
+    2c82:	68 0b 56 00 00       	push   $0x560b
+    2c87:	e8 a7 1a 00 00       	call   4733 <unlink>
+    2c8c:	83 c4 10             	add    $0x10,%esp
+    2c8f:	85 c0                	test   %eax,%eax
+    2c91:	0f 85 16 03 00 00    	jne    2fad <subdir+0x46d>
+  if(open("dd/dd/ff", O_RDONLY) >= 0){
+    2c97:	83 ec 08             	sub    $0x8,%esp
+    2c9a:	6a 00                	push   $0x0
+    2c9c:	68 0b 56 00 00       	push   $0x560b
+    2ca1:	e8 7d 1a 00 00       	call   4723 <open>
+    2ca6:	83 c4 10             	add    $0x10,%esp
+    2ca9:	85 c0                	test   %eax,%eax
+    2cab:	0f 89 2c 04 00 00    	jns    30dd <subdir+0x59d>
+  if(chdir("dd") != 0){
+    2cb1:	83 ec 0c             	sub    $0xc,%esp
+    2cb4:	68 d5 56 00 00       	push   $0x56d5
+    2cb9:	e8 95 1a 00 00       	call   4753 <chdir>
+    2cbe:	83 c4 10             	add    $0x10,%esp
+    2cc1:	85 c0                	test   %eax,%eax
+    2cc3:	0f 85 01 04 00 00    	jne    30ca <subdir+0x58a>
+  if(chdir("dd/../../dd") != 0){
+    2cc9:	83 ec 0c             	sub    $0xc,%esp
+    2ccc:	68 a3 56 00 00       	push   $0x56a3
+    2cd1:	e8 7d 1a 00 00       	call   4753 <chdir>
+    2cd6:	83 c4 10             	add    $0x10,%esp
+    2cd9:	85 c0                	test   %eax,%eax
+    2cdb:	0f 85 b9 02 00 00    	jne    2f9a <subdir+0x45a>
+  if(chdir("dd/../../../dd") != 0){
+    2ce1:	83 ec 0c             	sub    $0xc,%esp
+    2ce4:	68 c9 56 00 00       	push   $0x56c9
+    2ce9:	e8 65 1a 00 00       	call   4753 <chdir>
+    2cee:	83 c4 10             	add    $0x10,%esp
+    2cf1:	85 c0                	test   %eax,%eax
+    2cf3:	0f 85 a1 02 00 00    	jne    2f9a <subdir+0x45a>
+  if(chdir("./..") != 0){
+    2cf9:	83 ec 0c             	sub    $0xc,%esp
+    2cfc:	68 d8 56 00 00       	push   $0x56d8
+    2d01:	e8 4d 1a 00 00       	call   4753 <chdir>
+    2d06:	83 c4 10             	add    $0x10,%esp
+    2d09:	85 c0                	test   %eax,%eax
+    2d0b:	0f 85 21 03 00 00    	jne    3032 <subdir+0x4f2>
+  fd = open("dd/dd/ffff", 0);
+    2d11:	83 ec 08             	sub    $0x8,%esp
+    2d14:	6a 00                	push   $0x0
+    2d16:	68 6f 56 00 00       	push   $0x566f
+    2d1b:	e8 03 1a 00 00       	call   4723 <open>
+  if(fd < 0){
+    2d20:	83 c4 10             	add    $0x10,%esp
+  fd = open("dd/dd/ffff", 0);
+    2d23:	89 c3                	mov    %eax,%ebx
+  if(fd < 0){
+    2d25:	85 c0                	test   %eax,%eax
+    2d27:	0f 88 e0 04 00 00    	js     320d <subdir+0x6cd>
+  if(read(fd, buf, sizeof(buf)) != 2){
+    2d2d:	83 ec 04             	sub    $0x4,%esp
+    2d30:	68 00 20 00 00       	push   $0x2000
+    2d35:	68 20 9a 00 00       	push   $0x9a20
+    2d3a:	50                   	push   %eax
+    2d3b:	e8 bb 19 00 00       	call   46fb <read>
+    2d40:	83 c4 10             	add    $0x10,%esp
+    2d43:	83 f8 02             	cmp    $0x2,%eax
+    2d46:	0f 85 ae 04 00 00    	jne    31fa <subdir+0x6ba>
+  close(fd);
+    2d4c:	83 ec 0c             	sub    $0xc,%esp
+    2d4f:	53                   	push   %ebx
+    2d50:	e8 b6 19 00 00       	call   470b <close>
+  if(open("dd/dd/ff", O_RDONLY) >= 0){
+    2d55:	58                   	pop    %eax
+    2d56:	5a                   	pop    %edx
+    2d57:	6a 00                	push   $0x0
+    2d59:	68 0b 56 00 00       	push   $0x560b
+    2d5e:	e8 c0 19 00 00       	call   4723 <open>
+    2d63:	83 c4 10             	add    $0x10,%esp
+    2d66:	85 c0                	test   %eax,%eax
+    2d68:	0f 89 65 02 00 00    	jns    2fd3 <subdir+0x493>
+  if(open("dd/ff/ff", O_CREATE|O_RDWR) >= 0){
+    2d6e:	83 ec 08             	sub    $0x8,%esp
+    2d71:	68 02 02 00 00       	push   $0x202
+    2d76:	68 23 57 00 00       	push   $0x5723
+    2d7b:	e8 a3 19 00 00       	call   4723 <open>
+    2d80:	83 c4 10             	add    $0x10,%esp
+    2d83:	85 c0                	test   %eax,%eax
+    2d85:	0f 89 35 02 00 00    	jns    2fc0 <subdir+0x480>
+  if(open("dd/xx/ff", O_CREATE|O_RDWR) >= 0){
+    2d8b:	83 ec 08             	sub    $0x8,%esp
+    2d8e:	68 02 02 00 00       	push   $0x202
+    2d93:	68 48 57 00 00       	push   $0x5748
+    2d98:	e8 86 19 00 00       	call   4723 <open>
+    2d9d:	83 c4 10             	add    $0x10,%esp
+    2da0:	85 c0                	test   %eax,%eax
+    2da2:	0f 89 0f 03 00 00    	jns    30b7 <subdir+0x577>
+  if(open("dd", O_CREATE) >= 0){
+    2da8:	83 ec 08             	sub    $0x8,%esp
+    2dab:	68 00 02 00 00       	push   $0x200
+    2db0:	68 d5 56 00 00       	push   $0x56d5
+    2db5:	e8 69 19 00 00       	call   4723 <open>
+    2dba:	83 c4 10             	add    $0x10,%esp
+    2dbd:	85 c0                	test   %eax,%eax
+    2dbf:	0f 89 df 02 00 00    	jns    30a4 <subdir+0x564>
+  if(open("dd", O_RDWR) >= 0){
+    2dc5:	83 ec 08             	sub    $0x8,%esp
+    2dc8:	6a 02                	push   $0x2
+    2dca:	68 d5 56 00 00       	push   $0x56d5
+    2dcf:	e8 4f 19 00 00       	call   4723 <open>
+    2dd4:	83 c4 10             	add    $0x10,%esp
+    2dd7:	85 c0                	test   %eax,%eax
+    2dd9:	0f 89 b2 02 00 00    	jns    3091 <subdir+0x551>
+  if(open("dd", O_WRONLY) >= 0){
+    2ddf:	83 ec 08             	sub    $0x8,%esp
+    2de2:	6a 01                	push   $0x1
+    2de4:	68 d5 56 00 00       	push   $0x56d5
+    2de9:	e8 35 19 00 00       	call   4723 <open>
+    2dee:	83 c4 10             	add    $0x10,%esp
+    2df1:	85 c0                	test   %eax,%eax
+    2df3:	0f 89 85 02 00 00    	jns    307e <subdir+0x53e>
+  if(link("dd/ff/ff", "dd/dd/xx") == 0){
+    2df9:	83 ec 08             	sub    $0x8,%esp
+    2dfc:	68 b7 57 00 00       	push   $0x57b7
+    2e01:	68 23 57 00 00       	push   $0x5723
+    2e06:	e8 38 19 00 00       	call   4743 <link>
+    2e0b:	83 c4 10             	add    $0x10,%esp
+    2e0e:	85 c0                	test   %eax,%eax
+    2e10:	0f 84 55 02 00 00    	je     306b <subdir+0x52b>
+  if(link("dd/xx/ff", "dd/dd/xx") == 0){
+    2e16:	83 ec 08             	sub    $0x8,%esp
+    2e19:	68 b7 57 00 00       	push   $0x57b7
+    2e1e:	68 48 57 00 00       	push   $0x5748
+    2e23:	e8 1b 19 00 00       	call   4743 <link>
+    2e28:	83 c4 10             	add    $0x10,%esp
+    2e2b:	85 c0                	test   %eax,%eax
+    2e2d:	0f 84 25 02 00 00    	je     3058 <subdir+0x518>
+  if(link("dd/ff", "dd/dd/ffff") == 0){
+    2e33:	83 ec 08             	sub    $0x8,%esp
+    2e36:	68 6f 56 00 00       	push   $0x566f
+    2e3b:	68 0e 56 00 00       	push   $0x560e
+    2e40:	e8 fe 18 00 00       	call   4743 <link>
+    2e45:	83 c4 10             	add    $0x10,%esp
+    2e48:	85 c0                	test   %eax,%eax
+    2e4a:	0f 84 a9 01 00 00    	je     2ff9 <subdir+0x4b9>
+  if(mkdir("dd/ff/ff") == 0){
+    2e50:	83 ec 0c             	sub    $0xc,%esp
+    2e53:	68 23 57 00 00       	push   $0x5723
+    2e58:	e8 ee 18 00 00       	call   474b <mkdir>
+    2e5d:	83 c4 10             	add    $0x10,%esp
+    2e60:	85 c0                	test   %eax,%eax
+    2e62:	0f 84 7e 01 00 00    	je     2fe6 <subdir+0x4a6>
+  if(mkdir("dd/xx/ff") == 0){
+    2e68:	83 ec 0c             	sub    $0xc,%esp
+    2e6b:	68 48 57 00 00       	push   $0x5748
+    2e70:	e8 d6 18 00 00       	call   474b <mkdir>
+    2e75:	83 c4 10             	add    $0x10,%esp
+    2e78:	85 c0                	test   %eax,%eax
+    2e7a:	0f 84 67 03 00 00    	je     31e7 <subdir+0x6a7>
+  if(mkdir("dd/dd/ffff") == 0){
+    2e80:	83 ec 0c             	sub    $0xc,%esp
+    2e83:	68 6f 56 00 00       	push   $0x566f
+    2e88:	e8 be 18 00 00       	call   474b <mkdir>
+    2e8d:	83 c4 10             	add    $0x10,%esp
+    2e90:	85 c0                	test   %eax,%eax
+    2e92:	0f 84 3c 03 00 00    	je     31d4 <subdir+0x694>
+  if(unlink("dd/xx/ff") == 0){
+    2e98:	83 ec 0c             	sub    $0xc,%esp
+    2e9b:	68 48 57 00 00       	push   $0x5748
+    2ea0:	e8 8e 18 00 00       	call   4733 <unlink>
+    2ea5:	83 c4 10             	add    $0x10,%esp
+    2ea8:	85 c0                	test   %eax,%eax
+    2eaa:	0f 84 11 03 00 00    	je     31c1 <subdir+0x681>
+  if(unlink("dd/ff/ff") == 0){
+    2eb0:	83 ec 0c             	sub    $0xc,%esp
+    2eb3:	68 23 57 00 00       	push   $0x5723
+    2eb8:	e8 76 18 00 00       	call   4733 <unlink>
+    2ebd:	83 c4 10             	add    $0x10,%esp
+    2ec0:	85 c0                	test   %eax,%eax
+    2ec2:	0f 84 e6 02 00 00    	je     31ae <subdir+0x66e>
+  if(chdir("dd/ff") == 0){
+    2ec8:	83 ec 0c             	sub    $0xc,%esp
+    2ecb:	68 0e 56 00 00       	push   $0x560e
+    2ed0:	e8 7e 18 00 00       	call   4753 <chdir>
+    2ed5:	83 c4 10             	add    $0x10,%esp
+    2ed8:	85 c0                	test   %eax,%eax
+    2eda:	0f 84 bb 02 00 00    	je     319b <subdir+0x65b>
+  if(chdir("dd/xx") == 0){
+    2ee0:	83 ec 0c             	sub    $0xc,%esp
+    2ee3:	68 ba 57 00 00       	push   $0x57ba
+    2ee8:	e8 66 18 00 00       	call   4753 <chdir>
+    2eed:	83 c4 10             	add    $0x10,%esp
+    2ef0:	85 c0                	test   %eax,%eax
+    2ef2:	0f 84 90 02 00 00    	je     3188 <subdir+0x648>
+  if(unlink("dd/dd/ffff") != 0){
+    2ef8:	83 ec 0c             	sub    $0xc,%esp
+    2efb:	68 6f 56 00 00       	push   $0x566f
+    2f00:	e8 2e 18 00 00       	call   4733 <unlink>
+    2f05:	83 c4 10             	add    $0x10,%esp
+    2f08:	85 c0                	test   %eax,%eax
+    2f0a:	0f 85 9d 00 00 00    	jne    2fad <subdir+0x46d>
+  if(unlink("dd/ff") != 0){
+    2f10:	83 ec 0c             	sub    $0xc,%esp
+    2f13:	68 0e 56 00 00       	push   $0x560e
+    2f18:	e8 16 18 00 00       	call   4733 <unlink>
+    2f1d:	83 c4 10             	add    $0x10,%esp
+    2f20:	85 c0                	test   %eax,%eax
+    2f22:	0f 85 4d 02 00 00    	jne    3175 <subdir+0x635>
+  if(unlink("dd") == 0){
+    2f28:	83 ec 0c             	sub    $0xc,%esp
+    2f2b:	68 d5 56 00 00       	push   $0x56d5
+    2f30:	e8 fe 17 00 00       	call   4733 <unlink>
+    2f35:	83 c4 10             	add    $0x10,%esp
+    2f38:	85 c0                	test   %eax,%eax
+    2f3a:	0f 84 22 02 00 00    	je     3162 <subdir+0x622>
+  if(unlink("dd/dd") < 0){
+    2f40:	83 ec 0c             	sub    $0xc,%esp
+    2f43:	68 ea 55 00 00       	push   $0x55ea
+    2f48:	e8 e6 17 00 00       	call   4733 <unlink>
+    2f4d:	83 c4 10             	add    $0x10,%esp
+    2f50:	85 c0                	test   %eax,%eax
+    2f52:	0f 88 f7 01 00 00    	js     314f <subdir+0x60f>
+  if(unlink("dd") < 0){
+    2f58:	83 ec 0c             	sub    $0xc,%esp
+    2f5b:	68 d5 56 00 00       	push   $0x56d5
+    2f60:	e8 ce 17 00 00       	call   4733 <unlink>
+    2f65:	83 c4 10             	add    $0x10,%esp
+    2f68:	85 c0                	test   %eax,%eax
+    2f6a:	0f 88 cc 01 00 00    	js     313c <subdir+0x5fc>
+  printf(1, "subdir ok\n");
+    2f70:	83 ec 08             	sub    $0x8,%esp
+    2f73:	68 b7 58 00 00       	push   $0x58b7
+    2f78:	6a 01                	push   $0x1
+    2f7a:	e8 21 19 00 00       	call   48a0 <printf>
+}
+    2f7f:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    2f82:	83 c4 10             	add    $0x10,%esp
+    2f85:	c9                   	leave
+    2f86:	c3                   	ret
+    printf(1, "dd/dd/../ff wrong content\n");
+    2f87:	50                   	push   %eax
+    2f88:	50                   	push   %eax
+    2f89:	68 54 56 00 00       	push   $0x5654
+    2f8e:	6a 01                	push   $0x1
+    2f90:	e8 0b 19 00 00       	call   48a0 <printf>
+    exit();
+    2f95:	e8 49 17 00 00       	call   46e3 <exit>
+    printf(1, "chdir dd/../../dd failed\n");
+    2f9a:	50                   	push   %eax
+    2f9b:	50                   	push   %eax
+    2f9c:	68 af 56 00 00       	push   $0x56af
+    2fa1:	6a 01                	push   $0x1
+    2fa3:	e8 f8 18 00 00       	call   48a0 <printf>
+    exit();
+    2fa8:	e8 36 17 00 00       	call   46e3 <exit>
+    printf(1, "unlink dd/dd/ff failed\n");
+    2fad:	50                   	push   %eax
+    2fae:	50                   	push   %eax
+    2faf:	68 7a 56 00 00       	push   $0x567a
+    2fb4:	6a 01                	push   $0x1
+    2fb6:	e8 e5 18 00 00       	call   48a0 <printf>
+    exit();
+    2fbb:	e8 23 17 00 00       	call   46e3 <exit>
+    printf(1, "create dd/ff/ff succeeded!\n");
+    2fc0:	51                   	push   %ecx
+    2fc1:	51                   	push   %ecx
+    2fc2:	68 2c 57 00 00       	push   $0x572c
+    2fc7:	6a 01                	push   $0x1
+    2fc9:	e8 d2 18 00 00       	call   48a0 <printf>
+    exit();
+    2fce:	e8 10 17 00 00       	call   46e3 <exit>
+    printf(1, "open (unlinked) dd/dd/ff succeeded!\n");
+    2fd3:	53                   	push   %ebx
+    2fd4:	53                   	push   %ebx
+    2fd5:	68 24 63 00 00       	push   $0x6324
+    2fda:	6a 01                	push   $0x1
+    2fdc:	e8 bf 18 00 00       	call   48a0 <printf>
+    exit();
+    2fe1:	e8 fd 16 00 00       	call   46e3 <exit>
+    printf(1, "mkdir dd/ff/ff succeeded!\n");
+    2fe6:	51                   	push   %ecx
+    2fe7:	51                   	push   %ecx
+    2fe8:	68 c0 57 00 00       	push   $0x57c0
+    2fed:	6a 01                	push   $0x1
+    2fef:	e8 ac 18 00 00       	call   48a0 <printf>
+    exit();
+    2ff4:	e8 ea 16 00 00       	call   46e3 <exit>
+    printf(1, "link dd/ff dd/dd/ffff succeeded!\n");
+    2ff9:	53                   	push   %ebx
+    2ffa:	53                   	push   %ebx
+    2ffb:	68 94 63 00 00       	push   $0x6394
+    3000:	6a 01                	push   $0x1
+    3002:	e8 99 18 00 00       	call   48a0 <printf>
+    exit();
+    3007:	e8 d7 16 00 00       	call   46e3 <exit>
+    printf(1, "open dd/dd/../ff failed\n");
+    300c:	50                   	push   %eax
+    300d:	50                   	push   %eax
+    300e:	68 3b 56 00 00       	push   $0x563b
+    3013:	6a 01                	push   $0x1
+    3015:	e8 86 18 00 00       	call   48a0 <printf>
+    exit();
+    301a:	e8 c4 16 00 00       	call   46e3 <exit>
+    printf(1, "create dd/dd/ff failed\n");
+    301f:	51                   	push   %ecx
+    3020:	51                   	push   %ecx
+    3021:	68 14 56 00 00       	push   $0x5614
+    3026:	6a 01                	push   $0x1
+    3028:	e8 73 18 00 00       	call   48a0 <printf>
+    exit();
+    302d:	e8 b1 16 00 00       	call   46e3 <exit>
+    printf(1, "chdir ./.. failed\n");
+    3032:	50                   	push   %eax
+    3033:	50                   	push   %eax
+    3034:	68 dd 56 00 00       	push   $0x56dd
+    3039:	6a 01                	push   $0x1
+    303b:	e8 60 18 00 00       	call   48a0 <printf>
+    exit();
+    3040:	e8 9e 16 00 00       	call   46e3 <exit>
+    printf(1, "link dd/dd/ff dd/dd/ffff failed\n");
+    3045:	52                   	push   %edx
+    3046:	52                   	push   %edx
+    3047:	68 dc 62 00 00       	push   $0x62dc
+    304c:	6a 01                	push   $0x1
+    304e:	e8 4d 18 00 00       	call   48a0 <printf>
+    exit();
+    3053:	e8 8b 16 00 00       	call   46e3 <exit>
+    printf(1, "link dd/xx/ff dd/dd/xx succeeded!\n");
+    3058:	50                   	push   %eax
+    3059:	50                   	push   %eax
+    305a:	68 70 63 00 00       	push   $0x6370
+    305f:	6a 01                	push   $0x1
+    3061:	e8 3a 18 00 00       	call   48a0 <printf>
+    exit();
+    3066:	e8 78 16 00 00       	call   46e3 <exit>
+    printf(1, "link dd/ff/ff dd/dd/xx succeeded!\n");
+    306b:	50                   	push   %eax
+    306c:	50                   	push   %eax
+    306d:	68 4c 63 00 00       	push   $0x634c
+    3072:	6a 01                	push   $0x1
+    3074:	e8 27 18 00 00       	call   48a0 <printf>
+    exit();
+    3079:	e8 65 16 00 00       	call   46e3 <exit>
+    printf(1, "open dd wronly succeeded!\n");
+    307e:	50                   	push   %eax
+    307f:	50                   	push   %eax
+    3080:	68 9c 57 00 00       	push   $0x579c
+    3085:	6a 01                	push   $0x1
+    3087:	e8 14 18 00 00       	call   48a0 <printf>
+    exit();
+    308c:	e8 52 16 00 00       	call   46e3 <exit>
+    printf(1, "open dd rdwr succeeded!\n");
+    3091:	50                   	push   %eax
+    3092:	50                   	push   %eax
+    3093:	68 83 57 00 00       	push   $0x5783
+    3098:	6a 01                	push   $0x1
+    309a:	e8 01 18 00 00       	call   48a0 <printf>
+    exit();
+    309f:	e8 3f 16 00 00       	call   46e3 <exit>
+    printf(1, "create dd succeeded!\n");
+    30a4:	50                   	push   %eax
+    30a5:	50                   	push   %eax
+    30a6:	68 6d 57 00 00       	push   $0x576d
+    30ab:	6a 01                	push   $0x1
+    30ad:	e8 ee 17 00 00       	call   48a0 <printf>
+    exit();
+    30b2:	e8 2c 16 00 00       	call   46e3 <exit>
+    printf(1, "create dd/xx/ff succeeded!\n");
+    30b7:	52                   	push   %edx
+    30b8:	52                   	push   %edx
+    30b9:	68 51 57 00 00       	push   $0x5751
+    30be:	6a 01                	push   $0x1
+    30c0:	e8 db 17 00 00       	call   48a0 <printf>
+    exit();
+    30c5:	e8 19 16 00 00       	call   46e3 <exit>
+    printf(1, "chdir dd failed\n");
+    30ca:	50                   	push   %eax
+    30cb:	50                   	push   %eax
+    30cc:	68 92 56 00 00       	push   $0x5692
+    30d1:	6a 01                	push   $0x1
+    30d3:	e8 c8 17 00 00       	call   48a0 <printf>
+    exit();
+    30d8:	e8 06 16 00 00       	call   46e3 <exit>
+    printf(1, "open (unlinked) dd/dd/ff succeeded\n");
+    30dd:	50                   	push   %eax
+    30de:	50                   	push   %eax
+    30df:	68 00 63 00 00       	push   $0x6300
+    30e4:	6a 01                	push   $0x1
+    30e6:	e8 b5 17 00 00       	call   48a0 <printf>
+    exit();
+    30eb:	e8 f3 15 00 00       	call   46e3 <exit>
+    printf(1, "subdir mkdir dd/dd failed\n");
+    30f0:	53                   	push   %ebx
+    30f1:	53                   	push   %ebx
+    30f2:	68 f0 55 00 00       	push   $0x55f0
+    30f7:	6a 01                	push   $0x1
+    30f9:	e8 a2 17 00 00       	call   48a0 <printf>
+    exit();
+    30fe:	e8 e0 15 00 00       	call   46e3 <exit>
+    printf(1, "unlink dd (non-empty dir) succeeded!\n");
+    3103:	50                   	push   %eax
+    3104:	50                   	push   %eax
+    3105:	68 b4 62 00 00       	push   $0x62b4
+    310a:	6a 01                	push   $0x1
+    310c:	e8 8f 17 00 00       	call   48a0 <printf>
+    exit();
+    3111:	e8 cd 15 00 00       	call   46e3 <exit>
+    printf(1, "create dd/ff failed\n");
+    3116:	50                   	push   %eax
+    3117:	50                   	push   %eax
+    3118:	68 d4 55 00 00       	push   $0x55d4
+    311d:	6a 01                	push   $0x1
+    311f:	e8 7c 17 00 00       	call   48a0 <printf>
+    exit();
+    3124:	e8 ba 15 00 00       	call   46e3 <exit>
+    printf(1, "subdir mkdir dd failed\n");
+    3129:	50                   	push   %eax
+    312a:	50                   	push   %eax
+    312b:	68 bc 55 00 00       	push   $0x55bc
+    3130:	6a 01                	push   $0x1
+    3132:	e8 69 17 00 00       	call   48a0 <printf>
+    exit();
+    3137:	e8 a7 15 00 00       	call   46e3 <exit>
+    printf(1, "unlink dd failed\n");
+    313c:	50                   	push   %eax
+    313d:	50                   	push   %eax
+    313e:	68 a5 58 00 00       	push   $0x58a5
+    3143:	6a 01                	push   $0x1
+    3145:	e8 56 17 00 00       	call   48a0 <printf>
+    exit();
+    314a:	e8 94 15 00 00       	call   46e3 <exit>
+    printf(1, "unlink dd/dd failed\n");
+    314f:	52                   	push   %edx
+    3150:	52                   	push   %edx
+    3151:	68 90 58 00 00       	push   $0x5890
+    3156:	6a 01                	push   $0x1
+    3158:	e8 43 17 00 00       	call   48a0 <printf>
+    exit();
+    315d:	e8 81 15 00 00       	call   46e3 <exit>
+    printf(1, "unlink non-empty dd succeeded!\n");
+    3162:	51                   	push   %ecx
+    3163:	51                   	push   %ecx
+    3164:	68 b8 63 00 00       	push   $0x63b8
+    3169:	6a 01                	push   $0x1
+    316b:	e8 30 17 00 00       	call   48a0 <printf>
+    exit();
+    3170:	e8 6e 15 00 00       	call   46e3 <exit>
+    printf(1, "unlink dd/ff failed\n");
+    3175:	53                   	push   %ebx
+    3176:	53                   	push   %ebx
+    3177:	68 7b 58 00 00       	push   $0x587b
+    317c:	6a 01                	push   $0x1
+    317e:	e8 1d 17 00 00       	call   48a0 <printf>
+    exit();
+    3183:	e8 5b 15 00 00       	call   46e3 <exit>
+    printf(1, "chdir dd/xx succeeded!\n");
+    3188:	50                   	push   %eax
+    3189:	50                   	push   %eax
+    318a:	68 63 58 00 00       	push   $0x5863
+    318f:	6a 01                	push   $0x1
+    3191:	e8 0a 17 00 00       	call   48a0 <printf>
+    exit();
+    3196:	e8 48 15 00 00       	call   46e3 <exit>
+    printf(1, "chdir dd/ff succeeded!\n");
+    319b:	50                   	push   %eax
+    319c:	50                   	push   %eax
+    319d:	68 4b 58 00 00       	push   $0x584b
+    31a2:	6a 01                	push   $0x1
+    31a4:	e8 f7 16 00 00       	call   48a0 <printf>
+    exit();
+    31a9:	e8 35 15 00 00       	call   46e3 <exit>
+    printf(1, "unlink dd/ff/ff succeeded!\n");
+    31ae:	50                   	push   %eax
+    31af:	50                   	push   %eax
+    31b0:	68 2f 58 00 00       	push   $0x582f
+    31b5:	6a 01                	push   $0x1
+    31b7:	e8 e4 16 00 00       	call   48a0 <printf>
+    exit();
+    31bc:	e8 22 15 00 00       	call   46e3 <exit>
+    printf(1, "unlink dd/xx/ff succeeded!\n");
+    31c1:	50                   	push   %eax
+    31c2:	50                   	push   %eax
+    31c3:	68 13 58 00 00       	push   $0x5813
+    31c8:	6a 01                	push   $0x1
+    31ca:	e8 d1 16 00 00       	call   48a0 <printf>
+    exit();
+    31cf:	e8 0f 15 00 00       	call   46e3 <exit>
+    printf(1, "mkdir dd/dd/ffff succeeded!\n");
+    31d4:	50                   	push   %eax
+    31d5:	50                   	push   %eax
+    31d6:	68 f6 57 00 00       	push   $0x57f6
+    31db:	6a 01                	push   $0x1
+    31dd:	e8 be 16 00 00       	call   48a0 <printf>
+    exit();
+    31e2:	e8 fc 14 00 00       	call   46e3 <exit>
+    printf(1, "mkdir dd/xx/ff succeeded!\n");
+    31e7:	52                   	push   %edx
+    31e8:	52                   	push   %edx
+    31e9:	68 db 57 00 00       	push   $0x57db
+    31ee:	6a 01                	push   $0x1
+    31f0:	e8 ab 16 00 00       	call   48a0 <printf>
+    exit();
+    31f5:	e8 e9 14 00 00       	call   46e3 <exit>
+    printf(1, "read dd/dd/ffff wrong len\n");
+    31fa:	51                   	push   %ecx
+    31fb:	51                   	push   %ecx
+    31fc:	68 08 57 00 00       	push   $0x5708
+    3201:	6a 01                	push   $0x1
+    3203:	e8 98 16 00 00       	call   48a0 <printf>
+    exit();
+    3208:	e8 d6 14 00 00       	call   46e3 <exit>
+    printf(1, "open dd/dd/ffff failed\n");
+    320d:	53                   	push   %ebx
+    320e:	53                   	push   %ebx
+    320f:	68 f0 56 00 00       	push   $0x56f0
+    3214:	6a 01                	push   $0x1
+    3216:	e8 85 16 00 00       	call   48a0 <printf>
+    exit();
+    321b:	e8 c3 14 00 00       	call   46e3 <exit>
+
+00003220 <bigwrite>:
+{
+    3220:	55                   	push   %ebp
+    3221:	89 e5                	mov    %esp,%ebp
+    3223:	56                   	push   %esi
+    3224:	53                   	push   %ebx
+  for(sz = 499; sz < 12*512; sz += 471){
+    3225:	bb f3 01 00 00       	mov    $0x1f3,%ebx
+  printf(1, "bigwrite test\n");
+    322a:	83 ec 08             	sub    $0x8,%esp
+    322d:	68 c2 58 00 00       	push   $0x58c2
+    3232:	6a 01                	push   $0x1
+    3234:	e8 67 16 00 00       	call   48a0 <printf>
+  unlink("bigwrite");
+    3239:	c7 04 24 d1 58 00 00 	movl   $0x58d1,(%esp)
+    3240:	e8 ee 14 00 00       	call   4733 <unlink>
+    3245:	83 c4 10             	add    $0x10,%esp
+    3248:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    324f:	90                   	nop
+    fd = open("bigwrite", O_CREATE | O_RDWR);
+    3250:	83 ec 08             	sub    $0x8,%esp
+    3253:	68 02 02 00 00       	push   $0x202
+    3258:	68 d1 58 00 00       	push   $0x58d1
+    325d:	e8 c1 14 00 00       	call   4723 <open>
+    if(fd < 0){
+    3262:	83 c4 10             	add    $0x10,%esp
+    fd = open("bigwrite", O_CREATE | O_RDWR);
+    3265:	89 c6                	mov    %eax,%esi
+    if(fd < 0){
+    3267:	85 c0                	test   %eax,%eax
+    3269:	78 7e                	js     32e9 <bigwrite+0xc9>
+      int cc = write(fd, buf, sz);
+    326b:	83 ec 04             	sub    $0x4,%esp
+    326e:	53                   	push   %ebx
+    326f:	68 20 9a 00 00       	push   $0x9a20
+    3274:	50                   	push   %eax
+    3275:	e8 89 14 00 00       	call   4703 <write>
+      if(cc != sz){
+    327a:	83 c4 10             	add    $0x10,%esp
+    327d:	39 d8                	cmp    %ebx,%eax
+    327f:	75 55                	jne    32d6 <bigwrite+0xb6>
+      int cc = write(fd, buf, sz);
+    3281:	83 ec 04             	sub    $0x4,%esp
+    3284:	53                   	push   %ebx
+    3285:	68 20 9a 00 00       	push   $0x9a20
+    328a:	56                   	push   %esi
+    328b:	e8 73 14 00 00       	call   4703 <write>
+      if(cc != sz){
+    3290:	83 c4 10             	add    $0x10,%esp
+    3293:	39 c3                	cmp    %eax,%ebx
+    3295:	75 3f                	jne    32d6 <bigwrite+0xb6>
+    close(fd);
+    3297:	83 ec 0c             	sub    $0xc,%esp
+  for(sz = 499; sz < 12*512; sz += 471){
+    329a:	81 c3 d7 01 00 00    	add    $0x1d7,%ebx
+    close(fd);
+    32a0:	56                   	push   %esi
+    32a1:	e8 65 14 00 00       	call   470b <close>
+    unlink("bigwrite");
+    32a6:	c7 04 24 d1 58 00 00 	movl   $0x58d1,(%esp)
+    32ad:	e8 81 14 00 00       	call   4733 <unlink>
+  for(sz = 499; sz < 12*512; sz += 471){
+    32b2:	83 c4 10             	add    $0x10,%esp
+    32b5:	81 fb 07 18 00 00    	cmp    $0x1807,%ebx
+    32bb:	75 93                	jne    3250 <bigwrite+0x30>
+  printf(1, "bigwrite ok\n");
+    32bd:	83 ec 08             	sub    $0x8,%esp
+    32c0:	68 04 59 00 00       	push   $0x5904
+    32c5:	6a 01                	push   $0x1
+    32c7:	e8 d4 15 00 00       	call   48a0 <printf>
+}
+    32cc:	83 c4 10             	add    $0x10,%esp
+    32cf:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    32d2:	5b                   	pop    %ebx
+    32d3:	5e                   	pop    %esi
+    32d4:	5d                   	pop    %ebp
+    32d5:	c3                   	ret
+        printf(1, "write(%d) ret %d\n", sz, cc);
+    32d6:	50                   	push   %eax
+    32d7:	53                   	push   %ebx
+    32d8:	68 f2 58 00 00       	push   $0x58f2
+    32dd:	6a 01                	push   $0x1
+    32df:	e8 bc 15 00 00       	call   48a0 <printf>
+        exit();
+    32e4:	e8 fa 13 00 00       	call   46e3 <exit>
+      printf(1, "cannot create bigwrite\n");
+    32e9:	83 ec 08             	sub    $0x8,%esp
+    32ec:	68 da 58 00 00       	push   $0x58da
+    32f1:	6a 01                	push   $0x1
+    32f3:	e8 a8 15 00 00       	call   48a0 <printf>
+      exit();
+    32f8:	e8 e6 13 00 00       	call   46e3 <exit>
+    32fd:	8d 76 00             	lea    0x0(%esi),%esi
+
+00003300 <bigfile>:
+{
+    3300:	55                   	push   %ebp
+    3301:	89 e5                	mov    %esp,%ebp
+    3303:	57                   	push   %edi
+    3304:	56                   	push   %esi
+    3305:	53                   	push   %ebx
+    3306:	83 ec 14             	sub    $0x14,%esp
+  printf(1, "bigfile test\n");
+    3309:	68 11 59 00 00       	push   $0x5911
+    330e:	6a 01                	push   $0x1
+    3310:	e8 8b 15 00 00       	call   48a0 <printf>
+  unlink("bigfile");
+    3315:	c7 04 24 2d 59 00 00 	movl   $0x592d,(%esp)
+    331c:	e8 12 14 00 00       	call   4733 <unlink>
+  fd = open("bigfile", O_CREATE | O_RDWR);
+    3321:	58                   	pop    %eax
+    3322:	5a                   	pop    %edx
+    3323:	68 02 02 00 00       	push   $0x202
+    3328:	68 2d 59 00 00       	push   $0x592d
+    332d:	e8 f1 13 00 00       	call   4723 <open>
+  if(fd < 0){
+    3332:	83 c4 10             	add    $0x10,%esp
+    3335:	85 c0                	test   %eax,%eax
+    3337:	0f 88 5e 01 00 00    	js     349b <bigfile+0x19b>
+    333d:	89 c6                	mov    %eax,%esi
+  for(i = 0; i < 20; i++){
+    333f:	31 db                	xor    %ebx,%ebx
+    3341:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    memset(buf, i, 600);
+    3348:	83 ec 04             	sub    $0x4,%esp
+    334b:	68 58 02 00 00       	push   $0x258
+    3350:	53                   	push   %ebx
+    3351:	68 20 9a 00 00       	push   $0x9a20
+    3356:	e8 05 12 00 00       	call   4560 <memset>
+    if(write(fd, buf, 600) != 600){
+    335b:	83 c4 0c             	add    $0xc,%esp
+    335e:	68 58 02 00 00       	push   $0x258
+    3363:	68 20 9a 00 00       	push   $0x9a20
+    3368:	56                   	push   %esi
+    3369:	e8 95 13 00 00       	call   4703 <write>
+    336e:	83 c4 10             	add    $0x10,%esp
+    3371:	3d 58 02 00 00       	cmp    $0x258,%eax
+    3376:	0f 85 f8 00 00 00    	jne    3474 <bigfile+0x174>
+  for(i = 0; i < 20; i++){
+    337c:	83 c3 01             	add    $0x1,%ebx
+    337f:	83 fb 14             	cmp    $0x14,%ebx
+    3382:	75 c4                	jne    3348 <bigfile+0x48>
+  close(fd);
+    3384:	83 ec 0c             	sub    $0xc,%esp
+    3387:	56                   	push   %esi
+    3388:	e8 7e 13 00 00       	call   470b <close>
+  fd = open("bigfile", 0);
+    338d:	5e                   	pop    %esi
+    338e:	5f                   	pop    %edi
+    338f:	6a 00                	push   $0x0
+    3391:	68 2d 59 00 00       	push   $0x592d
+    3396:	e8 88 13 00 00       	call   4723 <open>
+  if(fd < 0){
+    339b:	83 c4 10             	add    $0x10,%esp
+  fd = open("bigfile", 0);
+    339e:	89 c6                	mov    %eax,%esi
+  if(fd < 0){
+    33a0:	85 c0                	test   %eax,%eax
+    33a2:	0f 88 e0 00 00 00    	js     3488 <bigfile+0x188>
+  total = 0;
+    33a8:	31 db                	xor    %ebx,%ebx
+  for(i = 0; ; i++){
+    33aa:	31 ff                	xor    %edi,%edi
+    33ac:	eb 30                	jmp    33de <bigfile+0xde>
+    33ae:	66 90                	xchg   %ax,%ax
+    if(cc != 300){
+    33b0:	3d 2c 01 00 00       	cmp    $0x12c,%eax
+    33b5:	0f 85 91 00 00 00    	jne    344c <bigfile+0x14c>
+    if(buf[0] != i/2 || buf[299] != i/2){
+    33bb:	89 fa                	mov    %edi,%edx
+    33bd:	0f be 05 20 9a 00 00 	movsbl 0x9a20,%eax
+    33c4:	d1 fa                	sar    %edx
+    33c6:	39 d0                	cmp    %edx,%eax
+    33c8:	75 6e                	jne    3438 <bigfile+0x138>
+    33ca:	0f be 15 4b 9b 00 00 	movsbl 0x9b4b,%edx
+    33d1:	39 d0                	cmp    %edx,%eax
+    33d3:	75 63                	jne    3438 <bigfile+0x138>
+    total += cc;
+    33d5:	81 c3 2c 01 00 00    	add    $0x12c,%ebx
+  for(i = 0; ; i++){
+    33db:	83 c7 01             	add    $0x1,%edi
+    cc = read(fd, buf, 300);
+    33de:	83 ec 04             	sub    $0x4,%esp
+    33e1:	68 2c 01 00 00       	push   $0x12c
+    33e6:	68 20 9a 00 00       	push   $0x9a20
+    33eb:	56                   	push   %esi
+    33ec:	e8 0a 13 00 00       	call   46fb <read>
+    if(cc < 0){
+    33f1:	83 c4 10             	add    $0x10,%esp
+    33f4:	85 c0                	test   %eax,%eax
+    33f6:	78 68                	js     3460 <bigfile+0x160>
+    if(cc == 0)
+    33f8:	75 b6                	jne    33b0 <bigfile+0xb0>
+  close(fd);
+    33fa:	83 ec 0c             	sub    $0xc,%esp
+    33fd:	56                   	push   %esi
+    33fe:	e8 08 13 00 00       	call   470b <close>
+  if(total != 20*600){
+    3403:	83 c4 10             	add    $0x10,%esp
+    3406:	81 fb e0 2e 00 00    	cmp    $0x2ee0,%ebx
+    340c:	0f 85 9c 00 00 00    	jne    34ae <bigfile+0x1ae>
+  unlink("bigfile");
+    3412:	83 ec 0c             	sub    $0xc,%esp
+    3415:	68 2d 59 00 00       	push   $0x592d
+    341a:	e8 14 13 00 00       	call   4733 <unlink>
+  printf(1, "bigfile test ok\n");
+    341f:	58                   	pop    %eax
+    3420:	5a                   	pop    %edx
+    3421:	68 bc 59 00 00       	push   $0x59bc
+    3426:	6a 01                	push   $0x1
+    3428:	e8 73 14 00 00       	call   48a0 <printf>
+}
+    342d:	83 c4 10             	add    $0x10,%esp
+    3430:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    3433:	5b                   	pop    %ebx
+    3434:	5e                   	pop    %esi
+    3435:	5f                   	pop    %edi
+    3436:	5d                   	pop    %ebp
+    3437:	c3                   	ret
+      printf(1, "read bigfile wrong data\n");
+    3438:	83 ec 08             	sub    $0x8,%esp
+    343b:	68 89 59 00 00       	push   $0x5989
+    3440:	6a 01                	push   $0x1
+    3442:	e8 59 14 00 00       	call   48a0 <printf>
+      exit();
+    3447:	e8 97 12 00 00       	call   46e3 <exit>
+      printf(1, "short read bigfile\n");
+    344c:	83 ec 08             	sub    $0x8,%esp
+    344f:	68 75 59 00 00       	push   $0x5975
+    3454:	6a 01                	push   $0x1
+    3456:	e8 45 14 00 00       	call   48a0 <printf>
+      exit();
+    345b:	e8 83 12 00 00       	call   46e3 <exit>
+      printf(1, "read bigfile failed\n");
+    3460:	83 ec 08             	sub    $0x8,%esp
+    3463:	68 60 59 00 00       	push   $0x5960
+    3468:	6a 01                	push   $0x1
+    346a:	e8 31 14 00 00       	call   48a0 <printf>
+      exit();
+    346f:	e8 6f 12 00 00       	call   46e3 <exit>
+      printf(1, "write bigfile failed\n");
+    3474:	83 ec 08             	sub    $0x8,%esp
+    3477:	68 35 59 00 00       	push   $0x5935
+    347c:	6a 01                	push   $0x1
+    347e:	e8 1d 14 00 00       	call   48a0 <printf>
+      exit();
+    3483:	e8 5b 12 00 00       	call   46e3 <exit>
+    printf(1, "cannot open bigfile\n");
+    3488:	53                   	push   %ebx
+    3489:	53                   	push   %ebx
+    348a:	68 4b 59 00 00       	push   $0x594b
+    348f:	6a 01                	push   $0x1
+    3491:	e8 0a 14 00 00       	call   48a0 <printf>
+    exit();
+    3496:	e8 48 12 00 00       	call   46e3 <exit>
+    printf(1, "cannot create bigfile");
+    349b:	50                   	push   %eax
+    349c:	50                   	push   %eax
+    349d:	68 1f 59 00 00       	push   $0x591f
+    34a2:	6a 01                	push   $0x1
+    34a4:	e8 f7 13 00 00       	call   48a0 <printf>
+    exit();
+    34a9:	e8 35 12 00 00       	call   46e3 <exit>
+    printf(1, "read bigfile wrong total\n");
+    34ae:	51                   	push   %ecx
+    34af:	51                   	push   %ecx
+    34b0:	68 a2 59 00 00       	push   $0x59a2
+    34b5:	6a 01                	push   $0x1
+    34b7:	e8 e4 13 00 00       	call   48a0 <printf>
+    exit();
+    34bc:	e8 22 12 00 00       	call   46e3 <exit>
+    34c1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    34c8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    34cf:	90                   	nop
+
+000034d0 <fourteen>:
+{
+    34d0:	55                   	push   %ebp
+    34d1:	89 e5                	mov    %esp,%ebp
+    34d3:	83 ec 10             	sub    $0x10,%esp
+  printf(1, "fourteen test\n");
+    34d6:	68 cd 59 00 00       	push   $0x59cd
+    34db:	6a 01                	push   $0x1
+    34dd:	e8 be 13 00 00       	call   48a0 <printf>
+  if(mkdir("12345678901234") != 0){
+    34e2:	c7 04 24 08 5a 00 00 	movl   $0x5a08,(%esp)
+    34e9:	e8 5d 12 00 00       	call   474b <mkdir>
+    34ee:	83 c4 10             	add    $0x10,%esp
+    34f1:	85 c0                	test   %eax,%eax
+    34f3:	0f 85 97 00 00 00    	jne    3590 <fourteen+0xc0>
+  if(mkdir("12345678901234/123456789012345") != 0){
+    34f9:	83 ec 0c             	sub    $0xc,%esp
+    34fc:	68 d8 63 00 00       	push   $0x63d8
+    3501:	e8 45 12 00 00       	call   474b <mkdir>
+    3506:	83 c4 10             	add    $0x10,%esp
+    3509:	85 c0                	test   %eax,%eax
+    350b:	0f 85 de 00 00 00    	jne    35ef <fourteen+0x11f>
+  fd = open("123456789012345/123456789012345/123456789012345", O_CREATE);
+    3511:	83 ec 08             	sub    $0x8,%esp
+    3514:	68 00 02 00 00       	push   $0x200
+    3519:	68 28 64 00 00       	push   $0x6428
+    351e:	e8 00 12 00 00       	call   4723 <open>
+  if(fd < 0){
+    3523:	83 c4 10             	add    $0x10,%esp
+    3526:	85 c0                	test   %eax,%eax
+    3528:	0f 88 ae 00 00 00    	js     35dc <fourteen+0x10c>
+  close(fd);
+    352e:	83 ec 0c             	sub    $0xc,%esp
+    3531:	50                   	push   %eax
+    3532:	e8 d4 11 00 00       	call   470b <close>
+  fd = open("12345678901234/12345678901234/12345678901234", 0);
+    3537:	58                   	pop    %eax
+    3538:	5a                   	pop    %edx
+    3539:	6a 00                	push   $0x0
+    353b:	68 98 64 00 00       	push   $0x6498
+    3540:	e8 de 11 00 00       	call   4723 <open>
+  if(fd < 0){
+    3545:	83 c4 10             	add    $0x10,%esp
+    3548:	85 c0                	test   %eax,%eax
+    354a:	78 7d                	js     35c9 <fourteen+0xf9>
+  close(fd);
+    354c:	83 ec 0c             	sub    $0xc,%esp
+    354f:	50                   	push   %eax
+    3550:	e8 b6 11 00 00       	call   470b <close>
+  if(mkdir("12345678901234/12345678901234") == 0){
+    3555:	c7 04 24 f9 59 00 00 	movl   $0x59f9,(%esp)
+    355c:	e8 ea 11 00 00       	call   474b <mkdir>
+    3561:	83 c4 10             	add    $0x10,%esp
+    3564:	85 c0                	test   %eax,%eax
+    3566:	74 4e                	je     35b6 <fourteen+0xe6>
+  if(mkdir("123456789012345/12345678901234") == 0){
+    3568:	83 ec 0c             	sub    $0xc,%esp
+    356b:	68 34 65 00 00       	push   $0x6534
+    3570:	e8 d6 11 00 00       	call   474b <mkdir>
+    3575:	83 c4 10             	add    $0x10,%esp
+    3578:	85 c0                	test   %eax,%eax
+    357a:	74 27                	je     35a3 <fourteen+0xd3>
+  printf(1, "fourteen ok\n");
+    357c:	83 ec 08             	sub    $0x8,%esp
+    357f:	68 17 5a 00 00       	push   $0x5a17
+    3584:	6a 01                	push   $0x1
+    3586:	e8 15 13 00 00       	call   48a0 <printf>
+}
+    358b:	83 c4 10             	add    $0x10,%esp
+    358e:	c9                   	leave
+    358f:	c3                   	ret
+    printf(1, "mkdir 12345678901234 failed\n");
+    3590:	50                   	push   %eax
+    3591:	50                   	push   %eax
+    3592:	68 dc 59 00 00       	push   $0x59dc
+    3597:	6a 01                	push   $0x1
+    3599:	e8 02 13 00 00       	call   48a0 <printf>
+    exit();
+    359e:	e8 40 11 00 00       	call   46e3 <exit>
+    printf(1, "mkdir 12345678901234/123456789012345 succeeded!\n");
+    35a3:	50                   	push   %eax
+    35a4:	50                   	push   %eax
+    35a5:	68 54 65 00 00       	push   $0x6554
+    35aa:	6a 01                	push   $0x1
+    35ac:	e8 ef 12 00 00       	call   48a0 <printf>
+    exit();
+    35b1:	e8 2d 11 00 00       	call   46e3 <exit>
+    printf(1, "mkdir 12345678901234/12345678901234 succeeded!\n");
+    35b6:	52                   	push   %edx
+    35b7:	52                   	push   %edx
+    35b8:	68 04 65 00 00       	push   $0x6504
+    35bd:	6a 01                	push   $0x1
+    35bf:	e8 dc 12 00 00       	call   48a0 <printf>
+    exit();
+    35c4:	e8 1a 11 00 00       	call   46e3 <exit>
+    printf(1, "open 12345678901234/12345678901234/12345678901234 failed\n");
+    35c9:	51                   	push   %ecx
+    35ca:	51                   	push   %ecx
+    35cb:	68 c8 64 00 00       	push   $0x64c8
+    35d0:	6a 01                	push   $0x1
+    35d2:	e8 c9 12 00 00       	call   48a0 <printf>
+    exit();
+    35d7:	e8 07 11 00 00       	call   46e3 <exit>
+    printf(1, "create 123456789012345/123456789012345/123456789012345 failed\n");
+    35dc:	51                   	push   %ecx
+    35dd:	51                   	push   %ecx
+    35de:	68 58 64 00 00       	push   $0x6458
+    35e3:	6a 01                	push   $0x1
+    35e5:	e8 b6 12 00 00       	call   48a0 <printf>
+    exit();
+    35ea:	e8 f4 10 00 00       	call   46e3 <exit>
+    printf(1, "mkdir 12345678901234/123456789012345 failed\n");
+    35ef:	50                   	push   %eax
+    35f0:	50                   	push   %eax
+    35f1:	68 f8 63 00 00       	push   $0x63f8
+    35f6:	6a 01                	push   $0x1
+    35f8:	e8 a3 12 00 00       	call   48a0 <printf>
+    exit();
+    35fd:	e8 e1 10 00 00       	call   46e3 <exit>
+    3602:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    3609:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00003610 <rmdot>:
+{
+    3610:	55                   	push   %ebp
+    3611:	89 e5                	mov    %esp,%ebp
+    3613:	83 ec 10             	sub    $0x10,%esp
+  printf(1, "rmdot test\n");
+    3616:	68 24 5a 00 00       	push   $0x5a24
+    361b:	6a 01                	push   $0x1
+    361d:	e8 7e 12 00 00       	call   48a0 <printf>
+  if(mkdir("dots") != 0){
+    3622:	c7 04 24 30 5a 00 00 	movl   $0x5a30,(%esp)
+    3629:	e8 1d 11 00 00       	call   474b <mkdir>
+    362e:	83 c4 10             	add    $0x10,%esp
+    3631:	85 c0                	test   %eax,%eax
+    3633:	0f 85 b0 00 00 00    	jne    36e9 <rmdot+0xd9>
+  if(chdir("dots") != 0){
+    3639:	83 ec 0c             	sub    $0xc,%esp
+    363c:	68 30 5a 00 00       	push   $0x5a30
+    3641:	e8 0d 11 00 00       	call   4753 <chdir>
+    3646:	83 c4 10             	add    $0x10,%esp
+    3649:	85 c0                	test   %eax,%eax
+    364b:	0f 85 1d 01 00 00    	jne    376e <rmdot+0x15e>
+  if(unlink(".") == 0){
+    3651:	83 ec 0c             	sub    $0xc,%esp
+    3654:	68 db 56 00 00       	push   $0x56db
+    3659:	e8 d5 10 00 00       	call   4733 <unlink>
+    365e:	83 c4 10             	add    $0x10,%esp
+    3661:	85 c0                	test   %eax,%eax
+    3663:	0f 84 f2 00 00 00    	je     375b <rmdot+0x14b>
+  if(unlink("..") == 0){
+    3669:	83 ec 0c             	sub    $0xc,%esp
+    366c:	68 da 56 00 00       	push   $0x56da
+    3671:	e8 bd 10 00 00       	call   4733 <unlink>
+    3676:	83 c4 10             	add    $0x10,%esp
+    3679:	85 c0                	test   %eax,%eax
+    367b:	0f 84 c7 00 00 00    	je     3748 <rmdot+0x138>
+  if(chdir("/") != 0){
+    3681:	83 ec 0c             	sub    $0xc,%esp
+    3684:	68 11 4c 00 00       	push   $0x4c11
+    3689:	e8 c5 10 00 00       	call   4753 <chdir>
+    368e:	83 c4 10             	add    $0x10,%esp
+    3691:	85 c0                	test   %eax,%eax
+    3693:	0f 85 9c 00 00 00    	jne    3735 <rmdot+0x125>
+  if(unlink("dots/.") == 0){
+    3699:	83 ec 0c             	sub    $0xc,%esp
+    369c:	68 78 5a 00 00       	push   $0x5a78
+    36a1:	e8 8d 10 00 00       	call   4733 <unlink>
+    36a6:	83 c4 10             	add    $0x10,%esp
+    36a9:	85 c0                	test   %eax,%eax
+    36ab:	74 75                	je     3722 <rmdot+0x112>
+  if(unlink("dots/..") == 0){
+    36ad:	83 ec 0c             	sub    $0xc,%esp
+    36b0:	68 96 5a 00 00       	push   $0x5a96
+    36b5:	e8 79 10 00 00       	call   4733 <unlink>
+    36ba:	83 c4 10             	add    $0x10,%esp
+    36bd:	85 c0                	test   %eax,%eax
+    36bf:	74 4e                	je     370f <rmdot+0xff>
+  if(unlink("dots") != 0){
+    36c1:	83 ec 0c             	sub    $0xc,%esp
+    36c4:	68 30 5a 00 00       	push   $0x5a30
+    36c9:	e8 65 10 00 00       	call   4733 <unlink>
+    36ce:	83 c4 10             	add    $0x10,%esp
+    36d1:	85 c0                	test   %eax,%eax
+    36d3:	75 27                	jne    36fc <rmdot+0xec>
+  printf(1, "rmdot ok\n");
+    36d5:	83 ec 08             	sub    $0x8,%esp
+    36d8:	68 cb 5a 00 00       	push   $0x5acb
+    36dd:	6a 01                	push   $0x1
+    36df:	e8 bc 11 00 00       	call   48a0 <printf>
+}
+    36e4:	83 c4 10             	add    $0x10,%esp
+    36e7:	c9                   	leave
+    36e8:	c3                   	ret
+    printf(1, "mkdir dots failed\n");
+    36e9:	50                   	push   %eax
+    36ea:	50                   	push   %eax
+    36eb:	68 35 5a 00 00       	push   $0x5a35
+    36f0:	6a 01                	push   $0x1
+    36f2:	e8 a9 11 00 00       	call   48a0 <printf>
+    exit();
+    36f7:	e8 e7 0f 00 00       	call   46e3 <exit>
+    printf(1, "unlink dots failed!\n");
+    36fc:	50                   	push   %eax
+    36fd:	50                   	push   %eax
+    36fe:	68 b6 5a 00 00       	push   $0x5ab6
+    3703:	6a 01                	push   $0x1
+    3705:	e8 96 11 00 00       	call   48a0 <printf>
+    exit();
+    370a:	e8 d4 0f 00 00       	call   46e3 <exit>
+    printf(1, "unlink dots/.. worked!\n");
+    370f:	52                   	push   %edx
+    3710:	52                   	push   %edx
+    3711:	68 9e 5a 00 00       	push   $0x5a9e
+    3716:	6a 01                	push   $0x1
+    3718:	e8 83 11 00 00       	call   48a0 <printf>
+    exit();
+    371d:	e8 c1 0f 00 00       	call   46e3 <exit>
+    printf(1, "unlink dots/. worked!\n");
+    3722:	51                   	push   %ecx
+    3723:	51                   	push   %ecx
+    3724:	68 7f 5a 00 00       	push   $0x5a7f
+    3729:	6a 01                	push   $0x1
+    372b:	e8 70 11 00 00       	call   48a0 <printf>
+    exit();
+    3730:	e8 ae 0f 00 00       	call   46e3 <exit>
+    printf(1, "chdir / failed\n");
+    3735:	50                   	push   %eax
+    3736:	50                   	push   %eax
+    3737:	68 13 4c 00 00       	push   $0x4c13
+    373c:	6a 01                	push   $0x1
+    373e:	e8 5d 11 00 00       	call   48a0 <printf>
+    exit();
+    3743:	e8 9b 0f 00 00       	call   46e3 <exit>
+    printf(1, "rm .. worked!\n");
+    3748:	50                   	push   %eax
+    3749:	50                   	push   %eax
+    374a:	68 69 5a 00 00       	push   $0x5a69
+    374f:	6a 01                	push   $0x1
+    3751:	e8 4a 11 00 00       	call   48a0 <printf>
+    exit();
+    3756:	e8 88 0f 00 00       	call   46e3 <exit>
+    printf(1, "rm . worked!\n");
+    375b:	50                   	push   %eax
+    375c:	50                   	push   %eax
+    375d:	68 5b 5a 00 00       	push   $0x5a5b
+    3762:	6a 01                	push   $0x1
+    3764:	e8 37 11 00 00       	call   48a0 <printf>
+    exit();
+    3769:	e8 75 0f 00 00       	call   46e3 <exit>
+    printf(1, "chdir dots failed\n");
+    376e:	50                   	push   %eax
+    376f:	50                   	push   %eax
+    3770:	68 48 5a 00 00       	push   $0x5a48
+    3775:	6a 01                	push   $0x1
+    3777:	e8 24 11 00 00       	call   48a0 <printf>
+    exit();
+    377c:	e8 62 0f 00 00       	call   46e3 <exit>
+    3781:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    3788:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    378f:	90                   	nop
+
+00003790 <dirfile>:
+{
+    3790:	55                   	push   %ebp
+    3791:	89 e5                	mov    %esp,%ebp
+    3793:	53                   	push   %ebx
+    3794:	83 ec 0c             	sub    $0xc,%esp
+  printf(1, "dir vs file\n");
+    3797:	68 d5 5a 00 00       	push   $0x5ad5
+    379c:	6a 01                	push   $0x1
+    379e:	e8 fd 10 00 00       	call   48a0 <printf>
+  fd = open("dirfile", O_CREATE);
+    37a3:	5b                   	pop    %ebx
+    37a4:	58                   	pop    %eax
+    37a5:	68 00 02 00 00       	push   $0x200
+    37aa:	68 e2 5a 00 00       	push   $0x5ae2
+    37af:	e8 6f 0f 00 00       	call   4723 <open>
+  if(fd < 0){
+    37b4:	83 c4 10             	add    $0x10,%esp
+    37b7:	85 c0                	test   %eax,%eax
+    37b9:	0f 88 43 01 00 00    	js     3902 <dirfile+0x172>
+  close(fd);
+    37bf:	83 ec 0c             	sub    $0xc,%esp
+    37c2:	50                   	push   %eax
+    37c3:	e8 43 0f 00 00       	call   470b <close>
+  if(chdir("dirfile") == 0){
+    37c8:	c7 04 24 e2 5a 00 00 	movl   $0x5ae2,(%esp)
+    37cf:	e8 7f 0f 00 00       	call   4753 <chdir>
+    37d4:	83 c4 10             	add    $0x10,%esp
+    37d7:	85 c0                	test   %eax,%eax
+    37d9:	0f 84 10 01 00 00    	je     38ef <dirfile+0x15f>
+  fd = open("dirfile/xx", 0);
+    37df:	83 ec 08             	sub    $0x8,%esp
+    37e2:	6a 00                	push   $0x0
+    37e4:	68 1b 5b 00 00       	push   $0x5b1b
+    37e9:	e8 35 0f 00 00       	call   4723 <open>
+  if(fd >= 0){
+    37ee:	83 c4 10             	add    $0x10,%esp
+    37f1:	85 c0                	test   %eax,%eax
+    37f3:	0f 89 e3 00 00 00    	jns    38dc <dirfile+0x14c>
+  fd = open("dirfile/xx", O_CREATE);
+    37f9:	83 ec 08             	sub    $0x8,%esp
+    37fc:	68 00 02 00 00       	push   $0x200
+    3801:	68 1b 5b 00 00       	push   $0x5b1b
+    3806:	e8 18 0f 00 00       	call   4723 <open>
+  if(fd >= 0){
+    380b:	83 c4 10             	add    $0x10,%esp
+    380e:	85 c0                	test   %eax,%eax
+    3810:	0f 89 c6 00 00 00    	jns    38dc <dirfile+0x14c>
+  if(mkdir("dirfile/xx") == 0){
+    3816:	83 ec 0c             	sub    $0xc,%esp
+    3819:	68 1b 5b 00 00       	push   $0x5b1b
+    381e:	e8 28 0f 00 00       	call   474b <mkdir>
+    3823:	83 c4 10             	add    $0x10,%esp
+    3826:	85 c0                	test   %eax,%eax
+    3828:	0f 84 46 01 00 00    	je     3974 <dirfile+0x1e4>
+  if(unlink("dirfile/xx") == 0){
+    382e:	83 ec 0c             	sub    $0xc,%esp
+    3831:	68 1b 5b 00 00       	push   $0x5b1b
+    3836:	e8 f8 0e 00 00       	call   4733 <unlink>
+    383b:	83 c4 10             	add    $0x10,%esp
+    383e:	85 c0                	test   %eax,%eax
+    3840:	0f 84 1b 01 00 00    	je     3961 <dirfile+0x1d1>
+  if(link("README", "dirfile/xx") == 0){
+    3846:	83 ec 08             	sub    $0x8,%esp
+    3849:	68 1b 5b 00 00       	push   $0x5b1b
+    384e:	68 7f 5b 00 00       	push   $0x5b7f
+    3853:	e8 eb 0e 00 00       	call   4743 <link>
+    3858:	83 c4 10             	add    $0x10,%esp
+    385b:	85 c0                	test   %eax,%eax
+    385d:	0f 84 eb 00 00 00    	je     394e <dirfile+0x1be>
+  if(unlink("dirfile") != 0){
+    3863:	83 ec 0c             	sub    $0xc,%esp
+    3866:	68 e2 5a 00 00       	push   $0x5ae2
+    386b:	e8 c3 0e 00 00       	call   4733 <unlink>
+    3870:	83 c4 10             	add    $0x10,%esp
+    3873:	85 c0                	test   %eax,%eax
+    3875:	0f 85 c0 00 00 00    	jne    393b <dirfile+0x1ab>
+  fd = open(".", O_RDWR);
+    387b:	83 ec 08             	sub    $0x8,%esp
+    387e:	6a 02                	push   $0x2
+    3880:	68 db 56 00 00       	push   $0x56db
+    3885:	e8 99 0e 00 00       	call   4723 <open>
+  if(fd >= 0){
+    388a:	83 c4 10             	add    $0x10,%esp
+    388d:	85 c0                	test   %eax,%eax
+    388f:	0f 89 93 00 00 00    	jns    3928 <dirfile+0x198>
+  fd = open(".", 0);
+    3895:	83 ec 08             	sub    $0x8,%esp
+    3898:	6a 00                	push   $0x0
+    389a:	68 db 56 00 00       	push   $0x56db
+    389f:	e8 7f 0e 00 00       	call   4723 <open>
+  if(write(fd, "x", 1) > 0){
+    38a4:	83 c4 0c             	add    $0xc,%esp
+    38a7:	6a 01                	push   $0x1
+  fd = open(".", 0);
+    38a9:	89 c3                	mov    %eax,%ebx
+  if(write(fd, "x", 1) > 0){
+    38ab:	68 be 57 00 00       	push   $0x57be
+    38b0:	50                   	push   %eax
+    38b1:	e8 4d 0e 00 00       	call   4703 <write>
+    38b6:	83 c4 10             	add    $0x10,%esp
+    38b9:	85 c0                	test   %eax,%eax
+    38bb:	7f 58                	jg     3915 <dirfile+0x185>
+  close(fd);
+    38bd:	83 ec 0c             	sub    $0xc,%esp
+    38c0:	53                   	push   %ebx
+    38c1:	e8 45 0e 00 00       	call   470b <close>
+  printf(1, "dir vs file OK\n");
+    38c6:	58                   	pop    %eax
+    38c7:	5a                   	pop    %edx
+    38c8:	68 b2 5b 00 00       	push   $0x5bb2
+    38cd:	6a 01                	push   $0x1
+    38cf:	e8 cc 0f 00 00       	call   48a0 <printf>
+}
+    38d4:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    38d7:	83 c4 10             	add    $0x10,%esp
+    38da:	c9                   	leave
+    38db:	c3                   	ret
+    printf(1, "create dirfile/xx succeeded!\n");
+    38dc:	50                   	push   %eax
+    38dd:	50                   	push   %eax
+    38de:	68 26 5b 00 00       	push   $0x5b26
+    38e3:	6a 01                	push   $0x1
+    38e5:	e8 b6 0f 00 00       	call   48a0 <printf>
+    exit();
+    38ea:	e8 f4 0d 00 00       	call   46e3 <exit>
+    printf(1, "chdir dirfile succeeded!\n");
+    38ef:	52                   	push   %edx
+    38f0:	52                   	push   %edx
+    38f1:	68 01 5b 00 00       	push   $0x5b01
+    38f6:	6a 01                	push   $0x1
+    38f8:	e8 a3 0f 00 00       	call   48a0 <printf>
+    exit();
+    38fd:	e8 e1 0d 00 00       	call   46e3 <exit>
+    printf(1, "create dirfile failed\n");
+    3902:	51                   	push   %ecx
+    3903:	51                   	push   %ecx
+    3904:	68 ea 5a 00 00       	push   $0x5aea
+    3909:	6a 01                	push   $0x1
+    390b:	e8 90 0f 00 00       	call   48a0 <printf>
+    exit();
+    3910:	e8 ce 0d 00 00       	call   46e3 <exit>
+    printf(1, "write . succeeded!\n");
+    3915:	51                   	push   %ecx
+    3916:	51                   	push   %ecx
+    3917:	68 9e 5b 00 00       	push   $0x5b9e
+    391c:	6a 01                	push   $0x1
+    391e:	e8 7d 0f 00 00       	call   48a0 <printf>
+    exit();
+    3923:	e8 bb 0d 00 00       	call   46e3 <exit>
+    printf(1, "open . for writing succeeded!\n");
+    3928:	53                   	push   %ebx
+    3929:	53                   	push   %ebx
+    392a:	68 a8 65 00 00       	push   $0x65a8
+    392f:	6a 01                	push   $0x1
+    3931:	e8 6a 0f 00 00       	call   48a0 <printf>
+    exit();
+    3936:	e8 a8 0d 00 00       	call   46e3 <exit>
+    printf(1, "unlink dirfile failed!\n");
+    393b:	50                   	push   %eax
+    393c:	50                   	push   %eax
+    393d:	68 86 5b 00 00       	push   $0x5b86
+    3942:	6a 01                	push   $0x1
+    3944:	e8 57 0f 00 00       	call   48a0 <printf>
+    exit();
+    3949:	e8 95 0d 00 00       	call   46e3 <exit>
+    printf(1, "link to dirfile/xx succeeded!\n");
+    394e:	50                   	push   %eax
+    394f:	50                   	push   %eax
+    3950:	68 88 65 00 00       	push   $0x6588
+    3955:	6a 01                	push   $0x1
+    3957:	e8 44 0f 00 00       	call   48a0 <printf>
+    exit();
+    395c:	e8 82 0d 00 00       	call   46e3 <exit>
+    printf(1, "unlink dirfile/xx succeeded!\n");
+    3961:	50                   	push   %eax
+    3962:	50                   	push   %eax
+    3963:	68 61 5b 00 00       	push   $0x5b61
+    3968:	6a 01                	push   $0x1
+    396a:	e8 31 0f 00 00       	call   48a0 <printf>
+    exit();
+    396f:	e8 6f 0d 00 00       	call   46e3 <exit>
+    printf(1, "mkdir dirfile/xx succeeded!\n");
+    3974:	50                   	push   %eax
+    3975:	50                   	push   %eax
+    3976:	68 44 5b 00 00       	push   $0x5b44
+    397b:	6a 01                	push   $0x1
+    397d:	e8 1e 0f 00 00       	call   48a0 <printf>
+    exit();
+    3982:	e8 5c 0d 00 00       	call   46e3 <exit>
+    3987:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    398e:	66 90                	xchg   %ax,%ax
+
+00003990 <iref>:
+{
+    3990:	55                   	push   %ebp
+    3991:	89 e5                	mov    %esp,%ebp
+    3993:	53                   	push   %ebx
+  printf(1, "empty file name\n");
+    3994:	bb 33 00 00 00       	mov    $0x33,%ebx
+{
+    3999:	83 ec 0c             	sub    $0xc,%esp
+  printf(1, "empty file name\n");
+    399c:	68 c2 5b 00 00       	push   $0x5bc2
+    39a1:	6a 01                	push   $0x1
+    39a3:	e8 f8 0e 00 00       	call   48a0 <printf>
+    39a8:	83 c4 10             	add    $0x10,%esp
+    39ab:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    39af:	90                   	nop
+    if(mkdir("irefd") != 0){
+    39b0:	83 ec 0c             	sub    $0xc,%esp
+    39b3:	68 d3 5b 00 00       	push   $0x5bd3
+    39b8:	e8 8e 0d 00 00       	call   474b <mkdir>
+    39bd:	83 c4 10             	add    $0x10,%esp
+    39c0:	85 c0                	test   %eax,%eax
+    39c2:	0f 85 bb 00 00 00    	jne    3a83 <iref+0xf3>
+    if(chdir("irefd") != 0){
+    39c8:	83 ec 0c             	sub    $0xc,%esp
+    39cb:	68 d3 5b 00 00       	push   $0x5bd3
+    39d0:	e8 7e 0d 00 00       	call   4753 <chdir>
+    39d5:	83 c4 10             	add    $0x10,%esp
+    39d8:	85 c0                	test   %eax,%eax
+    39da:	0f 85 b7 00 00 00    	jne    3a97 <iref+0x107>
+    mkdir("");
+    39e0:	83 ec 0c             	sub    $0xc,%esp
+    39e3:	68 88 52 00 00       	push   $0x5288
+    39e8:	e8 5e 0d 00 00       	call   474b <mkdir>
+    link("README", "");
+    39ed:	59                   	pop    %ecx
+    39ee:	58                   	pop    %eax
+    39ef:	68 88 52 00 00       	push   $0x5288
+    39f4:	68 7f 5b 00 00       	push   $0x5b7f
+    39f9:	e8 45 0d 00 00       	call   4743 <link>
+    fd = open("", O_CREATE);
+    39fe:	58                   	pop    %eax
+    39ff:	5a                   	pop    %edx
+    3a00:	68 00 02 00 00       	push   $0x200
+    3a05:	68 88 52 00 00       	push   $0x5288
+    3a0a:	e8 14 0d 00 00       	call   4723 <open>
+    if(fd >= 0)
+    3a0f:	83 c4 10             	add    $0x10,%esp
+    3a12:	85 c0                	test   %eax,%eax
+    3a14:	78 0c                	js     3a22 <iref+0x92>
+      close(fd);
+    3a16:	83 ec 0c             	sub    $0xc,%esp
+    3a19:	50                   	push   %eax
+    3a1a:	e8 ec 0c 00 00       	call   470b <close>
+    3a1f:	83 c4 10             	add    $0x10,%esp
+    fd = open("xx", O_CREATE);
+    3a22:	83 ec 08             	sub    $0x8,%esp
+    3a25:	68 00 02 00 00       	push   $0x200
+    3a2a:	68 bd 57 00 00       	push   $0x57bd
+    3a2f:	e8 ef 0c 00 00       	call   4723 <open>
+    if(fd >= 0)
+    3a34:	83 c4 10             	add    $0x10,%esp
+    3a37:	85 c0                	test   %eax,%eax
+    3a39:	78 0c                	js     3a47 <iref+0xb7>
+      close(fd);
+    3a3b:	83 ec 0c             	sub    $0xc,%esp
+    3a3e:	50                   	push   %eax
+    3a3f:	e8 c7 0c 00 00       	call   470b <close>
+    3a44:	83 c4 10             	add    $0x10,%esp
+    unlink("xx");
+    3a47:	83 ec 0c             	sub    $0xc,%esp
+    3a4a:	68 bd 57 00 00       	push   $0x57bd
+    3a4f:	e8 df 0c 00 00       	call   4733 <unlink>
+  for(i = 0; i < 50 + 1; i++){
+    3a54:	83 c4 10             	add    $0x10,%esp
+    3a57:	83 eb 01             	sub    $0x1,%ebx
+    3a5a:	0f 85 50 ff ff ff    	jne    39b0 <iref+0x20>
+  chdir("/");
+    3a60:	83 ec 0c             	sub    $0xc,%esp
+    3a63:	68 11 4c 00 00       	push   $0x4c11
+    3a68:	e8 e6 0c 00 00       	call   4753 <chdir>
+  printf(1, "empty file name OK\n");
+    3a6d:	58                   	pop    %eax
+    3a6e:	5a                   	pop    %edx
+    3a6f:	68 01 5c 00 00       	push   $0x5c01
+    3a74:	6a 01                	push   $0x1
+    3a76:	e8 25 0e 00 00       	call   48a0 <printf>
+}
+    3a7b:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    3a7e:	83 c4 10             	add    $0x10,%esp
+    3a81:	c9                   	leave
+    3a82:	c3                   	ret
+      printf(1, "mkdir irefd failed\n");
+    3a83:	83 ec 08             	sub    $0x8,%esp
+    3a86:	68 d9 5b 00 00       	push   $0x5bd9
+    3a8b:	6a 01                	push   $0x1
+    3a8d:	e8 0e 0e 00 00       	call   48a0 <printf>
+      exit();
+    3a92:	e8 4c 0c 00 00       	call   46e3 <exit>
+      printf(1, "chdir irefd failed\n");
+    3a97:	83 ec 08             	sub    $0x8,%esp
+    3a9a:	68 ed 5b 00 00       	push   $0x5bed
+    3a9f:	6a 01                	push   $0x1
+    3aa1:	e8 fa 0d 00 00       	call   48a0 <printf>
+      exit();
+    3aa6:	e8 38 0c 00 00       	call   46e3 <exit>
+    3aab:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    3aaf:	90                   	nop
+
+00003ab0 <forktest>:
+{
+    3ab0:	55                   	push   %ebp
+    3ab1:	89 e5                	mov    %esp,%ebp
+    3ab3:	53                   	push   %ebx
+  for(n=0; n<1000; n++){
+    3ab4:	31 db                	xor    %ebx,%ebx
+{
+    3ab6:	83 ec 0c             	sub    $0xc,%esp
+  printf(1, "fork test\n");
+    3ab9:	68 15 5c 00 00       	push   $0x5c15
+    3abe:	6a 01                	push   $0x1
+    3ac0:	e8 db 0d 00 00       	call   48a0 <printf>
+    3ac5:	83 c4 10             	add    $0x10,%esp
+    3ac8:	eb 13                	jmp    3add <forktest+0x2d>
+    3aca:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    if(pid == 0)
+    3ad0:	74 4d                	je     3b1f <forktest+0x6f>
+  for(n=0; n<1000; n++){
+    3ad2:	83 c3 01             	add    $0x1,%ebx
+    3ad5:	81 fb e8 03 00 00    	cmp    $0x3e8,%ebx
+    3adb:	74 6e                	je     3b4b <forktest+0x9b>
+    pid = fork();
+    3add:	e8 f9 0b 00 00       	call   46db <fork>
+    if(pid < 0)
+    3ae2:	85 c0                	test   %eax,%eax
+    3ae4:	79 ea                	jns    3ad0 <forktest+0x20>
+  for(; n > 0; n--){
+    3ae6:	85 db                	test   %ebx,%ebx
+    3ae8:	74 14                	je     3afe <forktest+0x4e>
+    3aea:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    if(wait() < 0){
+    3af0:	e8 f6 0b 00 00       	call   46eb <wait>
+    3af5:	85 c0                	test   %eax,%eax
+    3af7:	78 2b                	js     3b24 <forktest+0x74>
+  for(; n > 0; n--){
+    3af9:	83 eb 01             	sub    $0x1,%ebx
+    3afc:	75 f2                	jne    3af0 <forktest+0x40>
+  if(wait() != -1){
+    3afe:	e8 e8 0b 00 00       	call   46eb <wait>
+    3b03:	83 f8 ff             	cmp    $0xffffffff,%eax
+    3b06:	75 30                	jne    3b38 <forktest+0x88>
+  printf(1, "fork test OK\n");
+    3b08:	83 ec 08             	sub    $0x8,%esp
+    3b0b:	68 47 5c 00 00       	push   $0x5c47
+    3b10:	6a 01                	push   $0x1
+    3b12:	e8 89 0d 00 00       	call   48a0 <printf>
+}
+    3b17:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    3b1a:	83 c4 10             	add    $0x10,%esp
+    3b1d:	c9                   	leave
+    3b1e:	c3                   	ret
+      exit();
+    3b1f:	e8 bf 0b 00 00       	call   46e3 <exit>
+      printf(1, "wait stopped early\n");
+    3b24:	83 ec 08             	sub    $0x8,%esp
+    3b27:	68 20 5c 00 00       	push   $0x5c20
+    3b2c:	6a 01                	push   $0x1
+    3b2e:	e8 6d 0d 00 00       	call   48a0 <printf>
+      exit();
+    3b33:	e8 ab 0b 00 00       	call   46e3 <exit>
+    printf(1, "wait got too many\n");
+    3b38:	50                   	push   %eax
+    3b39:	50                   	push   %eax
+    3b3a:	68 34 5c 00 00       	push   $0x5c34
+    3b3f:	6a 01                	push   $0x1
+    3b41:	e8 5a 0d 00 00       	call   48a0 <printf>
+    exit();
+    3b46:	e8 98 0b 00 00       	call   46e3 <exit>
+    printf(1, "fork claimed to work 1000 times!\n");
+    3b4b:	52                   	push   %edx
+    3b4c:	52                   	push   %edx
+    3b4d:	68 c8 65 00 00       	push   $0x65c8
+    3b52:	6a 01                	push   $0x1
+    3b54:	e8 47 0d 00 00       	call   48a0 <printf>
+    exit();
+    3b59:	e8 85 0b 00 00       	call   46e3 <exit>
+    3b5e:	66 90                	xchg   %ax,%ax
+
+00003b60 <sbrktest>:
+{
+    3b60:	55                   	push   %ebp
+    3b61:	89 e5                	mov    %esp,%ebp
+    3b63:	57                   	push   %edi
+    3b64:	56                   	push   %esi
+  for(i = 0; i < 5000; i++){
+    3b65:	31 f6                	xor    %esi,%esi
+{
+    3b67:	53                   	push   %ebx
+    3b68:	83 ec 64             	sub    $0x64,%esp
+  printf(stdout, "sbrk test\n");
+    3b6b:	68 55 5c 00 00       	push   $0x5c55
+    3b70:	ff 35 e8 72 00 00    	push   0x72e8
+    3b76:	e8 25 0d 00 00       	call   48a0 <printf>
+  oldbrk = sbrk(0);
+    3b7b:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+    3b82:	e8 e4 0b 00 00       	call   476b <sbrk>
+    3b87:	89 45 a4             	mov    %eax,-0x5c(%ebp)
+  a = sbrk(0);
+    3b8a:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+    3b91:	e8 d5 0b 00 00       	call   476b <sbrk>
+    3b96:	83 c4 10             	add    $0x10,%esp
+    3b99:	89 c3                	mov    %eax,%ebx
+  for(i = 0; i < 5000; i++){
+    3b9b:	eb 05                	jmp    3ba2 <sbrktest+0x42>
+    3b9d:	8d 76 00             	lea    0x0(%esi),%esi
+    a = b + 1;
+    3ba0:	89 c3                	mov    %eax,%ebx
+    b = sbrk(1);
+    3ba2:	83 ec 0c             	sub    $0xc,%esp
+    3ba5:	6a 01                	push   $0x1
+    3ba7:	e8 bf 0b 00 00       	call   476b <sbrk>
+    if(b != a){
+    3bac:	83 c4 10             	add    $0x10,%esp
+    3baf:	39 d8                	cmp    %ebx,%eax
+    3bb1:	0f 85 9c 02 00 00    	jne    3e53 <sbrktest+0x2f3>
+  for(i = 0; i < 5000; i++){
+    3bb7:	83 c6 01             	add    $0x1,%esi
+    *b = 1;
+    3bba:	c6 03 01             	movb   $0x1,(%ebx)
+    a = b + 1;
+    3bbd:	8d 43 01             	lea    0x1(%ebx),%eax
+  for(i = 0; i < 5000; i++){
+    3bc0:	81 fe 88 13 00 00    	cmp    $0x1388,%esi
+    3bc6:	75 d8                	jne    3ba0 <sbrktest+0x40>
+  pid = fork();
+    3bc8:	e8 0e 0b 00 00       	call   46db <fork>
+    3bcd:	89 c6                	mov    %eax,%esi
+  if(pid < 0){
+    3bcf:	85 c0                	test   %eax,%eax
+    3bd1:	0f 88 02 03 00 00    	js     3ed9 <sbrktest+0x379>
+  c = sbrk(1);
+    3bd7:	83 ec 0c             	sub    $0xc,%esp
+  if(c != a + 1){
+    3bda:	83 c3 02             	add    $0x2,%ebx
+  c = sbrk(1);
+    3bdd:	6a 01                	push   $0x1
+    3bdf:	e8 87 0b 00 00       	call   476b <sbrk>
+  c = sbrk(1);
+    3be4:	c7 04 24 01 00 00 00 	movl   $0x1,(%esp)
+    3beb:	e8 7b 0b 00 00       	call   476b <sbrk>
+  if(c != a + 1){
+    3bf0:	83 c4 10             	add    $0x10,%esp
+    3bf3:	39 c3                	cmp    %eax,%ebx
+    3bf5:	0f 85 3b 03 00 00    	jne    3f36 <sbrktest+0x3d6>
+  if(pid == 0)
+    3bfb:	85 f6                	test   %esi,%esi
+    3bfd:	0f 84 2e 03 00 00    	je     3f31 <sbrktest+0x3d1>
+  wait();
+    3c03:	e8 e3 0a 00 00       	call   46eb <wait>
+  a = sbrk(0);
+    3c08:	83 ec 0c             	sub    $0xc,%esp
+    3c0b:	6a 00                	push   $0x0
+    3c0d:	e8 59 0b 00 00       	call   476b <sbrk>
+    3c12:	89 c3                	mov    %eax,%ebx
+  amt = (BIG) - (uint)a;
+    3c14:	b8 00 00 40 06       	mov    $0x6400000,%eax
+    3c19:	29 d8                	sub    %ebx,%eax
+  p = sbrk(amt);
+    3c1b:	89 04 24             	mov    %eax,(%esp)
+    3c1e:	e8 48 0b 00 00       	call   476b <sbrk>
+  if (p != a) {
+    3c23:	83 c4 10             	add    $0x10,%esp
+    3c26:	39 c3                	cmp    %eax,%ebx
+    3c28:	0f 85 94 02 00 00    	jne    3ec2 <sbrktest+0x362>
+  a = sbrk(0);
+    3c2e:	83 ec 0c             	sub    $0xc,%esp
+  *lastaddr = 99;
+    3c31:	c6 05 ff ff 3f 06 63 	movb   $0x63,0x63fffff
+  a = sbrk(0);
+    3c38:	6a 00                	push   $0x0
+    3c3a:	e8 2c 0b 00 00       	call   476b <sbrk>
+  c = sbrk(-4096);
+    3c3f:	c7 04 24 00 f0 ff ff 	movl   $0xfffff000,(%esp)
+  a = sbrk(0);
+    3c46:	89 c3                	mov    %eax,%ebx
+  c = sbrk(-4096);
+    3c48:	e8 1e 0b 00 00       	call   476b <sbrk>
+  if(c == (char*)0xffffffff){
+    3c4d:	83 c4 10             	add    $0x10,%esp
+    3c50:	83 f8 ff             	cmp    $0xffffffff,%eax
+    3c53:	0f 84 22 03 00 00    	je     3f7b <sbrktest+0x41b>
+  c = sbrk(0);
+    3c59:	83 ec 0c             	sub    $0xc,%esp
+    3c5c:	6a 00                	push   $0x0
+    3c5e:	e8 08 0b 00 00       	call   476b <sbrk>
+  if(c != a - 4096){
+    3c63:	8d 93 00 f0 ff ff    	lea    -0x1000(%ebx),%edx
+    3c69:	83 c4 10             	add    $0x10,%esp
+    3c6c:	39 d0                	cmp    %edx,%eax
+    3c6e:	0f 85 f0 02 00 00    	jne    3f64 <sbrktest+0x404>
+  a = sbrk(0);
+    3c74:	83 ec 0c             	sub    $0xc,%esp
+    3c77:	6a 00                	push   $0x0
+    3c79:	e8 ed 0a 00 00       	call   476b <sbrk>
+  c = sbrk(4096);
+    3c7e:	c7 04 24 00 10 00 00 	movl   $0x1000,(%esp)
+  a = sbrk(0);
+    3c85:	89 c3                	mov    %eax,%ebx
+  c = sbrk(4096);
+    3c87:	e8 df 0a 00 00       	call   476b <sbrk>
+  if(c != a || sbrk(0) != a + 4096){
+    3c8c:	83 c4 10             	add    $0x10,%esp
+  c = sbrk(4096);
+    3c8f:	89 c6                	mov    %eax,%esi
+  if(c != a || sbrk(0) != a + 4096){
+    3c91:	39 c3                	cmp    %eax,%ebx
+    3c93:	0f 85 b4 02 00 00    	jne    3f4d <sbrktest+0x3ed>
+    3c99:	83 ec 0c             	sub    $0xc,%esp
+    3c9c:	6a 00                	push   $0x0
+    3c9e:	e8 c8 0a 00 00       	call   476b <sbrk>
+    3ca3:	8d 93 00 10 00 00    	lea    0x1000(%ebx),%edx
+    3ca9:	83 c4 10             	add    $0x10,%esp
+    3cac:	39 c2                	cmp    %eax,%edx
+    3cae:	0f 85 99 02 00 00    	jne    3f4d <sbrktest+0x3ed>
+  if(*lastaddr == 99){
+    3cb4:	80 3d ff ff 3f 06 63 	cmpb   $0x63,0x63fffff
+    3cbb:	0f 84 2f 02 00 00    	je     3ef0 <sbrktest+0x390>
+  a = sbrk(0);
+    3cc1:	83 ec 0c             	sub    $0xc,%esp
+    3cc4:	6a 00                	push   $0x0
+    3cc6:	e8 a0 0a 00 00       	call   476b <sbrk>
+  c = sbrk(-(sbrk(0) - oldbrk));
+    3ccb:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+  a = sbrk(0);
+    3cd2:	89 c3                	mov    %eax,%ebx
+  c = sbrk(-(sbrk(0) - oldbrk));
+    3cd4:	e8 92 0a 00 00       	call   476b <sbrk>
+    3cd9:	89 c2                	mov    %eax,%edx
+    3cdb:	8b 45 a4             	mov    -0x5c(%ebp),%eax
+    3cde:	29 d0                	sub    %edx,%eax
+    3ce0:	89 04 24             	mov    %eax,(%esp)
+    3ce3:	e8 83 0a 00 00       	call   476b <sbrk>
+  if(c != a){
+    3ce8:	83 c4 10             	add    $0x10,%esp
+    3ceb:	39 c3                	cmp    %eax,%ebx
+    3ced:	0f 85 b8 01 00 00    	jne    3eab <sbrktest+0x34b>
+  for(a = (char*)(KERNBASE); a < (char*) (KERNBASE+2000000); a += 50000){
+    3cf3:	bb 00 00 00 80       	mov    $0x80000000,%ebx
+    3cf8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    3cff:	90                   	nop
+    ppid = getpid();
+    3d00:	e8 5e 0a 00 00       	call   4763 <getpid>
+    3d05:	89 c6                	mov    %eax,%esi
+    pid = fork();
+    3d07:	e8 cf 09 00 00       	call   46db <fork>
+    if(pid < 0){
+    3d0c:	85 c0                	test   %eax,%eax
+    3d0e:	0f 88 5d 01 00 00    	js     3e71 <sbrktest+0x311>
+    if(pid == 0){
+    3d14:	0f 84 6f 01 00 00    	je     3e89 <sbrktest+0x329>
+    wait();
+    3d1a:	e8 cc 09 00 00       	call   46eb <wait>
+  for(a = (char*)(KERNBASE); a < (char*) (KERNBASE+2000000); a += 50000){
+    3d1f:	81 c3 50 c3 00 00    	add    $0xc350,%ebx
+    3d25:	81 fb 80 84 1e 80    	cmp    $0x801e8480,%ebx
+    3d2b:	75 d3                	jne    3d00 <sbrktest+0x1a0>
+  if(pipe(fds) != 0){
+    3d2d:	83 ec 0c             	sub    $0xc,%esp
+    3d30:	8d 45 b8             	lea    -0x48(%ebp),%eax
+    3d33:	50                   	push   %eax
+    3d34:	e8 ba 09 00 00       	call   46f3 <pipe>
+    3d39:	83 c4 10             	add    $0x10,%esp
+    3d3c:	85 c0                	test   %eax,%eax
+    3d3e:	0f 85 da 01 00 00    	jne    3f1e <sbrktest+0x3be>
+    3d44:	8d 5d c0             	lea    -0x40(%ebp),%ebx
+    3d47:	8d 75 e8             	lea    -0x18(%ebp),%esi
+    3d4a:	89 df                	mov    %ebx,%edi
+    3d4c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    if((pids[i] = fork()) == 0){
+    3d50:	e8 86 09 00 00       	call   46db <fork>
+    3d55:	89 07                	mov    %eax,(%edi)
+    3d57:	85 c0                	test   %eax,%eax
+    3d59:	0f 84 91 00 00 00    	je     3df0 <sbrktest+0x290>
+    if(pids[i] != -1)
+    3d5f:	83 f8 ff             	cmp    $0xffffffff,%eax
+    3d62:	74 14                	je     3d78 <sbrktest+0x218>
+      read(fds[0], &scratch, 1);
+    3d64:	83 ec 04             	sub    $0x4,%esp
+    3d67:	8d 45 b7             	lea    -0x49(%ebp),%eax
+    3d6a:	6a 01                	push   $0x1
+    3d6c:	50                   	push   %eax
+    3d6d:	ff 75 b8             	push   -0x48(%ebp)
+    3d70:	e8 86 09 00 00       	call   46fb <read>
+    3d75:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; i < sizeof(pids)/sizeof(pids[0]); i++){
+    3d78:	83 c7 04             	add    $0x4,%edi
+    3d7b:	39 f7                	cmp    %esi,%edi
+    3d7d:	75 d1                	jne    3d50 <sbrktest+0x1f0>
+  c = sbrk(4096);
+    3d7f:	83 ec 0c             	sub    $0xc,%esp
+    3d82:	68 00 10 00 00       	push   $0x1000
+    3d87:	e8 df 09 00 00       	call   476b <sbrk>
+    3d8c:	83 c4 10             	add    $0x10,%esp
+    3d8f:	89 c7                	mov    %eax,%edi
+  for(i = 0; i < sizeof(pids)/sizeof(pids[0]); i++){
+    3d91:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    if(pids[i] == -1)
+    3d98:	8b 03                	mov    (%ebx),%eax
+    3d9a:	83 f8 ff             	cmp    $0xffffffff,%eax
+    3d9d:	74 11                	je     3db0 <sbrktest+0x250>
+    kill(pids[i]);
+    3d9f:	83 ec 0c             	sub    $0xc,%esp
+    3da2:	50                   	push   %eax
+    3da3:	e8 6b 09 00 00       	call   4713 <kill>
+    wait();
+    3da8:	e8 3e 09 00 00       	call   46eb <wait>
+    3dad:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; i < sizeof(pids)/sizeof(pids[0]); i++){
+    3db0:	83 c3 04             	add    $0x4,%ebx
+    3db3:	39 f3                	cmp    %esi,%ebx
+    3db5:	75 e1                	jne    3d98 <sbrktest+0x238>
+  if(c == (char*)0xffffffff){
+    3db7:	83 ff ff             	cmp    $0xffffffff,%edi
+    3dba:	0f 84 47 01 00 00    	je     3f07 <sbrktest+0x3a7>
+  if(sbrk(0) > oldbrk)
+    3dc0:	83 ec 0c             	sub    $0xc,%esp
+    3dc3:	6a 00                	push   $0x0
+    3dc5:	e8 a1 09 00 00       	call   476b <sbrk>
+    3dca:	83 c4 10             	add    $0x10,%esp
+    3dcd:	39 45 a4             	cmp    %eax,-0x5c(%ebp)
+    3dd0:	72 60                	jb     3e32 <sbrktest+0x2d2>
+  printf(stdout, "sbrk test OK\n");
+    3dd2:	83 ec 08             	sub    $0x8,%esp
+    3dd5:	68 fd 5c 00 00       	push   $0x5cfd
+    3dda:	ff 35 e8 72 00 00    	push   0x72e8
+    3de0:	e8 bb 0a 00 00       	call   48a0 <printf>
+}
+    3de5:	83 c4 10             	add    $0x10,%esp
+    3de8:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    3deb:	5b                   	pop    %ebx
+    3dec:	5e                   	pop    %esi
+    3ded:	5f                   	pop    %edi
+    3dee:	5d                   	pop    %ebp
+    3def:	c3                   	ret
+      sbrk(BIG - (uint)sbrk(0));
+    3df0:	83 ec 0c             	sub    $0xc,%esp
+    3df3:	6a 00                	push   $0x0
+    3df5:	e8 71 09 00 00       	call   476b <sbrk>
+    3dfa:	89 c2                	mov    %eax,%edx
+    3dfc:	b8 00 00 40 06       	mov    $0x6400000,%eax
+    3e01:	29 d0                	sub    %edx,%eax
+    3e03:	89 04 24             	mov    %eax,(%esp)
+    3e06:	e8 60 09 00 00       	call   476b <sbrk>
+      write(fds[1], "x", 1);
+    3e0b:	83 c4 0c             	add    $0xc,%esp
+    3e0e:	6a 01                	push   $0x1
+    3e10:	68 be 57 00 00       	push   $0x57be
+    3e15:	ff 75 bc             	push   -0x44(%ebp)
+    3e18:	e8 e6 08 00 00       	call   4703 <write>
+    3e1d:	83 c4 10             	add    $0x10,%esp
+      for(;;) sleep(1000);
+    3e20:	83 ec 0c             	sub    $0xc,%esp
+    3e23:	68 e8 03 00 00       	push   $0x3e8
+    3e28:	e8 46 09 00 00       	call   4773 <sleep>
+    3e2d:	83 c4 10             	add    $0x10,%esp
+    3e30:	eb ee                	jmp    3e20 <sbrktest+0x2c0>
+    sbrk(-(sbrk(0) - oldbrk));
+    3e32:	83 ec 0c             	sub    $0xc,%esp
+    3e35:	6a 00                	push   $0x0
+    3e37:	e8 2f 09 00 00       	call   476b <sbrk>
+    3e3c:	89 c2                	mov    %eax,%edx
+    3e3e:	8b 45 a4             	mov    -0x5c(%ebp),%eax
+    3e41:	29 d0                	sub    %edx,%eax
+    3e43:	89 04 24             	mov    %eax,(%esp)
+    3e46:	e8 20 09 00 00       	call   476b <sbrk>
+    3e4b:	83 c4 10             	add    $0x10,%esp
+    3e4e:	e9 7f ff ff ff       	jmp    3dd2 <sbrktest+0x272>
+      printf(stdout, "sbrk test failed %d %x %x\n", i, a, b);
+    3e53:	83 ec 0c             	sub    $0xc,%esp
+    3e56:	50                   	push   %eax
+    3e57:	53                   	push   %ebx
+    3e58:	56                   	push   %esi
+    3e59:	68 60 5c 00 00       	push   $0x5c60
+    3e5e:	ff 35 e8 72 00 00    	push   0x72e8
+    3e64:	e8 37 0a 00 00       	call   48a0 <printf>
+      exit();
+    3e69:	83 c4 20             	add    $0x20,%esp
+    3e6c:	e8 72 08 00 00       	call   46e3 <exit>
+      printf(stdout, "fork failed\n");
+    3e71:	83 ec 08             	sub    $0x8,%esp
+    3e74:	68 a6 5d 00 00       	push   $0x5da6
+    3e79:	ff 35 e8 72 00 00    	push   0x72e8
+    3e7f:	e8 1c 0a 00 00       	call   48a0 <printf>
+      exit();
+    3e84:	e8 5a 08 00 00       	call   46e3 <exit>
+      printf(stdout, "oops could read %x = %x\n", a, *a);
+    3e89:	0f be 03             	movsbl (%ebx),%eax
+    3e8c:	50                   	push   %eax
+    3e8d:	53                   	push   %ebx
+    3e8e:	68 c9 5c 00 00       	push   $0x5cc9
+    3e93:	ff 35 e8 72 00 00    	push   0x72e8
+    3e99:	e8 02 0a 00 00       	call   48a0 <printf>
+      kill(ppid);
+    3e9e:	89 34 24             	mov    %esi,(%esp)
+    3ea1:	e8 6d 08 00 00       	call   4713 <kill>
+      exit();
+    3ea6:	e8 38 08 00 00       	call   46e3 <exit>
+    printf(stdout, "sbrk downsize failed, a %x c %x\n", a, c);
+    3eab:	50                   	push   %eax
+    3eac:	53                   	push   %ebx
+    3ead:	68 bc 66 00 00       	push   $0x66bc
+    3eb2:	ff 35 e8 72 00 00    	push   0x72e8
+    3eb8:	e8 e3 09 00 00       	call   48a0 <printf>
+    exit();
+    3ebd:	e8 21 08 00 00       	call   46e3 <exit>
+    printf(stdout, "sbrk test failed to grow big address space; enough phys mem?\n");
+    3ec2:	56                   	push   %esi
+    3ec3:	56                   	push   %esi
+    3ec4:	68 ec 65 00 00       	push   $0x65ec
+    3ec9:	ff 35 e8 72 00 00    	push   0x72e8
+    3ecf:	e8 cc 09 00 00       	call   48a0 <printf>
+    exit();
+    3ed4:	e8 0a 08 00 00       	call   46e3 <exit>
+    printf(stdout, "sbrk test fork failed\n");
+    3ed9:	50                   	push   %eax
+    3eda:	50                   	push   %eax
+    3edb:	68 7b 5c 00 00       	push   $0x5c7b
+    3ee0:	ff 35 e8 72 00 00    	push   0x72e8
+    3ee6:	e8 b5 09 00 00       	call   48a0 <printf>
+    exit();
+    3eeb:	e8 f3 07 00 00       	call   46e3 <exit>
+    printf(stdout, "sbrk de-allocation didn't really deallocate\n");
+    3ef0:	51                   	push   %ecx
+    3ef1:	51                   	push   %ecx
+    3ef2:	68 8c 66 00 00       	push   $0x668c
+    3ef7:	ff 35 e8 72 00 00    	push   0x72e8
+    3efd:	e8 9e 09 00 00       	call   48a0 <printf>
+    exit();
+    3f02:	e8 dc 07 00 00       	call   46e3 <exit>
+    printf(stdout, "failed sbrk leaked memory\n");
+    3f07:	50                   	push   %eax
+    3f08:	50                   	push   %eax
+    3f09:	68 e2 5c 00 00       	push   $0x5ce2
+    3f0e:	ff 35 e8 72 00 00    	push   0x72e8
+    3f14:	e8 87 09 00 00       	call   48a0 <printf>
+    exit();
+    3f19:	e8 c5 07 00 00       	call   46e3 <exit>
+    printf(1, "pipe() failed\n");
+    3f1e:	52                   	push   %edx
+    3f1f:	52                   	push   %edx
+    3f20:	68 01 4f 00 00       	push   $0x4f01
+    3f25:	6a 01                	push   $0x1
+    3f27:	e8 74 09 00 00       	call   48a0 <printf>
+    exit();
+    3f2c:	e8 b2 07 00 00       	call   46e3 <exit>
+    exit();
+    3f31:	e8 ad 07 00 00       	call   46e3 <exit>
+    printf(stdout, "sbrk test failed post-fork\n");
+    3f36:	57                   	push   %edi
+    3f37:	57                   	push   %edi
+    3f38:	68 92 5c 00 00       	push   $0x5c92
+    3f3d:	ff 35 e8 72 00 00    	push   0x72e8
+    3f43:	e8 58 09 00 00       	call   48a0 <printf>
+    exit();
+    3f48:	e8 96 07 00 00       	call   46e3 <exit>
+    printf(stdout, "sbrk re-allocation failed, a %x c %x\n", a, c);
+    3f4d:	56                   	push   %esi
+    3f4e:	53                   	push   %ebx
+    3f4f:	68 64 66 00 00       	push   $0x6664
+    3f54:	ff 35 e8 72 00 00    	push   0x72e8
+    3f5a:	e8 41 09 00 00       	call   48a0 <printf>
+    exit();
+    3f5f:	e8 7f 07 00 00       	call   46e3 <exit>
+    printf(stdout, "sbrk deallocation produced wrong address, a %x c %x\n", a, c);
+    3f64:	50                   	push   %eax
+    3f65:	53                   	push   %ebx
+    3f66:	68 2c 66 00 00       	push   $0x662c
+    3f6b:	ff 35 e8 72 00 00    	push   0x72e8
+    3f71:	e8 2a 09 00 00       	call   48a0 <printf>
+    exit();
+    3f76:	e8 68 07 00 00       	call   46e3 <exit>
+    printf(stdout, "sbrk could not deallocate\n");
+    3f7b:	53                   	push   %ebx
+    3f7c:	53                   	push   %ebx
+    3f7d:	68 ae 5c 00 00       	push   $0x5cae
+    3f82:	ff 35 e8 72 00 00    	push   0x72e8
+    3f88:	e8 13 09 00 00       	call   48a0 <printf>
+    exit();
+    3f8d:	e8 51 07 00 00       	call   46e3 <exit>
+    3f92:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    3f99:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00003fa0 <validateint>:
+}
+    3fa0:	c3                   	ret
+    3fa1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    3fa8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    3faf:	90                   	nop
+
+00003fb0 <validatetest>:
+{
+    3fb0:	55                   	push   %ebp
+    3fb1:	89 e5                	mov    %esp,%ebp
+    3fb3:	56                   	push   %esi
+  for(p = 0; p <= (uint)hi; p += 4096){
+    3fb4:	31 f6                	xor    %esi,%esi
+{
+    3fb6:	53                   	push   %ebx
+  printf(stdout, "validate test\n");
+    3fb7:	83 ec 08             	sub    $0x8,%esp
+    3fba:	68 0b 5d 00 00       	push   $0x5d0b
+    3fbf:	ff 35 e8 72 00 00    	push   0x72e8
+    3fc5:	e8 d6 08 00 00       	call   48a0 <printf>
+    3fca:	83 c4 10             	add    $0x10,%esp
+    3fcd:	8d 76 00             	lea    0x0(%esi),%esi
+    if((pid = fork()) == 0){
+    3fd0:	e8 06 07 00 00       	call   46db <fork>
+    3fd5:	89 c3                	mov    %eax,%ebx
+    3fd7:	85 c0                	test   %eax,%eax
+    3fd9:	74 63                	je     403e <validatetest+0x8e>
+    sleep(0);
+    3fdb:	83 ec 0c             	sub    $0xc,%esp
+    3fde:	6a 00                	push   $0x0
+    3fe0:	e8 8e 07 00 00       	call   4773 <sleep>
+    sleep(0);
+    3fe5:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+    3fec:	e8 82 07 00 00       	call   4773 <sleep>
+    kill(pid);
+    3ff1:	89 1c 24             	mov    %ebx,(%esp)
+    3ff4:	e8 1a 07 00 00       	call   4713 <kill>
+    wait();
+    3ff9:	e8 ed 06 00 00       	call   46eb <wait>
+    if(link("nosuchfile", (char*)p) != -1){
+    3ffe:	58                   	pop    %eax
+    3fff:	5a                   	pop    %edx
+    4000:	56                   	push   %esi
+    4001:	68 1a 5d 00 00       	push   $0x5d1a
+    4006:	e8 38 07 00 00       	call   4743 <link>
+    400b:	83 c4 10             	add    $0x10,%esp
+    400e:	83 f8 ff             	cmp    $0xffffffff,%eax
+    4011:	75 30                	jne    4043 <validatetest+0x93>
+  for(p = 0; p <= (uint)hi; p += 4096){
+    4013:	81 c6 00 10 00 00    	add    $0x1000,%esi
+    4019:	81 fe 00 40 11 00    	cmp    $0x114000,%esi
+    401f:	75 af                	jne    3fd0 <validatetest+0x20>
+  printf(stdout, "validate ok\n");
+    4021:	83 ec 08             	sub    $0x8,%esp
+    4024:	68 3e 5d 00 00       	push   $0x5d3e
+    4029:	ff 35 e8 72 00 00    	push   0x72e8
+    402f:	e8 6c 08 00 00       	call   48a0 <printf>
+}
+    4034:	83 c4 10             	add    $0x10,%esp
+    4037:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    403a:	5b                   	pop    %ebx
+    403b:	5e                   	pop    %esi
+    403c:	5d                   	pop    %ebp
+    403d:	c3                   	ret
+      exit();
+    403e:	e8 a0 06 00 00       	call   46e3 <exit>
+      printf(stdout, "link should not succeed\n");
+    4043:	83 ec 08             	sub    $0x8,%esp
+    4046:	68 25 5d 00 00       	push   $0x5d25
+    404b:	ff 35 e8 72 00 00    	push   0x72e8
+    4051:	e8 4a 08 00 00       	call   48a0 <printf>
+      exit();
+    4056:	e8 88 06 00 00       	call   46e3 <exit>
+    405b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    405f:	90                   	nop
+
+00004060 <bsstest>:
+{
+    4060:	55                   	push   %ebp
+    4061:	89 e5                	mov    %esp,%ebp
+    4063:	83 ec 10             	sub    $0x10,%esp
+  printf(stdout, "bss test\n");
+    4066:	68 4b 5d 00 00       	push   $0x5d4b
+    406b:	ff 35 e8 72 00 00    	push   0x72e8
+    4071:	e8 2a 08 00 00       	call   48a0 <printf>
+    4076:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; i < sizeof(uninit); i++){
+    4079:	31 c0                	xor    %eax,%eax
+    407b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    407f:	90                   	nop
+    if(uninit[i] != '\0'){
+    4080:	80 b8 00 73 00 00 00 	cmpb   $0x0,0x7300(%eax)
+    4087:	75 22                	jne    40ab <bsstest+0x4b>
+  for(i = 0; i < sizeof(uninit); i++){
+    4089:	83 c0 01             	add    $0x1,%eax
+    408c:	3d 10 27 00 00       	cmp    $0x2710,%eax
+    4091:	75 ed                	jne    4080 <bsstest+0x20>
+  printf(stdout, "bss test ok\n");
+    4093:	83 ec 08             	sub    $0x8,%esp
+    4096:	68 66 5d 00 00       	push   $0x5d66
+    409b:	ff 35 e8 72 00 00    	push   0x72e8
+    40a1:	e8 fa 07 00 00       	call   48a0 <printf>
+}
+    40a6:	83 c4 10             	add    $0x10,%esp
+    40a9:	c9                   	leave
+    40aa:	c3                   	ret
+      printf(stdout, "bss test failed\n");
+    40ab:	83 ec 08             	sub    $0x8,%esp
+    40ae:	68 55 5d 00 00       	push   $0x5d55
+    40b3:	ff 35 e8 72 00 00    	push   0x72e8
+    40b9:	e8 e2 07 00 00       	call   48a0 <printf>
+      exit();
+    40be:	e8 20 06 00 00       	call   46e3 <exit>
+    40c3:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    40ca:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+000040d0 <bigargtest>:
+{
+    40d0:	55                   	push   %ebp
+    40d1:	89 e5                	mov    %esp,%ebp
+    40d3:	83 ec 14             	sub    $0x14,%esp
+  unlink("bigarg-ok");
+    40d6:	68 73 5d 00 00       	push   $0x5d73
+    40db:	e8 53 06 00 00       	call   4733 <unlink>
+  pid = fork();
+    40e0:	e8 f6 05 00 00       	call   46db <fork>
+  if(pid == 0){
+    40e5:	83 c4 10             	add    $0x10,%esp
+    40e8:	85 c0                	test   %eax,%eax
+    40ea:	74 44                	je     4130 <bigargtest+0x60>
+  } else if(pid < 0){
+    40ec:	0f 88 c3 00 00 00    	js     41b5 <bigargtest+0xe5>
+  wait();
+    40f2:	e8 f4 05 00 00       	call   46eb <wait>
+  fd = open("bigarg-ok", 0);
+    40f7:	83 ec 08             	sub    $0x8,%esp
+    40fa:	6a 00                	push   $0x0
+    40fc:	68 73 5d 00 00       	push   $0x5d73
+    4101:	e8 1d 06 00 00       	call   4723 <open>
+  if(fd < 0){
+    4106:	83 c4 10             	add    $0x10,%esp
+    4109:	85 c0                	test   %eax,%eax
+    410b:	0f 88 8d 00 00 00    	js     419e <bigargtest+0xce>
+  close(fd);
+    4111:	83 ec 0c             	sub    $0xc,%esp
+    4114:	50                   	push   %eax
+    4115:	e8 f1 05 00 00       	call   470b <close>
+  unlink("bigarg-ok");
+    411a:	c7 04 24 73 5d 00 00 	movl   $0x5d73,(%esp)
+    4121:	e8 0d 06 00 00       	call   4733 <unlink>
+}
+    4126:	83 c4 10             	add    $0x10,%esp
+    4129:	c9                   	leave
+    412a:	c3                   	ret
+    412b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    412f:	90                   	nop
+      args[i] = "bigargs test: failed\n                                                                                                                                                                                                       ";
+    4130:	c7 04 85 20 ba 00 00 	movl   $0x66e0,0xba20(,%eax,4)
+    4137:	e0 66 00 00 
+    for(i = 0; i < MAXARG-1; i++)
+    413b:	83 c0 01             	add    $0x1,%eax
+    413e:	83 f8 1f             	cmp    $0x1f,%eax
+    4141:	75 ed                	jne    4130 <bigargtest+0x60>
+    args[MAXARG-1] = 0;
+    4143:	31 c9                	xor    %ecx,%ecx
+    4145:	89 0d 9c ba 00 00    	mov    %ecx,0xba9c
+    printf(stdout, "bigarg test\n");
+    414b:	50                   	push   %eax
+    414c:	50                   	push   %eax
+    414d:	68 7d 5d 00 00       	push   $0x5d7d
+    4152:	ff 35 e8 72 00 00    	push   0x72e8
+    4158:	e8 43 07 00 00       	call   48a0 <printf>
+    exec("echo", args);
+    415d:	58                   	pop    %eax
+    415e:	5a                   	pop    %edx
+    415f:	68 20 ba 00 00       	push   $0xba20
+    4164:	68 ad 4c 00 00       	push   $0x4cad
+    4169:	e8 ad 05 00 00       	call   471b <exec>
+    printf(stdout, "bigarg test ok\n");
+    416e:	59                   	pop    %ecx
+    416f:	58                   	pop    %eax
+    4170:	68 8a 5d 00 00       	push   $0x5d8a
+    4175:	ff 35 e8 72 00 00    	push   0x72e8
+    417b:	e8 20 07 00 00       	call   48a0 <printf>
+    fd = open("bigarg-ok", O_CREATE);
+    4180:	58                   	pop    %eax
+    4181:	5a                   	pop    %edx
+    4182:	68 00 02 00 00       	push   $0x200
+    4187:	68 73 5d 00 00       	push   $0x5d73
+    418c:	e8 92 05 00 00       	call   4723 <open>
+    close(fd);
+    4191:	89 04 24             	mov    %eax,(%esp)
+    4194:	e8 72 05 00 00       	call   470b <close>
+    exit();
+    4199:	e8 45 05 00 00       	call   46e3 <exit>
+    printf(stdout, "bigarg test failed!\n");
+    419e:	50                   	push   %eax
+    419f:	50                   	push   %eax
+    41a0:	68 b3 5d 00 00       	push   $0x5db3
+    41a5:	ff 35 e8 72 00 00    	push   0x72e8
+    41ab:	e8 f0 06 00 00       	call   48a0 <printf>
+    exit();
+    41b0:	e8 2e 05 00 00       	call   46e3 <exit>
+    printf(stdout, "bigargtest: fork failed\n");
+    41b5:	52                   	push   %edx
+    41b6:	52                   	push   %edx
+    41b7:	68 9a 5d 00 00       	push   $0x5d9a
+    41bc:	ff 35 e8 72 00 00    	push   0x72e8
+    41c2:	e8 d9 06 00 00       	call   48a0 <printf>
+    exit();
+    41c7:	e8 17 05 00 00       	call   46e3 <exit>
+    41cc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000041d0 <fsfull>:
+{
+    41d0:	55                   	push   %ebp
+    41d1:	89 e5                	mov    %esp,%ebp
+    41d3:	57                   	push   %edi
+    41d4:	56                   	push   %esi
+  for(nfiles = 0; ; nfiles++){
+    41d5:	31 f6                	xor    %esi,%esi
+{
+    41d7:	53                   	push   %ebx
+    41d8:	83 ec 54             	sub    $0x54,%esp
+  printf(1, "fsfull test\n");
+    41db:	68 c8 5d 00 00       	push   $0x5dc8
+    41e0:	6a 01                	push   $0x1
+    41e2:	e8 b9 06 00 00       	call   48a0 <printf>
+    41e7:	83 c4 10             	add    $0x10,%esp
+    41ea:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    name[1] = '0' + nfiles / 1000;
+    41f0:	b8 d3 4d 62 10       	mov    $0x10624dd3,%eax
+    name[3] = '0' + (nfiles % 100) / 10;
+    41f5:	b9 cd cc cc cc       	mov    $0xcccccccd,%ecx
+    printf(1, "writing %s\n", name);
+    41fa:	83 ec 04             	sub    $0x4,%esp
+    name[0] = 'f';
+    41fd:	c6 45 a8 66          	movb   $0x66,-0x58(%ebp)
+    name[1] = '0' + nfiles / 1000;
+    4201:	f7 e6                	mul    %esi
+    name[5] = '\0';
+    4203:	c6 45 ad 00          	movb   $0x0,-0x53(%ebp)
+    name[1] = '0' + nfiles / 1000;
+    4207:	c1 ea 06             	shr    $0x6,%edx
+    420a:	8d 42 30             	lea    0x30(%edx),%eax
+    420d:	88 45 a9             	mov    %al,-0x57(%ebp)
+    name[2] = '0' + (nfiles % 1000) / 100;
+    4210:	69 c2 e8 03 00 00    	imul   $0x3e8,%edx,%eax
+    4216:	89 f2                	mov    %esi,%edx
+    4218:	29 c2                	sub    %eax,%edx
+    421a:	b8 1f 85 eb 51       	mov    $0x51eb851f,%eax
+    421f:	f7 e2                	mul    %edx
+    name[3] = '0' + (nfiles % 100) / 10;
+    4221:	b8 1f 85 eb 51       	mov    $0x51eb851f,%eax
+    name[2] = '0' + (nfiles % 1000) / 100;
+    4226:	c1 ea 05             	shr    $0x5,%edx
+    4229:	83 c2 30             	add    $0x30,%edx
+    422c:	88 55 aa             	mov    %dl,-0x56(%ebp)
+    name[3] = '0' + (nfiles % 100) / 10;
+    422f:	f7 e6                	mul    %esi
+    4231:	c1 ea 05             	shr    $0x5,%edx
+    4234:	6b c2 64             	imul   $0x64,%edx,%eax
+    4237:	89 f2                	mov    %esi,%edx
+    4239:	29 c2                	sub    %eax,%edx
+    423b:	89 d0                	mov    %edx,%eax
+    423d:	f7 e1                	mul    %ecx
+    name[4] = '0' + (nfiles % 10);
+    423f:	89 f0                	mov    %esi,%eax
+    name[3] = '0' + (nfiles % 100) / 10;
+    4241:	c1 ea 03             	shr    $0x3,%edx
+    4244:	83 c2 30             	add    $0x30,%edx
+    4247:	88 55 ab             	mov    %dl,-0x55(%ebp)
+    name[4] = '0' + (nfiles % 10);
+    424a:	f7 e1                	mul    %ecx
+    424c:	89 f0                	mov    %esi,%eax
+    424e:	c1 ea 03             	shr    $0x3,%edx
+    4251:	8d 14 92             	lea    (%edx,%edx,4),%edx
+    4254:	01 d2                	add    %edx,%edx
+    4256:	29 d0                	sub    %edx,%eax
+    4258:	83 c0 30             	add    $0x30,%eax
+    425b:	88 45 ac             	mov    %al,-0x54(%ebp)
+    printf(1, "writing %s\n", name);
+    425e:	8d 45 a8             	lea    -0x58(%ebp),%eax
+    4261:	50                   	push   %eax
+    4262:	68 d5 5d 00 00       	push   $0x5dd5
+    4267:	6a 01                	push   $0x1
+    4269:	e8 32 06 00 00       	call   48a0 <printf>
+    int fd = open(name, O_CREATE|O_RDWR);
+    426e:	58                   	pop    %eax
+    426f:	8d 45 a8             	lea    -0x58(%ebp),%eax
+    4272:	5a                   	pop    %edx
+    4273:	68 02 02 00 00       	push   $0x202
+    4278:	50                   	push   %eax
+    4279:	e8 a5 04 00 00       	call   4723 <open>
+    if(fd < 0){
+    427e:	83 c4 10             	add    $0x10,%esp
+    int fd = open(name, O_CREATE|O_RDWR);
+    4281:	89 c7                	mov    %eax,%edi
+    if(fd < 0){
+    4283:	85 c0                	test   %eax,%eax
+    4285:	78 4f                	js     42d6 <fsfull+0x106>
+    int total = 0;
+    4287:	31 db                	xor    %ebx,%ebx
+    4289:	eb 07                	jmp    4292 <fsfull+0xc2>
+    428b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    428f:	90                   	nop
+      total += cc;
+    4290:	01 c3                	add    %eax,%ebx
+      int cc = write(fd, buf, 512);
+    4292:	83 ec 04             	sub    $0x4,%esp
+    4295:	68 00 02 00 00       	push   $0x200
+    429a:	68 20 9a 00 00       	push   $0x9a20
+    429f:	57                   	push   %edi
+    42a0:	e8 5e 04 00 00       	call   4703 <write>
+      if(cc < 512)
+    42a5:	83 c4 10             	add    $0x10,%esp
+    42a8:	3d ff 01 00 00       	cmp    $0x1ff,%eax
+    42ad:	7f e1                	jg     4290 <fsfull+0xc0>
+    printf(1, "wrote %d bytes\n", total);
+    42af:	83 ec 04             	sub    $0x4,%esp
+    42b2:	53                   	push   %ebx
+    42b3:	68 f1 5d 00 00       	push   $0x5df1
+    42b8:	6a 01                	push   $0x1
+    42ba:	e8 e1 05 00 00       	call   48a0 <printf>
+    close(fd);
+    42bf:	89 3c 24             	mov    %edi,(%esp)
+    42c2:	e8 44 04 00 00       	call   470b <close>
+    if(total == 0)
+    42c7:	83 c4 10             	add    $0x10,%esp
+    42ca:	85 db                	test   %ebx,%ebx
+    42cc:	74 1e                	je     42ec <fsfull+0x11c>
+  for(nfiles = 0; ; nfiles++){
+    42ce:	83 c6 01             	add    $0x1,%esi
+    42d1:	e9 1a ff ff ff       	jmp    41f0 <fsfull+0x20>
+      printf(1, "open %s failed\n", name);
+    42d6:	83 ec 04             	sub    $0x4,%esp
+    42d9:	8d 45 a8             	lea    -0x58(%ebp),%eax
+    42dc:	50                   	push   %eax
+    42dd:	68 e1 5d 00 00       	push   $0x5de1
+    42e2:	6a 01                	push   $0x1
+    42e4:	e8 b7 05 00 00       	call   48a0 <printf>
+      break;
+    42e9:	83 c4 10             	add    $0x10,%esp
+    name[1] = '0' + nfiles / 1000;
+    42ec:	bf d3 4d 62 10       	mov    $0x10624dd3,%edi
+    name[2] = '0' + (nfiles % 1000) / 100;
+    42f1:	bb 1f 85 eb 51       	mov    $0x51eb851f,%ebx
+    42f6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    42fd:	8d 76 00             	lea    0x0(%esi),%esi
+    name[1] = '0' + nfiles / 1000;
+    4300:	89 f0                	mov    %esi,%eax
+    unlink(name);
+    4302:	83 ec 0c             	sub    $0xc,%esp
+    name[0] = 'f';
+    4305:	c6 45 a8 66          	movb   $0x66,-0x58(%ebp)
+    name[1] = '0' + nfiles / 1000;
+    4309:	f7 e7                	mul    %edi
+    name[5] = '\0';
+    430b:	c6 45 ad 00          	movb   $0x0,-0x53(%ebp)
+    name[1] = '0' + nfiles / 1000;
+    430f:	c1 ea 06             	shr    $0x6,%edx
+    4312:	8d 42 30             	lea    0x30(%edx),%eax
+    4315:	88 45 a9             	mov    %al,-0x57(%ebp)
+    name[2] = '0' + (nfiles % 1000) / 100;
+    4318:	69 c2 e8 03 00 00    	imul   $0x3e8,%edx,%eax
+    431e:	89 f2                	mov    %esi,%edx
+    4320:	29 c2                	sub    %eax,%edx
+    4322:	89 d0                	mov    %edx,%eax
+    4324:	f7 e3                	mul    %ebx
+    name[3] = '0' + (nfiles % 100) / 10;
+    4326:	89 f0                	mov    %esi,%eax
+    name[2] = '0' + (nfiles % 1000) / 100;
+    4328:	c1 ea 05             	shr    $0x5,%edx
+    432b:	83 c2 30             	add    $0x30,%edx
+    432e:	88 55 aa             	mov    %dl,-0x56(%ebp)
+    name[3] = '0' + (nfiles % 100) / 10;
+    4331:	f7 e3                	mul    %ebx
+    4333:	c1 ea 05             	shr    $0x5,%edx
+    4336:	6b ca 64             	imul   $0x64,%edx,%ecx
+    4339:	89 f2                	mov    %esi,%edx
+    433b:	29 ca                	sub    %ecx,%edx
+    433d:	b9 cd cc cc cc       	mov    $0xcccccccd,%ecx
+    4342:	89 d0                	mov    %edx,%eax
+    4344:	f7 e1                	mul    %ecx
+    name[4] = '0' + (nfiles % 10);
+    4346:	89 f0                	mov    %esi,%eax
+    name[3] = '0' + (nfiles % 100) / 10;
+    4348:	c1 ea 03             	shr    $0x3,%edx
+    434b:	83 c2 30             	add    $0x30,%edx
+    434e:	88 55 ab             	mov    %dl,-0x55(%ebp)
+    name[4] = '0' + (nfiles % 10);
+    4351:	f7 e1                	mul    %ecx
+    4353:	89 f0                	mov    %esi,%eax
+    nfiles--;
+    4355:	83 ee 01             	sub    $0x1,%esi
+    name[4] = '0' + (nfiles % 10);
+    4358:	c1 ea 03             	shr    $0x3,%edx
+    435b:	8d 14 92             	lea    (%edx,%edx,4),%edx
+    435e:	01 d2                	add    %edx,%edx
+    4360:	29 d0                	sub    %edx,%eax
+    4362:	83 c0 30             	add    $0x30,%eax
+    4365:	88 45 ac             	mov    %al,-0x54(%ebp)
+    unlink(name);
+    4368:	8d 45 a8             	lea    -0x58(%ebp),%eax
+    436b:	50                   	push   %eax
+    436c:	e8 c2 03 00 00       	call   4733 <unlink>
+  while(nfiles >= 0){
+    4371:	83 c4 10             	add    $0x10,%esp
+    4374:	83 fe ff             	cmp    $0xffffffff,%esi
+    4377:	75 87                	jne    4300 <fsfull+0x130>
+  printf(1, "fsfull test finished\n");
+    4379:	83 ec 08             	sub    $0x8,%esp
+    437c:	68 01 5e 00 00       	push   $0x5e01
+    4381:	6a 01                	push   $0x1
+    4383:	e8 18 05 00 00       	call   48a0 <printf>
+}
+    4388:	83 c4 10             	add    $0x10,%esp
+    438b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    438e:	5b                   	pop    %ebx
+    438f:	5e                   	pop    %esi
+    4390:	5f                   	pop    %edi
+    4391:	5d                   	pop    %ebp
+    4392:	c3                   	ret
+    4393:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    439a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+000043a0 <uio>:
+{
+    43a0:	55                   	push   %ebp
+    43a1:	89 e5                	mov    %esp,%ebp
+    43a3:	83 ec 10             	sub    $0x10,%esp
+  printf(1, "uio test\n");
+    43a6:	68 17 5e 00 00       	push   $0x5e17
+    43ab:	6a 01                	push   $0x1
+    43ad:	e8 ee 04 00 00       	call   48a0 <printf>
+  pid = fork();
+    43b2:	e8 24 03 00 00       	call   46db <fork>
+  if(pid == 0){
+    43b7:	83 c4 10             	add    $0x10,%esp
+    43ba:	85 c0                	test   %eax,%eax
+    43bc:	74 1b                	je     43d9 <uio+0x39>
+  } else if(pid < 0){
+    43be:	78 3d                	js     43fd <uio+0x5d>
+  wait();
+    43c0:	e8 26 03 00 00       	call   46eb <wait>
+  printf(1, "uio test done\n");
+    43c5:	83 ec 08             	sub    $0x8,%esp
+    43c8:	68 21 5e 00 00       	push   $0x5e21
+    43cd:	6a 01                	push   $0x1
+    43cf:	e8 cc 04 00 00       	call   48a0 <printf>
+}
+    43d4:	83 c4 10             	add    $0x10,%esp
+    43d7:	c9                   	leave
+    43d8:	c3                   	ret
+    asm volatile("outb %0,%1"::"a"(val), "d" (port));
+    43d9:	b8 09 00 00 00       	mov    $0x9,%eax
+    43de:	ba 70 00 00 00       	mov    $0x70,%edx
+    43e3:	ee                   	out    %al,(%dx)
+    asm volatile("inb %1,%0" : "=a" (val) : "d" (port));
+    43e4:	ba 71 00 00 00       	mov    $0x71,%edx
+    43e9:	ec                   	in     (%dx),%al
+    printf(1, "uio: uio succeeded; test FAILED\n");
+    43ea:	52                   	push   %edx
+    43eb:	52                   	push   %edx
+    43ec:	68 c0 67 00 00       	push   $0x67c0
+    43f1:	6a 01                	push   $0x1
+    43f3:	e8 a8 04 00 00       	call   48a0 <printf>
+    exit();
+    43f8:	e8 e6 02 00 00       	call   46e3 <exit>
+    printf (1, "fork failed\n");
+    43fd:	50                   	push   %eax
+    43fe:	50                   	push   %eax
+    43ff:	68 a6 5d 00 00       	push   $0x5da6
+    4404:	6a 01                	push   $0x1
+    4406:	e8 95 04 00 00       	call   48a0 <printf>
+    exit();
+    440b:	e8 d3 02 00 00       	call   46e3 <exit>
+
+00004410 <argptest>:
+{
+    4410:	55                   	push   %ebp
+    4411:	89 e5                	mov    %esp,%ebp
+    4413:	53                   	push   %ebx
+    4414:	83 ec 0c             	sub    $0xc,%esp
+  fd = open("init", O_RDONLY);
+    4417:	6a 00                	push   $0x0
+    4419:	68 30 5e 00 00       	push   $0x5e30
+    441e:	e8 00 03 00 00       	call   4723 <open>
+  if (fd < 0) {
+    4423:	83 c4 10             	add    $0x10,%esp
+    4426:	85 c0                	test   %eax,%eax
+    4428:	78 39                	js     4463 <argptest+0x53>
+  read(fd, sbrk(0) - 1, -1);
+    442a:	83 ec 0c             	sub    $0xc,%esp
+    442d:	89 c3                	mov    %eax,%ebx
+    442f:	6a 00                	push   $0x0
+    4431:	e8 35 03 00 00       	call   476b <sbrk>
+    4436:	83 c4 0c             	add    $0xc,%esp
+    4439:	83 e8 01             	sub    $0x1,%eax
+    443c:	6a ff                	push   $0xffffffff
+    443e:	50                   	push   %eax
+    443f:	53                   	push   %ebx
+    4440:	e8 b6 02 00 00       	call   46fb <read>
+  close(fd);
+    4445:	89 1c 24             	mov    %ebx,(%esp)
+    4448:	e8 be 02 00 00       	call   470b <close>
+  printf(1, "arg test passed\n");
+    444d:	58                   	pop    %eax
+    444e:	5a                   	pop    %edx
+    444f:	68 42 5e 00 00       	push   $0x5e42
+    4454:	6a 01                	push   $0x1
+    4456:	e8 45 04 00 00       	call   48a0 <printf>
+}
+    445b:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    445e:	83 c4 10             	add    $0x10,%esp
+    4461:	c9                   	leave
+    4462:	c3                   	ret
+    printf(2, "open failed\n");
+    4463:	51                   	push   %ecx
+    4464:	51                   	push   %ecx
+    4465:	68 35 5e 00 00       	push   $0x5e35
+    446a:	6a 02                	push   $0x2
+    446c:	e8 2f 04 00 00       	call   48a0 <printf>
+    exit();
+    4471:	e8 6d 02 00 00       	call   46e3 <exit>
+    4476:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    447d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00004480 <rand>:
+  randstate = randstate * 1664525 + 1013904223;
+    4480:	69 05 e4 72 00 00 0d 	imul   $0x19660d,0x72e4,%eax
+    4487:	66 19 00 
+    448a:	05 5f f3 6e 3c       	add    $0x3c6ef35f,%eax
+    448f:	a3 e4 72 00 00       	mov    %eax,0x72e4
+}
+    4494:	c3                   	ret
+    4495:	66 90                	xchg   %ax,%ax
+    4497:	66 90                	xchg   %ax,%ax
+    4499:	66 90                	xchg   %ax,%ax
+    449b:	66 90                	xchg   %ax,%ax
+    449d:	66 90                	xchg   %ax,%ax
+    449f:	90                   	nop
+
+000044a0 <strcpy>:
+#include "user.h"
+#include "x86.h"
+
+char*
+strcpy(char *s, const char *t)
+{
+    44a0:	55                   	push   %ebp
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+    44a1:	31 c0                	xor    %eax,%eax
+{
+    44a3:	89 e5                	mov    %esp,%ebp
+    44a5:	53                   	push   %ebx
+    44a6:	8b 4d 08             	mov    0x8(%ebp),%ecx
+    44a9:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+    44ac:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  while((*s++ = *t++) != 0)
+    44b0:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+    44b4:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+    44b7:	83 c0 01             	add    $0x1,%eax
+    44ba:	84 d2                	test   %dl,%dl
+    44bc:	75 f2                	jne    44b0 <strcpy+0x10>
+    ;
+  return os;
+}
+    44be:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    44c1:	89 c8                	mov    %ecx,%eax
+    44c3:	c9                   	leave
+    44c4:	c3                   	ret
+    44c5:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    44cc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000044d0 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+    44d0:	55                   	push   %ebp
+    44d1:	89 e5                	mov    %esp,%ebp
+    44d3:	53                   	push   %ebx
+    44d4:	8b 55 08             	mov    0x8(%ebp),%edx
+    44d7:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  while(*p && *p == *q)
+    44da:	0f b6 02             	movzbl (%edx),%eax
+    44dd:	84 c0                	test   %al,%al
+    44df:	75 17                	jne    44f8 <strcmp+0x28>
+    44e1:	eb 3a                	jmp    451d <strcmp+0x4d>
+    44e3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    44e7:	90                   	nop
+    44e8:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+    p++, q++;
+    44ec:	83 c2 01             	add    $0x1,%edx
+    44ef:	8d 59 01             	lea    0x1(%ecx),%ebx
+  while(*p && *p == *q)
+    44f2:	84 c0                	test   %al,%al
+    44f4:	74 1a                	je     4510 <strcmp+0x40>
+    p++, q++;
+    44f6:	89 d9                	mov    %ebx,%ecx
+  while(*p && *p == *q)
+    44f8:	0f b6 19             	movzbl (%ecx),%ebx
+    44fb:	38 c3                	cmp    %al,%bl
+    44fd:	74 e9                	je     44e8 <strcmp+0x18>
+  return (uchar)*p - (uchar)*q;
+    44ff:	29 d8                	sub    %ebx,%eax
+}
+    4501:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    4504:	c9                   	leave
+    4505:	c3                   	ret
+    4506:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    450d:	8d 76 00             	lea    0x0(%esi),%esi
+  return (uchar)*p - (uchar)*q;
+    4510:	0f b6 59 01          	movzbl 0x1(%ecx),%ebx
+    4514:	31 c0                	xor    %eax,%eax
+    4516:	29 d8                	sub    %ebx,%eax
+}
+    4518:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    451b:	c9                   	leave
+    451c:	c3                   	ret
+  return (uchar)*p - (uchar)*q;
+    451d:	0f b6 19             	movzbl (%ecx),%ebx
+    4520:	31 c0                	xor    %eax,%eax
+    4522:	eb db                	jmp    44ff <strcmp+0x2f>
+    4524:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    452b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    452f:	90                   	nop
+
+00004530 <strlen>:
+
+uint
+strlen(const char *s)
+{
+    4530:	55                   	push   %ebp
+    4531:	89 e5                	mov    %esp,%ebp
+    4533:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for(n = 0; s[n]; n++)
+    4536:	80 3a 00             	cmpb   $0x0,(%edx)
+    4539:	74 15                	je     4550 <strlen+0x20>
+    453b:	31 c0                	xor    %eax,%eax
+    453d:	8d 76 00             	lea    0x0(%esi),%esi
+    4540:	83 c0 01             	add    $0x1,%eax
+    4543:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+    4547:	89 c1                	mov    %eax,%ecx
+    4549:	75 f5                	jne    4540 <strlen+0x10>
+    ;
+  return n;
+}
+    454b:	89 c8                	mov    %ecx,%eax
+    454d:	5d                   	pop    %ebp
+    454e:	c3                   	ret
+    454f:	90                   	nop
+  for(n = 0; s[n]; n++)
+    4550:	31 c9                	xor    %ecx,%ecx
+}
+    4552:	5d                   	pop    %ebp
+    4553:	89 c8                	mov    %ecx,%eax
+    4555:	c3                   	ret
+    4556:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    455d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00004560 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+    4560:	55                   	push   %ebp
+    4561:	89 e5                	mov    %esp,%ebp
+    4563:	57                   	push   %edi
+    4564:	8b 55 08             	mov    0x8(%ebp),%edx
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosb" :
+    4567:	8b 4d 10             	mov    0x10(%ebp),%ecx
+    456a:	8b 45 0c             	mov    0xc(%ebp),%eax
+    456d:	89 d7                	mov    %edx,%edi
+    456f:	fc                   	cld
+    4570:	f3 aa                	rep stos %al,%es:(%edi)
+  stosb(dst, c, n);
+  return dst;
+}
+    4572:	8b 7d fc             	mov    -0x4(%ebp),%edi
+    4575:	89 d0                	mov    %edx,%eax
+    4577:	c9                   	leave
+    4578:	c3                   	ret
+    4579:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00004580 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+    4580:	55                   	push   %ebp
+    4581:	89 e5                	mov    %esp,%ebp
+    4583:	8b 45 08             	mov    0x8(%ebp),%eax
+    4586:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+    458a:	0f b6 10             	movzbl (%eax),%edx
+    458d:	84 d2                	test   %dl,%dl
+    458f:	75 12                	jne    45a3 <strchr+0x23>
+    4591:	eb 1d                	jmp    45b0 <strchr+0x30>
+    4593:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    4597:	90                   	nop
+    4598:	0f b6 50 01          	movzbl 0x1(%eax),%edx
+    459c:	83 c0 01             	add    $0x1,%eax
+    459f:	84 d2                	test   %dl,%dl
+    45a1:	74 0d                	je     45b0 <strchr+0x30>
+    if(*s == c)
+    45a3:	38 d1                	cmp    %dl,%cl
+    45a5:	75 f1                	jne    4598 <strchr+0x18>
+      return (char*)s;
+  return 0;
+}
+    45a7:	5d                   	pop    %ebp
+    45a8:	c3                   	ret
+    45a9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  return 0;
+    45b0:	31 c0                	xor    %eax,%eax
+}
+    45b2:	5d                   	pop    %ebp
+    45b3:	c3                   	ret
+    45b4:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    45bb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    45bf:	90                   	nop
+
+000045c0 <gets>:
+
+char*
+gets(char *buf, int max)
+{
+    45c0:	55                   	push   %ebp
+    45c1:	89 e5                	mov    %esp,%ebp
+    45c3:	57                   	push   %edi
+    45c4:	56                   	push   %esi
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+    cc = read(0, &c, 1);
+    45c5:	8d 75 e7             	lea    -0x19(%ebp),%esi
+{
+    45c8:	53                   	push   %ebx
+  for(i=0; i+1 < max; ){
+    45c9:	31 db                	xor    %ebx,%ebx
+{
+    45cb:	83 ec 1c             	sub    $0x1c,%esp
+  for(i=0; i+1 < max; ){
+    45ce:	eb 27                	jmp    45f7 <gets+0x37>
+    cc = read(0, &c, 1);
+    45d0:	83 ec 04             	sub    $0x4,%esp
+    45d3:	6a 01                	push   $0x1
+    45d5:	56                   	push   %esi
+    45d6:	6a 00                	push   $0x0
+    45d8:	e8 1e 01 00 00       	call   46fb <read>
+    if(cc < 1)
+    45dd:	83 c4 10             	add    $0x10,%esp
+    45e0:	85 c0                	test   %eax,%eax
+    45e2:	7e 1d                	jle    4601 <gets+0x41>
+      break;
+    buf[i++] = c;
+    45e4:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+    45e8:	8b 55 08             	mov    0x8(%ebp),%edx
+    45eb:	88 44 1a ff          	mov    %al,-0x1(%edx,%ebx,1)
+    if(c == '\n' || c == '\r')
+    45ef:	3c 0a                	cmp    $0xa,%al
+    45f1:	74 10                	je     4603 <gets+0x43>
+    45f3:	3c 0d                	cmp    $0xd,%al
+    45f5:	74 0c                	je     4603 <gets+0x43>
+  for(i=0; i+1 < max; ){
+    45f7:	89 df                	mov    %ebx,%edi
+    45f9:	83 c3 01             	add    $0x1,%ebx
+    45fc:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+    45ff:	7c cf                	jl     45d0 <gets+0x10>
+    4601:	89 fb                	mov    %edi,%ebx
+      break;
+  }
+  buf[i] = '\0';
+    4603:	8b 45 08             	mov    0x8(%ebp),%eax
+    4606:	c6 04 18 00          	movb   $0x0,(%eax,%ebx,1)
+  return buf;
+}
+    460a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    460d:	5b                   	pop    %ebx
+    460e:	5e                   	pop    %esi
+    460f:	5f                   	pop    %edi
+    4610:	5d                   	pop    %ebp
+    4611:	c3                   	ret
+    4612:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    4619:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00004620 <stat>:
+
+int
+stat(const char *n, struct stat *st)
+{
+    4620:	55                   	push   %ebp
+    4621:	89 e5                	mov    %esp,%ebp
+    4623:	56                   	push   %esi
+    4624:	53                   	push   %ebx
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+    4625:	83 ec 08             	sub    $0x8,%esp
+    4628:	6a 00                	push   $0x0
+    462a:	ff 75 08             	push   0x8(%ebp)
+    462d:	e8 f1 00 00 00       	call   4723 <open>
+  if(fd < 0)
+    4632:	83 c4 10             	add    $0x10,%esp
+    4635:	85 c0                	test   %eax,%eax
+    4637:	78 27                	js     4660 <stat+0x40>
+    return -1;
+  r = fstat(fd, st);
+    4639:	83 ec 08             	sub    $0x8,%esp
+    463c:	ff 75 0c             	push   0xc(%ebp)
+    463f:	89 c3                	mov    %eax,%ebx
+    4641:	50                   	push   %eax
+    4642:	e8 f4 00 00 00       	call   473b <fstat>
+  close(fd);
+    4647:	89 1c 24             	mov    %ebx,(%esp)
+  r = fstat(fd, st);
+    464a:	89 c6                	mov    %eax,%esi
+  close(fd);
+    464c:	e8 ba 00 00 00       	call   470b <close>
+  return r;
+    4651:	83 c4 10             	add    $0x10,%esp
+}
+    4654:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    4657:	89 f0                	mov    %esi,%eax
+    4659:	5b                   	pop    %ebx
+    465a:	5e                   	pop    %esi
+    465b:	5d                   	pop    %ebp
+    465c:	c3                   	ret
+    465d:	8d 76 00             	lea    0x0(%esi),%esi
+    return -1;
+    4660:	be ff ff ff ff       	mov    $0xffffffff,%esi
+    4665:	eb ed                	jmp    4654 <stat+0x34>
+    4667:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    466e:	66 90                	xchg   %ax,%ax
+
+00004670 <atoi>:
+
+int
+atoi(const char *s)
+{
+    4670:	55                   	push   %ebp
+    4671:	89 e5                	mov    %esp,%ebp
+    4673:	53                   	push   %ebx
+    4674:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  n = 0;
+  while('0' <= *s && *s <= '9')
+    4677:	0f be 02             	movsbl (%edx),%eax
+    467a:	8d 48 d0             	lea    -0x30(%eax),%ecx
+    467d:	80 f9 09             	cmp    $0x9,%cl
+  n = 0;
+    4680:	b9 00 00 00 00       	mov    $0x0,%ecx
+  while('0' <= *s && *s <= '9')
+    4685:	77 1e                	ja     46a5 <atoi+0x35>
+    4687:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    468e:	66 90                	xchg   %ax,%ax
+    n = n*10 + *s++ - '0';
+    4690:	83 c2 01             	add    $0x1,%edx
+    4693:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+    4696:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+  while('0' <= *s && *s <= '9')
+    469a:	0f be 02             	movsbl (%edx),%eax
+    469d:	8d 58 d0             	lea    -0x30(%eax),%ebx
+    46a0:	80 fb 09             	cmp    $0x9,%bl
+    46a3:	76 eb                	jbe    4690 <atoi+0x20>
+  return n;
+}
+    46a5:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    46a8:	89 c8                	mov    %ecx,%eax
+    46aa:	c9                   	leave
+    46ab:	c3                   	ret
+    46ac:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000046b0 <memmove>:
+
+void*
+memmove(void *vdst, const void *vsrc, int n)
+{
+    46b0:	55                   	push   %ebp
+    46b1:	89 e5                	mov    %esp,%ebp
+    46b3:	57                   	push   %edi
+    46b4:	56                   	push   %esi
+    46b5:	8b 45 10             	mov    0x10(%ebp),%eax
+    46b8:	8b 55 08             	mov    0x8(%ebp),%edx
+    46bb:	8b 75 0c             	mov    0xc(%ebp),%esi
+  char *dst;
+  const char *src;
+
+  dst = vdst;
+  src = vsrc;
+  while(n-- > 0)
+    46be:	85 c0                	test   %eax,%eax
+    46c0:	7e 13                	jle    46d5 <memmove+0x25>
+    46c2:	01 d0                	add    %edx,%eax
+  dst = vdst;
+    46c4:	89 d7                	mov    %edx,%edi
+    46c6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    46cd:	8d 76 00             	lea    0x0(%esi),%esi
+    *dst++ = *src++;
+    46d0:	a4                   	movsb  %ds:(%esi),%es:(%edi)
+  while(n-- > 0)
+    46d1:	39 f8                	cmp    %edi,%eax
+    46d3:	75 fb                	jne    46d0 <memmove+0x20>
+  return vdst;
+}
+    46d5:	5e                   	pop    %esi
+    46d6:	89 d0                	mov    %edx,%eax
+    46d8:	5f                   	pop    %edi
+    46d9:	5d                   	pop    %ebp
+    46da:	c3                   	ret
+
+000046db <fork>:
+  name: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+SYSCALL(fork)
+    46db:	b8 01 00 00 00       	mov    $0x1,%eax
+    46e0:	cd 40                	int    $0x40
+    46e2:	c3                   	ret
+
+000046e3 <exit>:
+SYSCALL(exit)
+    46e3:	b8 02 00 00 00       	mov    $0x2,%eax
+    46e8:	cd 40                	int    $0x40
+    46ea:	c3                   	ret
+
+000046eb <wait>:
+SYSCALL(wait)
+    46eb:	b8 03 00 00 00       	mov    $0x3,%eax
+    46f0:	cd 40                	int    $0x40
+    46f2:	c3                   	ret
+
+000046f3 <pipe>:
+SYSCALL(pipe)
+    46f3:	b8 04 00 00 00       	mov    $0x4,%eax
+    46f8:	cd 40                	int    $0x40
+    46fa:	c3                   	ret
+
+000046fb <read>:
+SYSCALL(read)
+    46fb:	b8 05 00 00 00       	mov    $0x5,%eax
+    4700:	cd 40                	int    $0x40
+    4702:	c3                   	ret
+
+00004703 <write>:
+SYSCALL(write)
+    4703:	b8 10 00 00 00       	mov    $0x10,%eax
+    4708:	cd 40                	int    $0x40
+    470a:	c3                   	ret
+
+0000470b <close>:
+SYSCALL(close)
+    470b:	b8 15 00 00 00       	mov    $0x15,%eax
+    4710:	cd 40                	int    $0x40
+    4712:	c3                   	ret
+
+00004713 <kill>:
+SYSCALL(kill)
+    4713:	b8 06 00 00 00       	mov    $0x6,%eax
+    4718:	cd 40                	int    $0x40
+    471a:	c3                   	ret
+
+0000471b <exec>:
+SYSCALL(exec)
+    471b:	b8 07 00 00 00       	mov    $0x7,%eax
+    4720:	cd 40                	int    $0x40
+    4722:	c3                   	ret
+
+00004723 <open>:
+SYSCALL(open)
+    4723:	b8 0f 00 00 00       	mov    $0xf,%eax
+    4728:	cd 40                	int    $0x40
+    472a:	c3                   	ret
+
+0000472b <mknod>:
+SYSCALL(mknod)
+    472b:	b8 11 00 00 00       	mov    $0x11,%eax
+    4730:	cd 40                	int    $0x40
+    4732:	c3                   	ret
+
+00004733 <unlink>:
+SYSCALL(unlink)
+    4733:	b8 12 00 00 00       	mov    $0x12,%eax
+    4738:	cd 40                	int    $0x40
+    473a:	c3                   	ret
+
+0000473b <fstat>:
+SYSCALL(fstat)
+    473b:	b8 08 00 00 00       	mov    $0x8,%eax
+    4740:	cd 40                	int    $0x40
+    4742:	c3                   	ret
+
+00004743 <link>:
+SYSCALL(link)
+    4743:	b8 13 00 00 00       	mov    $0x13,%eax
+    4748:	cd 40                	int    $0x40
+    474a:	c3                   	ret
+
+0000474b <mkdir>:
+SYSCALL(mkdir)
+    474b:	b8 14 00 00 00       	mov    $0x14,%eax
+    4750:	cd 40                	int    $0x40
+    4752:	c3                   	ret
+
+00004753 <chdir>:
+SYSCALL(chdir)
+    4753:	b8 09 00 00 00       	mov    $0x9,%eax
+    4758:	cd 40                	int    $0x40
+    475a:	c3                   	ret
+
+0000475b <dup>:
+SYSCALL(dup)
+    475b:	b8 0a 00 00 00       	mov    $0xa,%eax
+    4760:	cd 40                	int    $0x40
+    4762:	c3                   	ret
+
+00004763 <getpid>:
+SYSCALL(getpid)
+    4763:	b8 0b 00 00 00       	mov    $0xb,%eax
+    4768:	cd 40                	int    $0x40
+    476a:	c3                   	ret
+
+0000476b <sbrk>:
+SYSCALL(sbrk)
+    476b:	b8 0c 00 00 00       	mov    $0xc,%eax
+    4770:	cd 40                	int    $0x40
+    4772:	c3                   	ret
+
+00004773 <sleep>:
+SYSCALL(sleep)
+    4773:	b8 0d 00 00 00       	mov    $0xd,%eax
+    4778:	cd 40                	int    $0x40
+    477a:	c3                   	ret
+
+0000477b <uptime>:
+SYSCALL(uptime)
+    477b:	b8 0e 00 00 00       	mov    $0xe,%eax
+    4780:	cd 40                	int    $0x40
+    4782:	c3                   	ret
+
+00004783 <cpustat>:
+SYSCALL(cpustat)
+    4783:	b8 16 00 00 00       	mov    $0x16,%eax
+    4788:	cd 40                	int    $0x40
+    478a:	c3                   	ret
+
+0000478b <setpriority>:
+SYSCALL(setpriority)
+    478b:	b8 17 00 00 00       	mov    $0x17,%eax
+    4790:	cd 40                	int    $0x40
+    4792:	c3                   	ret
+
+00004793 <cpuinfo>:
+SYSCALL(cpuinfo)
+    4793:	b8 18 00 00 00       	mov    $0x18,%eax
+    4798:	cd 40                	int    $0x40
+    479a:	c3                   	ret
+
+0000479b <procinfo>:
+SYSCALL(procinfo)
+    479b:	b8 19 00 00 00       	mov    $0x19,%eax
+    47a0:	cd 40                	int    $0x40
+    47a2:	c3                   	ret
+
+000047a3 <setgovernor>:
+SYSCALL(setgovernor)
+    47a3:	b8 1a 00 00 00       	mov    $0x1a,%eax
+    47a8:	cd 40                	int    $0x40
+    47aa:	c3                   	ret
+
+000047ab <sysctl>:
+SYSCALL(sysctl)
+    47ab:	b8 1b 00 00 00       	mov    $0x1b,%eax
+    47b0:	cd 40                	int    $0x40
+    47b2:	c3                   	ret
+
+000047b3 <telemetry>:
+SYSCALL(telemetry)
+    47b3:	b8 1c 00 00 00       	mov    $0x1c,%eax
+    47b8:	cd 40                	int    $0x40
+    47ba:	c3                   	ret
+
+000047bb <clock_gettime>:
+SYSCALL(clock_gettime)
+    47bb:	b8 1d 00 00 00       	mov    $0x1d,%eax
+    47c0:	cd 40                	int    $0x40
+    47c2:	c3                   	ret
+
+000047c3 <sched_setaffinity>:
+SYSCALL(sched_setaffinity)
+    47c3:	b8 1e 00 00 00       	mov    $0x1e,%eax
+    47c8:	cd 40                	int    $0x40
+    47ca:	c3                   	ret
+
+000047cb <sched_getaffinity>:
+SYSCALL(sched_getaffinity)
+    47cb:	b8 1f 00 00 00       	mov    $0x1f,%eax
+    47d0:	cd 40                	int    $0x40
+    47d2:	c3                   	ret
+
+000047d3 <setqos>:
+SYSCALL(setqos)
+    47d3:	b8 20 00 00 00       	mov    $0x20,%eax
+    47d8:	cd 40                	int    $0x40
+    47da:	c3                   	ret
+
+000047db <setgroup>:
+SYSCALL(setgroup)
+    47db:	b8 21 00 00 00       	mov    $0x21,%eax
+    47e0:	cd 40                	int    $0x40
+    47e2:	c3                   	ret
+
+000047e3 <setquota>:
+SYSCALL(setquota)
+    47e3:	b8 22 00 00 00       	mov    $0x22,%eax
+    47e8:	cd 40                	int    $0x40
+    47ea:	c3                   	ret
+
+000047eb <groupinfo>:
+SYSCALL(groupinfo)
+    47eb:	b8 23 00 00 00       	mov    $0x23,%eax
+    47f0:	cd 40                	int    $0x40
+    47f2:	c3                   	ret
+    47f3:	66 90                	xchg   %ax,%ax
+    47f5:	66 90                	xchg   %ax,%ax
+    47f7:	66 90                	xchg   %ax,%ax
+    47f9:	66 90                	xchg   %ax,%ax
+    47fb:	66 90                	xchg   %ax,%ax
+    47fd:	66 90                	xchg   %ax,%ax
+    47ff:	90                   	nop
+
+00004800 <printint>:
+  write(fd, &c, 1);
+}
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+    4800:	55                   	push   %ebp
+    4801:	89 e5                	mov    %esp,%ebp
+    4803:	57                   	push   %edi
+    4804:	56                   	push   %esi
+    4805:	53                   	push   %ebx
+    4806:	89 cb                	mov    %ecx,%ebx
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+    neg = 1;
+    x = -xx;
+    4808:	89 d1                	mov    %edx,%ecx
+{
+    480a:	83 ec 3c             	sub    $0x3c,%esp
+    480d:	89 45 c0             	mov    %eax,-0x40(%ebp)
+  if(sgn && xx < 0){
+    4810:	85 d2                	test   %edx,%edx
+    4812:	0f 89 80 00 00 00    	jns    4898 <printint+0x98>
+    4818:	f6 45 08 01          	testb  $0x1,0x8(%ebp)
+    481c:	74 7a                	je     4898 <printint+0x98>
+    x = -xx;
+    481e:	f7 d9                	neg    %ecx
+    neg = 1;
+    4820:	b8 01 00 00 00       	mov    $0x1,%eax
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+    4825:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+    4828:	31 f6                	xor    %esi,%esi
+    482a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  do{
+    buf[i++] = digits[x % base];
+    4830:	89 c8                	mov    %ecx,%eax
+    4832:	31 d2                	xor    %edx,%edx
+    4834:	89 f7                	mov    %esi,%edi
+    4836:	f7 f3                	div    %ebx
+    4838:	8d 76 01             	lea    0x1(%esi),%esi
+    483b:	0f b6 92 80 68 00 00 	movzbl 0x6880(%edx),%edx
+    4842:	88 54 35 d7          	mov    %dl,-0x29(%ebp,%esi,1)
+  }while((x /= base) != 0);
+    4846:	89 ca                	mov    %ecx,%edx
+    4848:	89 c1                	mov    %eax,%ecx
+    484a:	39 da                	cmp    %ebx,%edx
+    484c:	73 e2                	jae    4830 <printint+0x30>
+  if(neg)
+    484e:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+    4851:	85 c0                	test   %eax,%eax
+    4853:	74 07                	je     485c <printint+0x5c>
+    buf[i++] = '-';
+    4855:	c6 44 35 d8 2d       	movb   $0x2d,-0x28(%ebp,%esi,1)
+    buf[i++] = digits[x % base];
+    485a:	89 f7                	mov    %esi,%edi
+    485c:	8d 5d d8             	lea    -0x28(%ebp),%ebx
+    485f:	8b 75 c0             	mov    -0x40(%ebp),%esi
+    4862:	01 df                	add    %ebx,%edi
+    4864:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+  while(--i >= 0)
+    putc(fd, buf[i]);
+    4868:	0f b6 07             	movzbl (%edi),%eax
+  write(fd, &c, 1);
+    486b:	83 ec 04             	sub    $0x4,%esp
+    486e:	88 45 d7             	mov    %al,-0x29(%ebp)
+    4871:	8d 45 d7             	lea    -0x29(%ebp),%eax
+    4874:	6a 01                	push   $0x1
+    4876:	50                   	push   %eax
+    4877:	56                   	push   %esi
+    4878:	e8 86 fe ff ff       	call   4703 <write>
+  while(--i >= 0)
+    487d:	89 f8                	mov    %edi,%eax
+    487f:	83 c4 10             	add    $0x10,%esp
+    4882:	83 ef 01             	sub    $0x1,%edi
+    4885:	39 d8                	cmp    %ebx,%eax
+    4887:	75 df                	jne    4868 <printint+0x68>
+}
+    4889:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    488c:	5b                   	pop    %ebx
+    488d:	5e                   	pop    %esi
+    488e:	5f                   	pop    %edi
+    488f:	5d                   	pop    %ebp
+    4890:	c3                   	ret
+    4891:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  neg = 0;
+    4898:	31 c0                	xor    %eax,%eax
+    489a:	eb 89                	jmp    4825 <printint+0x25>
+    489c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000048a0 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, const char *fmt, ...)
+{
+    48a0:	55                   	push   %ebp
+    48a1:	89 e5                	mov    %esp,%ebp
+    48a3:	57                   	push   %edi
+    48a4:	56                   	push   %esi
+    48a5:	53                   	push   %ebx
+    48a6:	83 ec 2c             	sub    $0x2c,%esp
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+  ap = (uint*)(void*)&fmt + 1;
+  for(i = 0; fmt[i]; i++){
+    48a9:	8b 75 0c             	mov    0xc(%ebp),%esi
+{
+    48ac:	8b 7d 08             	mov    0x8(%ebp),%edi
+  for(i = 0; fmt[i]; i++){
+    48af:	0f b6 1e             	movzbl (%esi),%ebx
+    48b2:	83 c6 01             	add    $0x1,%esi
+    48b5:	84 db                	test   %bl,%bl
+    48b7:	74 67                	je     4920 <printf+0x80>
+    48b9:	8d 4d 10             	lea    0x10(%ebp),%ecx
+    48bc:	31 d2                	xor    %edx,%edx
+    48be:	89 4d d0             	mov    %ecx,-0x30(%ebp)
+    48c1:	eb 34                	jmp    48f7 <printf+0x57>
+    48c3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    48c7:	90                   	nop
+    48c8:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+        state = '%';
+    48cb:	ba 25 00 00 00       	mov    $0x25,%edx
+      if(c == '%'){
+    48d0:	83 f8 25             	cmp    $0x25,%eax
+    48d3:	74 18                	je     48ed <printf+0x4d>
+  write(fd, &c, 1);
+    48d5:	83 ec 04             	sub    $0x4,%esp
+    48d8:	8d 45 e7             	lea    -0x19(%ebp),%eax
+    48db:	88 5d e7             	mov    %bl,-0x19(%ebp)
+    48de:	6a 01                	push   $0x1
+    48e0:	50                   	push   %eax
+    48e1:	57                   	push   %edi
+    48e2:	e8 1c fe ff ff       	call   4703 <write>
+    48e7:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+      } else {
+        putc(fd, c);
+    48ea:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; fmt[i]; i++){
+    48ed:	0f b6 1e             	movzbl (%esi),%ebx
+    48f0:	83 c6 01             	add    $0x1,%esi
+    48f3:	84 db                	test   %bl,%bl
+    48f5:	74 29                	je     4920 <printf+0x80>
+    c = fmt[i] & 0xff;
+    48f7:	0f b6 c3             	movzbl %bl,%eax
+    if(state == 0){
+    48fa:	85 d2                	test   %edx,%edx
+    48fc:	74 ca                	je     48c8 <printf+0x28>
+      }
+    } else if(state == '%'){
+    48fe:	83 fa 25             	cmp    $0x25,%edx
+    4901:	75 ea                	jne    48ed <printf+0x4d>
+      if(c == 'd'){
+    4903:	83 f8 25             	cmp    $0x25,%eax
+    4906:	0f 84 24 01 00 00    	je     4a30 <printf+0x190>
+    490c:	83 e8 63             	sub    $0x63,%eax
+    490f:	83 f8 15             	cmp    $0x15,%eax
+    4912:	77 1c                	ja     4930 <printf+0x90>
+    4914:	ff 24 85 28 68 00 00 	jmp    *0x6828(,%eax,4)
+    491b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    491f:	90                   	nop
+        putc(fd, c);
+      }
+      state = 0;
+    }
+  }
+}
+    4920:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    4923:	5b                   	pop    %ebx
+    4924:	5e                   	pop    %esi
+    4925:	5f                   	pop    %edi
+    4926:	5d                   	pop    %ebp
+    4927:	c3                   	ret
+    4928:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    492f:	90                   	nop
+  write(fd, &c, 1);
+    4930:	83 ec 04             	sub    $0x4,%esp
+    4933:	8d 55 e7             	lea    -0x19(%ebp),%edx
+    4936:	c6 45 e7 25          	movb   $0x25,-0x19(%ebp)
+    493a:	6a 01                	push   $0x1
+    493c:	52                   	push   %edx
+    493d:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+    4940:	57                   	push   %edi
+    4941:	e8 bd fd ff ff       	call   4703 <write>
+    4946:	83 c4 0c             	add    $0xc,%esp
+    4949:	88 5d e7             	mov    %bl,-0x19(%ebp)
+    494c:	6a 01                	push   $0x1
+    494e:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+    4951:	52                   	push   %edx
+    4952:	57                   	push   %edi
+    4953:	e8 ab fd ff ff       	call   4703 <write>
+        putc(fd, c);
+    4958:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+    495b:	31 d2                	xor    %edx,%edx
+    495d:	eb 8e                	jmp    48ed <printf+0x4d>
+    495f:	90                   	nop
+        printint(fd, *ap, 16, 0);
+    4960:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+    4963:	83 ec 0c             	sub    $0xc,%esp
+    4966:	b9 10 00 00 00       	mov    $0x10,%ecx
+    496b:	8b 13                	mov    (%ebx),%edx
+    496d:	6a 00                	push   $0x0
+    496f:	89 f8                	mov    %edi,%eax
+        ap++;
+    4971:	83 c3 04             	add    $0x4,%ebx
+        printint(fd, *ap, 16, 0);
+    4974:	e8 87 fe ff ff       	call   4800 <printint>
+        ap++;
+    4979:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+    497c:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+    497f:	31 d2                	xor    %edx,%edx
+    4981:	e9 67 ff ff ff       	jmp    48ed <printf+0x4d>
+    4986:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    498d:	8d 76 00             	lea    0x0(%esi),%esi
+        s = (char*)*ap;
+    4990:	8b 45 d0             	mov    -0x30(%ebp),%eax
+    4993:	8b 18                	mov    (%eax),%ebx
+        ap++;
+    4995:	83 c0 04             	add    $0x4,%eax
+    4998:	89 45 d0             	mov    %eax,-0x30(%ebp)
+        if(s == 0)
+    499b:	85 db                	test   %ebx,%ebx
+    499d:	0f 84 9d 00 00 00    	je     4a40 <printf+0x1a0>
+        while(*s != 0){
+    49a3:	0f b6 03             	movzbl (%ebx),%eax
+      state = 0;
+    49a6:	31 d2                	xor    %edx,%edx
+        while(*s != 0){
+    49a8:	84 c0                	test   %al,%al
+    49aa:	0f 84 3d ff ff ff    	je     48ed <printf+0x4d>
+    49b0:	8d 55 e7             	lea    -0x19(%ebp),%edx
+    49b3:	89 75 d4             	mov    %esi,-0x2c(%ebp)
+    49b6:	89 de                	mov    %ebx,%esi
+    49b8:	89 d3                	mov    %edx,%ebx
+    49ba:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  write(fd, &c, 1);
+    49c0:	83 ec 04             	sub    $0x4,%esp
+    49c3:	88 45 e7             	mov    %al,-0x19(%ebp)
+          s++;
+    49c6:	83 c6 01             	add    $0x1,%esi
+  write(fd, &c, 1);
+    49c9:	6a 01                	push   $0x1
+    49cb:	53                   	push   %ebx
+    49cc:	57                   	push   %edi
+    49cd:	e8 31 fd ff ff       	call   4703 <write>
+        while(*s != 0){
+    49d2:	0f b6 06             	movzbl (%esi),%eax
+    49d5:	83 c4 10             	add    $0x10,%esp
+    49d8:	84 c0                	test   %al,%al
+    49da:	75 e4                	jne    49c0 <printf+0x120>
+      state = 0;
+    49dc:	8b 75 d4             	mov    -0x2c(%ebp),%esi
+    49df:	31 d2                	xor    %edx,%edx
+    49e1:	e9 07 ff ff ff       	jmp    48ed <printf+0x4d>
+    49e6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    49ed:	8d 76 00             	lea    0x0(%esi),%esi
+        printint(fd, *ap, 10, 1);
+    49f0:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+    49f3:	83 ec 0c             	sub    $0xc,%esp
+    49f6:	b9 0a 00 00 00       	mov    $0xa,%ecx
+    49fb:	8b 13                	mov    (%ebx),%edx
+    49fd:	6a 01                	push   $0x1
+    49ff:	e9 6b ff ff ff       	jmp    496f <printf+0xcf>
+    4a04:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+        putc(fd, *ap);
+    4a08:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  write(fd, &c, 1);
+    4a0b:	83 ec 04             	sub    $0x4,%esp
+    4a0e:	8d 55 e7             	lea    -0x19(%ebp),%edx
+        putc(fd, *ap);
+    4a11:	8b 03                	mov    (%ebx),%eax
+        ap++;
+    4a13:	83 c3 04             	add    $0x4,%ebx
+        putc(fd, *ap);
+    4a16:	88 45 e7             	mov    %al,-0x19(%ebp)
+  write(fd, &c, 1);
+    4a19:	6a 01                	push   $0x1
+    4a1b:	52                   	push   %edx
+    4a1c:	57                   	push   %edi
+    4a1d:	e8 e1 fc ff ff       	call   4703 <write>
+        ap++;
+    4a22:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+    4a25:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+    4a28:	31 d2                	xor    %edx,%edx
+    4a2a:	e9 be fe ff ff       	jmp    48ed <printf+0x4d>
+    4a2f:	90                   	nop
+  write(fd, &c, 1);
+    4a30:	83 ec 04             	sub    $0x4,%esp
+    4a33:	88 5d e7             	mov    %bl,-0x19(%ebp)
+    4a36:	8d 55 e7             	lea    -0x19(%ebp),%edx
+    4a39:	6a 01                	push   $0x1
+    4a3b:	e9 11 ff ff ff       	jmp    4951 <printf+0xb1>
+    4a40:	b8 28 00 00 00       	mov    $0x28,%eax
+          s = "(null)";
+    4a45:	bb 20 68 00 00       	mov    $0x6820,%ebx
+    4a4a:	e9 61 ff ff ff       	jmp    49b0 <printf+0x110>
+    4a4f:	90                   	nop
+
+00004a50 <free>:
+static Header base;
+static Header *freep;
+
+void
+free(void *ap)
+{
+    4a50:	55                   	push   %ebp
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+    4a51:	a1 a0 ba 00 00       	mov    0xbaa0,%eax
+{
+    4a56:	89 e5                	mov    %esp,%ebp
+    4a58:	57                   	push   %edi
+    4a59:	56                   	push   %esi
+    4a5a:	53                   	push   %ebx
+    4a5b:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  bp = (Header*)ap - 1;
+    4a5e:	8d 4b f8             	lea    -0x8(%ebx),%ecx
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+    4a61:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    4a68:	89 c2                	mov    %eax,%edx
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+    4a6a:	8b 00                	mov    (%eax),%eax
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+    4a6c:	39 ca                	cmp    %ecx,%edx
+    4a6e:	73 30                	jae    4aa0 <free+0x50>
+    4a70:	39 c1                	cmp    %eax,%ecx
+    4a72:	72 04                	jb     4a78 <free+0x28>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+    4a74:	39 c2                	cmp    %eax,%edx
+    4a76:	72 f0                	jb     4a68 <free+0x18>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+    4a78:	8b 73 fc             	mov    -0x4(%ebx),%esi
+    4a7b:	8d 3c f1             	lea    (%ecx,%esi,8),%edi
+    4a7e:	39 f8                	cmp    %edi,%eax
+    4a80:	74 2e                	je     4ab0 <free+0x60>
+    bp->s.size += p->s.ptr->s.size;
+    bp->s.ptr = p->s.ptr->s.ptr;
+    4a82:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  } else
+    bp->s.ptr = p->s.ptr;
+  if(p + p->s.size == bp){
+    4a85:	8b 42 04             	mov    0x4(%edx),%eax
+    4a88:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+    4a8b:	39 f1                	cmp    %esi,%ecx
+    4a8d:	74 38                	je     4ac7 <free+0x77>
+    p->s.size += bp->s.size;
+    p->s.ptr = bp->s.ptr;
+    4a8f:	89 0a                	mov    %ecx,(%edx)
+  } else
+    p->s.ptr = bp;
+  freep = p;
+}
+    4a91:	5b                   	pop    %ebx
+  freep = p;
+    4a92:	89 15 a0 ba 00 00    	mov    %edx,0xbaa0
+}
+    4a98:	5e                   	pop    %esi
+    4a99:	5f                   	pop    %edi
+    4a9a:	5d                   	pop    %ebp
+    4a9b:	c3                   	ret
+    4a9c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+    4aa0:	39 c1                	cmp    %eax,%ecx
+    4aa2:	72 d0                	jb     4a74 <free+0x24>
+    4aa4:	eb c2                	jmp    4a68 <free+0x18>
+    4aa6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    4aad:	8d 76 00             	lea    0x0(%esi),%esi
+    bp->s.size += p->s.ptr->s.size;
+    4ab0:	03 70 04             	add    0x4(%eax),%esi
+    4ab3:	89 73 fc             	mov    %esi,-0x4(%ebx)
+    bp->s.ptr = p->s.ptr->s.ptr;
+    4ab6:	8b 02                	mov    (%edx),%eax
+    4ab8:	8b 00                	mov    (%eax),%eax
+    4aba:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  if(p + p->s.size == bp){
+    4abd:	8b 42 04             	mov    0x4(%edx),%eax
+    4ac0:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+    4ac3:	39 f1                	cmp    %esi,%ecx
+    4ac5:	75 c8                	jne    4a8f <free+0x3f>
+    p->s.size += bp->s.size;
+    4ac7:	03 43 fc             	add    -0x4(%ebx),%eax
+  freep = p;
+    4aca:	89 15 a0 ba 00 00    	mov    %edx,0xbaa0
+    p->s.size += bp->s.size;
+    4ad0:	89 42 04             	mov    %eax,0x4(%edx)
+    p->s.ptr = bp->s.ptr;
+    4ad3:	8b 4b f8             	mov    -0x8(%ebx),%ecx
+    4ad6:	89 0a                	mov    %ecx,(%edx)
+}
+    4ad8:	5b                   	pop    %ebx
+    4ad9:	5e                   	pop    %esi
+    4ada:	5f                   	pop    %edi
+    4adb:	5d                   	pop    %ebp
+    4adc:	c3                   	ret
+    4add:	8d 76 00             	lea    0x0(%esi),%esi
+
+00004ae0 <malloc>:
+  return freep;
+}
+
+void*
+malloc(uint nbytes)
+{
+    4ae0:	55                   	push   %ebp
+    4ae1:	89 e5                	mov    %esp,%ebp
+    4ae3:	57                   	push   %edi
+    4ae4:	56                   	push   %esi
+    4ae5:	53                   	push   %ebx
+    4ae6:	83 ec 0c             	sub    $0xc,%esp
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+    4ae9:	8b 45 08             	mov    0x8(%ebp),%eax
+  if((prevp = freep) == 0){
+    4aec:	8b 15 a0 ba 00 00    	mov    0xbaa0,%edx
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+    4af2:	8d 78 07             	lea    0x7(%eax),%edi
+    4af5:	c1 ef 03             	shr    $0x3,%edi
+    4af8:	83 c7 01             	add    $0x1,%edi
+  if((prevp = freep) == 0){
+    4afb:	85 d2                	test   %edx,%edx
+    4afd:	0f 84 8d 00 00 00    	je     4b90 <malloc+0xb0>
+    base.s.ptr = freep = prevp = &base;
+    base.s.size = 0;
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+    4b03:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+    4b05:	8b 48 04             	mov    0x4(%eax),%ecx
+    4b08:	39 f9                	cmp    %edi,%ecx
+    4b0a:	73 64                	jae    4b70 <malloc+0x90>
+  if(nu < 4096)
+    4b0c:	bb 00 10 00 00       	mov    $0x1000,%ebx
+    4b11:	39 df                	cmp    %ebx,%edi
+    4b13:	0f 43 df             	cmovae %edi,%ebx
+  p = sbrk(nu * sizeof(Header));
+    4b16:	8d 34 dd 00 00 00 00 	lea    0x0(,%ebx,8),%esi
+    4b1d:	eb 0a                	jmp    4b29 <malloc+0x49>
+    4b1f:	90                   	nop
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+    4b20:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+    4b22:	8b 48 04             	mov    0x4(%eax),%ecx
+    4b25:	39 f9                	cmp    %edi,%ecx
+    4b27:	73 47                	jae    4b70 <malloc+0x90>
+        p->s.size = nunits;
+      }
+      freep = prevp;
+      return (void*)(p + 1);
+    }
+    if(p == freep)
+    4b29:	89 c2                	mov    %eax,%edx
+    4b2b:	39 05 a0 ba 00 00    	cmp    %eax,0xbaa0
+    4b31:	75 ed                	jne    4b20 <malloc+0x40>
+  p = sbrk(nu * sizeof(Header));
+    4b33:	83 ec 0c             	sub    $0xc,%esp
+    4b36:	56                   	push   %esi
+    4b37:	e8 2f fc ff ff       	call   476b <sbrk>
+  if(p == (char*)-1)
+    4b3c:	83 c4 10             	add    $0x10,%esp
+    4b3f:	83 f8 ff             	cmp    $0xffffffff,%eax
+    4b42:	74 1c                	je     4b60 <malloc+0x80>
+  hp->s.size = nu;
+    4b44:	89 58 04             	mov    %ebx,0x4(%eax)
+  free((void*)(hp + 1));
+    4b47:	83 ec 0c             	sub    $0xc,%esp
+    4b4a:	83 c0 08             	add    $0x8,%eax
+    4b4d:	50                   	push   %eax
+    4b4e:	e8 fd fe ff ff       	call   4a50 <free>
+  return freep;
+    4b53:	8b 15 a0 ba 00 00    	mov    0xbaa0,%edx
+      if((p = morecore(nunits)) == 0)
+    4b59:	83 c4 10             	add    $0x10,%esp
+    4b5c:	85 d2                	test   %edx,%edx
+    4b5e:	75 c0                	jne    4b20 <malloc+0x40>
+        return 0;
+  }
+}
+    4b60:	8d 65 f4             	lea    -0xc(%ebp),%esp
+        return 0;
+    4b63:	31 c0                	xor    %eax,%eax
+}
+    4b65:	5b                   	pop    %ebx
+    4b66:	5e                   	pop    %esi
+    4b67:	5f                   	pop    %edi
+    4b68:	5d                   	pop    %ebp
+    4b69:	c3                   	ret
+    4b6a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+      if(p->s.size == nunits)
+    4b70:	39 cf                	cmp    %ecx,%edi
+    4b72:	74 4c                	je     4bc0 <malloc+0xe0>
+        p->s.size -= nunits;
+    4b74:	29 f9                	sub    %edi,%ecx
+    4b76:	89 48 04             	mov    %ecx,0x4(%eax)
+        p += p->s.size;
+    4b79:	8d 04 c8             	lea    (%eax,%ecx,8),%eax
+        p->s.size = nunits;
+    4b7c:	89 78 04             	mov    %edi,0x4(%eax)
+      freep = prevp;
+    4b7f:	89 15 a0 ba 00 00    	mov    %edx,0xbaa0
+}
+    4b85:	8d 65 f4             	lea    -0xc(%ebp),%esp
+      return (void*)(p + 1);
+    4b88:	83 c0 08             	add    $0x8,%eax
+}
+    4b8b:	5b                   	pop    %ebx
+    4b8c:	5e                   	pop    %esi
+    4b8d:	5f                   	pop    %edi
+    4b8e:	5d                   	pop    %ebp
+    4b8f:	c3                   	ret
+    base.s.ptr = freep = prevp = &base;
+    4b90:	c7 05 a0 ba 00 00 a4 	movl   $0xbaa4,0xbaa0
+    4b97:	ba 00 00 
+    base.s.size = 0;
+    4b9a:	b8 a4 ba 00 00       	mov    $0xbaa4,%eax
+    base.s.ptr = freep = prevp = &base;
+    4b9f:	c7 05 a4 ba 00 00 a4 	movl   $0xbaa4,0xbaa4
+    4ba6:	ba 00 00 
+    base.s.size = 0;
+    4ba9:	c7 05 a8 ba 00 00 00 	movl   $0x0,0xbaa8
+    4bb0:	00 00 00 
+    if(p->s.size >= nunits){
+    4bb3:	e9 54 ff ff ff       	jmp    4b0c <malloc+0x2c>
+    4bb8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    4bbf:	90                   	nop
+        prevp->s.ptr = p->s.ptr;
+    4bc0:	8b 08                	mov    (%eax),%ecx
+    4bc2:	89 0a                	mov    %ecx,(%edx)
+    4bc4:	eb b9                	jmp    4b7f <malloc+0x9f>
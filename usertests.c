@@ -424,6 +424,387 @@ exitwait(void)
   printf(1, "exitwait ok\n");
 }
 
+// Run a child that spins for the given number of ticks, and return
+// how many loops it got through.
+int
+spinwork(int n)
+{
+  int fds[2], pid, count;
+  uint end;
+
+  pipe(fds);
+  pid = fork();
+  if(pid < 0){
+    printf(1, "fork failed\n");
+    exit();
+  }
+  if(pid == 0){
+    close(fds[0]);
+    end = uptime() + n;
+    for(count = 0; uptime() < end; count++)
+      ;
+    write(fds[1], &count, sizeof(count));
+    exit();
+  }
+  close(fds[1]);
+  count = 0;
+  if(read(fds[0], &count, sizeof(count)) != sizeof(count)){
+    printf(1, "spinwork read failed\n");
+    exit();
+  }
+  close(fds[0]);
+  wait();
+  return count;
+}
+
+// At LOW a spinner gets through about duty_low% of the work it does
+// at HIGH, and can still be killed while it is halted for the
+// difference.  Governors are 0=spas 1=performance 2=powersave.
+void
+dutytest(void)
+{
+  int period, duty, high, low, pct, pid, t0;
+
+  printf(1, "duty test\n");
+  if(sysctl(-1, "load_period", &period, 0) < 0 ||
+     sysctl(-1, "duty_low", &duty, 0) < 0){
+    printf(1, "sysctl failed\n");
+    exit();
+  }
+  setgovernor(-1, 1);
+  sleep(2 * period);              // levels change once per period
+  high = spinwork(200);
+  setgovernor(-1, 2);
+  sleep(2 * period);
+  low = spinwork(200);
+  pct = high >= 100 ? low / (high / 100) : 0;
+  if(pct < duty - 15 || pct > duty + 15){
+    printf(1, "spinner at LOW did %d%% of HIGH's work, want %d%%\n",
+           pct, duty);
+    setgovernor(-1, 0);
+    exit();
+  }
+
+  pid = fork();
+  if(pid == 0)
+    for(;;)
+      ;
+  sleep(20);
+  t0 = uptime();
+  kill(pid);
+  wait();
+  setgovernor(-1, 0);
+  if(uptime() - t0 > 50){
+    printf(1, "stalled spinner took %d ticks to die\n", uptime() - t0);
+    exit();
+  }
+  printf(1, "duty test ok\n");
+}
+
+// sysctl() rejects out-of-range and inconsistent values, leaving
+// the tunable as it was.
+void
+sysctltest(void)
+{
+  int low, high, v, bad;
+
+  printf(1, "sysctl test\n");
+  if(sysctl(-1, "thresh_low_med", &low, 0) < 0 ||
+     sysctl(-1, "thresh_med_high", &high, 0) < 0){
+    printf(1, "sysctl read failed\n");
+    exit();
+  }
+  bad = 101;
+  if(sysctl(-1, "thresh_low_med", 0, &bad) >= 0){
+    printf(1, "sysctl accepted out-of-range %d\n", bad);
+    exit();
+  }
+  bad = high + 1;
+  if(sysctl(-1, "thresh_low_med", 0, &bad) >= 0){
+    printf(1, "sysctl accepted thresh_low_med %d > thresh_med_high %d\n",
+           bad, high);
+    exit();
+  }
+  if(sysctl(-1, "thresh_low_med", &v, 0) < 0 || v != low){
+    printf(1, "rejected sysctl changed thresh_low_med to %d\n", v);
+    exit();
+  }
+  if(sysctl(-1, "no_such_tunable", &v, 0) >= 0){
+    printf(1, "sysctl accepted unknown name\n");
+    exit();
+  }
+  printf(1, "sysctl test ok\n");
+}
+
+// A telemetry reader that falls more than NTELEMETRY samples behind
+// is told how many it missed in the dropped field of the next one.
+void
+telemetrytest(void)
+{
+  struct telemetry t;
+  uint seq, last;
+  int old, period;
+
+  printf(1, "telemetry test\n");
+  if(sysctl(-1, "load_period", &old, 0) < 0){
+    printf(1, "sysctl load_period failed\n");
+    exit();
+  }
+  seq = 0;
+  if(telemetry(&seq, &t, 1) != 1 || t.dropped != 0){
+    printf(1, "telemetry read failed\n");
+    exit();
+  }
+  period = 1;                     // a sample every tick
+  sysctl(-1, "load_period", 0, &period);
+  sleep(NTELEMETRY + 20);
+  sysctl(-1, "load_period", 0, &old);
+  last = seq;
+  if(telemetry(&seq, &t, 1) != 1){
+    printf(1, "telemetry read failed\n");
+    exit();
+  }
+  if(t.dropped == 0 || t.seq - last != t.dropped + 1){
+    printf(1, "telemetry sample %d after %d reports %d dropped\n",
+           t.seq, last, t.dropped);
+    exit();
+  }
+  printf(1, "telemetry test ok\n");
+}
+
+// sleep() is served by a timer wheel: a deadline may be deferred by
+// up to timer_slack ticks, but never brought forward, including one
+// more than a full turn of the wheel away.  A kill ends it early.
+void
+sleeptest(void)
+{
+  static int waits[] = { 0, 1, 5, 70 };
+  int i, n, slack, old, t0, t, pid;
+
+  printf(1, "sleep test\n");
+  if(sysctl(-1, "timer_slack", &old, 0) < 0){
+    printf(1, "sysctl timer_slack failed\n");
+    exit();
+  }
+  for(slack = 0; slack <= 3; slack += 3){
+    sysctl(-1, "timer_slack", 0, &slack);
+    for(i = 0; i < sizeof(waits)/sizeof(waits[0]); i++){
+      n = waits[i];
+      t0 = uptime();
+      if(sleep(n) < 0){
+        printf(1, "sleep(%d) failed\n", n);
+        exit();
+      }
+      t = uptime() - t0;
+      if(t < n || t > n + slack + 5){
+        printf(1, "sleep(%d) with slack %d took %d ticks\n", n, slack, t);
+        exit();
+      }
+    }
+  }
+  sysctl(-1, "timer_slack", 0, &old);
+
+  pid = fork();
+  if(pid < 0){
+    printf(1, "fork failed\n");
+    exit();
+  }
+  if(pid == 0){
+    sleep(1000);
+    exit();
+  }
+  t0 = uptime();
+  sleep(2);
+  kill(pid);
+  wait();
+  if(uptime() - t0 > 100){
+    printf(1, "killed sleeper did not wake\n");
+    exit();
+  }
+  printf(1, "sleep test ok\n");
+}
+
+// An affinity mask keeps a process on its CPUs, whether set by the
+// process itself or by another, and is kept across fork and exec
+// (taskset reports the mask it was started with).  lastcpu says
+// where a process actually ran, not just which queue it is on.
+void
+affinitytest(void)
+{
+  static char *args[] = { "taskset", "-p", "0", 0 };
+  struct procinfo pi;
+  uint mask, all;
+  int i, n, cpu, pid, fds[2];
+
+  printf(1, "affinity test\n");
+  if(sched_getaffinity(0, &all) < 0 || (all & 1) == 0){
+    printf(1, "sched_getaffinity failed\n");
+    exit();
+  }
+  if(sched_setaffinity(0, 0) >= 0 || sched_setaffinity(0, ~all) >= 0){
+    printf(1, "empty mask accepted\n");
+    exit();
+  }
+
+  pid = fork();
+  if(pid < 0){
+    printf(1, "fork failed\n");
+    exit();
+  }
+  if(pid == 0)
+    for(;;)
+      ;
+  for(cpu = 0; cpu < 2 && (all >> cpu) & 1; cpu++){
+    if(sched_setaffinity(pid, 1 << cpu) < 0){
+      printf(1, "sched_setaffinity failed\n");
+      exit();
+    }
+    sleep(2);
+    for(i = 0; i < 20; i++){
+      if(procinfo(pid, &pi) < 0 || pi.lastcpu != cpu){
+        printf(1, "spinner ran on cpu %d outside mask %x\n",
+               pi.lastcpu, 1 << cpu);
+        exit();
+      }
+      sleep(1);
+    }
+  }
+  kill(pid);
+  wait();
+
+  if(sched_setaffinity(0, 1) < 0){
+    printf(1, "sched_setaffinity failed\n");
+    exit();
+  }
+  for(i = 0; i < 100; i++){
+    if(procinfo(getpid(), &pi) < 0 || pi.lastcpu != 0){
+      printf(1, "running on cpu %d outside mask\n", pi.lastcpu);
+      exit();
+    }
+    sleep(i % 2);
+  }
+
+  pipe(fds);
+  pid = fork();
+  if(pid < 0){
+    printf(1, "fork failed\n");
+    exit();
+  }
+  if(pid == 0){
+    if(sched_getaffinity(0, &mask) < 0 || mask != 1){
+      printf(1, "mask not inherited across fork\n");
+      exit();
+    }
+    close(1);
+    dup(fds[1]);
+    close(fds[0]);
+    close(fds[1]);
+    exec("taskset", args);
+    printf(2, "exec taskset failed\n");
+    exit();
+  }
+  close(fds[1]);
+  n = 0;
+  while((i = read(fds[0], buf + n, sizeof(buf) - 1 - n)) > 0)
+    n += i;
+  close(fds[0]);
+  wait();
+  buf[n] = 0;
+  if(n < 3 || strcmp(buf + n - 3, " 1\n") != 0){
+    printf(1, "mask not kept across exec: %s\n", buf);
+    exit();
+  }
+
+  if(sched_setaffinity(0, all) < 0){
+    printf(1, "sched_setaffinity failed\n");
+    exit();
+  }
+  printf(1, "affinity test ok\n");
+}
+
+// Total CPU time of the processes in pids, in milliseconds.
+uint
+runtimeof(int *pids, int n)
+{
+  struct procinfo pi;
+  uint ms;
+  int i;
+
+  ms = 0;
+  for(i = 0; i < n; i++){
+    if(procinfo(pids[i], &pi) < 0 || pi.group != 1){
+      printf(1, "procinfo failed\n");
+      exit();
+    }
+    ms += pi.runtime_ms;
+  }
+  return ms;
+}
+
+// A group given 20 ms of CPU time per 100 ms is throttled every
+// period, and its two spinning members, which may run on two CPUs,
+// get little more than the quota between them; lifting the quota
+// lets them run freely again.
+void
+quotatest(void)
+{
+  struct groupinfo gi;
+  uint before, ran;
+  int i, pids[2];
+
+  printf(1, "quota test\n");
+  if(setquota(0, 20000, 100000) >= 0 || setquota(1, 1000, 0) >= 0 ||
+     setgroup(0, NGROUP) >= 0){
+    printf(1, "bad quota accepted\n");
+    exit();
+  }
+  if(setquota(1, 20000, 100000) < 0){
+    printf(1, "setquota failed\n");
+    exit();
+  }
+  for(i = 0; i < 2; i++){
+    pids[i] = fork();
+    if(pids[i] < 0){
+      printf(1, "fork failed\n");
+      exit();
+    }
+    if(pids[i] == 0){
+      setgroup(0, 1);
+      for(;;)
+        ;
+    }
+  }
+  sleep(20);
+  before = runtimeof(pids, 2);
+  sleep(100);
+  ran = runtimeof(pids, 2) - before;
+  if(groupinfo(1, &gi) < 0){
+    printf(1, "groupinfo failed\n");
+    exit();
+  }
+  // 10 periods of 20 ms, plus one partly in the window.
+  if(gi.nproc != 2 || gi.nthrottled < 5 || gi.throttled_ms < 300 ||
+     ran < 100 || ran > 250){
+    printf(1, "not throttled: nproc %d throttled %d times for %d ms, "
+           "ran %d ms\n", gi.nproc, gi.nthrottled, gi.throttled_ms, ran);
+    exit();
+  }
+
+  setquota(1, 0, 0);
+  before = runtimeof(pids, 2);
+  sleep(50);
+  ran = runtimeof(pids, 2) - before;
+  if(groupinfo(1, &gi) < 0 || gi.throttled || ran < 200){
+    printf(1, "not unthrottled: ran %d ms\n", ran);
+    exit();
+  }
+  for(i = 0; i < 2; i++){
+    kill(pids[i]);
+    wait();
+  }
+  printf(1, "quota test ok\n");
+}
+
 void
 mem(void)
 {
@@ -1783,6 +2164,12 @@ main(int argc, char *argv[])
   pipe1();
   preempt();
   exitwait();
+  sysctltest();
+  telemetrytest();
+  sleeptest();
+  affinitytest();
+  quotatest();
+  dutytest();
 
   rmdot();
   fourteen();
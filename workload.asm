@@ -0,0 +1,1859 @@
+
+_workload:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+    ;
+}
+
+int
+main(int argc, char *argv[])
+{
+   0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+   4:	83 e4 f0             	and    $0xfffffff0,%esp
+   7:	ff 71 fc             	push   -0x4(%ecx)
+   a:	55                   	push   %ebp
+   b:	89 e5                	mov    %esp,%ebp
+   d:	57                   	push   %edi
+   e:	56                   	push   %esi
+   f:	53                   	push   %ebx
+  10:	bb 01 00 00 00       	mov    $0x1,%ebx
+  15:	51                   	push   %ecx
+  16:	83 ec 58             	sub    $0x58,%esp
+  19:	8b 01                	mov    (%ecx),%eax
+  1b:	8b 79 04             	mov    0x4(%ecx),%edi
+  int i, fd;
+  char *desc, *out;
+
+  desc = out = 0;
+  1e:	c7 45 a8 00 00 00 00 	movl   $0x0,-0x58(%ebp)
+  25:	c7 45 ac 00 00 00 00 	movl   $0x0,-0x54(%ebp)
+{
+  2c:	89 45 b0             	mov    %eax,-0x50(%ebp)
+  2f:	89 7d b4             	mov    %edi,-0x4c(%ebp)
+  for(i = 1; i < argc; i++){
+  32:	83 f8 01             	cmp    $0x1,%eax
+  35:	0f 8e 11 04 00 00    	jle    44c <main+0x44c>
+  3b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  3f:	90                   	nop
+    if(strcmp(argv[i], "-o") == 0 && i + 1 < argc)
+  40:	8b 45 b4             	mov    -0x4c(%ebp),%eax
+  43:	8d 3c 9d 00 00 00 00 	lea    0x0(,%ebx,4),%edi
+  4a:	83 ec 08             	sub    $0x8,%esp
+  4d:	68 f0 0e 00 00       	push   $0xef0
+  52:	8d 34 38             	lea    (%eax,%edi,1),%esi
+  55:	ff 36                	push   (%esi)
+  57:	e8 a4 06 00 00       	call   700 <strcmp>
+  5c:	8d 4b 01             	lea    0x1(%ebx),%ecx
+  5f:	83 c4 10             	add    $0x10,%esp
+  62:	85 c0                	test   %eax,%eax
+  64:	0f 85 c6 03 00 00    	jne    430 <main+0x430>
+  6a:	39 4d b0             	cmp    %ecx,-0x50(%ebp)
+  6d:	0f 8e c9 03 00 00    	jle    43c <main+0x43c>
+      out = argv[++i];
+  73:	8b 45 b4             	mov    -0x4c(%ebp),%eax
+  for(i = 1; i < argc; i++){
+  76:	83 c3 02             	add    $0x2,%ebx
+      out = argv[++i];
+  79:	8b 44 38 04          	mov    0x4(%eax,%edi,1),%eax
+  7d:	89 45 a8             	mov    %eax,-0x58(%ebp)
+  for(i = 1; i < argc; i++){
+  80:	39 5d b0             	cmp    %ebx,-0x50(%ebp)
+  83:	7f bb                	jg     40 <main+0x40>
+    else
+      desc = argv[i];
+  }
+  if(desc == 0){
+  85:	8b 45 ac             	mov    -0x54(%ebp),%eax
+  88:	85 c0                	test   %eax,%eax
+  8a:	0f 84 bc 03 00 00    	je     44c <main+0x44c>
+  if((fd = open(path, O_RDONLY)) < 0){
+  90:	83 ec 08             	sub    $0x8,%esp
+  93:	6a 00                	push   $0x0
+  95:	50                   	push   %eax
+  96:	e8 b8 08 00 00       	call   953 <open>
+  9b:	83 c4 10             	add    $0x10,%esp
+  9e:	89 c3                	mov    %eax,%ebx
+  a0:	85 c0                	test   %eax,%eax
+  a2:	0f 88 e0 05 00 00    	js     688 <main+0x688>
+  n = read(fd, buf, sizeof(buf) - 1);
+  a8:	83 ec 04             	sub    $0x4,%esp
+  ab:	68 ff 0f 00 00       	push   $0xfff
+  b0:	68 20 19 00 00       	push   $0x1920
+  b5:	50                   	push   %eax
+  b6:	e8 70 08 00 00       	call   92b <read>
+  close(fd);
+  bb:	89 1c 24             	mov    %ebx,(%esp)
+  n = read(fd, buf, sizeof(buf) - 1);
+  be:	89 c6                	mov    %eax,%esi
+  close(fd);
+  c0:	e8 76 08 00 00       	call   93b <close>
+  if(n < 0){
+  c5:	83 c4 10             	add    $0x10,%esp
+  c8:	85 f6                	test   %esi,%esi
+  ca:	0f 88 d0 05 00 00    	js     6a0 <main+0x6a0>
+  buf[n] = 0;
+  d0:	c6 86 20 19 00 00 00 	movb   $0x0,0x1920(%esi)
+  for(line = buf; *line; line = p){
+  d7:	80 3d 20 19 00 00 00 	cmpb   $0x0,0x1920
+  de:	0f 84 8f 01 00 00    	je     273 <main+0x273>
+  lineno = 0;
+  e4:	31 ff                	xor    %edi,%edi
+  for(line = buf; *line; line = p){
+  e6:	bb 20 19 00 00       	mov    $0x1920,%ebx
+  eb:	89 7d b0             	mov    %edi,-0x50(%ebp)
+  ee:	66 90                	xchg   %ax,%ax
+    p = strchr(line, '\n');
+  f0:	83 ec 08             	sub    $0x8,%esp
+    lineno++;
+  f3:	83 45 b0 01          	addl   $0x1,-0x50(%ebp)
+    p = strchr(line, '\n');
+  f7:	6a 0a                	push   $0xa
+  f9:	53                   	push   %ebx
+  fa:	e8 b1 06 00 00       	call   7b0 <strchr>
+    if(p)
+  ff:	83 c4 10             	add    $0x10,%esp
+ 102:	85 c0                	test   %eax,%eax
+ 104:	0f 84 55 03 00 00    	je     45f <main+0x45f>
+      *p++ = 0;
+ 10a:	c6 00 00             	movb   $0x0,(%eax)
+ 10d:	8d 70 01             	lea    0x1(%eax),%esi
+  for(i = 0; i < 5; i++)
+ 110:	31 c9                	xor    %ecx,%ecx
+  while(*p == ' ' || *p == '\t')
+ 112:	0f b6 03             	movzbl (%ebx),%eax
+ 115:	3c 20                	cmp    $0x20,%al
+ 117:	75 12                	jne    12b <main+0x12b>
+ 119:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 120:	0f b6 43 01          	movzbl 0x1(%ebx),%eax
+    p++;
+ 124:	83 c3 01             	add    $0x1,%ebx
+  while(*p == ' ' || *p == '\t')
+ 127:	3c 20                	cmp    $0x20,%al
+ 129:	74 f5                	je     120 <main+0x120>
+ 12b:	3c 09                	cmp    $0x9,%al
+ 12d:	74 f1                	je     120 <main+0x120>
+  if(*p == 0 || *p == '\n'){
+ 12f:	84 c0                	test   %al,%al
+ 131:	0f 84 d9 02 00 00    	je     410 <main+0x410>
+ 137:	3c 0a                	cmp    $0xa,%al
+ 139:	0f 84 d1 02 00 00    	je     410 <main+0x410>
+  while(*p && *p != ' ' && *p != '\t' && *p != '\n')
+ 13f:	0f b6 03             	movzbl (%ebx),%eax
+ 142:	89 da                	mov    %ebx,%edx
+ 144:	88 45 b4             	mov    %al,-0x4c(%ebp)
+ 147:	a8 df                	test   $0xdf,%al
+ 149:	74 40                	je     18b <main+0x18b>
+ 14b:	0f b6 45 b4          	movzbl -0x4c(%ebp),%eax
+ 14f:	eb 16                	jmp    167 <main+0x167>
+ 151:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 158:	3c 0a                	cmp    $0xa,%al
+ 15a:	74 15                	je     171 <main+0x171>
+ 15c:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+    p++;
+ 160:	83 c2 01             	add    $0x1,%edx
+  while(*p && *p != ' ' && *p != '\t' && *p != '\n')
+ 163:	a8 df                	test   $0xdf,%al
+ 165:	74 21                	je     188 <main+0x188>
+ 167:	3c 09                	cmp    $0x9,%al
+ 169:	75 ed                	jne    158 <main+0x158>
+    *p++ = 0;
+ 16b:	c6 02 00             	movb   $0x0,(%edx)
+ 16e:	83 c2 01             	add    $0x1,%edx
+ 171:	89 5c 8d b8          	mov    %ebx,-0x48(%ebp,%ecx,4)
+  for(i = 0; i < 5; i++)
+ 175:	83 c1 01             	add    $0x1,%ecx
+ 178:	83 f9 05             	cmp    $0x5,%ecx
+ 17b:	74 33                	je     1b0 <main+0x1b0>
+ 17d:	89 d3                	mov    %edx,%ebx
+ 17f:	eb 91                	jmp    112 <main+0x112>
+ 181:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  while(*p && *p != ' ' && *p != '\t' && *p != '\n')
+ 188:	88 45 b4             	mov    %al,-0x4c(%ebp)
+ 18b:	84 c0                	test   %al,%al
+ 18d:	0f 95 c0             	setne  %al
+  if(*p && *p != '\n')
+ 190:	80 7d b4 0a          	cmpb   $0xa,-0x4c(%ebp)
+  while(*p && *p != ' ' && *p != '\t' && *p != '\n')
+ 194:	89 c7                	mov    %eax,%edi
+  if(*p && *p != '\n')
+ 196:	0f 95 c0             	setne  %al
+ 199:	21 f8                	and    %edi,%eax
+ 19b:	84 c0                	test   %al,%al
+ 19d:	75 cc                	jne    16b <main+0x16b>
+ 19f:	89 5c 8d b8          	mov    %ebx,-0x48(%ebp,%ecx,4)
+  for(i = 0; i < 5; i++)
+ 1a3:	83 c1 01             	add    $0x1,%ecx
+ 1a6:	83 f9 05             	cmp    $0x5,%ecx
+ 1a9:	75 d2                	jne    17d <main+0x17d>
+ 1ab:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 1af:	90                   	nop
+  if(i == 0 || w[0][0] == '#')
+ 1b0:	8b 45 b8             	mov    -0x48(%ebp),%eax
+ 1b3:	80 38 23             	cmpb   $0x23,(%eax)
+ 1b6:	0f 84 60 02 00 00    	je     41c <main+0x41c>
+  if(nphase == MAXPHASES){
+ 1bc:	8b 1d 04 15 00 00    	mov    0x1504,%ebx
+ 1c2:	83 fb 20             	cmp    $0x20,%ebx
+ 1c5:	0f 84 a6 04 00 00    	je     671 <main+0x671>
+  ph = &phases[nphase++];
+ 1cb:	8d 53 01             	lea    0x1(%ebx),%edx
+  memmove(ph->name, w[0], sizeof(ph->name) - 1);
+ 1ce:	c1 e3 05             	shl    $0x5,%ebx
+ 1d1:	83 ec 04             	sub    $0x4,%esp
+ 1d4:	81 c3 20 15 00 00    	add    $0x1520,%ebx
+ 1da:	6a 0f                	push   $0xf
+ 1dc:	50                   	push   %eax
+ 1dd:	53                   	push   %ebx
+  ph = &phases[nphase++];
+ 1de:	89 15 04 15 00 00    	mov    %edx,0x1504
+  memmove(ph->name, w[0], sizeof(ph->name) - 1);
+ 1e4:	e8 f7 06 00 00       	call   8e0 <memmove>
+  ph->name[sizeof(ph->name) - 1] = 0;
+ 1e9:	c6 43 0f 00          	movb   $0x0,0xf(%ebx)
+  ph->duty = clamp(atoi(w[1]), 0, 100);
+ 1ed:	58                   	pop    %eax
+ 1ee:	ff 75 bc             	push   -0x44(%ebp)
+ 1f1:	e8 aa 06 00 00       	call   8a0 <atoi>
+ 1f6:	ba 64 00 00 00       	mov    $0x64,%edx
+ 1fb:	39 d0                	cmp    %edx,%eax
+ 1fd:	0f 4f c2             	cmovg  %edx,%eax
+ 200:	31 d2                	xor    %edx,%edx
+ 202:	85 c0                	test   %eax,%eax
+ 204:	0f 48 c2             	cmovs  %edx,%eax
+ 207:	89 43 10             	mov    %eax,0x10(%ebx)
+  ph->nproc = clamp(atoi(w[2]), 1, MAXWORKERS);
+ 20a:	58                   	pop    %eax
+ 20b:	ff 75 c0             	push   -0x40(%ebp)
+ 20e:	e8 8d 06 00 00       	call   8a0 <atoi>
+ 213:	ba 10 00 00 00       	mov    $0x10,%edx
+ 218:	39 d0                	cmp    %edx,%eax
+ 21a:	0f 4f c2             	cmovg  %edx,%eax
+ 21d:	ba 01 00 00 00       	mov    $0x1,%edx
+ 222:	85 c0                	test   %eax,%eax
+ 224:	0f 4e c2             	cmovle %edx,%eax
+ 227:	89 43 14             	mov    %eax,0x14(%ebx)
+  ph->io = clamp(atoi(w[3]), 0, 100);
+ 22a:	58                   	pop    %eax
+ 22b:	ff 75 c4             	push   -0x3c(%ebp)
+ 22e:	e8 6d 06 00 00       	call   8a0 <atoi>
+ 233:	ba 64 00 00 00       	mov    $0x64,%edx
+ 238:	39 d0                	cmp    %edx,%eax
+ 23a:	0f 4f c2             	cmovg  %edx,%eax
+ 23d:	31 d2                	xor    %edx,%edx
+ 23f:	85 c0                	test   %eax,%eax
+ 241:	0f 48 c2             	cmovs  %edx,%eax
+ 244:	89 43 18             	mov    %eax,0x18(%ebx)
+  ph->seconds = clamp(atoi(w[4]), 1, 3600);
+ 247:	58                   	pop    %eax
+ 248:	ff 75 c8             	push   -0x38(%ebp)
+ 24b:	e8 50 06 00 00       	call   8a0 <atoi>
+ 250:	ba 10 0e 00 00       	mov    $0xe10,%edx
+ 255:	39 d0                	cmp    %edx,%eax
+ 257:	0f 4f c2             	cmovg  %edx,%eax
+ 25a:	ba 01 00 00 00       	mov    $0x1,%edx
+ 25f:	85 c0                	test   %eax,%eax
+ 261:	0f 4e c2             	cmovle %edx,%eax
+  return 0;
+ 264:	83 c4 10             	add    $0x10,%esp
+  ph->seconds = clamp(atoi(w[4]), 1, 3600);
+ 267:	89 43 1c             	mov    %eax,0x1c(%ebx)
+  for(line = buf; *line; line = p){
+ 26a:	80 3e 00             	cmpb   $0x0,(%esi)
+ 26d:	0f 85 b2 01 00 00    	jne    425 <main+0x425>
+    printf(2, "usage: workload [-o outfile] file\n");
+    exit();
+  }
+  if(readdesc(desc) < 0)
+    exit();
+  if(nphase == 0){
+ 273:	83 3d 04 15 00 00 00 	cmpl   $0x0,0x1504
+ 27a:	0f 84 14 02 00 00    	je     494 <main+0x494>
+    printf(2, "workload: no phases in %s\n", desc);
+    exit();
+  }
+
+  fd = 1;
+  if(out){
+ 280:	8b 7d a8             	mov    -0x58(%ebp),%edi
+ 283:	85 ff                	test   %edi,%edi
+ 285:	0f 84 83 02 00 00    	je     50e <main+0x50e>
+    unlink(out);
+ 28b:	83 ec 0c             	sub    $0xc,%esp
+ 28e:	57                   	push   %edi
+ 28f:	e8 cf 06 00 00       	call   963 <unlink>
+    if((fd = open(out, O_CREATE | O_WRONLY)) < 0){
+ 294:	5b                   	pop    %ebx
+ 295:	5e                   	pop    %esi
+ 296:	68 01 02 00 00       	push   $0x201
+ 29b:	57                   	push   %edi
+ 29c:	e8 b2 06 00 00       	call   953 <open>
+ 2a1:	83 c4 10             	add    $0x10,%esp
+ 2a4:	89 45 b0             	mov    %eax,-0x50(%ebp)
+ 2a7:	85 c0                	test   %eax,%eax
+ 2a9:	0f 88 fa 01 00 00    	js     4a9 <main+0x4a9>
+      printf(2, "workload: cannot create %s\n", out);
+      exit();
+    }
+  }
+
+  memset(iobuf, 'w', sizeof(iobuf));
+ 2af:	50                   	push   %eax
+ 2b0:	68 00 02 00 00       	push   $0x200
+ 2b5:	6a 77                	push   $0x77
+ 2b7:	68 00 13 00 00       	push   $0x1300
+ 2bc:	e8 cf 04 00 00       	call   790 <memset>
+
+  printf(fd, "phase,tick,load,predicted,freq,temp,thresh_low_med,thresh_med_high\n");
+ 2c1:	58                   	pop    %eax
+ 2c2:	5a                   	pop    %edx
+ 2c3:	68 74 0e 00 00       	push   $0xe74
+ 2c8:	ff 75 b0             	push   -0x50(%ebp)
+ 2cb:	e8 00 08 00 00       	call   ad0 <printf>
+  for(i = 0; i < nphase; i++)
+ 2d0:	83 c4 10             	add    $0x10,%esp
+ 2d3:	83 3d 04 15 00 00 00 	cmpl   $0x0,0x1504
+ 2da:	0f 8e 13 02 00 00    	jle    4f3 <main+0x4f3>
+ 2e0:	be 20 15 00 00       	mov    $0x1520,%esi
+ 2e5:	31 ff                	xor    %edi,%edi
+ 2e7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 2ee:	66 90                	xchg   %ax,%ax
+  printf(2, "workload: phase %s: duty %d%% nproc %d io %d%% for %ds\n",
+ 2f0:	83 ec 04             	sub    $0x4,%esp
+ 2f3:	ff 76 1c             	push   0x1c(%esi)
+  for(i = 0; i < ph->nproc; i++){
+ 2f6:	31 db                	xor    %ebx,%ebx
+  printf(2, "workload: phase %s: duty %d%% nproc %d io %d%% for %ds\n",
+ 2f8:	ff 76 18             	push   0x18(%esi)
+ 2fb:	ff 76 14             	push   0x14(%esi)
+ 2fe:	ff 76 10             	push   0x10(%esi)
+ 301:	56                   	push   %esi
+ 302:	68 b8 0e 00 00       	push   $0xeb8
+ 307:	6a 02                	push   $0x2
+ 309:	e8 c2 07 00 00       	call   ad0 <printf>
+  end = uptime() + ph->seconds * 100;
+ 30e:	83 c4 20             	add    $0x20,%esp
+ 311:	e8 95 06 00 00       	call   9ab <uptime>
+ 316:	6b 56 1c 64          	imul   $0x64,0x1c(%esi),%edx
+ 31a:	01 d0                	add    %edx,%eax
+ 31c:	89 45 b4             	mov    %eax,-0x4c(%ebp)
+  for(i = 0; i < ph->nproc; i++){
+ 31f:	8b 46 14             	mov    0x14(%esi),%eax
+ 322:	85 c0                	test   %eax,%eax
+ 324:	7f 18                	jg     33e <main+0x33e>
+ 326:	eb 31                	jmp    359 <main+0x359>
+ 328:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 32f:	90                   	nop
+    if(pid == 0)
+ 330:	0f 84 14 02 00 00    	je     54a <main+0x54a>
+  for(i = 0; i < ph->nproc; i++){
+ 336:	83 c3 01             	add    $0x1,%ebx
+ 339:	3b 5e 14             	cmp    0x14(%esi),%ebx
+ 33c:	7d 1b                	jge    359 <main+0x359>
+    pid = fork();
+ 33e:	e8 c8 05 00 00       	call   90b <fork>
+    if(pid < 0){
+ 343:	85 c0                	test   %eax,%eax
+ 345:	79 e9                	jns    330 <main+0x330>
+      printf(2, "workload: fork failed\n");
+ 347:	83 ec 08             	sub    $0x8,%esp
+ 34a:	68 5e 0f 00 00       	push   $0xf5e
+ 34f:	6a 02                	push   $0x2
+ 351:	e8 7a 07 00 00       	call   ad0 <printf>
+      break;
+ 356:	83 c4 10             	add    $0x10,%esp
+    printf(fd, "%s,%d,%d,%d,%s,%d.%d,%d,%d\n", ph->name, st.tick,
+ 359:	89 7d ac             	mov    %edi,-0x54(%ebp)
+ 35c:	8d 5d b8             	lea    -0x48(%ebp),%ebx
+ 35f:	eb 68                	jmp    3c9 <main+0x3c9>
+ 361:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    fl = st.frequency_level;
+ 368:	8b 7d cc             	mov    -0x34(%ebp),%edi
+           st.temp % 10, st.thresh_low_med, st.thresh_med_high);
+ 36b:	8b 4d d0             	mov    -0x30(%ebp),%ecx
+      fl = 1;
+ 36e:	b8 01 00 00 00       	mov    $0x1,%eax
+ 373:	83 ff 03             	cmp    $0x3,%edi
+ 376:	0f 43 f8             	cmovae %eax,%edi
+    printf(fd, "%s,%d,%d,%d,%s,%d.%d,%d,%d\n", ph->name, st.tick,
+ 379:	b8 67 66 66 66       	mov    $0x66666667,%eax
+ 37e:	83 ec 04             	sub    $0x4,%esp
+ 381:	ff 75 d8             	push   -0x28(%ebp)
+ 384:	f7 e9                	imul   %ecx
+ 386:	89 c8                	mov    %ecx,%eax
+ 388:	ff 75 d4             	push   -0x2c(%ebp)
+ 38b:	c1 f8 1f             	sar    $0x1f,%eax
+ 38e:	c1 fa 02             	sar    $0x2,%edx
+ 391:	29 c2                	sub    %eax,%edx
+ 393:	8d 04 92             	lea    (%edx,%edx,4),%eax
+ 396:	01 c0                	add    %eax,%eax
+ 398:	29 c1                	sub    %eax,%ecx
+ 39a:	51                   	push   %ecx
+ 39b:	52                   	push   %edx
+ 39c:	ff 34 bd e8 12 00 00 	push   0x12e8(,%edi,4)
+ 3a3:	ff 75 c8             	push   -0x38(%ebp)
+ 3a6:	ff 75 c4             	push   -0x3c(%ebp)
+ 3a9:	ff 75 c0             	push   -0x40(%ebp)
+ 3ac:	56                   	push   %esi
+ 3ad:	68 af 0f 00 00       	push   $0xfaf
+ 3b2:	ff 75 b0             	push   -0x50(%ebp)
+ 3b5:	e8 16 07 00 00       	call   ad0 <printf>
+  } while(st.tick < end);
+ 3ba:	8b 45 b4             	mov    -0x4c(%ebp),%eax
+ 3bd:	83 c4 30             	add    $0x30,%esp
+ 3c0:	39 45 c0             	cmp    %eax,-0x40(%ebp)
+ 3c3:	0f 83 40 01 00 00    	jae    509 <main+0x509>
+    if(telemetry(&seq, &st, 1) != 1){
+ 3c9:	83 ec 04             	sub    $0x4,%esp
+ 3cc:	6a 01                	push   $0x1
+ 3ce:	53                   	push   %ebx
+ 3cf:	68 00 15 00 00       	push   $0x1500
+ 3d4:	e8 0a 06 00 00       	call   9e3 <telemetry>
+ 3d9:	83 c4 10             	add    $0x10,%esp
+ 3dc:	83 f8 01             	cmp    $0x1,%eax
+ 3df:	0f 85 db 00 00 00    	jne    4c0 <main+0x4c0>
+    if(st.dropped)
+ 3e5:	8b 45 bc             	mov    -0x44(%ebp),%eax
+ 3e8:	85 c0                	test   %eax,%eax
+ 3ea:	0f 84 78 ff ff ff    	je     368 <main+0x368>
+      printf(2, "workload: %d samples dropped\n", st.dropped);
+ 3f0:	83 ec 04             	sub    $0x4,%esp
+ 3f3:	50                   	push   %eax
+ 3f4:	68 91 0f 00 00       	push   $0xf91
+ 3f9:	6a 02                	push   $0x2
+ 3fb:	e8 d0 06 00 00       	call   ad0 <printf>
+ 400:	83 c4 10             	add    $0x10,%esp
+ 403:	e9 60 ff ff ff       	jmp    368 <main+0x368>
+ 408:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 40f:	90                   	nop
+    if((w[i] = nextword(&p)) == 0)
+ 410:	c7 44 8d b8 00 00 00 	movl   $0x0,-0x48(%ebp,%ecx,4)
+ 417:	00 
+  if(i == 0 || w[0][0] == '#')
+ 418:	85 c9                	test   %ecx,%ecx
+ 41a:	75 57                	jne    473 <main+0x473>
+  for(line = buf; *line; line = p){
+ 41c:	80 3e 00             	cmpb   $0x0,(%esi)
+ 41f:	0f 84 4e fe ff ff    	je     273 <main+0x273>
+ 425:	89 f3                	mov    %esi,%ebx
+ 427:	e9 c4 fc ff ff       	jmp    f0 <main+0xf0>
+ 42c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+      desc = argv[i];
+ 430:	8b 06                	mov    (%esi),%eax
+ 432:	89 cb                	mov    %ecx,%ebx
+ 434:	89 45 ac             	mov    %eax,-0x54(%ebp)
+ 437:	e9 44 fc ff ff       	jmp    80 <main+0x80>
+ 43c:	8b 06                	mov    (%esi),%eax
+ 43e:	89 45 ac             	mov    %eax,-0x54(%ebp)
+  if(desc == 0){
+ 441:	8b 45 ac             	mov    -0x54(%ebp),%eax
+ 444:	85 c0                	test   %eax,%eax
+ 446:	0f 85 44 fc ff ff    	jne    90 <main+0x90>
+    printf(2, "usage: workload [-o outfile] file\n");
+ 44c:	56                   	push   %esi
+ 44d:	56                   	push   %esi
+ 44e:	68 f8 0d 00 00       	push   $0xdf8
+ 453:	6a 02                	push   $0x2
+ 455:	e8 76 06 00 00       	call   ad0 <printf>
+    exit();
+ 45a:	e8 b4 04 00 00       	call   913 <exit>
+      p = line + strlen(line);
+ 45f:	83 ec 0c             	sub    $0xc,%esp
+ 462:	53                   	push   %ebx
+ 463:	e8 f8 02 00 00       	call   760 <strlen>
+ 468:	83 c4 10             	add    $0x10,%esp
+ 46b:	8d 34 03             	lea    (%ebx,%eax,1),%esi
+ 46e:	e9 9d fc ff ff       	jmp    110 <main+0x110>
+  if(i == 0 || w[0][0] == '#')
+ 473:	8b 45 b8             	mov    -0x48(%ebp),%eax
+ 476:	80 38 23             	cmpb   $0x23,(%eax)
+ 479:	74 a1                	je     41c <main+0x41c>
+    printf(2, "workload: line %d: want name duty nproc io seconds\n", lineno);
+ 47b:	8b 7d b0             	mov    -0x50(%ebp),%edi
+ 47e:	52                   	push   %edx
+ 47f:	57                   	push   %edi
+ 480:	68 1c 0e 00 00       	push   $0xe1c
+ 485:	6a 02                	push   $0x2
+ 487:	e8 44 06 00 00       	call   ad0 <printf>
+    return -1;
+ 48c:	83 c4 10             	add    $0x10,%esp
+    exit();
+ 48f:	e8 7f 04 00 00       	call   913 <exit>
+    printf(2, "workload: no phases in %s\n", desc);
+ 494:	57                   	push   %edi
+ 495:	ff 75 ac             	push   -0x54(%ebp)
+ 498:	68 27 0f 00 00       	push   $0xf27
+ 49d:	6a 02                	push   $0x2
+ 49f:	e8 2c 06 00 00       	call   ad0 <printf>
+    exit();
+ 4a4:	e8 6a 04 00 00       	call   913 <exit>
+      printf(2, "workload: cannot create %s\n", out);
+ 4a9:	51                   	push   %ecx
+ 4aa:	ff 75 a8             	push   -0x58(%ebp)
+ 4ad:	68 42 0f 00 00       	push   $0xf42
+ 4b2:	6a 02                	push   $0x2
+ 4b4:	e8 17 06 00 00       	call   ad0 <printf>
+      exit();
+ 4b9:	e8 55 04 00 00       	call   913 <exit>
+ 4be:	66 90                	xchg   %ax,%ax
+      printf(2, "workload: telemetry failed\n");
+ 4c0:	83 ec 08             	sub    $0x8,%esp
+ 4c3:	8b 7d ac             	mov    -0x54(%ebp),%edi
+ 4c6:	68 75 0f 00 00       	push   $0xf75
+ 4cb:	6a 02                	push   $0x2
+ 4cd:	e8 fe 05 00 00       	call   ad0 <printf>
+ 4d2:	83 c4 10             	add    $0x10,%esp
+ 4d5:	8d 76 00             	lea    0x0(%esi),%esi
+  while(wait() >= 0)
+ 4d8:	e8 3e 04 00 00       	call   91b <wait>
+ 4dd:	85 c0                	test   %eax,%eax
+ 4df:	79 f7                	jns    4d8 <main+0x4d8>
+  for(i = 0; i < nphase; i++)
+ 4e1:	83 c7 01             	add    $0x1,%edi
+ 4e4:	83 c6 20             	add    $0x20,%esi
+ 4e7:	39 3d 04 15 00 00    	cmp    %edi,0x1504
+ 4ed:	0f 8f fd fd ff ff    	jg     2f0 <main+0x2f0>
+    runphase(fd, &phases[i]);
+
+  if(fd != 1)
+ 4f3:	83 7d b0 01          	cmpl   $0x1,-0x50(%ebp)
+ 4f7:	74 96                	je     48f <main+0x48f>
+    close(fd);
+ 4f9:	83 ec 0c             	sub    $0xc,%esp
+ 4fc:	ff 75 b0             	push   -0x50(%ebp)
+ 4ff:	e8 37 04 00 00       	call   93b <close>
+ 504:	83 c4 10             	add    $0x10,%esp
+ 507:	eb 86                	jmp    48f <main+0x48f>
+ 509:	8b 7d ac             	mov    -0x54(%ebp),%edi
+ 50c:	eb ca                	jmp    4d8 <main+0x4d8>
+  memset(iobuf, 'w', sizeof(iobuf));
+ 50e:	50                   	push   %eax
+ 50f:	68 00 02 00 00       	push   $0x200
+ 514:	6a 77                	push   $0x77
+ 516:	68 00 13 00 00       	push   $0x1300
+ 51b:	e8 70 02 00 00       	call   790 <memset>
+  printf(fd, "phase,tick,load,predicted,freq,temp,thresh_low_med,thresh_med_high\n");
+ 520:	5a                   	pop    %edx
+ 521:	59                   	pop    %ecx
+ 522:	68 74 0e 00 00       	push   $0xe74
+ 527:	6a 01                	push   $0x1
+ 529:	e8 a2 05 00 00       	call   ad0 <printf>
+  for(i = 0; i < nphase; i++)
+ 52e:	83 c4 10             	add    $0x10,%esp
+ 531:	83 3d 04 15 00 00 00 	cmpl   $0x0,0x1504
+  fd = 1;
+ 538:	c7 45 b0 01 00 00 00 	movl   $0x1,-0x50(%ebp)
+  for(i = 0; i < nphase; i++)
+ 53f:	0f 8f 9b fd ff ff    	jg     2e0 <main+0x2e0>
+ 545:	e9 45 ff ff ff       	jmp    48f <main+0x48f>
+  char path[] = "wl.io.a";
+ 54a:	8b 46 10             	mov    0x10(%esi),%eax
+  busy = ph->duty * SLOT / 100;
+ 54d:	b9 05 00 00 00       	mov    $0x5,%ecx
+  path[6] = 'a' + id;
+ 552:	83 c3 61             	add    $0x61,%ebx
+  char path[] = "wl.io.a";
+ 555:	c7 45 bc 6f 2e 61 00 	movl   $0x612e6f,-0x44(%ebp)
+  path[6] = 'a' + id;
+ 55c:	88 5d be             	mov    %bl,-0x42(%ebp)
+  busy = ph->duty * SLOT / 100;
+ 55f:	99                   	cltd
+  char path[] = "wl.io.a";
+ 560:	c7 45 b8 77 6c 2e 69 	movl   $0x692e6c77,-0x48(%ebp)
+  busy = ph->duty * SLOT / 100;
+ 567:	f7 f9                	idiv   %ecx
+  io = busy * ph->io / 100;
+ 569:	b9 64 00 00 00       	mov    $0x64,%ecx
+  busy = ph->duty * SLOT / 100;
+ 56e:	89 45 b0             	mov    %eax,-0x50(%ebp)
+  io = busy * ph->io / 100;
+ 571:	0f af 46 18          	imul   0x18(%esi),%eax
+ 575:	99                   	cltd
+ 576:	89 c3                	mov    %eax,%ebx
+ 578:	f7 f9                	idiv   %ecx
+ 57a:	89 5d a4             	mov    %ebx,-0x5c(%ebp)
+ 57d:	89 45 a8             	mov    %eax,-0x58(%ebp)
+  while((now = uptime()) < end){
+ 580:	eb 12                	jmp    594 <main+0x594>
+    if(SLOT - busy > 0)
+ 582:	8b 7d b0             	mov    -0x50(%ebp),%edi
+ 585:	b8 14 00 00 00       	mov    $0x14,%eax
+ 58a:	29 f8                	sub    %edi,%eax
+ 58c:	85 c0                	test   %eax,%eax
+ 58e:	0f 8f 24 01 00 00    	jg     6b8 <main+0x6b8>
+  while((now = uptime()) < end){
+ 594:	e8 12 04 00 00       	call   9ab <uptime>
+ 599:	89 c6                	mov    %eax,%esi
+ 59b:	8b 45 b4             	mov    -0x4c(%ebp),%eax
+ 59e:	39 c6                	cmp    %eax,%esi
+ 5a0:	0f 83 ab 00 00 00    	jae    651 <main+0x651>
+    if(io > 0)
+ 5a6:	83 7d a4 63          	cmpl   $0x63,-0x5c(%ebp)
+ 5aa:	7f 18                	jg     5c4 <main+0x5c4>
+    if(busy - io > 0)
+ 5ac:	8b 7d a8             	mov    -0x58(%ebp),%edi
+ 5af:	39 7d b0             	cmp    %edi,-0x50(%ebp)
+ 5b2:	7e ce                	jle    582 <main+0x582>
+      spin(now + busy);
+ 5b4:	8b 45 b0             	mov    -0x50(%ebp),%eax
+ 5b7:	01 c6                	add    %eax,%esi
+  while(uptime() < end)
+ 5b9:	e8 ed 03 00 00       	call   9ab <uptime>
+ 5be:	39 f0                	cmp    %esi,%eax
+ 5c0:	72 f7                	jb     5b9 <main+0x5b9>
+ 5c2:	eb be                	jmp    582 <main+0x582>
+      doio(path, now + io);
+ 5c4:	8b 45 a8             	mov    -0x58(%ebp),%eax
+ 5c7:	89 75 ac             	mov    %esi,-0x54(%ebp)
+ 5ca:	8d 3c 30             	lea    (%eax,%esi,1),%edi
+  while(uptime() < end){
+ 5cd:	e8 d9 03 00 00       	call   9ab <uptime>
+ 5d2:	39 f8                	cmp    %edi,%eax
+ 5d4:	73 73                	jae    649 <main+0x649>
+    if((fd = open(path, O_CREATE | O_WRONLY)) < 0)
+ 5d6:	83 ec 08             	sub    $0x8,%esp
+ 5d9:	8d 45 b8             	lea    -0x48(%ebp),%eax
+ 5dc:	68 01 02 00 00       	push   $0x201
+ 5e1:	50                   	push   %eax
+ 5e2:	e8 6c 03 00 00       	call   953 <open>
+ 5e7:	83 c4 10             	add    $0x10,%esp
+ 5ea:	89 c6                	mov    %eax,%esi
+ 5ec:	85 c0                	test   %eax,%eax
+ 5ee:	78 59                	js     649 <main+0x649>
+    for(i = 0; i < IOBLOCKS && uptime() < end; i++)
+ 5f0:	31 db                	xor    %ebx,%ebx
+ 5f2:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+ 5f8:	e8 ae 03 00 00       	call   9ab <uptime>
+ 5fd:	39 f8                	cmp    %edi,%eax
+ 5ff:	73 33                	jae    634 <main+0x634>
+      if(write(fd, iobuf, sizeof(iobuf)) != sizeof(iobuf))
+ 601:	83 ec 04             	sub    $0x4,%esp
+ 604:	68 00 02 00 00       	push   $0x200
+ 609:	68 00 13 00 00       	push   $0x1300
+ 60e:	56                   	push   %esi
+ 60f:	e8 1f 03 00 00       	call   933 <write>
+ 614:	83 c4 10             	add    $0x10,%esp
+ 617:	3d 00 02 00 00       	cmp    $0x200,%eax
+ 61c:	75 16                	jne    634 <main+0x634>
+    for(i = 0; i < IOBLOCKS && uptime() < end; i++)
+ 61e:	83 c3 01             	add    $0x1,%ebx
+ 621:	83 fb 08             	cmp    $0x8,%ebx
+ 624:	75 d2                	jne    5f8 <main+0x5f8>
+    close(fd);
+ 626:	83 ec 0c             	sub    $0xc,%esp
+ 629:	56                   	push   %esi
+ 62a:	e8 0c 03 00 00       	call   93b <close>
+ 62f:	83 c4 10             	add    $0x10,%esp
+ 632:	eb 99                	jmp    5cd <main+0x5cd>
+ 634:	83 ec 0c             	sub    $0xc,%esp
+ 637:	56                   	push   %esi
+ 638:	e8 fe 02 00 00       	call   93b <close>
+    if(i < IOBLOCKS && uptime() < end)
+ 63d:	e8 69 03 00 00       	call   9ab <uptime>
+ 642:	83 c4 10             	add    $0x10,%esp
+ 645:	39 f8                	cmp    %edi,%eax
+ 647:	73 84                	jae    5cd <main+0x5cd>
+ 649:	8b 75 ac             	mov    -0x54(%ebp),%esi
+ 64c:	e9 5b ff ff ff       	jmp    5ac <main+0x5ac>
+  if(io > 0)
+ 651:	8b 5d a4             	mov    -0x5c(%ebp),%ebx
+ 654:	83 fb 63             	cmp    $0x63,%ebx
+ 657:	0f 8e 32 fe ff ff    	jle    48f <main+0x48f>
+    unlink(path);
+ 65d:	83 ec 0c             	sub    $0xc,%esp
+ 660:	8d 45 b8             	lea    -0x48(%ebp),%eax
+ 663:	50                   	push   %eax
+ 664:	e8 fa 02 00 00       	call   963 <unlink>
+ 669:	83 c4 10             	add    $0x10,%esp
+ 66c:	e9 1e fe ff ff       	jmp    48f <main+0x48f>
+    printf(2, "workload: too many phases (max %d)\n", MAXPHASES);
+ 671:	50                   	push   %eax
+ 672:	6a 20                	push   $0x20
+ 674:	68 50 0e 00 00       	push   $0xe50
+ 679:	6a 02                	push   $0x2
+ 67b:	e8 50 04 00 00       	call   ad0 <printf>
+    return -1;
+ 680:	83 c4 10             	add    $0x10,%esp
+ 683:	e9 07 fe ff ff       	jmp    48f <main+0x48f>
+    printf(2, "workload: cannot open %s\n", path);
+ 688:	53                   	push   %ebx
+ 689:	ff 75 ac             	push   -0x54(%ebp)
+ 68c:	68 f3 0e 00 00       	push   $0xef3
+ 691:	6a 02                	push   $0x2
+ 693:	e8 38 04 00 00       	call   ad0 <printf>
+ 698:	83 c4 10             	add    $0x10,%esp
+ 69b:	e9 ef fd ff ff       	jmp    48f <main+0x48f>
+    printf(2, "workload: cannot read %s\n", path);
+ 6a0:	51                   	push   %ecx
+ 6a1:	ff 75 ac             	push   -0x54(%ebp)
+ 6a4:	68 0d 0f 00 00       	push   $0xf0d
+ 6a9:	6a 02                	push   $0x2
+ 6ab:	e8 20 04 00 00       	call   ad0 <printf>
+ 6b0:	83 c4 10             	add    $0x10,%esp
+ 6b3:	e9 d7 fd ff ff       	jmp    48f <main+0x48f>
+      sleep(SLOT - busy);
+ 6b8:	83 ec 0c             	sub    $0xc,%esp
+ 6bb:	50                   	push   %eax
+ 6bc:	e8 e2 02 00 00       	call   9a3 <sleep>
+ 6c1:	83 c4 10             	add    $0x10,%esp
+ 6c4:	e9 cb fe ff ff       	jmp    594 <main+0x594>
+ 6c9:	66 90                	xchg   %ax,%ax
+ 6cb:	66 90                	xchg   %ax,%ax
+ 6cd:	66 90                	xchg   %ax,%ax
+ 6cf:	90                   	nop
+
+000006d0 <strcpy>:
+#include "user.h"
+#include "x86.h"
+
+char*
+strcpy(char *s, const char *t)
+{
+ 6d0:	55                   	push   %ebp
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+ 6d1:	31 c0                	xor    %eax,%eax
+{
+ 6d3:	89 e5                	mov    %esp,%ebp
+ 6d5:	53                   	push   %ebx
+ 6d6:	8b 4d 08             	mov    0x8(%ebp),%ecx
+ 6d9:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+ 6dc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  while((*s++ = *t++) != 0)
+ 6e0:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+ 6e4:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+ 6e7:	83 c0 01             	add    $0x1,%eax
+ 6ea:	84 d2                	test   %dl,%dl
+ 6ec:	75 f2                	jne    6e0 <strcpy+0x10>
+    ;
+  return os;
+}
+ 6ee:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 6f1:	89 c8                	mov    %ecx,%eax
+ 6f3:	c9                   	leave
+ 6f4:	c3                   	ret
+ 6f5:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 6fc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000700 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+ 700:	55                   	push   %ebp
+ 701:	89 e5                	mov    %esp,%ebp
+ 703:	53                   	push   %ebx
+ 704:	8b 55 08             	mov    0x8(%ebp),%edx
+ 707:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  while(*p && *p == *q)
+ 70a:	0f b6 02             	movzbl (%edx),%eax
+ 70d:	84 c0                	test   %al,%al
+ 70f:	75 17                	jne    728 <strcmp+0x28>
+ 711:	eb 3a                	jmp    74d <strcmp+0x4d>
+ 713:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 717:	90                   	nop
+ 718:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+    p++, q++;
+ 71c:	83 c2 01             	add    $0x1,%edx
+ 71f:	8d 59 01             	lea    0x1(%ecx),%ebx
+  while(*p && *p == *q)
+ 722:	84 c0                	test   %al,%al
+ 724:	74 1a                	je     740 <strcmp+0x40>
+    p++, q++;
+ 726:	89 d9                	mov    %ebx,%ecx
+  while(*p && *p == *q)
+ 728:	0f b6 19             	movzbl (%ecx),%ebx
+ 72b:	38 c3                	cmp    %al,%bl
+ 72d:	74 e9                	je     718 <strcmp+0x18>
+  return (uchar)*p - (uchar)*q;
+ 72f:	29 d8                	sub    %ebx,%eax
+}
+ 731:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 734:	c9                   	leave
+ 735:	c3                   	ret
+ 736:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 73d:	8d 76 00             	lea    0x0(%esi),%esi
+  return (uchar)*p - (uchar)*q;
+ 740:	0f b6 59 01          	movzbl 0x1(%ecx),%ebx
+ 744:	31 c0                	xor    %eax,%eax
+ 746:	29 d8                	sub    %ebx,%eax
+}
+ 748:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 74b:	c9                   	leave
+ 74c:	c3                   	ret
+  return (uchar)*p - (uchar)*q;
+ 74d:	0f b6 19             	movzbl (%ecx),%ebx
+ 750:	31 c0                	xor    %eax,%eax
+ 752:	eb db                	jmp    72f <strcmp+0x2f>
+ 754:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 75b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 75f:	90                   	nop
+
+00000760 <strlen>:
+
+uint
+strlen(const char *s)
+{
+ 760:	55                   	push   %ebp
+ 761:	89 e5                	mov    %esp,%ebp
+ 763:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for(n = 0; s[n]; n++)
+ 766:	80 3a 00             	cmpb   $0x0,(%edx)
+ 769:	74 15                	je     780 <strlen+0x20>
+ 76b:	31 c0                	xor    %eax,%eax
+ 76d:	8d 76 00             	lea    0x0(%esi),%esi
+ 770:	83 c0 01             	add    $0x1,%eax
+ 773:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+ 777:	89 c1                	mov    %eax,%ecx
+ 779:	75 f5                	jne    770 <strlen+0x10>
+    ;
+  return n;
+}
+ 77b:	89 c8                	mov    %ecx,%eax
+ 77d:	5d                   	pop    %ebp
+ 77e:	c3                   	ret
+ 77f:	90                   	nop
+  for(n = 0; s[n]; n++)
+ 780:	31 c9                	xor    %ecx,%ecx
+}
+ 782:	5d                   	pop    %ebp
+ 783:	89 c8                	mov    %ecx,%eax
+ 785:	c3                   	ret
+ 786:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 78d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000790 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+ 790:	55                   	push   %ebp
+ 791:	89 e5                	mov    %esp,%ebp
+ 793:	57                   	push   %edi
+ 794:	8b 55 08             	mov    0x8(%ebp),%edx
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosb" :
+ 797:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 79a:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 79d:	89 d7                	mov    %edx,%edi
+ 79f:	fc                   	cld
+ 7a0:	f3 aa                	rep stos %al,%es:(%edi)
+  stosb(dst, c, n);
+  return dst;
+}
+ 7a2:	8b 7d fc             	mov    -0x4(%ebp),%edi
+ 7a5:	89 d0                	mov    %edx,%eax
+ 7a7:	c9                   	leave
+ 7a8:	c3                   	ret
+ 7a9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+000007b0 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+ 7b0:	55                   	push   %ebp
+ 7b1:	89 e5                	mov    %esp,%ebp
+ 7b3:	8b 45 08             	mov    0x8(%ebp),%eax
+ 7b6:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+ 7ba:	0f b6 10             	movzbl (%eax),%edx
+ 7bd:	84 d2                	test   %dl,%dl
+ 7bf:	75 12                	jne    7d3 <strchr+0x23>
+ 7c1:	eb 1d                	jmp    7e0 <strchr+0x30>
+ 7c3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 7c7:	90                   	nop
+ 7c8:	0f b6 50 01          	movzbl 0x1(%eax),%edx
+ 7cc:	83 c0 01             	add    $0x1,%eax
+ 7cf:	84 d2                	test   %dl,%dl
+ 7d1:	74 0d                	je     7e0 <strchr+0x30>
+    if(*s == c)
+ 7d3:	38 d1                	cmp    %dl,%cl
+ 7d5:	75 f1                	jne    7c8 <strchr+0x18>
+      return (char*)s;
+  return 0;
+}
+ 7d7:	5d                   	pop    %ebp
+ 7d8:	c3                   	ret
+ 7d9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  return 0;
+ 7e0:	31 c0                	xor    %eax,%eax
+}
+ 7e2:	5d                   	pop    %ebp
+ 7e3:	c3                   	ret
+ 7e4:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 7eb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 7ef:	90                   	nop
+
+000007f0 <gets>:
+
+char*
+gets(char *buf, int max)
+{
+ 7f0:	55                   	push   %ebp
+ 7f1:	89 e5                	mov    %esp,%ebp
+ 7f3:	57                   	push   %edi
+ 7f4:	56                   	push   %esi
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+    cc = read(0, &c, 1);
+ 7f5:	8d 75 e7             	lea    -0x19(%ebp),%esi
+{
+ 7f8:	53                   	push   %ebx
+  for(i=0; i+1 < max; ){
+ 7f9:	31 db                	xor    %ebx,%ebx
+{
+ 7fb:	83 ec 1c             	sub    $0x1c,%esp
+  for(i=0; i+1 < max; ){
+ 7fe:	eb 27                	jmp    827 <gets+0x37>
+    cc = read(0, &c, 1);
+ 800:	83 ec 04             	sub    $0x4,%esp
+ 803:	6a 01                	push   $0x1
+ 805:	56                   	push   %esi
+ 806:	6a 00                	push   $0x0
+ 808:	e8 1e 01 00 00       	call   92b <read>
+    if(cc < 1)
+ 80d:	83 c4 10             	add    $0x10,%esp
+ 810:	85 c0                	test   %eax,%eax
+ 812:	7e 1d                	jle    831 <gets+0x41>
+      break;
+    buf[i++] = c;
+ 814:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+ 818:	8b 55 08             	mov    0x8(%ebp),%edx
+ 81b:	88 44 1a ff          	mov    %al,-0x1(%edx,%ebx,1)
+    if(c == '\n' || c == '\r')
+ 81f:	3c 0a                	cmp    $0xa,%al
+ 821:	74 10                	je     833 <gets+0x43>
+ 823:	3c 0d                	cmp    $0xd,%al
+ 825:	74 0c                	je     833 <gets+0x43>
+  for(i=0; i+1 < max; ){
+ 827:	89 df                	mov    %ebx,%edi
+ 829:	83 c3 01             	add    $0x1,%ebx
+ 82c:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+ 82f:	7c cf                	jl     800 <gets+0x10>
+ 831:	89 fb                	mov    %edi,%ebx
+      break;
+  }
+  buf[i] = '\0';
+ 833:	8b 45 08             	mov    0x8(%ebp),%eax
+ 836:	c6 04 18 00          	movb   $0x0,(%eax,%ebx,1)
+  return buf;
+}
+ 83a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 83d:	5b                   	pop    %ebx
+ 83e:	5e                   	pop    %esi
+ 83f:	5f                   	pop    %edi
+ 840:	5d                   	pop    %ebp
+ 841:	c3                   	ret
+ 842:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 849:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000850 <stat>:
+
+int
+stat(const char *n, struct stat *st)
+{
+ 850:	55                   	push   %ebp
+ 851:	89 e5                	mov    %esp,%ebp
+ 853:	56                   	push   %esi
+ 854:	53                   	push   %ebx
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+ 855:	83 ec 08             	sub    $0x8,%esp
+ 858:	6a 00                	push   $0x0
+ 85a:	ff 75 08             	push   0x8(%ebp)
+ 85d:	e8 f1 00 00 00       	call   953 <open>
+  if(fd < 0)
+ 862:	83 c4 10             	add    $0x10,%esp
+ 865:	85 c0                	test   %eax,%eax
+ 867:	78 27                	js     890 <stat+0x40>
+    return -1;
+  r = fstat(fd, st);
+ 869:	83 ec 08             	sub    $0x8,%esp
+ 86c:	ff 75 0c             	push   0xc(%ebp)
+ 86f:	89 c3                	mov    %eax,%ebx
+ 871:	50                   	push   %eax
+ 872:	e8 f4 00 00 00       	call   96b <fstat>
+  close(fd);
+ 877:	89 1c 24             	mov    %ebx,(%esp)
+  r = fstat(fd, st);
+ 87a:	89 c6                	mov    %eax,%esi
+  close(fd);
+ 87c:	e8 ba 00 00 00       	call   93b <close>
+  return r;
+ 881:	83 c4 10             	add    $0x10,%esp
+}
+ 884:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 887:	89 f0                	mov    %esi,%eax
+ 889:	5b                   	pop    %ebx
+ 88a:	5e                   	pop    %esi
+ 88b:	5d                   	pop    %ebp
+ 88c:	c3                   	ret
+ 88d:	8d 76 00             	lea    0x0(%esi),%esi
+    return -1;
+ 890:	be ff ff ff ff       	mov    $0xffffffff,%esi
+ 895:	eb ed                	jmp    884 <stat+0x34>
+ 897:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 89e:	66 90                	xchg   %ax,%ax
+
+000008a0 <atoi>:
+
+int
+atoi(const char *s)
+{
+ 8a0:	55                   	push   %ebp
+ 8a1:	89 e5                	mov    %esp,%ebp
+ 8a3:	53                   	push   %ebx
+ 8a4:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  n = 0;
+  while('0' <= *s && *s <= '9')
+ 8a7:	0f be 02             	movsbl (%edx),%eax
+ 8aa:	8d 48 d0             	lea    -0x30(%eax),%ecx
+ 8ad:	80 f9 09             	cmp    $0x9,%cl
+  n = 0;
+ 8b0:	b9 00 00 00 00       	mov    $0x0,%ecx
+  while('0' <= *s && *s <= '9')
+ 8b5:	77 1e                	ja     8d5 <atoi+0x35>
+ 8b7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 8be:	66 90                	xchg   %ax,%ax
+    n = n*10 + *s++ - '0';
+ 8c0:	83 c2 01             	add    $0x1,%edx
+ 8c3:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+ 8c6:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+  while('0' <= *s && *s <= '9')
+ 8ca:	0f be 02             	movsbl (%edx),%eax
+ 8cd:	8d 58 d0             	lea    -0x30(%eax),%ebx
+ 8d0:	80 fb 09             	cmp    $0x9,%bl
+ 8d3:	76 eb                	jbe    8c0 <atoi+0x20>
+  return n;
+}
+ 8d5:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 8d8:	89 c8                	mov    %ecx,%eax
+ 8da:	c9                   	leave
+ 8db:	c3                   	ret
+ 8dc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000008e0 <memmove>:
+
+void*
+memmove(void *vdst, const void *vsrc, int n)
+{
+ 8e0:	55                   	push   %ebp
+ 8e1:	89 e5                	mov    %esp,%ebp
+ 8e3:	57                   	push   %edi
+ 8e4:	56                   	push   %esi
+ 8e5:	8b 45 10             	mov    0x10(%ebp),%eax
+ 8e8:	8b 55 08             	mov    0x8(%ebp),%edx
+ 8eb:	8b 75 0c             	mov    0xc(%ebp),%esi
+  char *dst;
+  const char *src;
+
+  dst = vdst;
+  src = vsrc;
+  while(n-- > 0)
+ 8ee:	85 c0                	test   %eax,%eax
+ 8f0:	7e 13                	jle    905 <memmove+0x25>
+ 8f2:	01 d0                	add    %edx,%eax
+  dst = vdst;
+ 8f4:	89 d7                	mov    %edx,%edi
+ 8f6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 8fd:	8d 76 00             	lea    0x0(%esi),%esi
+    *dst++ = *src++;
+ 900:	a4                   	movsb  %ds:(%esi),%es:(%edi)
+  while(n-- > 0)
+ 901:	39 f8                	cmp    %edi,%eax
+ 903:	75 fb                	jne    900 <memmove+0x20>
+  return vdst;
+}
+ 905:	5e                   	pop    %esi
+ 906:	89 d0                	mov    %edx,%eax
+ 908:	5f                   	pop    %edi
+ 909:	5d                   	pop    %ebp
+ 90a:	c3                   	ret
+
+0000090b <fork>:
+  name: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+SYSCALL(fork)
+ 90b:	b8 01 00 00 00       	mov    $0x1,%eax
+ 910:	cd 40                	int    $0x40
+ 912:	c3                   	ret
+
+00000913 <exit>:
+SYSCALL(exit)
+ 913:	b8 02 00 00 00       	mov    $0x2,%eax
+ 918:	cd 40                	int    $0x40
+ 91a:	c3                   	ret
+
+0000091b <wait>:
+SYSCALL(wait)
+ 91b:	b8 03 00 00 00       	mov    $0x3,%eax
+ 920:	cd 40                	int    $0x40
+ 922:	c3                   	ret
+
+00000923 <pipe>:
+SYSCALL(pipe)
+ 923:	b8 04 00 00 00       	mov    $0x4,%eax
+ 928:	cd 40                	int    $0x40
+ 92a:	c3                   	ret
+
+0000092b <read>:
+SYSCALL(read)
+ 92b:	b8 05 00 00 00       	mov    $0x5,%eax
+ 930:	cd 40                	int    $0x40
+ 932:	c3                   	ret
+
+00000933 <write>:
+SYSCALL(write)
+ 933:	b8 10 00 00 00       	mov    $0x10,%eax
+ 938:	cd 40                	int    $0x40
+ 93a:	c3                   	ret
+
+0000093b <close>:
+SYSCALL(close)
+ 93b:	b8 15 00 00 00       	mov    $0x15,%eax
+ 940:	cd 40                	int    $0x40
+ 942:	c3                   	ret
+
+00000943 <kill>:
+SYSCALL(kill)
+ 943:	b8 06 00 00 00       	mov    $0x6,%eax
+ 948:	cd 40                	int    $0x40
+ 94a:	c3                   	ret
+
+0000094b <exec>:
+SYSCALL(exec)
+ 94b:	b8 07 00 00 00       	mov    $0x7,%eax
+ 950:	cd 40                	int    $0x40
+ 952:	c3                   	ret
+
+00000953 <open>:
+SYSCALL(open)
+ 953:	b8 0f 00 00 00       	mov    $0xf,%eax
+ 958:	cd 40                	int    $0x40
+ 95a:	c3                   	ret
+
+0000095b <mknod>:
+SYSCALL(mknod)
+ 95b:	b8 11 00 00 00       	mov    $0x11,%eax
+ 960:	cd 40                	int    $0x40
+ 962:	c3                   	ret
+
+00000963 <unlink>:
+SYSCALL(unlink)
+ 963:	b8 12 00 00 00       	mov    $0x12,%eax
+ 968:	cd 40                	int    $0x40
+ 96a:	c3                   	ret
+
+0000096b <fstat>:
+SYSCALL(fstat)
+ 96b:	b8 08 00 00 00       	mov    $0x8,%eax
+ 970:	cd 40                	int    $0x40
+ 972:	c3                   	ret
+
+00000973 <link>:
+SYSCALL(link)
+ 973:	b8 13 00 00 00       	mov    $0x13,%eax
+ 978:	cd 40                	int    $0x40
+ 97a:	c3                   	ret
+
+0000097b <mkdir>:
+SYSCALL(mkdir)
+ 97b:	b8 14 00 00 00       	mov    $0x14,%eax
+ 980:	cd 40                	int    $0x40
+ 982:	c3                   	ret
+
+00000983 <chdir>:
+SYSCALL(chdir)
+ 983:	b8 09 00 00 00       	mov    $0x9,%eax
+ 988:	cd 40                	int    $0x40
+ 98a:	c3                   	ret
+
+0000098b <dup>:
+SYSCALL(dup)
+ 98b:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 990:	cd 40                	int    $0x40
+ 992:	c3                   	ret
+
+00000993 <getpid>:
+SYSCALL(getpid)
+ 993:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 998:	cd 40                	int    $0x40
+ 99a:	c3                   	ret
+
+0000099b <sbrk>:
+SYSCALL(sbrk)
+ 99b:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 9a0:	cd 40                	int    $0x40
+ 9a2:	c3                   	ret
+
+000009a3 <sleep>:
+SYSCALL(sleep)
+ 9a3:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 9a8:	cd 40                	int    $0x40
+ 9aa:	c3                   	ret
+
+000009ab <uptime>:
+SYSCALL(uptime)
+ 9ab:	b8 0e 00 00 00       	mov    $0xe,%eax
+ 9b0:	cd 40                	int    $0x40
+ 9b2:	c3                   	ret
+
+000009b3 <cpustat>:
+SYSCALL(cpustat)
+ 9b3:	b8 16 00 00 00       	mov    $0x16,%eax
+ 9b8:	cd 40                	int    $0x40
+ 9ba:	c3                   	ret
+
+000009bb <setpriority>:
+SYSCALL(setpriority)
+ 9bb:	b8 17 00 00 00       	mov    $0x17,%eax
+ 9c0:	cd 40                	int    $0x40
+ 9c2:	c3                   	ret
+
+000009c3 <cpuinfo>:
+SYSCALL(cpuinfo)
+ 9c3:	b8 18 00 00 00       	mov    $0x18,%eax
+ 9c8:	cd 40                	int    $0x40
+ 9ca:	c3                   	ret
+
+000009cb <procinfo>:
+SYSCALL(procinfo)
+ 9cb:	b8 19 00 00 00       	mov    $0x19,%eax
+ 9d0:	cd 40                	int    $0x40
+ 9d2:	c3                   	ret
+
+000009d3 <setgovernor>:
+SYSCALL(setgovernor)
+ 9d3:	b8 1a 00 00 00       	mov    $0x1a,%eax
+ 9d8:	cd 40                	int    $0x40
+ 9da:	c3                   	ret
+
+000009db <sysctl>:
+SYSCALL(sysctl)
+ 9db:	b8 1b 00 00 00       	mov    $0x1b,%eax
+ 9e0:	cd 40                	int    $0x40
+ 9e2:	c3                   	ret
+
+000009e3 <telemetry>:
+SYSCALL(telemetry)
+ 9e3:	b8 1c 00 00 00       	mov    $0x1c,%eax
+ 9e8:	cd 40                	int    $0x40
+ 9ea:	c3                   	ret
+
+000009eb <clock_gettime>:
+SYSCALL(clock_gettime)
+ 9eb:	b8 1d 00 00 00       	mov    $0x1d,%eax
+ 9f0:	cd 40                	int    $0x40
+ 9f2:	c3                   	ret
+
+000009f3 <sched_setaffinity>:
+SYSCALL(sched_setaffinity)
+ 9f3:	b8 1e 00 00 00       	mov    $0x1e,%eax
+ 9f8:	cd 40                	int    $0x40
+ 9fa:	c3                   	ret
+
+000009fb <sched_getaffinity>:
+SYSCALL(sched_getaffinity)
+ 9fb:	b8 1f 00 00 00       	mov    $0x1f,%eax
+ a00:	cd 40                	int    $0x40
+ a02:	c3                   	ret
+
+00000a03 <setqos>:
+SYSCALL(setqos)
+ a03:	b8 20 00 00 00       	mov    $0x20,%eax
+ a08:	cd 40                	int    $0x40
+ a0a:	c3                   	ret
+
+00000a0b <setgroup>:
+SYSCALL(setgroup)
+ a0b:	b8 21 00 00 00       	mov    $0x21,%eax
+ a10:	cd 40                	int    $0x40
+ a12:	c3                   	ret
+
+00000a13 <setquota>:
+SYSCALL(setquota)
+ a13:	b8 22 00 00 00       	mov    $0x22,%eax
+ a18:	cd 40                	int    $0x40
+ a1a:	c3                   	ret
+
+00000a1b <groupinfo>:
+SYSCALL(groupinfo)
+ a1b:	b8 23 00 00 00       	mov    $0x23,%eax
+ a20:	cd 40                	int    $0x40
+ a22:	c3                   	ret
+ a23:	66 90                	xchg   %ax,%ax
+ a25:	66 90                	xchg   %ax,%ax
+ a27:	66 90                	xchg   %ax,%ax
+ a29:	66 90                	xchg   %ax,%ax
+ a2b:	66 90                	xchg   %ax,%ax
+ a2d:	66 90                	xchg   %ax,%ax
+ a2f:	90                   	nop
+
+00000a30 <printint>:
+  write(fd, &c, 1);
+}
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+ a30:	55                   	push   %ebp
+ a31:	89 e5                	mov    %esp,%ebp
+ a33:	57                   	push   %edi
+ a34:	56                   	push   %esi
+ a35:	53                   	push   %ebx
+ a36:	89 cb                	mov    %ecx,%ebx
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+    neg = 1;
+    x = -xx;
+ a38:	89 d1                	mov    %edx,%ecx
+{
+ a3a:	83 ec 3c             	sub    $0x3c,%esp
+ a3d:	89 45 c0             	mov    %eax,-0x40(%ebp)
+  if(sgn && xx < 0){
+ a40:	85 d2                	test   %edx,%edx
+ a42:	0f 89 80 00 00 00    	jns    ac8 <printint+0x98>
+ a48:	f6 45 08 01          	testb  $0x1,0x8(%ebp)
+ a4c:	74 7a                	je     ac8 <printint+0x98>
+    x = -xx;
+ a4e:	f7 d9                	neg    %ecx
+    neg = 1;
+ a50:	b8 01 00 00 00       	mov    $0x1,%eax
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+ a55:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+ a58:	31 f6                	xor    %esi,%esi
+ a5a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  do{
+    buf[i++] = digits[x % base];
+ a60:	89 c8                	mov    %ecx,%eax
+ a62:	31 d2                	xor    %edx,%edx
+ a64:	89 f7                	mov    %esi,%edi
+ a66:	f7 f3                	div    %ebx
+ a68:	8d 76 01             	lea    0x1(%esi),%esi
+ a6b:	0f b6 92 3c 10 00 00 	movzbl 0x103c(%edx),%edx
+ a72:	88 54 35 d7          	mov    %dl,-0x29(%ebp,%esi,1)
+  }while((x /= base) != 0);
+ a76:	89 ca                	mov    %ecx,%edx
+ a78:	89 c1                	mov    %eax,%ecx
+ a7a:	39 da                	cmp    %ebx,%edx
+ a7c:	73 e2                	jae    a60 <printint+0x30>
+  if(neg)
+ a7e:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+ a81:	85 c0                	test   %eax,%eax
+ a83:	74 07                	je     a8c <printint+0x5c>
+    buf[i++] = '-';
+ a85:	c6 44 35 d8 2d       	movb   $0x2d,-0x28(%ebp,%esi,1)
+    buf[i++] = digits[x % base];
+ a8a:	89 f7                	mov    %esi,%edi
+ a8c:	8d 5d d8             	lea    -0x28(%ebp),%ebx
+ a8f:	8b 75 c0             	mov    -0x40(%ebp),%esi
+ a92:	01 df                	add    %ebx,%edi
+ a94:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+  while(--i >= 0)
+    putc(fd, buf[i]);
+ a98:	0f b6 07             	movzbl (%edi),%eax
+  write(fd, &c, 1);
+ a9b:	83 ec 04             	sub    $0x4,%esp
+ a9e:	88 45 d7             	mov    %al,-0x29(%ebp)
+ aa1:	8d 45 d7             	lea    -0x29(%ebp),%eax
+ aa4:	6a 01                	push   $0x1
+ aa6:	50                   	push   %eax
+ aa7:	56                   	push   %esi
+ aa8:	e8 86 fe ff ff       	call   933 <write>
+  while(--i >= 0)
+ aad:	89 f8                	mov    %edi,%eax
+ aaf:	83 c4 10             	add    $0x10,%esp
+ ab2:	83 ef 01             	sub    $0x1,%edi
+ ab5:	39 d8                	cmp    %ebx,%eax
+ ab7:	75 df                	jne    a98 <printint+0x68>
+}
+ ab9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ abc:	5b                   	pop    %ebx
+ abd:	5e                   	pop    %esi
+ abe:	5f                   	pop    %edi
+ abf:	5d                   	pop    %ebp
+ ac0:	c3                   	ret
+ ac1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  neg = 0;
+ ac8:	31 c0                	xor    %eax,%eax
+ aca:	eb 89                	jmp    a55 <printint+0x25>
+ acc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000ad0 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, const char *fmt, ...)
+{
+ ad0:	55                   	push   %ebp
+ ad1:	89 e5                	mov    %esp,%ebp
+ ad3:	57                   	push   %edi
+ ad4:	56                   	push   %esi
+ ad5:	53                   	push   %ebx
+ ad6:	83 ec 2c             	sub    $0x2c,%esp
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+  ap = (uint*)(void*)&fmt + 1;
+  for(i = 0; fmt[i]; i++){
+ ad9:	8b 75 0c             	mov    0xc(%ebp),%esi
+{
+ adc:	8b 7d 08             	mov    0x8(%ebp),%edi
+  for(i = 0; fmt[i]; i++){
+ adf:	0f b6 1e             	movzbl (%esi),%ebx
+ ae2:	83 c6 01             	add    $0x1,%esi
+ ae5:	84 db                	test   %bl,%bl
+ ae7:	74 67                	je     b50 <printf+0x80>
+ ae9:	8d 4d 10             	lea    0x10(%ebp),%ecx
+ aec:	31 d2                	xor    %edx,%edx
+ aee:	89 4d d0             	mov    %ecx,-0x30(%ebp)
+ af1:	eb 34                	jmp    b27 <printf+0x57>
+ af3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ af7:	90                   	nop
+ af8:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+        state = '%';
+ afb:	ba 25 00 00 00       	mov    $0x25,%edx
+      if(c == '%'){
+ b00:	83 f8 25             	cmp    $0x25,%eax
+ b03:	74 18                	je     b1d <printf+0x4d>
+  write(fd, &c, 1);
+ b05:	83 ec 04             	sub    $0x4,%esp
+ b08:	8d 45 e7             	lea    -0x19(%ebp),%eax
+ b0b:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ b0e:	6a 01                	push   $0x1
+ b10:	50                   	push   %eax
+ b11:	57                   	push   %edi
+ b12:	e8 1c fe ff ff       	call   933 <write>
+ b17:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+      } else {
+        putc(fd, c);
+ b1a:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; fmt[i]; i++){
+ b1d:	0f b6 1e             	movzbl (%esi),%ebx
+ b20:	83 c6 01             	add    $0x1,%esi
+ b23:	84 db                	test   %bl,%bl
+ b25:	74 29                	je     b50 <printf+0x80>
+    c = fmt[i] & 0xff;
+ b27:	0f b6 c3             	movzbl %bl,%eax
+    if(state == 0){
+ b2a:	85 d2                	test   %edx,%edx
+ b2c:	74 ca                	je     af8 <printf+0x28>
+      }
+    } else if(state == '%'){
+ b2e:	83 fa 25             	cmp    $0x25,%edx
+ b31:	75 ea                	jne    b1d <printf+0x4d>
+      if(c == 'd'){
+ b33:	83 f8 25             	cmp    $0x25,%eax
+ b36:	0f 84 24 01 00 00    	je     c60 <printf+0x190>
+ b3c:	83 e8 63             	sub    $0x63,%eax
+ b3f:	83 f8 15             	cmp    $0x15,%eax
+ b42:	77 1c                	ja     b60 <printf+0x90>
+ b44:	ff 24 85 e4 0f 00 00 	jmp    *0xfe4(,%eax,4)
+ b4b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ b4f:	90                   	nop
+        putc(fd, c);
+      }
+      state = 0;
+    }
+  }
+}
+ b50:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ b53:	5b                   	pop    %ebx
+ b54:	5e                   	pop    %esi
+ b55:	5f                   	pop    %edi
+ b56:	5d                   	pop    %ebp
+ b57:	c3                   	ret
+ b58:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ b5f:	90                   	nop
+  write(fd, &c, 1);
+ b60:	83 ec 04             	sub    $0x4,%esp
+ b63:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ b66:	c6 45 e7 25          	movb   $0x25,-0x19(%ebp)
+ b6a:	6a 01                	push   $0x1
+ b6c:	52                   	push   %edx
+ b6d:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+ b70:	57                   	push   %edi
+ b71:	e8 bd fd ff ff       	call   933 <write>
+ b76:	83 c4 0c             	add    $0xc,%esp
+ b79:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ b7c:	6a 01                	push   $0x1
+ b7e:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+ b81:	52                   	push   %edx
+ b82:	57                   	push   %edi
+ b83:	e8 ab fd ff ff       	call   933 <write>
+        putc(fd, c);
+ b88:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ b8b:	31 d2                	xor    %edx,%edx
+ b8d:	eb 8e                	jmp    b1d <printf+0x4d>
+ b8f:	90                   	nop
+        printint(fd, *ap, 16, 0);
+ b90:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+ b93:	83 ec 0c             	sub    $0xc,%esp
+ b96:	b9 10 00 00 00       	mov    $0x10,%ecx
+ b9b:	8b 13                	mov    (%ebx),%edx
+ b9d:	6a 00                	push   $0x0
+ b9f:	89 f8                	mov    %edi,%eax
+        ap++;
+ ba1:	83 c3 04             	add    $0x4,%ebx
+        printint(fd, *ap, 16, 0);
+ ba4:	e8 87 fe ff ff       	call   a30 <printint>
+        ap++;
+ ba9:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+ bac:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ baf:	31 d2                	xor    %edx,%edx
+ bb1:	e9 67 ff ff ff       	jmp    b1d <printf+0x4d>
+ bb6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ bbd:	8d 76 00             	lea    0x0(%esi),%esi
+        s = (char*)*ap;
+ bc0:	8b 45 d0             	mov    -0x30(%ebp),%eax
+ bc3:	8b 18                	mov    (%eax),%ebx
+        ap++;
+ bc5:	83 c0 04             	add    $0x4,%eax
+ bc8:	89 45 d0             	mov    %eax,-0x30(%ebp)
+        if(s == 0)
+ bcb:	85 db                	test   %ebx,%ebx
+ bcd:	0f 84 9d 00 00 00    	je     c70 <printf+0x1a0>
+        while(*s != 0){
+ bd3:	0f b6 03             	movzbl (%ebx),%eax
+      state = 0;
+ bd6:	31 d2                	xor    %edx,%edx
+        while(*s != 0){
+ bd8:	84 c0                	test   %al,%al
+ bda:	0f 84 3d ff ff ff    	je     b1d <printf+0x4d>
+ be0:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ be3:	89 75 d4             	mov    %esi,-0x2c(%ebp)
+ be6:	89 de                	mov    %ebx,%esi
+ be8:	89 d3                	mov    %edx,%ebx
+ bea:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  write(fd, &c, 1);
+ bf0:	83 ec 04             	sub    $0x4,%esp
+ bf3:	88 45 e7             	mov    %al,-0x19(%ebp)
+          s++;
+ bf6:	83 c6 01             	add    $0x1,%esi
+  write(fd, &c, 1);
+ bf9:	6a 01                	push   $0x1
+ bfb:	53                   	push   %ebx
+ bfc:	57                   	push   %edi
+ bfd:	e8 31 fd ff ff       	call   933 <write>
+        while(*s != 0){
+ c02:	0f b6 06             	movzbl (%esi),%eax
+ c05:	83 c4 10             	add    $0x10,%esp
+ c08:	84 c0                	test   %al,%al
+ c0a:	75 e4                	jne    bf0 <printf+0x120>
+      state = 0;
+ c0c:	8b 75 d4             	mov    -0x2c(%ebp),%esi
+ c0f:	31 d2                	xor    %edx,%edx
+ c11:	e9 07 ff ff ff       	jmp    b1d <printf+0x4d>
+ c16:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ c1d:	8d 76 00             	lea    0x0(%esi),%esi
+        printint(fd, *ap, 10, 1);
+ c20:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+ c23:	83 ec 0c             	sub    $0xc,%esp
+ c26:	b9 0a 00 00 00       	mov    $0xa,%ecx
+ c2b:	8b 13                	mov    (%ebx),%edx
+ c2d:	6a 01                	push   $0x1
+ c2f:	e9 6b ff ff ff       	jmp    b9f <printf+0xcf>
+ c34:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+        putc(fd, *ap);
+ c38:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  write(fd, &c, 1);
+ c3b:	83 ec 04             	sub    $0x4,%esp
+ c3e:	8d 55 e7             	lea    -0x19(%ebp),%edx
+        putc(fd, *ap);
+ c41:	8b 03                	mov    (%ebx),%eax
+        ap++;
+ c43:	83 c3 04             	add    $0x4,%ebx
+        putc(fd, *ap);
+ c46:	88 45 e7             	mov    %al,-0x19(%ebp)
+  write(fd, &c, 1);
+ c49:	6a 01                	push   $0x1
+ c4b:	52                   	push   %edx
+ c4c:	57                   	push   %edi
+ c4d:	e8 e1 fc ff ff       	call   933 <write>
+        ap++;
+ c52:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+ c55:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ c58:	31 d2                	xor    %edx,%edx
+ c5a:	e9 be fe ff ff       	jmp    b1d <printf+0x4d>
+ c5f:	90                   	nop
+  write(fd, &c, 1);
+ c60:	83 ec 04             	sub    $0x4,%esp
+ c63:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ c66:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ c69:	6a 01                	push   $0x1
+ c6b:	e9 11 ff ff ff       	jmp    b81 <printf+0xb1>
+ c70:	b8 28 00 00 00       	mov    $0x28,%eax
+          s = "(null)";
+ c75:	bb db 0f 00 00       	mov    $0xfdb,%ebx
+ c7a:	e9 61 ff ff ff       	jmp    be0 <printf+0x110>
+ c7f:	90                   	nop
+
+00000c80 <free>:
+static Header base;
+static Header *freep;
+
+void
+free(void *ap)
+{
+ c80:	55                   	push   %ebp
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ c81:	a1 20 29 00 00       	mov    0x2920,%eax
+{
+ c86:	89 e5                	mov    %esp,%ebp
+ c88:	57                   	push   %edi
+ c89:	56                   	push   %esi
+ c8a:	53                   	push   %ebx
+ c8b:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  bp = (Header*)ap - 1;
+ c8e:	8d 4b f8             	lea    -0x8(%ebx),%ecx
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ c91:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ c98:	89 c2                	mov    %eax,%edx
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ c9a:	8b 00                	mov    (%eax),%eax
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ c9c:	39 ca                	cmp    %ecx,%edx
+ c9e:	73 30                	jae    cd0 <free+0x50>
+ ca0:	39 c1                	cmp    %eax,%ecx
+ ca2:	72 04                	jb     ca8 <free+0x28>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ ca4:	39 c2                	cmp    %eax,%edx
+ ca6:	72 f0                	jb     c98 <free+0x18>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+ ca8:	8b 73 fc             	mov    -0x4(%ebx),%esi
+ cab:	8d 3c f1             	lea    (%ecx,%esi,8),%edi
+ cae:	39 f8                	cmp    %edi,%eax
+ cb0:	74 2e                	je     ce0 <free+0x60>
+    bp->s.size += p->s.ptr->s.size;
+    bp->s.ptr = p->s.ptr->s.ptr;
+ cb2:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  } else
+    bp->s.ptr = p->s.ptr;
+  if(p + p->s.size == bp){
+ cb5:	8b 42 04             	mov    0x4(%edx),%eax
+ cb8:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+ cbb:	39 f1                	cmp    %esi,%ecx
+ cbd:	74 38                	je     cf7 <free+0x77>
+    p->s.size += bp->s.size;
+    p->s.ptr = bp->s.ptr;
+ cbf:	89 0a                	mov    %ecx,(%edx)
+  } else
+    p->s.ptr = bp;
+  freep = p;
+}
+ cc1:	5b                   	pop    %ebx
+  freep = p;
+ cc2:	89 15 20 29 00 00    	mov    %edx,0x2920
+}
+ cc8:	5e                   	pop    %esi
+ cc9:	5f                   	pop    %edi
+ cca:	5d                   	pop    %ebp
+ ccb:	c3                   	ret
+ ccc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ cd0:	39 c1                	cmp    %eax,%ecx
+ cd2:	72 d0                	jb     ca4 <free+0x24>
+ cd4:	eb c2                	jmp    c98 <free+0x18>
+ cd6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ cdd:	8d 76 00             	lea    0x0(%esi),%esi
+    bp->s.size += p->s.ptr->s.size;
+ ce0:	03 70 04             	add    0x4(%eax),%esi
+ ce3:	89 73 fc             	mov    %esi,-0x4(%ebx)
+    bp->s.ptr = p->s.ptr->s.ptr;
+ ce6:	8b 02                	mov    (%edx),%eax
+ ce8:	8b 00                	mov    (%eax),%eax
+ cea:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  if(p + p->s.size == bp){
+ ced:	8b 42 04             	mov    0x4(%edx),%eax
+ cf0:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+ cf3:	39 f1                	cmp    %esi,%ecx
+ cf5:	75 c8                	jne    cbf <free+0x3f>
+    p->s.size += bp->s.size;
+ cf7:	03 43 fc             	add    -0x4(%ebx),%eax
+  freep = p;
+ cfa:	89 15 20 29 00 00    	mov    %edx,0x2920
+    p->s.size += bp->s.size;
+ d00:	89 42 04             	mov    %eax,0x4(%edx)
+    p->s.ptr = bp->s.ptr;
+ d03:	8b 4b f8             	mov    -0x8(%ebx),%ecx
+ d06:	89 0a                	mov    %ecx,(%edx)
+}
+ d08:	5b                   	pop    %ebx
+ d09:	5e                   	pop    %esi
+ d0a:	5f                   	pop    %edi
+ d0b:	5d                   	pop    %ebp
+ d0c:	c3                   	ret
+ d0d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000d10 <malloc>:
+  return freep;
+}
+
+void*
+malloc(uint nbytes)
+{
+ d10:	55                   	push   %ebp
+ d11:	89 e5                	mov    %esp,%ebp
+ d13:	57                   	push   %edi
+ d14:	56                   	push   %esi
+ d15:	53                   	push   %ebx
+ d16:	83 ec 0c             	sub    $0xc,%esp
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ d19:	8b 45 08             	mov    0x8(%ebp),%eax
+  if((prevp = freep) == 0){
+ d1c:	8b 15 20 29 00 00    	mov    0x2920,%edx
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ d22:	8d 78 07             	lea    0x7(%eax),%edi
+ d25:	c1 ef 03             	shr    $0x3,%edi
+ d28:	83 c7 01             	add    $0x1,%edi
+  if((prevp = freep) == 0){
+ d2b:	85 d2                	test   %edx,%edx
+ d2d:	0f 84 8d 00 00 00    	je     dc0 <malloc+0xb0>
+    base.s.ptr = freep = prevp = &base;
+    base.s.size = 0;
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ d33:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+ d35:	8b 48 04             	mov    0x4(%eax),%ecx
+ d38:	39 f9                	cmp    %edi,%ecx
+ d3a:	73 64                	jae    da0 <malloc+0x90>
+  if(nu < 4096)
+ d3c:	bb 00 10 00 00       	mov    $0x1000,%ebx
+ d41:	39 df                	cmp    %ebx,%edi
+ d43:	0f 43 df             	cmovae %edi,%ebx
+  p = sbrk(nu * sizeof(Header));
+ d46:	8d 34 dd 00 00 00 00 	lea    0x0(,%ebx,8),%esi
+ d4d:	eb 0a                	jmp    d59 <malloc+0x49>
+ d4f:	90                   	nop
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ d50:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+ d52:	8b 48 04             	mov    0x4(%eax),%ecx
+ d55:	39 f9                	cmp    %edi,%ecx
+ d57:	73 47                	jae    da0 <malloc+0x90>
+        p->s.size = nunits;
+      }
+      freep = prevp;
+      return (void*)(p + 1);
+    }
+    if(p == freep)
+ d59:	89 c2                	mov    %eax,%edx
+ d5b:	39 05 20 29 00 00    	cmp    %eax,0x2920
+ d61:	75 ed                	jne    d50 <malloc+0x40>
+  p = sbrk(nu * sizeof(Header));
+ d63:	83 ec 0c             	sub    $0xc,%esp
+ d66:	56                   	push   %esi
+ d67:	e8 2f fc ff ff       	call   99b <sbrk>
+  if(p == (char*)-1)
+ d6c:	83 c4 10             	add    $0x10,%esp
+ d6f:	83 f8 ff             	cmp    $0xffffffff,%eax
+ d72:	74 1c                	je     d90 <malloc+0x80>
+  hp->s.size = nu;
+ d74:	89 58 04             	mov    %ebx,0x4(%eax)
+  free((void*)(hp + 1));
+ d77:	83 ec 0c             	sub    $0xc,%esp
+ d7a:	83 c0 08             	add    $0x8,%eax
+ d7d:	50                   	push   %eax
+ d7e:	e8 fd fe ff ff       	call   c80 <free>
+  return freep;
+ d83:	8b 15 20 29 00 00    	mov    0x2920,%edx
+      if((p = morecore(nunits)) == 0)
+ d89:	83 c4 10             	add    $0x10,%esp
+ d8c:	85 d2                	test   %edx,%edx
+ d8e:	75 c0                	jne    d50 <malloc+0x40>
+        return 0;
+  }
+}
+ d90:	8d 65 f4             	lea    -0xc(%ebp),%esp
+        return 0;
+ d93:	31 c0                	xor    %eax,%eax
+}
+ d95:	5b                   	pop    %ebx
+ d96:	5e                   	pop    %esi
+ d97:	5f                   	pop    %edi
+ d98:	5d                   	pop    %ebp
+ d99:	c3                   	ret
+ d9a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+      if(p->s.size == nunits)
+ da0:	39 cf                	cmp    %ecx,%edi
+ da2:	74 4c                	je     df0 <malloc+0xe0>
+        p->s.size -= nunits;
+ da4:	29 f9                	sub    %edi,%ecx
+ da6:	89 48 04             	mov    %ecx,0x4(%eax)
+        p += p->s.size;
+ da9:	8d 04 c8             	lea    (%eax,%ecx,8),%eax
+        p->s.size = nunits;
+ dac:	89 78 04             	mov    %edi,0x4(%eax)
+      freep = prevp;
+ daf:	89 15 20 29 00 00    	mov    %edx,0x2920
+}
+ db5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+      return (void*)(p + 1);
+ db8:	83 c0 08             	add    $0x8,%eax
+}
+ dbb:	5b                   	pop    %ebx
+ dbc:	5e                   	pop    %esi
+ dbd:	5f                   	pop    %edi
+ dbe:	5d                   	pop    %ebp
+ dbf:	c3                   	ret
+    base.s.ptr = freep = prevp = &base;
+ dc0:	c7 05 20 29 00 00 24 	movl   $0x2924,0x2920
+ dc7:	29 00 00 
+    base.s.size = 0;
+ dca:	b8 24 29 00 00       	mov    $0x2924,%eax
+    base.s.ptr = freep = prevp = &base;
+ dcf:	c7 05 24 29 00 00 24 	movl   $0x2924,0x2924
+ dd6:	29 00 00 
+    base.s.size = 0;
+ dd9:	c7 05 28 29 00 00 00 	movl   $0x0,0x2928
+ de0:	00 00 00 
+    if(p->s.size >= nunits){
+ de3:	e9 54 ff ff ff       	jmp    d3c <malloc+0x2c>
+ de8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ def:	90                   	nop
+        prevp->s.ptr = p->s.ptr;
+ df0:	8b 08                	mov    (%eax),%ecx
+ df2:	89 0a                	mov    %ecx,(%edx)
+ df4:	eb b9                	jmp    daf <malloc+0x9f>
@@ -0,0 +1,285 @@
+#include "types.h"
+#include "stat.h"
+#include "user.h"
+#include "fcntl.h"
+
+// Trace-driven workload generator for SPAS.
+//
+// Reads a workload description and reproduces it phase by phase,
+// sampling cpustat() while each phase runs.  Each non-blank line of
+// the description that does not start with '#' is one phase:
+//
+//   name duty nproc io seconds
+//
+//   duty    percent of each slot a worker is busy (0-100)
+//   nproc   number of worker processes (1-MAXWORKERS)
+//   io      percent of the busy time spent writing to disk (0-100)
+//   seconds phase duration
+//
+// Busy time is burned spinning until an uptime() deadline, so a busy
+// share stays a share of wall time whatever the frequency level;
+// idle time is spent in sleep().  Every telemetry sample taken while
+// a phase runs, one per analytics period, is printed as CSV (to
+// stdout, or to the file given with -o) in the same column order
+// spassim expects with -c 2.
+//
+// Usage: workload [-o outfile] file
+
+#define MAXWORKERS 16
+#define MAXPHASES  32
+#define SLOT       20    // ticks per busy/idle cycle
+#define IOBLOCKS   8     // blocks per scratch file; rewritten in place
+
+struct phase {
+  char name[16];
+  int duty;
+  int nproc;
+  int io;
+  int seconds;
+};
+
+struct phase phases[MAXPHASES];
+int nphase;
+uint seq;        // Telemetry cursor
+char iobuf[512];
+char *freq_str[] = { "LOW", "MEDIUM", "HIGH" };
+
+// Stay busy until tick end.
+static void
+spin(uint end)
+{
+  while(uptime() < end)
+    ;
+}
+
+// Skip spaces; return pointer to the next word, or 0 at end of line.
+static char*
+nextword(char **pp)
+{
+  char *p, *w;
+
+  p = *pp;
+  while(*p == ' ' || *p == '\t')
+    p++;
+  if(*p == 0 || *p == '\n'){
+    *pp = p;
+    return 0;
+  }
+  w = p;
+  while(*p && *p != ' ' && *p != '\t' && *p != '\n')
+    p++;
+  if(*p && *p != '\n')
+    *p++ = 0;
+  *pp = p;
+  return w;
+}
+
+static int
+clamp(int v, int lo, int hi)
+{
+  if(v < lo)
+    return lo;
+  if(v > hi)
+    return hi;
+  return v;
+}
+
+// Parse one description line into phases[nphase].
+static int
+parseline(char *line, int lineno)
+{
+  char *p, *w[5];
+  struct phase *ph;
+  int i;
+
+  p = line;
+  for(i = 0; i < 5; i++)
+    if((w[i] = nextword(&p)) == 0)
+      break;
+  if(i == 0 || w[0][0] == '#')
+    return 0;
+  if(i < 5){
+    printf(2, "workload: line %d: want name duty nproc io seconds\n", lineno);
+    return -1;
+  }
+  if(nphase == MAXPHASES){
+    printf(2, "workload: too many phases (max %d)\n", MAXPHASES);
+    return -1;
+  }
+  ph = &phases[nphase++];
+  memmove(ph->name, w[0], sizeof(ph->name) - 1);
+  ph->name[sizeof(ph->name) - 1] = 0;
+  ph->duty = clamp(atoi(w[1]), 0, 100);
+  ph->nproc = clamp(atoi(w[2]), 1, MAXWORKERS);
+  ph->io = clamp(atoi(w[3]), 0, 100);
+  ph->seconds = clamp(atoi(w[4]), 1, 3600);
+  return 0;
+}
+
+static int
+readdesc(char *path)
+{
+  static char buf[4096];
+  char *line, *p;
+  int fd, n, lineno;
+
+  if((fd = open(path, O_RDONLY)) < 0){
+    printf(2, "workload: cannot open %s\n", path);
+    return -1;
+  }
+  n = read(fd, buf, sizeof(buf) - 1);
+  close(fd);
+  if(n < 0){
+    printf(2, "workload: cannot read %s\n", path);
+    return -1;
+  }
+  buf[n] = 0;
+
+  lineno = 0;
+  for(line = buf; *line; line = p){
+    lineno++;
+    p = strchr(line, '\n');
+    if(p)
+      *p++ = 0;
+    else
+      p = line + strlen(line);
+    if(parseline(line, lineno) < 0)
+      return -1;
+  }
+  return 0;
+}
+
+// Write blocks to the worker's scratch file until tick end.
+// Each open starts again at offset 0, so the file never grows
+// beyond IOBLOCKS blocks.
+static void
+doio(char *path, uint end)
+{
+  int fd, i;
+
+  while(uptime() < end){
+    if((fd = open(path, O_CREATE | O_WRONLY)) < 0)
+      return;
+    for(i = 0; i < IOBLOCKS && uptime() < end; i++)
+      if(write(fd, iobuf, sizeof(iobuf)) != sizeof(iobuf))
+        break;
+    close(fd);
+    if(i < IOBLOCKS && uptime() < end)
+      return;  // write failed
+  }
+}
+
+// Worker body: repeat busy/idle slots until the phase ends.
+static void
+worker(struct phase *ph, int id, uint end)
+{
+  char path[] = "wl.io.a";
+  int busy, io;
+  uint now;
+
+  path[6] = 'a' + id;
+  busy = ph->duty * SLOT / 100;
+  io = busy * ph->io / 100;
+  while((now = uptime()) < end){
+    if(io > 0)
+      doio(path, now + io);
+    if(busy - io > 0)
+      spin(now + busy);
+    if(SLOT - busy > 0)
+      sleep(SLOT - busy);
+  }
+  if(io > 0)
+    unlink(path);
+  exit();
+}
+
+// Print the telemetry samples taken until tick end; telemetry()
+// blocks until the next one, so none are skipped.
+static void
+sample(int fd, struct phase *ph, uint end)
+{
+  struct telemetry st;
+  int fl;
+
+  do {
+    if(telemetry(&seq, &st, 1) != 1){
+      printf(2, "workload: telemetry failed\n");
+      return;
+    }
+    if(st.dropped)
+      printf(2, "workload: %d samples dropped\n", st.dropped);
+    fl = st.frequency_level;
+    if(fl < 0 || fl > 2)
+      fl = 1;
+    printf(fd, "%s,%d,%d,%d,%s,%d.%d,%d,%d\n", ph->name, st.tick,
+           st.load, st.predicted_load, freq_str[fl], st.temp / 10,
+           st.temp % 10, st.thresh_low_med, st.thresh_med_high);
+  } while(st.tick < end);
+}
+
+static void
+runphase(int fd, struct phase *ph)
+{
+  int i, pid;
+  uint end;
+
+  printf(2, "workload: phase %s: duty %d%% nproc %d io %d%% for %ds\n",
+         ph->name, ph->duty, ph->nproc, ph->io, ph->seconds);
+  end = uptime() + ph->seconds * 100;
+  for(i = 0; i < ph->nproc; i++){
+    pid = fork();
+    if(pid < 0){
+      printf(2, "workload: fork failed\n");
+      break;
+    }
+    if(pid == 0)
+      worker(ph, i, end);
+  }
+  sample(fd, ph, end);
+  while(wait() >= 0)
+    ;
+}
+
+int
+main(int argc, char *argv[])
+{
+  int i, fd;
+  char *desc, *out;
+
+  desc = out = 0;
+  for(i = 1; i < argc; i++){
+    if(strcmp(argv[i], "-o") == 0 && i + 1 < argc)
+      out = argv[++i];
+    else
+      desc = argv[i];
+  }
+  if(desc == 0){
+    printf(2, "usage: workload [-o outfile] file\n");
+    exit();
+  }
+  if(readdesc(desc) < 0)
+    exit();
+  if(nphase == 0){
+    printf(2, "workload: no phases in %s\n", desc);
+    exit();
+  }
+
+  fd = 1;
+  if(out){
+    unlink(out);
+    if((fd = open(out, O_CREATE | O_WRONLY)) < 0){
+      printf(2, "workload: cannot create %s\n", out);
+      exit();
+    }
+  }
+
+  memset(iobuf, 'w', sizeof(iobuf));
+
+  printf(fd, "phase,tick,load,predicted,freq,temp,thresh_low_med,thresh_med_high\n");
+  for(i = 0; i < nphase; i++)
+    runphase(fd, &phases[i]);
+
+  if(fd != 1)
+    close(fd);
+  exit();
+}
@@ -117,6 +117,15 @@ sti(void)
   asm volatile("sti");
 }
 
+static inline uint64
+rdtsc(void)
+{
+  uint64 t;
+
+  asm volatile("rdtsc" : "=A" (t));
+  return t;
+}
+
 static inline uint
 xchg(volatile uint *addr, uint newval)
 {